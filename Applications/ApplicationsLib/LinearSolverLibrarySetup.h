@@ -21,6 +21,7 @@
 #include "NumLib/DOF/GlobalMatrixProviders.h"
 
 #if defined(USE_PETSC)
+#include <logog/include/logog.hpp>
 #include <petsc.h>
 #include <mpi.h>
 namespace ApplicationsLib
@@ -29,7 +30,18 @@ struct LinearSolverLibrarySetup final
 {
     LinearSolverLibrarySetup(int argc, char* argv[])
     {
-        MPI_Init(&argc, &argv);
+        // The threaded assembly only calls MPI from the main thread, which
+        // allows the combination of MPI ranks and OpenMP threads.
+        int provided_thread_support;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED,
+                        &provided_thread_support);
+        if (provided_thread_support < MPI_THREAD_FUNNELED)
+        {
+            WARN(
+                "The MPI library does not support the use of threads. Use "
+                "the serial assembly executor, or run with one OpenMP thread "
+                "per rank.");
+        }
         char help[] = "ogs6 with PETSc \n";
         PetscInitialize(&argc, &argv, nullptr, help);
         MPI_Comm_set_errhandler(PETSC_COMM_WORLD, MPI_ERRORS_RETURN);
@@ -15,6 +15,7 @@
 
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/LogogAsyncCout.h"
 #include "BaseLib/LogogSimpleFormatter.h"
 
 namespace ApplicationsLib
@@ -46,6 +47,14 @@ public:
         logog_cout->SetFormatter(*fmt);
     }
 
+    /// Writes the log messages in a background thread.
+    /// \see BaseLib::LogogAsyncCout
+    void enableAsynchronousOutput()
+    {
+        logog_cout = std::make_unique<BaseLib::LogogAsyncCout>();
+        logog_cout->SetFormatter(*fmt);
+    }
+
     void setLevel(LOGOG_LEVEL_TYPE level)
     {
         logog::SetDefaultLevel(level);
@@ -77,7 +86,7 @@ public:
 
 private:
     std::unique_ptr<logog::Formatter> fmt;
-    std::unique_ptr<logog::Cout> logog_cout;
+    std::unique_ptr<logog::Target> logog_cout;
 };
 
 }  // namespace ApplicationsLib
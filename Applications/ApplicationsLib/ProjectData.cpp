@@ -15,8 +15,14 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
 #include <logog/include/logog.hpp>
+#include <map>
+#include <mutex>
 #include <set>
+#include <sstream>
 
 #ifdef OGS_USE_PYTHON
 #include <pybind11/eval.h>
@@ -25,6 +31,7 @@
 #include "BaseLib/Algorithm.h"
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/FileTools.h"
+#include "BaseLib/Timing.h"
 
 #include "GeoLib/GEOObjects.h"
 #include "MaterialLib/MPL/CreateMedium.h"
@@ -32,7 +39,10 @@
 #include "MeshGeoToolsLib/ConstructMeshesFromGeometries.h"
 #include "MeshGeoToolsLib/CreateSearchLength.h"
 #include "MeshGeoToolsLib/SearchLength.h"
+#include "MeshLib/Elements/Element.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 
 #include "NumLib/ODESolver/ConvergenceCriterion.h"
 #include "ProcessLib/CreateJacobianAssembler.h"
@@ -41,6 +51,7 @@
 // FileIO
 #include "GeoLib/IO/XmlIO/Boost/BoostXmlGmlInterface.h"
 #include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/IO/writeMeshToFile.h"
 
 #include "ParameterLib/ConstantParameter.h"
 #include "ParameterLib/Utils.h"
@@ -125,40 +136,240 @@ void readGeometry(std::string const& fname, GeoLib::GEOObjects& geo_objects)
     gml_reader.readFile(fname);
 }
 
-std::unique_ptr<MeshLib::Mesh> readSingleMesh(
-    BaseLib::ConfigTree const& mesh_config_parameter,
-    std::string const& project_directory)
+/// FNV-1a hash of a byte sequence, continuing from the given hash value.
+std::uint64_t hashBytes(void const* const data, std::size_t const size,
+                        std::uint64_t hash = 14695981039346656037ull)
 {
-    std::string const mesh_file = BaseLib::copyPathToFileName(
-        mesh_config_parameter.getValue<std::string>(), project_directory);
-    DBUG("Reading mesh file '%s'.", mesh_file.c_str());
+    auto const* const bytes = static_cast<unsigned char const*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
 
-    auto mesh = std::unique_ptr<MeshLib::Mesh>(
-        MeshLib::IO::readMeshFromFile(mesh_file));
-    if (!mesh)
+/// Key of the geometry search results for the given bulk mesh, geometry file
+/// and search configuration.
+std::uint64_t computeGeometrySearchKey(MeshLib::Mesh const& mesh,
+                                       std::string const& geometry_file,
+                                       double const search_length,
+                                       bool const multiple_nodes_allowed)
+{
+    std::ifstream in(geometry_file, std::ios::binary);
+    std::string const geometry((std::istreambuf_iterator<char>(in)),
+                               std::istreambuf_iterator<char>());
+    std::uint64_t key = hashBytes(geometry.data(), geometry.size());
+
+    key = hashBytes(&search_length, sizeof(search_length), key);
+    key = hashBytes(&multiple_nodes_allowed, sizeof(multiple_nodes_allowed),
+                    key);
+
+    for (auto const* node : mesh.getNodes())
     {
-        OGS_FATAL("Could not read mesh from '%s' file. No mesh added.",
-                  mesh_file.c_str());
+        key = hashBytes(node->getCoords(), 3 * sizeof(double), key);
+    }
+    for (auto const* element : mesh.getElements())
+    {
+        auto const cell_type = element->getCellType();
+        key = hashBytes(&cell_type, sizeof(cell_type), key);
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+        {
+            std::size_t const node_id = element->getNodeIndex(i);
+            key = hashBytes(&node_id, sizeof(node_id), key);
+        }
     }
+    return key;
+}
+
+/// The geometry search cache consists of an index file listing the mesh names
+/// and a mesh file for each mesh, all starting with the given prefix.
+std::string geometrySearchCacheIndexFile(std::string const& prefix)
+{
+    return prefix + ".txt";
+}
+
+std::string geometrySearchCacheMeshFile(std::string const& prefix,
+                                        std::size_t const mesh_number)
+{
+    return prefix + "_" + std::to_string(mesh_number) + ".vtu";
+}
+
+/// Reads the meshes of a previous geometry search. Returns an empty vector if
+/// there is no complete cache.
+std::vector<std::unique_ptr<MeshLib::Mesh>> readGeometrySearchCache(
+    std::string const& prefix)
+{
+    std::ifstream index(geometrySearchCacheIndexFile(prefix));
+    if (!index)
+    {
+        return {};
+    }
+
+    std::vector<std::unique_ptr<MeshLib::Mesh>> meshes;
+    std::string mesh_name;
+    while (std::getline(index, mesh_name))
+    {
+        std::unique_ptr<MeshLib::Mesh> mesh(MeshLib::IO::readMeshFromFile(
+            geometrySearchCacheMeshFile(prefix, meshes.size())));
+        if (!mesh)
+        {
+            WARN("Incomplete geometry search cache '%s', searching again.",
+                 geometrySearchCacheIndexFile(prefix).c_str());
+            return {};
+        }
+        mesh->setName(mesh_name);
+        meshes.push_back(std::move(mesh));
+    }
+    return meshes;
+}
+
+void writeGeometrySearchCache(
+    std::string const& prefix,
+    std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes)
+{
+    for (std::size_t i = 0; i < meshes.size(); ++i)
+    {
+        if (MeshLib::IO::writeMeshToFile(
+                *meshes[i], geometrySearchCacheMeshFile(prefix, i)) != 0)
+        {
+            WARN("Could not write the geometry search cache '%s'.",
+                 geometrySearchCacheIndexFile(prefix).c_str());
+            return;
+        }
+    }
+
+    // The index is written last, such that an interrupted write leaves no
+    // valid cache behind.
+    std::ofstream index(geometrySearchCacheIndexFile(prefix));
+    for (auto const& mesh : meshes)
+    {
+        index << mesh->getName() << "\n";
+    }
+    if (!index)
+    {
+        WARN("Could not write the geometry search cache '%s'.",
+             geometrySearchCacheIndexFile(prefix).c_str());
+    }
+}
+
+/// Meshes read from files so far, if enabled by
+/// ProjectData::enableMeshReuse().
+bool reuse_meshes = false;
+std::map<std::string, std::unique_ptr<MeshLib::Mesh>> meshes_read;
+/// Guards meshes_read, which is accessed by concurrent mesh reads.
+std::mutex meshes_read_mutex;
+
+std::unique_ptr<MeshLib::Mesh> readMeshFile(std::string const& mesh_file)
+{
+#ifndef USE_PETSC  // Node partitioned meshes are not copied.
+    if (reuse_meshes)
+    {
+        {
+            std::lock_guard<std::mutex> lock(meshes_read_mutex);
+            if (auto const it = meshes_read.find(mesh_file);
+                it != meshes_read.end())
+            {
+                DBUG("Reusing mesh file '%s' read before.", mesh_file.c_str());
+                return std::make_unique<MeshLib::Mesh>(*it->second);
+            }
+        }
+
+        std::unique_ptr<MeshLib::Mesh> mesh(
+            MeshLib::IO::readMeshFromFile(mesh_file));
+        if (!mesh)
+        {
+            return nullptr;
+        }
+        // The kept mesh stays unchanged, the project modifies its copy.
+        auto copy = std::make_unique<MeshLib::Mesh>(*mesh);
+        std::lock_guard<std::mutex> lock(meshes_read_mutex);
+        meshes_read.emplace(mesh_file, std::move(mesh));
+        return copy;
+    }
+#endif  // USE_PETSC
+    return std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::IO::readMeshFromFile(mesh_file));
+}
+
+/// The settings of a single mesh of the project file.
+struct MeshConfig
+{
+    std::string mesh_file;
+    boost::optional<bool> axially_symmetric;
+};
+
+/// Reads the settings of a single mesh. The configuration tree is not
+/// thread-safe, hence it is parsed before the meshes are read concurrently.
+MeshConfig parseMeshConfig(BaseLib::ConfigTree const& mesh_config_parameter,
+                           std::string const& project_directory)
+{
+    std::string const mesh_file = BaseLib::copyPathToFileName(
+        mesh_config_parameter.getValue<std::string>(), project_directory);
 
 #ifdef DOXYGEN_DOCU_ONLY
     //! \ogs_file_attr{prj__meshes__mesh__axially_symmetric}
     mesh_config_parameter.getConfigAttributeOptional<bool>("axially_symmetric");
 #endif  // DOXYGEN_DOCU_ONLY
 
-    if (auto const axially_symmetric =
+    return {mesh_file,
             //! \ogs_file_attr{prj__mesh__axially_symmetric}
-        mesh_config_parameter.getConfigAttributeOptional<bool>(
-            "axially_symmetric"))
+            mesh_config_parameter.getConfigAttributeOptional<bool>(
+                "axially_symmetric")};
+}
+
+std::unique_ptr<MeshLib::Mesh> readSingleMesh(MeshConfig const& mesh_config)
+{
+    DBUG("Reading mesh file '%s'.", mesh_config.mesh_file.c_str());
+
+    auto mesh = readMeshFile(mesh_config.mesh_file);
+    if (!mesh)
     {
-        mesh->setAxiallySymmetric(*axially_symmetric);
+        OGS_FATAL("Could not read mesh from '%s' file. No mesh added.",
+                  mesh_config.mesh_file.c_str());
+    }
+
+    if (mesh_config.axially_symmetric)
+    {
+        mesh->setAxiallySymmetric(*mesh_config.axially_symmetric);
     }
 
     return mesh;
 }
 
+/// Reads the meshes in the order of the given configurations.
+///
+/// The mesh files are independent of each other and are read concurrently,
+/// such that the time for reading many boundary meshes along with the bulk
+/// mesh is bounded by the time for the largest file rather than the sum.
+/// The partitioned meshes of parallel runs are read collectively by all
+/// ranks and therefore one after the other.
+std::vector<std::unique_ptr<MeshLib::Mesh>> readMeshFiles(
+    std::vector<MeshConfig> const& mesh_configs)
+{
+    std::vector<std::unique_ptr<MeshLib::Mesh>> meshes(mesh_configs.size());
+#ifdef USE_PETSC
+    for (std::size_t i = 0; i < mesh_configs.size(); ++i)
+    {
+        meshes[i] = readSingleMesh(mesh_configs[i]);
+    }
+#else
+    // The mesh sizes differ by orders of magnitude; each file is scheduled
+    // on its own.
+    int const chunk_size = 1;
+    NumLib::detail::parallelFor(
+        mesh_configs.size(),
+        [&](std::size_t const i) {
+            meshes[i] = readSingleMesh(mesh_configs[i]);
+        },
+        chunk_size);
+#endif
+    return meshes;
+}
+
 std::vector<std::unique_ptr<MeshLib::Mesh>> readMeshes(
-    BaseLib::ConfigTree const& config, std::string const& project_directory)
+    BaseLib::ConfigTree const& config, std::string const& project_directory,
+    std::string const& cache_directory)
 {
     std::vector<std::unique_ptr<MeshLib::Mesh>> meshes;
 
@@ -167,12 +378,15 @@ std::vector<std::unique_ptr<MeshLib::Mesh>> readMeshes(
     if (optional_meshes)
     {
         DBUG("Reading multiple meshes.");
+        std::vector<MeshConfig> mesh_configs;
         for (auto mesh_config :
              //! \ogs_file_param{prj__meshes__mesh}
              optional_meshes->getConfigParameterList("mesh"))
         {
-            meshes.push_back(readSingleMesh(mesh_config, project_directory));
+            mesh_configs.push_back(
+                parseMeshConfig(mesh_config, project_directory));
         }
+        meshes = readMeshFiles(mesh_configs);
     }
     else
     {  // Read single mesh with geometry.
@@ -182,8 +396,8 @@ std::vector<std::unique_ptr<MeshLib::Mesh>> readMeshes(
             "https://www.opengeosys.org/docs/tools/model-preparation/"
             "constructmeshesfromgeometry/ tool for conversion.");
         //! \ogs_file_param{prj__mesh}
-        meshes.push_back(readSingleMesh(config.getConfigParameter("mesh"),
-                                        project_directory));
+        meshes.push_back(readSingleMesh(parseMeshConfig(
+            config.getConfigParameter("mesh"), project_directory)));
 
         std::string const geometry_file = BaseLib::copyPathToFileName(
             //! \ogs_file_param{prj__geometry}
@@ -195,10 +409,51 @@ std::vector<std::unique_ptr<MeshLib::Mesh>> readMeshes(
         std::unique_ptr<MeshGeoToolsLib::SearchLength> search_length_algorithm =
             MeshGeoToolsLib::createSearchLengthAlgorithm(config, *meshes[0]);
         bool const multiple_nodes_allowed = false;
-        auto additional_meshes =
-            MeshGeoToolsLib::constructAdditionalMeshesFromGeoObjects(
-                geoObjects, *meshes[0], std::move(search_length_algorithm),
-                multiple_nodes_allowed);
+
+        //! \ogs_file_param{prj__geometry_search_cache}
+        bool const use_cache = config.getConfigParameter<bool>(
+                                   "geometry_search_cache", false) ||
+                               !cache_directory.empty();
+        std::string cache_prefix;
+        std::vector<std::unique_ptr<MeshLib::Mesh>> additional_meshes;
+        if (use_cache)
+        {
+            std::stringstream key;
+            key << std::hex
+                << computeGeometrySearchKey(
+                       *meshes[0], geometry_file,
+                       search_length_algorithm->getSearchLength(),
+                       multiple_nodes_allowed);
+            cache_prefix = BaseLib::joinPaths(
+                cache_directory.empty() ? project_directory : cache_directory,
+                BaseLib::extractBaseNameWithoutExtension(geometry_file) + "_" +
+                    key.str());
+            additional_meshes = readGeometrySearchCache(cache_prefix);
+            if (!additional_meshes.empty())
+            {
+                INFO("Read the meshes of the geometries from the cache '%s'.",
+                     geometrySearchCacheIndexFile(cache_prefix).c_str());
+            }
+        }
+
+        if (additional_meshes.empty())
+        {
+            additional_meshes =
+                MeshGeoToolsLib::constructAdditionalMeshesFromGeoObjects(
+                    geoObjects, *meshes[0], std::move(search_length_algorithm),
+                    multiple_nodes_allowed);
+            if (use_cache)
+            {
+                writeGeometrySearchCache(cache_prefix, additional_meshes);
+            }
+        }
+        else
+        {
+            for (auto& mesh : additional_meshes)
+            {
+                mesh->setAxiallySymmetric(meshes[0]->isAxiallySymmetric());
+            }
+        }
 
         std::move(begin(additional_meshes), end(additional_meshes),
                   std::back_inserter(meshes));
@@ -266,11 +521,26 @@ boost::optional<ParameterLib::CoordinateSystem> parseLocalCoordinateSystem(
 
 ProjectData::ProjectData() = default;
 
+void ProjectData::enableMeshReuse()
+{
+    reuse_meshes = true;
+}
+
+MeshLib::Mesh& ProjectData::getMesh(std::string const& mesh_name) const
+{
+    return *BaseLib::findElementOrError(
+        begin(_mesh_vec), end(_mesh_vec),
+        [&mesh_name](auto const& m) { return m->getName() == mesh_name; },
+        "Expected to find a mesh named " + mesh_name + ".");
+}
+
 ProjectData::ProjectData(BaseLib::ConfigTree const& project_config,
                          std::string const& project_directory,
-                         std::string const& output_directory)
+                         std::string const& output_directory,
+                         std::string const& cache_directory)
 {
-    _mesh_vec = readMeshes(project_config, project_directory);
+    _mesh_vec = readMeshes(project_config, project_directory, cache_directory);
+    BaseLib::Timing::recordMemoryStage("mesh_read");
 
     if (auto const python_script =
             //! \ogs_file_param{prj__python_script}
@@ -335,17 +605,23 @@ ProjectData::ProjectData(BaseLib::ConfigTree const& project_config,
     //! \ogs_file_param{prj__processes}
     parseProcesses(project_config.getConfigSubtree("processes"),
                    project_directory, output_directory);
+    BaseLib::Timing::recordMemoryStage("processes_created");
 
     //! \ogs_file_param{prj__linear_solvers}
     parseLinearSolvers(project_config.getConfigSubtree("linear_solvers"));
 
     //! \ogs_file_param{prj__nonlinear_solvers}
     parseNonlinearSolvers(project_config.getConfigSubtree("nonlinear_solvers"));
+    BaseLib::Timing::recordMemoryStage("solver_setup");
 
     parseChemicalSystem(
         //! \ogs_file_param{prj__chemical_system}
         project_config.getConfigSubtreeOptional("chemical_system"),
         output_directory);
+    if (_chemical_system)
+    {
+        BaseLib::Timing::recordMemoryStage("chemical_system");
+    }
 
     //! \ogs_file_param{prj__time_loop}
     parseTimeLoop(project_config.getConfigSubtree("time_loop"),
@@ -534,6 +810,64 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             //! \ogs_file_param{prj__processes__process__jacobian_assembler}
             process_config.getConfigSubtreeOptional("jacobian_assembler"));
 
+        auto const assembly_executor =
+            //! \ogs_file_param{prj__processes__process__assembly_executor}
+            process_config.getConfigParameter<std::string>("assembly_executor",
+                                                           "Serial");
+        if (assembly_executor != "Serial" && assembly_executor != "Parallel" &&
+            assembly_executor != "ParallelColored")
+        {
+            OGS_FATAL(
+                "Unknown assembly executor `%s' for process `%s'. Possible "
+                "values are `Serial', `Parallel', and `ParallelColored'.",
+                assembly_executor.c_str(), name.c_str());
+        }
+
+        auto const node_ordering_name =
+            //! \ogs_file_param{prj__processes__process__node_ordering}
+            process_config.getConfigParameter<std::string>("node_ordering",
+                                                           "Mesh");
+        auto const node_ordering = [&]() {
+            if (node_ordering_name == "Mesh")
+            {
+                return NumLib::NodeOrdering::MESH;
+            }
+            if (node_ordering_name == "ReverseCuthillMcKee")
+            {
+                return NumLib::NodeOrdering::REVERSE_CUTHILL_MCKEE;
+            }
+            if (node_ordering_name == "HilbertCurve")
+            {
+                return NumLib::NodeOrdering::HILBERT_CURVE;
+            }
+            OGS_FATAL(
+                "Unknown node ordering `%s' for process `%s'. Possible values "
+                "are `Mesh', `ReverseCuthillMcKee', and `HilbertCurve'.",
+                node_ordering_name.c_str(), name.c_str());
+        }();
+
+        auto const reorder_elements =
+            //! \ogs_file_param{prj__processes__process__reorder_elements}
+            process_config.getConfigParameter<bool>("reorder_elements", false);
+
+        auto const precompute_scatter_maps =
+            //! \ogs_file_param{prj__processes__process__precompute_scatter_maps}
+            process_config.getConfigParameter<bool>("precompute_scatter_maps",
+                                                    false);
+
+        auto const time_invariant_matrices =
+            //! \ogs_file_param{prj__processes__process__time_invariant_matrices}
+            process_config.getConfigParameter<bool>("time_invariant_matrices",
+                                                    false);
+
+        auto const element_timing =
+            //! \ogs_file_param{prj__processes__process__element_timing}
+            process_config.getConfigParameter<bool>("element_timing", false);
+
+        auto const incremental_assembly_config =
+            //! \ogs_file_param{prj__processes__process__incremental_assembly}
+            process_config.getConfigSubtreeOptional("incremental_assembly");
+
 #ifdef OGS_BUILD_PROCESS_STEADYSTATEDIFFUSION
         if (type == "STEADY_STATE_DIFFUSION")
         {
@@ -967,6 +1301,68 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
         {
             OGS_FATAL("The process name '%s' is not unique.", name.c_str());
         }
+
+        if (assembly_executor != "Serial")
+        {
+            INFO("Using the %s assembly executor for process `%s'.",
+                 assembly_executor.c_str(), name.c_str());
+            process->enableParallelAssembly(assembly_executor ==
+                                            "ParallelColored");
+        }
+        if (node_ordering != NumLib::NodeOrdering::MESH)
+        {
+#ifdef USE_PETSC
+            WARN(
+                "The node ordering requested for process `%s' is not "
+                "available with PETSc.",
+                name.c_str());
+#else
+            process->setNodeOrdering(node_ordering);
+#endif
+        }
+        if (reorder_elements)
+        {
+            process->enableElementReordering();
+        }
+        if (precompute_scatter_maps)
+        {
+#ifdef USE_PETSC
+            WARN(
+                "The scatter maps requested for process `%s' are not "
+                "available with PETSc.",
+                name.c_str());
+#else
+            process->enableScatterMaps();
+#endif
+        }
+        if (time_invariant_matrices)
+        {
+            process->enableTimeInvariantMatrices();
+        }
+        if (element_timing)
+        {
+            process->enableElementTiming();
+        }
+        if (incremental_assembly_config)
+        {
+            auto const tolerance =
+                //! \ogs_file_param{prj__processes__process__incremental_assembly__tolerance}
+                incremental_assembly_config->getConfigParameter<double>(
+                    "tolerance");
+            auto const max_reuses =
+                //! \ogs_file_param{prj__processes__process__incremental_assembly__max_reuses}
+                incremental_assembly_config->getConfigParameter<int>(
+                    "max_reuses", 5);
+            if (!(tolerance >= 0) || max_reuses < 0)
+            {
+                OGS_FATAL(
+                    "Invalid incremental assembly parameters for process "
+                    "`%s': tolerance = %g, max_reuses = %d. Both must not be "
+                    "negative.",
+                    name.c_str(), tolerance, max_reuses);
+            }
+            process->enableIncrementalAssembly(tolerance, max_reuses);
+        }
         _processes.push_back(std::move(process));
     }
 }
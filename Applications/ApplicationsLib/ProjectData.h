@@ -60,12 +60,22 @@ public:
     /// \param project_directory Where to look for files referenced in the
     ///                          \c config_tree.
     /// \param output_directory  Where to write simulation output files to.
+    /// \param cache_directory   Where to keep the results of the geometry
+    ///                          search between runs. If empty, the cache is
+    ///                          only used if the project file enables it and
+    ///                          it is kept in the project directory.
     ProjectData(BaseLib::ConfigTree const& project_config,
                 std::string const& project_directory,
-                std::string const& output_directory);
+                std::string const& output_directory,
+                std::string const& cache_directory);
 
     ProjectData(ProjectData&) = delete;
 
+    /// Keeps every mesh read from a file in memory, such that subsequently
+    /// constructed projects referring to the same file get a copy of it
+    /// instead of reading the file again. This is used for running several
+    /// projects, e.g. the members of an ensemble, in one process.
+    static void enableMeshReuse();
 
     //
     // Process interface
@@ -80,6 +90,9 @@ public:
 
     ProcessLib::TimeLoop& getTimeLoop() { return *_time_loop; }
 
+    /// Returns the mesh with the given name, e.g. for reading its properties.
+    MeshLib::Mesh& getMesh(std::string const& mesh_name) const;
+
 private:
     /// Parses the process variables configuration and creates new variables for
     /// each variable entry passing the corresponding subtree to the process
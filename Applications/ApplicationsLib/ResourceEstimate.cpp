@@ -0,0 +1,180 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ResourceEstimate.h"
+
+#include <cmath>
+
+#include <logog/include/logog.hpp>
+
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/NodeAdjacencyTable.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendrePrism.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendrePyramid.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendreTet.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendreTri.h"
+#include "ProcessLib/Process.h"
+#include "ProcessLib/ProcessVariable.h"
+
+namespace
+{
+/// The solution, the previous solutions, the residual, the increment, and
+/// the work vectors of the nonlinear solver and the time discretization.
+constexpr int number_of_global_vectors = 8;
+
+constexpr double bytes_per_mebibyte = 1024. * 1024.;
+
+unsigned numberOfIntegrationPoints(MeshLib::Element const& element,
+                                   unsigned const order)
+{
+    switch (element.getGeomType())
+    {
+        case MeshLib::MeshElemType::POINT:
+            return 1;
+        case MeshLib::MeshElemType::LINE:
+            return order;
+        case MeshLib::MeshElemType::QUAD:
+            return order * order;
+        case MeshLib::MeshElemType::HEXAHEDRON:
+            return order * order * order;
+        case MeshLib::MeshElemType::TRIANGLE:
+            return NumLib::IntegrationGaussLegendreTri::getNumberOfPoints(
+                order);
+        case MeshLib::MeshElemType::TETRAHEDRON:
+            return NumLib::IntegrationGaussLegendreTet::getNumberOfPoints(
+                order);
+        case MeshLib::MeshElemType::PRISM:
+            return NumLib::IntegrationGaussLegendrePrism::getNumberOfPoints(
+                order);
+        case MeshLib::MeshElemType::PYRAMID:
+            return NumLib::IntegrationGaussLegendrePyramid::getNumberOfPoints(
+                order);
+        default:
+            OGS_FATAL("Unsupported element type for the resource estimate.");
+    }
+}
+
+ApplicationsLib::ResourceEstimate estimateResources(
+    ProcessLib::Process const& process, int const process_id)
+{
+    auto const& mesh = process.getMesh();
+    auto const& variables = process.getProcessVariables(process_id);
+
+    // Number of components at each node, where the linear variables are
+    // defined at the base nodes only.
+    std::vector<std::size_t> components(mesh.getNumberOfNodes(), 0);
+    std::size_t number_of_dofs = 0;
+    for (ProcessLib::ProcessVariable const& variable : variables)
+    {
+        auto const n_components =
+            static_cast<std::size_t>(variable.getNumberOfComponents());
+        auto const n_nodes = variable.getShapeFunctionOrder() == 1
+                                 ? mesh.getNumberOfBaseNodes()
+                                 : mesh.getNumberOfNodes();
+        for (std::size_t i = 0; i < n_nodes; ++i)
+        {
+            components[i] += n_components;
+        }
+        number_of_dofs += n_nodes * n_components;
+    }
+
+    auto const& adjacency = mesh.getNodeAdjacencyTable();
+    std::size_t number_of_nonzeros = 0;
+    for (std::size_t i = 0; i < components.size(); ++i)
+    {
+        std::size_t adjacent_components = 0;
+        for (auto const j : adjacency.getAdjacentNodes(i))
+        {
+            adjacent_components += components[j];
+        }
+        number_of_nonzeros += components[i] * adjacent_components;
+    }
+
+    auto const integration_order = process.getIntegrationOrder();
+    auto const dimension = mesh.getDimension();
+    std::size_t number_of_integration_points = 0;
+    double integration_point_bytes = 0;
+    for (auto const* const element : mesh.getElements())
+    {
+        auto const n_points =
+            numberOfIntegrationPoints(*element, integration_order);
+        number_of_integration_points += n_points;
+        // N, dNdx, and the integration weight.
+        integration_point_bytes += static_cast<double>(
+            n_points * (element->getNumberOfNodes() * (1 + dimension) + 1) *
+            sizeof(double));
+    }
+
+    double const matrix_bytes =
+        static_cast<double>(number_of_nonzeros) *
+            (sizeof(double) + sizeof(GlobalIndexType)) +
+        static_cast<double>(number_of_dofs + 1) * sizeof(GlobalIndexType);
+    double const vector_bytes = static_cast<double>(
+        number_of_global_vectors * number_of_dofs * sizeof(double));
+
+    return {process.name,
+            process_id,
+            number_of_dofs,
+            number_of_nonzeros,
+            number_of_integration_points,
+            matrix_bytes + vector_bytes,
+            integration_point_bytes};
+}
+}  // namespace
+
+namespace ApplicationsLib
+{
+std::vector<ResourceEstimate> estimateResources(
+    std::vector<std::unique_ptr<ProcessLib::Process>> const& processes)
+{
+    std::vector<ResourceEstimate> estimates;
+    for (auto const& process : processes)
+    {
+        for (int process_id = 0;
+             process_id < process->getNumberOfProcessIDs();
+             ++process_id)
+        {
+            estimates.push_back(::estimateResources(*process, process_id));
+        }
+    }
+    return estimates;
+}
+
+void logResourceEstimates(std::vector<ResourceEstimate> const& estimates,
+                          int const number_of_partitions)
+{
+    double total_bytes = 0;
+    for (auto const& e : estimates)
+    {
+        INFO(
+            "Process '%s', process id %d: %d degrees of freedom, %d matrix "
+            "nonzeros, %d integration points.",
+            e.process_name.c_str(), e.process_id, e.number_of_dofs,
+            e.number_of_nonzeros, e.number_of_integration_points);
+        INFO(
+            "\tEquation system %g MiB, integration point data %g MiB.",
+            e.equation_system_bytes / bytes_per_mebibyte,
+            e.integration_point_bytes / bytes_per_mebibyte);
+        total_bytes += e.equation_system_bytes + e.integration_point_bytes;
+    }
+
+    INFO("Estimated memory: %g MiB in total, %g MiB per rank for %d "
+         "partitions.",
+         total_bytes / bytes_per_mebibyte,
+         total_bytes / bytes_per_mebibyte / number_of_partitions,
+         number_of_partitions);
+    INFO(
+        "The estimate excludes the meshes, the material state at the "
+        "integration points, and the factorization of direct linear "
+        "solvers.");
+}
+}  // namespace ApplicationsLib
@@ -0,0 +1,56 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ProcessLib
+{
+class Process;
+}
+
+namespace ApplicationsLib
+{
+/// Estimated size of the global equation system of one process id of a
+/// process, computed from the mesh and the process variables before the
+/// process is initialized.
+struct ResourceEstimate
+{
+    std::string process_name;
+    int process_id;
+    std::size_t number_of_dofs;
+    /// Nonzero entries of the global matrix, i.e., the products of the
+    /// numbers of components of all pairs of adjacent nodes.
+    std::size_t number_of_nonzeros;
+    std::size_t number_of_integration_points;
+    /// Memory of one global matrix and of the global vectors of the
+    /// nonlinear solver and the time discretization.
+    double equation_system_bytes;
+    /// Memory of the shape functions and their derivatives stored for each
+    /// integration point; the material state is not included.
+    double integration_point_bytes;
+};
+
+/// Estimates the sizes of the equation systems of all processes.
+///
+/// \attention All process variables are assumed to be defined on the whole
+/// process mesh.
+std::vector<ResourceEstimate> estimateResources(
+    std::vector<std::unique_ptr<ProcessLib::Process>> const& processes);
+
+/// Logs the estimates and the memory per rank for the given number of
+/// partitions, assuming balanced partitions without ghost nodes.
+void logResourceEstimates(std::vector<ResourceEstimate> const& estimates,
+                          int const number_of_partitions);
+}  // namespace ApplicationsLib
@@ -11,22 +11,35 @@
 
 #include "TestDefinition.h"
 
+#include <algorithm>
 #include <cmath>
-#include <cstdlib>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
 
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
 #include "BaseLib/FileTools.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Properties.h"
 #ifdef USE_PETSC
-#include "MeshLib/IO/VtkIO/VtuInterface.h"  // For petsc file name conversion.
 #include <petsc.h>
 #endif
 
 namespace
 {
-/// Test if the given string is convertible to a valid double value, not a NaN.
-bool isConvertibleToDouble(std::string const& s)
+/// Converts the given tolerance to double. An empty string results in the
+/// default tolerance of vtkdiff, the machine epsilon.
+double toTolerance(std::string const& s)
 {
+    if (s.empty())
+    {
+        return std::numeric_limits<double>::epsilon();
+    }
+
     std::size_t pos = 0;
     double value;
     try
@@ -49,89 +62,44 @@ bool isConvertibleToDouble(std::string const& s)
     {
         OGS_FATAL("The given string '%s' results in a NaN value.", s.c_str());
     }
-    return true;
+    return value;
 }
 
-/// Wraps a string into double ticks.
-std::string safeString(std::string s)
+/// Copies the values of the point or cell data field with the given name to a
+/// vector of doubles. Returns an empty optional if there is no such field.
+template <typename... Ts>
+std::optional<std::vector<double>> getFieldValues(
+    MeshLib::Properties const& properties, std::string const& field_name)
 {
-    return "\"" + s + "\"";
+    std::optional<std::vector<double>> values;
+    auto const copy = [&](auto const* const property) {
+        if (!values && property)
+        {
+            values.emplace(property->begin(), property->end());
+        }
+    };
+    (copy(properties.existsPropertyVector<Ts>(field_name)
+              ? properties.getPropertyVector<Ts>(field_name)
+              : nullptr),
+     ...);
+    return values;
 }
 
-/// Tries to find a vtkdiff executable by testing 'path/vtkdiff --version' calls
-/// for various paths.
-std::string findVtkdiff()
+/// Compares two values in the same way as vtkdiff does. Returns the absolute
+/// and the relative difference. The relative difference is infinite if only
+/// one of the values is zero.
+std::pair<double, double> computeDifferences(double const a, double const b)
 {
-    // Try to read the VTKDIFF_EXE environment variable.
-    if (const char* vtkdiff_exe_environment_variable =
-            std::getenv("VTKDIFF_EXE"))
-    {
-        std::string const vtkdiff_exe{vtkdiff_exe_environment_variable};
-        DBUG("VTKDIFF_EXE set to %s.", vtkdiff_exe.c_str());
-
-        //
-        // Sanity checks.
-        //
-        {  // The base name is 'vtkdiff'
-            auto const& base_name =
-                BaseLib::extractBaseNameWithoutExtension(vtkdiff_exe);
-            if (base_name != "vtkdiff")
-            {
-                OGS_FATAL(
-                    "The VTKDIFF_EXE environment variable does not point to "
-                    "'vtkdiff'. VTKDIFF_EXE='%s'",
-                    vtkdiff_exe.c_str());
-            }
-        }
-        {  // vtkdiff must exist.
-            if (!BaseLib::IsFileExisting(vtkdiff_exe))
-            {
-                OGS_FATAL(
-                    "The VTKDIFF_EXE points to a non-existing file. "
-                    "VTKDIFF_EXE='%s'",
-                    vtkdiff_exe.c_str());
-            }
-        }
-
-        //
-        // Test the actual call.
-        //
-        int const return_value =
-            // TODO (naumov) replace system call with output consuming call
-            // (fork + execl seems to be more safe), and extract the vtkdiff
-            // call to common function. Also properly escape all strings in
-            // command lines.
-            // Reference for POSIX and Windows:
-            // https://wiki.sei.cmu.edu/confluence/pages/viewpage.action?pageId=87152177
-            // Take care when using fork, which might copy resources.
-            std::system((vtkdiff_exe + " --version").c_str());
-        if (return_value == 0)
-        {
-            return vtkdiff_exe;
-        }
-        WARN(
-            "Calling %s from the VTKDIFF_EXE environment variable didn't work "
-            "as expected. Return value was %d.",
-            vtkdiff_exe.c_str(), return_value);
-    }
-
-    std::string const vtkdiff_exe{"vtkdiff"};
-    std::vector<std::string> const paths = {"", "bin"};
-    auto const path = find_if(
-        begin(paths), end(paths), [&vtkdiff_exe](std::string const& path) {
-            int const return_value =
-                // TODO (naumov) replace system call with output consuming call
-                // as in an above todo comment.
-                std::system(
-                    (BaseLib::joinPaths(path, vtkdiff_exe) + " --version")
-                        .c_str());
-            return return_value == 0;
-        });
-    if (path == end(paths))
-    {
-        OGS_FATAL("vtkdiff not found.");
-    }
-    return BaseLib::joinPaths(*path, vtkdiff_exe);
+    double const absolute = std::abs(a - b);
+    if (absolute == 0)
+    {
+        return {0, 0};
+    }
+    if (a == 0 || b == 0)
+    {
+        return {absolute, std::numeric_limits<double>::infinity()};
+    }
+    return {absolute, absolute / std::min(std::abs(a), std::abs(b))};
 }
 
 }  // namespace
@@ -149,12 +117,9 @@ TestDefinition::TestDefinition(BaseLib::ConfigTree const& config_tree,
             "empty.");
     }
 
-    std::string const vtkdiff = findVtkdiff();
-
-    // Construct command lines for each entry.
     //! \ogs_file_param{prj__test_definition__vtkdiff}
     auto const& vtkdiff_configs = config_tree.getConfigSubtreeList("vtkdiff");
-    _command_lines.reserve(vtkdiff_configs.size());
+    _comparisons.reserve(vtkdiff_configs.size());
     for (auto const& vtkdiff_config : vtkdiff_configs)
     {
         std::string const& field_name =
@@ -188,62 +153,119 @@ TestDefinition::TestDefinition(BaseLib::ConfigTree const& config_tree,
             //! \ogs_file_param{prj__test_definition__vtkdiff__absolute_tolerance}
             vtkdiff_config.getConfigParameter<std::string>("absolute_tolerance",
                                                            "");
-        if (!absolute_tolerance.empty() &&
-            !isConvertibleToDouble(absolute_tolerance))
-        {
-            OGS_FATAL(
-                "The absolute tolerance value '%s' is not convertible to "
-                "double.",
-                absolute_tolerance.c_str());
-        }
-        std::string const absolute_tolerance_parameter =
-            "--abs " + absolute_tolerance;
-
         auto const relative_tolerance =
             //! \ogs_file_param{prj__test_definition__vtkdiff__relative_tolerance}
             vtkdiff_config.getConfigParameter<std::string>("relative_tolerance",
                                                            "");
-        if (!relative_tolerance.empty() &&
-            !isConvertibleToDouble(relative_tolerance))
+
+        _comparisons.push_back(
+            {field_name, reference_filename, output_filename,
+             toTolerance(absolute_tolerance), toTolerance(relative_tolerance)});
+        INFO("Will compare field '%s' of '%s' and '%s'.", field_name.c_str(),
+             reference_filename.c_str(), output_filename.c_str());
+    }
+}
+
+bool TestDefinition::runTests() const
+{
+    if (_comparisons.empty())
+    {
+        return false;
+    }
+
+    // The comparisons are grouped by the compared files, such that each file
+    // is read only once.
+    std::map<std::pair<std::string, std::string>, std::vector<Comparison const*>>
+        comparisons_per_file;
+    for (auto const& comparison : _comparisons)
+    {
+        comparisons_per_file[{comparison.reference_file,
+                              comparison.output_file}]
+            .push_back(&comparison);
+    }
+
+    bool all_passed = true;
+    for (auto const& [files, comparisons] : comparisons_per_file)
+    {
+        std::unique_ptr<MeshLib::Mesh> const reference(
+            MeshLib::IO::VtuInterface::readVTUFile(files.first));
+        std::unique_ptr<MeshLib::Mesh> const output(
+            MeshLib::IO::VtuInterface::readVTUFile(files.second));
+        if (!reference || !output)
+        {
+            WARN("Could not read '%s' or '%s' for the comparison.",
+                 files.first.c_str(), files.second.c_str());
+            all_passed = false;
+            continue;
+        }
+
+        std::vector<char> passed(comparisons.size());
+#pragma omp parallel for
+        for (std::ptrdiff_t i = 0;
+             i < static_cast<std::ptrdiff_t>(comparisons.size());
+             ++i)
         {
-            OGS_FATAL(
-                "The relative tolerance value '%s' is not convertible to "
-                "double.",
-                relative_tolerance.c_str());
+            passed[i] = compare(*comparisons[i], reference->getProperties(),
+                                output->getProperties());
         }
-        std::string const relative_tolerance_parameter =
-            "--rel " + relative_tolerance;
-
-        //
-        // Construct command line.
-        //
-        std::string command_line =
-            vtkdiff + " -a " + safeString(field_name) + " -b " +
-            safeString(field_name) + " " + safeString(reference_filename) +
-            " " + safeString(output_filename) + " " +
-            absolute_tolerance_parameter + " " + relative_tolerance_parameter;
-        INFO("Will run '%s'", command_line.c_str());
-        _command_lines.emplace_back(std::move(command_line));
+        all_passed =
+            all_passed && std::all_of(passed.begin(), passed.end(),
+                                      [](char const p) { return p != 0; });
     }
+    return all_passed;
 }
 
-bool TestDefinition::runTests() const
+bool TestDefinition::compare(Comparison const& comparison,
+                             MeshLib::Properties const& reference,
+                             MeshLib::Properties const& output)
 {
-    std::vector<int> return_values;
-    transform(begin(_command_lines), end(_command_lines),
-              back_inserter(return_values),
-              [](std::string const& command_line) {
-                  int const return_value = std::system(command_line.c_str());
-                  if (return_value != 0)
-                  {
-                      WARN("Return value %d was returned by '%s'.",
-                           return_value, command_line.c_str());
-                  }
-                  return return_value;
-              });
-    return !return_values.empty() &&
-           all_of(begin(return_values), end(return_values),
-                  [](int const& return_value) { return return_value == 0; });
+    auto const& field = comparison.field;
+    auto const a = getFieldValues<double, float, int, long, long long,
+                                  unsigned, unsigned long, unsigned long long,
+                                  char, unsigned char>(reference, field);
+    auto const b = getFieldValues<double, float, int, long, long long,
+                                  unsigned, unsigned long, unsigned long long,
+                                  char, unsigned char>(output, field);
+    if (!a || !b)
+    {
+        WARN("The field '%s' is missing in '%s' or '%s'.", field.c_str(),
+             comparison.reference_file.c_str(),
+             comparison.output_file.c_str());
+        return false;
+    }
+    if (a->size() != b->size())
+    {
+        WARN("The field '%s' has %d values in '%s' but %d in '%s'.",
+             field.c_str(), a->size(), comparison.reference_file.c_str(),
+             b->size(), comparison.output_file.c_str());
+        return false;
+    }
+
+    // Maximum norms of the absolute and the relative differences.
+    double max_absolute = 0;
+    double max_relative = 0;
+    for (std::size_t i = 0; i < a->size(); ++i)
+    {
+        auto const [absolute, relative] = computeDifferences((*a)[i], (*b)[i]);
+        max_absolute = std::max(max_absolute, absolute);
+        max_relative = std::max(max_relative, relative);
+    }
+
+    // Like vtkdiff the fields differ only if both tolerances are exceeded.
+    if (max_absolute > comparison.absolute_tolerance &&
+        max_relative > comparison.relative_tolerance)
+    {
+        WARN(
+            "The field '%s' differs between '%s' and '%s': the absolute "
+            "difference %g exceeds the tolerance %g and the relative "
+            "difference %g exceeds the tolerance %g.",
+            field.c_str(), comparison.reference_file.c_str(),
+            comparison.output_file.c_str(), max_absolute,
+            comparison.absolute_tolerance, max_relative,
+            comparison.relative_tolerance);
+        return false;
+    }
+    return true;
 }
 
 std::vector<std::string> const& TestDefinition::getOutputFiles() const
@@ -19,6 +19,10 @@ namespace BaseLib
 {
 class ConfigTree;
 }
+namespace MeshLib
+{
+class Properties;
+}
 
 namespace ApplicationsLib
 {
@@ -26,17 +30,33 @@ class TestDefinition final
 {
 public:
     /// Constructs test definition from the config and reference path
-    /// essentially constructing the command lines to be run on run() function
-    /// call.
+    /// essentially collecting the field comparisons to be run on runTests()
+    /// function call.
     TestDefinition(BaseLib::ConfigTree const& config_tree,
                    std::string const& reference_path,
                    std::string const& output_directory);
 
+    /// Compares the fields of the output files to the reference files in the
+    /// same way as the vtkdiff tool, but without starting a process per field.
+    /// Each file is read once and its fields are compared in parallel.
     bool runTests() const;
     std::vector<std::string> const& getOutputFiles() const;
 
 private:
-    std::vector<std::string> _command_lines;
+    struct Comparison
+    {
+        std::string field;
+        std::string reference_file;
+        std::string output_file;
+        double absolute_tolerance;
+        double relative_tolerance;
+    };
+
+    static bool compare(Comparison const& comparison,
+                        MeshLib::Properties const& reference,
+                        MeshLib::Properties const& output);
+
+    std::vector<Comparison> _comparisons;
     std::vector<std::string> _output_files;
 };
 }  // namespace ApplicationsLib
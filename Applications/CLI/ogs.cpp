@@ -11,6 +11,7 @@
  */
 
 #include <tclap/CmdLine.h>
+#include <algorithm>
 #include <chrono>
 
 #ifndef _WIN32
@@ -22,20 +23,24 @@
 #endif  // _WIN32
 
 #ifdef USE_PETSC
+#include <mpi.h>
 #include <vtkMPIController.h>
 #include <vtkSmartPointer.h>
 #endif
 
 // BaseLib
 #include "BaseLib/ConfigTreeUtil.h"
+#include "BaseLib/ConvergenceTelemetry.h"
 #include "BaseLib/DateTools.h"
 #include "BaseLib/FileTools.h"
 #include "BaseLib/RunTime.h"
 #include "BaseLib/TemplateLogogFormatterSuppressedGCC.h"
+#include "BaseLib/Timing.h"
 
 #include "Applications/ApplicationsLib/LinearSolverLibrarySetup.h"
 #include "Applications/ApplicationsLib/LogogSetup.h"
 #include "Applications/ApplicationsLib/ProjectData.h"
+#include "Applications/ApplicationsLib/ResourceEstimate.h"
 #include "Applications/ApplicationsLib/TestDefinition.h"
 #include "Applications/InSituLib/Adaptor.h"
 #include "InfoLib/CMakeInfo.h"
@@ -48,6 +53,30 @@
 #include "ogs_embedded_python.h"
 #endif
 
+namespace
+{
+void writeTimingData(std::string file_name, std::string const& format)
+{
+    int rank = 0;
+#ifdef USE_PETSC
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    auto const extension = BaseLib::getFileExtension(file_name);
+    file_name = BaseLib::dropFileExtension(file_name) + "_" +
+                std::to_string(rank) +
+                (extension.empty() ? "" : "." + extension);
+#endif
+
+    if (format == "chrome")
+    {
+        BaseLib::Timing::writeChromeTrace(file_name, rank);
+    }
+    else
+    {
+        BaseLib::Timing::writeJSON(file_name, rank);
+    }
+}
+}  // namespace
+
 int main(int argc, char* argv[])
 {
     // Parse CLI arguments.
@@ -72,11 +101,13 @@ int main(int argc, char* argv[])
         false, "", "PATH");
     cmd.add(reference_path_arg);
 
-    TCLAP::UnlabeledValueArg<std::string> project_arg(
+    TCLAP::UnlabeledMultiArg<std::string> project_arg(
         "project-file",
-        "Path to the ogs6 project file.",
+        "Path to the ogs6 project file. Several project files, e.g. the "
+        "members of an ensemble differing only in some parameters, are run "
+        "one after another in the same process reading each mesh file only "
+        "once; their output prefixes should differ.",
         true,
-        "",
         "PROJECT_FILE");
     cmd.add(project_arg);
 
@@ -85,6 +116,13 @@ int main(int argc, char* argv[])
                                             false, "", "PATH");
     cmd.add(outdir_arg);
 
+    TCLAP::ValueArg<std::string> cache_dir_arg(
+        "", "cache-dir",
+        "keep the meshes constructed from the geometry in the given existing "
+        "directory and reuse them in subsequent runs of the same model",
+        false, "", "PATH");
+    cmd.add(cache_dir_arg);
+
     TCLAP::ValueArg<std::string> log_level_arg("l", "log-level",
                                                "the verbosity of logging "
                                                "messages: none, error, warn, "
@@ -108,6 +146,12 @@ int main(int argc, char* argv[])
                                          "use unbuffered standard output");
     cmd.add(unbuffered_cout_arg);
 
+    TCLAP::SwitchArg async_log_arg(
+        "", "async-log",
+        "write the log messages in a background thread; errors are still "
+        "written immediately");
+    cmd.add(async_log_arg);
+
 #ifndef _WIN32  // TODO: On windows floating point exceptions are not handled
                 // currently
     TCLAP::SwitchArg enable_fpe_arg("", "enable-fpe",
@@ -115,6 +159,41 @@ int main(int argc, char* argv[])
     cmd.add(enable_fpe_arg);
 #endif  // _WIN32
 
+    TCLAP::ValueArg<std::string> timing_output_arg(
+        "", "timing-output",
+        "write the times spent in the assembly, the linear solver, the "
+        "output, etc. and the memory used after each setup stage to the given "
+        "file; in parallel runs the MPI rank is appended to the file name",
+        false, "", "PATH");
+    cmd.add(timing_output_arg);
+
+    std::vector<std::string> allowed_timing_formats{"json", "chrome"};
+    TCLAP::ValuesConstraint<std::string> allowed_timing_formats_constraint{
+        allowed_timing_formats};
+    TCLAP::ValueArg<std::string> timing_format_arg(
+        "", "timing-format",
+        "format of the timing output: json for the accumulated times per "
+        "timestep, chrome for a trace viewable with chrome://tracing",
+        false, "json", &allowed_timing_formats_constraint);
+    cmd.add(timing_format_arg);
+
+    TCLAP::ValueArg<std::string> convergence_output_arg(
+        "", "convergence-output",
+        "write the residual and increment norms, the linear solver "
+        "iterations, and the assembly and linear solver times of each "
+        "nonlinear iteration, and the accepted and rejected timesteps to the "
+        "given file as JSON lines; in parallel runs only rank 0 writes",
+        false, "", "PATH");
+    cmd.add(convergence_output_arg);
+
+    TCLAP::ValueArg<int> estimate_arg(
+        "", "estimate",
+        "read the project and print the degrees of freedom, matrix nonzeros, "
+        "integration points, and the estimated memory per rank for the given "
+        "number of partitions instead of running the simulation",
+        false, 1, "PARTITIONS");
+    cmd.add(estimate_arg);
+
     cmd.parse(argc, argv);
 
     // deactivate buffer for standard output if specified
@@ -124,6 +203,10 @@ int main(int argc, char* argv[])
     }
 
     ApplicationsLib::LogogSetup logog_setup;
+    if (async_log_arg.isSet())
+    {
+        logog_setup.enableAsynchronousOutput();
+    }
     logog_setup.setLevel(log_level_arg.getValue());
 
     INFO("This is OpenGeoSys-6 version %s.",
@@ -146,6 +229,11 @@ int main(int argc, char* argv[])
     (void)guard;
 #endif
 
+    if (timing_output_arg.isSet())
+    {
+        BaseLib::Timing::enable();
+    }
+
     BaseLib::RunTime run_time;
 
     {
@@ -154,7 +242,8 @@ int main(int argc, char* argv[])
         INFO("OGS started on %s.", time_str.c_str());
     }
 
-    std::unique_ptr<ApplicationsLib::TestDefinition> test_definition;
+    std::vector<std::unique_ptr<ApplicationsLib::TestDefinition>>
+        test_definitions;
     auto ogs_status = EXIT_SUCCESS;
 
     try
@@ -176,74 +265,124 @@ int main(int argc, char* argv[])
 #endif
             run_time.start();
 
-            auto project_config = BaseLib::makeConfigTree(
-                project_arg.getValue(), !nonfatal_arg.getValue(),
-                "OpenGeoSysProject");
-
-            BaseLib::setProjectDirectory(
-                BaseLib::extractPath(project_arg.getValue()));
-
-            ProjectData project(*project_config,
-                                BaseLib::getProjectDirectory(),
-                                outdir_arg.getValue());
-
-            if (!reference_path_arg.isSet())
-            {  // Ignore the test_definition section.
-                project_config->ignoreConfigParameter("test_definition");
-            }
-            else
+            if (convergence_output_arg.isSet())
             {
-                test_definition =
-                    std::make_unique<ApplicationsLib::TestDefinition>(
-                        //! \ogs_file_param{prj__test_definition}
-                        project_config->getConfigSubtree("test_definition"),
-                        reference_path_arg.getValue(),
-                        outdir_arg.getValue());
-
-                INFO("Cleanup possible output files before running ogs.");
-                BaseLib::removeFiles(test_definition->getOutputFiles());
+                int rank = 0;
+#ifdef USE_PETSC
+                MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+                if (rank == 0)
+                {
+                    BaseLib::ConvergenceTelemetry::open(
+                        convergence_output_arg.getValue());
+                }
             }
-#ifdef USE_INSITU
-            auto isInsituConfigured = false;
-            //! \ogs_file_param{prj__insitu}
-            if (auto t = project_config->getConfigSubtreeOptional("insitu"))
+
+            auto const& project_files = project_arg.getValue();
+            if (project_files.size() > 1)
             {
-                InSituLib::Initialize(
-                    //! \ogs_file_param{prj__insitu__scripts}
-                    t->getConfigSubtree("scripts"),
-                    BaseLib::extractPath(project_arg.getValue()));
-                isInsituConfigured = true;
+                ProjectData::enableMeshReuse();
             }
-#else
-            project_config->ignoreConfigParameter("insitu");
-#endif
 
-            INFO("Initialize processes.");
-            for (auto& p : project.getProcesses())
+            solver_succeeded = true;
+            for (auto const& project_file : project_files)
             {
-                p->initialize();
-            }
+                if (project_files.size() > 1)
+                {
+                    INFO("Running project '%s'.", project_file.c_str());
+                }
+
+                auto project_config = BaseLib::makeConfigTree(
+                    project_file, !nonfatal_arg.getValue(),
+                    "OpenGeoSysProject");
+
+                BaseLib::setProjectDirectory(
+                    BaseLib::extractPath(project_file));
+
+                ProjectData project(*project_config,
+                                    BaseLib::getProjectDirectory(),
+                                    outdir_arg.getValue(),
+                                    cache_dir_arg.getValue());
+
+                if (!reference_path_arg.isSet() || estimate_arg.isSet())
+                {  // Ignore the test_definition section.
+                    project_config->ignoreConfigParameter("test_definition");
+                }
+                else
+                {
+                    test_definitions.push_back(
+                        std::make_unique<ApplicationsLib::TestDefinition>(
+                            //! \ogs_file_param{prj__test_definition}
+                            project_config->getConfigSubtree("test_definition"),
+                            reference_path_arg.getValue(),
+                            outdir_arg.getValue()));
+
+                    INFO("Cleanup possible output files before running ogs.");
+                    BaseLib::removeFiles(
+                        test_definitions.back()->getOutputFiles());
+                }
+
+                if (estimate_arg.isSet())
+                {
+                    project_config->ignoreConfigParameter("insitu");
+                    ApplicationsLib::logResourceEstimates(
+                        ApplicationsLib::estimateResources(
+                            project.getProcesses()),
+                        std::max(estimate_arg.getValue(), 1));
+                    project_config.checkAndInvalidate();
+                    continue;
+                }
 
-            // Check intermediately that config parsing went fine.
-            project_config.checkAndInvalidate();
-            BaseLib::ConfigTree::assertNoSwallowedErrors();
+#ifdef USE_INSITU
+                auto isInsituConfigured = false;
+                //! \ogs_file_param{prj__insitu}
+                if (auto t = project_config->getConfigSubtreeOptional("insitu"))
+                {
+                    InSituLib::Initialize(
+                        //! \ogs_file_param{prj__insitu__scripts}
+                        t->getConfigSubtree("scripts"),
+                        BaseLib::extractPath(project_file));
+                    isInsituConfigured = true;
+                }
+#else
+                project_config->ignoreConfigParameter("insitu");
+#endif
 
-            BaseLib::ConfigTree::assertNoSwallowedErrors();
+                INFO("Initialize processes.");
+                for (auto& p : project.getProcesses())
+                {
+                    p->initialize();
+                }
 
-            BaseLib::ConfigTree::assertNoSwallowedErrors();
+                // Check intermediately that config parsing went fine.
+                project_config.checkAndInvalidate();
+                BaseLib::ConfigTree::assertNoSwallowedErrors();
 
-            INFO("Solve processes.");
+                INFO("Solve processes.");
 
-            auto& time_loop = project.getTimeLoop();
-            time_loop.initialize();
-            solver_succeeded = time_loop.loop();
+                auto& time_loop = project.getTimeLoop();
+                time_loop.initialize();
+                if (!time_loop.loop())
+                {
+                    ERR("The simulation of project '%s' failed.",
+                        project_file.c_str());
+                    solver_succeeded = false;
+                }
 
 #ifdef USE_INSITU
-            if (isInsituConfigured)
-                InSituLib::Finalize();
+                if (isInsituConfigured)
+                    InSituLib::Finalize();
 #endif
+            }
             INFO("[time] Execution took %g s.", run_time.elapsed());
 
+            if (timing_output_arg.isSet())
+            {
+                writeTimingData(timing_output_arg.getValue(),
+                                timing_format_arg.getValue());
+            }
+            BaseLib::ConvergenceTelemetry::close();
+
 #if defined(USE_PETSC)
             controller->Finalize(1);
 #endif
@@ -273,7 +412,7 @@ int main(int argc, char* argv[])
         return EXIT_FAILURE;
     }
 
-    if (test_definition == nullptr)
+    if (test_definitions.empty())
     {
         // There are no tests, so just exit;
         return ogs_status;
@@ -284,7 +423,12 @@ int main(int argc, char* argv[])
     INFO("# Running tests                          #");
     INFO("##########################################");
     INFO("");
-    if (!test_definition->runTests())
+    bool tests_passed = true;
+    for (auto const& test_definition : test_definitions)
+    {
+        tests_passed = test_definition->runTests() && tests_passed;
+    }
+    if (!tests_passed)
     {
         ERR("One of the tests failed.");
         return EXIT_FAILURE;
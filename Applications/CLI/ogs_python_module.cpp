@@ -0,0 +1,162 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <memory>
+#include <string>
+
+#include "Applications/ApplicationsLib/LinearSolverLibrarySetup.h"
+#include "Applications/ApplicationsLib/LogogSetup.h"
+#include "Applications/ApplicationsLib/ProjectData.h"
+#include "BaseLib/ConfigTreeUtil.h"
+#include "BaseLib/FileTools.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/PropertyVector.h"
+#include "NumLib/NumericsConfig.h"
+#include "ProcessLib/TimeLoop.h"
+
+namespace py = pybind11;
+
+namespace
+{
+/// A simulation that is set up like in the ogs executable and that is
+/// executed step by step from Python.
+class Simulation final
+{
+public:
+    Simulation(std::string const& project_file,
+               std::string const& output_directory,
+               std::string const& log_level)
+        : _linear_solver_library_setup(0, nullptr),
+          _project_config(BaseLib::makeConfigTree(project_file, true,
+                                                  "OpenGeoSysProject"))
+    {
+        _logog_setup.setLevel(log_level);
+
+        BaseLib::setProjectDirectory(BaseLib::extractPath(project_file));
+        _project_data = std::make_unique<ProjectData>(
+            *_project_config, BaseLib::getProjectDirectory(),
+            output_directory, "");
+
+        _project_config->ignoreConfigParameter("test_definition");
+        _project_config->ignoreConfigParameter("insitu");
+
+        for (auto& p : _project_data->getProcesses())
+        {
+            p->initialize();
+        }
+        _project_config.checkAndInvalidate();
+        BaseLib::ConfigTree::assertNoSwallowedErrors();
+
+        _project_data->getTimeLoop().initialize();
+    }
+
+    ProcessLib::TimeLoop& timeLoop() { return _project_data->getTimeLoop(); }
+
+    /// Executes the remaining time steps.
+    bool executeSimulation()
+    {
+        while (timeLoop().executeTimeStep())
+        {
+        }
+        return timeLoop().outputLastTimeStep();
+    }
+
+    MeshLib::Mesh& getMesh(std::string const& mesh_name) const
+    {
+        return _project_data->getMesh(mesh_name);
+    }
+
+private:
+    ApplicationsLib::LogogSetup _logog_setup;
+    ApplicationsLib::LinearSolverLibrarySetup _linear_solver_library_setup;
+    BaseLib::ConfigTreeTopLevel _project_config;
+    std::unique_ptr<ProjectData> _project_data;
+};
+
+/// Returns a NumPy array referring to the property's data without copying it.
+/// The Simulation object \c owner is kept alive as long as the array exists.
+py::array_t<double> meshProperty(py::object const& owner,
+                                 std::string const& mesh_name,
+                                 std::string const& property_name)
+{
+    auto& property =
+        *owner.cast<Simulation&>()
+             .getMesh(mesh_name)
+             .getProperties()
+             .getPropertyVector<double>(property_name);
+    auto const n_components =
+        static_cast<std::size_t>(property.getNumberOfComponents());
+    return py::array_t<double>({property.getNumberOfTuples(), n_components},
+                               property.data(), owner);
+}
+
+#ifndef USE_PETSC
+/// Returns a NumPy array referring to the global solution vector of the
+/// process with the given id without copying it.
+py::array_t<double> solution(py::object const& owner, int const process_id)
+{
+    auto const& solutions = owner.cast<Simulation&>().timeLoop().getSolutions();
+    if (process_id < 0 || process_id >= static_cast<int>(solutions.size()))
+    {
+        throw py::index_error("There is no process with id " +
+                              std::to_string(process_id) + ".");
+    }
+    auto& x = solutions[process_id]->getRawVector();
+    return py::array_t<double>(x.size(), x.data(), owner);
+}
+#endif  // USE_PETSC
+}  // namespace
+
+PYBIND11_MODULE(ogs_simulator, m)
+{
+    m.doc() =
+        "Runs OpenGeoSys simulations step by step within a Python process.";
+
+    py::class_<Simulation>(m, "Simulation")
+        .def(py::init<std::string const&, std::string const&,
+                      std::string const&>(),
+             "Reads the project file and initializes the simulation.",
+             py::arg("project_file"), py::arg("output_directory") = "",
+             py::arg("log_level") = "info")
+        .def(
+            "current_time",
+            [](Simulation& s) { return s.timeLoop().currentTime(); },
+            "Time of the last executed time step.")
+        .def(
+            "end_time", [](Simulation& s) { return s.timeLoop().endTime(); },
+            "End time of the simulation.")
+        .def(
+            "execute_time_step",
+            [](Simulation& s) { return s.timeLoop().executeTimeStep(); },
+            "Executes one time step. Returns False if the time loop has "
+            "finished.")
+        .def(
+            "output_last_time_step",
+            [](Simulation& s) { return s.timeLoop().outputLastTimeStep(); },
+            "Writes the output of the last time step. Returns True if the "
+            "last time step has converged.")
+        .def("execute_simulation", &Simulation::executeSimulation,
+             "Executes the remaining time steps and writes the last output. "
+             "Returns True if the last time step has converged.")
+        .def("mesh_property", &meshProperty,
+             "Array of the double valued mesh property with one row per "
+             "mesh item. The array refers to the property's data, which is "
+             "not copied. It is invalidated if the property is resized.",
+             py::arg("mesh_name"), py::arg("property_name"))
+#ifndef USE_PETSC
+        .def("solution", &solution,
+             "Array referring to the current global solution vector of the "
+             "given process.",
+             py::arg("process_id") = 0)
+#endif  // USE_PETSC
+        ;
+}
@@ -36,8 +36,11 @@
 #include <vtkActor.h>
 #include <vtkCellData.h>
 #include <vtkDataSetMapper.h>
+#include <vtkDataSetSurfaceFilter.h>
 #include <vtkImageAlgorithm.h>
+#include <vtkLODActor.h>
 #include <vtkPointData.h>
+#include <vtkQuadricDecimation.h>
 #include <vtkRenderer.h>
 #include <vtkSmartPointer.h>
 #include <vtkTransform.h>
@@ -59,7 +62,7 @@ VtkVisPointSetItem::VtkVisPointSetItem(
         vtkAlgorithm* algorithm, TreeItem* parentItem,
         const QList<QVariant> data /*= QList<QVariant>()*/)
     : VtkVisPipelineItem(algorithm, parentItem, data), _mapper(nullptr),
-    _transformFilter(nullptr), _onPointData(true), _activeArrayName("")
+    _lodMapper(nullptr), _transformFilter(nullptr), _onPointData(true), _activeArrayName("")
 {
     auto* visParentItem = dynamic_cast<VtkVisPipelineItem*>(parentItem);
     if (parentItem->parentItem())
@@ -87,7 +90,7 @@ VtkVisPointSetItem::VtkVisPointSetItem(
         VtkCompositeFilter* compositeFilter, TreeItem* parentItem,
         const QList<QVariant> data /*= QList<QVariant>()*/)
     : VtkVisPipelineItem(compositeFilter, parentItem, data), _mapper(nullptr),
-    _transformFilter(nullptr), _onPointData(true), _activeArrayName("")
+    _lodMapper(nullptr), _transformFilter(nullptr), _onPointData(true), _activeArrayName("")
 {
 }
 
@@ -95,6 +98,10 @@ VtkVisPointSetItem::~VtkVisPointSetItem()
 {
     _transformFilter->Delete();
     _mapper->Delete();
+    if (_lodMapper)
+    {
+        _lodMapper->Delete();
+    }
 }
 QString VtkVisPointSetItem::GetActiveAttribute() const
 {
@@ -119,8 +126,46 @@ void VtkVisPointSetItem::Initialize(vtkRenderer* renderer)
     _mapper->SetColorModeToMapScalars();
 
     _mapper->SetInputConnection(_transformFilter->GetOutputPort());
-    _actor = vtkActor::New();
-    static_cast<vtkActor*>(_actor)->SetMapper(_mapper);
+
+    // Data sets with more cells than the threshold are rendered as a
+    // decimated surface during interaction and at full resolution otherwise.
+    QSettings settings;
+    int const lodThreshold =
+        settings.value("lodCellThreshold", 1000000).toInt();
+    vtkDataSet* dataSet =
+        vtkDataSet::SafeDownCast(_transformFilter->GetOutputDataObject(0));
+    if (lodThreshold > 0 && dataSet &&
+        dataSet->GetNumberOfCells() > lodThreshold)
+    {
+        INFO("Rendering a decimated surface of the data set during "
+             "interaction.");
+        vtkSmartPointer<vtkDataSetSurfaceFilter> surfaceFilter =
+            vtkSmartPointer<vtkDataSetSurfaceFilter>::New();
+        surfaceFilter->SetInputConnection(_transformFilter->GetOutputPort());
+        vtkSmartPointer<vtkTriangleFilter> triangleFilter =
+            vtkSmartPointer<vtkTriangleFilter>::New();
+        triangleFilter->SetInputConnection(surfaceFilter->GetOutputPort());
+        vtkSmartPointer<vtkQuadricDecimation> decimation =
+            vtkSmartPointer<vtkQuadricDecimation>::New();
+        decimation->SetInputConnection(triangleFilter->GetOutputPort());
+        decimation->SetTargetReduction(
+            settings.value("lodTargetReduction", 0.9).toDouble());
+
+        _lodMapper = QVtkDataSetMapper::New();
+        _lodMapper->InterpolateScalarsBeforeMappingOff();
+        _lodMapper->SetColorModeToMapScalars();
+        _lodMapper->SetInputConnection(decimation->GetOutputPort());
+
+        vtkLODActor* lodActor = vtkLODActor::New();
+        lodActor->SetMapper(_mapper);
+        lodActor->AddLODMapper(_lodMapper);
+        _actor = lodActor;
+    }
+    else
+    {
+        _actor = vtkActor::New();
+        static_cast<vtkActor*>(_actor)->SetMapper(_mapper);
+    }
     _renderer->AddActor(_actor);
 
     // Determine the right pre-set properties
@@ -188,7 +233,6 @@ void VtkVisPointSetItem::Initialize(vtkRenderer* renderer)
 
 
     // Set global backface culling
-    QSettings settings;
     bool backfaceCulling = settings.value("globalCullBackfaces", 0).toBool();
     this->setBackfaceCulling(backfaceCulling);
 
@@ -214,12 +258,18 @@ void VtkVisPointSetItem::Initialize(vtkRenderer* renderer)
 void VtkVisPointSetItem::SetScalarVisibility( bool on )
 {
     _mapper->SetScalarVisibility(on);
+    updateLODMapper();
 }
 
 void VtkVisPointSetItem::setVtkProperties(VtkAlgorithmProperties* vtkProps)
 {
     QObject::connect(vtkProps, SIGNAL(ScalarVisibilityChanged(bool)),
                      _mapper, SLOT(SetScalarVisibility(bool)));
+    if (_lodMapper)
+    {
+        QObject::connect(vtkProps, SIGNAL(ScalarVisibilityChanged(bool)),
+                         _lodMapper, SLOT(SetScalarVisibility(bool)));
+    }
 
     auto* actor = dynamic_cast<vtkActor*>(_actor);
     if (actor)
@@ -293,6 +343,7 @@ void VtkVisPointSetItem::SetActiveAttribute( const QString& name )
     {
         _vtkProps->SetActiveAttribute("Solid Color");
         _mapper->ScalarVisibilityOff();
+        updateLODMapper();
         return;
     }
     else
@@ -352,6 +403,15 @@ void VtkVisPointSetItem::SetActiveAttribute( const QString& name )
         _mapper->SetLookupTable(lut);
     }
     _mapper->SelectColorArray( _activeArrayName.c_str());
+    updateLODMapper();
+}
+
+void VtkVisPointSetItem::updateLODMapper() const
+{
+    if (_lodMapper)
+    {
+        _lodMapper->ShallowCopy(_mapper);
+    }
 }
 
 bool VtkVisPointSetItem::activeAttributeExists(vtkDataSetAttributes* data, std::string& name)
@@ -77,6 +77,9 @@ public:
 
 protected:
     QVtkDataSetMapper* _mapper;
+    /// Mapper of the decimated surface rendered during the interaction with
+    /// large data sets, or nullptr.
+    QVtkDataSetMapper* _lodMapper;
     vtkTransformFilter* _transformFilter;
     bool _onPointData;
     std::string _activeArrayName;
@@ -91,6 +94,9 @@ protected:
     void setVtkProperties(VtkAlgorithmProperties* vtkProps);
 
 private:
+    /// Copies the settings of the mapper to the level of detail mapper.
+    void updateLODMapper() const;
+
     /// Checks if the selected attribute actually exists for the data set
     bool activeAttributeExists(vtkDataSetAttributes* data, std::string& name);
 
@@ -14,6 +14,9 @@
 
 #include "mainwindow.h"
 
+#include <chrono>
+#include <future>
+
 #include <logog/include/logog.hpp>
 
 // Qt includes
@@ -22,6 +25,7 @@
 #include <QFileDialog>
 #include <QMessageBox>
 #include <QObject>
+#include <QProgressDialog>
 #include <QScreen>
 #include <QSettings>
 #include <QSignalMapper>
@@ -96,6 +100,34 @@
 
 using namespace FileIO;
 
+namespace
+{
+/// Reads the mesh in a worker thread while the user interface shows a busy
+/// indicator and stays responsive.
+std::unique_ptr<MeshLib::Mesh> readMeshInBackground(QString const& fileName,
+                                                    QWidget* parent)
+{
+    std::string const file_name = fileName.toStdString();
+    auto mesh = std::async(std::launch::async, [&file_name]() {
+        return std::unique_ptr<MeshLib::Mesh>(
+            MeshLib::IO::readMeshFromFile(file_name));
+    });
+
+    QProgressDialog progress("Loading mesh " + fileName + " ...", QString(), 0,
+                             0, parent);
+    progress.setWindowModality(Qt::WindowModal);
+    progress.setMinimumDuration(500);
+    progress.setValue(0);
+    while (mesh.wait_for(std::chrono::milliseconds(50)) !=
+           std::future_status::ready)
+    {
+        QApplication::processEvents();
+    }
+    progress.close();
+    return mesh.get();
+}
+}  // namespace
+
 MainWindow::MainWindow(QWidget* parent /* = 0*/) : QMainWindow(parent)
 {
     setupUi(this);
@@ -590,8 +622,8 @@ void MainWindow::loadFile(ImportFileType::type t, const QString &fileName)
             QTime myTimer1;
             myTimer0.start();
 #endif
-            std::unique_ptr<MeshLib::Mesh> mesh(
-                MeshLib::IO::readMeshFromFile(fileName.toStdString()));
+            std::unique_ptr<MeshLib::Mesh> mesh =
+                readMeshInBackground(fileName, this);
 #ifndef NDEBUG
             INFO("Mesh loading time: %d ms.", myTimer0.elapsed());
             myTimer1.start();
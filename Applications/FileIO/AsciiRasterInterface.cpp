@@ -13,6 +13,14 @@
 
 #include "AsciiRasterInterface.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <istream>
+#include <utility>
+#include <vector>
+
 #include <logog/include/logog.hpp>
 #include <boost/optional.hpp>
 
@@ -21,25 +29,182 @@
 
 #include "GeoLib/Raster.h"
 
+namespace
+{
+/// The columns [first_col, last_col) and rows [first_row, last_row) of a
+/// raster which are kept in memory.
+struct RasterWindow
+{
+    std::size_t first_col;
+    std::size_t last_col;
+    std::size_t first_row;
+    std::size_t last_row;
+
+    bool contains(std::size_t const col, std::size_t const row) const
+    {
+        return first_col <= col && col < last_col && first_row <= row &&
+               row < last_row;
+    }
+
+    std::size_t index(std::size_t const col, std::size_t const row) const
+    {
+        return (row - first_row) * (last_col - first_col) + (col - first_col);
+    }
+};
+
+/// Returns the window of the raster covering the (x,y)-extent of the region,
+/// or the whole raster if there is no region.
+RasterWindow getRasterWindow(GeoLib::RasterHeader const& header,
+                             boost::optional<GeoLib::AABB> const& region)
+{
+    if (!region)
+    {
+        return {0, header.n_cols, 0, header.n_rows};
+    }
+
+    // Two additional cells on each side for the interpolation of the values
+    // at the region's border.
+    auto const cell_range = [&header](double const origin, double const min,
+                                      double const max, std::size_t const n) {
+        auto const clamp = [n](double const i) {
+            return static_cast<std::size_t>(
+                std::min(std::max(i, 0.0), static_cast<double>(n)));
+        };
+        return std::make_pair(
+            clamp(std::floor((min - origin) / header.cell_size) - 2),
+            clamp(std::floor((max - origin) / header.cell_size) + 3));
+    };
+
+    auto const cols =
+        cell_range(header.origin[0], region->getMinPoint()[0],
+                   region->getMaxPoint()[0], header.n_cols);
+    auto const rows =
+        cell_range(header.origin[1], region->getMinPoint()[1],
+                   region->getMaxPoint()[1], header.n_rows);
+    return {cols.first, cols.second, rows.first, rows.second};
+}
+
+/// Returns the header of the part of the raster given by the window.
+GeoLib::RasterHeader getWindowHeader(GeoLib::RasterHeader header,
+                                     RasterWindow const& window)
+{
+    header.origin[0] += window.first_col * header.cell_size;
+    header.origin[1] += window.first_row * header.cell_size;
+    header.n_cols = window.last_col - window.first_col;
+    header.n_rows = window.last_row - window.first_row;
+    return header;
+}
+
+/// Reads the whitespace separated values of a raster chunk by chunk, s.t. the
+/// file is not copied into memory as a whole. Decimal commas are accepted.
+class ChunkedValueReader
+{
+public:
+    explicit ChunkedValueReader(std::istream& in) : _in(in) {}
+
+    /// Reads the next value like std::strtod.
+    /// \return false if there are no more values.
+    bool read(double& value)
+    {
+        // Skip whitespace, refilling the buffer as needed.
+        for (;;)
+        {
+            while (_pos < _end && std::isspace(static_cast<unsigned char>(
+                                      _buffer[_pos])) != 0)
+            {
+                ++_pos;
+            }
+            if (_pos < _end || !fill())
+            {
+                break;
+            }
+        }
+        if (_pos == _end)
+        {
+            return false;
+        }
+
+        // Find the end of the token. A token at the end of the buffer might be
+        // continued in the next chunk.
+        std::size_t token_end = _pos;
+        for (;;)
+        {
+            while (token_end < _end && std::isspace(static_cast<unsigned char>(
+                                           _buffer[token_end])) == 0)
+            {
+                ++token_end;
+            }
+            if (token_end < _end)
+            {
+                break;
+            }
+            auto const offset = token_end - _pos;
+            bool const filled = fill();
+            token_end = _pos + offset;
+            if (!filled)
+            {
+                break;
+            }
+        }
+
+        char* const token = &_buffer[_pos];
+        std::replace(token, &_buffer[token_end], ',', '.');
+        // The token is followed by whitespace or by the terminating zero.
+        value = std::strtod(token, nullptr);
+        _pos = token_end;
+        return true;
+    }
+
+private:
+    /// Moves the unread rest to the front of the buffer and appends the next
+    /// chunk. Returns false if nothing could be read.
+    bool fill()
+    {
+        std::size_t const rest = _end - _pos;
+        std::copy(_buffer.begin() + _pos, _buffer.begin() + _end,
+                  _buffer.begin());
+        if (_buffer.size() < rest + chunk_size + 1)
+        {
+            _buffer.resize(rest + chunk_size + 1);
+        }
+        _in.read(&_buffer[rest], chunk_size);
+        auto const n = static_cast<std::size_t>(_in.gcount());
+        _pos = 0;
+        _end = rest + n;
+        _buffer[_end] = '\0';
+        return n > 0;
+    }
+
+    static constexpr std::size_t chunk_size = 1 << 20;
+
+    std::istream& _in;
+    std::vector<char> _buffer = std::vector<char>(1, '\0');
+    std::size_t _pos = 0;
+    std::size_t _end = 0;
+};
+}  // namespace
+
 namespace FileIO
 {
 
-GeoLib::Raster* AsciiRasterInterface::readRaster(std::string const& fname)
+GeoLib::Raster* AsciiRasterInterface::readRaster(
+    std::string const& fname, boost::optional<GeoLib::AABB> const& region)
 {
     std::string ext (BaseLib::getFileExtension(fname));
     std::transform(ext.begin(), ext.end(), ext.begin(), tolower);
     if (ext == "asc")
     {
-        return getRasterFromASCFile(fname);
+        return getRasterFromASCFile(fname, region);
     }
     if (ext == "grd")
     {
-        return getRasterFromSurferFile(fname);
+        return getRasterFromSurferFile(fname, region);
     }
     return nullptr;
 }
 
-GeoLib::Raster* AsciiRasterInterface::getRasterFromASCFile(std::string const& fname)
+GeoLib::Raster* AsciiRasterInterface::getRasterFromASCFile(
+    std::string const& fname, boost::optional<GeoLib::AABB> const& region)
 {
     std::ifstream in(fname.c_str());
 
@@ -51,22 +216,27 @@ GeoLib::Raster* AsciiRasterInterface::getRasterFromASCFile(std::string const& fn
     // header information
     GeoLib::RasterHeader header;
     if (readASCHeader(in, header)) {
-        auto* values = new double[header.n_cols * header.n_rows];
-        std::string s;
-        // read the data into the double-array
+        auto const window = getRasterWindow(header, region);
+        auto window_header = getWindowHeader(header, window);
+        std::vector<double> values(window_header.n_cols *
+                                   window_header.n_rows);
+        ChunkedValueReader reader(in);
+        double value = 0;
+        // read the data into the double-array, the rows are stored from top to
+        // bottom in the file
         for (std::size_t j(0); j < header.n_rows; ++j) {
-            const std::size_t idx ((header.n_rows - j - 1) * header.n_cols);
+            const std::size_t row (header.n_rows - j - 1);
             for (std::size_t i(0); i < header.n_cols; ++i) {
-                in >> s;
-                values[idx + i] = strtod(
-                    BaseLib::replaceString(",", ".", s).c_str(), nullptr);
+                reader.read(value);
+                if (window.contains(i, row))
+                {
+                    values[window.index(i, row)] = value;
+                }
             }
         }
         in.close();
-        GeoLib::Raster* raster(new GeoLib::Raster(
-            std::move(header), values, values + header.n_cols * header.n_rows));
-        delete [] values;
-        return raster;
+        return new GeoLib::Raster(std::move(window_header), values.begin(),
+                                  values.end());
     }
     WARN("Raster::getRasterFromASCFile(): Could not read header of file %s",
          fname.c_str());
@@ -154,7 +324,8 @@ bool AsciiRasterInterface::readASCHeader(std::ifstream &in, GeoLib::RasterHeader
     return true;
 }
 
-GeoLib::Raster* AsciiRasterInterface::getRasterFromSurferFile(std::string const& fname)
+GeoLib::Raster* AsciiRasterInterface::getRasterFromSurferFile(
+    std::string const& fname, boost::optional<GeoLib::AABB> const& region)
 {
     std::ifstream in(fname.c_str());
 
@@ -171,25 +342,29 @@ GeoLib::Raster* AsciiRasterInterface::getRasterFromSurferFile(std::string const&
     if (readSurferHeader(in, header, min, max))
     {
         const double no_data_val (min-1);
-        auto* values = new double[header.n_cols * header.n_rows];
-        std::string s;
+        auto const window = getRasterWindow(header, region);
+        auto window_header = getWindowHeader(header, window);
+        std::vector<double> values(window_header.n_cols *
+                                   window_header.n_rows);
+        ChunkedValueReader reader(in);
+        double val = 0;
         // read the data into the double-array
         for (std::size_t j(0); j < header.n_rows; ++j)
         {
-            const std::size_t idx (j * header.n_cols);
             for (std::size_t i(0); i < header.n_cols; ++i)
             {
-                in >> s;
-                const double val(strtod(
-                    BaseLib::replaceString(",", ".", s).c_str(), nullptr));
-                values[idx+i] = (val > max || val < min) ? no_data_val : val;
+                reader.read(val);
+                if (!window.contains(i, j))
+                {
+                    continue;
+                }
+                values[window.index(i, j)] =
+                    (val > max || val < min) ? no_data_val : val;
             }
         }
         in.close();
-        GeoLib::Raster* raster(new GeoLib::Raster(
-            std::move(header), values, values + header.n_cols * header.n_rows));
-        delete [] values;
-        return raster;
+        return new GeoLib::Raster(std::move(window_header), values.begin(),
+                                  values.end());
     }
     ERR("Raster::getRasterFromASCFile() - could not read header of file %s",
         fname.c_str());
@@ -281,18 +456,21 @@ static bool allRastersExist(std::vector<std::string> const& raster_paths)
 }
 
 boost::optional<std::vector<GeoLib::Raster const*>> readRasters(
-    std::vector<std::string> const& raster_paths)
+    std::vector<std::string> const& raster_paths,
+    boost::optional<GeoLib::AABB> const& region)
 {
     if (!allRastersExist(raster_paths))
     {
         return boost::none;
     }
 
-    std::vector<GeoLib::Raster const*> rasters;
-    rasters.reserve(raster_paths.size());
-    for (auto const& path : raster_paths)
+    std::vector<GeoLib::Raster const*> rasters(raster_paths.size());
+    auto const n_rasters = static_cast<std::ptrdiff_t>(raster_paths.size());
+#pragma omp parallel for schedule(dynamic, 1)
+    for (std::ptrdiff_t i = 0; i < n_rasters; ++i)
     {
-        rasters.push_back(FileIO::AsciiRasterInterface::readRaster(path));
+        rasters[i] =
+            FileIO::AsciiRasterInterface::readRaster(raster_paths[i], region);
     }
     return boost::make_optional(rasters);
 }
@@ -18,6 +18,7 @@
 #include <string>
 #include <boost/optional.hpp>
 
+#include "GeoLib/AABB.h"
 #include "GeoLib/Raster.h"
 
 namespace FileIO
@@ -30,13 +31,21 @@ namespace FileIO
 class AsciiRasterInterface {
 public:
     /// Reads raster file by detecting type based on extension and then calling the apropriate method
-    static GeoLib::Raster* readRaster(std::string const& fname);
+    /// If a region is given, only the part of the raster covering the
+    /// (x,y)-extent of the region is kept in memory.
+    static GeoLib::Raster* readRaster(
+        std::string const& fname,
+        boost::optional<GeoLib::AABB> const& region = boost::none);
 
     /// Reads an ArcGis ASC raster file
-    static GeoLib::Raster* getRasterFromASCFile(std::string const& fname);
+    static GeoLib::Raster* getRasterFromASCFile(
+        std::string const& fname,
+        boost::optional<GeoLib::AABB> const& region = boost::none);
 
     /// Reads a Surfer GRD raster file
-    static GeoLib::Raster* getRasterFromSurferFile(std::string const& fname);
+    static GeoLib::Raster* getRasterFromSurferFile(
+        std::string const& fname,
+        boost::optional<GeoLib::AABB> const& region = boost::none);
 
     /// Writes an Esri asc-file
     static void writeRasterAsASC(GeoLib::Raster const& raster, std::string const& file_name);
@@ -53,6 +62,9 @@ private:
 
 /// Reads a vector of rasters given by file names. On error nothing is returned,
 /// otherwise the returned vector contains pointers to the read rasters.
+/// The rasters are read in parallel. If a region is given, only the parts of
+/// the rasters covering the (x,y)-extent of the region are kept in memory.
 boost::optional<std::vector<GeoLib::Raster const*>> readRasters(
-    std::vector<std::string> const& raster_paths);
+    std::vector<std::string> const& raster_paths,
+    boost::optional<GeoLib::AABB> const& region = boost::none);
 } // end namespace FileIO
@@ -14,6 +14,7 @@
 #include "CsvInterface.h"
 
 #include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <numeric>
 
@@ -74,11 +75,11 @@ int CsvInterface::readPoints(std::string const& fname, char delim,
 
     std::size_t line_count(0);
     std::size_t error_count(0);
-    std::list<std::string>::const_iterator it;
+    std::vector<std::string_view> fields;
     while ( getline(in, line) )
     {
         line_count++;
-        std::list<std::string> const fields = BaseLib::splitString(line, delim);
+        splitLine(line, delim, fields);
 
         if (fields.size() < 3)
         {
@@ -86,14 +87,15 @@ int CsvInterface::readPoints(std::string const& fname, char delim,
             error_count++;
             continue;
         }
-        it = fields.begin();
         std::array<double, 3> point;
-        try {
-            point[0] = std::stod(*it);
-            point[1] = std::stod(*(++it));
-            point[2] = std::stod(*(++it));
+        if (parseDouble(fields[0], point[0]) &&
+            parseDouble(fields[1], point[1]) &&
+            parseDouble(fields[2], point[2]))
+        {
             points.push_back(new GeoLib::Point(point[0], point[1], point[2]));
-        } catch (const std::invalid_argument&) {
+        }
+        else
+        {
             ERR ("Error converting data to coordinates in line %d.", line_count);
         }
     }
@@ -161,25 +163,20 @@ int CsvInterface::readPoints(std::ifstream &in, char delim,
                              std::vector<GeoLib::Point*> &points,
                              std::array<std::size_t, 3> const& column_idx)
 {
-    std::array<std::size_t, 3> order = {{ 0, 1, 2 }};
-    std::sort(order.begin(), order.end(),
-        [&column_idx](std::size_t idx1, std::size_t idx2) {return column_idx[idx1] < column_idx[idx2];});
-    std::array<std::size_t, 3> const column_advance =
-        {{ column_idx[order[0]],
-           column_idx[order[1]] - column_idx[order[0]],
-           column_idx[order[2]] - column_idx[order[1]] }};
+    std::size_t const max_column_idx =
+        *std::max_element(column_idx.begin(), column_idx.end());
 
     std::string line;
     std::size_t line_count(0);
     std::size_t error_count(0);
-    std::list<std::string>::const_iterator it;
+    std::vector<std::string_view> fields;
 
     while ( getline(in, line) )
     {
         line_count++;
-        std::list<std::string> const fields = BaseLib::splitString(line, delim);
+        splitLine(line, delim, fields);
 
-        if (fields.size() < column_idx[order[2]]+1)
+        if (fields.size() < max_column_idx+1)
         {
             ERR ("Line %d contains not enough columns of data. Skipping line...", line_count);
             error_count++;
@@ -187,16 +184,16 @@ int CsvInterface::readPoints(std::ifstream &in, char delim,
         }
 
         std::array<double, 3> point;
-        it = fields.begin();
-        try {
-            std::advance(it, column_advance[0]);
-            point[order[0]] = std::stod(*it);
-            std::advance(it, column_advance[1]);
-            point[order[1]] = std::stod(*it);
-            std::advance(it, column_advance[2]);
-            point[order[2]] = (column_idx[1] == column_idx[2]) ? 0 : std::stod(*it);
+        point[2] = 0;
+        if (parseDouble(fields[column_idx[0]], point[0]) &&
+            parseDouble(fields[column_idx[1]], point[1]) &&
+            (column_idx[1] == column_idx[2] ||
+             parseDouble(fields[column_idx[2]], point[2])))
+        {
             points.push_back(new GeoLib::Point(point[0], point[1], point[2]));
-        } catch (const std::invalid_argument&) {
+        }
+        else
+        {
             ERR ("Error converting data to coordinates in line %d.", line_count);
             error_count++;
         }
@@ -204,6 +201,47 @@ int CsvInterface::readPoints(std::ifstream &in, char delim,
     return error_count;
 }
 
+void CsvInterface::splitLine(std::string_view const line, char const delim,
+                             std::vector<std::string_view>& fields)
+{
+    fields.clear();
+    std::size_t begin = 0;
+    while (begin < line.size())
+    {
+        auto end = line.find(delim, begin);
+        if (end == std::string_view::npos)
+        {
+            end = line.size();
+        }
+        fields.push_back(line.substr(begin, end - begin));
+        begin = end + 1;
+    }
+}
+
+bool CsvInterface::parseDouble(std::string_view const field, double& value)
+{
+    // strtod needs a null terminated string. Short fields are copied to the
+    // stack to avoid an allocation.
+    std::array<char, 64> buffer;
+    std::string long_field;
+    char const* str;
+    if (field.size() < buffer.size())
+    {
+        std::copy(field.begin(), field.end(), buffer.begin());
+        buffer[field.size()] = '\0';
+        str = buffer.data();
+    }
+    else
+    {
+        long_field = field;
+        str = long_field.c_str();
+    }
+
+    char* end = nullptr;
+    value = std::strtod(str, &end);
+    return end != str;
+}
+
 std::size_t CsvInterface::findColumn(std::string const& line, char delim, std::string const& column_name)
 {
     std::list<std::string> const fields = BaseLib::splitString(line, delim);
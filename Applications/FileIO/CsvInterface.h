@@ -21,7 +21,10 @@
 #include <iterator>
 #include <limits>
 #include <list>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <typeinfo>
 #include <vector>
 
@@ -196,11 +199,11 @@ private:
         std::string line;
         std::size_t line_count(0);
         std::size_t error_count(0);
-        std::list<std::string>::const_iterator it;
+        std::vector<std::string_view> fields;
         while ( getline(in, line) )
         {
             line_count++;
-            std::list<std::string> const fields = BaseLib::splitString(line, delim);
+            splitLine(line, delim, fields);
 
             if (fields.size() < column_idx+1)
             {
@@ -208,12 +211,9 @@ private:
                 error_count++;
                 continue;
             }
-            it = fields.begin();
-            std::advance(it, column_idx);
 
-            std::istringstream stream(*it);
             T value;
-            if (!(stream >> value))
+            if (!parseValue(fields[column_idx], value))
             {
                 ERR("Error reading value in line %d.", line_count);
                 error_count++;
@@ -225,6 +225,31 @@ private:
         return error_count;
     }
 
+    /// Splits the line at the delimiter like BaseLib::splitString() but
+    /// without copying the fields. The \c fields vector is reused, s.t. no
+    /// memory is allocated per line.
+    static void splitLine(std::string_view line, char delim,
+                          std::vector<std::string_view>& fields);
+
+    /// Converts a field like std::strtod, i.e. leading whitespace is skipped
+    /// and the longest valid prefix is converted.
+    /// \return false if the field does not start with a number.
+    static bool parseDouble(std::string_view field, double& value);
+
+    template <typename T>
+    static bool parseValue(std::string_view const field, T& value)
+    {
+        if constexpr (std::is_same<T, double>::value)
+        {
+            return parseDouble(field, value);
+        }
+        else
+        {
+            std::istringstream stream{std::string(field)};
+            return static_cast<bool>(stream >> value);
+        }
+    }
+
     /// Returns the number of the column with column_name (or std::numeric_limits::max() if no such column has been found).
     static std::size_t findColumn(std::string const& line, char delim, std::string const& column_name);
 
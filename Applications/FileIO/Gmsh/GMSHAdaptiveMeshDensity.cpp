@@ -75,6 +75,9 @@ void GMSHAdaptiveMeshDensity::initialize(std::vector<GeoLib::Point const*> const
 
     // *** QuadTree - create object
     DBUG("GMSHAdaptiveMeshDensity::init(): Creating quadtree.");
+    // The strategy is shared by the polygon trees, each of which initializes
+    // it again.
+    delete _quad_tree;
     _quad_tree = new GeoLib::QuadTree<GeoLib::Point> (min, max, _max_pnts_per_leaf);
     DBUG("GMSHAdaptiveMeshDensity::init(): \tok.");
 
@@ -172,13 +172,15 @@ int GMSHInterface::writeGMSHInputFile(std::ostream& out)
         auto const* stations(_geo_objs.getStationVec(geometry_name));
         if (stations) {
             for (auto * station : *stations) {
-                bool found(false);
-                for (auto it(_polygon_tree_list.begin());
-                    it != _polygon_tree_list.end() && !found; ++it) {
-                    gmsh_stations->emplace_back(new GeoLib::Station(
-                        *static_cast<GeoLib::Station*>(station)));
-                    if ((*it)->insertStation(gmsh_stations->back())) {
-                        found = true;
+                // copy the station once and try the polygon trees until one
+                // of them takes it
+                gmsh_stations->emplace_back(new GeoLib::Station(
+                    *static_cast<GeoLib::Station*>(station)));
+                for (auto* polygon_tree : _polygon_tree_list)
+                {
+                    if (polygon_tree->insertStation(gmsh_stations->back()))
+                    {
+                        break;
                     }
                 }
             }
@@ -10,6 +10,8 @@
 
 #include "GMSHPolygonTree.h"
 
+#include <optional>
+
 #include "GMSHFixedMeshDensity.h"
 #include "GMSHAdaptiveMeshDensity.h"
 
@@ -257,8 +259,9 @@ void GMSHPolygonTree::initMeshDensityStrategy()
 
         // give collected points to the mesh density strategy
         adaptive_mesh_density->initialize(pnts);
-        // insert constraints
-        adaptive_mesh_density->addPoints(_stations);
+        // insert constraints; the stations of this node are collected
+        // together with the ones of the sub polygons, such that the quadtree
+        // is balanced only once
         std::vector<GeoLib::Point const*> stations;
         getStationsInsideSubPolygons(stations);
         adaptive_mesh_density->addPoints(stations);
@@ -280,23 +283,36 @@ void GMSHPolygonTree::createGMSHPoints(std::vector<GMSHPoint*> & gmsh_pnts) cons
             *pnt, id, _mesh_density_strategy.getMeshDensityAtPoint(pnt));
     }
 
-    const std::size_t n_plys(_plys.size());
-    for (std::size_t k(0); k<n_plys; k++) {
-        const std::size_t n_pnts_in_ply(_plys[k]->getNumberOfPoints());
-        for (std::size_t j(0); j<n_pnts_in_ply; j++) {
-            if (_node_polygon->isPntInPolygon(*(_plys[k]->getPoint(j)))) {
-                const std::size_t id (_plys[k]->getPointID(j));
-                // if this point was already part of another polyline
-                if (gmsh_pnts[id] != nullptr)
-                {
-                    continue;
-                }
-                GeoLib::Point const*const pnt(_plys[k]->getPoint(j));
-                gmsh_pnts[id] = new GMSHPoint(
-                    *pnt, id,
-                    _mesh_density_strategy.getMeshDensityAtPoint(pnt));
+    // The point in polygon tests and the mesh densities are computed for all
+    // points of a polyline at once, the points are created afterwards.
+    std::vector<std::optional<double>> densities;
+    for (auto const* polyline : _plys)
+    {
+        auto const n_signed =
+            static_cast<long>(polyline->getNumberOfPoints());
+        densities.assign(n_signed, std::nullopt);
+#pragma omp parallel for schedule(dynamic, 64)
+        for (long j = 0; j < n_signed; ++j)
+        {
+            GeoLib::Point const* const pnt(polyline->getPoint(j));
+            if (_node_polygon->isPntInPolygon(*pnt))
+            {
+                densities[j] = _mesh_density_strategy.getMeshDensityAtPoint(pnt);
             }
         }
+
+        for (long j = 0; j < n_signed; ++j)
+        {
+            const std::size_t id(polyline->getPointID(j));
+            // skip points outside of the polygon and points that were
+            // already part of another polyline
+            if (!densities[j] || gmsh_pnts[id] != nullptr)
+            {
+                continue;
+            }
+            gmsh_pnts[id] =
+                new GMSHPoint(*polyline->getPoint(j), id, *densities[j]);
+        }
     }
 
     // walk through children
@@ -400,12 +416,25 @@ void GMSHPolygonTree::writeAdditionalPointData(std::size_t & pnt_id_offset, std:
         std::vector<GeoLib::Point*> steiner_pnts;
         adaptive_mesh_density->getSteinerPoints(steiner_pnts, 0);
         const std::size_t n(steiner_pnts.size());
+
+        // Test all Steiner points at once, the points outside of the
+        // polygon have no density.
+        std::vector<std::optional<double>> densities(n);
+        auto const n_signed = static_cast<long>(n);
+#pragma omp parallel for schedule(dynamic, 256)
+        for (long k = 0; k < n_signed; ++k)
+        {
+            if (_node_polygon->isPntInPolygon(*(steiner_pnts[k])))
+            {
+                densities[k] = _mesh_density_strategy.getMeshDensityAtPoint(
+                    steiner_pnts[k]);
+            }
+        }
+
         for (std::size_t k(0); k<n; k++) {
-            if (_node_polygon->isPntInPolygon(*(steiner_pnts[k]))) {
+            if (densities[k]) {
                 out << "Point(" << pnt_id_offset + k << ") = {" << (*(steiner_pnts[k]))[0] << "," << (*(steiner_pnts[k]))[1] << ", 0.0, ";
-                out << _mesh_density_strategy.getMeshDensityAtPoint(
-                           steiner_pnts[k])
-                    << "};\n";
+                out << *densities[k] << "};\n";
                 out << "Point { " << pnt_id_offset + k << " } In Surface { " << sfc_number << " };\n";
             }
             delete steiner_pnts[k];
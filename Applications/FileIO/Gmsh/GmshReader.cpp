@@ -24,9 +24,12 @@
 #include "MeshLib/MeshEditing/ElementValueModification.h"
 
 #include "BaseLib/FileTools.h"
+#include "BaseLib/IO/TextScanner.h"
 
+#include <array>
 #include <fstream>
 #include <map>
+#include <sstream>
 #include <vector>
 
 namespace FileIO
@@ -59,20 +62,63 @@ bool isGMSHMeshFile(const std::string& fname)
     return false;
 }
 
-void readNodeIDs(std::ifstream& in, unsigned n_nodes,
+void readNodeIDs(BaseLib::IO::TextScanner& in, unsigned n_nodes,
                  std::vector<unsigned>& node_ids,
                  std::map<unsigned, unsigned> const& id_map)
 {
     unsigned idx;
     for (unsigned i = 0; i < n_nodes; i++)
     {
-        in >> idx;
+        in.read(idx);
         node_ids.push_back(id_map.at(idx));
     }
 }
 
+/// Number of nodes of the GMSH element types, 0 for unknown types.
+unsigned getNumberOfElementNodes(unsigned const type)
+{
+    static std::array<unsigned, 20> const number_of_nodes = {
+        0, 2, 3, 4, 4, 8, 6, 5, 3, 6, 9, 10, 27, 18, 14, 1, 8, 20, 15, 13};
+    return type < number_of_nodes.size() ? number_of_nodes[type] : 0;
+}
+
+/// True for the GMSH element types which are converted into OGS elements,
+/// i.e. the linear line, triangle, quadrilateral, tetrahedron, hexahedron,
+/// prism and pyramid elements.
+bool isSupportedElementType(unsigned const type)
+{
+    return type >= 1 && type <= 7;
+}
+
+/// Creates the element of a supported GMSH element type. The element takes
+/// the ownership of the \c element_nodes given in the GMSH node order.
+MeshLib::Element* createElement(unsigned const type,
+                                MeshLib::Node** const element_nodes)
+{
+    switch (type)
+    {
+        case 1:
+            return new MeshLib::Line(element_nodes);
+        case 2:
+            std::swap(element_nodes[0], element_nodes[2]);
+            return new MeshLib::Tri(element_nodes);
+        case 3:
+            return new MeshLib::Quad(element_nodes);
+        case 4:
+            return new MeshLib::Tet(element_nodes);
+        case 5:
+            return new MeshLib::Hex(element_nodes);
+        case 6:
+            return new MeshLib::Prism(element_nodes);
+        case 7:
+            return new MeshLib::Pyramid(element_nodes);
+    }
+    delete[] element_nodes;
+    return nullptr;
+}
+
 std::pair<MeshLib::Element*, int> readElement(
-    std::ifstream& in, std::vector<MeshLib::Node*> const& nodes,
+    BaseLib::IO::TextScanner& in, std::vector<MeshLib::Node*> const& nodes,
     std::map<unsigned, unsigned> const& id_map)
 {
     unsigned idx;
@@ -81,127 +127,405 @@ std::pair<MeshLib::Element*, int> readElement(
     unsigned dummy;
     int mat_id;
     std::vector<unsigned> node_ids;
-    in >> idx >> type >> n_tags >> mat_id >> dummy;
+    in.read(idx, type, n_tags, mat_id, dummy);
 
     // skip tags
     for (std::size_t j = 2; j < n_tags; j++)
     {
-        in >> dummy;
+        in.skipToken();
     }
 
-    switch (type)
+    if (type == 15)
+    {
+        in.skipToken();  // skip rest of line
+        return std::make_pair(nullptr, -1);
+    }
+    if (!isSupportedElementType(type))
+    {
+        WARN("readGMSHMesh(): Unknown element type %d.", type);
+        return std::make_pair(nullptr, -1);
+    }
+
+    unsigned const n_element_nodes = getNumberOfElementNodes(type);
+    readNodeIDs(in, n_element_nodes, node_ids, id_map);
+    // element_nodes array will be deleted from the element
+    auto element_nodes = new MeshLib::Node*[n_element_nodes];
+    for (unsigned k = 0; k < n_element_nodes; k++)
+    {
+        element_nodes[k] = nodes[node_ids[k]];
+    }
+    return std::make_pair(createElement(type, element_nodes), mat_id);
+}
+
+/// Reads the values of the sections of the MSH 4.1 format, which are stored
+/// either binary or as ASCII text.
+class MSH41Scanner
+{
+public:
+    MSH41Scanner(BaseLib::IO::TextScanner& in, bool const binary)
+        : _in(in), _binary(binary)
     {
-    case 1: {
-        readNodeIDs(in, 2, node_ids, id_map);
-        // edge_nodes array will be deleted from Line object
-        auto edge_nodes = new MeshLib::Node*[2];
-        edge_nodes[0] = nodes[node_ids[0]];
-        edge_nodes[1] = nodes[node_ids[1]];
-        return std::make_pair(new MeshLib::Line(edge_nodes), mat_id);
     }
-    case 2: {
-        readNodeIDs(in, 3, node_ids, id_map);
-        auto tri_nodes = new MeshLib::Node*[3];
-        tri_nodes[0] = nodes[node_ids[2]];
-        tri_nodes[1] = nodes[node_ids[1]];
-        tri_nodes[2] = nodes[node_ids[0]];
-        return std::make_pair(new MeshLib::Tri(tri_nodes), mat_id);
+
+    template <typename T>
+    T read()
+    {
+        T value;
+        read(&value, 1);
+        return value;
     }
-    case 3: {
-        readNodeIDs(in, 4, node_ids, id_map);
-        auto quad_nodes = new MeshLib::Node*[4];
-        for (unsigned k(0); k < 4; k++)
+
+    template <typename T>
+    void read(T* const values, std::size_t const n)
+    {
+        if (_binary)
         {
-            quad_nodes[k] = nodes[node_ids[k]];
+            if (!_in.readBinary(values, n))
+            {
+                OGS_FATAL("readGMSHMesh(): Unexpected end of the MSH file.");
+            }
+            return;
+        }
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (!_in.read(values[i]))
+            {
+                OGS_FATAL("readGMSHMesh(): Could not read value from MSH file.");
+            }
         }
-        return std::make_pair(new MeshLib::Quad(quad_nodes), mat_id);
     }
-    case 4: {
-        readNodeIDs(in, 4, node_ids, id_map);
-        auto tet_nodes = new MeshLib::Node*[5];
-        for (unsigned k(0); k < 4; k++)
+
+    template <typename T>
+    std::vector<T> readVector(std::size_t const n)
+    {
+        std::vector<T> values(n);
+        read(values.data(), n);
+        return values;
+    }
+
+private:
+    BaseLib::IO::TextScanner& _in;
+    bool const _binary;
+};
+
+/// Reads the \$Entities section and returns the first physical tag of each
+/// entity given by its dimension and tag.
+std::map<std::pair<int, int>, int> readEntityPhysicalTags(MSH41Scanner& in)
+{
+    std::array<std::size_t, 4> number_of_entities;
+    in.read(number_of_entities.data(), number_of_entities.size());
+
+    std::map<std::pair<int, int>, int> physical_tags;
+    for (int dim = 0; dim < 4; ++dim)
+    {
+        for (std::size_t e = 0; e < number_of_entities[dim]; ++e)
         {
-            tet_nodes[k] = nodes[node_ids[k]];
+            auto const tag = in.read<int>();
+            // The coordinates of a point or the bounding box.
+            in.readVector<double>(dim == 0 ? 3 : 6);
+            auto const physical =
+                in.readVector<int>(in.read<std::size_t>());
+            if (!physical.empty())
+            {
+                physical_tags[{dim, tag}] = physical.front();
+            }
+            if (dim > 0)
+            {
+                // The bounding entities.
+                in.readVector<int>(in.read<std::size_t>());
+            }
         }
-        return std::make_pair(new MeshLib::Tet(tet_nodes), mat_id);
     }
-    case 5: {
-        readNodeIDs(in, 8, node_ids, id_map);
-        auto hex_nodes = new MeshLib::Node*[8];
-        for (unsigned k(0); k < 8; k++)
+    return physical_tags;
+}
+
+/// Reads the \$Nodes section block by block into \c nodes and returns the
+/// map from node tags to node indices.
+std::vector<std::size_t> readNodes41(MSH41Scanner& in,
+                                     std::vector<MeshLib::Node*>& nodes)
+{
+    auto const n_blocks = in.read<std::size_t>();
+    auto const n_nodes = in.read<std::size_t>();
+    in.read<std::size_t>();  // minimal node tag
+    auto const max_tag = in.read<std::size_t>();
+
+    std::vector<std::size_t> node_indices(max_tag + 1, n_nodes);
+    nodes.resize(n_nodes);
+    std::size_t offset = 0;
+    for (std::size_t b = 0; b < n_blocks; ++b)
+    {
+        auto const dim = in.read<int>();
+        in.read<int>();  // entity tag
+        auto const parametric = in.read<int>();
+        auto const n = in.read<std::size_t>();
+        if (offset + n > n_nodes)
+        {
+            OGS_FATAL("readGMSHMesh(): More nodes than the %d announced.",
+                      n_nodes);
+        }
+
+        auto const tags = in.readVector<std::size_t>(n);
+        auto const stride = 3 + (parametric != 0 ? dim : 0);
+        auto const coordinates = in.readVector<double>(stride * n);
+
+        for (std::size_t k = 0; k < n; ++k)
         {
-            hex_nodes[k] = nodes[node_ids[k]];
+            if (tags[k] > max_tag)
+            {
+                OGS_FATAL("readGMSHMesh(): Node tag %d exceeds maximum %d.",
+                          tags[k], max_tag);
+            }
+            node_indices[tags[k]] = offset + k;
+        }
+
+        auto const n_block_nodes = static_cast<std::ptrdiff_t>(n);
+#pragma omp parallel for
+        for (std::ptrdiff_t k = 0; k < n_block_nodes; ++k)
+        {
+            double const* const x = &coordinates[stride * k];
+            nodes[offset + k] = new MeshLib::Node(x[0], x[1], x[2], offset + k);
         }
-        return std::make_pair(new MeshLib::Hex(hex_nodes), mat_id);
+        offset += n;
     }
-    case 6: {
-        readNodeIDs(in, 6, node_ids, id_map);
-        auto prism_nodes = new MeshLib::Node*[6];
-        for (unsigned k(0); k < 6; k++)
+    if (offset != n_nodes)
+    {
+        OGS_FATAL("readGMSHMesh(): Read %d nodes, but %d were announced.",
+                  offset, n_nodes);
+    }
+    return node_indices;
+}
+
+/// Reads the \$Elements section block by block. The material id of an
+/// element is the first physical tag of its entity or zero.
+void readElements41(MSH41Scanner& in, std::vector<MeshLib::Node*> const& nodes,
+                    std::vector<std::size_t> const& node_indices,
+                    std::map<std::pair<int, int>, int> const& physical_tags,
+                    std::vector<MeshLib::Element*>& elements,
+                    std::vector<int>& materials)
+{
+    auto const n_blocks = in.read<std::size_t>();
+    auto const n_elements = in.read<std::size_t>();
+    in.read<std::size_t>();  // minimal element tag
+    in.read<std::size_t>();  // maximal element tag
+
+    elements.reserve(n_elements);
+    materials.reserve(n_elements);
+    for (std::size_t b = 0; b < n_blocks; ++b)
+    {
+        auto const dim = in.read<int>();
+        auto const entity_tag = in.read<int>();
+        auto const type = in.read<int>();
+        auto const n = in.read<std::size_t>();
+
+        auto const n_element_nodes = getNumberOfElementNodes(type);
+        if (n_element_nodes == 0)
         {
-            prism_nodes[k] = nodes[node_ids[k]];
+            OGS_FATAL("readGMSHMesh(): Unknown element type %d.", type);
+        }
+        // Each element is given by its tag followed by its node tags.
+        auto const data = in.readVector<std::size_t>(n * (n_element_nodes + 1));
+
+        if (!isSupportedElementType(type))
+        {
+            if (type != 15)
+            {
+                WARN("readGMSHMesh(): Skipping %d elements of type %d.", n,
+                     type);
+            }
+            continue;
+        }
+
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            for (unsigned j = 1; j <= n_element_nodes; ++j)
+            {
+                auto const tag = data[k * (n_element_nodes + 1) + j];
+                if (tag >= node_indices.size() ||
+                    node_indices[tag] >= nodes.size())
+                {
+                    OGS_FATAL("readGMSHMesh(): Unknown node tag %d.", tag);
+                }
+            }
+        }
+
+        auto const it = physical_tags.find({dim, entity_tag});
+        int const mat_id = it == physical_tags.end() ? 0 : it->second;
+
+        auto const offset = elements.size();
+        elements.resize(offset + n);
+        materials.resize(offset + n, mat_id);
+        auto const n_block_elements = static_cast<std::ptrdiff_t>(n);
+#pragma omp parallel for
+        for (std::ptrdiff_t k = 0; k < n_block_elements; ++k)
+        {
+            std::size_t const* const element_data =
+                &data[k * (n_element_nodes + 1)];
+            // element_nodes array will be deleted from the element
+            auto element_nodes = new MeshLib::Node*[n_element_nodes];
+            for (unsigned j = 0; j < n_element_nodes; ++j)
+            {
+                element_nodes[j] = nodes[node_indices[element_data[j + 1]]];
+            }
+            elements[offset + k] = createElement(type, element_nodes);
         }
-        return std::make_pair(new MeshLib::Prism(prism_nodes), mat_id);
     }
-    case 7: {
-        readNodeIDs(in, 5, node_ids, id_map);
-        auto pyramid_nodes = new MeshLib::Node*[5];
-        for (unsigned k(0); k < 5; k++)
+}
+
+/// Reads the sections of the MSH 4.1 format following the \$MeshFormat
+/// section.
+void readGMSH41Sections(BaseLib::IO::TextScanner& text, bool const binary,
+                        std::vector<MeshLib::Node*>& nodes,
+                        std::vector<MeshLib::Element*>& elements,
+                        std::vector<int>& materials)
+{
+    MSH41Scanner in(text, binary);
+    std::map<std::pair<int, int>, int> physical_tags;
+    std::vector<std::size_t> node_indices;
+
+    text.skipWhitespace();
+    while (!text.eof())
+    {
+        std::string const section(text.readToken());
+        if (section.empty() || section[0] != '$')
+        {
+            OGS_FATAL("readGMSHMesh(): Expected a section, got '%s'.",
+                      section.c_str());
+        }
+        text.getLine();
+
+        if (section == "$Entities")
         {
-            pyramid_nodes[k] = nodes[node_ids[k]];
+            physical_tags = readEntityPhysicalTags(in);
         }
-        return std::make_pair(new MeshLib::Pyramid(pyramid_nodes), mat_id);
+        else if (section == "$Nodes")
+        {
+            node_indices = readNodes41(in, nodes);
+        }
+        else if (section == "$Elements")
+        {
+            readElements41(in, nodes, node_indices, physical_tags, elements,
+                           materials);
+        }
+        // Continue after the end of the section; other sections are skipped.
+        text.skipPast("$End" + section.substr(1));
+        text.getLine();
+        text.skipWhitespace();
     }
-    case 15:
-        in >> dummy; // skip rest of line
-        break;
-    default:
-        WARN("readGMSHMesh(): Unknown element type %d.", type);
-        break;
+}
+
+/// Creates the mesh with the material ids from the data read.
+MeshLib::Mesh* createMesh(std::string const& fname,
+                          std::vector<MeshLib::Node*> const& nodes,
+                          std::vector<MeshLib::Element*> const& elements,
+                          std::vector<int> const& materials)
+{
+    if (elements.empty()) {
+        for (auto& node : nodes)
+        {
+            delete node;
+        }
+        return nullptr;
     }
-    return std::make_pair(nullptr, -1);
+
+    MeshLib::Mesh * mesh(new MeshLib::Mesh(
+        BaseLib::extractBaseNameWithoutExtension(fname), nodes, elements));
+
+    auto* const material_ids =
+        mesh->getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    if (!material_ids)
+    {
+        WARN("Could not create PropertyVector for MaterialIDs in Mesh.");
+    }
+    else
+    {
+        material_ids->insert(material_ids->end(), materials.cbegin(),
+                             materials.cend());
+    }
+
+    MeshLib::ElementValueModification::condense(*mesh);
+
+    INFO("\t... finished.");
+    INFO("Nr. Nodes: %d.", nodes.size());
+    INFO("Nr. Elements: %d.", elements.size());
+
+    return mesh;
 }
 
 MeshLib::Mesh* readGMSHMesh(std::string const& fname)
 {
-    std::string line;
-    std::ifstream in(fname.c_str(), std::ios::in);
-    if (!in.is_open())
+    auto scanner = BaseLib::IO::TextScanner::fromFile(fname);
+    if (!scanner)
     {
         WARN ("readGMSHMesh() - Could not open file %s.", fname.c_str());
         return nullptr;
     }
+    auto& in = *scanner;
 
-    getline(in, line); // $MeshFormat keyword
+    std::string_view line = in.getLine();  // $MeshFormat keyword
     if (line.find("$MeshFormat") == std::string::npos)
     {
-        in.close();
         WARN ("No GMSH file format recognized.");
         return nullptr;
     }
 
-    getline(in, line); // version-number file-type data-size
+    line = in.getLine();  // version-number file-type data-size
+    if (line.substr(0, 3) == "4.1")
+    {
+        std::string version;
+        int file_type = 0;
+        int data_size = 0;
+        std::istringstream(std::string(line)) >> version >> file_type >>
+            data_size;
+        bool const binary = file_type == 1;
+        if (binary)
+        {
+            if (data_size != sizeof(std::size_t))
+            {
+                WARN("Gmsh binary files with data size %d are not supported.",
+                     data_size);
+                return nullptr;
+            }
+            int one = 0;
+            if (!in.readBinary(&one) || one != 1)
+            {
+                WARN("Gmsh binary files with a different byte order are not "
+                     "supported.");
+                return nullptr;
+            }
+        }
+        in.skipPast("$EndMeshFormat");
+        in.getLine();
+
+        std::vector<MeshLib::Node*> nodes;
+        std::vector<MeshLib::Element*> elements;
+        std::vector<int> materials;
+        readGMSH41Sections(in, binary, nodes, elements, materials);
+        return createMesh(fname, nodes, elements, materials);
+    }
+
     if (line.substr(0, 3) != "2.2")
     {
-        WARN("Wrong gmsh file format version '%s'.", line.substr(0,3).c_str());
+        WARN("Wrong gmsh file format version '%s'.",
+             std::string(line.substr(0, 3)).c_str());
         return nullptr;
     }
 
-    if (line[4] != '0')
+    if (line.size() < 5 || line[4] != '0')
     {
         WARN("Currently reading gmsh binary file type is not supported.");
         return nullptr;
     }
-    getline(in, line); //$EndMeshFormat
+    line = in.getLine();  //$EndMeshFormat
 
     std::vector<MeshLib::Node*> nodes;
     std::vector<MeshLib::Element*> elements;
     std::vector<int> materials;
     std::map<unsigned, unsigned> id_map;
-    while (line.find("$EndElements") == std::string::npos)
+    while (line.find("$EndElements") == std::string::npos && !in.eof())
     {
         // Node data
-        getline(in, line); //$Nodes Keywords
+        line = in.getLine();  //$Nodes Keywords
         if (line.find("$Nodes") != std::string::npos)
         {
             std::size_t n_nodes(0);
@@ -209,21 +533,22 @@ MeshLib::Mesh* readGMSHMesh(std::string const& fname)
             double x;
             double y;
             double z;
-            in >> n_nodes >> std::ws;
+            in.read(n_nodes);
             nodes.resize(n_nodes);
             for (std::size_t i = 0; i < n_nodes; i++) {
-                in >> id >> x >> y >> z >> std::ws;
+                in.read(id, x, y, z);
                 id_map.insert(std::map<unsigned, unsigned>::value_type(id, i));
                 nodes[i] = new MeshLib::Node(x,y,z,id);
             }
-            getline(in, line); // End Node keyword $EndNodes
+            in.skipWhitespace();
+            line = in.getLine();  // End Node keyword $EndNodes
         }
 
         // Element data
         if (line.find("$Elements") != std::string::npos)
         {
             std::size_t n_elements(0);
-            if (! (in >> n_elements >> std::ws)) { // number-of-elements
+            if (!in.read(n_elements)) {  // number-of-elements
                 ERR("Read GMSH mesh does not contain any elements");
             }
             elements.reserve(n_elements);
@@ -239,52 +564,23 @@ MeshLib::Mesh* readGMSHMesh(std::string const& fname)
                     materials.push_back(mat_id);
                 }
             }
-            getline(in, line); // END keyword
+            in.skipWhitespace();
+            line = in.getLine();  // END keyword
         }
 
         if (line.find("PhysicalNames") != std::string::npos)
         {
             std::size_t n_lines(0);
-            in >> n_lines >> std::ws; // number-of-lines
+            in.read(n_lines);  // number-of-lines
+            in.skipWhitespace();
             for (std::size_t i = 0; i < n_lines; i++)
             {
-                getline(in, line);
+                in.getLine();
             }
-            getline(in, line); // END keyword
+            line = in.getLine();  // END keyword
         }
     }
-    in.close();
-    if (elements.empty()) {
-        for (auto& node : nodes)
-        {
-            delete node;
-        }
-        return nullptr;
-    }
-
-    MeshLib::Mesh * mesh(new MeshLib::Mesh(
-        BaseLib::extractBaseNameWithoutExtension(fname), nodes, elements));
-
-    auto* const material_ids =
-        mesh->getProperties().createNewPropertyVector<int>(
-            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
-    if (!material_ids)
-    {
-        WARN("Could not create PropertyVector for MaterialIDs in Mesh.");
-    }
-    else
-    {
-        material_ids->insert(material_ids->end(), materials.cbegin(),
-                             materials.cend());
-    }
-
-    MeshLib::ElementValueModification::condense(*mesh);
-
-    INFO("\t... finished.");
-    INFO("Nr. Nodes: %d.", nodes.size());
-    INFO("Nr. Elements: %d.", elements.size());
-
-    return mesh;
+    return createMesh(fname, nodes, elements, materials);
 }
 
 } // end namespace GMSH
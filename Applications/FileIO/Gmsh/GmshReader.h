@@ -28,7 +28,9 @@ bool isGMSHMeshFile(const std::string& fname);
 
 /**
  * reads a mesh created by GMSH - this implementation is based on the former
- * function GMSH2MSH
+ * function GMSH2MSH. Supported are the ASCII format version 2.2 and the ASCII
+ * and binary format version 4.1. In the version 4.1 the material id of an
+ * element is the first physical tag of its entity.
  * @param fname the file name of the mesh (including the path)
  * @return
  */
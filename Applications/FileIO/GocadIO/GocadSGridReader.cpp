@@ -11,12 +11,14 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 
 #include <boost/tokenizer.hpp>
 
+#include "BaseLib/MappedFile.h"
 #include "MeshLib/Elements/Hex.h"
 #include "MeshLib/Elements/Quad.h"
 #include "MeshLib/Mesh.h"
@@ -377,28 +379,33 @@ void GocadSGridReader::parseFaceSet(std::string& line, std::istream& in)
     _property_meta_data_vecs.push_back(face_set_property);
 }
 
-// Reads given number of bits (rounded up to next byte) into a bitset.
-// Used for reading region information which can be represented by some
-// number of bits.
-Bitset readBits(std::ifstream& in, const std::size_t bits)
+// Copies given number of bytes into a bitset. Used for reading region
+// information which can be represented by some number of bits.
+Bitset readBits(char const* const data, std::size_t const bytes)
 {
     using block_t = Bitset::block_type;
-    auto const bytes = static_cast<std::size_t>(std::ceil(bits / 8.));
     std::size_t const blocks =
-        bytes + 1 < sizeof(block_t) ? 1 : (bytes + 1) / sizeof(block_t);
+        std::max<std::size_t>(1, (bytes + sizeof(block_t) - 1) / sizeof(block_t));
 
-    std::vector<block_t> data;
-    data.resize(blocks);
-    std::fill_n(data.data(), blocks, 0);
-    in.read(reinterpret_cast<char*>(data.data()), bytes);
+    std::vector<block_t> blocks_data(blocks, 0);
+    std::memcpy(blocks_data.data(), data, bytes);
 
-    return Bitset(data.begin(), data.end());
+    return Bitset(blocks_data.begin(), blocks_data.end());
+}
+
+// Reads the big endian value at the given position of a mapped binary file.
+template <typename T>
+T readBigEndianValue(char const* const data)
+{
+    T v;
+    std::memcpy(&v, data, sizeof(T));
+    return BaseLib::swapEndianness(v);
 }
 
 void GocadSGridReader::readNodesBinary()
 {
-    std::ifstream in(_pnts_fname.c_str(), std::ios::binary);
-    if (!in)
+    BaseLib::MappedFile const file(_pnts_fname);
+    if (file.data() == nullptr)
     {
         ERR("Could not open points file '%s'.", _pnts_fname.c_str());
         throw std::runtime_error("Could not open points file.");
@@ -407,33 +414,34 @@ void GocadSGridReader::readNodesBinary()
     std::size_t const n = _index_calculator._n_nodes;
     _nodes.resize(n);
 
-    double coords[3];
+    std::size_t const value_size =
+        _bin_pnts_in_double_precision ? sizeof(double) : sizeof(float);
+    std::size_t const n_read = std::min(n, file.size() / (3 * value_size));
+    if (n_read != n)
+    {
+        ERR("Read different number of points. Expected %d floats, got %d.\n",
+            n * 3, file.size() / value_size);
+    }
 
-    std::size_t k = 0;
-    while (in && k < n * 3)
+    // The coordinates are converted directly from the mapped file without
+    // buffering the whole payload.
+    auto const n_read_signed = static_cast<long>(n_read);
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (long i = 0; i < n_read_signed; ++i)
     {
-        if (_bin_pnts_in_double_precision)
-        {
-            coords[k % 3] =
-                BaseLib::swapEndianness(BaseLib::readBinaryValue<double>(in));
-        }
-        else
-        {
-            coords[k % 3] =
-                BaseLib::swapEndianness(BaseLib::readBinaryValue<float>(in));
-        }
-        if ((k + 1) % 3 == 0)
-        {
-            const std::size_t layer_transition_idx(
-                _index_calculator.getCoordsForID(k / 3)[2]);
-            _nodes[k / 3] =
-                new GocadNode(coords, k / 3, layer_transition_idx);
-        }
-        k++;
+        char const* const data = file.data() + i * 3 * value_size;
+        double coords[3];
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            coords[c] =
+                _bin_pnts_in_double_precision
+                    ? readBigEndianValue<double>(data + c * value_size)
+                    : readBigEndianValue<float>(data + c * value_size);
+        }
+        const std::size_t layer_transition_idx(
+            _index_calculator.getCoordsForID(i)[2]);
+        _nodes[i] = new GocadNode(coords, i, layer_transition_idx);
     }
-    if (k != n * 3 && !in.eof())
-        ERR("Read different number of points. Expected %d floats, got %d.\n",
-            n * 3, k);
 }
 
 void GocadSGridReader::mapRegionFlagsToCellProperties(
@@ -495,21 +503,30 @@ void GocadSGridReader::readElementPropertiesBinary()
                  prop_it->_property_name.c_str());
             continue;
         }
-        std::vector<float> float_properties =
-            BaseLib::readBinaryArray<float>(fname, _index_calculator._n_cells);
-        DBUG(
-            "GocadSGridReader::readElementPropertiesBinary(): Read %d float "
-            "properties from binary file.",
-            _index_calculator._n_cells);
-
-        std::transform(float_properties.cbegin(), float_properties.cend(),
-                       float_properties.begin(), [](float const& val) {
-                           return BaseLib::swapEndianness(val);
-                       });
-
-        prop_it->_property_data.resize(float_properties.size());
-        std::copy(float_properties.begin(), float_properties.end(),
-                  prop_it->_property_data.begin());
+        std::size_t const n = _index_calculator._n_cells;
+        BaseLib::MappedFile const file(fname);
+        if (file.data() == nullptr)
+        {
+            ERR("Could not open file '%s' for input.", fname.c_str());
+        }
+        else if (file.size() < n * sizeof(float))
+        {
+            ERR("Read different number of values. Expected %d, got %d.", n,
+                file.size() / sizeof(float));
+        }
+        else
+        {
+            DBUG(
+                "GocadSGridReader::readElementPropertiesBinary(): Read %d "
+                "float properties from binary file.",
+                n);
+            prop_it->_property_data.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                prop_it->_property_data[i] =
+                    readBigEndianValue<float>(file.data() + i * sizeof(float));
+            }
+        }
         if (prop_it->_property_data.empty())
         {
             ERR("Reading of element properties file '%s' failed.",
@@ -522,25 +539,27 @@ std::vector<Bitset> GocadSGridReader::readRegionFlagsBinary() const
 {
     std::vector<Bitset> result;
 
-    std::ifstream in(_region_flags_fname.c_str());
-    if (!in)
+    BaseLib::MappedFile const file(_region_flags_fname);
+    if (file.data() == nullptr)
     {
         ERR("readRegionFlagsBinary(): Could not open file '%s' for input.\n",
             _region_flags_fname.c_str());
-        in.close();
         return result;
     }
 
     std::size_t const n = _index_calculator._n_nodes;
-    result.resize(n);
+    std::size_t const bytes = (regions.size() + 7) / 8;
+    std::size_t const n_read =
+        bytes == 0 ? n : std::min(n, file.size() / bytes);
+    if (n_read != n)
+        ERR("Read different number of values. Expected %d, got %d.\n", n,
+            n_read);
 
-    std::size_t k = 0;
-    while (in && k < n)
+    result.resize(n);
+    for (std::size_t k = 0; k < n_read; ++k)
     {
-        result[k++] = readBits(in, regions.size());
+        result[k] = readBits(file.data() + k * bytes, bytes);
     }
-    if (k != n && !in.eof())
-        ERR("Read different number of values. Expected %d, got %d.\n", n, k);
 
     return result;
 }
@@ -9,10 +9,13 @@
 #include "SwmmInterface.h"
 
 #include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <utility>
 
 #include "BaseLib/FileTools.h"
+#include "BaseLib/MappedFile.h"
 #include "BaseLib/StringTools.h"
 #include "GeoLib/GEOObjects.h"
 #include "GeoLib/Point.h"
@@ -93,6 +96,119 @@ const std::array<std::string,15> system_vars =
 /// Number of base variables for the four object types (subcatchments/nodes/links/system).
 std::array<std::size_t,4> const n_obj_params = { 8, 6, 5, 15 };
 
+/// Random access to the results stored in a SWMM binary output file. The
+/// position of each value is computed from the file header, such that only
+/// the requested values are read from the memory-mapped file.
+class SwmmOutputFile
+{
+public:
+    explicit SwmmOutputFile(std::string const& file_name) : _file(file_name)
+    {
+        std::size_t const end = _file.size();
+        if (_file.data() == nullptr || end < 13 * record_size)
+        {
+            ERR("Could not read SWMM output file '%s'.", file_name.c_str());
+            return;
+        }
+        if (readInt(0) != magic_number ||
+            readInt(end - record_size) != magic_number ||
+            readInt(end - 2 * record_size) != 0)
+        {
+            ERR("SWMM output file '%s' is invalid or contains errors.",
+                file_name.c_str());
+            return;
+        }
+
+        std::size_t const input_start_pos = readInt(end - 5 * record_size);
+        _output_start_pos = readInt(end - 4 * record_size);
+        _n_periods = readInt(end - 3 * record_size);
+        _n_objects = {{static_cast<std::size_t>(readInt(3 * record_size)),
+                       static_cast<std::size_t>(readInt(4 * record_size)),
+                       static_cast<std::size_t>(readInt(5 * record_size)), 1}};
+        _n_pollutants = readInt(6 * record_size);
+
+        // Skip the saved input values of subcatchments (area), nodes (type,
+        // invert, max. depth), and links (type, offsets, max. depth, length)
+        // to get to the number of computed variables per object type.
+        std::size_t pos =
+            input_start_pos + ((_n_objects[0] + 2) + (3 * _n_objects[1] + 4) +
+                               (5 * _n_objects[2] + 6)) *
+                                  record_size;
+        for (std::size_t i = 0; i < _n_vars.size(); ++i)
+        {
+            if (pos + record_size > end)
+            {
+                ERR("SWMM output file '%s' is truncated.", file_name.c_str());
+                return;
+            }
+            _n_vars[i] = readInt(pos);
+            pos += (_n_vars[i] + 1) * record_size;
+        }
+
+        // Each period starts with its date stored as a double.
+        _bytes_per_period = 2 * record_size;
+        for (std::size_t i = 0; i < _n_vars.size(); ++i)
+        {
+            _bytes_per_period += _n_objects[i] * _n_vars[i] * record_size;
+        }
+        if (_output_start_pos + _n_periods * _bytes_per_period > end)
+        {
+            ERR("SWMM output file '%s' is truncated.", file_name.c_str());
+            return;
+        }
+        _is_valid = true;
+    }
+
+    bool isValid() const { return _is_valid; }
+    std::size_t getNumberOfPeriods() const { return _n_periods; }
+    std::size_t getNumberOfPollutants() const { return _n_pollutants; }
+    std::size_t getNumberOfObjects(int const obj_type_id) const
+    {
+        return _n_objects[obj_type_id];
+    }
+    std::size_t getNumberOfVariables(int const obj_type_id) const
+    {
+        return _n_vars[obj_type_id];
+    }
+
+    /// Returns the value of the given variable of an object in a period.
+    float getValue(int const obj_type_id, std::size_t const obj_idx,
+                   std::size_t const var_idx, std::size_t const period) const
+    {
+        std::size_t offset =
+            _output_start_pos + period * _bytes_per_period + 2 * record_size;
+        for (int i = 0; i < obj_type_id; ++i)
+        {
+            offset += _n_objects[i] * _n_vars[i] * record_size;
+        }
+        offset += (obj_idx * _n_vars[obj_type_id] + var_idx) * record_size;
+
+        float value;
+        std::memcpy(&value, _file.data() + offset, sizeof(float));
+        return value;
+    }
+
+private:
+    std::int32_t readInt(std::size_t const pos) const
+    {
+        std::int32_t value;
+        std::memcpy(&value, _file.data() + pos, sizeof(std::int32_t));
+        return value;
+    }
+
+    static constexpr std::size_t record_size = 4;
+    static constexpr std::int32_t magic_number = 516114522;
+
+    BaseLib::MappedFile const _file;
+    bool _is_valid = false;
+    std::size_t _output_start_pos = 0;
+    std::size_t _n_periods = 0;
+    std::size_t _n_pollutants = 0;
+    std::size_t _bytes_per_period = 0;
+    std::array<std::size_t, 4> _n_objects{};
+    std::array<std::size_t, 4> _n_vars{};
+};
+
 std::unique_ptr<SwmmInterface> SwmmInterface::create(std::string const& file_name)
 {
     //The input/output methods take a base name and check if the corresponding i/o file for that base name exists.
@@ -997,79 +1113,82 @@ bool SwmmInterface::addResultsToMesh(MeshLib::Mesh &mesh, SwmmObject const swmm_
 std::vector<double> SwmmInterface::getArrayAtTimeStep(SwmmObject obj_type, std::size_t time_step, std::size_t var_idx) const
 {
     std::vector<double> data;
-    std::string const outfile (_base_name + ".out");
-    if (OpenSwmmOutFile(const_cast<char*>(outfile.c_str())) != 0)
+    SwmmOutputFile const out(_base_name + ".out");
+    if (!out.isValid())
         return data;
 
-    if (time_step >= SWMM_Nperiods)
+    if (time_step >= out.getNumberOfPeriods())
     {
-        ERR ("Time step %d not available, file contains only %d periods.", time_step, SWMM_Nperiods);
+        ERR ("Time step %d not available, file contains only %d periods.", time_step, out.getNumberOfPeriods());
         return data;
     }
 
+    std::size_t const n_polluts (out.getNumberOfPollutants());
     bool is_var_idx_okay = true;
     int obj_type_id;
-    std::size_t n_objects;
     switch (obj_type)
     {
         case SwmmObject::SUBCATCHMENT:
             obj_type_id = 0;
-            n_objects = SWMM_Nsubcatch;
-            if (var_idx > (n_obj_params[obj_type_id] - 1 + SWMM_Npolluts))
+            if (var_idx > (n_obj_params[obj_type_id] - 1 + n_polluts))
                 is_var_idx_okay = false;
             break;
         case SwmmObject::NODE:
             obj_type_id = 1;
-            n_objects = SWMM_Nnodes;
-            if (var_idx > (n_obj_params[obj_type_id] + SWMM_Npolluts))
+            if (var_idx > (n_obj_params[obj_type_id] + n_polluts))
                 is_var_idx_okay = false;
             break;
         case SwmmObject::LINK:
             obj_type_id = 2;
-            n_objects = SWMM_Nlinks;
-            if (var_idx > (n_obj_params[obj_type_id] + SWMM_Npolluts))
+            if (var_idx > (n_obj_params[obj_type_id] + n_polluts))
                 is_var_idx_okay = false;
             break;
         case SwmmObject::SYSTEM:
             obj_type_id = 3;
-            n_objects = 1;
             if (var_idx > n_obj_params[obj_type_id])
                 is_var_idx_okay = false;
             break;
       default:
          ERR ("Object type not recognised.");
-         CloseSwmmOutFile();
          return data;
     }
 
-    if (!is_var_idx_okay)
+    if (!is_var_idx_okay || var_idx >= out.getNumberOfVariables(obj_type_id))
     {
         ERR ("Requested variable does not exist.");
-        CloseSwmmOutFile();
         return data;
     }
 
     INFO("Fetching '%s'-data for time step %d...",
-         getArrayName(obj_type, var_idx, SWMM_Npolluts).c_str(), time_step);
+         getArrayName(obj_type, var_idx, n_polluts).c_str(), time_step);
 
+    std::size_t const n_objects (out.getNumberOfObjects(obj_type_id));
+    data.reserve(n_objects);
     for (std::size_t i=0; i<n_objects; ++i)
     {
-        float val;
-        GetSwmmResult(obj_type_id, i, var_idx, time_step, &val);
-        data.push_back(static_cast<double>(val));
+        data.push_back(static_cast<double>(
+            out.getValue(obj_type_id, i, var_idx, time_step)));
     }
 
-    CloseSwmmOutFile();
     return data;
 }
 
 std::vector<double> SwmmInterface::getArrayForObject(SwmmObject obj_type, std::size_t obj_idx, std::size_t var_idx) const
+{
+    return getArrayForObject(obj_type, obj_idx, var_idx, 0,
+                             std::numeric_limits<std::size_t>::max());
+}
+
+std::vector<double> SwmmInterface::getArrayForObject(
+    SwmmObject obj_type, std::size_t obj_idx, std::size_t var_idx,
+    std::size_t first_time_step, std::size_t n_time_steps) const
 {
     std::vector<double> data;
-    std::string const outfile (_base_name + ".out");
-    if (OpenSwmmOutFile(const_cast<char*>(outfile.c_str())) != 0)
+    SwmmOutputFile const out(_base_name + ".out");
+    if (!out.isValid())
         return data;
 
+    std::size_t const n_polluts (out.getNumberOfPollutants());
     bool is_var_idx_okay = true;
     bool is_obj_idx_okay = true;
     int obj_type_id;
@@ -1077,61 +1196,59 @@ std::vector<double> SwmmInterface::getArrayForObject(SwmmObject obj_type, std::s
     {
         case SwmmObject::SUBCATCHMENT:
             obj_type_id = 0;
-            if (obj_idx >= SWMM_Nsubcatch)
-                is_obj_idx_okay = false;
-            if (var_idx > (n_obj_params[obj_type_id] + SWMM_Npolluts))
+            if (var_idx > (n_obj_params[obj_type_id] + n_polluts))
                 is_var_idx_okay = false;
             break;
         case SwmmObject::NODE:
             obj_type_id = 1;
-            if (obj_idx >= SWMM_Nnodes)
-                is_obj_idx_okay = false;
-            if (var_idx > (n_obj_params[obj_type_id] + SWMM_Npolluts))
+            if (var_idx > (n_obj_params[obj_type_id] + n_polluts))
                 is_var_idx_okay = false;
             break;
         case SwmmObject::LINK:
             obj_type_id = 2;
-            if (obj_idx >= SWMM_Nlinks)
-                is_obj_idx_okay = false;
-            if (var_idx > (n_obj_params[obj_type_id] + SWMM_Npolluts))
+            if (var_idx > (n_obj_params[obj_type_id] + n_polluts))
                 is_var_idx_okay = false;
             break;
         case SwmmObject::SYSTEM:
             obj_type_id = 3;
-            if (obj_idx >= 1)
-                is_obj_idx_okay = false;
             if (var_idx > n_obj_params[obj_type_id])
                 is_var_idx_okay = false;
             break;
       default:
          ERR ("Object type not recognised.");
-         CloseSwmmOutFile();
          return data;
     }
+    if (obj_idx >= out.getNumberOfObjects(obj_type_id))
+        is_obj_idx_okay = false;
 
     if (!is_obj_idx_okay)
     {
         ERR ("Requested object index does not exist.");
-        CloseSwmmOutFile();
         return data;
     }
 
-    if (!is_var_idx_okay)
+    if (!is_var_idx_okay || var_idx >= out.getNumberOfVariables(obj_type_id))
     {
         ERR ("Requested variable does not exist.");
-        CloseSwmmOutFile();
         return data;
     }
 
-    std::size_t const n_time_steps (static_cast<std::size_t>(SWMM_Nperiods));
-    for (std::size_t i=0; i<n_time_steps; ++i)
+    std::size_t const n_periods (out.getNumberOfPeriods());
+    if (first_time_step >= n_periods)
     {
-        float val;
-        GetSwmmResult(obj_type_id , obj_idx, var_idx, i, &val);
-        data.push_back(static_cast<double>(val));
+        ERR ("Time step %d not available, file contains only %d periods.", first_time_step, n_periods);
+        return data;
+    }
+
+    std::size_t const last_time_step (
+        first_time_step + std::min(n_time_steps, n_periods - first_time_step));
+    data.reserve(last_time_step - first_time_step);
+    for (std::size_t i=first_time_step; i<last_time_step; ++i)
+    {
+        data.push_back(static_cast<double>(
+            out.getValue(obj_type_id, obj_idx, var_idx, i)));
     }
 
-    CloseSwmmOutFile();
     return data;
 }
 
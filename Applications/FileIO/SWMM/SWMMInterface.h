@@ -96,6 +96,11 @@ public:
     /// Returns an array for a given variable for one specific object from a SWMM output file for all time steps.
     std::vector<double> getArrayForObject(SwmmObject obj_type, std::size_t obj_idx, std::size_t var_idx) const;
 
+    /// Returns an array for a given variable for one specific object from a SWMM output file for at most
+    /// n_time_steps time steps starting with first_time_step. Only the requested values are read from the file.
+    std::vector<double> getArrayForObject(SwmmObject obj_type, std::size_t obj_idx, std::size_t var_idx,
+        std::size_t first_time_step, std::size_t n_time_steps) const;
+
     /// Writes the node coordinates into double vectors for writing of CSV files
     bool getNodeCoordinateVectors(std::vector<double> &x, std::vector<double> &y, std::vector<double> &z) const;
 
@@ -707,6 +707,7 @@ void TetGenInterface::write3dElements(std::ofstream &out,
                                       const MeshLib::Mesh &mesh,
                                       std::vector<MeshLib::Node> &attribute_points) const
 {
+    mesh.computeElementNeighbors();
     const std::vector<MeshLib::Element*> &elements = mesh.getElements();
     const std::size_t nElements (elements.size());
     if (!attribute_points.empty())
@@ -14,6 +14,7 @@
 #include <vtkCPProcessor.h>
 #include <vtkCPPythonScriptPipeline.h>
 #include <vtkNew.h>
+#include <vtkSmartPointer.h>
 #include <vtkUnstructuredGrid.h>
 
 #include "MeshLib/Mesh.h"
@@ -22,6 +23,10 @@
 namespace InSituLib
 {
 vtkCPProcessor* Processor = nullptr;
+/// The source and the data description are kept over all time steps, s.t.
+/// the cells of the mesh are converted only once.
+vtkSmartPointer<MeshLib::VtkMappedMeshSource> Source;
+vtkSmartPointer<vtkCPDataDescription> DataDescription;
 
 void Initialize(BaseLib::ConfigTree const& scripts_config,
                 std::string const& path)
@@ -55,6 +60,8 @@ void Finalize()
         Processor->Delete();
         Processor = nullptr;
     }
+    Source = nullptr;
+    DataDescription = nullptr;
 }
 void CoProcess(MeshLib::Mesh const& mesh, double const time,
                unsigned int const timeStep, bool const lastTimeStep)
@@ -62,25 +69,30 @@ void CoProcess(MeshLib::Mesh const& mesh, double const time,
     if (Processor == nullptr)
         return;
 
-    vtkNew<vtkCPDataDescription> dataDescription;
-    dataDescription->AddInput("input");
-    dataDescription->SetTimeData(time, timeStep);
-    if (lastTimeStep == true)
+    if (DataDescription == nullptr)
     {
-        // assume that we want to all the pipelines to execute if it
-        // is the last time step.
-        dataDescription->ForceOutputOn();
+        DataDescription = vtkSmartPointer<vtkCPDataDescription>::New();
+        DataDescription->AddInput("input");
     }
-    if (Processor->RequestDataDescription(dataDescription.GetPointer()) != 0)
+    DataDescription->SetTimeData(time, timeStep);
+    // assume that we want to all the pipelines to execute if it
+    // is the last time step.
+    DataDescription->SetForceOutput(lastTimeStep);
+    if (Processor->RequestDataDescription(DataDescription.GetPointer()) != 0)
     {
         INFO("Start InSitu process: timestep #%d (t=%g, last=%d)", timeStep,
              time, lastTimeStep);
-        vtkNew<MeshLib::VtkMappedMeshSource> vtkSource;
-        vtkSource->SetMesh(&mesh);
-        vtkSource->Update();
-        dataDescription->GetInputDescriptionByName("input")->SetGrid(
-            vtkSource->GetOutput());
-        Processor->CoProcess(dataDescription.GetPointer());
+        if (Source == nullptr)
+        {
+            Source = vtkSmartPointer<MeshLib::VtkMappedMeshSource>::New();
+        }
+        // Marks the source modified, s.t. the current property values are
+        // mapped.
+        Source->SetMesh(&mesh);
+        Source->Update();
+        DataDescription->GetInputDescriptionByName("input")->SetGrid(
+            Source->GetOutput());
+        Processor->CoProcess(DataDescription.GetPointer());
         INFO("End InSitu process.");
     }
 }
@@ -41,9 +41,9 @@ int main (int argc, char* argv[])
     ApplicationsLib::LogogSetup logog_setup;
 
     TCLAP::CmdLine cmd(
-        "Converting meshes in gmsh file format (ASCII, version 2.2) to a vtk "
-        "unstructured grid file (new OGS file format) or to the old OGS file "
-        "format - see options.\n\n"
+        "Converting meshes in gmsh file format (ASCII version 2.2, ASCII or "
+        "binary version 4.1) to a vtk unstructured grid file (new OGS file "
+        "format) or to the old OGS file format - see options.\n\n"
         "OpenGeoSys-6 software, version " +
             GitInfoLib::GitInfo::ogs_version +
             ".\n"
@@ -8,6 +8,10 @@
  *              http://www.opengeosys.org/LICENSE.txt
  */
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -18,10 +22,103 @@
 #include "GeoLib/AABB.h"
 #include "MeshLib/IO/readMeshFromFile.h"
 #include "MeshLib/Mesh.h"
-#include "MeshLib/MeshSearch/MeshElementGrid.h"
 #include "MeshLib/Node.h"
 #include "MeshLib/MeshEditing/ProjectPointOnMesh.h"
 
+namespace
+{
+/// Regular grid of sample points with the x-coordinates x0 + column *
+/// cellsize and the y-coordinates y0 - row * cellsize.
+struct SampleGrid
+{
+    double x0;
+    double y0;
+    double cellsize;
+    std::size_t n_rows;
+    std::size_t n_cols;
+};
+
+/// Returns for each row of the grid the ids of the elements whose bounding
+/// boxes contain the row.
+std::vector<std::vector<std::size_t>> binElementsByRow(
+    std::vector<MeshLib::Element*> const& elements,
+    std::vector<GeoLib::AABB> const& bounding_boxes, SampleGrid const& grid)
+{
+    std::vector<std::vector<std::size_t>> rows(grid.n_rows);
+    for (std::size_t e = 0; e < elements.size(); ++e)
+    {
+        auto const& min = bounding_boxes[e].getMinPoint();
+        auto const& max = bounding_boxes[e].getMaxPoint();
+        double const first = std::ceil((grid.y0 - max[1]) / grid.cellsize);
+        double const last = std::floor((grid.y0 - min[1]) / grid.cellsize);
+        if (last < 0 || first >= static_cast<double>(grid.n_rows))
+        {
+            continue;
+        }
+        auto const row_end = std::min(static_cast<std::size_t>(last) + 1,
+                                      grid.n_rows);
+        for (auto row = static_cast<std::size_t>(std::max(first, 0.0));
+             row < row_end; ++row)
+        {
+            rows[row].push_back(e);
+        }
+    }
+    return rows;
+}
+
+/// Samples the elevation of the mesh at the grid points of the rows
+/// [row_begin, row_end) into \c values, which is NaN where no element is
+/// located beneath a point. Each row only visits the elements binned to it.
+void sampleRows(std::vector<MeshLib::Element*> const& elements,
+                std::vector<GeoLib::AABB> const& bounding_boxes,
+                std::vector<std::vector<std::size_t>> const& row_bins,
+                SampleGrid const& grid, std::size_t const row_begin,
+                std::size_t const row_end, std::vector<double>& values)
+{
+    values.assign((row_end - row_begin) * grid.n_cols,
+                  std::numeric_limits<double>::quiet_NaN());
+
+#pragma omp parallel for schedule(dynamic, 4)
+    for (std::ptrdiff_t r = row_begin; r < static_cast<std::ptrdiff_t>(row_end);
+         ++r)
+    {
+        double* const row_values = &values[(r - row_begin) * grid.n_cols];
+        double const y = grid.y0 - r * grid.cellsize;
+        std::vector<MeshLib::Element const*> element(1);
+        for (auto const e : row_bins[r])
+        {
+            element[0] = elements[e];
+            auto const& min = bounding_boxes[e].getMinPoint();
+            auto const& max = bounding_boxes[e].getMaxPoint();
+            double const first = std::ceil((min[0] - grid.x0) / grid.cellsize);
+            double const last = std::floor((max[0] - grid.x0) / grid.cellsize);
+            if (last < 0 || first >= static_cast<double>(grid.n_cols))
+            {
+                continue;
+            }
+            auto const col_end = std::min(static_cast<std::size_t>(last) + 1,
+                                          grid.n_cols);
+            for (auto col = static_cast<std::size_t>(std::max(first, 0.0));
+                 col < col_end; ++col)
+            {
+                // The first element containing the point determines the value.
+                if (!std::isnan(row_values[col]))
+                {
+                    continue;
+                }
+                MeshLib::Node const node(grid.x0 + col * grid.cellsize, y, 0);
+                if (MeshLib::ProjectPointOnMesh::getProjectedElement(
+                        element, node) != nullptr)
+                {
+                    row_values[col] = MeshLib::ProjectPointOnMesh::getElevation(
+                        *elements[e], node);
+                }
+            }
+        }
+    }
+}
+}  // namespace
+
 int main(int argc, char* argv[])
 {
     ApplicationsLib::LogogSetup logog_setup;
@@ -90,51 +187,62 @@ int main(int argc, char* argv[])
         << "-9999\n";
     INFO("Writing raster with %d x %d pixels.", n_cols, n_rows);
 
-    MeshLib::MeshElementGrid const grid(*mesh);
-    double const max_edge(mesh->getMaxEdgeLength() + cellsize);
+    // The pixel centres and the pixel corners are sampled on two grids by
+    // iterating over the elements covering each row. The rows are processed
+    // in blocks to bound the memory.
+    auto const& elements = mesh->getElements();
+    std::vector<GeoLib::AABB> bounding_boxes;
+    bounding_boxes.reserve(elements.size());
+    for (auto const* element : elements)
+    {
+        bounding_boxes.emplace_back(
+            element->getNodes(),
+            element->getNodes() + element->getNumberOfNodes());
+    }
+    SampleGrid const centres{min[0], max[1], cellsize, n_rows + 1, n_cols + 1};
+    SampleGrid const corners{min[0] - half_cell, max[1] + half_cell, cellsize,
+                             n_rows + 2, n_cols + 2};
+    auto const centre_bins = binElementsByRow(elements, bounding_boxes, centres);
+    auto const corner_bins = binElementsByRow(elements, bounding_boxes, corners);
 
-    for (std::size_t row = 0; row <= n_rows; ++row)
+    std::size_t const block_size = 256;
+    std::vector<double> centre_values;
+    std::vector<double> corner_values;
+    for (std::size_t block = 0; block < centres.n_rows; block += block_size)
     {
-        double const y = max[1] - row * cellsize;
-        for (std::size_t column = 0; column <= n_cols; ++column)
+        std::size_t const block_end =
+            std::min(block + block_size, centres.n_rows);
+        sampleRows(elements, bounding_boxes, centre_bins, centres, block,
+                   block_end, centre_values);
+        sampleRows(elements, bounding_boxes, corner_bins, corners, block,
+                   block_end + 1, corner_values);
+
+        for (std::size_t row = block; row < block_end; ++row)
         {
-            // pixel values
-            double const x = min[0] + column * cellsize;
-            MeshLib::Node const node(x, y, 0);
-            MathLib::Point3d min_vol{{x - max_edge, y - max_edge,
-                                      -std::numeric_limits<double>::max()}};
-            MathLib::Point3d max_vol{{x + max_edge, y + max_edge,
-                                      std::numeric_limits<double>::max()}};
-            std::vector<const MeshLib::Element*> const& elems =
-                grid.getElementsInVolume(min_vol, max_vol);
-            auto const* element =
-                MeshLib::ProjectPointOnMesh::getProjectedElement(elems, node);
-            // centre of the pixel is located within a mesh element
-            if (element != nullptr)
+            double const* const centre_row =
+                &centre_values[(row - block) * centres.n_cols];
+            double const* const upper_corners =
+                &corner_values[(row - block) * corners.n_cols];
+            double const* const lower_corners = upper_corners + corners.n_cols;
+            for (std::size_t column = 0; column <= n_cols; ++column)
             {
-                out << MeshLib::ProjectPointOnMesh::getElevation(*element, node) << " ";
-            }
-            else
-            {
-                std::array<double, 4> const x_off{
-                    {-half_cell, half_cell, -half_cell, half_cell}};
-                std::array<double, 4> const y_off{
-                    {-half_cell, -half_cell, half_cell, half_cell}};
+                // centre of the pixel is located within a mesh element
+                if (!std::isnan(centre_row[column]))
+                {
+                    out << centre_row[column] << " ";
+                    continue;
+                }
+                // otherwise the average of the pixel's corners within an
+                // element is used
                 double sum(0);
                 std::size_t nonzero_count(0);
-                // test all of the pixel's corners if there are any within an
-                // element
-                for (std::size_t i = 0; i < 4; ++i)
+                for (double const corner_value :
+                     {lower_corners[column], lower_corners[column + 1],
+                      upper_corners[column], upper_corners[column + 1]})
                 {
-                    MeshLib::Node const corner_node(x + x_off[i], y + y_off[i],
-                                                    0);
-                    auto const* corner_element =
-                        MeshLib::ProjectPointOnMesh::getProjectedElement(
-                            elems, corner_node);
-                    if (corner_element != nullptr)
+                    if (!std::isnan(corner_value))
                     {
-                        sum += MeshLib::ProjectPointOnMesh::getElevation(
-                            *corner_element, corner_node);
+                        sum += corner_value;
                         nonzero_count++;
                     }
                 }
@@ -149,8 +257,8 @@ int main(int argc, char* argv[])
                     out << "-9999 ";
                 }
             }
+            out << "\n";
         }
-        out << "\n";
     }
     out.close();
     INFO("Result written to %s", output_arg.getValue().c_str());
@@ -8,6 +8,7 @@
  */
 
 // STL
+#include <algorithm>
 #include <cctype>
 #include <iostream>
 #include <limits>
@@ -174,11 +175,12 @@ static MathLib::Point3d getOrigin(NcFile const& dataset, NcVar const& var,
     return origin;
 }
 
-static void flipRaster(std::vector<double>& data, std::size_t const width,
-                std::size_t const height)
+static void flipRaster(double* const data, std::size_t const width,
+                       std::size_t const height)
 {
-    std::size_t const length(data.size());
-    std::vector<double> tmp_vec(length);
+    std::size_t const length(width * height);
+    std::vector<double> tmp_vec;
+    tmp_vec.reserve(length);
     for (std::size_t i = 0; i < height; i++)
     {
         std::size_t const line_idx(length - (width * (i + 1)));
@@ -187,7 +189,7 @@ static void flipRaster(std::vector<double>& data, std::size_t const width,
             tmp_vec.push_back(data[line_idx + j]);
         }
     }
-    std::copy(tmp_vec.cbegin(), tmp_vec.cend(), data.begin());
+    std::copy(tmp_vec.cbegin(), tmp_vec.cend(), data);
 }
 
 static bool canConvert(NcVar const& var)
@@ -397,17 +399,50 @@ static std::vector<std::size_t> getLength(NcVar const& var, bool const is_time_d
     return length;
 }
 
-static std::vector<double> getData(NcFile const& dataset, NcVar const& var,
-                            std::size_t const total_length,
-                            std::size_t const time_step,
-                            std::vector<std::size_t> const& length)
+/// Returns the number of time steps read at once, which is bounded by the
+/// memory of the window and, for chunked variables, a multiple of the chunk
+/// size of the temporal dimension.
+static std::size_t getTimeWindowSize(NcVar const& var,
+                                     std::size_t const slice_length,
+                                     bool const is_time_dep)
+{
+    if (!is_time_dep)
+    {
+        return 1;
+    }
+    std::size_t const max_window_bytes = 256 * 1024 * 1024;
+    std::size_t window = std::max<std::size_t>(
+        1, max_window_bytes / (slice_length * sizeof(double)));
+
+    NcVar::ChunkMode chunk_mode;
+    std::vector<std::size_t> chunk_sizes;
+    var.getChunkingParameters(chunk_mode, chunk_sizes);
+    if (chunk_mode == NcVar::nc_CHUNKED && !chunk_sizes.empty() &&
+        chunk_sizes[0] > 0)
+    {
+        window = std::max(chunk_sizes[0],
+                          window / chunk_sizes[0] * chunk_sizes[0]);
+    }
+    return window;
+}
+
+/// Reads the time steps [first_step, first_step + n_steps) with a single
+/// hyperslab access into \c data, one slice of length \c slice_length after
+/// the other.
+static void getData(NcFile const& dataset, NcVar const& var,
+                    std::size_t const slice_length,
+                    std::size_t const first_step, std::size_t const n_steps,
+                    std::vector<std::size_t> const& length,
+                    std::vector<double>& data)
 {
     std::size_t const n_dims(var.getDimCount());
     std::vector<std::size_t> offset(n_dims, 0);
-    offset[0] = time_step;
-    std::vector<double> data_vec(total_length, 0);
-    var.getVar(offset, length, data_vec.data());
-    std::replace_if(data_vec.begin(), data_vec.end(),
+    offset[0] = first_step;
+    std::vector<std::size_t> count(length);
+    count[0] *= n_steps;
+    data.resize(n_steps * slice_length);
+    var.getVar(offset, count, data.data());
+    std::replace_if(data.begin(), data.end(),
                     [](double& x) { return x <= no_data; }, no_data);
 
     // reverse lines in vertical direction if the original file has its origin
@@ -416,8 +451,95 @@ static std::vector<double> getData(NcFile const& dataset, NcVar const& var,
     auto const bounds = (dim_var.isNull()) ? getDimLength(var, n_dims - 1)
                                            : getBoundaries(dim_var);
     if (bounds.first > bounds.second)
-        flipRaster(data_vec, length[n_dims - 2], length[n_dims - 1]);
-    return data_vec;
+    {
+        for (std::size_t i = 0; i < n_steps; ++i)
+        {
+            flipRaster(data.data() + i * slice_length, length[n_dims - 2],
+                       length[n_dims - 1]);
+        }
+    }
+}
+
+/// Returns the values of the cells of the mesh created by
+/// RasterToMesh::convert() before the removal of the no data cells, i.e. in
+/// the order of the cells of the regular mesh.
+static std::vector<double> getCellValues(double const* const img,
+                                         GeoLib::RasterHeader const& header,
+                                         MeshLib::MeshElemType const elem_type)
+{
+    bool const double_idx = elem_type == MeshLib::MeshElemType::TRIANGLE ||
+                            elem_type == MeshLib::MeshElemType::PRISM;
+    std::vector<double> values;
+    values.reserve((double_idx ? 2 : 1) * header.n_depth * header.n_rows *
+                   header.n_cols);
+    for (std::size_t k = 0; k < header.n_depth; k++)
+    {
+        std::size_t const layer_idx = (k * header.n_rows * header.n_cols);
+        for (std::size_t i = 0; i < header.n_cols; i++)
+        {
+            std::size_t const idx(i * header.n_rows + layer_idx);
+            for (std::size_t j = 0; j < header.n_rows; j++)
+            {
+                values.push_back(img[idx + j]);
+                if (double_idx)
+                {
+                    values.push_back(img[idx + j]);
+                }
+            }
+        }
+    }
+    return values;
+}
+
+/// The geometry of the converted meshes, which is built once from the first
+/// time step and shared by all time steps with the same no data cells.
+struct MeshGeometry
+{
+    std::unique_ptr<MeshLib::Mesh> mesh;
+    /// Ids of the cells of the regular mesh kept in the mesh.
+    std::vector<std::size_t> kept_cells;
+    std::size_t n_cells;
+
+    /// Copies the values of the kept cells into \c values and returns false
+    /// if the no data cells differ from the ones of the geometry.
+    bool extractValues(std::vector<double> const& cell_values,
+                       std::vector<double>& values) const
+    {
+        values.resize(kept_cells.size());
+        std::size_t n_valid = 0;
+        for (std::size_t i = 0; i < kept_cells.size(); ++i)
+        {
+            values[i] = cell_values[kept_cells[i]];
+            if (values[i] != no_data)
+            {
+                n_valid++;
+            }
+        }
+        return n_valid == kept_cells.size() &&
+               std::count(cell_values.begin(), cell_values.end(), no_data) ==
+                   static_cast<std::ptrdiff_t>(n_cells - kept_cells.size());
+    }
+};
+
+static MeshGeometry createMeshGeometry(std::vector<double> const& cell_values,
+                                       double const* const img,
+                                       GeoLib::RasterHeader const& header,
+                                       MeshLib::MeshElemType const elem_type,
+                                       std::string const& array_name)
+{
+    MeshGeometry geometry;
+    geometry.mesh.reset(MeshLib::RasterToMesh::convert(
+        img, header, elem_type, MeshLib::UseIntensityAs::DATAVECTOR,
+        array_name));
+    geometry.n_cells = cell_values.size();
+    for (std::size_t i = 0; i < cell_values.size(); ++i)
+    {
+        if (cell_values[i] != no_data)
+        {
+            geometry.kept_cells.push_back(i);
+        }
+    }
+    return geometry;
 }
 
 static bool assignDimParams(NcVar const& var,
@@ -514,63 +636,131 @@ static bool convert(NcFile const& dataset, NcVar const& var,
              std::pair<std::size_t, std::size_t> const& time_bounds,
              bool const use_single_file, MeshLib::MeshElemType const elem_type)
 {
-    std::unique_ptr<MeshLib::Mesh> mesh;
     std::vector<std::size_t> const length = getLength(var, is_time_dep);
     std::size_t const array_length = std::accumulate(
         length.cbegin(), length.cend(), 1, std::multiplies<std::size_t>());
-    for (std::size_t i = time_bounds.first; i <= time_bounds.second; ++i)
-    {
-        std::string const step_str = (time_bounds.first != time_bounds.second)
-                ? std::string(" time step " + std::to_string(i)) : "";
-        std::cout << "Converting" << step_str << "...\n";
-        std::vector<double> const data_vec =
-            getData(dataset, var, array_length, i, length);
-
-        GeoLib::RasterHeader const header =
-            createRasterHeader(dataset, var, dim_idx_map, length, is_time_dep);
-        MeshLib::UseIntensityAs const useIntensity =
-            MeshLib::UseIntensityAs::DATAVECTOR;
-        if (!use_single_file)
+    GeoLib::RasterHeader const header =
+        createRasterHeader(dataset, var, dim_idx_map, length, is_time_dep);
+    std::size_t const window_size =
+        getTimeWindowSize(var, array_length, is_time_dep);
+
+    // The time steps are read window by window, the windows being aligned
+    // with the chunks of the variable. The mesh geometry is built from the
+    // first time step and reused for all time steps with the same no data
+    // cells.
+    MeshGeometry geometry;
+    std::vector<double> data;
+    bool success = true;
+    for (std::size_t first = time_bounds.first; first <= time_bounds.second;)
+    {
+        std::size_t const end = std::min(time_bounds.second + 1,
+                                         (first / window_size + 1) * window_size);
+        std::cout << "Reading time steps " << first << " to " << end - 1
+                  << "...\n";
+        getData(dataset, var, array_length, first, end - first, length, data);
+
+        if (geometry.mesh == nullptr)
         {
-            mesh.reset(MeshLib::RasterToMesh::convert(
-                data_vec.data(), header, elem_type, useIntensity,
-                var.getName()));
-            std::string const output_file_name(
-                BaseLib::dropFileExtension(output_name) +
-                getIterationString(i, time_bounds.second) + ".vtu");
-            MeshLib::IO::VtuInterface vtu(mesh.get());
-            vtu.writeToFile(output_file_name);
+            std::string array_name(var.getName());
+            if (use_single_file && time_bounds.first != time_bounds.second)
+            {
+                array_name.append(
+                    getIterationString(first, time_bounds.second));
+            }
+            geometry = createMeshGeometry(
+                getCellValues(data.data(), header, elem_type), data.data(),
+                header, elem_type, array_name);
+            if (geometry.mesh == nullptr)
+            {
+                return false;
+            }
         }
-        else
+
+        if (use_single_file)
         {
-            std::string array_name(var.getName());
-            if (time_bounds.first != time_bounds.second)
-                array_name.append(getIterationString(i, time_bounds.second));
-            if (i == time_bounds.first)  // create persistent mesh
-                mesh.reset(MeshLib::RasterToMesh::convert(
-                    data_vec.data(), header, elem_type, useIntensity,
-                    array_name));
-            else  // copy array to mesh
+            std::vector<double> values;
+            for (std::size_t i = std::max(first, time_bounds.first + 1);
+                 i < end; ++i)
             {
-                std::unique_ptr<MeshLib::Mesh> const temp(
-                    MeshLib::RasterToMesh::convert(data_vec.data(), header,
-                                                   elem_type, useIntensity,
-                                                   array_name));
-                MeshLib::PropertyVector<double> const* const vec =
-                    temp->getProperties().getPropertyVector<double>(array_name);
-                if (vec == nullptr)
-                    return false;
+                std::string const array_name(
+                    var.getName() +
+                    getIterationString(i, time_bounds.second));
+                // Time steps with other no data cells keep the no data values
+                // in the cells of the geometry.
+                geometry.extractValues(
+                    getCellValues(data.data() + (i - first) * array_length,
+                                  header, elem_type),
+                    values);
                 MeshLib::addPropertyToMesh<double>(
-                    *mesh, array_name, MeshLib::MeshItemType::Cell, 1, *vec);
+                    *geometry.mesh, array_name, MeshLib::MeshItemType::Cell, 1,
+                    values);
             }
-            if (i == time_bounds.second)
+        }
+        else
+        {
+            // The time steps are written in parallel, each thread working on
+            // its own copy of the geometry.
+#pragma omp parallel
             {
-                MeshLib::IO::VtuInterface vtu(mesh.get());
-                vtu.writeToFile(output_name);
+                std::unique_ptr<MeshLib::Mesh> thread_mesh;
+                std::vector<double> values;
+#pragma omp for schedule(dynamic)
+                for (std::ptrdiff_t i = first; i < static_cast<std::ptrdiff_t>(end);
+                     ++i)
+                {
+                    std::cout << "Converting time step " << i << "...\n";
+                    double const* const img =
+                        data.data() + (i - first) * array_length;
+                    std::unique_ptr<MeshLib::Mesh> slice_mesh;
+                    MeshLib::Mesh* mesh = nullptr;
+                    if (geometry.extractValues(
+                            getCellValues(img, header, elem_type), values))
+                    {
+                        if (thread_mesh == nullptr)
+                        {
+#pragma omp critical(netcdf_converter_create_mesh)
+                            thread_mesh =
+                                std::make_unique<MeshLib::Mesh>(*geometry.mesh);
+                        }
+                        auto& property =
+                            *thread_mesh->getProperties()
+                                 .getPropertyVector<double>(var.getName());
+                        std::copy(values.begin(), values.end(),
+                                  property.begin());
+                        mesh = thread_mesh.get();
+                    }
+                    else
+                    {
+#pragma omp critical(netcdf_converter_create_mesh)
+                        slice_mesh.reset(MeshLib::RasterToMesh::convert(
+                            img, header, elem_type,
+                            MeshLib::UseIntensityAs::DATAVECTOR,
+                            var.getName()));
+                        mesh = slice_mesh.get();
+                    }
+                    if (mesh == nullptr)
+                    {
+#pragma omp atomic write
+                        success = false;
+                        continue;
+                    }
+                    std::string const output_file_name(
+                        BaseLib::dropFileExtension(output_name) +
+                        getIterationString(i, time_bounds.second) + ".vtu");
+                    MeshLib::IO::VtuInterface vtu(mesh);
+                    vtu.writeToFile(output_file_name);
+                }
             }
         }
+        first = end;
     }
-    return true;
+
+    if (use_single_file && success)
+    {
+        MeshLib::IO::VtuInterface vtu(geometry.mesh.get());
+        vtu.writeToFile(output_name);
+    }
+    return success;
 }
 
 int main(int argc, char* argv[])
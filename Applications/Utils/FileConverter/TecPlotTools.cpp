@@ -7,6 +7,7 @@
  *
  */
 
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -17,6 +18,7 @@
 #include <Applications/ApplicationsLib/LogogSetup.h>
 
 #include "InfoLib/GitInfo.h"
+#include "BaseLib/BackgroundTaskQueue.h"
 #include "BaseLib/StringTools.h"
 
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
@@ -169,11 +171,12 @@ void writeTecPlotSection(std::ofstream& out,
     }
 }
 
-/// Writes one section/zone into a separate OGS-mesh
+/// Writes one section/zone into a separate OGS-mesh. The scalar arrays are
+/// moved into the mesh.
 int writeDataToMesh(std::string const& file_name,
-                    std::size_t& write_count,
+                    std::size_t const section,
                     std::vector<std::string> const& vec_names,
-                    std::vector<std::vector<double>> const& scalars,
+                    std::vector<std::vector<double>>& scalars,
                     std::pair<std::size_t, std::size_t> const& dims)
 {
     double cellsize = 0;
@@ -201,6 +204,7 @@ int writeDataToMesh(std::string const& file_name,
                                        MeshLib::MeshElemType::QUAD,
                                        MeshLib::UseIntensityAs::DATAVECTOR,
                                        vec_names[0]));
+    std::vector<double>().swap(scalars[0]);
     MeshLib::Properties& properties = mesh->getProperties();
     for (std::size_t i = 1; i < vec_names.size(); ++i)
     {
@@ -211,20 +215,86 @@ int writeDataToMesh(std::string const& file_name,
             ERR("Error creating array '%s'.", vec_names[i].c_str());
             return -5;
         }
-        prop->reserve(scalars[i].size());
-        std::copy(scalars[i].cbegin(), scalars[i].cend(), std::back_inserter(*prop));
+        prop->swap(scalars[i]);
     }
 
     std::size_t const delim_pos(file_name.find_last_of("."));
     std::string const base_name(file_name.substr(0, delim_pos + 1));
     std::string const extension(file_name.substr(delim_pos, std::string::npos));
 
-    INFO("Writing section #%i", write_count);
+    INFO("Writing section #%i", section);
     MeshLib::IO::VtuInterface vtu(mesh.get());
-    vtu.writeToFile(base_name + std::to_string(write_count++) + extension);
+    vtu.writeToFile(base_name + std::to_string(section) + extension);
     return 0;
 }
 
+/// Writes the sections/zones into OGS-meshes by a background thread while the
+/// next section is read. Only one section is written at a time.
+class MeshSectionWriter final
+{
+public:
+    explicit MeshSectionWriter(std::string file_name)
+        : _file_name(std::move(file_name))
+    {
+    }
+
+    /// Writes the section; the scalar arrays are moved into the task.
+    void write(std::vector<std::string> const& vec_names,
+               std::vector<std::vector<double>>& scalars,
+               std::pair<std::size_t, std::size_t> const& dims)
+    {
+        _queue.push([this, section = _write_count++, vec_names,
+                     scalars = std::move(scalars), dims]() mutable {
+            int const result =
+                writeDataToMesh(_file_name, section, vec_names, scalars, dims);
+            if (_result == 0)
+            {
+                _result = result;
+            }
+        });
+    }
+
+    /// Waits for all sections; returns the error code of the first failed
+    /// section or 0.
+    int wait()
+    {
+        _queue.wait();
+        return _result;
+    }
+
+private:
+    std::string const _file_name;
+    std::size_t _write_count = 0;
+    /// Only accessed by the task thread until wait() returns.
+    int _result = 0;
+    BaseLib::BackgroundTaskQueue _queue{1};
+};
+
+/// Appends the values of a data line to the scalar arrays. Returns the number
+/// of values found, which is larger than the number of arrays for too much
+/// data.
+std::size_t parseDataLine(std::string const& line,
+                          std::vector<std::vector<double>>& scalars)
+{
+    char const* begin = line.c_str();
+    std::size_t i(0);
+    for (;;)
+    {
+        char* end;
+        double const x = std::strtod(begin, &end);
+        if (end == begin)
+        {
+            return i;
+        }
+        if (i == scalars.size())
+        {
+            return i + 1;
+        }
+        scalars[i++].push_back(x);
+        begin = end;
+    }
+}
+
 /// If a geometry-section is encountered, it is currently ignored
 void skipGeometrySection(std::ifstream& in, std::string& line)
 {
@@ -298,7 +368,8 @@ int splitFile(std::ifstream& in, std::string file_name)
     return 0;
 }
 
-/// Converts a TecPlot file into one or more OGS-meshes (one mesh per section/zone)
+/// Converts a TecPlot file into one or more OGS-meshes (one mesh per
+/// section/zone). A section is written while the next one is read.
 int convertFile(std::ifstream& in, std::string file_name)
 {
     std::string line;
@@ -308,7 +379,7 @@ int convertFile(std::ifstream& in, std::string file_name)
     std::vector<std::vector<double>> scalars;
     std::size_t val_count(0);
     std::size_t val_total(0);
-    std::size_t write_count(0);
+    MeshSectionWriter writer(std::move(file_name));
     while (std::getline(in, line))
     {
         if (line.find("GEOMETRY") != std::string::npos)
@@ -328,7 +399,7 @@ int convertFile(std::ifstream& in, std::string file_name)
             }
             if (val_count != 0)
             {
-                writeDataToMesh(file_name, write_count, var_names, scalars, dims);
+                writer.write(var_names, scalars, dims);
                 resetDataStructures(var_names.size(), scalars, val_count);
             }
             continue;
@@ -341,7 +412,7 @@ int convertFile(std::ifstream& in, std::string file_name)
                 {
                     return -3;
                 }
-                writeDataToMesh(file_name, write_count, var_names, scalars, dims);
+                writer.write(var_names, scalars, dims);
             }
             var_names.clear();
             var_names = getVariables(line);
@@ -356,30 +427,27 @@ int convertFile(std::ifstream& in, std::string file_name)
                 {
                     return -3;
                 }
-                writeDataToMesh(file_name, write_count, var_names, scalars, dims);
+                writer.write(var_names, scalars, dims);
                 resetDataStructures(var_names.size(), scalars, val_count);
             }
             name = getName(line);
             dims = getDimensions(line);
             val_total = dims.first * dims.second;
             val_count = 0;
+            for (auto& values : scalars)
+            {
+                values.reserve(val_total);
+            }
             continue;
         }
 
-        double x;
-        std::stringstream iss(line);
-        std::size_t i(0);
-        std::size_t const n_scalars(scalars.size());
-        while (iss >> x)
+        std::size_t const n_values = parseDataLine(line, scalars);
+        if (n_values > scalars.size())
         {
-            if (i > n_scalars - 1)
-            {
-                ERR("Too much data for existing scalar arrays");
-                return -3;
-            }
-            scalars[i++].push_back(x);
+            ERR("Too much data for existing scalar arrays");
+            return -3;
         }
-        if (i < n_scalars)
+        if (n_values < scalars.size())
         {
             ERR("Not enough data for existing scalar arrays");
             return -3;
@@ -390,7 +458,11 @@ int convertFile(std::ifstream& in, std::string file_name)
     {
         return -3;
     }
-    writeDataToMesh(file_name, write_count, var_names, scalars, dims);
+    writer.write(var_names, scalars, dims);
+    if (int const result = writer.wait(); result != 0)
+    {
+        return result;
+    }
     INFO("Finished conversion.");
     return 0;
 }
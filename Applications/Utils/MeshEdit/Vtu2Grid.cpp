@@ -13,11 +13,10 @@
 #include "Applications/ApplicationsLib/LogogSetup.h"
 #include "InfoLib/GitInfo.h"
 
+#include "MeshLib/Elements/Hex.h"
 #include "MeshLib/IO/writeMeshToFile.h"
 #include "MeshLib/Mesh.h"
-#include "MeshLib/MeshEditing/RemoveMeshComponents.h"
-#include "MeshLib/MeshGenerators/MeshGenerator.h"
-#include "MeshLib/MeshSearch/ElementSearch.h"
+#include "MeshLib/Node.h"
 
 #include <vtkAbstractArray.h>
 #include <vtkCellData.h>
@@ -53,21 +52,19 @@ std::vector<int> assignCellIds(vtkSmartPointer<vtkUnstructuredGrid> const& mesh,
     locator->SetDataSet(mesh);
     locator->Update();
 
+    // The cells are ordered like the elements of a regular hex mesh, i.e.,
+    // with the x-index running fastest.
     std::vector<int>  cell_ids;
     cell_ids.reserve(dims[0] * dims[1] * dims[2]);
-    std::array<double, 3> const grid_max = {min[0] + dims[0] * cellsize[0],
-                                            min[1] + dims[1] * cellsize[1],
-                                            min[2] + dims[2] * cellsize[2]};
-    for (double k = min[2] + (cellsize[2] / 2.0); k < grid_max[2];
-         k += cellsize[2])
+    for (std::size_t k = 0; k < dims[2]; ++k)
     {
-        for (double j = min[1] + (cellsize[1] / 2.0); j < grid_max[1];
-             j += cellsize[1])
+        for (std::size_t j = 0; j < dims[1]; ++j)
         {
-            for (double i = min[0] + (cellsize[0] / 2.0); i < grid_max[0];
-                 i += cellsize[0])
+            for (std::size_t i = 0; i < dims[0]; ++i)
             {
-                double pnt[3] = {i, j, k};
+                double pnt[3] = {min[0] + (i + 0.5) * cellsize[0],
+                                 min[1] + (j + 0.5) * cellsize[1],
+                                 min[2] + (k + 0.5) * cellsize[2]};
                 cell_ids.push_back(static_cast<int>(locator->FindCell(pnt)));
             }
         }
@@ -75,25 +72,67 @@ std::vector<int> assignCellIds(vtkSmartPointer<vtkUnstructuredGrid> const& mesh,
     return cell_ids;
 }
 
-bool removeUnusedGridCells(vtkSmartPointer<vtkUnstructuredGrid> const& mesh,
-                           std::unique_ptr<MeshLib::Mesh>& grid)
+/// Creates the hex mesh of those grid cells whose centres lie within the
+/// input mesh. The grid is given implicitly by its origin, cell size and
+/// dimensions, only the nodes and elements of the valid cells are created.
+std::unique_ptr<MeshLib::Mesh> generateTrimmedGrid(
+    std::vector<int> const& cell_ids, MathLib::Point3d const& min,
+    std::array<std::size_t, 3> const& dims,
+    std::array<double, 3> const& cellsize)
 {
-    MeshLib::ElementSearch search(*grid);
-    std::size_t const n_elems_marked = search.searchByPropertyValueRange<int>(
-        cell_id_name, 0, static_cast<int>(mesh->GetNumberOfCells()), true);
+    std::size_t const n_x_nodes = dims[0] + 1;
+    std::size_t const n_y_nodes = dims[1] + 1;
+    std::vector<MeshLib::Node*> grid_nodes(n_x_nodes * n_y_nodes *
+                                           (dims[2] + 1));
+    std::vector<MeshLib::Node*> nodes;
+    auto node = [&](std::size_t const i, std::size_t const j,
+                    std::size_t const k) {
+        auto& n = grid_nodes[(k * n_y_nodes + j) * n_x_nodes + i];
+        if (n == nullptr)
+        {
+            n = new MeshLib::Node(min[0] + i * cellsize[0],
+                                  min[1] + j * cellsize[1],
+                                  min[2] + k * cellsize[2]);
+            nodes.push_back(n);
+        }
+        return n;
+    };
 
-    if (n_elems_marked == grid->getNumberOfElements())
+    std::vector<MeshLib::Element*> elements;
+    std::vector<int> valid_cell_ids;
+    std::size_t cell = 0;
+    for (std::size_t k = 0; k < dims[2]; ++k)
     {
-        ERR ("No valid elements found. Aborting...");
-        return false;
+        for (std::size_t j = 0; j < dims[1]; ++j)
+        {
+            for (std::size_t i = 0; i < dims[0]; ++i, ++cell)
+            {
+                if (cell_ids[cell] < 0)
+                {
+                    continue;
+                }
+                elements.push_back(new MeshLib::Hex(
+                    {// bottom
+                     node(i, j, k), node(i + 1, j, k), node(i + 1, j + 1, k),
+                     node(i, j + 1, k),
+                     // top
+                     node(i, j, k + 1), node(i + 1, j, k + 1),
+                     node(i + 1, j + 1, k + 1), node(i, j + 1, k + 1)}));
+                valid_cell_ids.push_back(cell_ids[cell]);
+            }
+        }
     }
 
-    if (n_elems_marked)
+    if (elements.empty())
     {
-        grid.reset(MeshLib::removeElements(
-            *grid, search.getSearchedElementIDs(), "trimmed_grid"));
+        return nullptr;
     }
-    return true;
+
+    auto grid = std::make_unique<MeshLib::Mesh>("grid", nodes, elements);
+    auto& grid_cell_ids = *grid->getProperties().createNewPropertyVector<int>(
+        cell_id_name, MeshLib::MeshItemType::Cell, 1);
+    grid_cell_ids.assign(valid_cell_ids.begin(), valid_cell_ids.end());
+    return grid;
 }
 
 template <typename T, typename VTK_TYPE>
@@ -203,20 +242,14 @@ int main (int argc, char* argv[])
     MathLib::Point3d const min(std::array<double, 3>{bounds[0], bounds[2], bounds[4]});
     MathLib::Point3d const max(std::array<double, 3>{bounds[1], bounds[3], bounds[5]});
     std::array<std::size_t, 3> const dims = getDimensions(min, max, cellsize);
-    std::unique_ptr<MeshLib::Mesh> grid(
-        MeshLib::MeshGenerator::generateRegularHexMesh(
-            dims[0], dims[1], dims[2], cellsize[0], cellsize[1], cellsize[2],
-            min, "grid"));
-
-
-    std::vector<int> const tmp_ids = assignCellIds(mesh, min, dims, cellsize);
-    std::vector<int>& cell_ids =
-        *grid->getProperties().createNewPropertyVector<int>(
-            cell_id_name, MeshLib::MeshItemType::Cell, 1);
-    std::copy(tmp_ids.cbegin(), tmp_ids.cend(), std::back_inserter(cell_ids));
-
-    if (!removeUnusedGridCells(mesh, grid))
+    std::vector<int> const cell_ids = assignCellIds(mesh, min, dims, cellsize);
+    std::unique_ptr<MeshLib::Mesh> grid =
+        generateTrimmedGrid(cell_ids, min, dims, cellsize);
+    if (!grid)
+    {
+        ERR ("No valid elements found. Aborting...");
         return EXIT_FAILURE;
+    }
 
     mapMeshArraysOntoGrid(mesh, grid);
 
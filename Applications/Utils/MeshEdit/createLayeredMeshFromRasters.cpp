@@ -27,8 +27,10 @@
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 #include "Applications/FileIO/AsciiRasterInterface.h"
 
+#include "GeoLib/AABB.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshGenerators/MeshLayerMapper.h"
+#include "MeshLib/Node.h"
 
 int readRasterPaths(std::string const& raster_list_file, std::vector<std::string> &raster_path_vec)
 {
@@ -138,8 +140,11 @@ int main (int argc, char* argv[])
         return EXIT_FAILURE;
     }
 
+    // Only the part of the rasters covering the surface mesh is read.
+    GeoLib::AABB const sfc_mesh_aabb(sfc_mesh->getNodes().cbegin(),
+                                     sfc_mesh->getNodes().cend());
     MeshLib::MeshLayerMapper mapper;
-    if (auto rasters = FileIO::readRasters(raster_paths))
+    if (auto rasters = FileIO::readRasters(raster_paths, sfc_mesh_aabb))
     {
         if (!mapper.createLayers(*sfc_mesh, *rasters, min_thickness))
         {
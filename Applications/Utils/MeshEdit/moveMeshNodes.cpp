@@ -183,6 +183,7 @@ int main (int argc, char* argv[])
             elevation[i] = (*nodes[i])[2];
         }
 
+        mesh->computeNodesConnectedByElements();
         for (std::size_t i=0; i<nNodes; i++)
         {
             const std::vector<MeshLib::Node*> conn_nodes (nodes[i]->getConnectedNodes());
@@ -70,6 +70,9 @@ int main(int argc, char *argv[])
     }
     selected_node_ids.insert(selected_node_ids.end(), nodeId_arg.getValue().begin(), nodeId_arg.getValue().end());
 
+    mesh->computeElementNeighbors();
+    mesh->computeNodesConnectedByElements();
+
     auto const materialIds = materialIDs(*mesh);
     for (auto ele_id : eleId_arg.getValue())
     {
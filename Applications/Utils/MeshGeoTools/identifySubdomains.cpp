@@ -127,16 +127,12 @@ int main(int argc, char* argv[])
     //
     // Identify the subdomains in the bulk mesh.
     //
-    for (auto& mesh_ptr : subdomain_meshes)
-    {
-        // If force overwrite is set or the output is to different mesh than
-        // the input mesh.
-        bool const overwrite_property_vectors =
-            force_overwrite_arg.getValue() ||
-            !output_prefix_arg.getValue().empty();
-        identifySubdomainMesh(*mesh_ptr, *bulk_mesh, mesh_node_searcher,
-                              overwrite_property_vectors);
-    }
+    // If force overwrite is set or the output is to different mesh than the
+    // input mesh.
+    bool const overwrite_property_vectors =
+        force_overwrite_arg.getValue() || !output_prefix_arg.getValue().empty();
+    identifySubdomainMeshes(subdomain_meshes, *bulk_mesh, mesh_node_searcher,
+                            overwrite_property_vectors);
 
     //
     // Output after the successful subdomain mesh identification.
@@ -9,16 +9,30 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 
 #include "BaseLib/Error.h"
 #include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
 
 namespace ApplicationUtils
 {
 void writeMETIS(std::vector<MeshLib::Element*> const& elements,
-                const std::string& file_name)
+                const std::string& file_name,
+                std::vector<long> const& element_weights)
 {
+    bool const has_weights = !element_weights.empty();
+    if (has_weights && element_weights.size() != elements.size())
+    {
+        OGS_FATAL(
+            "The number of element weights (%d) differs from the number of "
+            "elements (%d).",
+            element_weights.size(), elements.size());
+    }
+
     std::ofstream os(file_name, std::ios::trunc);
     if (!os.is_open())
     {
@@ -30,9 +44,14 @@ void writeMETIS(std::vector<MeshLib::Element*> const& elements,
         OGS_FATAL("Error: Cannot write in file %s.", file_name.data());
     }
 
-    os << elements.size() << " \n";
-    for (const auto* elem : elements)
+    os << elements.size() << (has_weights ? " 1" : "") << " \n";
+    for (std::size_t i = 0; i < elements.size(); i++)
     {
+        auto const* const elem = elements[i];
+        if (has_weights)
+        {
+            os << element_weights[i] << " ";
+        }
         os << elem->getNodeIndex(0) + 1;
         for (unsigned j = 1; j < elem->getNumberOfNodes(); j++)
         {
@@ -42,6 +61,43 @@ void writeMETIS(std::vector<MeshLib::Element*> const& elements,
     }
 }
 
+std::vector<long> getElementWeights(MeshLib::Mesh const& mesh,
+                                    std::string const& property_name)
+{
+    auto const& properties = mesh.getProperties();
+    auto const n_elements = mesh.getNumberOfElements();
+
+    std::vector<long> weights(n_elements, 1);
+    if (properties.existsPropertyVector<int>(
+            property_name, MeshLib::MeshItemType::Cell, 1))
+    {
+        auto const& values = *properties.getPropertyVector<int>(
+            property_name, MeshLib::MeshItemType::Cell, 1);
+        for (std::size_t i = 0; i < n_elements; i++)
+        {
+            weights[i] = std::max(1L, static_cast<long>(values[i]));
+        }
+        return weights;
+    }
+
+    auto const& values = *properties.getPropertyVector<double>(
+        property_name, MeshLib::MeshItemType::Cell, 1);
+
+    double min_positive_value = std::numeric_limits<double>::max();
+    for (std::size_t i = 0; i < n_elements; i++)
+    {
+        if (values[i] > 0)
+        {
+            min_positive_value = std::min(min_positive_value, values[i]);
+        }
+    }
+    for (std::size_t i = 0; i < n_elements; i++)
+    {
+        weights[i] = std::max(1L, std::lround(values[i] / min_positive_value));
+    }
+    return weights;
+}
+
 std::vector<std::size_t> readMetisData(const std::string& file_name_base,
                                        long const number_of_partitions,
                                        std::size_t const number_of_nodes)
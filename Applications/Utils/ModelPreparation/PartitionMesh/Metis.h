@@ -17,6 +17,7 @@
 namespace MeshLib
 {
 class Element;
+class Mesh;
 }
 
 namespace ApplicationUtils
@@ -24,8 +25,21 @@ namespace ApplicationUtils
 /// Write elements as METIS graph file
 /// \param elements The mesh elements.
 /// \param file_name File name with an extension of mesh.
+/// \param element_weights Optional positive weights of the elements, e.g.
+///                        their estimated or measured assembly costs. If
+///                        given, the weights are written in front of the
+///                        node ids of each element.
 void writeMETIS(std::vector<MeshLib::Element*> const& elements,
-                const std::string& file_name);
+                const std::string& file_name,
+                std::vector<long> const& element_weights = {});
+
+/// Converts the cell data array \c property_name of the mesh into positive
+/// integer element weights for METIS. Integer arrays are used as given,
+/// floating point arrays, e.g. measured assembly times, are scaled such that
+/// the smallest positive value becomes one. Non-positive weights are raised to
+/// one.
+std::vector<long> getElementWeights(MeshLib::Mesh const& mesh,
+                                    std::string const& property_name);
 
 /// Read metis data
 /// \param file_name_base The prefix of the filename.
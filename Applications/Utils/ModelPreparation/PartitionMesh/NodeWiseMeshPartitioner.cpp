@@ -14,6 +14,7 @@
 
 #include "NodeWiseMeshPartitioner.h"
 
+#include <fstream>
 #include <limits>
 #include <numeric>
 #include <unordered_map>
@@ -1049,6 +1050,19 @@ void NodeWiseMeshPartitioner::writeOtherMesh(
                           partitions, MeshLib::MeshItemType::Cell);
 }
 
+void writeBlocksInfo(std::string const& file_name_base,
+                     long const number_of_blocks,
+                     std::string const& bulk_mesh_file_name_base)
+{
+    std::string const file_name = file_name_base + "_partitioned_blocks.txt";
+    std::ofstream os(file_name);
+    if (!os)
+    {
+        OGS_FATAL("Could not open file '%s' for writing.", file_name.c_str());
+    }
+    os << number_of_blocks << "\n" << bulk_mesh_file_name_base << "\n";
+}
+
 void NodeWiseMeshPartitioner::writeConfigDataASCII(
     const std::string& file_name_base)
 {
@@ -53,6 +53,17 @@ MeshLib::Properties partitionProperties(
     MeshLib::Properties const& properties,
     std::vector<Partition> const& partitions);
 
+/// Marks the partition files of a mesh as blocks, which ogs merges at load
+/// time into any number of ranks dividing the number of blocks.
+///
+/// The file \c file_name_base + "_partitioned_blocks.txt" contains the number
+/// of blocks and, for meshes partitioned according to a bulk mesh, the base
+/// name of the bulk mesh's files for the renumbering of the bulk node and
+/// element ids.
+void writeBlocksInfo(std::string const& file_name_base,
+                     long number_of_blocks,
+                     std::string const& bulk_mesh_file_name_base);
+
 /// Mesh partitioner.
 class NodeWiseMeshPartitioner
 {
@@ -29,6 +29,7 @@
 
 #include "Metis.h"
 #include "NodeWiseMeshPartitioner.h"
+#include "SpaceFillingCurve.h"
 
 using namespace ApplicationUtils;
 
@@ -77,6 +78,34 @@ int main(int argc, char* argv[])
         false);
     cmd.add(exe_metis_flag);
 
+    TCLAP::ValueArg<std::string> element_weights_arg(
+        "w", "element_weights",
+        "Name of a cell data array of the mesh with the costs of the elements, "
+        "e.g. estimated from the element type, the number of integration "
+        "points and the material model, or measured in a previous run. The "
+        "partitions are balanced w.r.t. the sum of the element costs instead "
+        "of the number of nodes. The option must be given for both, the "
+        "conversion to the METIS input file and the partitioning.",
+        false, "", "name");
+    cmd.add(element_weights_arg);
+
+    TCLAP::SwitchArg sfc_flag(
+        "", "space_filling_curve",
+        "Partition the nodes along a Hilbert curve through the node "
+        "coordinates instead of using METIS. This needs less memory and time "
+        "than METIS for large meshes but yields larger partition interfaces.",
+        false);
+    cmd.add(sfc_flag);
+
+    TCLAP::SwitchArg blocks_flag(
+        "", "blocks",
+        "Write the partitions as blocks ordered along a space-filling curve. "
+        "ogs merges consecutive blocks at load time, such that the partition "
+        "files can be used with any number of MPI ranks dividing the number "
+        "of partitions. The option requires binary output.",
+        false);
+    cmd.add(blocks_flag);
+
     TCLAP::SwitchArg lh_elems_flag(
         "q", "lh_elements", "Mixed linear and high order elements.", false);
     cmd.add(lh_elems_flag);
@@ -109,8 +138,15 @@ int main(int argc, char* argv[])
     if (ogs2metis_flag.getValue())
     {
         INFO("Write the mesh into METIS input file.");
+        std::vector<long> element_weights;
+        if (element_weights_arg.isSet())
+        {
+            element_weights = ApplicationUtils::getElementWeights(
+                *mesh_ptr, element_weights_arg.getValue());
+        }
         ApplicationUtils::writeMETIS(mesh_ptr->getElements(),
-                                     input_file_name_wo_extension + ".mesh");
+                                     input_file_name_wo_extension + ".mesh",
+                                     element_weights);
         INFO("Total runtime: %g s.", run_timer.elapsed());
         INFO("Total CPU time: %g s.", CPU_timer.elapsed());
 
@@ -138,16 +174,26 @@ int main(int argc, char* argv[])
             "-np=1'.");
     }
 
+    if (blocks_flag.getValue() && ascii_flag.getValue())
+    {
+        OGS_FATAL("The partitions can be written as blocks in binary only.");
+    }
+
     // Execute mpmetis via system(...)
-    if (exe_metis_flag.getValue())
+    if (exe_metis_flag.getValue() && !sfc_flag.getValue())
     {
         INFO("METIS is running ...");
         const std::string exe_name = argv[0];
         const std::string exe_path = BaseLib::extractPath(exe_name);
         INFO("Path to mpmetis is: \n\t%s", exe_path.c_str());
 
+        // METIS ignores element weights for the nodal graph partitioning,
+        // therefore the weighted elements are partitioned via the dual graph,
+        // which also yields the partitioning of the nodes.
+        std::string const graph_type =
+            element_weights_arg.isSet() ? " -gtype=dual " : " -gtype=nodal ";
         const std::string mpmetis_com =
-            BaseLib::joinPaths(exe_path, "mpmetis") + " -gtype=nodal " + "'" +
+            BaseLib::joinPaths(exe_path, "mpmetis") + graph_type + "'" +
             input_file_name_wo_extension + ".mesh" + "' " +
             std::to_string(nparts.getValue());
 
@@ -159,11 +205,31 @@ int main(int argc, char* argv[])
             return EXIT_FAILURE;
         }
     }
-    mesh_partitioner.resetPartitionIdsForNodes(
-        readMetisData(input_file_name_wo_extension, num_partitions,
-                      mesh_partitioner.mesh().getNumberOfNodes()));
+    std::vector<std::size_t> node_partition_ids;
+    if (sfc_flag.getValue())
+    {
+        INFO("Partitioning the nodes along a space-filling curve ...");
+        node_partition_ids = partitionBySpaceFillingCurve(
+            mesh_partitioner.mesh().getNodes(), num_partitions);
+    }
+    else
+    {
+        node_partition_ids =
+            readMetisData(input_file_name_wo_extension, num_partitions,
+                          mesh_partitioner.mesh().getNumberOfNodes());
+
+        removeMetisPartitioningFiles(input_file_name_wo_extension,
+                                     num_partitions);
 
-    removeMetisPartitioningFiles(input_file_name_wo_extension, num_partitions);
+        if (blocks_flag.getValue())
+        {
+            INFO("Ordering the blocks along a space-filling curve ...");
+            node_partition_ids = orderPartitionsAlongSpaceFillingCurve(
+                mesh_partitioner.mesh().getNodes(), node_partition_ids,
+                num_partitions);
+        }
+    }
+    mesh_partitioner.resetPartitionIdsForNodes(std::move(node_partition_ids));
 
     INFO("Partitioning the mesh in the node wise way ...");
     bool const is_mixed_high_order_linear_elems = lh_elems_flag.getValue();
@@ -198,6 +264,13 @@ int main(int argc, char* argv[])
         mesh_partitioner.writeOtherMesh(
             other_mesh_output_file_name_wo_extension, partitions,
             partitioned_properties);
+        if (blocks_flag.getValue())
+        {
+            writeBlocksInfo(other_mesh_output_file_name_wo_extension,
+                            num_partitions,
+                            BaseLib::extractBaseName(
+                                output_file_name_wo_extension));
+        }
     }
 
     if (ascii_flag.getValue())
@@ -209,6 +282,10 @@ int main(int argc, char* argv[])
     {
         INFO("Write the data of partitions into binary files ...");
         mesh_partitioner.writeBinary(output_file_name_wo_extension);
+        if (blocks_flag.getValue())
+        {
+            writeBlocksInfo(output_file_name_wo_extension, num_partitions, "");
+        }
     }
 
     INFO("Total runtime: %g s.", run_timer.elapsed());
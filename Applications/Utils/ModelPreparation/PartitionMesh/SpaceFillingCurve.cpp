@@ -0,0 +1,113 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "SpaceFillingCurve.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "BaseLib/Error.h"
+#include "MathLib/HilbertCurve.h"
+#include "MeshLib/Node.h"
+
+namespace ApplicationUtils
+{
+std::vector<std::size_t> partitionBySpaceFillingCurve(
+    std::vector<MeshLib::Node*> const& nodes, long const number_of_partitions)
+{
+    if (number_of_partitions < 1)
+    {
+        OGS_FATAL("Number of partitions must be positive.");
+    }
+
+    std::vector<MathLib::Point3d> points;
+    points.reserve(nodes.size());
+    for (auto const* node : nodes)
+    {
+        points.emplace_back(*node);
+    }
+    auto const hilbert_positions = MathLib::computeHilbertCurvePositions(points);
+
+    std::vector<std::pair<std::uint64_t, std::size_t>> curve_positions;
+    curve_positions.reserve(nodes.size());
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        curve_positions.emplace_back(hilbert_positions[i], i);
+    }
+    std::sort(curve_positions.begin(), curve_positions.end());
+
+    // Cut the curve into pieces differing by at most one node.
+    std::vector<std::size_t> partition_ids(nodes.size());
+    auto const n_partitions = static_cast<std::size_t>(number_of_partitions);
+    for (std::size_t i = 0; i < curve_positions.size(); ++i)
+    {
+        partition_ids[curve_positions[i].second] =
+            i * n_partitions / curve_positions.size();
+    }
+    return partition_ids;
+}
+
+std::vector<std::size_t> orderPartitionsAlongSpaceFillingCurve(
+    std::vector<MeshLib::Node*> const& nodes,
+    std::vector<std::size_t> const& partition_ids,
+    long const number_of_partitions)
+{
+    auto const n_partitions = static_cast<std::size_t>(number_of_partitions);
+
+    std::vector<MathLib::Point3d> centroids(n_partitions,
+                                            MathLib::Point3d{{0, 0, 0}});
+    std::vector<std::size_t> number_of_nodes(n_partitions, 0);
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        auto& centroid = centroids[partition_ids[i]];
+        for (int d = 0; d < 3; ++d)
+        {
+            centroid[d] += (*nodes[i])[d];
+        }
+        ++number_of_nodes[partition_ids[i]];
+    }
+    for (std::size_t p = 0; p < n_partitions; ++p)
+    {
+        if (number_of_nodes[p] == 0)
+        {
+            continue;
+        }
+        for (int d = 0; d < 3; ++d)
+        {
+            centroids[p][d] /= static_cast<double>(number_of_nodes[p]);
+        }
+    }
+    auto const hilbert_positions =
+        MathLib::computeHilbertCurvePositions(centroids);
+
+    std::vector<std::pair<std::uint64_t, std::size_t>> curve_positions;
+    curve_positions.reserve(n_partitions);
+    for (std::size_t p = 0; p < n_partitions; ++p)
+    {
+        curve_positions.emplace_back(hilbert_positions[p], p);
+    }
+    std::sort(curve_positions.begin(), curve_positions.end());
+
+    std::vector<std::size_t> new_partition_ids(n_partitions);
+    for (std::size_t i = 0; i < n_partitions; ++i)
+    {
+        new_partition_ids[curve_positions[i].second] = i;
+    }
+
+    std::vector<std::size_t> result(partition_ids.size());
+    for (std::size_t i = 0; i < partition_ids.size(); ++i)
+    {
+        result[i] = new_partition_ids[partition_ids[i]];
+    }
+    return result;
+}
+}  // namespace ApplicationUtils
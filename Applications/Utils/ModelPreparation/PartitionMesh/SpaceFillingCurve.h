@@ -0,0 +1,42 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace MeshLib
+{
+class Node;
+}
+
+namespace ApplicationUtils
+{
+/// Partitions the nodes by cutting a Hilbert curve through the nodes'
+/// coordinates into pieces of equal numbers of nodes.
+///
+/// In contrast to METIS the mesh graph is not needed, hence the partitioning
+/// takes linear memory and n log n time in the number of nodes. The
+/// partitions are spatially compact but have larger interfaces than the graph
+/// partitions of METIS.
+/// \return The partition id of each node.
+std::vector<std::size_t> partitionBySpaceFillingCurve(
+    std::vector<MeshLib::Node*> const& nodes, long number_of_partitions);
+
+/// Renumbers the partitions along a Hilbert curve through their centroids.
+///
+/// Partitions with consecutive ids are then spatially close, such that
+/// merging groups of consecutive partitions again yields compact partitions.
+/// \return The new partition id of each node.
+std::vector<std::size_t> orderPartitionsAlongSpaceFillingCurve(
+    std::vector<MeshLib::Node*> const& nodes,
+    std::vector<std::size_t> const& partition_ids, long number_of_partitions);
+}  // namespace ApplicationUtils
@@ -0,0 +1,172 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <nlohmann/json.hpp>
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+#include "BaseLib/FileTools.h"
+#include "BaseLib/TCLAPCustomOutput.h"
+#include "InfoLib/GitInfo.h"
+
+using nlohmann::json;
+
+namespace
+{
+bool readJSON(std::string const& file_name, json& data)
+{
+    std::ifstream in(file_name);
+    if (!in)
+    {
+        return false;
+    }
+    try
+    {
+        in >> data;
+    }
+    catch (json::exception const& e)
+    {
+        ERR("Could not parse '%s': %s", file_name.c_str(), e.what());
+        return false;
+    }
+    return true;
+}
+
+/// Compares the accumulated times of the regions of the timing output to the
+/// baseline. Returns false if a region has become slower by more than the
+/// tolerance.
+bool compareTotals(json const& timing, json const& baseline,
+                   double const tolerance, double const min_time)
+{
+    auto const& total = timing.at("total");
+    bool passed = true;
+    for (auto const& item : baseline.at("total").items())
+    {
+        auto const& region = item.key();
+        double const baseline_time = item.value().at("time").get<double>();
+        if (baseline_time < min_time)
+        {
+            // Short regions are dominated by noise.
+            continue;
+        }
+        if (total.find(region) == total.end())
+        {
+            WARN("The region '%s' of the baseline has not been timed.",
+                 region.c_str());
+            continue;
+        }
+        double const time = total.at(region).at("time").get<double>();
+        double const ratio = time / baseline_time;
+        if (ratio > 1 + tolerance)
+        {
+            ERR("%-40s %10.4g s, baseline %10.4g s (%+.1f %%) is too slow.",
+                region.c_str(), time, baseline_time, 100 * (ratio - 1));
+            passed = false;
+        }
+        else
+        {
+            INFO("%-40s %10.4g s, baseline %10.4g s (%+.1f %%)",
+                 region.c_str(), time, baseline_time, 100 * (ratio - 1));
+        }
+    }
+    return passed;
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Compares the timing output of ogs (--timing-output with the json "
+        "format) to a baseline. The accumulated time of each region must not "
+        "exceed the baseline time by more than the given tolerance. If the "
+        "baseline file does not exist, the timing output is copied to it.\n\n"
+        "OpenGeoSys-6 software, version " +
+            GitInfoLib::GitInfo::ogs_version +
+            ".\n"
+            "Copyright (c) 2012-2020, OpenGeoSys Community "
+            "(http://www.opengeosys.org)",
+        ' ', GitInfoLib::GitInfo::ogs_version);
+
+    auto tclapOutput = std::make_unique<BaseLib::TCLAPCustomOutput>();
+    cmd.setOutput(tclapOutput.get());
+
+    TCLAP::ValueArg<double> min_time_arg(
+        "m", "min-time",
+        "regions taking less time in the baseline are not compared, in "
+        "seconds",
+        false, 0.1, "MIN_TIME");
+    cmd.add(min_time_arg);
+    TCLAP::ValueArg<double> tolerance_arg(
+        "t", "tolerance",
+        "allowed relative increase of the time of a region, e.g. 0.2 for 20 %",
+        false, 0.2, "TOLERANCE");
+    cmd.add(tolerance_arg);
+    TCLAP::ValueArg<std::string> baseline_arg(
+        "b", "baseline", "the baseline timing file", true, "", "BASELINE");
+    cmd.add(baseline_arg);
+    TCLAP::ValueArg<std::string> timing_arg(
+        "i", "input", "the timing file written by ogs", true, "", "TIMING");
+    cmd.add(timing_arg);
+    cmd.parse(argc, argv);
+
+    json timing;
+    if (!readJSON(timing_arg.getValue(), timing))
+    {
+        ERR("Could not read the timing file '%s'.",
+            timing_arg.getValue().c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (!BaseLib::IsFileExisting(baseline_arg.getValue()))
+    {
+        std::ofstream out(baseline_arg.getValue());
+        out << timing.dump(2) << '\n';
+        if (!out)
+        {
+            ERR("Could not write the baseline '%s'.",
+                baseline_arg.getValue().c_str());
+            return EXIT_FAILURE;
+        }
+        INFO("Stored the timing as new baseline '%s'.",
+             baseline_arg.getValue().c_str());
+        return EXIT_SUCCESS;
+    }
+
+    json baseline;
+    if (!readJSON(baseline_arg.getValue(), baseline))
+    {
+        ERR("Could not read the baseline '%s'.",
+            baseline_arg.getValue().c_str());
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        if (!compareTotals(timing, baseline, tolerance_arg.getValue(),
+                           min_time_arg.getValue()))
+        {
+            ERR("Performance regression compared to '%s'.",
+                baseline_arg.getValue().c_str());
+            return EXIT_FAILURE;
+        }
+    }
+    catch (json::exception const& e)
+    {
+        ERR("Unexpected structure of the timing files: %s", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -6,8 +6,9 @@
  *              http://www.opengeosys.org/LICENSE.txt
  */
 
-#include <map>
+#include <exception>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <tclap/CmdLine.h>
@@ -19,7 +20,7 @@
 #include "InfoLib/GitInfo.h"
 #include "BaseLib/FileTools.h"
 #include "MeshLib/IO/readMeshFromFile.h"
-#include "MeshLib/IO/writeMeshToFile.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshEditing/ConvertToLinearMesh.h"
 #include "ProcessLib/LIE/Common/MeshUtils.h"
@@ -27,18 +28,26 @@
 
 namespace
 {
-void postVTU(std::string const& int_vtu_filename,
-             std::string const& out_vtu_filename)
+std::unique_ptr<MeshLib::Mesh const> readResultMesh(
+    std::string const& vtu_filename)
 {
     // read VTU with simulation results
     std::unique_ptr<MeshLib::Mesh const> mesh(
-        MeshLib::IO::readMeshFromFile(int_vtu_filename));
+        MeshLib::IO::readMeshFromFile(vtu_filename));
+    if (!mesh)
+    {
+        OGS_FATAL("Could not read the mesh '%s'.", vtu_filename.c_str());
+    }
     if (mesh->isNonlinear())
     {
         mesh = MeshLib::convertToLinearMesh(*mesh, mesh->getName());
     }
+    return mesh;
+}
 
-    // post-process
+std::unique_ptr<ProcessLib::LIE::PostProcessTool> createPostProcessTool(
+    MeshLib::Mesh const& mesh)
+{
     std::vector<MeshLib::Element*> vec_matrix_elements;
     std::vector<int> vec_fracture_mat_IDs;
     std::vector<std::vector<MeshLib::Element*>> vec_fracture_elements;
@@ -49,20 +58,36 @@ void postVTU(std::string const& int_vtu_filename,
     std::vector<std::pair<std::size_t, std::vector<int>>>
         vec_junction_nodeID_matIDs;
     ProcessLib::LIE::getFractureMatrixDataInMesh(
-        *mesh, vec_matrix_elements, vec_fracture_mat_IDs, vec_fracture_elements,
+        mesh, vec_matrix_elements, vec_fracture_mat_IDs, vec_fracture_elements,
         vec_fracture_matrix_elements, vec_fracture_nodes,
         vec_branch_nodeID_matIDs, vec_junction_nodeID_matIDs);
 
-    ProcessLib::LIE::PostProcessTool post(*mesh,
-                                          vec_fracture_mat_IDs,
-                                          vec_fracture_nodes,
-                                          vec_fracture_matrix_elements,
-                                          vec_branch_nodeID_matIDs,
-                                          vec_junction_nodeID_matIDs);
+    return std::make_unique<ProcessLib::LIE::PostProcessTool>(
+        mesh, vec_fracture_mat_IDs, vec_fracture_nodes,
+        vec_fracture_matrix_elements, vec_branch_nodeID_matIDs,
+        vec_junction_nodeID_matIDs);
+}
 
-    // create a new VTU file
+void writeOutputMesh(ProcessLib::LIE::PostProcessTool const& post,
+                     std::string const& out_vtu_filename)
+{
+    // create a new VTU file; the compressed appended data is written by the
+    // parallel zlib writer
     INFO("create %s", out_vtu_filename.c_str());
-    MeshLib::IO::writeMeshToFile(post.getOutputMesh(), out_vtu_filename);
+    MeshLib::IO::VtuInterface writer(&post.getOutputMesh(),
+                                     vtkXMLWriter::Appended, true);
+    if (!writer.writeToFile(out_vtu_filename))
+    {
+        OGS_FATAL("Could not write the mesh '%s'.", out_vtu_filename.c_str());
+    }
+}
+
+void postVTU(std::string const& int_vtu_filename,
+             std::string const& out_vtu_filename)
+{
+    auto const mesh = readResultMesh(int_vtu_filename);
+    auto const post = createPostProcessTool(*mesh);
+    writeOutputMesh(*post, out_vtu_filename);
 }
 
 void postPVD(std::string const& in_pvd_filename,
@@ -75,6 +100,8 @@ void postPVD(std::string const& in_pvd_filename,
     read_xml(in_pvd_filename, pt,
              boost::property_tree::xml_parser::trim_whitespace);
 
+    std::vector<std::string> org_vtu_filepaths;
+    std::vector<std::string> dest_vtu_filepaths;
     for (auto& dataset : pt.get_child("VTKFile.Collection"))
     {
         if (dataset.first != "DataSet")
@@ -92,20 +119,56 @@ void postPVD(std::string const& in_pvd_filename,
         {
             org_vtu_dir = in_pvd_file_dir;
         }
-        auto const org_vtu_filepath =
-            BaseLib::joinPaths(org_vtu_dir, org_vtu_filebasename);
-        INFO("processing %s...", org_vtu_filepath.c_str());
+        org_vtu_filepaths.push_back(
+            BaseLib::joinPaths(org_vtu_dir, org_vtu_filebasename));
 
-        // post-process the VTU and save into the new file
+        // the post-processed VTU is saved into the new file
         auto const dest_vtu_filename = "post_" + org_vtu_filebasename;
-        auto const dest_vtu_filepath =
-            BaseLib::joinPaths(out_pvd_file_dir, dest_vtu_filename);
-        postVTU(org_vtu_filepath, dest_vtu_filepath);
+        dest_vtu_filepaths.push_back(
+            BaseLib::joinPaths(out_pvd_file_dir, dest_vtu_filename));
 
-        // create a new VTU file and update XML
+        // update XML
         dataset.second.put("<xmlattr>.file", dest_vtu_filename);
     }
 
+    if (!org_vtu_filepaths.empty())
+    {
+        // The fractures and hence the node duplication are the same for all
+        // timesteps. They are determined from the first file and reused for
+        // the others, which are processed in parallel.
+        INFO("processing %s...", org_vtu_filepaths[0].c_str());
+        auto const first_mesh = readResultMesh(org_vtu_filepaths[0]);
+        auto const first_post = createPostProcessTool(*first_mesh);
+        writeOutputMesh(*first_post, dest_vtu_filepaths[0]);
+
+        auto const n_signed = static_cast<long>(org_vtu_filepaths.size());
+        std::string error_message;
+#pragma omp parallel for schedule(dynamic, 1)
+        for (long i = 1; i < n_signed; ++i)
+        {
+            try
+            {
+                INFO("processing %s...", org_vtu_filepaths[i].c_str());
+                auto const mesh = readResultMesh(org_vtu_filepaths[i]);
+                ProcessLib::LIE::PostProcessTool const post(*mesh,
+                                                            *first_post);
+                writeOutputMesh(post, dest_vtu_filepaths[i]);
+            }
+            catch (std::exception const& e)
+            {
+#pragma omp critical(postLIE_error)
+                if (error_message.empty())
+                {
+                    error_message = e.what();
+                }
+            }
+        }
+        if (!error_message.empty())
+        {
+            OGS_FATAL("%s", error_message.c_str());
+        }
+    }
+
     // save into the new PVD file
     INFO("save into the new PVD file %s", out_pvd_filename.c_str());
     boost::property_tree::xml_writer_settings<std::string> settings('\t', 1);
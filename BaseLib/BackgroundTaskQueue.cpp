@@ -0,0 +1,101 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BackgroundTaskQueue.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace BaseLib
+{
+BackgroundTaskQueue::BackgroundTaskQueue(std::size_t const max_tasks_in_flight)
+    : _max_tasks_in_flight(std::max<std::size_t>(max_tasks_in_flight, 1)),
+      _thread(&BackgroundTaskQueue::run, this)
+{
+}
+
+BackgroundTaskQueue::~BackgroundTaskQueue()
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _task_finished.wait(lock, [this] { return _tasks_in_flight == 0; });
+        _stop = true;
+    }
+    _task_pushed.notify_one();
+    _thread.join();
+}
+
+void BackgroundTaskQueue::push(std::function<void()> task)
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _task_finished.wait(lock, [this] {
+            return _tasks_in_flight < _max_tasks_in_flight;
+        });
+        rethrowTaskException();
+        _tasks.push_back(std::move(task));
+        ++_tasks_in_flight;
+    }
+    _task_pushed.notify_one();
+}
+
+void BackgroundTaskQueue::wait()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _task_finished.wait(lock, [this] { return _tasks_in_flight == 0; });
+    rethrowTaskException();
+}
+
+void BackgroundTaskQueue::rethrowTaskException()
+{
+    if (_task_exception)
+    {
+        std::rethrow_exception(std::exchange(_task_exception, nullptr));
+    }
+}
+
+void BackgroundTaskQueue::run()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _task_pushed.wait(lock, [this] { return _stop || !_tasks.empty(); });
+            if (_tasks.empty())
+            {
+                return;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+
+        std::exception_ptr exception;
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (exception && !_task_exception)
+            {
+                _task_exception = exception;
+            }
+            --_tasks_in_flight;
+        }
+        _task_finished.notify_all();
+    }
+}
+}  // namespace BaseLib
@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace BaseLib
+{
+/// Executes tasks one after the other in the order of their submission by a
+/// single background thread.
+///
+/// The number of tasks in flight, i.e., waiting or being executed, is bounded;
+/// push() blocks until the number falls below the bound. An exception thrown
+/// by a task is rethrown by the next call of push() or wait().
+class BackgroundTaskQueue final
+{
+public:
+    explicit BackgroundTaskQueue(std::size_t const max_tasks_in_flight);
+
+    BackgroundTaskQueue(BackgroundTaskQueue const&) = delete;
+    BackgroundTaskQueue& operator=(BackgroundTaskQueue const&) = delete;
+
+    /// Waits for all tasks and stops the thread. Exceptions of the tasks are
+    /// discarded.
+    ~BackgroundTaskQueue();
+
+    void push(std::function<void()> task);
+
+    /// Blocks until all submitted tasks have been executed.
+    void wait();
+
+private:
+    void run();
+
+    /// Rethrows the exception of a failed task. Requires the lock.
+    void rethrowTaskException();
+
+    std::size_t const _max_tasks_in_flight;
+
+    std::mutex _mutex;
+    std::condition_variable _task_pushed;
+    std::condition_variable _task_finished;
+    std::deque<std::function<void()>> _tasks;
+    /// Tasks in the queue and the one being executed.
+    std::size_t _tasks_in_flight = 0;
+    bool _stop = false;
+    std::exception_ptr _task_exception;
+
+    std::thread _thread;
+};
+}  // namespace BaseLib
@@ -13,27 +13,10 @@
 #include <sstream>
 #include <utility>
 
-namespace BaseLib
-{
+#include "Range.h"
 
-//! Wraps a pair of iterators for use as a range in range-based for-loops.
-template<typename Iterator>
-class Range
+namespace BaseLib
 {
-public:
-    explicit Range(Iterator begin, Iterator end)
-        : _begin(std::move(begin)), _end(std::move(end))
-    {}
-
-    Iterator begin() const { return _begin; }
-    Iterator end()   const { return _end; }
-    std::size_t size() const { return std::distance(_begin, _end); }
-    bool empty() const { return size() == 0; }
-
-private:
-    Iterator _begin;
-    Iterator _end;
-};
 
 template<typename T>
 T
@@ -133,7 +116,7 @@ peekConfigParameter(std::string const& param) const
 {
     checkKeyname(param);
 
-    if (auto p = _tree->get_child_optional(param))
+    if (auto const* const p = findChild(*_tree, param))
     {
         try
         {
@@ -222,16 +205,14 @@ getConfigAttributeOptional(std::string const& attr) const
     checkUniqueAttr(attr);
     auto& ct = markVisited<T>(attr, Attr::ATTR, true);
 
-    if (auto attrs = _tree->get_child_optional("<xmlattr>")) {
-        if (auto a = attrs->get_child_optional(attr)) {
-            ++ct.count; // count only if attribute has been found
-            if (auto v = a->get_value_optional<T>()) {
-                return v;
-            }
-            error("Value for XML attribute '" + attr + "' `" +
-                  shortString(a->data()) +
-                  "' not convertible to the desired type.");
+    if (auto const* const a = findAttribute(*_tree, attr)) {
+        ++ct.count; // count only if attribute has been found
+        if (auto v = a->get_value_optional<T>()) {
+            return v;
         }
+        error("Value for XML attribute '" + attr + "' `" +
+              shortString(a->data()) +
+              "' not convertible to the desired type.");
     }
 
     return boost::none;
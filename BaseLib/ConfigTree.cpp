@@ -162,7 +162,7 @@ getConfigSubtreeOptional(std::string const& root) const
 {
     checkUnique(root);
 
-    if (auto subtree = _tree->get_child_optional(root)) {
+    if (auto const* const subtree = findChild(*_tree, root)) {
         markVisited(root, Attr::TAG, false);
         return ConfigTree(*subtree, *this, root);
     }
@@ -188,7 +188,7 @@ void ConfigTree::ignoreConfigParameter(const std::string &param) const
 {
     checkUnique(param);
     // if not found, peek only
-    bool peek_only = _tree->find(param) == _tree->not_found();
+    bool peek_only = findChild(*_tree, param) == nullptr;
     markVisited(param, Attr::TAG, peek_only);
 }
 
@@ -197,8 +197,7 @@ void ConfigTree::ignoreConfigAttribute(const std::string &attr) const
     checkUniqueAttr(attr);
 
     // Exercise: Guess what not! (hint: if not found, peek only)
-    // Btw. (not a hint) _tree->find() does not seem to work here.
-    bool peek_only = !_tree->get_child_optional("<xmlattr>." + attr);
+    bool peek_only = findAttribute(*_tree, attr) == nullptr;
 
     markVisited(attr, Attr::ATTR, peek_only);
 }
@@ -215,6 +214,27 @@ void ConfigTree::ignoreConfigParameterAll(const std::string &param) const
 }
 
 
+ConfigTree::PTree const* ConfigTree::findChild(PTree const& tree,
+                                               std::string const& key)
+{
+    auto const it = tree.find(key);
+    if (it == tree.not_found())
+    {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+ConfigTree::PTree const* ConfigTree::findAttribute(PTree const& tree,
+                                                   std::string const& attr)
+{
+    if (auto const* const attrs = findChild(tree, "<xmlattr>"))
+    {
+        return findChild(*attrs, attr);
+    }
+    return nullptr;
+}
+
 void ConfigTree::error(const std::string& message) const
 {
     _onerror(_filename, _path, message);
@@ -408,7 +428,7 @@ ConfigTree::checkAndInvalidate()
     }
 
     // iterate over attributes
-    if (auto attrs = _tree->get_child_optional("<xmlattr>")) {
+    if (auto const* const attrs = findChild(*_tree, "<xmlattr>")) {
         for (auto const& p : *attrs) {
             markVisitedDecrement(Attr::ATTR, p.first);
         }
@@ -553,6 +553,16 @@ private:
     //! This method only acts as a helper method.
     void warning(std::string const& message) const;
 
+    //! Returns the direct child \c key of \c tree or nullptr if there is
+    //! none.
+    //! Unlike get_child_optional() the key is looked up in the key index of
+    //! the property tree directly, i.e., it is not parsed as a path.
+    static PTree const* findChild(PTree const& tree, std::string const& key);
+
+    //! Returns the XML attribute \c attr of \c tree or nullptr.
+    static PTree const* findAttribute(PTree const& tree,
+                                      std::string const& attr);
+
     //! Checks if \c key complies with the rules [a-z0-9_].
     void checkKeyname(std::string const& key) const;
 
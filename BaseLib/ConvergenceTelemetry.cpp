@@ -0,0 +1,160 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ConvergenceTelemetry.h"
+
+#include <fstream>
+#include <memory>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+#include "Error.h"
+
+using nlohmann::json;
+
+namespace
+{
+struct State
+{
+    std::unique_ptr<std::ofstream> os;
+
+    std::size_t timestep = 0;
+    double t = 0;
+    double dt = 0;
+
+    // Data of the current nonlinear iteration.
+    std::vector<double> residual_norms;
+    std::vector<double> increment_norms;
+    int linear_iterations = 0;
+
+    // Sums over the current timestep.
+    int timestep_iterations = 0;
+    int timestep_linear_iterations = 0;
+};
+
+State& state()
+{
+    static State s;
+    return s;
+}
+
+void writeRecord(json const& record)
+{
+    *state().os << record.dump() << "\n";
+}
+}  // namespace
+
+namespace BaseLib
+{
+namespace ConvergenceTelemetry
+{
+void open(std::string const& file_name)
+{
+    auto os = std::make_unique<std::ofstream>(file_name);
+    if (!*os)
+    {
+        OGS_FATAL("Could not open file '%s' for writing the convergence data.",
+                  file_name.c_str());
+    }
+    state().os = std::move(os);
+}
+
+void close()
+{
+    state().os.reset();
+}
+
+bool isEnabled()
+{
+    return state().os != nullptr;
+}
+
+void beginTimestep(std::size_t const timestep, double const t,
+                   double const dt)
+{
+    auto& s = state();
+    s.timestep = timestep;
+    s.t = t;
+    s.dt = dt;
+    s.timestep_iterations = 0;
+    s.timestep_linear_iterations = 0;
+}
+
+void setResidualNorms(std::vector<double> norms)
+{
+    if (isEnabled())
+    {
+        state().residual_norms = std::move(norms);
+    }
+}
+
+void setIncrementNorms(std::vector<double> norms)
+{
+    if (isEnabled())
+    {
+        state().increment_norms = std::move(norms);
+    }
+}
+
+void addLinearIterations(int const iterations)
+{
+    state().linear_iterations += iterations;
+}
+
+void finishIteration(int const process_id, int const iteration,
+                     double const assembly_time,
+                     double const linear_solver_time, bool const converged)
+{
+    auto& s = state();
+    if (isEnabled())
+    {
+        writeRecord({{"type", "iteration"},
+                     {"timestep", s.timestep},
+                     {"t", s.t},
+                     {"dt", s.dt},
+                     {"process", process_id},
+                     {"iteration", iteration},
+                     {"residual_norms", s.residual_norms},
+                     {"increment_norms", s.increment_norms},
+                     {"linear_iterations", s.linear_iterations},
+                     {"assembly_time", assembly_time},
+                     {"linear_solver_time", linear_solver_time},
+                     {"converged", converged}});
+    }
+
+    ++s.timestep_iterations;
+    s.timestep_linear_iterations += s.linear_iterations;
+    s.residual_norms.clear();
+    s.increment_norms.clear();
+    s.linear_iterations = 0;
+}
+
+void finishTimestep(bool const accepted, double const time)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    auto const& s = state();
+    writeRecord({{"type", "timestep"},
+                 {"timestep", s.timestep},
+                 {"t", s.t},
+                 {"dt", s.dt},
+                 {"iterations", s.timestep_iterations},
+                 {"linear_iterations", s.timestep_linear_iterations},
+                 {"time", time},
+                 {"accepted", accepted}});
+    // Keep the file usable if the simulation is aborted later.
+    s.os->flush();
+}
+}  // namespace ConvergenceTelemetry
+}  // namespace BaseLib
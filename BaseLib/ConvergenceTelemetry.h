@@ -0,0 +1,67 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace BaseLib
+{
+/// Machine-readable record of the convergence of the nonlinear and linear
+/// solvers.
+///
+/// The records are written as JSON lines, i.e., one JSON object per line,
+/// distinguished by their \c "type":
+/// - \c "iteration" for each nonlinear iteration with the timestep, time,
+///   step size, process id, iteration number, the residual and solution
+///   increment norms as computed by the convergence criterion (one per
+///   component or one for the whole vector), the number of linear solver
+///   iterations, the assembly and linear solver times, and whether the
+///   convergence criterion was met;
+/// - \c "timestep" for each finished timestep with its number of nonlinear
+///   and linear iterations, its duration, and whether it was accepted. A
+///   rejected timestep is repeated with the same timestep number.
+///
+/// The recording is inactive unless open() was called; the functions are
+/// called from the main thread only.
+namespace ConvergenceTelemetry
+{
+/// Opens the output file and activates the recording.
+void open(std::string const& file_name);
+
+/// Closes the output file and deactivates the recording.
+void close();
+
+bool isEnabled();
+
+/// Sets the timestep, time, and step size of the subsequent records.
+void beginTimestep(std::size_t const timestep, double const t,
+                   double const dt);
+
+/// Stores the residual norms of the current nonlinear iteration.
+void setResidualNorms(std::vector<double> norms);
+
+/// Stores the solution increment norms of the current nonlinear iteration.
+void setIncrementNorms(std::vector<double> norms);
+
+/// Adds the iterations of a linear solve to the current nonlinear iteration.
+void addLinearIterations(int const iterations);
+
+/// Writes the record of the current nonlinear iteration and starts a new one.
+void finishIteration(int const process_id, int const iteration,
+                     double const assembly_time,
+                     double const linear_solver_time, bool const converged);
+
+/// Writes the record of the current timestep.
+void finishTimestep(bool const accepted, double const time);
+}  // namespace ConvergenceTelemetry
+}  // namespace BaseLib
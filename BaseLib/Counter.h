@@ -10,20 +10,27 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 
 namespace BaseLib
 {
+/// Counts the created objects of type X. Objects may be created concurrently.
 template <typename X>
 struct Counter
 {
-    Counter()
-    {
-        _counter_value++;
-    }
-    static std::size_t _counter_value;
+    Counter() : _counter_id(_counter_value++) {}
+
+    /// A copy is a new object and gets its own id.
+    Counter(Counter const& /*other*/) : Counter() {}
+
+    static std::atomic<std::size_t> _counter_value;
+
+    /// The number of objects of type X created before this one. It is unique
+    /// among all objects of type X.
+    std::size_t const _counter_id;
 };
 
-template <typename X> std::size_t Counter<X>::_counter_value(0);
+template <typename X> std::atomic<std::size_t> Counter<X>::_counter_value(0);
 
 } // end namespace BaseLib
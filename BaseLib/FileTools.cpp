@@ -61,6 +61,24 @@ double swapEndianness(double const& v)
     return b.v;
 }
 
+void writeStringBinary(std::ostream& out, std::string const& str)
+{
+    writeValueBinary(out, static_cast<std::uint64_t>(str.size()));
+    out.write(str.data(), str.size());
+}
+
+std::string readStringBinary(std::istream& in)
+{
+    auto const size = readBinaryValue<std::uint64_t>(in);
+    if (!in)
+    {
+        return {};
+    }
+    std::string str(size, '\0');
+    in.read(&str[0], size);
+    return str;
+}
+
 namespace
 {
 
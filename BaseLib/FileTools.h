@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <fstream>
 #include <string>
 #include <vector>
@@ -70,6 +71,46 @@ T readBinaryValue(std::istream& in)
     return v;
 }
 
+/**
+ * \brief write the size and the contents of a vector as binary into the given
+ * output stream
+ *
+ * The values must be copyable bytewise, e.g., arithmetic types or fixed size
+ * Eigen matrices.
+ *
+ * \param out     output stream, have to be opened in binary mode
+ * \param values  vector of values
+ */
+template <typename T, typename Allocator>
+void writeVectorBinary(std::ostream& out,
+                       std::vector<T, Allocator> const& values)
+{
+    writeValueBinary(out, static_cast<std::uint64_t>(values.size()));
+    out.write(reinterpret_cast<const char*>(values.data()),
+              values.size() * sizeof(T));
+}
+
+/// Reads a vector written by writeVectorBinary() into \c values, which are
+/// resized accordingly.
+template <typename T, typename Allocator>
+void readVectorBinary(std::istream& in, std::vector<T, Allocator>& values)
+{
+    auto const size = readBinaryValue<std::uint64_t>(in);
+    if (!in)
+    {
+        return;
+    }
+    values.resize(size);
+    in.read(reinterpret_cast<char*>(values.data()), size * sizeof(T));
+}
+
+/// Writes the size and the characters of a string as binary into the given
+/// output stream.
+void writeStringBinary(std::ostream& out, std::string const& str);
+
+/// Reads a string written by writeStringBinary().
+std::string readStringBinary(std::istream& in);
+
 template <typename T>
 std::vector<T> readBinaryArray(std::string const& filename, std::size_t const n)
 {
@@ -0,0 +1,109 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TextScanner.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+
+namespace
+{
+bool isSpace(char const c)
+{
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+}  // namespace
+
+namespace BaseLib
+{
+namespace IO
+{
+std::optional<TextScanner> TextScanner::fromFile(std::string const& file_name)
+{
+    std::ifstream in(file_name, std::ios::in | std::ios::binary);
+    if (!in)
+    {
+        return std::nullopt;
+    }
+    in.seekg(0, std::ios::end);
+    auto const size = in.tellg();
+    if (size < 0)
+    {
+        return std::nullopt;
+    }
+    in.seekg(0, std::ios::beg);
+
+    std::string text(static_cast<std::size_t>(size), '\0');
+    if (!in.read(text.data(), size))
+    {
+        return std::nullopt;
+    }
+    return TextScanner{std::move(text)};
+}
+
+std::string_view TextScanner::getLine()
+{
+    if (eof())
+    {
+        return {};
+    }
+    auto line_end = _text.find('\n', _pos);
+    if (line_end == std::string::npos)
+    {
+        line_end = _text.size();
+    }
+    std::string_view line(_text.data() + _pos, line_end - _pos);
+    if (!line.empty() && line.back() == '\r')
+    {
+        line.remove_suffix(1);
+    }
+    _pos = std::min(line_end + 1, _text.size());
+    return line;
+}
+
+void TextScanner::skipWhitespace()
+{
+    while (_pos < _text.size() && isSpace(_text[_pos]))
+    {
+        ++_pos;
+    }
+}
+
+void TextScanner::skipToken()
+{
+    readToken();
+}
+
+std::string_view TextScanner::readToken()
+{
+    skipWhitespace();
+    auto const begin = _pos;
+    while (_pos < _text.size() && !isSpace(_text[_pos]))
+    {
+        ++_pos;
+    }
+    return {_text.data() + begin, _pos - begin};
+}
+
+bool TextScanner::skipPast(std::string_view const pattern)
+{
+    auto const position = std::string_view(_text).find(pattern, _pos);
+    if (position == std::string_view::npos)
+    {
+        _pos = _text.size();
+        return false;
+    }
+    _pos = position + pattern.size();
+    return true;
+}
+
+}  // namespace IO
+}  // namespace BaseLib
@@ -0,0 +1,130 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace BaseLib
+{
+namespace IO
+{
+/// Fast sequential reading of whitespace separated text, e.g. the node and
+/// element blocks of mesh files.
+///
+/// The whole text is kept in memory. Integers are parsed with
+/// std::from_chars and floating point numbers with std::strtod, which avoids
+/// the per value overhead of the formatted stream input and of a
+/// std::stringstream per line.
+class TextScanner
+{
+public:
+    explicit TextScanner(std::string text) : _text(std::move(text)) {}
+
+    /// Reads the whole file with a single read.
+    /// \return std::nullopt if the file could not be read.
+    static std::optional<TextScanner> fromFile(std::string const& file_name);
+
+    /// True if the whole text has been consumed.
+    bool eof() const { return _pos >= _text.size(); }
+
+    /// Returns the rest of the current line without the line break and
+    /// continues at the beginning of the next line. A trailing '\\r' is
+    /// removed.
+    std::string_view getLine();
+
+    /// Skips whitespace including line breaks.
+    void skipWhitespace();
+
+    /// Skips the next whitespace separated token.
+    void skipToken();
+
+    /// Skips whitespace and reads the next whitespace separated token.
+    std::string_view readToken();
+
+    /// Skips whitespace and reads an integral or floating point value.
+    /// \return false if no value of the given type could be parsed. The
+    /// position is not changed then.
+    template <typename T>
+    bool read(T& value)
+    {
+        static_assert(std::is_arithmetic_v<T>);
+        skipWhitespace();
+        char const* const begin = _text.data() + _pos;
+        char const* const end = _text.data() + _text.size();
+        if constexpr (std::is_integral_v<T>)
+        {
+            // Accept a leading '+' like the formatted stream input.
+            char const* const first =
+                (begin != end && *begin == '+') ? begin + 1 : begin;
+            auto const [ptr, ec] = std::from_chars(first, end, value);
+            if (ec != std::errc{})
+            {
+                return false;
+            }
+            _pos = ptr - _text.data();
+        }
+        else
+        {
+            // The text is null terminated, hence strtod stops at its end.
+            char* ptr = nullptr;
+            double const result = std::strtod(begin, &ptr);
+            if (ptr == begin)
+            {
+                return false;
+            }
+            value = static_cast<T>(result);
+            _pos = ptr - _text.data();
+        }
+        return true;
+    }
+
+    /// Reads \c values one after another.
+    /// \return false if any value could not be read.
+    template <typename... Ts>
+    bool read(Ts&... values)
+    {
+        return (read(values) && ...);
+    }
+
+    /// Reads \c n values in the native binary representation, e.g. from the
+    /// binary sections of a file which is read as a whole.
+    /// \return false if the text is too short.
+    template <typename T>
+    bool readBinary(T* const values, std::size_t const n = 1)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (_text.size() - _pos < n * sizeof(T))
+        {
+            return false;
+        }
+        std::memcpy(values, _text.data() + _pos, n * sizeof(T));
+        _pos += n * sizeof(T);
+        return true;
+    }
+
+    /// Continues after the next occurrence of \c pattern.
+    /// \return false if there is no such occurrence. The whole text is
+    /// consumed then.
+    bool skipPast(std::string_view pattern);
+
+private:
+    std::string const _text;
+    std::size_t _pos = 0;
+};
+
+}  // namespace IO
+}  // namespace BaseLib
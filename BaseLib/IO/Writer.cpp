@@ -45,25 +45,30 @@ std::string Writer::writeToString()
 
 int Writer::writeToFile(std::string const& filename)
 {
-    std::string file_content = this->writeToString();
-    if (!file_content.empty())
-    {
-        std::ofstream fileStream;
-        fileStream.open (filename.c_str());
+    // Empty stream and clear error states.
+    _out.str("");
+    _out.clear();
 
-        // check file stream
-        if (!fileStream)
-        {
-            ERR("Could not open file '%s'!", filename.c_str());
-            return 0;
-        }
+    if (!this->write() || _out.tellp() <= 0)
+    {
+        return 0;
+    }
 
-        fileStream << file_content;
+    std::ofstream fileStream;
+    fileStream.open (filename.c_str());
 
-        fileStream.close();
-        return 1;
+    // check file stream
+    if (!fileStream)
+    {
+        ERR("Could not open file '%s'!", filename.c_str());
+        return 0;
     }
-    return 0;
+
+    // Pass the buffer to the file without copying the content into a string.
+    fileStream << _out.rdbuf();
+
+    fileStream.close();
+    return 1;
 }
 
 void Writer::setPrecision(unsigned int precision)
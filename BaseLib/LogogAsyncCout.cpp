@@ -0,0 +1,112 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "LogogAsyncCout.h"
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+std::size_t roundUpToPowerOfTwo(std::size_t const n)
+{
+    std::size_t power = 1;
+    while (power < n)
+    {
+        power *= 2;
+    }
+    return power;
+}
+}  // namespace
+
+namespace BaseLib
+{
+LogogAsyncCout::LogogAsyncCout(std::size_t const capacity)
+    : _messages(roundUpToPowerOfTwo(capacity)),
+      _mask(_messages.size() - 1),
+      _writer(&LogogAsyncCout::write, this)
+{
+}
+
+LogogAsyncCout::~LogogAsyncCout()
+{
+    _stop.store(true, std::memory_order_release);
+    _writer.join();
+}
+
+int LogogAsyncCout::Receive(const logog::Topic& topic)
+{
+    logog::ScopedLock lock(m_MutexReceive);
+    auto const& data = m_pFormatter->Format(topic, *this);
+    if (topic.Level() <= LOGOG_LEVEL_ERROR)
+    {
+        waitUntilWritten();
+        std::cout << static_cast<const LOGOG_CHAR*>(data) << std::flush;
+        return 0;
+    }
+    push(static_cast<const LOGOG_CHAR*>(data));
+    return 0;
+}
+
+int LogogAsyncCout::Output(const LOGOG_STRING& data)
+{
+    push(static_cast<const LOGOG_CHAR*>(data));
+    return 0;
+}
+
+void LogogAsyncCout::push(const LOGOG_CHAR* message)
+{
+    auto const pushed = _pushed.load(std::memory_order_relaxed);
+    while (pushed - _written.load(std::memory_order_acquire) >
+           _mask)  // the buffer is full
+    {
+        std::this_thread::yield();
+    }
+    _messages[pushed & _mask] = message;
+    _pushed.store(pushed + 1, std::memory_order_release);
+}
+
+void LogogAsyncCout::waitUntilWritten() const
+{
+    while (_written.load(std::memory_order_acquire) !=
+           _pushed.load(std::memory_order_relaxed))
+    {
+        std::this_thread::yield();
+    }
+}
+
+void LogogAsyncCout::write()
+{
+    bool flushed = true;
+    while (true)
+    {
+        auto const written = _written.load(std::memory_order_relaxed);
+        if (written == _pushed.load(std::memory_order_acquire))
+        {
+            if (!flushed)
+            {
+                std::cout << std::flush;
+                flushed = true;
+            }
+            // All messages are pushed before the destructor is called.
+            if (_stop.load(std::memory_order_acquire) &&
+                written == _pushed.load(std::memory_order_acquire))
+            {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        std::cout << _messages[written & _mask];
+        flushed = false;
+        _written.store(written + 1, std::memory_order_release);
+    }
+}
+}  // namespace BaseLib
@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+namespace BaseLib
+{
+/// Logog target writing the formatted messages to the standard output in a
+/// background thread, such that the logging thread does not wait for the
+/// output and its flush.
+///
+/// The messages are passed through a ring buffer with a single producer,
+/// logog serialising the calls of Receive(), and the writer thread as single
+/// consumer. The standard output is flushed whenever the buffer runs empty.
+/// Errors and more severe messages are written immediately after all pending
+/// messages, so they are not lost if the program is aborted.
+class LogogAsyncCout final : public logog::Target
+{
+public:
+    /// \param capacity the number of messages in the ring buffer, which is
+    /// rounded up to a power of two.
+    explicit LogogAsyncCout(std::size_t const capacity = 4096);
+
+    /// Writes all pending messages and stops the writer thread.
+    ~LogogAsyncCout() override;
+
+    int Receive(const logog::Topic& topic) override;
+
+    int Output(const LOGOG_STRING& data) override;
+
+private:
+    /// Appends the message to the ring buffer and waits if it is full.
+    void push(const LOGOG_CHAR* message);
+
+    /// Waits until the writer thread has written all pending messages.
+    void waitUntilWritten() const;
+
+    /// Loop of the writer thread.
+    void write();
+
+    std::vector<std::string> _messages;
+    std::size_t const _mask;
+    /// Number of messages appended to the ring buffer.
+    std::atomic<std::size_t> _pushed{0};
+    /// Number of messages written by the writer thread.
+    std::atomic<std::size_t> _written{0};
+    std::atomic<bool> _stop{false};
+    std::thread _writer;
+};
+}  // namespace BaseLib
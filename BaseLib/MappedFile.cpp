@@ -0,0 +1,96 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace BaseLib
+{
+MappedFile::MappedFile(std::string const& file_name)
+{
+#ifdef _WIN32
+    _file = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (_file == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(_file, &size) || size.QuadPart == 0)
+    {
+        return;
+    }
+    _mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mapping == nullptr)
+    {
+        return;
+    }
+    _data = static_cast<char const*>(
+        MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (_data != nullptr)
+    {
+        _size = static_cast<std::size_t>(size.QuadPart);
+    }
+#else
+    int const fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return;
+    }
+    struct stat file_status;
+    if (fstat(fd, &file_status) == 0 && file_status.st_size > 0)
+    {
+        auto const size = static_cast<std::size_t>(file_status.st_size);
+        void* const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            _data = static_cast<char const*>(data);
+            _size = size;
+        }
+    }
+    // The mapping stays valid after closing the file descriptor.
+    close(fd);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+    }
+    if (_mapping != nullptr)
+    {
+        CloseHandle(_mapping);
+    }
+    if (_file != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(_file);
+    }
+#else
+    if (_data != nullptr)
+    {
+        munmap(const_cast<char*>(_data), _size);
+    }
+#endif
+}
+}  // namespace BaseLib
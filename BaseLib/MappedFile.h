@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace BaseLib
+{
+/// Read-only memory mapping of a whole file.
+///
+/// The file contents are paged in by the operating system on first access, so
+/// only the parts actually read occupy memory. If the file can not be opened
+/// or mapped, or if it is empty, data() is a null pointer.
+class MappedFile final
+{
+public:
+    explicit MappedFile(std::string const& file_name);
+
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    char const* data() const { return _data; }
+    std::size_t size() const { return _size; }
+
+private:
+#ifdef _WIN32
+    void* _file;
+    void* _mapping = nullptr;
+#endif
+    char const* _data = nullptr;
+    std::size_t _size = 0;
+};
+}  // namespace BaseLib
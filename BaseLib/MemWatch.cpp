@@ -85,5 +85,24 @@ unsigned long MemWatch::getCodeMemUsage () {
         return _cmem_size;
 }
 
+unsigned long MemWatch::getPeakResMemUsage ()
+{
+#if !defined(_WIN32) && !defined(__APPLE__) && !defined(__MINGW32__)
+        std::ifstream in ("/proc/self/status", std::ios::in);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.compare(0, 6, "VmHWM:") == 0)
+            {
+                std::stringstream str_kib (line.substr(6));
+                unsigned long kib = 0;
+                str_kib >> kib;
+                return kib * 1024;
+            }
+        }
+#endif
+        return 0;
+}
+
 } // end namespace BaseLib
 
@@ -23,6 +23,9 @@ public:
     unsigned long getResMemUsage ();
     unsigned long getShrMemUsage ();
     unsigned long getCodeMemUsage ();
+    /// Returns the peak resident set size of the process (the high-water
+    /// mark), or zero if it is not available on the platform.
+    unsigned long getPeakResMemUsage ();
 
 private:
     unsigned updateMemUsage ();
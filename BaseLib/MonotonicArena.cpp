@@ -0,0 +1,163 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MonotonicArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+/// Alignment of the chunks, one cache line.
+std::size_t const chunk_alignment = 64;
+
+thread_local BaseLib::MonotonicArenaScope* current_scope = nullptr;
+
+/// Stored in front of each object allocated by ArenaAllocated, which must know
+/// on deletion where the object was placed.
+struct AllocationHeader
+{
+    /// Distance of the object from the beginning of the allocation, which is
+    /// also the alignment of the allocation.
+    std::uint32_t offset;
+    std::uint32_t in_arena;
+};
+
+void* allocateObject(std::size_t const size, std::size_t alignment)
+{
+    alignment = std::max({alignment, alignof(std::max_align_t),
+                          sizeof(AllocationHeader)});
+
+    auto* const scope = BaseLib::MonotonicArenaScope::current();
+    char* const allocation =
+        scope != nullptr
+            ? static_cast<char*>(scope->allocate(size + alignment, alignment))
+            : static_cast<char*>(::operator new(
+                  size + alignment, std::align_val_t{alignment}));
+
+    char* const object = allocation + alignment;
+    auto* const header = reinterpret_cast<AllocationHeader*>(object) - 1;
+    header->offset = static_cast<std::uint32_t>(alignment);
+    header->in_arena = scope != nullptr;
+    return object;
+}
+
+void deallocateObject(void* const ptr) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    auto const& header = *(static_cast<AllocationHeader*>(ptr) - 1);
+    if (header.in_arena)
+    {
+        return;
+    }
+    ::operator delete(static_cast<char*>(ptr) - header.offset,
+                      std::align_val_t{header.offset});
+}
+}  // namespace
+
+namespace BaseLib
+{
+MonotonicArena::MonotonicArena(std::size_t const chunk_size)
+    : _chunk_size(std::max<std::size_t>(chunk_size, chunk_alignment))
+{
+}
+
+MonotonicArena::~MonotonicArena()
+{
+    for (auto const& chunk : _chunks)
+    {
+        ::operator delete(chunk.first, std::align_val_t{chunk_alignment});
+    }
+}
+
+std::size_t MonotonicArena::allocatedBytes() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::size_t bytes = 0;
+    for (auto const& chunk : _chunks)
+    {
+        bytes += chunk.second;
+    }
+    return bytes;
+}
+
+char* MonotonicArena::allocateChunk(std::size_t& size)
+{
+    size = std::max(size, _chunk_size);
+    auto* const chunk = static_cast<char*>(
+        ::operator new(size, std::align_val_t{chunk_alignment}));
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _chunks.emplace_back(chunk, size);
+    return chunk;
+}
+
+MonotonicArenaScope::MonotonicArenaScope(MonotonicArena& arena)
+    : _arena(arena), _enclosing_scope(current_scope)
+{
+    current_scope = this;
+}
+
+MonotonicArenaScope::~MonotonicArenaScope()
+{
+    current_scope = _enclosing_scope;
+}
+
+MonotonicArenaScope* MonotonicArenaScope::current()
+{
+    return current_scope;
+}
+
+void* MonotonicArenaScope::allocate(std::size_t const size,
+                                    std::size_t const alignment)
+{
+    auto const aligned = [alignment](char* const p) {
+        auto const address = reinterpret_cast<std::uintptr_t>(p);
+        return p + (alignment - address % alignment) % alignment;
+    };
+
+    if (_begin == nullptr || aligned(_begin) + size > _end)
+    {
+        // The rest of the current chunk is abandoned.
+        std::size_t chunk_size = size + alignment;
+        _begin = _arena.allocateChunk(chunk_size);
+        _end = _begin + chunk_size;
+    }
+
+    char* const p = aligned(_begin);
+    _begin = p + size;
+    return p;
+}
+
+void* ArenaAllocated::operator new(std::size_t const size)
+{
+    return allocateObject(size, alignof(std::max_align_t));
+}
+
+void* ArenaAllocated::operator new(std::size_t const size,
+                                   std::align_val_t const alignment)
+{
+    return allocateObject(size, static_cast<std::size_t>(alignment));
+}
+
+void ArenaAllocated::operator delete(void* const ptr) noexcept
+{
+    deallocateObject(ptr);
+}
+
+void ArenaAllocated::operator delete(
+    void* const ptr, std::align_val_t const /*alignment*/) noexcept
+{
+    deallocateObject(ptr);
+}
+}  // namespace BaseLib
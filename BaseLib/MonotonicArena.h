@@ -0,0 +1,102 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace BaseLib
+{
+/// Memory for many objects of the same lifetime, e.g., the local assemblers of
+/// a process.
+///
+/// The memory is handed out in large chunks to the threads allocating from the
+/// arena through a MonotonicArenaScope. Each thread fills its own chunk, hence
+/// the pages are first touched by the thread using them and objects created
+/// one after the other are contiguous in memory. Nothing is freed before the
+/// arena is destroyed, which releases all chunks at once.
+class MonotonicArena final
+{
+public:
+    explicit MonotonicArena(std::size_t const chunk_size = 1 << 20);
+
+    MonotonicArena(MonotonicArena const&) = delete;
+    MonotonicArena& operator=(MonotonicArena const&) = delete;
+
+    ~MonotonicArena();
+
+    /// Total size of the allocated chunks in bytes.
+    std::size_t allocatedBytes() const;
+
+private:
+    friend class MonotonicArenaScope;
+
+    /// Allocates a new chunk of at least the given size. Thread-safe.
+    char* allocateChunk(std::size_t& size);
+
+    std::size_t const _chunk_size;
+
+    mutable std::mutex _mutex;
+    std::vector<std::pair<char*, std::size_t>> _chunks;
+};
+
+/// Within the lifetime of a scope, the objects of classes derived from
+/// ArenaAllocated, which are created by the thread owning the scope, are
+/// placed in the given arena. Scopes are thread-local and can be nested.
+class MonotonicArenaScope final
+{
+public:
+    explicit MonotonicArenaScope(MonotonicArena& arena);
+
+    MonotonicArenaScope(MonotonicArenaScope const&) = delete;
+    MonotonicArenaScope& operator=(MonotonicArenaScope const&) = delete;
+
+    ~MonotonicArenaScope();
+
+    /// Returns the innermost scope of the current thread or nullptr.
+    static MonotonicArenaScope* current();
+
+    /// The arena of this scope, e.g., for opening scopes in worker threads.
+    MonotonicArena& arena() const { return _arena; }
+
+    void* allocate(std::size_t const size, std::size_t const alignment);
+
+private:
+    MonotonicArena& _arena;
+    MonotonicArenaScope* const _enclosing_scope;
+
+    /// Unused part of the current chunk.
+    char* _begin = nullptr;
+    char* _end = nullptr;
+};
+
+/// Base class providing class-specific allocation functions, which place the
+/// objects in the arena of the current MonotonicArenaScope if there is one and
+/// on the heap otherwise.
+///
+/// Deleting an object placed in an arena only runs its destructor; the memory
+/// is released together with the arena, which therefore must outlive the
+/// object.
+class ArenaAllocated
+{
+public:
+    static void* operator new(std::size_t size);
+    static void* operator new(std::size_t size, std::align_val_t alignment);
+    static void operator delete(void* ptr) noexcept;
+    static void operator delete(void* ptr, std::align_val_t alignment) noexcept;
+
+protected:
+    ~ArenaAllocated() = default;
+};
+}  // namespace BaseLib
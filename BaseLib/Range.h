@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace BaseLib
+{
+//! Wraps a pair of iterators for use as a range in range-based for-loops.
+template<typename Iterator>
+class Range
+{
+public:
+    explicit Range(Iterator begin, Iterator end)
+        : _begin(std::move(begin)), _end(std::move(end))
+    {}
+
+    Iterator begin() const { return _begin; }
+    Iterator end()   const { return _end; }
+    std::size_t size() const { return std::distance(_begin, _end); }
+    bool empty() const { return size() == 0; }
+
+private:
+    Iterator _begin;
+    Iterator _end;
+};
+}  // namespace BaseLib
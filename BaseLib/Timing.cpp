@@ -0,0 +1,289 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "Timing.h"
+
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+#include <nlohmann/json.hpp>
+
+#include "Error.h"
+#include "MemWatch.h"
+
+using nlohmann::json;
+
+namespace
+{
+struct Event
+{
+    BaseLib::Timing::Region const* region;
+    BaseLib::Timing::Clock::time_point begin;
+    BaseLib::Timing::Clock::time_point end;
+    int thread;
+};
+
+/// Time and count of one region within one timestep.
+struct RegionData
+{
+    std::int64_t nanoseconds;
+    std::int64_t count;
+};
+
+struct Timestep
+{
+    std::size_t timestep;
+    std::vector<RegionData> regions;
+    /// Peak resident memory at the end of the timestep.
+    unsigned long peak_resident;
+};
+
+struct MemoryStage
+{
+    std::string stage;
+    unsigned long resident;
+    unsigned long peak_resident;
+};
+
+struct Registry
+{
+    std::mutex mutex;
+    /// A deque keeps the references to the regions valid.
+    std::deque<BaseLib::Timing::Region> regions;
+    std::map<std::string, BaseLib::Timing::Region*> regions_by_name;
+
+    /// Accumulated data of all regions at the end of the previous timestep.
+    std::vector<RegionData> previous_totals;
+    std::vector<Timestep> timesteps;
+
+    std::mutex events_mutex;
+    std::vector<Event> events;
+
+    std::mutex memory_mutex;
+    std::vector<MemoryStage> memory_stages;
+    std::map<std::string, std::int64_t> memory_subsystems;
+
+    BaseLib::Timing::Clock::time_point start_time =
+        BaseLib::Timing::Clock::now();
+};
+
+Registry& registry()
+{
+    static Registry r;
+    return r;
+}
+
+int threadIndex()
+{
+    static std::atomic<int> number_of_threads{0};
+    thread_local int const index = number_of_threads++;
+    return index;
+}
+
+double toSeconds(std::int64_t const nanoseconds)
+{
+    return 1e-9 * static_cast<double>(nanoseconds);
+}
+
+std::int64_t toMicroseconds(BaseLib::Timing::Clock::duration const d)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+}
+
+void writeFile(std::string const& file_name, json const& data)
+{
+    std::ofstream os(file_name);
+    if (!os)
+    {
+        OGS_FATAL("Could not open file '%s' for writing the timing data.",
+                  file_name.c_str());
+    }
+    os << data.dump(2) << "\n";
+}
+}  // namespace
+
+namespace BaseLib
+{
+namespace Timing
+{
+namespace detail
+{
+std::atomic<bool> enabled{false};
+}  // namespace detail
+
+void enable()
+{
+    registry().start_time = Clock::now();
+    detail::enabled = true;
+}
+
+Region& getRegion(std::string const& name, bool const record_events)
+{
+    auto& r = registry();
+    std::lock_guard<std::mutex> const lock(r.mutex);
+
+    auto const it = r.regions_by_name.find(name);
+    if (it != r.regions_by_name.end())
+    {
+        return *it->second;
+    }
+
+    r.regions.emplace_back(name, record_events);
+    r.regions_by_name[name] = &r.regions.back();
+    return r.regions.back();
+}
+
+void recordEvent(Region const& region, Clock::time_point const begin,
+                 Clock::time_point const end)
+{
+    auto const thread = threadIndex();
+    auto& r = registry();
+    std::lock_guard<std::mutex> const lock(r.events_mutex);
+    r.events.push_back({&region, begin, end, thread});
+}
+
+void finishTimestep(std::size_t const timestep)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    auto& r = registry();
+    std::lock_guard<std::mutex> const lock(r.mutex);
+
+    r.previous_totals.resize(r.regions.size(), RegionData{0, 0});
+    Timestep step{timestep, {}, BaseLib::MemWatch().getPeakResMemUsage()};
+    step.regions.reserve(r.regions.size());
+    for (std::size_t i = 0; i < r.regions.size(); ++i)
+    {
+        RegionData const total{r.regions[i].nanoseconds, r.regions[i].count};
+        step.regions.push_back(
+            {total.nanoseconds - r.previous_totals[i].nanoseconds,
+             total.count - r.previous_totals[i].count});
+        r.previous_totals[i] = total;
+    }
+    r.timesteps.push_back(std::move(step));
+}
+
+void recordMemoryStage(std::string const& stage)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    BaseLib::MemWatch mem_watch;
+    MemoryStage memory_stage{stage, mem_watch.getResMemUsage(),
+                             mem_watch.getPeakResMemUsage()};
+    auto& r = registry();
+    std::lock_guard<std::mutex> const lock(r.memory_mutex);
+    r.memory_stages.push_back(std::move(memory_stage));
+}
+
+void addMemory(std::string const& subsystem, std::int64_t const bytes)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    auto& r = registry();
+    std::lock_guard<std::mutex> const lock(r.memory_mutex);
+    r.memory_subsystems[subsystem] += bytes;
+}
+
+void writeJSON(std::string const& file_name, int const rank)
+{
+    auto& r = registry();
+    std::lock_guard<std::mutex> const lock(r.mutex);
+
+    json data;
+    data["rank"] = rank;
+
+    json total = json::object();
+    for (auto const& region : r.regions)
+    {
+        total[region.name] = {{"time", toSeconds(region.nanoseconds)},
+                              {"count", region.count.load()}};
+    }
+    data["total"] = std::move(total);
+
+    json timesteps = json::array();
+    for (auto const& step : r.timesteps)
+    {
+        json regions = json::object();
+        for (std::size_t i = 0; i < step.regions.size(); ++i)
+        {
+            if (step.regions[i].count == 0)
+            {
+                continue;
+            }
+            regions[r.regions[i].name] = {
+                {"time", toSeconds(step.regions[i].nanoseconds)},
+                {"count", step.regions[i].count}};
+        }
+        timesteps.push_back({{"timestep", step.timestep},
+                             {"regions", std::move(regions)},
+                             {"peak_resident_memory", step.peak_resident}});
+    }
+    data["timesteps"] = std::move(timesteps);
+
+    {
+        std::lock_guard<std::mutex> const memory_lock(r.memory_mutex);
+        // The increase is the change of the resident memory since the
+        // previous stage.
+        json stages = json::array();
+        unsigned long previous_resident = 0;
+        for (auto const& stage : r.memory_stages)
+        {
+            stages.push_back(
+                {{"stage", stage.stage},
+                 {"resident", stage.resident},
+                 {"peak_resident", stage.peak_resident},
+                 {"increase", static_cast<std::int64_t>(stage.resident) -
+                                  static_cast<std::int64_t>(previous_resident)}});
+            previous_resident = stage.resident;
+        }
+        data["memory"] = {{"stages", std::move(stages)},
+                          {"subsystems", r.memory_subsystems}};
+    }
+
+    writeFile(file_name, data);
+    INFO("Timing data written to '%s'.", file_name.c_str());
+}
+
+void writeChromeTrace(std::string const& file_name, int const rank)
+{
+    auto& r = registry();
+    std::lock_guard<std::mutex> const lock(r.events_mutex);
+
+    json events = json::array();
+    for (auto const& e : r.events)
+    {
+        events.push_back({{"name", e.region->name},
+                          {"ph", "X"},
+                          {"ts", toMicroseconds(e.begin - r.start_time)},
+                          {"dur", toMicroseconds(e.end - e.begin)},
+                          {"pid", rank},
+                          {"tid", e.thread}});
+    }
+
+    writeFile(file_name, {{"traceEvents", std::move(events)},
+                          {"displayTimeUnit", "ms"}});
+    INFO("Timing trace written to '%s'.", file_name.c_str());
+}
+}  // namespace Timing
+}  // namespace BaseLib
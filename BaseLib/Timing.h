@@ -0,0 +1,139 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace BaseLib
+{
+/// Low-overhead timers of instrumented code regions, and memory accounting of
+/// the setup stages and subsystems.
+///
+/// A region is identified by a hierarchical name with the levels separated by
+/// slashes, e.g., "assembly/local_assembly". The time spent in a region and
+/// the number of its executions are accumulated over the whole run and per
+/// timestep. The timers are inactive unless enabled by enable(); an inactive
+/// timer only reads a flag.
+///
+/// Typical usage:
+/// \code
+/// static auto& region = BaseLib::Timing::getRegion("assembly");
+/// BaseLib::Timing::ScopedTimer const timer{region};
+/// \endcode
+namespace Timing
+{
+using Clock = std::chrono::steady_clock;
+
+/// Accumulated data of an instrumented code region.
+struct Region final
+{
+    Region(std::string name_, bool const record_events_)
+        : name(std::move(name_)), record_events(record_events_)
+    {
+    }
+
+    std::string const name;
+    /// Whether each execution is recorded for the trace output. This should
+    /// be used for coarse regions only, which are executed a few times per
+    /// iteration.
+    bool const record_events;
+
+    std::atomic<std::int64_t> nanoseconds{0};
+    std::atomic<std::int64_t> count{0};
+};
+
+namespace detail
+{
+extern std::atomic<bool> enabled;
+}  // namespace detail
+
+/// Activates all timers.
+void enable();
+
+inline bool isEnabled()
+{
+    return detail::enabled.load(std::memory_order_relaxed);
+}
+
+/// Returns the region of the given name, which is created on the first call.
+/// The reference stays valid until the end of the program; callers should
+/// keep it in a function-local static variable.
+Region& getRegion(std::string const& name, bool const record_events = false);
+
+/// Stores one execution of the \c region for the trace output.
+void recordEvent(Region const& region, Clock::time_point const begin,
+                 Clock::time_point const end);
+
+/// Stores the time spent in each region since the previous call for the
+/// given timestep.
+void finishTimestep(std::size_t const timestep);
+
+/// Records the resident and the peak resident memory of the process after the
+/// named setup stage, e.g. "mesh_read", if the timers are enabled.
+void recordMemoryStage(std::string const& stage);
+
+/// Adds the given number of bytes to the memory accounted to the named
+/// subsystem, e.g. "global_matrix", if the timers are enabled.
+void addMemory(std::string const& subsystem, std::int64_t const bytes);
+
+/// Writes the accumulated and the per-timestep data of all regions and the
+/// memory accounting data.
+void writeJSON(std::string const& file_name, int const rank);
+
+/// Writes the recorded events in the Chrome trace event format, which can be
+/// viewed, e.g., with chrome://tracing. The \c rank is used as process id.
+void writeChromeTrace(std::string const& file_name, int const rank);
+
+/// Measures the time from its construction to its destruction and adds it to
+/// the given region if the timers are enabled.
+class ScopedTimer final
+{
+public:
+    explicit ScopedTimer(Region& region)
+        : _region(isEnabled() ? &region : nullptr)
+    {
+        if (_region != nullptr)
+        {
+            _begin = Clock::now();
+        }
+    }
+
+    ScopedTimer(ScopedTimer const&) = delete;
+    ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+    ~ScopedTimer()
+    {
+        if (_region == nullptr)
+        {
+            return;
+        }
+
+        auto const end = Clock::now();
+        _region->nanoseconds +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - _begin)
+                .count();
+        ++_region->count;
+        if (_region->record_events)
+        {
+            recordEvent(*_region, _begin, end);
+        }
+    }
+
+private:
+    Region* const _region;
+    Clock::time_point _begin;
+};
+}  // namespace Timing
+}  // namespace BaseLib
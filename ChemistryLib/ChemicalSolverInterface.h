@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <iosfwd>
+
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
 
 namespace ChemistryLib
@@ -23,6 +26,21 @@ public:
     virtual void doWaterChemistryCalculation(
         std::vector<GlobalVector*>& process_solutions, double const dt) = 0;
 
+    /// Writes the chemical state not contained in the process solutions for
+    /// a restart from a checkpoint.
+    virtual void writeCheckpoint(std::ostream& /*os*/) const
+    {
+        OGS_FATAL("Checkpoints are not supported by the chemical solver.");
+    }
+
+    /// Restores the state written by writeCheckpoint().
+    virtual void readCheckpoint(std::istream& /*is*/)
+    {
+        OGS_FATAL(
+            "Restart from a checkpoint is not supported by the chemical "
+            "solver.");
+    }
+
     virtual ~ChemicalSolverInterface() = default;
 };
 }  // namespace ChemistryLib
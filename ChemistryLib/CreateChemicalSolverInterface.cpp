@@ -150,13 +150,21 @@ createChemicalSolverInterface<ChemicalSolver::Phreeqc>(
     std::vector<PhreeqcIOData::AqueousSolution> aqueous_solutions(
         num_chemical_systems, aqueous_solution);
 
+    auto const number_of_instances =
+        //! \ogs_file_param{prj__chemical_system__number_of_instances}
+        config.getConfigParameter<std::size_t>("number_of_instances", 1);
+
+    auto const skip_tolerance =
+        //! \ogs_file_param{prj__chemical_system__skip_tolerance}
+        config.getConfigParameter<double>("skip_tolerance", 0.);
+
     return std::make_unique<PhreeqcIOData::PhreeqcIO>(
         std::move(project_file_name), *meshes[mesh.getID()],
         std::move(path_to_database), std::move(aqueous_solutions),
         std::move(equilibrium_phases), std::move(kinetic_reactants),
         std::move(reaction_rates), std::move(surface), std::move(user_punch),
         std::move(output), std::move(dump), std::move(knobs),
-        process_id_to_component_name_map);
+        process_id_to_component_name_map, number_of_instances, skip_tolerance);
 }
 
 template <>
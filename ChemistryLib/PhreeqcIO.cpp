@@ -8,12 +8,16 @@
  *
  */
 
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <cmath>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 
 #include "BaseLib/Algorithm.h"
 #include "BaseLib/ConfigTreeUtil.h"
+#include "BaseLib/FileTools.h"
 #include "MeshLib/Mesh.h"
 #include "PhreeqcIO.h"
 #include "PhreeqcIOData/AqueousSolution.h"
@@ -42,6 +46,33 @@ std::ostream& operator<<(std::ostream& os,
               std::ostream_iterator<DataBlock>(os));
     return os;
 }
+
+/// Copies pH, pe and the component amounts of the aqueous solution to the
+/// values.
+void copyToValues(AqueousSolution const& aqueous_solution, double* values)
+{
+    *values++ = aqueous_solution.pH;
+    *values++ = aqueous_solution.pe;
+    for (auto const& component : aqueous_solution.components)
+    {
+        *values++ = component.amount;
+    }
+}
+
+void copyFromValues(double const* values, AqueousSolution& aqueous_solution)
+{
+    aqueous_solution.pH = *values++;
+    aqueous_solution.pe = *values++;
+    for (auto& component : aqueous_solution.components)
+    {
+        component.amount = *values++;
+    }
+}
+
+std::size_t numberOfValues(AqueousSolution const& aqueous_solution)
+{
+    return 2 + aqueous_solution.components.size();
+}
 }  // namespace
 
 PhreeqcIO::PhreeqcIO(std::string const project_file_name,
@@ -57,7 +88,9 @@ PhreeqcIO::PhreeqcIO(std::string const project_file_name,
                      std::unique_ptr<Dump>&& dump,
                      Knobs&& knobs,
                      std::vector<std::pair<int, std::string>> const&
-                         process_id_to_component_name_map)
+                         process_id_to_component_name_map,
+                     std::size_t const number_of_instances,
+                     double const skip_tolerance)
     : _phreeqc_input_file(project_file_name + "_phreeqc.inp"),
       _mesh(mesh),
       _database(std::move(database)),
@@ -70,38 +103,85 @@ PhreeqcIO::PhreeqcIO(std::string const project_file_name,
       _output(std::move(output)),
       _dump(std::move(dump)),
       _knobs(std::move(knobs)),
-      _process_id_to_component_name_map(process_id_to_component_name_map)
+      _process_id_to_component_name_map(process_id_to_component_name_map),
+      _skip_tolerance(skip_tolerance)
 {
-    // initialize phreeqc instance
-    if (CreateIPhreeqc() != phreeqc_instance_id)
+    // The chemical systems are split into contiguous ranges of nearly equal
+    // sizes, one for each phreeqc instance.
+    std::size_t const num_chemical_systems = _mesh.getNumberOfBaseNodes();
+    std::size_t const num_instances = std::max<std::size_t>(
+        1, std::min(number_of_instances, num_chemical_systems));
+    if (_dump && num_instances > 1)
     {
         OGS_FATAL(
-            "Failed to initialize phreeqc instance, due to lack of memory.");
+            "Multiple phreeqc instances are not supported together with "
+            "surface reactions, which require a phreeqc dump file.");
     }
-
-    // load specified thermodynamic database
-    if (LoadDatabase(phreeqc_instance_id, _database.c_str()) != IPQ_OK)
+    if (_dump && _skip_tolerance > 0)
     {
         OGS_FATAL(
-            "Failed in loading the specified thermodynamic database file: "
-            "%s.",
-            _database.c_str());
+            "Skipping unchanged chemical systems is not supported together "
+            "with surface reactions, which require a phreeqc dump file.");
     }
+    for (std::size_t i = 0; i <= num_instances; ++i)
+    {
+        _chemical_system_offsets.push_back(i * num_chemical_systems /
+                                           num_instances);
+    }
+    _phreeqc_inputs.resize(num_instances);
+    _computed_chemical_systems.resize(num_instances);
 
-    if (SetSelectedOutputFileOn(phreeqc_instance_id, 1) != IPQ_OK)
+    for (std::size_t i = 0; i < num_instances; ++i)
     {
-        OGS_FATAL(
-            "Failed to fly the flag for the specified file %s where phreeqc "
-            "will write output.",
-            _output->basic_output_setups.output_file.c_str());
+        // initialize phreeqc instance
+        int const phreeqc_instance_id = CreateIPhreeqc();
+        if (phreeqc_instance_id < 0)
+        {
+            OGS_FATAL(
+                "Failed to initialize phreeqc instance, due to lack of "
+                "memory.");
+        }
+        _phreeqc_instance_ids.push_back(phreeqc_instance_id);
+
+        // load specified thermodynamic database
+        if (LoadDatabase(phreeqc_instance_id, _database.c_str()) != IPQ_OK)
+        {
+            OGS_FATAL(
+                "Failed in loading the specified thermodynamic database file: "
+                "%s.",
+                _database.c_str());
+        }
+
+        // The selected output is kept in memory instead of being written to
+        // the file.
+        if (SetSelectedOutputFileOn(phreeqc_instance_id, 0) != IPQ_OK ||
+            SetSelectedOutputStringOn(phreeqc_instance_id, 1) != IPQ_OK)
+        {
+            OGS_FATAL(
+                "Failed to fly the flag for keeping the phreeqc selected "
+                "output in memory.");
+        }
+
+        if (_dump)
+        {
+            // Chemical composition of the aqueous solution of last time step
+            // will be written into .dmp file once the second function argument
+            // is set to one.
+            SetDumpFileOn(phreeqc_instance_id, 1);
+        }
+    }
+    if (num_instances > 1)
+    {
+        INFO("Solving %d chemical systems with %d phreeqc instances.",
+             num_chemical_systems, num_instances);
     }
+}
 
-    if (_dump)
+PhreeqcIO::~PhreeqcIO()
+{
+    for (int const phreeqc_instance_id : _phreeqc_instance_ids)
     {
-        // Chemical composition of the aqueous solution of last time step will
-        // be written into .dmp file once the second function argument is set to
-        // one.
-        SetDumpFileOn(phreeqc_instance_id, 1);
+        DestroyIPhreeqc(phreeqc_instance_id);
     }
 }
 
@@ -111,11 +191,15 @@ void PhreeqcIO::executeInitialCalculation(
     setAqueousSolutionsOrUpdateProcessSolutions(
         process_solutions, Status::SettingAqueousSolutions);
 
-    writeInputsToFile();
+    selectChemicalSystems();
+
+    writeInputsToString();
 
     execute();
 
-    readOutputsFromFile();
+    readOutputsFromString();
+
+    storeResultsOfComputedChemicalSystems();
 
     setAqueousSolutionsOrUpdateProcessSolutions(
         process_solutions, Status::UpdatingProcessSolutions);
@@ -129,16 +213,112 @@ void PhreeqcIO::doWaterChemistryCalculation(
 
     setAqueousSolutionsPrevFromDumpFile();
 
-    writeInputsToFile(dt);
+    selectChemicalSystems();
+
+    writeInputsToString(dt);
 
     execute();
 
-    readOutputsFromFile();
+    readOutputsFromString();
+
+    storeResultsOfComputedChemicalSystems();
 
     setAqueousSolutionsOrUpdateProcessSolutions(
         process_solutions, Status::UpdatingProcessSolutions);
 }
 
+void PhreeqcIO::selectChemicalSystems()
+{
+    std::size_t const num_chemical_systems = _aqueous_solutions.size();
+    bool const skip_unchanged =
+        _skip_tolerance > 0 && !_last_computed_inputs.empty();
+    std::size_t const n_values =
+        num_chemical_systems == 0 ? 0
+                                  : numberOfValues(_aqueous_solutions.front());
+    std::vector<double> inputs(n_values);
+
+    std::size_t num_skipped = 0;
+    for (std::size_t i = 0; i < _phreeqc_instance_ids.size(); ++i)
+    {
+        auto& computed = _computed_chemical_systems[i];
+        computed.clear();
+        for (std::size_t local_id = _chemical_system_offsets[i];
+             local_id < _chemical_system_offsets[i + 1];
+             ++local_id)
+        {
+            auto& aqueous_solution = _aqueous_solutions[local_id];
+            if (!skip_unchanged)
+            {
+                computed.push_back(local_id);
+                continue;
+            }
+
+            copyToValues(aqueous_solution, inputs.data());
+            double const* const last_inputs =
+                &_last_computed_inputs[local_id * n_values];
+            bool const unchanged = std::equal(
+                inputs.begin(), inputs.end(), last_inputs,
+                [this](double const value, double const last_value) {
+                    return std::abs(value - last_value) <=
+                           _skip_tolerance *
+                               std::max(std::abs(value), std::abs(last_value));
+                });
+            if (!unchanged)
+            {
+                computed.push_back(local_id);
+                continue;
+            }
+
+            copyFromValues(&_last_computed_results[local_id * n_values],
+                           aqueous_solution);
+            ++num_skipped;
+        }
+    }
+
+    if (_skip_tolerance > 0)
+    {
+        INFO("Phreeqc: Skipping %d of %d unchanged chemical systems.",
+             num_skipped, num_chemical_systems);
+    }
+
+    // Only the inputs of the computed systems change their last computed
+    // state.
+    if (_skip_tolerance > 0)
+    {
+        _last_computed_inputs.resize(num_chemical_systems * n_values);
+        for (auto const& computed : _computed_chemical_systems)
+        {
+            for (auto const local_id : computed)
+            {
+                copyToValues(_aqueous_solutions[local_id],
+                             &_last_computed_inputs[local_id * n_values]);
+            }
+        }
+    }
+}
+
+void PhreeqcIO::storeResultsOfComputedChemicalSystems()
+{
+    if (_skip_tolerance <= 0)
+    {
+        return;
+    }
+
+    std::size_t const num_chemical_systems = _aqueous_solutions.size();
+    std::size_t const n_values =
+        num_chemical_systems == 0 ? 0
+                                  : numberOfValues(_aqueous_solutions.front());
+    _last_computed_results.resize(num_chemical_systems * n_values);
+    for (auto const& computed : _computed_chemical_systems)
+    {
+        for (auto const local_id : computed)
+        {
+            copyToValues(_aqueous_solutions[local_id],
+                         &_last_computed_results[local_id * n_values]);
+        }
+    }
+}
+
 void PhreeqcIO::setAqueousSolutionsOrUpdateProcessSolutions(
     std::vector<GlobalVector*> const& process_solutions, Status const status)
 {
@@ -218,6 +398,99 @@ void PhreeqcIO::setAqueousSolutionsOrUpdateProcessSolutions(
     }
 }
 
+void PhreeqcIO::writeCheckpoint(std::ostream& os) const
+{
+    for (auto const& aqueous_solution : _aqueous_solutions)
+    {
+        BaseLib::writeValueBinary(os, aqueous_solution.pH);
+        BaseLib::writeValueBinary(os, aqueous_solution.pe);
+        for (auto const& component : aqueous_solution.components)
+        {
+            BaseLib::writeValueBinary(os, component.amount);
+        }
+    }
+
+    for (auto const& equilibrium_phase : _equilibrium_phases)
+    {
+        BaseLib::writeVectorBinary(os, *equilibrium_phase.amount);
+    }
+
+    for (auto const& kinetic_reactant : _kinetic_reactants)
+    {
+        BaseLib::writeVectorBinary(os, *kinetic_reactant.amount);
+    }
+
+    // The aqueous solutions of the last timestep are read by phreeqc from the
+    // dump file.
+    std::string dump_file_contents;
+    if (_dump)
+    {
+        std::ifstream in(_dump->dump_file);
+        if (!in)
+        {
+            OGS_FATAL("Could not open phreeqc dump file '%s'.",
+                      _dump->dump_file.c_str());
+        }
+        std::ostringstream contents;
+        contents << in.rdbuf();
+        dump_file_contents = contents.str();
+    }
+    BaseLib::writeStringBinary(os, dump_file_contents);
+}
+
+void PhreeqcIO::readCheckpoint(std::istream& is)
+{
+    // All chemical systems are computed in the first calculation after the
+    // restart.
+    _last_computed_inputs.clear();
+    _last_computed_results.clear();
+
+    for (auto& aqueous_solution : _aqueous_solutions)
+    {
+        aqueous_solution.pH = BaseLib::readBinaryValue<double>(is);
+        aqueous_solution.pe = BaseLib::readBinaryValue<double>(is);
+        for (auto& component : aqueous_solution.components)
+        {
+            component.amount = BaseLib::readBinaryValue<double>(is);
+        }
+    }
+
+    auto read_amounts = [&is](MeshLib::PropertyVector<double>& amount,
+                              std::string const& name) {
+        auto const size = amount.size();
+        BaseLib::readVectorBinary(is, amount);
+        if (!is || amount.size() != size)
+        {
+            OGS_FATAL(
+                "The amounts of '%s' in the checkpoint do not match the "
+                "mesh.",
+                name.c_str());
+        }
+    };
+
+    for (auto& equilibrium_phase : _equilibrium_phases)
+    {
+        read_amounts(*equilibrium_phase.amount, equilibrium_phase.name);
+    }
+
+    for (auto& kinetic_reactant : _kinetic_reactants)
+    {
+        read_amounts(*kinetic_reactant.amount, kinetic_reactant.name);
+    }
+
+    auto const dump_file_contents = BaseLib::readStringBinary(is);
+    if (_dump)
+    {
+        std::ofstream out(_dump->dump_file);
+        if (!out)
+        {
+            OGS_FATAL("Could not open phreeqc dump file '%s' for writing.",
+                      _dump->dump_file.c_str());
+        }
+        out << dump_file_contents;
+    }
+}
+
 void PhreeqcIO::setAqueousSolutionsPrevFromDumpFile()
 {
     if (!_dump)
@@ -244,30 +517,26 @@ void PhreeqcIO::setAqueousSolutionsPrevFromDumpFile()
     in.close();
 }
 
-void PhreeqcIO::writeInputsToFile(double const dt)
+void PhreeqcIO::writeInputsToString(double const dt)
 {
-    DBUG("Writing phreeqc inputs into file '%s'.", _phreeqc_input_file.c_str());
-    std::ofstream out(_phreeqc_input_file, std::ofstream::out);
-
-    if (!out)
-    {
-        OGS_FATAL("Could not open file '%s' for writing phreeqc inputs.",
-                  _phreeqc_input_file.c_str());
-    }
-
-    out << (*this << dt);
+    DBUG("Writing phreeqc inputs.");
+    _dt = dt;
 
-    if (!out)
+    auto const num_instances =
+        static_cast<std::ptrdiff_t>(_phreeqc_instance_ids.size());
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < num_instances; ++i)
     {
-        OGS_FATAL("Failed in generating phreeqc input file '%s'.",
-                  _phreeqc_input_file.c_str());
+        std::ostringstream out;
+        writeInputs(out, _computed_chemical_systems[i]);
+        _phreeqc_inputs[i] = out.str();
     }
-
-    out.close();
 }
 
-std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
+void PhreeqcIO::writeInputs(std::ostream& os,
+                            std::vector<std::size_t> const& local_ids) const
 {
+    auto const& phreeqc_io = *this;
     os << phreeqc_io._knobs << "\n";
 
     os << *phreeqc_io._output << "\n";
@@ -293,7 +562,7 @@ std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
              .template getPropertyVector<std::size_t>(
                  "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
 
-    for (std::size_t local_id = 0; local_id < num_chemical_systems; ++local_id)
+    for (auto const local_id : local_ids)
     {
         auto const global_id = chemical_system_map[local_id];
         auto const& aqueous_solution =
@@ -356,55 +625,76 @@ std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
         os << "END" << "\n\n";
     }
 
+    // There is only one phreeqc instance if the dump file is used.
     auto const& dump = phreeqc_io._dump;
     if (dump)
     {
         dump->print(os, num_chemical_systems);
     }
-
-    return os;
 }
 
 void PhreeqcIO::execute()
 {
     INFO("Phreeqc: Executing chemical calculation.");
-    if (RunFile(phreeqc_instance_id, _phreeqc_input_file.c_str()) != IPQ_OK)
+
+    // The phreeqc instances are independent of each other.
+    auto const num_instances =
+        static_cast<std::ptrdiff_t>(_phreeqc_instance_ids.size());
+    std::ptrdiff_t failed_instance = -1;
+#pragma omp parallel for schedule(dynamic, 1)
+    for (std::ptrdiff_t i = 0; i < num_instances; ++i)
     {
-        OutputErrorString(phreeqc_instance_id);
+        if (_computed_chemical_systems[i].empty())
+        {
+            continue;
+        }
+        if (RunString(_phreeqc_instance_ids[i], _phreeqc_inputs[i].c_str()) !=
+            IPQ_OK)
+        {
+#pragma omp critical(ogs_phreeqc_io_failed_instance)
+            failed_instance = i;
+        }
+    }
+
+    if (failed_instance >= 0)
+    {
+        OutputErrorString(_phreeqc_instance_ids[failed_instance]);
+
+        // Keep the failed input for the inspection.
+        std::ofstream out(_phreeqc_input_file, std::ofstream::out);
+        out << _phreeqc_inputs[failed_instance];
         OGS_FATAL(
             "Failed in performing speciation calculation with the generated "
-            "phreeqc input file '%s'.",
+            "phreeqc input, which has been written to the file '%s'.",
             _phreeqc_input_file.c_str());
     }
 }
 
-void PhreeqcIO::readOutputsFromFile()
+void PhreeqcIO::readOutputsFromString()
 {
-    auto const& basic_output_setups = _output->basic_output_setups;
-    auto const& phreeqc_result_file = basic_output_setups.output_file;
-    DBUG("Reading phreeqc results from file '%s'.",
-         phreeqc_result_file.c_str());
-    std::ifstream in(phreeqc_result_file);
-
-    if (!in)
+    DBUG("Reading phreeqc results.");
+    for (std::size_t i = 0; i < _phreeqc_instance_ids.size(); ++i)
     {
-        OGS_FATAL("Could not open phreeqc result file '%s'.",
-                  phreeqc_result_file.c_str());
-    }
+        if (_computed_chemical_systems[i].empty())
+        {
+            continue;
+        }
+        std::istringstream in(
+            GetSelectedOutputString(_phreeqc_instance_ids[i]));
 
-    in >> *this;
+        readOutputs(in, _computed_chemical_systems[i]);
 
-    if (!in)
-    {
-        OGS_FATAL("Error when reading phreeqc result file '%s'",
-                  phreeqc_result_file.c_str());
+        if (!in)
+        {
+            OGS_FATAL("Error when reading phreeqc results.");
+        }
     }
-
-    in.close();
 }
 
-std::istream& operator>>(std::istream& in, PhreeqcIO& phreeqc_io)
+void PhreeqcIO::readOutputs(std::istream& in,
+                            std::vector<std::size_t> const& local_ids)
 {
+    auto& phreeqc_io = *this;
     // Skip the headline
     in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
@@ -415,15 +705,12 @@ std::istream& operator>>(std::istream& in, PhreeqcIO& phreeqc_io)
     auto const& surface = phreeqc_io._surface;
     int const num_skipped_lines = surface.empty() ? 1 : 2;
 
-    std::size_t const num_chemical_systems =
-        phreeqc_io._mesh.getNumberOfBaseNodes();
-
     auto const chemical_system_map =
         *phreeqc_io._mesh.getProperties()
              .template getPropertyVector<std::size_t>(
                  "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
 
-    for (std::size_t local_id = 0; local_id < num_chemical_systems; ++local_id)
+    for (auto const local_id : local_ids)
     {
         auto const global_id = chemical_system_map[local_id];
         // Skip equilibrium calculation result of initial solution
@@ -557,8 +844,6 @@ std::istream& operator>>(std::istream& in, PhreeqcIO& phreeqc_io)
             }
         }
     }
-
-    return in;
 }
 }  // namespace PhreeqcIOData
 }  // namespace ChemistryLib
@@ -11,6 +11,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "ChemicalSolverInterface.h"
 #include "PhreeqcIOData/Knobs.h"
@@ -55,7 +57,11 @@ public:
               std::unique_ptr<Dump>&& dump,
               Knobs&& knobs,
               std::vector<std::pair<int, std::string>> const&
-                  process_id_to_component_name_map);
+                  process_id_to_component_name_map,
+              std::size_t const number_of_instances,
+              double const skip_tolerance);
+
+    ~PhreeqcIO() override;
 
     void executeInitialCalculation(
         std::vector<GlobalVector*>& process_solutions) override;
@@ -64,34 +70,49 @@ public:
         std::vector<GlobalVector*>& process_solutions,
         double const dt) override;
 
+    void writeCheckpoint(std::ostream& os) const override;
+
+    void readCheckpoint(std::istream& is) override;
+
     void setAqueousSolutionsOrUpdateProcessSolutions(
         std::vector<GlobalVector*> const& process_solutions,
         Status const status);
 
-    void writeInputsToFile(double const dt = 0);
+    void writeInputsToString(double const dt = 0);
 
     void execute();
 
-    void readOutputsFromFile();
-
-    friend std::ostream& operator<<(std::ostream& os,
-                                    PhreeqcIO const& phreeqc_io);
-
-    friend std::istream& operator>>(std::istream& in, PhreeqcIO& phreeqc_io);
+    void readOutputsFromString();
 
+    /// The input is written to this file only if the calculation fails.
     std::string const _phreeqc_input_file;
 
 private:
-    PhreeqcIO& operator<<(double const dt)
-    {
-        _dt = dt;
-        return *this;
-    }
+    /// Writes the phreeqc input for the chemical systems with the given local
+    /// ids.
+    void writeInputs(std::ostream& os,
+                     std::vector<std::size_t> const& local_ids) const;
+
+    /// Reads the selected output of the chemical systems with the given local
+    /// ids.
+    void readOutputs(std::istream& in,
+                     std::vector<std::size_t> const& local_ids);
+
+    /// Selects the chemical systems to be computed by each phreeqc instance.
+    /// The systems whose inputs changed less than the skip tolerance since
+    /// their last computation get their last results instead.
+    void selectChemicalSystems();
+
+    /// Stores the results of the computed chemical systems for skipping them
+    /// later.
+    void storeResultsOfComputedChemicalSystems();
 
     void setAqueousSolutionsPrevFromDumpFile();
 
     MeshLib::Mesh const& _mesh;
     std::string const _database;
+    /// Phreeqc inputs of the current calculation, one per phreeqc instance.
+    std::vector<std::string> _phreeqc_inputs;
     std::vector<AqueousSolution> _aqueous_solutions;
     std::vector<EquilibriumPhase> _equilibrium_phases;
     std::vector<KineticReactant> _kinetic_reactants;
@@ -104,7 +125,22 @@ private:
     std::vector<std::pair<int, std::string>> const&
         _process_id_to_component_name_map;
     double _dt = std::numeric_limits<double>::quiet_NaN();
-    const int phreeqc_instance_id = 0;
+    /// Independent phreeqc instances each solving the contiguous range of
+    /// chemical systems with the local ids _chemical_system_offsets[i] to
+    /// _chemical_system_offsets[i+1]-1.
+    std::vector<int> _phreeqc_instance_ids;
+    std::vector<std::size_t> _chemical_system_offsets;
+    /// Local ids of the chemical systems computed in the current calculation
+    /// by each phreeqc instance.
+    std::vector<std::vector<std::size_t>> _computed_chemical_systems;
+
+    /// Relative tolerance of the input changes below which a chemical system
+    /// is not computed again. Zero disables the skipping.
+    double const _skip_tolerance;
+    /// pH, pe and component amounts of each chemical system when it was last
+    /// computed, before and after the computation.
+    std::vector<double> _last_computed_inputs;
+    std::vector<double> _last_computed_results;
 };
 }  // namespace PhreeqcIOData
 }  // namespace ChemistryLib
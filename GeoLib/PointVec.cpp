@@ -12,7 +12,12 @@
  *
  */
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <numeric>
+#include <tuple>
 
 #include <logog/include/logog.hpp>
 
@@ -20,6 +25,89 @@
 
 #include "MathLib/MathTools.h"
 
+namespace
+{
+/// Returns for each point the position of the first preceding point that is
+/// not a duplicate itself and lies within the distance \c eps, or the
+/// point's own position if there is none. This is the result of inserting the
+/// points one after the other into an oct tree.
+///
+/// The points are sorted by the cells of a grid with the cell size \c eps,
+/// so only the points of the neighbouring cells have to be compared. An empty
+/// vector is returned if the cell indices do not fit into integers.
+std::vector<std::size_t> findFirstPointsInRange(
+    std::vector<GeoLib::Point*> const& pnts, MathLib::Point3d const& min,
+    MathLib::Point3d const& max, double const eps)
+{
+    using CellIndex = std::array<std::int64_t, 3>;
+    for (int d = 0; d < 3; ++d)
+    {
+        if ((max[d] - min[d]) / eps >= std::ldexp(1.0, 62))
+        {
+            return {};
+        }
+    }
+
+    auto const n = static_cast<std::ptrdiff_t>(pnts.size());
+    std::vector<CellIndex> cells(n);
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < n; ++k)
+    {
+        for (int d = 0; d < 3; ++d)
+        {
+            cells[k][d] = static_cast<std::int64_t>(
+                std::floor(((*pnts[k])[d] - min[d]) / eps));
+        }
+    }
+
+    // Within a cell the points remain in the input order.
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&cells](std::size_t const a, std::size_t const b) {
+                  return std::tie(cells[a], a) < std::tie(cells[b], b);
+              });
+    std::vector<CellIndex> sorted_cells(n);
+    std::transform(order.begin(), order.end(), sorted_cells.begin(),
+                   [&cells](std::size_t const k) { return cells[k]; });
+
+    std::vector<std::size_t> first_points(n);
+    for (std::ptrdiff_t k = 0; k < n; ++k)
+    {
+        std::size_t first = k;
+        for (std::int64_t i = -1; i <= 1; ++i)
+        {
+            for (std::int64_t j = -1; j <= 1; ++j)
+            {
+                for (std::int64_t l = -1; l <= 1; ++l)
+                {
+                    CellIndex const cell{
+                        {cells[k][0] + i, cells[k][1] + j, cells[k][2] + l}};
+                    auto const range = std::equal_range(
+                        sorted_cells.begin(), sorted_cells.end(), cell);
+                    for (auto it = range.first; it != range.second; ++it)
+                    {
+                        std::size_t const m = order[it - sorted_cells.begin()];
+                        if (m >= first)
+                        {
+                            break;
+                        }
+                        if (first_points[m] == m &&
+                            MathLib::sqrDist(*pnts[m], *pnts[k]) <= eps * eps)
+                        {
+                            first = m;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        first_points[k] = first;
+    }
+    return first_points;
+}
+}  // namespace
+
 namespace GeoLib
 {
 PointVec::PointVec(
@@ -30,9 +118,7 @@ PointVec::PointVec(
       _type(type),
       _aabb(_data_vec->begin(), _data_vec->end()),
       _rel_eps(rel_eps * std::sqrt(MathLib::sqrDist(_aabb.getMinPoint(),
-                                                    _aabb.getMaxPoint()))),
-      _oct_tree(OctTree<GeoLib::Point, 16>::createOctTree(
-          _aabb.getMinPoint(), _aabb.getMaxPoint(), _rel_eps))
+                                                    _aabb.getMaxPoint())))
 {
     assert(_data_vec);
     std::size_t const number_of_all_input_pnts(_data_vec->size());
@@ -46,63 +132,44 @@ PointVec::PointVec(
         }
     }
 
-    std::vector<std::size_t> rm_pos;
-    // add all points in the oct tree in order to make them unique
-    _pnt_id_map.resize(number_of_all_input_pnts);
-    std::iota(_pnt_id_map.begin(), _pnt_id_map.end(), 0);
-    GeoLib::Point* ret_pnt(nullptr);
-    for (std::size_t k(0); k < _data_vec->size(); ++k)
+    // make the points unique, the same epsilon is used by the oct tree
+    double const eps =
+        (_rel_eps == 0.0) ? std::numeric_limits<double>::epsilon() : _rel_eps;
+    std::vector<std::size_t> first_points = findFirstPointsInRange(
+        *_data_vec, _aabb.getMinPoint(), _aabb.getMaxPoint(), eps);
+    if (first_points.empty())
     {
-        GeoLib::Point* const pnt((*_data_vec)[k]);
-        if (!_oct_tree->addPoint(pnt, ret_pnt))
-        {
-            assert(ret_pnt != nullptr);
-            _pnt_id_map[pnt->getID()] = ret_pnt->getID();
-            rm_pos.push_back(k);
-            delete (*_data_vec)[k];
-            (*_data_vec)[k] = nullptr;
-        }
-        else
+        // the grid would be too fine, insert the points into the oct tree
+        _oct_tree.reset(OctTree<GeoLib::Point, 16>::createOctTree(
+            _aabb.getMinPoint(), _aabb.getMaxPoint(), _rel_eps));
+        first_points.resize(number_of_all_input_pnts);
+        GeoLib::Point* ret_pnt(nullptr);
+        for (std::size_t k(0); k < _data_vec->size(); ++k)
         {
-            _pnt_id_map[k] = pnt->getID();
+            first_points[k] = _oct_tree->addPoint((*_data_vec)[k], ret_pnt)
+                                  ? k
+                                  : ret_pnt->getID();
         }
     }
 
-    auto const data_vec_end =
-        std::remove(_data_vec->begin(), _data_vec->end(), nullptr);
-    _data_vec->erase(data_vec_end, _data_vec->end());
-
-    // decrement the ids according to the number of removed points (==k) before
-    // the j-th point (positions of removed points are stored in the vector
-    // rm_pos)
-    for (std::size_t k(1); k < rm_pos.size(); ++k)
-    {
-        // decrement the ids in the interval [rm_pos[k-1]+1, rm_pos[k])
-        for (std::size_t j(rm_pos[k - 1] + 1); j < rm_pos[k]; ++j)
-        {
-            _pnt_id_map[j] -= k;
-        }
-    }
-    // decrement the ids from rm_pos.back()+1 until the end of _pnt_id_map
-    if (!rm_pos.empty())
+    // remove the duplicates and map each point to the position of its first
+    // occurrence in the compacted vector
+    _pnt_id_map.resize(number_of_all_input_pnts);
+    std::size_t number_of_unique_pnts(0);
+    for (std::size_t k(0); k < number_of_all_input_pnts; ++k)
     {
-        for (std::size_t j(rm_pos.back() + 1); j < _pnt_id_map.size(); ++j)
+        if (first_points[k] == k)
         {
-            _pnt_id_map[j] -= rm_pos.size();
+            _pnt_id_map[k] = number_of_unique_pnts;
+            (*_data_vec)[number_of_unique_pnts++] = (*_data_vec)[k];
         }
-    }
-    // decrement the ids within the _pnt_id_map at positions of the removed
-    // points
-    for (std::size_t k(1); k < rm_pos.size(); ++k)
-    {
-        std::size_t cnt(0);
-        for (cnt = 0;
-             cnt < rm_pos.size() && _pnt_id_map[rm_pos[k]] > rm_pos[cnt];)
+        else
         {
-            cnt++;
+            _pnt_id_map[k] = _pnt_id_map[first_points[k]];
+            delete (*_data_vec)[k];
         }
-        _pnt_id_map[rm_pos[k]] -= cnt;
     }
+    _data_vec->resize(number_of_unique_pnts);
 
     // set value of the point id to the position of the point within _data_vec
     for (std::size_t k(0); k < _data_vec->size(); ++k)
@@ -162,6 +229,11 @@ void PointVec::push_back(Point* pnt, std::string const* const name)
 
 std::size_t PointVec::uniqueInsert(Point* pnt)
 {
+    if (!_oct_tree)
+    {
+        createOctTree();
+    }
+
     GeoLib::Point* ret_pnt(nullptr);
     if (_oct_tree->addPoint(pnt, ret_pnt))
     {
@@ -178,14 +250,7 @@ std::size_t PointVec::uniqueInsert(Point* pnt)
         // update the axis aligned bounding box
         _aabb.update(*pnt);
         // recreate the (enlarged) OctTree
-        _oct_tree.reset(GeoLib::OctTree<GeoLib::Point, 16>::createOctTree(
-            _aabb.getMinPoint(), _aabb.getMaxPoint(), _rel_eps));
-        // add all points that are already in the _data_vec
-        for (std::size_t k(0); k < _data_vec->size(); ++k)
-        {
-            GeoLib::Point* const p((*_data_vec)[k]);
-            _oct_tree->addPoint(p, ret_pnt);
-        }
+        createOctTree();
         // add the new point
         ret_pnt = nullptr;
         _oct_tree->addPoint(pnt, ret_pnt);
@@ -265,6 +330,12 @@ void PointVec::resetInternalDataStructures()
     _rel_eps = rel_eps * std::sqrt(MathLib::sqrDist(_aabb.getMinPoint(),
                                                     _aabb.getMaxPoint()));
 
+    // the oct tree is recreated on the next insertion
+    _oct_tree.reset();
+}
+
+void PointVec::createOctTree()
+{
     _oct_tree.reset(OctTree<GeoLib::Point, 16>::createOctTree(
         _aabb.getMinPoint(), _aabb.getMaxPoint(), _rel_eps));
 
@@ -139,6 +139,10 @@ private:
 	 */
     std::size_t uniqueInsert (Point* pnt);
 
+    /// Creates the oct tree from the axis aligned bounding box and inserts
+    /// all points.
+    void createOctTree();
+
     /** the type of the point (\sa enum PointType) */
     PointType _type;
 
@@ -154,6 +158,8 @@ private:
 
     AABB _aabb;
     double _rel_eps;
+    /// The oct tree used for the insertion of single points, which is created
+    /// on the first insertion.
     std::unique_ptr<GeoLib::OctTree<GeoLib::Point, 16>> _oct_tree;
 };
 }  // namespace GeoLib
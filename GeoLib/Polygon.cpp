@@ -14,6 +14,12 @@
 
 #include "Polygon.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+
 #include <logog/include/logog.hpp>
 #include <boost/math/constants/constants.hpp>
 
@@ -30,11 +36,17 @@ Polygon::Polygon(const Polyline &ply, bool init) :
     {
         initialise();
     }
+    initialiseSlabs();
     _simple_polygon_list.push_back(this);
 }
 
 Polygon::Polygon(Polygon const& other)
-    : Polyline(other), _aabb(other._aabb)
+    : Polyline(other),
+      _aabb(other._aabb),
+      _slabs_min_y(other._slabs_min_y),
+      _slab_height(other._slab_height),
+      _slab_offsets(other._slab_offsets),
+      _slab_segment_ids(other._slab_segment_ids)
 {
     _simple_polygon_list.push_back(this);
     auto sub_polygon_it(other._simple_polygon_list.begin());
@@ -70,6 +82,120 @@ bool Polygon::initialise ()
     return false;
 }
 
+bool Polygon::addPoint(std::size_t pnt_id)
+{
+    if (!Polyline::addPoint(pnt_id))
+    {
+        return false;
+    }
+    initialiseSlabs();
+    return true;
+}
+
+bool Polygon::insertPoint(std::size_t pos, std::size_t pnt_id)
+{
+    if (!Polyline::insertPoint(pos, pnt_id))
+    {
+        return false;
+    }
+    initialiseSlabs();
+    return true;
+}
+
+void Polygon::removePoint(std::size_t pos)
+{
+    Polyline::removePoint(pos);
+    initialiseSlabs();
+}
+
+void Polygon::initialiseSlabs()
+{
+    _slab_offsets.clear();
+    _slab_segment_ids.clear();
+    std::size_t const n_segments(getNumberOfSegments());
+    if (n_segments == 0)
+    {
+        return;
+    }
+
+    double max_y(std::numeric_limits<double>::lowest());
+    _slabs_min_y = std::numeric_limits<double>::max();
+    for (std::size_t k(0); k < getNumberOfPoints(); k++)
+    {
+        _slabs_min_y = std::min(_slabs_min_y, (*getPoint(k))[1]);
+        max_y = std::max(max_y, (*getPoint(k))[1]);
+    }
+
+    auto const slab_range = [this](std::size_t const k) {
+        double const y0((*getPoint(k))[1]);
+        double const y1((*getPoint(k + 1))[1]);
+        return std::make_pair(getSlab(std::min(y0, y1)),
+                              getSlab(std::max(y0, y1)));
+    };
+
+    // Start with one slab per segment. Long segments are contained in many
+    // slabs, thus the number of slabs is reduced until the number of entries
+    // is proportional to the number of segments.
+    std::size_t n_slabs(n_segments);
+    std::vector<std::size_t> slab_sizes;
+    for (;;)
+    {
+        _slab_height = (max_y - _slabs_min_y) / n_slabs;
+        if (!(_slab_height > 0))
+        {
+            _slab_height = 0;
+            n_slabs = 1;
+        }
+        _slab_offsets.assign(n_slabs + 1, 0);
+
+        slab_sizes.assign(n_slabs, 0);
+        std::size_t n_entries(0);
+        for (std::size_t k(0); k < n_segments; k++)
+        {
+            auto const [first, last] = slab_range(k);
+            for (std::size_t i(first); i <= last; i++)
+            {
+                slab_sizes[i]++;
+            }
+            n_entries += last - first + 1;
+        }
+        if (n_slabs == 1 || n_entries <= 8 * n_segments)
+        {
+            break;
+        }
+        n_slabs /= 2;
+    }
+
+    std::partial_sum(slab_sizes.begin(), slab_sizes.end(),
+                     _slab_offsets.begin() + 1);
+    _slab_segment_ids.resize(_slab_offsets.back());
+    std::vector<std::size_t> positions(_slab_offsets.begin(),
+                                       _slab_offsets.end() - 1);
+    for (std::size_t k(0); k < n_segments; k++)
+    {
+        auto const [first, last] = slab_range(k);
+        for (std::size_t i(first); i <= last; i++)
+        {
+            _slab_segment_ids[positions[i]++] = k;
+        }
+    }
+}
+
+std::size_t Polygon::getSlab(double const y) const
+{
+    std::size_t const n_slabs(_slab_offsets.size() - 1);
+    if (_slab_height == 0 || !(y > _slabs_min_y))
+    {
+        return 0;
+    }
+    double const slab(std::floor((y - _slabs_min_y) / _slab_height));
+    if (slab >= static_cast<double>(n_slabs))
+    {
+        return n_slabs - 1;
+    }
+    return static_cast<std::size_t>(slab);
+}
+
 bool Polygon::isPntInPolygon(GeoLib::Point const& pnt) const
 {
     MathLib::Point3d const& min_aabb_pnt(_aabb.getMinPoint());
@@ -83,10 +209,18 @@ bool Polygon::isPntInPolygon(GeoLib::Point const& pnt) const
 
     if (_simple_polygon_list.size() == 1)
     {
+        if (_slab_offsets.empty())
+        {
+            return false;
+        }
         std::size_t n_intersections(0);
-        const std::size_t n_nodes(getNumberOfPoints() - 1);
-        for (std::size_t k(0); k < n_nodes; k++)
+        // Only the segments of the point's slab can overlap the point in y
+        // direction.
+        std::size_t const slab(getSlab(pnt[1]));
+        for (std::size_t i(_slab_offsets[slab]); i < _slab_offsets[slab + 1];
+             i++)
         {
+            std::size_t const k(_slab_segment_ids[i]);
             if (((*(getPoint(k)))[1] <= pnt[1] &&
                  pnt[1] <= (*(getPoint(k + 1)))[1]) ||
                 ((*(getPoint(k + 1)))[1] <= pnt[1] &&
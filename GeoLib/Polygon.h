@@ -58,6 +58,13 @@ public:
 
     bool initialise ();
 
+    /// Adds the point and updates the search structure of the segments.
+    bool addPoint(std::size_t pnt_id) override;
+    /// Inserts the point and updates the search structure of the segments.
+    bool insertPoint(std::size_t pos, std::size_t pnt_id) override;
+    /// Removes the point and updates the search structure of the segments.
+    void removePoint(std::size_t pos) override;
+
     /**
      * Method checks if the given point is inside the polygon.
      * The method requires that the polygon has clock wise orientation.
@@ -129,6 +136,13 @@ private:
 
     void ensureCCWOrientation ();
 
+    /// Sorts the segments into horizontal slabs, such that isPntInPolygon()
+    /// only has to check the segments of the slab of the point.
+    void initialiseSlabs();
+
+    /// Returns the slab containing the given y coordinate.
+    std::size_t getSlab(double y) const;
+
 #if __GNUC__ <= 4 && (__GNUC_MINOR__ < 9)
     void splitPolygonAtIntersection(
         const std::list<Polygon*>::iterator& polygon_it);
@@ -139,6 +153,15 @@ private:
     void splitPolygonAtPoint (const std::list<Polygon*>::iterator& polygon_it);
     std::list<Polygon*> _simple_polygon_list;
     AABB _aabb;
+
+    /// Lower y coordinate and height of the horizontal slabs.
+    double _slabs_min_y = 0;
+    double _slab_height = 0;
+    /// The segments overlapping the slab i in the y direction are
+    /// _slab_segment_ids[_slab_offsets[i]] to
+    /// _slab_segment_ids[_slab_offsets[i+1]-1].
+    std::vector<std::size_t> _slab_offsets;
+    std::vector<std::size_t> _slab_segment_ids;
 };
 
 /**
@@ -29,7 +29,7 @@ bool PolygonWithSegmentMarker::isSegmentMarked(std::size_t seg_num) const
 
 bool PolygonWithSegmentMarker::addPoint(std::size_t pnt_id)
 {
-    if (Polyline::addPoint(pnt_id)) {
+    if (Polygon::addPoint(pnt_id)) {
         _marker.push_back(false);
         return true;
     }
@@ -38,7 +38,7 @@ bool PolygonWithSegmentMarker::addPoint(std::size_t pnt_id)
 
 bool PolygonWithSegmentMarker::insertPoint(std::size_t pos, std::size_t pnt_id)
 {
-    if (Polyline::insertPoint(pos, pnt_id)) {
+    if (Polygon::insertPoint(pos, pnt_id)) {
         _marker.insert(_marker.begin()+pos, _marker[pos]);
         return true;
     }
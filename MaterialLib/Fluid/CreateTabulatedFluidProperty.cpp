@@ -0,0 +1,54 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ * \file
+ */
+
+#include "CreateTabulatedFluidProperty.h"
+
+#include "BaseLib/Error.h"
+
+#include "TabulatedFluidProperty.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+static std::array<double, 2> readRange(BaseLib::ConfigTree const& config,
+                                       std::string const& name)
+{
+    auto const range = config.getConfigParameter<std::vector<double>>(name);
+    if (range.size() != 2)
+    {
+        OGS_FATAL(
+            "The tabulation %s must be given by two values, the minimum and "
+            "the maximum, but %d values are given.",
+            name.c_str(), range.size());
+    }
+    return {{range[0], range[1]}};
+}
+
+std::unique_ptr<FluidProperty> createTabulatedFluidProperty(
+    BaseLib::ConfigTree const& config,
+    std::unique_ptr<FluidProperty>&& property)
+{
+    auto const temperature_range =
+        //! \ogs_file_param{material__fluid__tabulation__temperature_range}
+        readRange(config, "temperature_range");
+    auto const pressure_range =
+        //! \ogs_file_param{material__fluid__tabulation__pressure_range}
+        readRange(config, "pressure_range");
+    auto const relative_tolerance =
+        //! \ogs_file_param{material__fluid__tabulation__relative_tolerance}
+        config.getConfigParameter<double>("relative_tolerance", 1e-6);
+
+    return std::make_unique<TabulatedFluidProperty>(
+        std::move(property), temperature_range, pressure_range,
+        relative_tolerance);
+}
+}  // namespace Fluid
+}  // namespace MaterialLib
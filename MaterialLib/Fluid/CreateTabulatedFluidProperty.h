@@ -0,0 +1,30 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ * \file
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "BaseLib/ConfigTree.h"
+
+#include "FluidProperty.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+/// Wraps the fluid property into a TabulatedFluidProperty.
+/// \param config  ConfigTree object has a tag of `<tabulation>`
+/// \param property the fluid property to be tabulated.
+std::unique_ptr<FluidProperty> createTabulatedFluidProperty(
+    BaseLib::ConfigTree const& config,
+    std::unique_ptr<FluidProperty>&& property);
+}  // namespace Fluid
+}  // namespace MaterialLib
@@ -23,6 +23,7 @@
 #include "WaterDensityIAPWSIF97Region1.h"
 
 #include "MaterialLib/Fluid/ConstantFluidProperty.h"
+#include "MaterialLib/Fluid/CreateTabulatedFluidProperty.h"
 
 namespace MaterialLib
 {
@@ -124,7 +125,7 @@ createLinearConcentrationAndPressureDependentDensity(
         fluid_density_pressure_difference_ratio);
 }
 
-std::unique_ptr<FluidProperty> createFluidDensityModel(
+static std::unique_ptr<FluidProperty> createFluidDensityModelOfType(
     BaseLib::ConfigTree const& config)
 {
     //! \ogs_file_param{material__fluid__density__type}
@@ -175,5 +176,20 @@ std::unique_ptr<FluidProperty> createFluidDensityModel(
         type.data());
 }
 
+std::unique_ptr<FluidProperty> createFluidDensityModel(
+    BaseLib::ConfigTree const& config)
+{
+    auto model = createFluidDensityModelOfType(config);
+
+    if (auto const tabulation_config =
+            //! \ogs_file_param{material__fluid__density__tabulation}
+            config.getConfigSubtreeOptional("tabulation"))
+    {
+        return createTabulatedFluidProperty(*tabulation_config,
+                                            std::move(model));
+    }
+    return model;
+}
+
 }  // namespace Fluid
 }  // namespace MaterialLib
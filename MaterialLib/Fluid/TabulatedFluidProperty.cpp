@@ -0,0 +1,232 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ * \file
+ */
+
+#include "TabulatedFluidProperty.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+
+namespace
+{
+/// Cubic Hermite basis functions on the unit interval, or their
+/// derivatives, for the value at 0, the derivative at 0, the value at 1 and
+/// the derivative at 1.
+std::array<double, 4> hermiteBasis(double const u, int const derivative)
+{
+    if (derivative == 0)
+    {
+        return {{2 * u * u * u - 3 * u * u + 1, u * u * u - 2 * u * u + u,
+                 -2 * u * u * u + 3 * u * u, u * u * u - u * u}};
+    }
+    return {{6 * u * u - 6 * u, 3 * u * u - 4 * u + 1, -6 * u * u + 6 * u,
+             3 * u * u - 2 * u}};
+}
+
+/// Returns the index of the grid cell containing x and the local coordinate
+/// of x within that cell.
+std::pair<std::size_t, double> locate(double const x, double const x_min,
+                                      double const dx,
+                                      std::size_t const number_of_cells)
+{
+    auto const cell = std::min(
+        static_cast<std::size_t>(std::floor((x - x_min) / dx)),
+        number_of_cells - 1);
+    return {cell, (x - x_min) / dx - cell};
+}
+}  // namespace
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+/// Number of cells in each direction of the first grid.
+static std::size_t const initial_number_of_cells = 16;
+/// Number of cells in each direction beyond which the grid is not refined.
+static std::size_t const maximum_number_of_cells = 512;
+
+TabulatedFluidProperty::TabulatedFluidProperty(
+    std::unique_ptr<FluidProperty>&& property,
+    std::array<double, 2> const& temperature_range,
+    std::array<double, 2> const& pressure_range,
+    double const relative_tolerance)
+    : _property(std::move(property)),
+      _temperature_range(temperature_range),
+      _pressure_range(pressure_range)
+{
+    if (!(_temperature_range[0] < _temperature_range[1]) ||
+        !(_pressure_range[0] < _pressure_range[1]))
+    {
+        OGS_FATAL(
+            "The tabulation ranges of the fluid property '%s' must be given "
+            "by a minimum less than the maximum.",
+            _property->getName().c_str());
+    }
+
+    for (std::size_t n = initial_number_of_cells;; n *= 2)
+    {
+        sample(n);
+        double const error = computeMaximumRelativeError();
+        if (error <= relative_tolerance)
+        {
+            INFO(
+                "Tabulated the fluid property '%s' on %d x %d cells with a "
+                "maximum relative error of %g.",
+                _property->getName().c_str(), n, n, error);
+            break;
+        }
+        if (n >= maximum_number_of_cells)
+        {
+            OGS_FATAL(
+                "The tabulation of the fluid property '%s' on %d x %d cells "
+                "has a maximum relative error of %g, which exceeds the "
+                "tolerance %g.",
+                _property->getName().c_str(), n, n, error, relative_tolerance);
+        }
+    }
+}
+
+void TabulatedFluidProperty::sample(std::size_t const number_of_cells)
+{
+    _number_of_cells = number_of_cells;
+    _dT = (_temperature_range[1] - _temperature_range[0]) / number_of_cells;
+    _dp = (_pressure_range[1] - _pressure_range[0]) / number_of_cells;
+
+    auto const T_index = static_cast<int>(PropertyVariableType::T);
+    auto const p_index = static_cast<int>(PropertyVariableType::p);
+    // Step of the central differences of the pressure derivative giving the
+    // mixed derivative.
+    double const perturbation = 1e-3 * _dT;
+
+    auto const n = number_of_cells + 1;
+    _nodes.resize(n * n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        for (std::size_t j = 0; j < n; j++)
+        {
+            ArrayType vars = {{0, 0, 0}};
+            vars[T_index] = _temperature_range[0] + i * _dT;
+            vars[p_index] = _pressure_range[0] + j * _dp;
+
+            auto& node = _nodes[i * n + j];
+            node[0] = _property->getValue(vars);
+            node[1] = _property->getdValue(vars, PropertyVariableType::T);
+            node[2] = _property->getdValue(vars, PropertyVariableType::p);
+
+            vars[T_index] += perturbation;
+            double const dp_plus =
+                _property->getdValue(vars, PropertyVariableType::p);
+            vars[T_index] -= 2 * perturbation;
+            double const dp_minus =
+                _property->getdValue(vars, PropertyVariableType::p);
+            node[3] = (dp_plus - dp_minus) / (2 * perturbation);
+        }
+    }
+}
+
+double TabulatedFluidProperty::computeMaximumRelativeError() const
+{
+    auto const T_index = static_cast<int>(PropertyVariableType::T);
+    auto const p_index = static_cast<int>(PropertyVariableType::p);
+
+    double max_error = 0;
+    for (std::size_t i = 0; i < _number_of_cells; i++)
+    {
+        for (std::size_t j = 0; j < _number_of_cells; j++)
+        {
+            ArrayType vars = {{0, 0, 0}};
+            vars[T_index] = _temperature_range[0] + (i + 0.5) * _dT;
+            vars[p_index] = _pressure_range[0] + (j + 0.5) * _dp;
+
+            double const exact = _property->getValue(vars);
+            double const error =
+                std::abs(interpolate(vars[T_index], vars[p_index], 0, 0) -
+                         exact);
+            max_error = std::max(
+                max_error, exact == 0 ? error : error / std::abs(exact));
+        }
+    }
+    return max_error;
+}
+
+bool TabulatedFluidProperty::isInRange(double const T, double const p) const
+{
+    return T >= _temperature_range[0] && T <= _temperature_range[1] &&
+           p >= _pressure_range[0] && p <= _pressure_range[1];
+}
+
+double TabulatedFluidProperty::interpolate(double const T, double const p,
+                                           int const dT, int const dp) const
+{
+    auto const [i, u] =
+        locate(T, _temperature_range[0], _dT, _number_of_cells);
+    auto const [j, v] = locate(p, _pressure_range[0], _dp, _number_of_cells);
+
+    auto const H_T = hermiteBasis(u, dT);
+    auto const H_p = hermiteBasis(v, dp);
+
+    auto const n = _number_of_cells + 1;
+    double value = 0;
+    for (int a = 0; a < 2; a++)
+    {
+        for (int b = 0; b < 2; b++)
+        {
+            auto const& node = _nodes[(i + a) * n + j + b];
+            double const h_T = H_T[2 * a];
+            double const h_T_derivative = H_T[2 * a + 1] * _dT;
+            double const h_p = H_p[2 * b];
+            double const h_p_derivative = H_p[2 * b + 1] * _dp;
+
+            value += h_T * h_p * node[0] + h_T_derivative * h_p * node[1] +
+                     h_T * h_p_derivative * node[2] +
+                     h_T_derivative * h_p_derivative * node[3];
+        }
+    }
+    // The basis functions are given in the local coordinates of the cell.
+    return value / std::pow(_dT, dT) / std::pow(_dp, dp);
+}
+
+double TabulatedFluidProperty::getValue(ArrayType const& var_vals) const
+{
+    double const T = var_vals[static_cast<int>(PropertyVariableType::T)];
+    double const p = var_vals[static_cast<int>(PropertyVariableType::p)];
+    if (!isInRange(T, p))
+    {
+        return _property->getValue(var_vals);
+    }
+    return interpolate(T, p, 0, 0);
+}
+
+double TabulatedFluidProperty::getdValue(ArrayType const& var_vals,
+                                         PropertyVariableType const var) const
+{
+    double const T = var_vals[static_cast<int>(PropertyVariableType::T)];
+    double const p = var_vals[static_cast<int>(PropertyVariableType::p)];
+    if (!isInRange(T, p))
+    {
+        return _property->getdValue(var_vals, var);
+    }
+
+    switch (var)
+    {
+        case PropertyVariableType::T:
+            return interpolate(T, p, 1, 0);
+        case PropertyVariableType::p:
+            return interpolate(T, p, 0, 1);
+        default:
+            return 0.0;
+    }
+}
+
+}  // namespace Fluid
+}  // namespace MaterialLib
@@ -0,0 +1,92 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ * \file
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "FluidProperty.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+/// A fluid property evaluated by bicubic Hermite interpolation of the values
+/// and derivatives of another fluid property sampled on a regular grid of
+/// temperatures and pressures.
+///
+/// The grid is refined at construction until the relative interpolation error
+/// at the cell centres is below the given tolerance. Outside of the grid the
+/// wrapped property is evaluated. The property is assumed to not depend on the
+/// concentration.
+class TabulatedFluidProperty final : public FluidProperty
+{
+public:
+    /// \param property the fluid property to be tabulated.
+    /// \param temperature_range the minimum and the maximum temperature of
+    ///        the grid.
+    /// \param pressure_range the minimum and the maximum pressure of the grid,
+    ///        or of the density for the properties substituting the pressure
+    ///        by the density.
+    /// \param relative_tolerance the maximum relative interpolation error.
+    TabulatedFluidProperty(std::unique_ptr<FluidProperty>&& property,
+                           std::array<double, 2> const& temperature_range,
+                           std::array<double, 2> const& pressure_range,
+                           double const relative_tolerance);
+
+    std::string getName() const override
+    {
+        return _property->getName() + " (tabulated)";
+    }
+
+    double getValue(ArrayType const& var_vals) const override;
+
+    double getdValue(ArrayType const& var_vals,
+                     PropertyVariableType const var) const override;
+
+private:
+    /// Value, derivatives with respect to the temperature and the pressure,
+    /// and the mixed derivative at a grid node.
+    using NodeData = std::array<double, 4>;
+
+    /// Samples the wrapped property on a grid with the given number of cells
+    /// in each direction.
+    void sample(std::size_t const number_of_cells);
+
+    /// Returns the maximum relative difference of the interpolated and the
+    /// wrapped property at the cell centres.
+    double computeMaximumRelativeError() const;
+
+    /// Returns true if the temperature and the pressure lie within the grid.
+    bool isInRange(double const T, double const p) const;
+
+    /// Interpolates the value or one of the derivatives, i.e. the derivatives
+    /// of the Hermite basis functions with respect to the temperature and the
+    /// pressure given by the orders dT and dp.
+    double interpolate(double const T, double const p, int const dT,
+                       int const dp) const;
+
+    std::unique_ptr<FluidProperty> const _property;
+    std::array<double, 2> const _temperature_range;
+    std::array<double, 2> const _pressure_range;
+
+    std::size_t _number_of_cells = 0;
+    double _dT = 0;
+    double _dp = 0;
+    /// Node data ordered by temperature first, i.e. the node (i, j) of the
+    /// i-th temperature and the j-th pressure is at i * (_number_of_cells + 1)
+    /// + j.
+    std::vector<NodeData> _nodes;
+};
+
+}  // namespace Fluid
+}  // namespace MaterialLib
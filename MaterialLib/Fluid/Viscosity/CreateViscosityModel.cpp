@@ -15,6 +15,7 @@
 #include "BaseLib/Error.h"
 
 #include "MaterialLib/Fluid/ConstantFluidProperty.h"
+#include "MaterialLib/Fluid/CreateTabulatedFluidProperty.h"
 #include "LinearPressureDependentViscosity.h"
 #include "TemperatureDependentViscosity.h"
 #include "VogelsLiquidDynamicViscosity.h"
@@ -70,7 +71,7 @@ static std::unique_ptr<FluidProperty> createTemperatureDependentViscosity(
     return std::make_unique<TemperatureDependentViscosity>(mu0, Tc, Tv);
 }
 
-std::unique_ptr<FluidProperty> createViscosityModel(
+static std::unique_ptr<FluidProperty> createViscosityModelOfType(
     BaseLib::ConfigTree const& config)
 {
     //! \ogs_file_param{material__fluid__viscosity__type}
@@ -149,5 +150,20 @@ std::unique_ptr<FluidProperty> createViscosityModel(
         type.data());
 }
 
+std::unique_ptr<FluidProperty> createViscosityModel(
+    BaseLib::ConfigTree const& config)
+{
+    auto model = createViscosityModelOfType(config);
+
+    if (auto const tabulation_config =
+            //! \ogs_file_param{material__fluid__viscosity__tabulation}
+            config.getConfigSubtreeOptional("tabulation"))
+    {
+        return createTabulatedFluidProperty(*tabulation_config,
+                                            std::move(model));
+    }
+    return model;
+}
+
 }  // namespace Fluid
 }  // namespace MaterialLib
@@ -92,6 +92,43 @@ public:
         Eigen::Ref<Eigen::MatrixXd>
             C,
         MaterialStateVariables& material_state_variables) = 0;
+
+    using Vector = Eigen::Matrix<double, DisplacementDim, 1>;
+    using Matrix = Eigen::Matrix<double, DisplacementDim, DisplacementDim>;
+
+    /**
+     * Batched version of computeConstitutiveRelation() for the integration
+     * points 0, ..., \c n - 1 of one fracture element. The position \c x
+     * identifies the element; its integration point is set for each of the
+     * points.
+     *
+     * The arrays \c aperture0, \c w_prev, \c w, \c sigma_prev, and \c
+     * material_state_variables provide the inputs, \c sigma and \c C receive
+     * the outputs; all of them must have \c n entries. The initial stress \c
+     * sigma0 is the same for all points.
+     *
+     * The default implementation calls computeConstitutiveRelation() for each
+     * point. Material models can override it in order to avoid the dynamic
+     * size arguments or to vectorize over the points.
+     */
+    virtual void computeConstitutiveRelationBatch(
+        double const t, ParameterLib::SpatialPosition const& x,
+        std::size_t const n, double const* const aperture0,
+        Vector const& sigma0, Vector const* const w_prev,
+        Vector const* const w, Vector const* const sigma_prev,
+        Vector* const sigma, Matrix* const C,
+        MaterialStateVariables* const* const material_state_variables)
+    {
+        ParameterLib::SpatialPosition x_ip = x;
+        for (std::size_t ip = 0; ip < n; ++ip)
+        {
+            x_ip.setIntegrationPoint(ip);
+            computeConstitutiveRelation(t, x_ip, aperture0[ip], sigma0,
+                                        w_prev[ip], w[ip], sigma_prev[ip],
+                                        sigma[ip], C[ip],
+                                        *material_state_variables[ip]);
+        }
+    }
 };
 
 }  // namespace Fracture
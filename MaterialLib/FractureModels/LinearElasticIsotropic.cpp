@@ -67,6 +67,51 @@ void LinearElasticIsotropic<DisplacementDim>::computeConstitutiveRelation(
     }
 }
 
+template <int DisplacementDim>
+void LinearElasticIsotropic<DisplacementDim>::computeConstitutiveRelationBatch(
+    double const t, ParameterLib::SpatialPosition const& x,
+    std::size_t const n, double const* const aperture0, Vector const& sigma0,
+    Vector const* const /*w_prev*/, Vector const* const w,
+    Vector const* const /*sigma_prev*/, Vector* const sigma, Matrix* const C,
+    typename FractureModelBase<DisplacementDim>::MaterialStateVariables* const*
+        const material_state_variables)
+{
+    const int index_ns = DisplacementDim - 1;
+    ParameterLib::SpatialPosition x_ip = x;
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        x_ip.setIntegrationPoint(ip);
+        auto& state = *material_state_variables[ip];
+        state.reset();
+
+        double const ks = _mp.shear_stiffness(t, x_ip)[0];
+        double const kn = _mp.normal_stiffness(t, x_ip)[0];
+        double const aperture = w[ip][index_ns] + aperture0[ip];
+
+        C[ip].setZero();
+        C[ip].diagonal().template head<index_ns>().setConstant(ks);
+        C[ip](index_ns, index_ns) =
+            kn *
+            logPenaltyDerivative(aperture0[ip], aperture,
+                                 _penalty_aperture_cutoff);
+
+        sigma[ip].template head<index_ns>() =
+            ks * w[ip].template head<index_ns>();
+        sigma[ip][index_ns] =
+            kn * w[ip][index_ns] *
+            logPenalty(aperture0[ip], aperture, _penalty_aperture_cutoff);
+        sigma[ip] += sigma0;
+
+        // correction for an opening fracture
+        if (_tension_cutoff && sigma[ip][index_ns] > 0)
+        {
+            C[ip].setZero();
+            sigma[ip].setZero();
+            state.setTensileStress(true);
+        }
+    }
+}
+
 template class LinearElasticIsotropic<2>;
 template class LinearElasticIsotropic<3>;
 
@@ -100,6 +100,20 @@ public:
         typename FractureModelBase<DisplacementDim>::MaterialStateVariables&
             material_state_variables) override;
 
+    using typename FractureModelBase<DisplacementDim>::Vector;
+    using typename FractureModelBase<DisplacementDim>::Matrix;
+
+    /// Fixed size version of computeConstitutiveRelation() for all points.
+    void computeConstitutiveRelationBatch(
+        double const t, ParameterLib::SpatialPosition const& x,
+        std::size_t const n, double const* const aperture0,
+        Vector const& sigma0, Vector const* const w_prev,
+        Vector const* const w, Vector const* const sigma_prev,
+        Vector* const sigma, Matrix* const C,
+        typename FractureModelBase<DisplacementDim>::
+            MaterialStateVariables* const* const material_state_variables)
+        override;
+
 private:
     /// Compressive normal displacements above this value will not enter the
     /// computation of the normal stiffness modulus of the fracture.
@@ -174,6 +174,14 @@ std::unique_ptr<PropertyArray> createProperties(
         auto property = createProperty(
             property_config, parameters, local_coordinate_system, curves);
 
+        //! \ogs_file_param{properties__property__tabulation}
+        if (auto const tabulation_config =
+                property_config.getConfigSubtreeOptional("tabulation"))
+        {
+            property = createTabulatedProperty(*tabulation_config,
+                                               std::move(property));
+        }
+
         // Insert the new property at the right position into the components
         // private PropertyArray:
         (*properties)[convertStringToProperty(property_name)] =
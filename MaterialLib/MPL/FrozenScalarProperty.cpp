@@ -0,0 +1,72 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "FrozenScalarProperty.h"
+
+#include <algorithm>
+
+#include "Properties/Constant.h"
+#include "Properties/LinearProperty.h"
+
+namespace MaterialPropertyLib
+{
+namespace
+{
+bool holdsDouble(PropertyDataType const& v)
+{
+    return std::holds_alternative<double>(v);
+}
+
+bool holdsDouble(VariableType const& v)
+{
+    return std::holds_alternative<double>(v);
+}
+}  // namespace
+
+FrozenScalarProperty::FrozenScalarProperty(Property const& property)
+    : _property(property)
+{
+    if (dynamic_cast<Constant const*>(&property) != nullptr &&
+        holdsDouble(property.value()))
+    {
+        _kind = Kind::Constant;
+        _value = property.value<double>();
+        return;
+    }
+
+    if (auto const* linear = dynamic_cast<LinearProperty const*>(&property))
+    {
+        auto const& ivs = linear->getIndependentVariables();
+        if (!holdsDouble(property.value()) ||
+            !std::all_of(ivs.begin(), ivs.end(), [](auto const& iv) {
+                return holdsDouble(iv.reference_condition) &&
+                       holdsDouble(iv.slope);
+            }))
+        {
+            return;
+        }
+
+        _kind = Kind::Linear;
+        _value = property.value<double>();
+        for (auto const& iv : ivs)
+        {
+            _linear_terms.push_back({static_cast<int>(iv.type),
+                                     std::get<double>(iv.reference_condition),
+                                     std::get<double>(iv.slope)});
+        }
+        // LinearProperty::dValue() uses the first matching variable.
+        for (auto it = ivs.rbegin(); it != ivs.rend(); ++it)
+        {
+            _derivatives[static_cast<int>(it->type)] =
+                _value * std::get<double>(it->slope);
+        }
+    }
+}
+}  // namespace MaterialPropertyLib
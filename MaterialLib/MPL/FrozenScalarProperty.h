@@ -0,0 +1,107 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Property.h"
+#include "VariableType.h"
+
+namespace MaterialPropertyLib
+{
+/// Evaluator of a scalar property with fast paths for constant and linear
+/// properties.
+///
+/// The property is analysed once on construction. Constant properties are
+/// folded into their value, linear properties with scalar slopes into their
+/// coefficients. For those the evaluation returns a double directly, i.e.,
+/// without a virtual call and without a PropertyDataType being constructed.
+/// All other properties are evaluated through the Property interface.
+///
+/// \attention The evaluator refers to the property, which must outlive it.
+class FrozenScalarProperty final
+{
+public:
+    explicit FrozenScalarProperty(Property const& property);
+
+    /// Whether the value does not depend on any variable, position, or time.
+    bool isConstant() const { return _kind == Kind::Constant; }
+
+    double value(VariableArray const& variable_array,
+                 ParameterLib::SpatialPosition const& pos, double const t,
+                 double const dt) const
+    {
+        switch (_kind)
+        {
+            case Kind::Constant:
+                return _value;
+            case Kind::Linear:
+                return linearValue(variable_array);
+            default:
+                return _property.value<double>(variable_array, pos, t, dt);
+        }
+    }
+
+    double dValue(VariableArray const& variable_array, Variable const variable,
+                  ParameterLib::SpatialPosition const& pos, double const t,
+                  double const dt) const
+    {
+        switch (_kind)
+        {
+            case Kind::Constant:
+                return 0;
+            case Kind::Linear:
+                return _derivatives[static_cast<int>(variable)];
+            default:
+                return _property.dValue<double>(
+                    variable_array, variable, pos, t, dt);
+        }
+    }
+
+private:
+    enum class Kind
+    {
+        Constant,
+        Linear,
+        Generic
+    };
+
+    struct LinearTerm
+    {
+        int variable;
+        double reference;
+        double slope;
+    };
+
+    double linearValue(VariableArray const& variable_array) const
+    {
+        // Same order of operations as in LinearProperty::value().
+        double ratio = 1.0;
+        for (auto const& term : _linear_terms)
+        {
+            ratio += term.slope *
+                     (std::get<double>(variable_array[term.variable]) -
+                      term.reference);
+        }
+        return _value * ratio;
+    }
+
+    Property const& _property;
+    Kind _kind = Kind::Generic;
+
+    /// The constant value or the reference value of a linear property.
+    double _value = 0;
+    std::vector<LinearTerm> _linear_terms;
+    /// Derivatives of a linear property w.r.t. all variables.
+    std::array<double, static_cast<int>(Variable::number_of_variables)>
+        _derivatives{};
+};
+}  // namespace MaterialPropertyLib
@@ -14,6 +14,29 @@
 
 namespace MaterialPropertyLib
 {
+MaterialSpatialDistributionMap::MaterialSpatialDistributionMap(
+    std::map<int, std::shared_ptr<Medium>> const& media,
+    MeshLib::PropertyVector<int> const* const material_ids)
+    : _media(media), _material_ids(material_ids)
+{
+    auto const find_medium = [&](int const material_id) -> Medium* {
+        auto const it = _media.find(material_id);
+        return it == _media.end() ? nullptr : it->second.get();
+    };
+
+    if (_material_ids == nullptr)
+    {
+        _element_media.push_back(find_medium(0));
+        return;
+    }
+
+    _element_media.reserve(_material_ids->size());
+    for (auto const material_id : *_material_ids)
+    {
+        _element_media.push_back(find_medium(material_id));
+    }
+}
+
 Medium* MaterialSpatialDistributionMap::getMedium(std::size_t const element_id)
 {
     return const_cast<Medium*>(
@@ -24,10 +47,14 @@ Medium* MaterialSpatialDistributionMap::getMedium(std::size_t const element_id)
 Medium const* MaterialSpatialDistributionMap::getMedium(
     std::size_t const element_id) const
 {
-    auto const material_id =
-        _material_ids == nullptr ? 0 : (*_material_ids)[element_id];
-
-    return _media.at(material_id).get();
+    auto const* const medium =
+        _element_media[_material_ids == nullptr ? 0 : element_id];
+    if (medium == nullptr)
+    {
+        OGS_FATAL("There is no medium definition for element %d.",
+                  element_id);
+    }
+    return medium;
 }
 
 
@@ -30,10 +30,7 @@ class MaterialSpatialDistributionMap
 public:
     MaterialSpatialDistributionMap(
         std::map<int, std::shared_ptr<Medium>> const& media,
-        MeshLib::PropertyVector<int> const* const material_ids)
-        : _media(media), _material_ids(material_ids)
-    {
-    }
+        MeshLib::PropertyVector<int> const* const material_ids);
 
     Medium* getMedium(std::size_t element_id);
     Medium const* getMedium(std::size_t element_id) const;
@@ -42,5 +39,10 @@ public:
 private:
     std::map<int, std::shared_ptr<Medium>> const& _media;
     MeshLib::PropertyVector<int> const* const _material_ids;
+
+    /// The medium of each element, or nullptr if there is no medium for the
+    /// element's material id. Without material ids the only entry is the
+    /// medium with id 0.
+    std::vector<Medium*> _element_media;
 };
 }  // namespace MaterialPropertyLib
@@ -29,4 +29,5 @@
 #include "CreateSaturationDependentSwelling.h"
 #include "CreateSaturationLiakopoulos.h"
 #include "CreateSaturationVanGenuchten.h"
+#include "CreateTabulatedProperty.h"
 #include "CreateTransportPorosityFromMassBalance.h"
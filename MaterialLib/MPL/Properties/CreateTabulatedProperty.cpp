@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CreateTabulatedProperty.h"
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "TabulatedProperty.h"
+
+namespace MaterialPropertyLib
+{
+std::unique_ptr<Property> createTabulatedProperty(
+    BaseLib::ConfigTree const& config, std::unique_ptr<Property>&& property)
+{
+    DBUG("Create tabulated property");
+
+    auto const variable = convertStringToVariable(
+        //! \ogs_file_param{properties__property__tabulation__variable}
+        config.getConfigParameter<std::string>("variable"));
+
+    auto const range =
+        //! \ogs_file_param{properties__property__tabulation__range}
+        config.getConfigParameter<std::vector<double>>("range");
+    if (range.size() != 2)
+    {
+        OGS_FATAL(
+            "The tabulation range must be given by two values, the minimum "
+            "and the maximum, but %d values are given.",
+            range.size());
+    }
+
+    auto const relative_tolerance =
+        //! \ogs_file_param{properties__property__tabulation__relative_tolerance}
+        config.getConfigParameter<double>("relative_tolerance", 1e-6);
+
+    return std::make_unique<TabulatedProperty>(
+        std::move(property), variable,
+        std::array<double, 2>{{range[0], range[1]}}, relative_tolerance);
+}
+}  // namespace MaterialPropertyLib
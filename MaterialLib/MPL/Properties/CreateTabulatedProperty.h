@@ -0,0 +1,31 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace MaterialPropertyLib
+{
+class Property;
+}
+
+namespace MaterialPropertyLib
+{
+/// Wraps the given property into a TabulatedProperty configured by the
+/// tabulation subtree.
+std::unique_ptr<Property> createTabulatedProperty(
+    BaseLib::ConfigTree const& config, std::unique_ptr<Property>&& property);
+}  // namespace MaterialPropertyLib
@@ -68,4 +68,26 @@ PropertyDataType ExponentialProperty::d2Value(
                : decltype(_value){};
 }
 
+double ExponentialProperty::computeValueAndDerivatives(
+    VariableArray const& variable_array, Variable const* const variables,
+    std::size_t const n, double* const derivatives,
+    ParameterLib::SpatialPosition const& /*pos*/, double const /*t*/,
+    double const /*dt*/) const
+{
+    double const factor = std::get<double>(_exponent_data.factor);
+    double const value =
+        std::get<double>(_value) *
+        std::exp(-factor *
+                 (std::get<double>(
+                      variable_array[static_cast<int>(_exponent_data.type)]) -
+                  std::get<double>(_exponent_data.reference_condition)));
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        derivatives[i] =
+            _exponent_data.type == variables[i] ? -factor * value : 0.;
+    }
+    return value;
+}
+
 }  // namespace MaterialPropertyLib
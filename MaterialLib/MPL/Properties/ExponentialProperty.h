@@ -54,6 +54,14 @@ public:
                              double const /*t*/,
                              double const /*dt*/) const override;
 
+protected:
+    /// Shares the subexpressions of the value and the derivatives.
+    double computeValueAndDerivatives(
+        VariableArray const& variable_array, Variable const* const variables,
+        std::size_t const n, double* const derivatives,
+        ParameterLib::SpatialPosition const& pos, double const t,
+        double const dt) const override;
+
 private:
     ExponentData const _exponent_data;
 };
@@ -132,4 +132,42 @@ PropertyDataType IdealGasLaw::d2Value(VariableArray const& variable_array,
     return 0.;
 }
 
+double IdealGasLaw::computeValueAndDerivatives(
+    VariableArray const& variable_array, Variable const* const variables,
+    std::size_t const n, double* const derivatives,
+    ParameterLib::SpatialPosition const& pos, double const t,
+    double const dt) const
+{
+    const double gas_constant = MaterialLib::PhysicalConstant::IdealGasConstant;
+    const double pressure = std::get<double>(
+        variable_array[static_cast<int>(Variable::phase_pressure)]);
+    const double temperature = std::get<double>(
+        variable_array[static_cast<int>(Variable::temperature)]);
+    double molar_mass =
+        molarMass(_phase, _component, variable_array, pos, t, dt);
+
+    double const drho_dp = molar_mass / gas_constant / temperature;
+    double const density = pressure * drho_dp;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (variables[i] == Variable::temperature)
+        {
+            derivatives[i] = -density / temperature;
+        }
+        else if (variables[i] == Variable::phase_pressure)
+        {
+            derivatives[i] = drho_dp;
+        }
+        else
+        {
+            OGS_FATAL(
+                "IdealGasLaw::computeValueAndDerivatives is implemented for "
+                "derivatives with respect to phase pressure or temperature "
+                "only.");
+        }
+    }
+    return density;
+}
+
 }  // namespace MaterialPropertyLib
@@ -69,6 +69,14 @@ public:
                              ParameterLib::SpatialPosition const& pos,
                              double const t, double const dt) const override;
 
+protected:
+    /// Shares the subexpressions of the value and the derivatives.
+    double computeValueAndDerivatives(
+        VariableArray const& variable_array, Variable const* const variables,
+        std::size_t const n, double* const derivatives,
+        ParameterLib::SpatialPosition const& pos, double const t,
+        double const dt) const override;
+
 private:
     Phase* _phase = nullptr;
     Component* _component = nullptr;
@@ -56,6 +56,11 @@ public:
                              double const /*t*/,
                              double const /*dt*/) const override;
 
+    std::vector<IndependentVariable> const& getIndependentVariables() const
+    {
+        return _independent_variables;
+    }
+
 private:
     std::vector<IndependentVariable> const _independent_variables;
 };
@@ -28,4 +28,5 @@
 #include "SaturationDependentSwelling.h"
 #include "SaturationLiakopoulos.h"
 #include "SaturationVanGenuchten.h"
+#include "TabulatedProperty.h"
 #include "TransportPorosityFromMassBalance.h"
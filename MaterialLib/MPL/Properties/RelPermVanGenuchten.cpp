@@ -93,4 +93,45 @@ PropertyDataType RelPermVanGenuchten::dValue(
            (_S_L_max - _S_L_res);
 }
 
+double RelPermVanGenuchten::computeValueAndDerivatives(
+    VariableArray const& variable_array, Variable const* const variables,
+    std::size_t const n, double* const derivatives,
+    ParameterLib::SpatialPosition const& /*pos*/, double const /*t*/,
+    double const /*dt*/) const
+{
+    double const S_L = std::clamp(
+        std::get<double>(
+            variable_array[static_cast<int>(Variable::liquid_saturation)]),
+        _S_L_res, _S_L_max);
+
+    double const S_eff = (S_L - _S_L_res) / (_S_L_max - _S_L_res);
+    double const S_eff_to_1_over_m = std::pow(S_eff, 1. / _m);
+    double const w = 1. - S_eff_to_1_over_m;
+    double const w_to_m = std::pow(w, _m);
+    double const v = 1. - w_to_m;
+    double const sqrt_S_eff = std::sqrt(S_eff);
+    double const k_rel = sqrt_S_eff * v * v;
+
+    // The derivative vanishes at the bounds of the effective saturation,
+    // which also prevents divisions by zero, and below the minimum.
+    double dk_rel_dS_L = 0;
+    if (S_eff > 0 && S_eff < 1 && k_rel >= _k_rel_min)
+    {
+        dk_rel_dS_L = (0.5 * v * v / sqrt_S_eff +
+                       2. * sqrt_S_eff * v * (w_to_m / w) *
+                           S_eff_to_1_over_m / S_eff) /
+                      (_S_L_max - _S_L_res);
+    }
+
+    (void)variables;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        assert((variables[i] == Variable::liquid_saturation) &&
+               "RelPermVanGenuchten::computeValueAndDerivatives is "
+               "implemented for derivatives with respect to liquid "
+               "saturation only.");
+        derivatives[i] = dk_rel_dS_L;
+    }
+    return std::max(_k_rel_min, k_rel);
+}
 }  // namespace MaterialPropertyLib
@@ -62,5 +62,13 @@ public:
                             Variable const variable,
                             ParameterLib::SpatialPosition const& pos,
                             double const t, double const dt) const override;
+
+protected:
+    /// Shares the subexpressions of the value and the derivatives.
+    double computeValueAndDerivatives(
+        VariableArray const& variable_array, Variable const* const variables,
+        std::size_t const n, double* const derivatives,
+        ParameterLib::SpatialPosition const& pos, double const t,
+        double const dt) const override;
 };
 }  // namespace MaterialPropertyLib
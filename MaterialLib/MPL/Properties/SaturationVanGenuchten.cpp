@@ -132,4 +132,44 @@ PropertyDataType SaturationVanGenuchten::d2Value(
         (p_cap * p_cap * (_m - 1.) * (_m - 1.));
     return d2S_eff_dp_cap2 * (_S_L_max - _S_L_res);
 }
+
+double SaturationVanGenuchten::computeValueAndDerivatives(
+    VariableArray const& variable_array, Variable const* const variables,
+    std::size_t const n, double* const derivatives,
+    ParameterLib::SpatialPosition const& /*pos*/, double const /*t*/,
+    double const /*dt*/) const
+{
+    const double p_cap = std::get<double>(
+        variable_array[static_cast<int>(Variable::capillary_pressure)]);
+
+    double S = _S_L_max;
+    double dS_dp_cap = 0;
+    if (p_cap > 0)
+    {
+        double const p = p_cap / _p_b;
+        double const n_vG = 1. / (1. - _m);
+        double const p_to_n = std::pow(p, n_vG);
+
+        double const S_eff = std::pow(p_to_n + 1., -_m);
+        S = S_eff * _S_L_max - S_eff * _S_L_res + _S_L_res;
+        if (S >= _S_L_res && S <= _S_L_max)
+        {
+            // The powers of the derivative are expressed by the ones of the
+            // value.
+            dS_dp_cap = -_m * (p_to_n / p) * (S_eff / (1 + p_to_n)) /
+                        (_p_b * (1. - _m)) * (_S_L_max - _S_L_res);
+        }
+    }
+
+    (void)variables;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        assert((variables[i] == Variable::capillary_pressure) &&
+               "SaturationVanGenuchten::computeValueAndDerivatives is "
+               "implemented for derivatives with respect to capillary "
+               "pressure only.");
+        derivatives[i] = dS_dp_cap;
+    }
+    return std::clamp(S, _S_L_res, _S_L_max);
+}
 }  // namespace MaterialPropertyLib
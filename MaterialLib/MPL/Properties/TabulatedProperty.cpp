@@ -0,0 +1,236 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TabulatedProperty.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+
+namespace
+{
+/// Cubic Hermite basis functions on the unit interval, or their first or
+/// second derivatives, for the value at 0, the derivative at 0, the value at 1
+/// and the derivative at 1.
+std::array<double, 4> hermiteBasis(double const u, int const derivative)
+{
+    switch (derivative)
+    {
+        case 0:
+            return {{2 * u * u * u - 3 * u * u + 1, u * u * u - 2 * u * u + u,
+                     -2 * u * u * u + 3 * u * u, u * u * u - u * u}};
+        case 1:
+            return {{6 * u * u - 6 * u, 3 * u * u - 4 * u + 1,
+                     -6 * u * u + 6 * u, 3 * u * u - 2 * u}};
+        default:
+            return {{12 * u - 6, 6 * u - 4, -12 * u + 6, 6 * u - 2}};
+    }
+}
+
+/// Limits the derivative at a node to the derivative's sign and three times
+/// the magnitude of the secant of an adjacent cell, which is sufficient for
+/// the Hermite interpolant to be monotone in that cell.
+double limitDerivative(double const derivative, double const secant)
+{
+    if (std::isnan(derivative) || secant == 0 ||
+        (derivative > 0) != (secant > 0))
+    {
+        return 0;
+    }
+    return secant > 0 ? std::min(derivative, 3 * secant)
+                      : std::max(derivative, 3 * secant);
+}
+}  // namespace
+
+namespace MaterialPropertyLib
+{
+/// Number of cells of the first grid.
+static std::size_t const initial_number_of_cells = 64;
+/// Number of cells beyond which the grid is not refined.
+static std::size_t const maximum_number_of_cells = 65536;
+
+TabulatedProperty::TabulatedProperty(std::unique_ptr<Property>&& property,
+                                     Variable const variable,
+                                     std::array<double, 2> const& range,
+                                     double const relative_tolerance)
+    : _property(std::move(property)),
+      _variable(variable),
+      _range(range),
+      _relative_tolerance(relative_tolerance)
+{
+    if (!(_range[0] < _range[1]))
+    {
+        OGS_FATAL(
+            "The tabulation range of a property must be given by a minimum "
+            "less than the maximum, but [%g, %g] is given.",
+            _range[0], _range[1]);
+    }
+}
+
+void TabulatedProperty::tabulate() const
+{
+    std::call_once(_tabulated, [this]() {
+        for (std::size_t n = initial_number_of_cells;; n *= 2)
+        {
+            sample(n);
+            double const error = computeMaximumRelativeError();
+            if (error <= _relative_tolerance)
+            {
+                INFO(
+                    "Tabulated a property on %d cells in [%g, %g] with a "
+                    "maximum relative error of %g.",
+                    n, _range[0], _range[1], error);
+                break;
+            }
+            if (n >= maximum_number_of_cells)
+            {
+                OGS_FATAL(
+                    "The tabulation of a property on %d cells in [%g, %g] "
+                    "has a maximum relative error of %g, which exceeds the "
+                    "tolerance %g.",
+                    n, _range[0], _range[1], error, _relative_tolerance);
+            }
+        }
+    });
+}
+
+void TabulatedProperty::sample(std::size_t const number_of_cells) const
+{
+    _number_of_cells = number_of_cells;
+    _dx = (_range[1] - _range[0]) / number_of_cells;
+
+    ParameterLib::SpatialPosition const pos;
+    double const t = std::numeric_limits<double>::quiet_NaN();
+    double const dt = std::numeric_limits<double>::quiet_NaN();
+    VariableArray variable_array;
+
+    _nodes.resize(number_of_cells + 1);
+    for (std::size_t i = 0; i <= number_of_cells; i++)
+    {
+        variable_array[static_cast<int>(_variable)] = _range[0] + i * _dx;
+        _nodes[i] = {
+            {_property->value<double>(variable_array, pos, t, dt),
+             _property->dValue<double>(variable_array, _variable, pos, t,
+                                       dt)}};
+    }
+
+    // Each node is limited by the secants of both adjacent cells.
+    for (std::size_t i = 0; i < number_of_cells; i++)
+    {
+        double const secant = (_nodes[i + 1][0] - _nodes[i][0]) / _dx;
+        _nodes[i][1] = limitDerivative(_nodes[i][1], secant);
+        _nodes[i + 1][1] = limitDerivative(_nodes[i + 1][1], secant);
+    }
+}
+
+double TabulatedProperty::computeMaximumRelativeError() const
+{
+    ParameterLib::SpatialPosition const pos;
+    double const t = std::numeric_limits<double>::quiet_NaN();
+    double const dt = std::numeric_limits<double>::quiet_NaN();
+    VariableArray variable_array;
+
+    double const scale =
+        std::abs(std::max_element(_nodes.begin(), _nodes.end(),
+                                  [](auto const& a, auto const& b) {
+                                      return std::abs(a[0]) < std::abs(b[0]);
+                                  })
+                     ->front());
+
+    double max_error = 0;
+    for (std::size_t i = 0; i < _number_of_cells; i++)
+    {
+        double const x = _range[0] + (i + 0.5) * _dx;
+        variable_array[static_cast<int>(_variable)] = x;
+
+        double const exact =
+            _property->value<double>(variable_array, pos, t, dt);
+        double const error = std::abs(interpolate(x, 0) - exact);
+        max_error = std::max(max_error, scale == 0 ? error : error / scale);
+    }
+    return max_error;
+}
+
+double TabulatedProperty::interpolate(double const x,
+                                      int const derivative) const
+{
+    auto const cell = std::min(
+        static_cast<std::size_t>(std::floor((x - _range[0]) / _dx)),
+        _number_of_cells - 1);
+    double const u = (x - _range[0]) / _dx - cell;
+
+    auto const H = hermiteBasis(u, derivative);
+    auto const& left = _nodes[cell];
+    auto const& right = _nodes[cell + 1];
+
+    double const value = H[0] * left[0] + H[1] * _dx * left[1] +
+                         H[2] * right[0] + H[3] * _dx * right[1];
+    // The basis functions are given in the local coordinates of the cell.
+    switch (derivative)
+    {
+        case 0:
+            return value;
+        case 1:
+            return value / _dx;
+        default:
+            return value / (_dx * _dx);
+    }
+}
+
+PropertyDataType TabulatedProperty::value(
+    VariableArray const& variable_array,
+    ParameterLib::SpatialPosition const& pos, double const t,
+    double const dt) const
+{
+    double const x =
+        std::get<double>(variable_array[static_cast<int>(_variable)]);
+    if (!isInRange(x))
+    {
+        return _property->value(variable_array, pos, t, dt);
+    }
+    tabulate();
+    return interpolate(x, 0);
+}
+
+PropertyDataType TabulatedProperty::dValue(
+    VariableArray const& variable_array, Variable const variable,
+    ParameterLib::SpatialPosition const& pos, double const t,
+    double const dt) const
+{
+    double const x =
+        std::get<double>(variable_array[static_cast<int>(_variable)]);
+    if (variable != _variable || !isInRange(x))
+    {
+        return _property->dValue(variable_array, variable, pos, t, dt);
+    }
+    tabulate();
+    return interpolate(x, 1);
+}
+
+PropertyDataType TabulatedProperty::d2Value(
+    VariableArray const& variable_array, Variable const variable1,
+    Variable const variable2, ParameterLib::SpatialPosition const& pos,
+    double const t, double const dt) const
+{
+    double const x =
+        std::get<double>(variable_array[static_cast<int>(_variable)]);
+    if (variable1 != _variable || variable2 != _variable || !isInRange(x))
+    {
+        return _property->d2Value(variable_array, variable1, variable2, pos, t,
+                                  dt);
+    }
+    tabulate();
+    return interpolate(x, 2);
+}
+}  // namespace MaterialPropertyLib
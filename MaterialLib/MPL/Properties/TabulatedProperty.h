@@ -0,0 +1,96 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "MaterialLib/MPL/Property.h"
+
+namespace MaterialPropertyLib
+{
+/// A scalar property of a single variable evaluated by monotone piecewise
+/// cubic Hermite interpolation of the values and derivatives of another
+/// property sampled on a regular grid, e.g. the saturation as a function of
+/// the capillary pressure.
+///
+/// The sampled derivatives are limited such that the interpolant is monotone
+/// in each cell in which the sampled values are. The grid is refined until the
+/// interpolation error at the cell centres, relative to the largest sampled
+/// magnitude, is below the given tolerance. The table is built on the first
+/// evaluation, because the wrapped property may need the other properties of
+/// its medium. Outside of the grid, and for the derivatives with respect to
+/// other variables, the wrapped property is evaluated.
+class TabulatedProperty final : public Property
+{
+public:
+    /// \param property the property to be tabulated.
+    /// \param variable the variable the property is tabulated for.
+    /// \param range the minimum and the maximum of the variable on the grid.
+    /// \param relative_tolerance the maximum relative interpolation error.
+    TabulatedProperty(std::unique_ptr<Property>&& property,
+                      Variable const variable,
+                      std::array<double, 2> const& range,
+                      double const relative_tolerance);
+
+    void setScale(
+        std::variant<Medium*, Phase*, Component*> scale_pointer) override
+    {
+        _property->setScale(scale_pointer);
+    }
+
+    PropertyDataType value(VariableArray const& variable_array,
+                           ParameterLib::SpatialPosition const& pos,
+                           double const t, double const dt) const override;
+    PropertyDataType dValue(VariableArray const& variable_array,
+                            Variable const variable,
+                            ParameterLib::SpatialPosition const& pos,
+                            double const t, double const dt) const override;
+    PropertyDataType d2Value(VariableArray const& variable_array,
+                             Variable const variable1, Variable const variable2,
+                             ParameterLib::SpatialPosition const& pos,
+                             double const t, double const dt) const override;
+
+private:
+    /// Value and the derivative with respect to the variable at a grid node.
+    using NodeData = std::array<double, 2>;
+
+    /// Builds the table, once.
+    void tabulate() const;
+
+    /// Samples the wrapped property on a grid with the given number of cells
+    /// and limits the derivatives.
+    void sample(std::size_t const number_of_cells) const;
+
+    /// Returns the maximum difference of the interpolated and the wrapped
+    /// property at the cell centres relative to the largest sampled magnitude.
+    double computeMaximumRelativeError() const;
+
+    /// Returns true if the variable lies within the grid.
+    bool isInRange(double const x) const
+    {
+        return x >= _range[0] && x <= _range[1];
+    }
+
+    /// Interpolates the value or the first or second derivative.
+    double interpolate(double const x, int const derivative) const;
+
+    std::unique_ptr<Property> const _property;
+    Variable const _variable;
+    std::array<double, 2> const _range;
+    double const _relative_tolerance;
+
+    mutable std::once_flag _tabulated;
+    mutable std::size_t _number_of_cells = 0;
+    mutable double _dx = 0;
+    mutable std::vector<NodeData> _nodes;
+};
+}  // namespace MaterialPropertyLib
@@ -99,4 +99,18 @@ PropertyDataType Property::d2Value(VariableArray const& /*variable_array*/,
 {
     return 0.0;
 }
+
+double Property::computeValueAndDerivatives(
+    VariableArray const& variable_array, Variable const* const variables,
+    std::size_t const n, double* const derivatives,
+    ParameterLib::SpatialPosition const& pos, double const t,
+    double const dt) const
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        derivatives[i] = std::get<double>(
+            dValue(variable_array, variables[i], pos, t, dt));
+    }
+    return std::get<double>(value(variable_array, pos, t, dt));
+}
 }  // namespace MaterialPropertyLib
@@ -37,6 +37,16 @@ using PropertyDataType =
 /// \attention It cannot distinguish between 2x2 matrix and 4x1 vector.
 PropertyDataType fromVector(std::vector<double> const& values);
 
+/// The value of a scalar property and its first derivatives with respect to
+/// the variables requested from Property::valueAndDerivatives(), in the order
+/// of the request.
+template <std::size_t N>
+struct ValueAndDerivatives
+{
+    double value;
+    std::array<double, N> derivatives;
+};
+
 /// This class is the base class for any material property of any
 /// scale (i.e. components, phases, media, ...). The single value of
 /// that Property can hold scalars, vectors, tensors, strings, etc.
@@ -74,6 +84,24 @@ public:
     virtual void setScale(
         std::variant<Medium*, Phase*, Component*> /*scale_pointer*/){};
 
+    /// Computes the value of a scalar property and its first derivatives
+    /// with respect to the given \c variables in one call. This is cheaper
+    /// than separate calls of value() and dValue() for properties sharing
+    /// subexpressions between them.
+    template <std::size_t N>
+    ValueAndDerivatives<N> valueAndDerivatives(
+        VariableArray const& variable_array,
+        std::array<Variable, N> const& variables,
+        ParameterLib::SpatialPosition const& pos, double const t,
+        double const dt) const
+    {
+        ValueAndDerivatives<N> result;
+        result.value = computeValueAndDerivatives(
+            variable_array, variables.data(), N, result.derivatives.data(),
+            pos, t, dt);
+        return result;
+    }
+
     template <typename T>
     T initialValue(ParameterLib::SpatialPosition const& pos,
                    double const t) const
@@ -113,6 +141,15 @@ public:
     }
 
 protected:
+    /// Returns the scalar value and stores the derivatives with respect to
+    /// the \c n \c variables in \c derivatives. The default implementation
+    /// calls value() and dValue() for each of the variables.
+    virtual double computeValueAndDerivatives(
+        VariableArray const& variable_array, Variable const* const variables,
+        std::size_t const n, double* const derivatives,
+        ParameterLib::SpatialPosition const& pos, double const t,
+        double const dt) const;
+
     /// The single value of a property.
     PropertyDataType _value;
     PropertyDataType _dvalue;
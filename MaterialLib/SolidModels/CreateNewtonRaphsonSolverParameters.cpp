@@ -34,6 +34,19 @@ NumLib::NewtonRaphsonSolverParameters createNewtonRaphsonSolverParameters(
 
     DBUG("\terror_tolerance: %g.", error_tolerance);
 
-    return {maximum_iterations, error_tolerance};
+    auto const jacobian_update_interval =
+        //! \ogs_file_param{nonlinear_solver__jacobian_update_interval}
+        config.getConfigParameter<int>("jacobian_update_interval", 1);
+
+    DBUG("\tjacobian_update_interval: %d.", jacobian_update_interval);
+
+    auto const broyden_update =
+        //! \ogs_file_param{nonlinear_solver__broyden_update}
+        config.getConfigParameter<bool>("broyden_update", false);
+
+    DBUG("\tbroyden_update: %s.", broyden_update ? "true" : "false");
+
+    return {maximum_iterations, error_tolerance, jacobian_update_interval,
+            broyden_update};
 }
 }  // namespace MaterialLib
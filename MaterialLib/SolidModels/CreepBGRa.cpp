@@ -50,10 +50,8 @@ CreepBGRa<DisplacementDim>::integrateStress(
     const auto C = this->getElasticTensor(t, x, T);
     KelvinVector sigma_try = sigma_prev + C * (eps - eps_prev);
 
-    auto const& deviatoric_matrix = Invariants::deviatoric_projection;
-
     double const norm_s_try =
-        Invariants::FrobeniusNorm(deviatoric_matrix * sigma_try);
+        Invariants::FrobeniusNorm(Invariants::deviatoric(sigma_try));
     // In case |s_{try}| is zero and _n < 3 (rare case).
     if (norm_s_try < std::numeric_limits<double>::epsilon() * C(0, 0))
     {
@@ -78,7 +76,7 @@ CreepBGRa<DisplacementDim>::integrateStress(
 
     auto const update_jacobian = [&solution, &G2b, &n](JacobianMatrix& jacobian) {
         auto const& D = Invariants::deviatoric_projection;
-        KelvinVector const s_n1 = D * solution;
+        KelvinVector const s_n1 = Invariants::deviatoric(solution);
         double const norm_s_n1 = Invariants::FrobeniusNorm(s_n1);
         double const pow_norm_s_n1_n_minus_one_2b_G =
             G2b * std::pow(norm_s_n1, n - 1);
@@ -90,7 +88,7 @@ CreepBGRa<DisplacementDim>::integrateStress(
 
     auto const update_residual = [&solution, &G2b, &n,
                                   &sigma_try](ResidualVectorType& r) {
-        KelvinVector const s_n1 = Invariants::deviatoric_projection * solution;
+        KelvinVector const s_n1 = Invariants::deviatoric(solution);
         double const norm_s_n1 = Invariants::FrobeniusNorm(s_n1);
         double const pow_norm_s_n1_n_minus_one_2b_G =
             G2b * std::pow(norm_s_n1, n - 1);
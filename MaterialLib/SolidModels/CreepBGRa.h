@@ -85,6 +85,24 @@ public:
             material_state_variables,
         double const T) const override;
 
+    /// Uses the point-wise integrateStress() of this model instead of the
+    /// batched linear elastic update.
+    bool integrateStressBatch(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const dt, std::size_t const n,
+        KelvinVector const* const eps_prev, KelvinVector const* const eps,
+        KelvinVector const* const sigma_prev,
+        std::unique_ptr<typename MechanicsBase<
+            DisplacementDim>::MaterialStateVariables>* const
+            material_state_variables,
+        double const T, KelvinVector* const sigma, KelvinMatrix* const C,
+        bool* const elastic) const override
+    {
+        return MechanicsBase<DisplacementDim>::integrateStressBatch(
+            t, x, dt, n, eps_prev, eps, sigma_prev, material_state_variables,
+            T, sigma, C, elastic);
+    }
+
     ConstitutiveModel getConstitutiveModel() const override
     {
         return ConstitutiveModel::CreepBGRa;
@@ -64,7 +64,7 @@ struct PhysicalStressWithInvariants final
 
     explicit PhysicalStressWithInvariants(KelvinVector const& stress)
         : value{stress},
-          D{Invariants::deviatoric_projection * stress},
+          D{Invariants::deviatoric(stress)},
           I_1{Invariants::trace(stress)},
           J_2{Invariants::J2(D)},
           J_3{Invariants::J3(D)}
@@ -159,7 +159,6 @@ calculatePlasticResidual(
     using KelvinVector =
         MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
 
-    auto const& P_dev = Invariants::deviatoric_projection;
     auto const& identity2 = Invariants::identity2;
 
     double const theta = s.J_3 / (s.J_2 * std::sqrt(s.J_2));
@@ -172,7 +171,7 @@ calculatePlasticResidual(
 
     // deviatoric plastic strain
     KelvinVector const sigma_D_inverse_D =
-        P_dev * MathLib::KelvinVector::inverse(s.D);
+        Invariants::deviatoric(MathLib::KelvinVector::inverse(s.D));
     KelvinVector const dtheta_dsigma =
         theta * sigma_D_inverse_D - 3. / 2. * theta / s.J_2 * s.D;
 
@@ -232,7 +231,8 @@ typename SolidEhlers<DisplacementDim>::JacobianMatrix calculatePlasticJacobian(
     }
     // inverse of sigma_D
     KelvinVector const sigma_D_inverse = MathLib::KelvinVector::inverse(s.D);
-    KelvinVector const sigma_D_inverse_D = P_dev * sigma_D_inverse;
+    KelvinVector const sigma_D_inverse_D =
+        Invariants::deviatoric(sigma_D_inverse);
 
     KelvinVector const dtheta_dsigma =
         theta * sigma_D_inverse_D - 3. / 2. * theta / s.J_2 * s.D;
@@ -436,7 +436,6 @@ typename SolidEhlers<DisplacementDim>::KelvinVector predict_sigma(
     static int const KelvinVectorSize =
         MathLib::KelvinVector::KelvinVectorDimensions<DisplacementDim>::value;
     using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
-    auto const& P_dev = Invariants::deviatoric_projection;
 
     // dimensionless initial hydrostatic pressure
     double const pressure_prev = Invariants::trace(sigma_prev) / (-3. * G);
@@ -446,10 +445,10 @@ typename SolidEhlers<DisplacementDim>::KelvinVector predict_sigma(
     double const pressure = pressure_prev - K / G * (eps_V - e_prev);
     // dimensionless deviatoric initial stress
     typename SolidEhlers<DisplacementDim>::KelvinVector const sigma_D_prev =
-        P_dev * sigma_prev / G;
+        Invariants::deviatoric(sigma_prev) / G;
     // dimensionless deviatoric stress
     typename SolidEhlers<DisplacementDim>::KelvinVector const sigma_D =
-        sigma_D_prev + 2 * P_dev * (eps - eps_prev);
+        sigma_D_prev + 2 * Invariants::deviatoric(eps - eps_prev);
     return sigma_D - pressure * Invariants::identity2;
 }
 
@@ -520,6 +519,72 @@ SolidEhlers<DisplacementDim>::integrateStress(
     StateVariables<DisplacementDim> state =
         static_cast<StateVariables<DisplacementDim> const&>(
             material_state_variables);
+
+    KelvinVector sigma;
+    KelvinMatrix tangentStiffness;
+    if (!returnMapping(t, x, dt, eps_prev, eps, sigma_prev, state, sigma,
+                       tangentStiffness, nullptr))
+    {
+        return {};
+    }
+
+    return {std::make_tuple(
+        sigma,
+        std::unique_ptr<
+            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
+            new StateVariables<DisplacementDim>{state}},
+        tangentStiffness)};
+}
+
+template <int DisplacementDim>
+bool SolidEhlers<DisplacementDim>::integrateStressBatch(
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
+    std::size_t const n, KelvinVector const* const eps_prev,
+    KelvinVector const* const eps, KelvinVector const* const sigma_prev,
+    std::unique_ptr<typename MechanicsBase<
+        DisplacementDim>::MaterialStateVariables>* const
+        material_state_variables,
+    double const /*T*/, KelvinVector* const sigma, KelvinMatrix* const C,
+    bool* const elastic) const
+{
+    ParameterLib::SpatialPosition x_ip = x;
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        assert(dynamic_cast<StateVariables<DisplacementDim>*>(
+                   material_state_variables[ip].get()) != nullptr);
+
+        x_ip.setIntegrationPoint(ip);
+        if (!returnMapping(t, x_ip, dt, eps_prev[ip], eps[ip], sigma_prev[ip],
+                           static_cast<StateVariables<DisplacementDim>&>(
+                               *material_state_variables[ip]),
+                           sigma[ip], C[ip],
+                           elastic != nullptr ? &elastic[ip] : nullptr))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <int DisplacementDim>
+typename SolidEhlers<DisplacementDim>::KelvinMatrix
+SolidEhlers<DisplacementDim>::getElasticTangent(
+    double const t, ParameterLib::SpatialPosition const& x,
+    double const /*T*/) const
+{
+    MaterialProperties const mp(t, x, _mp);
+    return elasticTangentStiffness<DisplacementDim>(mp.K - 2. / 3 * mp.G,
+                                                    mp.G);
+}
+
+template <int DisplacementDim>
+bool SolidEhlers<DisplacementDim>::returnMapping(
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
+    KelvinVector const& eps_prev, KelvinVector const& eps,
+    KelvinVector const& sigma_prev, StateVariables<DisplacementDim>& state,
+    KelvinVector& sigma_final, KelvinMatrix& tangentStiffness,
+    bool* const elastic) const
+{
     state.setInitialConditions();
 
     using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
@@ -527,9 +592,8 @@ SolidEhlers<DisplacementDim>::integrateStress(
     // volumetric strain
     double const eps_V = Invariants::trace(eps);
 
-    auto const& P_dev = Invariants::deviatoric_projection;
     // deviatoric strain
-    KelvinVector const eps_D = P_dev * eps;
+    KelvinVector const eps_D = Invariants::deviatoric(eps);
 
     // do the evaluation once per function call.
     MaterialProperties const mp(t, x, _mp);
@@ -537,8 +601,6 @@ SolidEhlers<DisplacementDim>::integrateStress(
     KelvinVector sigma = predict_sigma<DisplacementDim>(mp.G, mp.K, sigma_prev,
                                                         eps, eps_prev, eps_V);
 
-    KelvinMatrix tangentStiffness;
-
     PhysicalStressWithInvariants<DisplacementDim> s{mp.G * sigma};
     // Quit early if sigma is zero (nothing to do) or if we are still in elastic
     // zone.
@@ -548,11 +610,22 @@ SolidEhlers<DisplacementDim>::integrateStress(
              calculateIsotropicHardening(mp.kappa, mp.hardening_coefficient,
                                          state.eps_p.eff)) < 0))
     {
-        tangentStiffness = elasticTangentStiffness<DisplacementDim>(
-            mp.K - 2. / 3 * mp.G, mp.G);
+        if (elastic != nullptr)
+        {
+            *elastic = true;
+        }
+        else
+        {
+            tangentStiffness = elasticTangentStiffness<DisplacementDim>(
+                mp.K - 2. / 3 * mp.G, mp.G);
+        }
     }
     else
     {
+        if (elastic != nullptr)
+        {
+            *elastic = false;
+        }
         // Linear solver for the newton loop is required after the loop with the
         // same matrix. This saves one decomposition.
         Eigen::FullPivLU<Eigen::Matrix<double, JacobianResidualSize,
@@ -629,7 +702,7 @@ SolidEhlers<DisplacementDim>::integrateStress(
 
             if (!success_iterations)
             {
-                return {};
+                return false;
             }
 
             // If the Newton loop didn't run, the linear solver will not be
@@ -680,15 +753,8 @@ SolidEhlers<DisplacementDim>::integrateStress(
         }
     }
 
-    KelvinVector sigma_final = mp.G * sigma;
-
-    return {std::make_tuple(
-        sigma_final,
-        std::unique_ptr<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
-            new StateVariables<DisplacementDim>{
-                static_cast<StateVariables<DisplacementDim> const&>(state)}},
-        tangentStiffness)};
+    sigma_final = mp.G * sigma;
+    return true;
 }
 
 template <int DisplacementDim>
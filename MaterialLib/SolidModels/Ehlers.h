@@ -236,6 +236,32 @@ struct StateVariables
     using KelvinVector =
         MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
 
+    std::vector<double> getCheckpointData() const override
+    {
+        std::vector<double> data(eps_p.D.data(),
+                                 eps_p.D.data() + eps_p.D.size());
+        data.insert(data.end(), {eps_p.V, eps_p.eff, damage.kappa_d(),
+                                 damage.value()});
+        return data;
+    }
+
+    void setCheckpointData(std::vector<double> const& data) override
+    {
+        auto const n = KelvinVector::RowsAtCompileTime;
+        if (data.size() != static_cast<std::size_t>(n + 4))
+        {
+            OGS_FATAL(
+                "Wrong size of the Ehlers material state in the checkpoint; "
+                "expected %d values, got %d.",
+                n + 4, data.size());
+        }
+        eps_p = PlasticStrain<KelvinVector>{
+            Eigen::Map<KelvinVector const>(data.data()), data[n],
+            data[n + 1]};
+        damage = Damage{data[n + 2], data[n + 3]};
+        pushBackState();
+    }
+
     PlasticStrain<KelvinVector> eps_p;  ///< plastic part of the state.
     Damage damage;                      ///< damage part of the state.
 
@@ -321,6 +347,25 @@ public:
             material_state_variables,
         double const T) const override;
 
+    /// Runs the return mapping of each integration point directly on its
+    /// state object. Contrary to integrateStress() no state copies are
+    /// created. Points whose elastic predictor does not violate the yield
+    /// condition are reported as elastic.
+    bool integrateStressBatch(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const dt, std::size_t const n,
+        KelvinVector const* const eps_prev, KelvinVector const* const eps,
+        KelvinVector const* const sigma_prev,
+        std::unique_ptr<typename MechanicsBase<
+            DisplacementDim>::MaterialStateVariables>* const
+            material_state_variables,
+        double const T, KelvinVector* const sigma, KelvinMatrix* const C,
+        bool* const elastic) const override;
+
+    KelvinMatrix getElasticTangent(double const t,
+                                   ParameterLib::SpatialPosition const& x,
+                                   double const T) const override;
+
     std::vector<typename MechanicsBase<DisplacementDim>::InternalVariable>
     getInternalVariables() const override;
 
@@ -342,6 +387,24 @@ public:
         return DamageProperties(t, x, *_damage_properties);
     }
 
+private:
+    /// Computes the stress and the tangent for a given strain increment
+    /// updating the \c state in place. The elastic predictor is accepted
+    /// without solving the local Newton problem if it does not violate the
+    /// yield condition.
+    ///
+    /// If \c elastic is not a nullptr, it tells whether the elastic predictor
+    /// was accepted, and the tangent is not computed in that case.
+    ///
+    /// \return false if the local Newton iterations did not converge.
+    bool returnMapping(double const t, ParameterLib::SpatialPosition const& x,
+                       double const dt, KelvinVector const& eps_prev,
+                       KelvinVector const& eps, KelvinVector const& sigma_prev,
+                       StateVariables<DisplacementDim>& state,
+                       KelvinVector& sigma_final,
+                       KelvinMatrix& tangentStiffness,
+                       bool* const elastic) const;
+
 private:
     NumLib::NewtonRaphsonSolverParameters const _nonlinear_solver_parameters;
 
@@ -37,6 +37,35 @@ LinearElasticIsotropic<DisplacementDim>::integrateStress(
         C)};
 }
 
+template <int DisplacementDim>
+bool LinearElasticIsotropic<DisplacementDim>::integrateStressBatch(
+    double const t, ParameterLib::SpatialPosition const& x, double const /*dt*/,
+    std::size_t const n, KelvinVector const* const eps_prev,
+    KelvinVector const* const eps, KelvinVector const* const sigma_prev,
+    std::unique_ptr<typename MechanicsBase<
+        DisplacementDim>::MaterialStateVariables>* const
+    /*material_state_variables*/,
+    double const T, KelvinVector* const sigma, KelvinMatrix* const C,
+    bool* const elastic) const
+{
+    ParameterLib::SpatialPosition x_ip = x;
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        x_ip.setIntegrationPoint(ip);
+        KelvinMatrix const C_ip = getElasticTensor(t, x_ip, T);
+        sigma[ip].noalias() = sigma_prev[ip] + C_ip * (eps[ip] - eps_prev[ip]);
+        if (elastic != nullptr)
+        {
+            elastic[ip] = true;
+        }
+        else
+        {
+            C[ip] = C_ip;
+        }
+    }
+    return true;
+}
+
 template <int DisplacementDim>
 typename LinearElasticIsotropic<DisplacementDim>::KelvinMatrix
 LinearElasticIsotropic<DisplacementDim>::getElasticTensor(
@@ -35,26 +35,40 @@ public:
         /// Lamé's first parameter.
         double lambda(double const t, X const& x) const
         {
-            return _youngs_modulus(t, x)[0] * _poissons_ratio(t, x)[0] /
-                   (1 + _poissons_ratio(t, x)[0]) /
-                   (1 - 2 * _poissons_ratio(t, x)[0]);
+            double const E = youngs_modulus(t, x);
+            double const nu = poissons_ratio(t, x);
+            return E * nu / (1 + nu) / (1 - 2 * nu);
         }
 
         /// Lamé's second parameter, the shear modulus.
         double mu(double const t, X const& x) const
         {
-            return _youngs_modulus(t, x)[0] /
-                   (2 * (1 + _poissons_ratio(t, x)[0]));
+            return youngs_modulus(t, x) / (2 * (1 + poissons_ratio(t, x)));
         }
 
         /// the bulk modulus.
         double bulk_modulus(double const t, X const& x) const
         {
-            return _youngs_modulus(t, x)[0] /
-                   (3 * (1 - 2 * _poissons_ratio(t, x)[0]));
+            return youngs_modulus(t, x) / (3 * (1 - 2 * poissons_ratio(t, x)));
         }
 
     private:
+        // Both parameters are scalar, which is checked on construction of
+        // the material model.
+        double youngs_modulus(double const t, X const& x) const
+        {
+            double E;
+            _youngs_modulus(t, x, &E);
+            return E;
+        }
+
+        double poissons_ratio(double const t, X const& x) const
+        {
+            double nu;
+            _poissons_ratio(t, x, &nu);
+            return nu;
+        }
+
         P const& _youngs_modulus;
         P const& _poissons_ratio;
     };
@@ -98,10 +112,30 @@ public:
             material_state_variables,
         double const T) const override;
 
+    /// The material has no internal state, therefore the state objects are
+    /// kept and no new ones are created. All steps are elastic.
+    bool integrateStressBatch(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const dt, std::size_t const n,
+        KelvinVector const* const eps_prev, KelvinVector const* const eps,
+        KelvinVector const* const sigma_prev,
+        std::unique_ptr<typename MechanicsBase<
+            DisplacementDim>::MaterialStateVariables>* const
+            material_state_variables,
+        double const T, KelvinVector* const sigma, KelvinMatrix* const C,
+        bool* const elastic) const override;
+
     KelvinMatrix getElasticTensor(double const t,
                                   ParameterLib::SpatialPosition const& x,
                                   double const T) const;
 
+    KelvinMatrix getElasticTangent(double const t,
+                                   ParameterLib::SpatialPosition const& x,
+                                   double const T) const override
+    {
+        return getElasticTensor(t, x, T);
+    }
+
     MaterialProperties getMaterialProperties() const { return _mp; }
 
     double getBulkModulus(double const t,
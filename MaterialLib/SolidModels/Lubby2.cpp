@@ -91,14 +91,14 @@ Lubby2<DisplacementDim>::integrateStress(
         detail::LocalLubby2Properties<DisplacementDim>{t, x, _mp};
 
     // calculation of deviatoric parts
-    auto const& P_dev = Invariants::deviatoric_projection;
-    KelvinVector const epsd_i = P_dev * eps;
-    KelvinVector const epsd_t = P_dev * eps_prev;
+    KelvinVector const epsd_i = Invariants::deviatoric(eps);
+    KelvinVector const epsd_t = Invariants::deviatoric(eps_prev);
 
     // initial guess as elastic predictor.
     KelvinVector sigd_j = 2.0 * (epsd_i - state.eps_M_t - state.eps_K_t);
     // Note: sigd_t contains dimensionless stresses!
-    KelvinVector sigd_t = P_dev * sigma_prev / local_lubby2_properties.GM0;
+    KelvinVector sigd_t =
+        Invariants::deviatoric(sigma_prev) / local_lubby2_properties.GM0;
 
     // Calculate effective stress and update material properties
     double sig_eff = Invariants::equivalentStress(sigd_j);
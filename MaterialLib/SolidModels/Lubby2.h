@@ -130,6 +130,30 @@ public:
             eps_M_t = eps_M_j;
         }
 
+        std::vector<double> getCheckpointData() const override
+        {
+            std::vector<double> data(eps_K_j.data(),
+                                     eps_K_j.data() + eps_K_j.size());
+            data.insert(data.end(), eps_M_j.data(),
+                        eps_M_j.data() + eps_M_j.size());
+            return data;
+        }
+
+        void setCheckpointData(std::vector<double> const& data) override
+        {
+            if (data.size() != static_cast<std::size_t>(2 * KelvinVectorSize))
+            {
+                OGS_FATAL(
+                    "Wrong size of the Lubby2 material state in the "
+                    "checkpoint; expected %d values, got %d.",
+                    2 * KelvinVectorSize, data.size());
+            }
+            eps_K_j = Eigen::Map<KelvinVector const>(data.data());
+            eps_M_j =
+                Eigen::Map<KelvinVector const>(data.data() + KelvinVectorSize);
+            pushBackState();
+        }
+
         using KelvinVector =
             MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
         using KelvinMatrix =
@@ -211,8 +235,7 @@ public:
 
         // calculation of deviatoric parts
         using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
-        auto const& P_dev = Invariants::deviatoric_projection;
-        KelvinVector const epsd_i = P_dev * eps;
+        KelvinVector const epsd_i = Invariants::deviatoric(eps);
 
         // initial guess as elastic predictor
         KelvinVector sigd_j = 2.0 * (epsd_i - state.eps_M_t - state.eps_K_t);
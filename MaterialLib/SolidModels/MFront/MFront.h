@@ -56,6 +56,26 @@ public:
             mgis::behaviour::update(_behaviour_data);
         }
 
+        std::vector<double> getCheckpointData() const override
+        {
+            return _behaviour_data.s1.internal_state_variables;
+        }
+
+        void setCheckpointData(std::vector<double> const& data) override
+        {
+            auto& internal_state_variables =
+                _behaviour_data.s1.internal_state_variables;
+            if (data.size() != internal_state_variables.size())
+            {
+                OGS_FATAL(
+                    "Wrong number of MFront internal state variables in the "
+                    "checkpoint; expected %d values, got %d.",
+                    internal_state_variables.size(), data.size());
+            }
+            internal_state_variables = data;
+            pushBackState();
+        }
+
         mgis::behaviour::BehaviourData _behaviour_data;
     };
 
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <optional>
 #include <functional>
 #include <memory>
@@ -17,11 +18,7 @@
 
 #include "BaseLib/Error.h"
 #include "MathLib/KelvinVector.h"
-
-namespace ParameterLib
-{
-class SpatialPosition;
-}
+#include "ParameterLib/SpatialPosition.h"
 
 namespace MeshLib
 {
@@ -58,6 +55,13 @@ struct MechanicsBase
     {
         virtual ~MaterialStateVariables() = default;
         virtual void pushBackState(){};
+
+        /// Returns the state as a flat array for writing a checkpoint.
+        virtual std::vector<double> getCheckpointData() const { return {}; }
+
+        /// Restores the state from data returned by getCheckpointData(). The
+        /// state of the previous timestep is set to the same values.
+        virtual void setCheckpointData(std::vector<double> const& /*data*/) {}
     };
 
     /// Polymorphic creator for MaterialStateVariables objects specific for a
@@ -119,6 +123,68 @@ struct MechanicsBase
                     MaterialStateVariables const& material_state_variables,
                     double const T) const = 0;
 
+    /// Batched version of integrateStress() for the integration points
+    /// 0, ..., \c n - 1 of one element. The position \c x identifies the
+    /// element; its integration point is set for each of the points.
+    ///
+    /// The arrays \c eps_prev, \c eps, \c sigma_prev, and
+    /// \c material_state_variables provide the inputs, \c sigma and \c C
+    /// receive the outputs; all of them must have \c n entries. The material
+    /// state variables are updated in place.
+    ///
+    /// If \c elastic is not a nullptr, it receives \c n flags telling which
+    /// points took an elastic step, i.e., whose elastic trial stress was
+    /// admissible. The tangents \c C of these points are not computed then;
+    /// the caller uses getElasticTangent() instead. Models which do not
+    /// distinguish elastic steps set all flags to false.
+    ///
+    /// Returns false if the computation failed for any of the points. The
+    /// outputs are undefined then.
+    ///
+    /// The default implementation calls integrateStress() for each point.
+    /// Material models can override it, e.g., in order to avoid the creation
+    /// of new state objects or to vectorize over the points.
+    virtual bool integrateStressBatch(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const dt, std::size_t const n,
+        KelvinVector const* const eps_prev, KelvinVector const* const eps,
+        KelvinVector const* const sigma_prev,
+        std::unique_ptr<MaterialStateVariables>* const material_state_variables,
+        double const T, KelvinVector* const sigma, KelvinMatrix* const C,
+        bool* const elastic) const
+    {
+        if (elastic != nullptr)
+        {
+            std::fill_n(elastic, n, false);
+        }
+        ParameterLib::SpatialPosition x_ip = x;
+        for (std::size_t ip = 0; ip < n; ++ip)
+        {
+            x_ip.setIntegrationPoint(ip);
+            auto&& solution =
+                integrateStress(t, x_ip, dt, eps_prev[ip], eps[ip],
+                                sigma_prev[ip], *material_state_variables[ip],
+                                T);
+            if (!solution)
+            {
+                return false;
+            }
+            std::tie(sigma[ip], material_state_variables[ip], C[ip]) =
+                std::move(*solution);
+        }
+        return true;
+    }
+
+    /// The tangent of an elastic step at the given position. Only called for
+    /// models reporting elastic steps from integrateStressBatch().
+    virtual KelvinMatrix getElasticTangent(
+        double const /*t*/, ParameterLib::SpatialPosition const& /*x*/,
+        double const /*T*/) const
+    {
+        OGS_FATAL(
+            "getElasticTangent is not implemented for this Solid Material.");
+    }
+
     /// Helper type for providing access to internal variables.
     struct InternalVariable
     {
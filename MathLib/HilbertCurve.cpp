@@ -0,0 +1,134 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "HilbertCurve.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace
+{
+/// Computes the index of the point with the given integer coordinates of
+/// \c bits bits each on the Hilbert curve, following J. Skilling, "Programming
+/// the Hilbert curve", AIP Conference Proceedings 707, 2004.
+std::uint64_t hilbertIndex(std::array<std::uint64_t, 3> x, unsigned const dim,
+                           unsigned const bits)
+{
+    std::uint64_t const m = std::uint64_t{1} << (bits - 1);
+
+    // Inverse undo excess work.
+    for (std::uint64_t q = m; q > 1; q >>= 1)
+    {
+        std::uint64_t const p = q - 1;
+        for (unsigned i = 0; i < dim; ++i)
+        {
+            if (x[i] & q)
+            {
+                x[0] ^= p;
+            }
+            else
+            {
+                std::uint64_t const t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode.
+    for (unsigned i = 1; i < dim; ++i)
+    {
+        x[i] ^= x[i - 1];
+    }
+    std::uint64_t t = 0;
+    for (std::uint64_t q = m; q > 1; q >>= 1)
+    {
+        if (x[dim - 1] & q)
+        {
+            t ^= q - 1;
+        }
+    }
+    for (unsigned i = 0; i < dim; ++i)
+    {
+        x[i] ^= t;
+    }
+
+    // Interleave the transposed bits, most significant first.
+    std::uint64_t index = 0;
+    for (int b = static_cast<int>(bits) - 1; b >= 0; --b)
+    {
+        for (unsigned i = 0; i < dim; ++i)
+        {
+            index = (index << 1) | ((x[i] >> b) & 1);
+        }
+    }
+    return index;
+}
+}  // namespace
+
+namespace MathLib
+{
+std::vector<std::uint64_t> computeHilbertCurvePositions(
+    std::vector<Point3d> const& points)
+{
+    if (points.empty())
+    {
+        return {};
+    }
+
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+    min.fill(std::numeric_limits<double>::max());
+    max.fill(std::numeric_limits<double>::lowest());
+    for (auto const& point : points)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            min[k] = std::min(min[k], point[k]);
+            max[k] = std::max(max[k], point[k]);
+        }
+    }
+
+    std::array<int, 3> axes{};
+    unsigned dim = 0;
+    for (int k = 0; k < 3; ++k)
+    {
+        if (max[k] > min[k])
+        {
+            axes[dim++] = k;
+        }
+    }
+    if (dim == 0)
+    {
+        // All points coincide.
+        axes[dim++] = 0;
+    }
+    // At most 63 bits in total; 21 bits per direction in 3d.
+    unsigned const bits = std::min(63u / dim, 32u);
+    double const cells = static_cast<double>((std::uint64_t{1} << bits) - 1);
+
+    std::vector<std::uint64_t> positions;
+    positions.reserve(points.size());
+    for (auto const& point : points)
+    {
+        std::array<std::uint64_t, 3> x{};
+        for (unsigned d = 0; d < dim; ++d)
+        {
+            int const k = axes[d];
+            double const extent = max[k] - min[k];
+            x[d] = extent > 0 ? static_cast<std::uint64_t>(
+                                    (point[k] - min[k]) / extent * cells)
+                              : 0;
+        }
+        positions.push_back(hilbertIndex(x, dim, bits));
+    }
+    return positions;
+}
+}  // namespace MathLib
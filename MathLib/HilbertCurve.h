@@ -0,0 +1,27 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Point3d.h"
+
+namespace MathLib
+{
+/// Computes the position of each of the given points on a Hilbert curve
+/// through the points' bounding box.
+///
+/// Only the directions in which the bounding box extends are used, such that
+/// the curve's resolution is not wasted on e.g. the z-direction of 2d point
+/// sets. Sorting points by their positions gives a spatially compact order.
+std::vector<std::uint64_t> computeHilbertCurvePositions(
+    std::vector<Point3d> const& points);
+}  // namespace MathLib
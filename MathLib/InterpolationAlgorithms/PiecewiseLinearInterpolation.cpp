@@ -11,6 +11,7 @@
  *              http://www.opengeosys.org/project/license
  *
  */
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <utility>
@@ -45,6 +46,61 @@ PiecewiseLinearInterpolation::PiecewiseLinearInterpolation(
             "Piecewise linear interpolation is not possible\n",
             i, i + 1);
     }
+
+    std::size_t const n = _supp_pnts.size();
+    if (n < 2)
+    {
+        return;
+    }
+
+    _slopes.resize(n - 1);
+    for (std::size_t i = 0; i < n - 1; i++)
+    {
+        _slopes[i] = (_values_at_supp_pnts[i + 1] - _values_at_supp_pnts[i]) /
+                     (_supp_pnts[i + 1] - _supp_pnts[i]);
+    }
+
+    double const h = (_supp_pnts.back() - _supp_pnts.front()) / (n - 1);
+    bool is_uniform = true;
+    for (std::size_t i = 1; i < n - 1; i++)
+    {
+        if (std::abs(_supp_pnts[i] - (_supp_pnts.front() + i * h)) > 1e-6 * h)
+        {
+            is_uniform = false;
+            break;
+        }
+    }
+    if (is_uniform)
+    {
+        _uniform_spacing = h;
+    }
+}
+
+std::size_t PiecewiseLinearInterpolation::findSupportPoint(
+    double const pnt_to_interpolate) const
+{
+    if (_uniform_spacing == 0)
+    {
+        return std::distance(
+            _supp_pnts.begin(),
+            std::lower_bound(_supp_pnts.begin(), _supp_pnts.end(),
+                             pnt_to_interpolate));
+    }
+
+    // Estimate the index and correct it for rounding errors and the small
+    // deviations from the uniform spacing.
+    auto idx = static_cast<std::size_t>(std::ceil(
+        (pnt_to_interpolate - _supp_pnts.front()) / _uniform_spacing));
+    idx = std::min(idx, _supp_pnts.size() - 1);
+    while (idx > 0 && _supp_pnts[idx - 1] >= pnt_to_interpolate)
+    {
+        --idx;
+    }
+    while (idx < _supp_pnts.size() - 1 && _supp_pnts[idx] < pnt_to_interpolate)
+    {
+        ++idx;
+    }
+    return idx;
 }
 
 double PiecewiseLinearInterpolation::getValue(double pnt_to_interpolate) const
@@ -60,22 +116,14 @@ double PiecewiseLinearInterpolation::getValue(double pnt_to_interpolate) const
         return _values_at_supp_pnts[_supp_pnts.size() - 1];
     }
 
-    auto const& it(std::lower_bound(_supp_pnts.begin(), _supp_pnts.end(),
-                                    pnt_to_interpolate));
-    std::size_t const interval_idx = std::distance(_supp_pnts.begin(), it) - 1;
+    std::size_t const interval_idx = findSupportPoint(pnt_to_interpolate) - 1;
 
-    // support points.
+    // support point and value.
     double const x = _supp_pnts[interval_idx];
-    double const x_r = _supp_pnts[interval_idx + 1];
-
-    // values.
     double const f = _values_at_supp_pnts[interval_idx];
-    double const f_r = _values_at_supp_pnts[interval_idx + 1];
-
-    // compute linear interpolation polynom: y = m * (x - support[i]) + value[i]
-    const double m = (f_r - f) / (x_r - x);
 
-    return m * (pnt_to_interpolate - x) + f;
+    // linear interpolation polynom: y = m * (x - support[i]) + value[i]
+    return _slopes[interval_idx] * (pnt_to_interpolate - x) + f;
 }
 
 double PiecewiseLinearInterpolation::getDerivative(
@@ -87,9 +135,7 @@ double PiecewiseLinearInterpolation::getDerivative(
         return 0;
     }
 
-    auto const& it(std::lower_bound(_supp_pnts.begin(), _supp_pnts.end(),
-                                    pnt_to_interpolate));
-    std::size_t interval_idx = std::distance(_supp_pnts.begin(), it);
+    std::size_t interval_idx = findSupportPoint(pnt_to_interpolate);
 
     if (pnt_to_interpolate == _supp_pnts.front())
     {
@@ -116,9 +162,7 @@ double PiecewiseLinearInterpolation::getDerivative(
         return (1. - w) * tangent_right + w * tangent_left;
     }
 
-    return (_values_at_supp_pnts[interval_idx] -
-            _values_at_supp_pnts[interval_idx - 1]) /
-           (_supp_pnts[interval_idx] - _supp_pnts[interval_idx - 1]);
+    return _slopes[interval_idx - 1];
 }
 
 double PiecewiseLinearInterpolation::getSupportMax() const
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 namespace MathLib
@@ -78,5 +79,20 @@ public:
 protected:
     std::vector<double> _supp_pnts;
     std::vector<double> _values_at_supp_pnts;
+
+private:
+    /// Returns the index of the first supporting point not less than the
+    /// given point, which must be within the range of the supporting points.
+    /// Equivalent to std::lower_bound, but computed directly for uniformly
+    /// spaced supporting points.
+    std::size_t findSupportPoint(double pnt_to_interpolate) const;
+
+    /// Slopes of the linear interpolation in the intervals between the
+    /// supporting points.
+    std::vector<double> _slopes;
+
+    /// Distance of the supporting points if they are uniformly spaced, zero
+    /// otherwise.
+    double _uniform_spacing = 0;
 };
 }  // end namespace MathLib
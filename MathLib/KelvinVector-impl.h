@@ -65,6 +65,16 @@ double Invariants<KelvinVectorSize>::trace(
     return diagonal(v).sum();
 }
 
+template <int KelvinVectorSize>
+Eigen::Matrix<double, KelvinVectorSize, 1>
+Invariants<KelvinVectorSize>::deviatoric(
+    Eigen::Matrix<double, KelvinVectorSize, 1> const& v)
+{
+    Eigen::Matrix<double, KelvinVectorSize, 1> v_D = v;
+    v_D.template head<3>().array() -= trace(v) / 3.;
+    return v_D;
+}
+
 //
 // Initialization of static Invariant variables.
 //
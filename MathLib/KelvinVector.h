@@ -109,6 +109,12 @@ struct Invariants final
     /// and 3D cases.
     static Eigen::Vector3d diagonal(
         Eigen::Matrix<double, KelvinVectorSize, 1> const& v);
+
+    /// Deviatoric part of the corresponding tensor. Equal to
+    /// deviatoric_projection * v but computed without the matrix-vector
+    /// product.
+    static Eigen::Matrix<double, KelvinVectorSize, 1> deviatoric(
+        Eigen::Matrix<double, KelvinVectorSize, 1> const& v);
 };
 
 //
@@ -0,0 +1,311 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "EigenAMGPreconditioner.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <Eigen/SparseLU>
+#include <logog/include/logog.hpp>
+
+namespace
+{
+using Matrix = MathLib::EigenAMGPreconditioner::Matrix;
+using Vector = MathLib::EigenAMGPreconditioner::Vector;
+using Index = Matrix::StorageIndex;
+
+/// Threshold for strong connections.
+constexpr double strength_threshold = 0.08;
+/// Matrices up to this size are solved directly.
+constexpr Matrix::Index max_coarse_size = 1000;
+constexpr std::size_t max_levels = 20;
+/// Marks unknowns which are not aggregated.
+constexpr Index not_aggregated = -1;
+
+/// Returns the damped inverse diagonal \f$\omega D^{-1}\f$ used for the
+/// Jacobi smoothing and the prolongator smoothing with \f$\omega = 4/(3\rho)\f$
+/// and \f$\rho \geq \rho(D^{-1} A)\f$ estimated by Gershgorin's theorem.
+Vector computeDampedInverseDiagonal(Matrix const& A)
+{
+    Vector const diagonal = A.diagonal();
+
+    double rho = 0;
+    for (Matrix::Index i = 0; i < A.outerSize(); ++i)
+    {
+        if (diagonal[i] == 0)
+        {
+            continue;
+        }
+        double row_sum = 0;
+        for (Matrix::InnerIterator it(A, i); it; ++it)
+        {
+            row_sum += std::abs(it.value());
+        }
+        rho = std::max(rho, row_sum / std::abs(diagonal[i]));
+    }
+    double const omega = rho > 0 ? 4. / (3. * rho) : 0;
+
+    Vector result(A.rows());
+    for (Matrix::Index i = 0; i < A.rows(); ++i)
+    {
+        result[i] = diagonal[i] != 0 ? omega / diagonal[i] : 0;
+    }
+    return result;
+}
+
+/// Groups the strongly connected unknowns into aggregates.
+///
+/// \return the aggregate of each unknown or \c not_aggregated.
+std::vector<Index> computeAggregates(Matrix const& A)
+{
+    auto const n = static_cast<Index>(A.rows());
+    Vector const diagonal = A.diagonal();
+
+    // Strong connections in compressed row storage.
+    std::vector<Index> strong_begin(n + 1, 0);
+    std::vector<Index> strong;
+    strong.reserve(A.nonZeros());
+    for (Index i = 0; i < n; ++i)
+    {
+        for (Matrix::InnerIterator it(A, i); it; ++it)
+        {
+            auto const j = static_cast<Index>(it.col());
+            if (j != i &&
+                std::abs(it.value()) >=
+                    strength_threshold *
+                        std::sqrt(std::abs(diagonal[i] * diagonal[j])))
+            {
+                strong.push_back(j);
+            }
+        }
+        strong_begin[i + 1] = static_cast<Index>(strong.size());
+    }
+
+    std::vector<Index> aggregates(n, not_aggregated);
+    std::vector<bool> isolated(n, false);
+    Index n_aggregates = 0;
+
+    // First pass: aggregates of a root and all its strong neighbors, if none
+    // of them is aggregated yet.
+    for (Index i = 0; i < n; ++i)
+    {
+        if (strong_begin[i] == strong_begin[i + 1])
+        {
+            isolated[i] = true;
+            continue;
+        }
+        if (aggregates[i] != not_aggregated)
+        {
+            continue;
+        }
+        bool const free_neighborhood =
+            std::all_of(strong.begin() + strong_begin[i],
+                        strong.begin() + strong_begin[i + 1],
+                        [&](Index const j) {
+                            return aggregates[j] == not_aggregated;
+                        });
+        if (!free_neighborhood)
+        {
+            continue;
+        }
+        aggregates[i] = n_aggregates;
+        for (Index k = strong_begin[i]; k < strong_begin[i + 1]; ++k)
+        {
+            aggregates[strong[k]] = n_aggregates;
+        }
+        ++n_aggregates;
+    }
+
+    // Second pass: the remaining unknowns join an aggregate of a strong
+    // neighbor.
+    std::vector<Index> first_pass_aggregates = aggregates;
+    for (Index i = 0; i < n; ++i)
+    {
+        if (aggregates[i] != not_aggregated || isolated[i])
+        {
+            continue;
+        }
+        for (Index k = strong_begin[i]; k < strong_begin[i + 1]; ++k)
+        {
+            if (first_pass_aggregates[strong[k]] != not_aggregated)
+            {
+                aggregates[i] = first_pass_aggregates[strong[k]];
+                break;
+            }
+        }
+    }
+
+    // Third pass: new aggregates for the unknowns still left.
+    for (Index i = 0; i < n; ++i)
+    {
+        if (aggregates[i] != not_aggregated || isolated[i])
+        {
+            continue;
+        }
+        aggregates[i] = n_aggregates;
+        for (Index k = strong_begin[i]; k < strong_begin[i + 1]; ++k)
+        {
+            if (aggregates[strong[k]] == not_aggregated)
+            {
+                aggregates[strong[k]] = n_aggregates;
+            }
+        }
+        ++n_aggregates;
+    }
+
+    return aggregates;
+}
+
+/// Computes the smoothed prolongator \f$P = (I - \omega D^{-1} A) T\f$ for
+/// the piecewise constant tentative prolongator \f$T\f$ of the aggregates.
+Matrix computeProlongator(Matrix const& A,
+                          Vector const& damped_inverse_diagonal,
+                          std::vector<Index> const& aggregates,
+                          Index const n_aggregates)
+{
+    std::vector<Eigen::Triplet<double, Index>> triplets;
+    triplets.reserve(A.nonZeros() + A.rows());
+    for (Index i = 0; i < static_cast<Index>(A.rows()); ++i)
+    {
+        if (aggregates[i] != not_aggregated)
+        {
+            triplets.emplace_back(i, aggregates[i], 1.0);
+        }
+        for (Matrix::InnerIterator it(A, i); it; ++it)
+        {
+            auto const aggregate = aggregates[it.col()];
+            if (aggregate != not_aggregated)
+            {
+                triplets.emplace_back(
+                    i, aggregate, -damped_inverse_diagonal[i] * it.value());
+            }
+        }
+    }
+
+    Matrix P(A.rows(), n_aggregates);
+    P.setFromTriplets(triplets.begin(), triplets.end());
+    return P;
+}
+}  // namespace
+
+namespace MathLib
+{
+struct EigenAMGPreconditioner::Level
+{
+    Matrix A;
+    Matrix P;
+    Matrix R;  ///< Restriction, the transpose of \c P.
+    Vector damped_inverse_diagonal;
+    std::vector<Index> aggregates;
+
+    /// Work vectors of the V-cycle.
+    mutable Vector r;
+    mutable Vector coarse_b;
+    mutable Vector coarse_x;
+};
+
+struct EigenAMGPreconditioner::CoarseSolver
+{
+    Eigen::SparseLU<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>>
+        lu;
+};
+
+EigenAMGPreconditioner::EigenAMGPreconditioner() = default;
+EigenAMGPreconditioner::~EigenAMGPreconditioner() = default;
+
+std::size_t EigenAMGPreconditioner::getNumberOfLevels() const
+{
+    return _levels.size() + 1;
+}
+
+void EigenAMGPreconditioner::setup(Matrix A)
+{
+    A.makeCompressed();
+    bool const reuse_aggregates = !_structure.update(A) && _coarse_solver;
+
+    std::vector<std::vector<Index>> previous_aggregates;
+    if (reuse_aggregates)
+    {
+        for (auto& level : _levels)
+        {
+            previous_aggregates.push_back(std::move(level.aggregates));
+        }
+    }
+    _levels.clear();
+
+    while (A.rows() > max_coarse_size && _levels.size() + 1 < max_levels)
+    {
+        auto const l = _levels.size();
+        Level level;
+        level.A = std::move(A);
+        level.damped_inverse_diagonal =
+            computeDampedInverseDiagonal(level.A);
+        level.aggregates = l < previous_aggregates.size()
+                               ? std::move(previous_aggregates[l])
+                               : computeAggregates(level.A);
+
+        auto const n_aggregates =
+            level.aggregates.empty()
+                ? 0
+                : *std::max_element(level.aggregates.begin(),
+                                    level.aggregates.end()) +
+                      1;
+        if (n_aggregates == 0 || n_aggregates >= 0.9 * level.A.rows())
+        {
+            // The coarsening stagnates.
+            A = std::move(level.A);
+            break;
+        }
+
+        level.P = computeProlongator(level.A, level.damped_inverse_diagonal,
+                                     level.aggregates, n_aggregates);
+        level.R = level.P.transpose();
+        Matrix const AP = level.A * level.P;
+        A = level.R * AP;
+        A.makeCompressed();
+
+        _levels.push_back(std::move(level));
+    }
+
+    DBUG("AMG hierarchy with %d levels, coarse matrix size %d.",
+         static_cast<int>(getNumberOfLevels()), static_cast<int>(A.rows()));
+
+    _coarse_solver = std::make_unique<CoarseSolver>();
+    Eigen::SparseMatrix<double> const coarse_A = A;
+    _coarse_solver->lu.compute(coarse_A);
+    _info = _coarse_solver->lu.info();
+}
+
+void EigenAMGPreconditioner::applyVCycle(std::size_t const level,
+                                         Vector const& b, Vector& x) const
+{
+    if (level == _levels.size())
+    {
+        x = _coarse_solver->lu.solve(b);
+        return;
+    }
+
+    auto const& l = _levels[level];
+
+    // Pre-smoothing starting from zero.
+    x = l.damped_inverse_diagonal.cwiseProduct(b);
+
+    // Coarse grid correction.
+    l.r = b - l.A * x;
+    l.coarse_b = l.R * l.r;
+    applyVCycle(level + 1, l.coarse_b, l.coarse_x);
+    x += l.P * l.coarse_x;
+
+    // Post-smoothing.
+    l.r = b - l.A * x;
+    x += l.damped_inverse_diagonal.cwiseProduct(l.r);
+}
+}  // namespace MathLib
@@ -0,0 +1,111 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+#include "EigenSparsityStructure.h"
+
+namespace MathLib
+{
+/**
+ * Smoothed aggregation algebraic multigrid preconditioner usable with the
+ * iterative solvers of Eigen, e.g. Eigen::ConjugateGradient.
+ *
+ * The hierarchy is built as follows:
+ * - The unknowns of each level are grouped into aggregates of strongly
+ *   connected unknowns, where \f$a_{ij}\f$ is strong if
+ *   \f$|a_{ij}| \geq \theta \sqrt{|a_{ii} a_{jj}|}\f$. Unknowns without strong
+ *   connections, e.g. those of Dirichlet boundary conditions, are not
+ *   aggregated and only treated by the smoother.
+ * - The piecewise constant tentative prolongator of the aggregates is
+ *   smoothed by one damped Jacobi step, \f$P = (I - \omega D^{-1} A) T\f$
+ *   with \f$\omega = 4/(3\rho)\f$ and an upper bound \f$\rho\f$ of the
+ *   spectral radius of \f$D^{-1} A\f$.
+ * - The coarse matrix is the Galerkin product \f$P^T A P\f$.
+ * - The coarsening stops at a small coarse matrix, which is factorized by a
+ *   sparse LU decomposition.
+ *
+ * One application is a V-cycle with one damped Jacobi pre- and
+ * post-smoothing step on each level. The preconditioner is symmetric for
+ * symmetric matrices and can be used with the CG method then.
+ *
+ * The constant near null space makes the preconditioner suitable for scalar
+ * elliptic problems, e.g. diffusion or heat conduction. For the displacements
+ * of mechanics problems the rigid body modes would be needed.
+ *
+ * If the sparsity structure of the matrix did not change since the previous
+ * setup, the aggregates are reused and only the prolongators and the coarse
+ * matrices are recomputed.
+ */
+class EigenAMGPreconditioner final
+{
+public:
+    using Matrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+    using Vector = Eigen::VectorXd;
+
+    EigenAMGPreconditioner();
+    ~EigenAMGPreconditioner();
+
+    template <typename MatType>
+    EigenAMGPreconditioner& analyzePattern(MatType const& /*A*/)
+    {
+        return *this;
+    }
+
+    template <typename MatType>
+    EigenAMGPreconditioner& factorize(MatType const& A)
+    {
+        setup(Matrix(A));
+        return *this;
+    }
+
+    template <typename MatType>
+    EigenAMGPreconditioner& compute(MatType const& A)
+    {
+        return factorize(A);
+    }
+
+    /// Applies one V-cycle to \c b.
+    template <typename Rhs>
+    Vector solve(Rhs const& b) const
+    {
+        Vector const rhs = b;
+        Vector x;
+        applyVCycle(0, rhs, x);
+        return x;
+    }
+
+    Eigen::ComputationInfo info() const { return _info; }
+
+    /// Number of levels including the coarsest one.
+    std::size_t getNumberOfLevels() const;
+
+private:
+    struct Level;
+    struct CoarseSolver;
+
+    void setup(Matrix A);
+
+    void applyVCycle(std::size_t level, Vector const& b, Vector& x) const;
+
+    /// All but the coarsest level.
+    std::vector<Level> _levels;
+    std::unique_ptr<CoarseSolver> _coarse_solver;
+
+    details::SparsityStructure _structure;
+    Eigen::ComputationInfo _info = Eigen::Success;
+};
+}  // namespace MathLib
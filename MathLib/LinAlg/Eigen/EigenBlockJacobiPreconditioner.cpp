@@ -0,0 +1,60 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "EigenBlockJacobiPreconditioner.h"
+
+#include <algorithm>
+
+namespace MathLib
+{
+void EigenBlockJacobiPreconditioner::setup(Matrix const& A)
+{
+    auto const n = A.rows();
+    auto const number_of_blocks = static_cast<Eigen::Index>(std::max(
+        1, std::min<int>(static_cast<int>(n), _number_of_blocks > 0
+                                                  ? _number_of_blocks
+                                                  : Eigen::nbThreads())));
+
+    _blocks.resize(number_of_blocks);
+    for (Eigen::Index k = 0; k < number_of_blocks; ++k)
+    {
+        _blocks[k].begin = k * n / number_of_blocks;
+        _blocks[k].size = (k + 1) * n / number_of_blocks - _blocks[k].begin;
+        if (!_blocks[k].ilut)
+        {
+            _blocks[k].ilut = std::make_unique<Eigen::IncompleteLUT<double>>();
+        }
+    }
+
+    bool success = true;
+#pragma omp parallel for reduction(&& : success) schedule(static, 1)
+    for (Eigen::Index k = 0; k < number_of_blocks; ++k)
+    {
+        auto& block = _blocks[k];
+        Matrix const A_block =
+            A.block(block.begin, block.begin, block.size, block.size);
+        block.ilut->compute(A_block);
+        success = success && block.ilut->info() == Eigen::Success;
+    }
+    _info = success ? Eigen::Success : Eigen::NumericalIssue;
+}
+
+void EigenBlockJacobiPreconditioner::apply(Vector const& b, Vector& x) const
+{
+    auto const number_of_blocks = static_cast<Eigen::Index>(_blocks.size());
+#pragma omp parallel for schedule(static, 1)
+    for (Eigen::Index k = 0; k < number_of_blocks; ++k)
+    {
+        auto const& block = _blocks[k];
+        x.segment(block.begin, block.size) =
+            block.ilut->solve(b.segment(block.begin, block.size));
+    }
+}
+}  // namespace MathLib
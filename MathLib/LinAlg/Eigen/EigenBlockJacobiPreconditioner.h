@@ -0,0 +1,93 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCore>
+
+namespace MathLib
+{
+/**
+ * Block Jacobi preconditioner with incomplete LU factorizations (ILUT) of the
+ * diagonal blocks, usable with the iterative solvers of Eigen.
+ *
+ * The unknowns are split into contiguous ranges of about the same size, one
+ * per thread of Eigen (see Eigen::nbThreads()) unless the number of blocks is
+ * set explicitly. The couplings between the blocks are dropped, such that the
+ * blocks are factorized and applied concurrently by OpenMP threads. Compared
+ * to a global ILUT the preconditioner becomes weaker with the number of
+ * blocks, i.e., the iteration numbers depend on the number of threads.
+ */
+class EigenBlockJacobiPreconditioner final
+{
+public:
+    using Matrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+    using Vector = Eigen::VectorXd;
+
+    /// Uses the given number of blocks instead of the number of threads.
+    void setNumberOfBlocks(int const number_of_blocks)
+    {
+        _number_of_blocks = number_of_blocks;
+    }
+
+    template <typename MatType>
+    EigenBlockJacobiPreconditioner& analyzePattern(MatType const& /*A*/)
+    {
+        return *this;
+    }
+
+    template <typename MatType>
+    EigenBlockJacobiPreconditioner& factorize(MatType const& A)
+    {
+        setup(Matrix(A));
+        return *this;
+    }
+
+    template <typename MatType>
+    EigenBlockJacobiPreconditioner& compute(MatType const& A)
+    {
+        return factorize(A);
+    }
+
+    template <typename Rhs>
+    Vector solve(Rhs const& b) const
+    {
+        Vector x(b.size());
+        apply(b, x);
+        return x;
+    }
+
+    Eigen::ComputationInfo info() const { return _info; }
+
+    std::size_t getNumberOfBlocks() const { return _blocks.size(); }
+
+private:
+    void setup(Matrix const& A);
+
+    void apply(Vector const& b, Vector& x) const;
+
+    struct Block
+    {
+        Eigen::Index begin;
+        Eigen::Index size;
+        // IncompleteLUT is not movable.
+        std::unique_ptr<Eigen::IncompleteLUT<double>> ilut;
+    };
+
+    int _number_of_blocks = 0;
+    std::vector<Block> _blocks;
+    Eigen::ComputationInfo _info = Eigen::Success;
+};
+}  // namespace MathLib
@@ -0,0 +1,188 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "EigenKnownSolutionIndex.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+#include "BaseLib/Error.h"
+
+namespace MathLib
+{
+void EigenKnownSolutionIndex::reset(RawMatrixType const& A,
+                                    std::vector<IndexType> const& ids)
+{
+    assert(A.isCompressed());
+    auto const n = A.rows();
+    auto const* const outer = A.outerIndexPtr();
+    auto const* const inner = A.innerIndexPtr();
+
+    _ids = ids;
+    _number_of_rows = n;
+    _number_of_nonzeros = A.nonZeros();
+
+    std::vector<char> is_known(n, 0);
+    _diagonal_positions.clear();
+    _diagonal_positions.reserve(ids.size());
+    for (auto const id : ids)
+    {
+        is_known[id] = 1;
+        auto const* const begin = inner + outer[id];
+        auto const* const end = inner + outer[id + 1];
+        // The column indices within a row are sorted.
+        auto const* const it = std::lower_bound(begin, end, id);
+        if (it == end || *it != id)
+        {
+            OGS_FATAL(
+                "The diagonal entry of the known solution %d is not in the "
+                "sparsity structure of the matrix.",
+                static_cast<int>(id));
+        }
+        _diagonal_positions.push_back(static_cast<StorageIndex>(it - inner));
+    }
+
+    // Counting sort of the entries in the known columns by their column.
+    std::vector<std::size_t> column_offsets(n + 1, 0);
+    for (IndexType row = 0; row < n; ++row)
+    {
+        if (is_known[row])
+        {
+            continue;
+        }
+        for (auto k = outer[row]; k < outer[row + 1]; ++k)
+        {
+            if (is_known[inner[k]])
+            {
+                ++column_offsets[inner[k] + 1];
+            }
+        }
+    }
+    std::partial_sum(column_offsets.begin(), column_offsets.end(),
+                     column_offsets.begin());
+
+    auto const number_of_entries = column_offsets[n];
+    _column_positions.resize(number_of_entries);
+    _column_rows.resize(number_of_entries);
+    _column_columns.resize(number_of_entries);
+    std::vector<std::size_t> fill(column_offsets.begin(),
+                                  column_offsets.end() - 1);
+    for (IndexType row = 0; row < n; ++row)
+    {
+        if (is_known[row])
+        {
+            continue;
+        }
+        for (auto k = outer[row]; k < outer[row + 1]; ++k)
+        {
+            auto const col = inner[k];
+            if (is_known[col])
+            {
+                auto const i = fill[col]++;
+                _column_positions[i] = k;
+                _column_rows[i] = static_cast<StorageIndex>(row);
+                _column_columns[i] = col;
+            }
+        }
+    }
+
+    _column_begin.clear();
+    _column_end.clear();
+    for (auto const id : ids)
+    {
+        _column_begin.push_back(column_offsets[id]);
+        _column_end.push_back(column_offsets[id + 1]);
+    }
+}
+
+bool EigenKnownSolutionIndex::isValidFor(
+    RawMatrixType const& A, std::vector<IndexType> const& ids) const
+{
+    if (!A.isCompressed() || A.rows() != _number_of_rows ||
+        A.nonZeros() != _number_of_nonzeros || ids != _ids)
+    {
+        return false;
+    }
+
+    auto const* const outer = A.outerIndexPtr();
+    auto const* const inner = A.innerIndexPtr();
+    auto const is_in_row = [&](StorageIndex const position,
+                               IndexType const row) {
+        return outer[row] <= position && position < outer[row + 1];
+    };
+
+    for (std::size_t i = 0; i < _ids.size(); ++i)
+    {
+        auto const position = _diagonal_positions[i];
+        if (inner[position] != _ids[i] || !is_in_row(position, _ids[i]))
+        {
+            return false;
+        }
+    }
+    for (std::size_t i = 0; i < _column_positions.size(); ++i)
+    {
+        auto const position = _column_positions[i];
+        if (inner[position] != _column_columns[i] ||
+            !is_in_row(position, _column_rows[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void EigenKnownSolutionIndex::apply(RawMatrixType& A, Eigen::VectorXd& b,
+                                    std::vector<double> const& values) const
+{
+    assert(isValidFor(A, _ids));
+    assert(values.size() == _ids.size());
+    auto const* const outer = A.outerIndexPtr();
+    double* const a = A.valuePtr();
+
+    // A(k, j) = 0 for j != k.
+    for (std::size_t i = 0; i < _ids.size(); ++i)
+    {
+        auto const row = _ids[i];
+        for (auto k = outer[row]; k < outer[row + 1]; ++k)
+        {
+            if (k != _diagonal_positions[i])
+            {
+                a[k] = 0.0;
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < _ids.size(); ++i)
+    {
+        auto const x = values[i];
+
+        // b_j -= A(j, k) * x, A(j, k) = 0 for j != k.
+        for (auto e = _column_begin[i]; e < _column_end[i]; ++e)
+        {
+            auto& value = a[_column_positions[e]];
+            b[_column_rows[e]] -= value * x;
+            value = 0.0;
+        }
+
+        auto& c = a[_diagonal_positions[i]];
+        if (c != 0.0)
+        {
+            b[_ids[i]] = x * c;
+        }
+        else
+        {
+            b[_ids[i]] = x;
+            c = 1.0;
+        }
+    }
+}
+
+}  // namespace MathLib
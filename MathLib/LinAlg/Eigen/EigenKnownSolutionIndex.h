@@ -0,0 +1,73 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+
+namespace MathLib
+{
+/// Positions of the matrix entries modified by the application of known
+/// solutions, i.e., of Dirichlet boundary conditions, to a row-major sparse
+/// matrix of fixed sparsity structure.
+///
+/// The entries in the columns of the known solutions are scattered over many
+/// rows of a row-major matrix. Finding them requires a pass over all entries
+/// or a transposed copy of the matrix. The index stores their positions in
+/// the value array once per set of known solutions, so that each application
+/// only touches the rows and columns of the known solutions.
+class EigenKnownSolutionIndex final
+{
+public:
+    using RawMatrixType = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+    using IndexType = RawMatrixType::Index;
+    using StorageIndex = RawMatrixType::StorageIndex;
+
+    /// Computes the positions of the entries in the rows and columns of the
+    /// known solutions \c ids. The matrix \c A must be compressed and contain
+    /// the diagonal entries of the known solutions.
+    void reset(RawMatrixType const& A, std::vector<IndexType> const& ids);
+
+    /// Whether the index has been computed for the given \c ids and the
+    /// sparsity structure of \c A. Only the rows and the positions stored in
+    /// the index are compared.
+    bool isValidFor(RawMatrixType const& A,
+                    std::vector<IndexType> const& ids) const;
+
+    /// Sets the rows and columns of the known solutions to zero except for the
+    /// diagonal entries and moves the column entries to the right-hand side.
+    /// The index must be valid for \c A.
+    void apply(RawMatrixType& A, Eigen::VectorXd& b,
+               std::vector<double> const& values) const;
+
+private:
+    std::vector<IndexType> _ids;
+    IndexType _number_of_rows = 0;
+    IndexType _number_of_nonzeros = 0;
+
+    /// Position of the diagonal entry of each known solution.
+    std::vector<StorageIndex> _diagonal_positions;
+
+    /// Entries of each known solution's column outside of the known rows,
+    /// stored contiguously; the entries of known solution i are in the range
+    /// [_column_begin[i], _column_end[i]).
+    std::vector<std::size_t> _column_begin;
+    std::vector<std::size_t> _column_end;
+    std::vector<StorageIndex> _column_positions;
+    std::vector<StorageIndex> _column_rows;
+    /// Column index of each stored entry, which is used for the validation.
+    std::vector<StorageIndex> _column_columns;
+};
+
+}  // namespace MathLib
@@ -10,6 +10,11 @@
 
 #include "EigenLinearSolver.h"
 
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <vector>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_MKL
@@ -23,8 +28,14 @@
 #endif
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/ConvergenceTelemetry.h"
+#include "BaseLib/RunTime.h"
+#include "BaseLib/Timing.h"
+#include "EigenAMGPreconditioner.h"
+#include "EigenBlockJacobiPreconditioner.h"
 #include "EigenVector.h"
 #include "EigenMatrix.h"
+#include "EigenSparsityStructure.h"
 #include "EigenTools.h"
 
 #include "MathLib/LinAlg/LinearSolverOptions.h"
@@ -42,18 +53,60 @@ public:
     virtual ~EigenLinearSolverBase() = default;
 
     //! Solves the linear equation system \f$ A x = b \f$ for \f$ x \f$.
-    virtual bool solve(Matrix &A, Vector const& b, Vector &x, EigenOption &opt) = 0;
+    //!
+    //! If \c reuse_setup is set, the factorization or preconditioner of the
+    //! previous call is used and \c A must not have changed since then.
+    virtual bool solve(Matrix& A, Vector const& b, Vector& x, EigenOption& opt,
+                       bool const reuse_setup) = 0;
 };
 
 namespace details
 {
+/// Copy of a compressed matrix for the detection of an unchanged matrix
+/// between subsequent solves.
+class MatrixCopy final
+{
+public:
+    using Matrix = EigenMatrix::RawMatrixType;
+
+    /// Adopts \c A and returns true if it differs from the previously adopted
+    /// matrix. A matrix at another address is always considered different.
+    bool update(Matrix const& A)
+    {
+        assert(A.isCompressed());
+        auto const* const values = A.valuePtr();
+        auto const nnz = static_cast<std::size_t>(A.nonZeros());
+
+        bool const structure_changed = _structure.update(A);
+        if (!structure_changed && _matrix == &A &&
+            std::equal(_values.begin(), _values.end(), values))
+        {
+            return false;
+        }
+
+        _matrix = &A;
+        _values.assign(values, values + nnz);
+        return true;
+    }
+
+private:
+    Matrix const* _matrix = nullptr;
+    SparsityStructure _structure;
+    std::vector<double> _values;
+};
 
 /// Template class for Eigen direct linear solvers
+///
+/// The ordering and symbolic analysis are only redone if the sparsity
+/// structure of the matrix changed since the previous solve, e.g., if
+/// subdomains have been (de)activated. Otherwise only the numerical
+/// factorization is computed.
 template <class T_SOLVER>
 class EigenDirectLinearSolver final : public EigenLinearSolverBase
 {
 public:
-    bool solve(Matrix& A, Vector const& b, Vector& x, EigenOption& opt) override
+    bool solve(Matrix& A, Vector const& b, Vector& x, EigenOption& opt,
+               bool const reuse_setup) override
     {
         INFO("-> solve with %s",
              EigenOption::getSolverName(opt.solver_type).c_str());
@@ -62,13 +115,29 @@ public:
             A.makeCompressed();
         }
 
-        _solver.compute(A);
+        if (!reuse_setup)
+        {
+            static auto& region =
+                BaseLib::Timing::getRegion("linear_solver/setup");
+            BaseLib::Timing::ScopedTimer const timer{region};
+            if (_structure.update(A))
+            {
+                DBUG("Sparsity structure changed; recomputing the ordering.");
+                _solver.analyzePattern(A);
+            }
+            _solver.factorize(A);
+        }
         if(_solver.info()!=Eigen::Success) {
             ERR("Failed during Eigen linear solver initialization");
             return false;
         }
 
-        x = _solver.solve(b);
+        {
+            static auto& region =
+                BaseLib::Timing::getRegion("linear_solver/solve");
+            BaseLib::Timing::ScopedTimer const timer{region};
+            x = _solver.solve(b);
+        }
         if(_solver.info()!=Eigen::Success) {
             ERR("Failed during Eigen linear solve");
             return false;
@@ -79,6 +148,103 @@ public:
 
 private:
     T_SOLVER _solver;
+    SparsityStructure _structure;
+};
+
+/// Sparse LU factorization in single precision with iterative refinement in
+/// double precision.
+///
+/// The correction of the solution is computed with the single precision
+/// factors from the double precision residual until the relative residual
+/// drops below the error tolerance. The refinement stops early if the
+/// residual stagnates, which happens for ill-conditioned matrices.
+class EigenMixedPrecisionLinearSolver final : public EigenLinearSolverBase
+{
+public:
+    bool solve(Matrix& A, Vector const& b, Vector& x, EigenOption& opt,
+               bool const reuse_setup) override
+    {
+        INFO("-> solve with %s",
+             EigenOption::getSolverName(opt.solver_type).c_str());
+        if (!A.isCompressed())
+        {
+            A.makeCompressed();
+        }
+
+        if (!reuse_setup)
+        {
+            static auto& region =
+                BaseLib::Timing::getRegion("linear_solver/setup");
+            BaseLib::Timing::ScopedTimer const timer{region};
+            _A_float = A.cast<float>();
+            if (_structure.update(A))
+            {
+                DBUG("Sparsity structure changed; recomputing the ordering.");
+                _solver.analyzePattern(_A_float);
+            }
+            _solver.factorize(_A_float);
+        }
+        if (_solver.info() != Eigen::Success)
+        {
+            ERR("Failed during Eigen linear solver initialization");
+            return false;
+        }
+
+        static auto& region = BaseLib::Timing::getRegion("linear_solver/solve");
+        BaseLib::Timing::ScopedTimer const timer{region};
+
+        double const b_norm = b.norm();
+        if (b_norm == 0.0)
+        {
+            x.setZero();
+            return true;
+        }
+
+        x.setZero();
+        Vector r = b;
+        double r_norm = b_norm;
+        int iteration = 0;
+        while (iteration < opt.max_iterations &&
+               r_norm > opt.error_tolerance * b_norm)
+        {
+            Eigen::VectorXf const dx = _solver.solve(r.cast<float>());
+            if (_solver.info() != Eigen::Success)
+            {
+                ERR("Failed during Eigen linear solve");
+                return false;
+            }
+            x += dx.cast<double>();
+            r = b - A * x;
+            ++iteration;
+
+            double const previous_r_norm = r_norm;
+            r_norm = r.norm();
+            if (r_norm > 0.5 * previous_r_norm)
+            {
+                break;  // stagnation
+            }
+        }
+        INFO("\t refinement iteration: %d/%d", iteration, opt.max_iterations);
+        BaseLib::ConvergenceTelemetry::addLinearIterations(iteration);
+        INFO("\t residual: %e\n", r_norm / b_norm);
+
+        if (r_norm > opt.error_tolerance * b_norm)
+        {
+            ERR("The iterative refinement did not reach the error tolerance "
+                "%g.",
+                opt.error_tolerance);
+            return false;
+        }
+
+        return true;
+    }
+
+private:
+    using FloatMatrix = Eigen::SparseMatrix<float, Eigen::ColMajor>;
+
+    FloatMatrix _A_float;
+    Eigen::SparseLU<FloatMatrix, Eigen::COLAMDOrdering<int>> _solver;
+    SparsityStructure _structure;
 };
 
 /// Template class for Eigen iterative linear solvers
@@ -86,7 +252,8 @@ template <class T_SOLVER>
 class EigenIterativeLinearSolver final : public EigenLinearSolverBase
 {
 public:
-    bool solve(Matrix& A, Vector const& b, Vector& x, EigenOption& opt) override
+    bool solve(Matrix& A, Vector const& b, Vector& x, EigenOption& opt,
+               bool const reuse_setup) override
     {
         INFO("-> solve with %s (precon %s)",
              EigenOption::getSolverName(opt.solver_type).c_str(),
@@ -99,14 +266,27 @@ public:
             A.makeCompressed();
         }
 
-        _solver.compute(A);
+        if (!reuse_setup)
+        {
+            static auto& region =
+                BaseLib::Timing::getRegion("linear_solver/setup");
+            BaseLib::Timing::ScopedTimer const timer{region};
+            _solver.compute(A);
+        }
         if(_solver.info()!=Eigen::Success) {
             ERR("Failed during Eigen linear solver initialization");
             return false;
         }
 
-        x = _solver.solveWithGuess(b, x);
+        {
+            static auto& region =
+                BaseLib::Timing::getRegion("linear_solver/solve");
+            BaseLib::Timing::ScopedTimer const timer{region};
+            x = _solver.solveWithGuess(b, x);
+        }
         INFO("\t iteration: %d/%ld", _solver.iterations(), opt.max_iterations);
+        BaseLib::ConvergenceTelemetry::addLinearIterations(
+            static_cast<int>(_solver.iterations()));
         INFO("\t residual: %e\n", _solver.error());
 
         if(_solver.info()!=Eigen::Success) {
@@ -145,13 +325,22 @@ std::unique_ptr<EigenLinearSolverBase> createIterativeSolver(
             // see https://eigen.tuxfamily.org/dox/classEigen_1_1IncompleteLUT.html
             return createIterativeSolver<
                 Solver, Eigen::IncompleteLUT<double>>();
+        case EigenOption::PreconType::AMG:
+            return createIterativeSolver<Solver, EigenAMGPreconditioner>();
+        case EigenOption::PreconType::BLOCK_JACOBI_ILUT:
+            return createIterativeSolver<Solver,
+                                         EigenBlockJacobiPreconditioner>();
         default:
             OGS_FATAL("Invalid Eigen preconditioner type.");
     }
 }
 
+// The full matrix is stored. Using both triangles allows Eigen to compute the
+// products of the row-major matrix with vectors by multiple threads, which it
+// does not for a self-adjoint view of one triangle.
 template <typename Mat, typename Precon>
-using EigenCGSolver = Eigen::ConjugateGradient<Mat, Eigen::Lower, Precon>;
+using EigenCGSolver =
+    Eigen::ConjugateGradient<Mat, Eigen::Lower | Eigen::Upper, Precon>;
 
 std::unique_ptr<EigenLinearSolverBase> createIterativeSolver(
     EigenOption::SolverType solver_type, EigenOption::PreconType precon_type)
@@ -177,40 +366,30 @@ std::unique_ptr<EigenLinearSolverBase> createIterativeSolver(
     }
 }
 
-}  // namespace details
-
-EigenLinearSolver::EigenLinearSolver(
-                            const std::string& /*solver_name*/,
-                            const BaseLib::ConfigTree* const option)
+std::unique_ptr<EigenLinearSolverBase> createLinearSolver(
+    EigenOption const& option)
 {
     using Matrix = EigenMatrix::RawMatrixType;
 
-    if (option)
-    {
-        setOption(*option);
-    }
-
     // TODO for my taste it is much too unobvious that the default solver type
     //      currently is SparseLU.
-    switch (_option.solver_type) {
+    switch (option.solver_type) {
         case EigenOption::SolverType::SparseLU: {
             using SolverType =
                 Eigen::SparseLU<Matrix, Eigen::COLAMDOrdering<int>>;
-            _solver = std::make_unique<
-                details::EigenDirectLinearSolver<SolverType>>();
-            return;
+            return std::make_unique<EigenDirectLinearSolver<SolverType>>();
         }
+        case EigenOption::SolverType::MixedPrecisionLU:
+            return std::make_unique<EigenMixedPrecisionLinearSolver>();
         case EigenOption::SolverType::BiCGSTAB:
         case EigenOption::SolverType::CG:
         case EigenOption::SolverType::GMRES:
-            _solver = details::createIterativeSolver(_option.solver_type,
-                                                     _option.precon_type);
-            return;
+            return createIterativeSolver(option.solver_type,
+                                         option.precon_type);
         case EigenOption::SolverType::PardisoLU: {
 #ifdef USE_MKL
             using SolverType = Eigen::PardisoLU<EigenMatrix::RawMatrixType>;
-            _solver.reset(new details::EigenDirectLinearSolver<SolverType>);
-            return;
+            return std::make_unique<EigenDirectLinearSolver<SolverType>>();
 #else
             OGS_FATAL(
                 "The code is not compiled with Intel MKL. Linear solver type "
@@ -222,6 +401,150 @@ EigenLinearSolver::EigenLinearSolver(
     OGS_FATAL("Invalid Eigen linear solver type. Aborting.");
 }
 
+std::string configurationName(EigenOption const& option)
+{
+    return "<solver_type>" + EigenOption::getSolverName(option.solver_type) +
+           "</solver_type><precon_type>" +
+           EigenOption::getPreconName(option.precon_type) + "</precon_type>";
+}
+
+/// Benchmarks several solver configurations on the equation systems of the
+/// first solves and selects the fastest one, which converged in all of them.
+///
+/// Each candidate solves every system from the same initial guess; the
+/// solution of the fastest successful candidate is returned. A candidate,
+/// which failed once, is not tried again.
+class AutoTuning final
+{
+public:
+    /// The first option is the configured one, which is kept if all
+    /// candidates fail.
+    AutoTuning(std::vector<EigenOption> const& options,
+               int const number_of_solves)
+        : _remaining_solves(number_of_solves)
+    {
+        for (auto const& option : options)
+        {
+            _candidates.push_back({option, createLinearSolver(option)});
+        }
+    }
+
+    bool solve(EigenLinearSolverBase::Matrix& A,
+               EigenLinearSolverBase::Vector const& b,
+               EigenLinearSolverBase::Vector& x, double const error_tolerance,
+               bool const reuse_setup)
+    {
+        INFO("-> auto-tuning: %d solves remaining", _remaining_solves);
+        EigenLinearSolverBase::Vector const x0 = x;
+        EigenLinearSolverBase::Vector x_candidate;
+        double fastest = std::numeric_limits<double>::infinity();
+        for (auto& candidate : _candidates)
+        {
+            if (candidate.failed)
+            {
+                continue;
+            }
+            auto option = candidate.option;
+            option.error_tolerance = error_tolerance;
+            x_candidate = x0;
+
+            BaseLib::RunTime time_solve;
+            time_solve.start();
+            bool const success = candidate.solver->solve(A, b, x_candidate,
+                                                         option, reuse_setup);
+            double const elapsed = time_solve.elapsed();
+            candidate.time += elapsed;
+            if (!success)
+            {
+                INFO("-> auto-tuning: %s failed",
+                     configurationName(candidate.option).c_str());
+                candidate.failed = true;
+                continue;
+            }
+            if (elapsed < fastest)
+            {
+                fastest = elapsed;
+                x = x_candidate;
+            }
+        }
+        --_remaining_solves;
+        return fastest < std::numeric_limits<double>::infinity();
+    }
+
+    bool finished() const
+    {
+        return _remaining_solves <= 0 ||
+               std::all_of(_candidates.begin(), _candidates.end(),
+                           [](auto const& c) { return c.failed; });
+    }
+
+    /// Reports the results and moves the selected solver into \c solver and
+    /// its configuration into \c option. If all candidates failed, the
+    /// configured solver is kept.
+    void select(std::unique_ptr<EigenLinearSolverBase>& solver,
+                EigenOption& option)
+    {
+        INFO("Auto-tuning of the linear solver finished:");
+        for (auto const& candidate : _candidates)
+        {
+            INFO("\t%s: %s%g s", configurationName(candidate.option).c_str(),
+                 candidate.failed ? "failed after " : "", candidate.time);
+        }
+
+        auto best = _candidates.end();
+        for (auto c = _candidates.begin(); c != _candidates.end(); ++c)
+        {
+            if (!c->failed &&
+                (best == _candidates.end() || c->time < best->time))
+            {
+                best = c;
+            }
+        }
+        if (best == _candidates.end())
+        {
+            WARN(
+                "All candidates of the auto-tuning failed; keeping the "
+                "configured linear solver.");
+            best = _candidates.begin();
+        }
+        else
+        {
+            INFO("Selected the linear solver %s.",
+                 configurationName(best->option).c_str());
+        }
+        option.solver_type = best->option.solver_type;
+        option.precon_type = best->option.precon_type;
+        solver = std::move(best->solver);
+    }
+
+private:
+    struct Candidate
+    {
+        EigenOption option;
+        std::unique_ptr<EigenLinearSolverBase> solver;
+        /// Total time of the setups and solves.
+        double time = 0;
+        bool failed = false;
+    };
+
+    std::vector<Candidate> _candidates;
+    int _remaining_solves;
+};
+
+}  // namespace details
+
+EigenLinearSolver::EigenLinearSolver(
+                            const std::string& /*solver_name*/,
+                            const BaseLib::ConfigTree* const option)
+{
+    if (option)
+    {
+        setOption(*option);
+    }
+
+    _solver = details::createLinearSolver(_option);
+}
+
 EigenLinearSolver::~EigenLinearSolver() = default;
 
 void EigenLinearSolver::setOption(BaseLib::ConfigTree const& option)
@@ -254,6 +577,25 @@ void EigenLinearSolver::setOption(BaseLib::ConfigTree const& option)
             ptSolver->getConfigParameterOptional<int>("max_iteration_step")) {
         _option.max_iterations = *max_iteration_step;
     }
+    if (auto reuse_setup_for_unchanged_matrix =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__reuse_setup_for_unchanged_matrix}
+        ptSolver->getConfigParameterOptional<bool>(
+            "reuse_setup_for_unchanged_matrix"))
+    {
+        _option.reuse_setup_for_unchanged_matrix =
+            *reuse_setup_for_unchanged_matrix;
+    }
+    if (auto number_of_threads =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__number_of_threads}
+        ptSolver->getConfigParameterOptional<int>("number_of_threads"))
+    {
+        if (*number_of_threads < 0)
+        {
+            OGS_FATAL("The number of threads must not be negative, got %d.",
+                      *number_of_threads);
+        }
+        _option.number_of_threads = *number_of_threads;
+    }
     if (auto scaling =
             //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__scaling}
             ptSolver->getConfigParameterOptional<bool>("scaling")) {
@@ -265,6 +607,42 @@ void EigenLinearSolver::setOption(BaseLib::ConfigTree const& option)
             "scaling is not available.");
 #endif
     }
+    // The candidates inherit the other settings, hence they are parsed last.
+    if (auto const auto_tune_config =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__auto_tune}
+        ptSolver->getConfigSubtreeOptional("auto_tune"))
+    {
+        auto const number_of_solves =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__auto_tune__number_of_solves}
+            auto_tune_config->getConfigParameter<int>("number_of_solves");
+        if (number_of_solves < 1)
+        {
+            OGS_FATAL(
+                "The number of solves of the auto-tuning must be positive, got "
+                "%d.",
+                number_of_solves);
+        }
+
+        std::vector<EigenOption> options{_option};
+        for (
+            auto candidate_config :
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__auto_tune__candidate}
+            auto_tune_config->getConfigSubtreeList("candidate"))
+        {
+            auto option = _option;
+            option.solver_type = MathLib::EigenOption::getSolverType(
+                //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__auto_tune__candidate__solver_type}
+                candidate_config.getConfigParameter<std::string>(
+                    "solver_type"));
+            option.precon_type = MathLib::EigenOption::getPreconType(
+                //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__auto_tune__candidate__precon_type}
+                candidate_config.getConfigParameter<std::string>("precon_type",
+                                                                 "NONE"));
+            options.push_back(option);
+        }
+        _auto_tuning =
+            std::make_unique<details::AutoTuning>(options, number_of_solves);
+    }
 }
 
 bool EigenLinearSolver::solve(EigenMatrix &A, EigenVector& b, EigenVector &x)
@@ -272,25 +650,92 @@ bool EigenLinearSolver::solve(EigenMatrix &A, EigenVector& b, EigenVector &x)
     INFO("------------------------------------------------------------------");
     INFO("*** Eigen solver computation");
 
+    bool reuse_setup = _reuse_setup && _has_setup;
+    _reuse_setup = false;
+    // The copy is only updated if a new setup is computed, such that it always
+    // corresponds to the current factorization or preconditioner.
+    if (_option.reuse_setup_for_unchanged_matrix && !reuse_setup)
+    {
+        auto& raw_A = A.getRawMatrix();
+        if (!raw_A.isCompressed())
+        {
+            raw_A.makeCompressed();
+        }
+        if (!_setup_matrix)
+        {
+            _setup_matrix = std::make_unique<details::MatrixCopy>();
+        }
+        bool const matrix_changed = _setup_matrix->update(raw_A);
+        reuse_setup = _has_setup && !matrix_changed;
+        if (reuse_setup)
+        {
+            INFO("-> matrix unchanged since the previous setup");
+        }
+    }
+    if (reuse_setup)
+    {
+        INFO("-> reuse the setup of the previous solve");
+    }
+
+    auto option = _option;
+    if (_relative_tolerance)
+    {
+        option.error_tolerance = *_relative_tolerance;
+    }
+
 #ifdef USE_EIGEN_UNSUPPORTED
-    std::unique_ptr<Eigen::IterScaling<EigenMatrix::RawMatrixType>> scal;
     if (_option.scaling)
     {
-        INFO("-> scale");
-        scal =
-            std::make_unique<Eigen::IterScaling<EigenMatrix::RawMatrixType>>();
-        scal->computeRef(A.getRawMatrix());
-        b.getRawVector() = scal->LeftScaling().cwiseProduct(b.getRawVector());
+        if (!reuse_setup)
+        {
+            INFO("-> scale");
+            Eigen::IterScaling<EigenMatrix::RawMatrixType> scal;
+            scal.computeRef(A.getRawMatrix());
+            _left_scaling = scal.LeftScaling();
+            _right_scaling = scal.RightScaling();
+        }
+        else
+        {
+            // The iterative solvers use the matrix, which has to be scaled in
+            // the same way as at the setup.
+            A.getRawMatrix() = _left_scaling.asDiagonal() * A.getRawMatrix() *
+                               _right_scaling.asDiagonal();
+        }
+        b.getRawVector() = _left_scaling.cwiseProduct(b.getRawVector());
     }
 #endif
-    auto const success = _solver->solve(A.getRawMatrix(), b.getRawVector(),
-                                        x.getRawVector(), _option);
+    // The thread count of Eigen is global; it is restored after the solve.
+    int const default_number_of_threads = Eigen::nbThreads();
+    if (_option.number_of_threads > 0)
+    {
+        Eigen::setNbThreads(_option.number_of_threads);
+    }
+    DBUG("-> using %d threads", Eigen::nbThreads());
+    bool success;
+    if (_auto_tuning)
+    {
+        success = _auto_tuning->solve(A.getRawMatrix(), b.getRawVector(),
+                                      x.getRawVector(), option.error_tolerance,
+                                      reuse_setup);
+        if (_auto_tuning->finished())
+        {
+            _auto_tuning->select(_solver, _option);
+            _auto_tuning.reset();
+        }
+    }
+    else
+    {
+        success = _solver->solve(A.getRawMatrix(), b.getRawVector(),
+                                 x.getRawVector(), option, reuse_setup);
+    }
+    Eigen::setNbThreads(default_number_of_threads);
 #ifdef USE_EIGEN_UNSUPPORTED
-    if (scal)
+    if (_option.scaling)
     {
-        x.getRawVector() = scal->RightScaling().cwiseProduct(x.getRawVector());
+        x.getRawVector() = _right_scaling.cwiseProduct(x.getRawVector());
     }
 #endif
+    _has_setup = success;
 
     INFO("------------------------------------------------------------------");
 
@@ -10,8 +10,14 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
+#include <boost/optional.hpp>
+#ifdef USE_EIGEN_UNSUPPORTED
+#include <Eigen/Core>
+#endif
+
 #include "BaseLib/ConfigTree.h"
 #include "EigenOption.h"
 
@@ -22,6 +28,11 @@ class EigenMatrix;
 class EigenVector;
 
 class EigenLinearSolverBase;
+namespace details
+{
+class AutoTuning;
+class MatrixCopy;
+}
 
 class EigenLinearSolver final
 {
@@ -56,9 +67,38 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Overrides the configured tolerance of iterative solvers in the
+    /// subsequent solves, e.g., for inexact Newton methods.
+    void setRelativeTolerance(double const tolerance)
+    {
+        _relative_tolerance = tolerance;
+    }
+
+    /// Restores the configured tolerance.
+    void resetRelativeTolerance() { _relative_tolerance = boost::none; }
+
+    /// Lets the next solve() reuse the factorization or preconditioner of the
+    /// previous one. The matrix must not have been modified in between.
+    void reuseSetupInNextSolve() { _reuse_setup = true; }
+
 protected:
     EigenOption _option;
     std::unique_ptr<EigenLinearSolverBase> _solver;
+
+private:
+    boost::optional<double> _relative_tolerance;
+    bool _reuse_setup = false;
+    bool _has_setup = false;  ///< Whether the previous solve succeeded.
+    /// Copy of the matrix of the last setup, if unchanged matrices are
+    /// detected.
+    std::unique_ptr<details::MatrixCopy> _setup_matrix;
+    /// Benchmark of the configured candidates in the first solves; reset
+    /// after the fastest one has been selected.
+    std::unique_ptr<details::AutoTuning> _auto_tuning;
+#ifdef USE_EIGEN_UNSUPPORTED
+    Eigen::VectorXd _left_scaling;
+    Eigen::VectorXd _right_scaling;
+#endif
 };
 
 }  // namespace MathLib
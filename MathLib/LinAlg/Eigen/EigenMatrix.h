@@ -17,6 +17,7 @@
 
 #include "MathLib/LinAlg/RowColumnIndices.h"
 #include "MathLib/LinAlg/SetMatrixSparsity.h"
+#include "EigenKnownSolutionIndex.h"
 #include "EigenVector.h"
 
 namespace MathLib
@@ -158,8 +159,16 @@ public:
     RawMatrixType& getRawMatrix() { return _mat; }
     const RawMatrixType& getRawMatrix() const { return _mat; }
 
+    /// The positions of the entries modified by applyKnownSolution(), which
+    /// are kept for subsequent applications of the same known solutions.
+    EigenKnownSolutionIndex& getKnownSolutionIndex()
+    {
+        return _known_solution_index;
+    }
+
 protected:
     RawMatrixType _mat;
+    EigenKnownSolutionIndex _known_solution_index;
 };
 
 template <class T_DENSE_MATRIX>
@@ -0,0 +1,98 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "EigenMatrixScatterMap.h"
+
+#include <algorithm>
+
+namespace MathLib
+{
+bool EigenMatrixScatterMap::reset(EigenMatrix const& matrix,
+                                  std::size_t const number_of_items)
+{
+    _offsets.clear();
+    _outer_indices.clear();
+    _inner_indices.clear();
+
+    auto const& A = matrix.getRawMatrix();
+    _is_valid = A.isCompressed();
+    if (!_is_valid)
+    {
+        return false;
+    }
+
+    _outer_indices.assign(A.outerIndexPtr(),
+                          A.outerIndexPtr() + A.outerSize() + 1);
+    _inner_indices.assign(A.innerIndexPtr(),
+                          A.innerIndexPtr() + A.nonZeros());
+    _offsets.resize(number_of_items);
+    return true;
+}
+
+void EigenMatrixScatterMap::invalidate()
+{
+    _is_valid = false;
+}
+
+bool EigenMatrixScatterMap::hasSameStructure(EigenMatrix const& matrix) const
+{
+    auto const& A = matrix.getRawMatrix();
+    if (!A.isCompressed() ||
+        static_cast<std::size_t>(A.outerSize()) + 1 != _outer_indices.size() ||
+        static_cast<std::size_t>(A.nonZeros()) != _inner_indices.size())
+    {
+        return false;
+    }
+
+    return std::equal(_outer_indices.begin(), _outer_indices.end(),
+                      A.outerIndexPtr()) &&
+           std::equal(_inner_indices.begin(), _inner_indices.end(),
+                      A.innerIndexPtr());
+}
+
+bool EigenMatrixScatterMap::computeOffsets(
+    std::size_t const item_id, std::vector<IndexType> const& indices)
+{
+    assert(isValid());
+    if (item_id >= _offsets.size())
+    {
+        return false;
+    }
+
+    auto& offsets = _offsets[item_id];
+    auto const n = indices.size();
+    if (offsets.size() == n * n)
+    {
+        return true;
+    }
+
+    offsets.resize(n * n);
+    std::size_t k = 0;
+    for (auto const row : indices)
+    {
+        auto const row_begin = _inner_indices.begin() + _outer_indices[row];
+        auto const row_end = _inner_indices.begin() + _outer_indices[row + 1];
+        for (auto const col : indices)
+        {
+            // The column indices within a row are sorted.
+            auto const it = std::lower_bound(row_begin, row_end, col);
+            if (it == row_end || *it != col)
+            {
+                offsets.clear();
+                return false;
+            }
+            offsets[k++] =
+                static_cast<StorageIndex>(it - _inner_indices.begin());
+        }
+    }
+    return true;
+}
+
+}  // namespace MathLib
@@ -0,0 +1,102 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "EigenMatrix.h"
+
+namespace MathLib
+{
+/// Positions of the entries of local matrices in the value array of an
+/// EigenMatrix of fixed sparsity structure.
+///
+/// Adding a local matrix via EigenMatrix::add() searches every entry in the
+/// sparse structure. If the structure does not change between assemblies,
+/// the positions of the entries of each local item, e.g., each mesh element,
+/// can be computed once and cached. Then the addition becomes a sequence of
+/// direct writes into the value array of the matrix.
+///
+/// The map can be used for all matrices having exactly the same sparsity
+/// structure as the matrix passed to reset(), cf. hasSameStructure().
+///
+/// \note The offsets of different local items can be computed concurrently.
+class EigenMatrixScatterMap final
+{
+public:
+    using IndexType = EigenMatrix::IndexType;
+    using StorageIndex = EigenMatrix::RawMatrixType::StorageIndex;
+
+    /// Adopts the sparsity structure of the given \c matrix and discards all
+    /// offsets computed so far.
+    ///
+    /// \return false if the structure cannot be adopted because the \c matrix
+    /// is not in compressed storage mode. Then the map is invalid.
+    bool reset(EigenMatrix const& matrix, std::size_t const number_of_items);
+
+    /// Invalidates the map, e.g., after new entries have been inserted into the
+    /// matrix.
+    void invalidate();
+
+    /// Whether reset() succeeded and the map has not been invalidated.
+    bool isValid() const { return _is_valid; }
+
+    /// Whether the \c matrix has exactly the sparsity structure adopted by
+    /// the last call of reset().
+    bool hasSameStructure(EigenMatrix const& matrix) const;
+
+    /// Computes the offsets of the local item \c item_id with the given global
+    /// \c indices unless they have been computed before.
+    ///
+    /// \return false if any of the required entries is not present in the
+    /// sparsity structure. The map can not be used for this item then.
+    bool computeOffsets(std::size_t const item_id,
+                        std::vector<IndexType> const& indices);
+
+    /// Adds the local matrix of the item \c item_id to the \c matrix. The
+    /// offsets of the item must have been computed before.
+    template <typename LocalMatrix>
+    void add(EigenMatrix& matrix, std::size_t const item_id,
+             LocalMatrix const& local_matrix) const
+    {
+        assert(isValid() && hasSameStructure(matrix));
+        auto const& offsets = _offsets[item_id];
+        assert(offsets.size() == static_cast<std::size_t>(local_matrix.size()));
+
+        double* const values = matrix.getRawMatrix().valuePtr();
+        auto const n_rows = local_matrix.rows();
+        auto const n_cols = local_matrix.cols();
+        std::size_t k = 0;
+        for (decltype(local_matrix.rows()) i = 0; i < n_rows; ++i)
+        {
+            for (decltype(local_matrix.cols()) j = 0; j < n_cols; ++j)
+            {
+                values[offsets[k++]] += local_matrix(i, j);
+            }
+        }
+    }
+
+private:
+    bool _is_valid = false;
+
+    /// Copy of the outer index array of the adopted sparsity structure.
+    std::vector<StorageIndex> _outer_indices;
+    /// Copy of the inner index array of the adopted sparsity structure.
+    std::vector<StorageIndex> _inner_indices;
+
+    /// Row-major positions of the local matrix entries in the value array,
+    /// one vector per local item.
+    std::vector<std::vector<StorageIndex>> _offsets;
+};
+
+}  // namespace MathLib
@@ -23,6 +23,8 @@ EigenOption::EigenOption()
 #ifdef USE_EIGEN_UNSUPPORTED
     scaling = false;
 #endif
+    reuse_setup_for_unchanged_matrix = false;
+    number_of_threads = 0;
 }
 
 EigenOption::SolverType EigenOption::getSolverType(const std::string &solver_name)
@@ -47,6 +49,10 @@ EigenOption::SolverType EigenOption::getSolverType(const std::string &solver_nam
     {
         return SolverType::GMRES;
     }
+    if (solver_name == "MixedPrecisionLU")
+    {
+        return SolverType::MixedPrecisionLU;
+    }
 
     OGS_FATAL("Unknown Eigen solver type `%s'", solver_name.c_str());
 }
@@ -65,6 +71,14 @@ EigenOption::PreconType EigenOption::getPreconType(const std::string &precon_nam
     {
         return PreconType::ILUT;
     }
+    if (precon_name == "AMG")
+    {
+        return PreconType::AMG;
+    }
+    if (precon_name == "BLOCK_JACOBI_ILUT")
+    {
+        return PreconType::BLOCK_JACOBI_ILUT;
+    }
 
     OGS_FATAL("Unknown Eigen preconditioner type `%s'", precon_name.c_str());
 }
@@ -82,6 +96,8 @@ std::string EigenOption::getSolverName(SolverType const solver_type)
             return "PardisoLU";
         case SolverType::GMRES:
             return "GMRES";
+        case SolverType::MixedPrecisionLU:
+            return "MixedPrecisionLU";
     }
     return "Invalid";
 }
@@ -95,6 +111,10 @@ std::string EigenOption::getPreconName(PreconType const precon_type)
             return "DIAGONAL";
         case PreconType::ILUT:
             return "ILUT";
+        case PreconType::AMG:
+            return "AMG";
+        case PreconType::BLOCK_JACOBI_ILUT:
+            return "BLOCK_JACOBI_ILUT";
     }
     return "Invalid";
 }
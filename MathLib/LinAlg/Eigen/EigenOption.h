@@ -25,7 +25,8 @@ struct EigenOption final
         BiCGSTAB,
         SparseLU,
         PardisoLU,
-        GMRES
+        GMRES,
+        MixedPrecisionLU
     };
 
     /// Preconditioner type
@@ -33,7 +34,9 @@ struct EigenOption final
     {
         NONE,
         DIAGONAL,
-        ILUT
+        ILUT,
+        AMG,
+        BLOCK_JACOBI_ILUT
     };
 
     /// Linear solver type
@@ -48,6 +51,13 @@ struct EigenOption final
     /// Scaling the coefficient matrix and the RHS bector
     bool scaling;
 #endif
+    /// Reuse the factorization or preconditioner of the previous solve if
+    /// the matrix did not change since then.
+    bool reuse_setup_for_unchanged_matrix;
+    /// Number of OpenMP threads of the sparse matrix-vector products and of
+    /// the block Jacobi preconditioner. Zero keeps the default of Eigen, i.e.,
+    /// the maximum number of OpenMP threads.
+    int number_of_threads;
 
     /// Constructor
     ///
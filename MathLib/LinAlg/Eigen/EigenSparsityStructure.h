@@ -0,0 +1,60 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "EigenMatrix.h"
+
+namespace MathLib
+{
+namespace details
+{
+/// Copy of the sparsity structure of a compressed matrix for the detection of
+/// structural changes between subsequent solves.
+class SparsityStructure final
+{
+public:
+    using Matrix = EigenMatrix::RawMatrixType;
+
+    /// Adopts the structure of \c A and returns true if it differs from the
+    /// previously adopted one.
+    bool update(Matrix const& A)
+    {
+        assert(A.isCompressed());
+        auto const* const outer = A.outerIndexPtr();
+        auto const* const inner = A.innerIndexPtr();
+        auto const n_outer = static_cast<std::size_t>(A.outerSize()) + 1;
+        auto const nnz = static_cast<std::size_t>(A.nonZeros());
+
+        if (_rows == A.rows() && _outer_indices.size() == n_outer &&
+            _inner_indices.size() == nnz &&
+            std::equal(_outer_indices.begin(), _outer_indices.end(), outer) &&
+            std::equal(_inner_indices.begin(), _inner_indices.end(), inner))
+        {
+            return false;
+        }
+
+        _rows = A.rows();
+        _outer_indices.assign(outer, outer + n_outer);
+        _inner_indices.assign(inner, inner + nnz);
+        return true;
+    }
+
+private:
+    Matrix::Index _rows = -1;
+    std::vector<Matrix::StorageIndex> _outer_indices;
+    std::vector<Matrix::StorageIndex> _inner_indices;
+};
+}  // namespace details
+}  // namespace MathLib
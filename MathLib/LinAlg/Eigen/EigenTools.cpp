@@ -26,49 +26,20 @@ void applyKnownSolution(EigenMatrix &A_, EigenVector &b_, EigenVector &/*x*/,
 
     auto &A = A_.getRawMatrix();
     auto &b = b_.getRawVector();
+    auto& index = A_.getKnownSolutionIndex();
 
-    // A(k, j) = 0.
-    // set row to zero
-    for (auto row_id : vec_knownX_id)
+    if (!index.isValidFor(A, vec_knownX_id))
     {
-        for (SpMat::InnerIterator it(A,row_id); it; ++it) {
-            if (it.col() != decltype(it.col())(row_id))
-            {
-                it.valueRef() = 0.0;
-            }
-        }
-    }
-
-    SpMat AT = A.transpose();
-
-    for (std::size_t ix=0; ix<vec_knownX_id.size(); ix++)
-    {
-        SpMat::Index const row_id = vec_knownX_id[ix];
-        auto const x = vec_knownX_x[ix];
-
-        // b_i -= A(i,k)*val, i!=k
-        // set column to zero, subtract from rhs
-        for (SpMat::InnerIterator it(AT, row_id); it; ++it)
+        // The diagonal entries must be present in the sparsity structure.
+        for (auto const row_id : vec_knownX_id)
         {
-            if (it.col() == row_id)
-            {
-                continue;
-            }
-
-            b[it.col()] -= it.value()*x;
-            it.valueRef() = 0.0;
-        }
-
-        auto& c = AT.coeffRef(row_id, row_id);
-        if (c != 0.0) {
-            b[row_id] = x * c;
-        } else {
-            b[row_id] = x;
-            c = 1.0;
+            A.coeffRef(row_id, row_id);
         }
+        A.makeCompressed();
+        index.reset(A, vec_knownX_id);
     }
 
-    A = AT.transpose();
+    index.apply(A, b, vec_knownX_x);
 }
 
 }  // namespace MathLib
@@ -16,6 +16,7 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/StringTools.h"
 #include "MathLib/LinAlg/Eigen/EigenMatrix.h"
 #include "MathLib/LinAlg/Eigen/EigenVector.h"
 #include "MathLib/LinAlg/Lis/LisMatrix.h"
@@ -29,6 +30,7 @@ EigenLisLinearSolver::EigenLisLinearSolver(
     BaseLib::ConfigTree const* const option)
     : _lis_option(option)
 {
+    _lis_solver.setOption(_lis_option);
 }
 
 bool EigenLisLinearSolver::solve(EigenMatrix &A_, EigenVector& b_,
@@ -50,12 +52,21 @@ bool EigenLisLinearSolver::solve(EigenMatrix &A_, EigenVector& b_,
     LisVector lisb(b.rows(), b.data());
     LisVector lisx(x.rows(), x.data());
 
-    LisLinearSolver lissol; // TODO not always creat Lis solver here
-    lissol.setOption(_lis_option);
-    bool const status = lissol.solve(lisA, lisb, lisx);
+    if (_relative_tolerance)
+    {
+        // Lis uses the last occurrence of an option.
+        auto option = _lis_option;
+        option._option_string +=
+            BaseLib::format(" -tol %g", *_relative_tolerance);
+        _lis_solver.setOption(option);
+    }
+    else
+    {
+        _lis_solver.setOption(_lis_option);
+    }
+    bool const status = _lis_solver.solve(lisA, lisb, lisx);
 
-    for (std::size_t i=0; i<lisx.size(); i++)
-        x[i] = lisx[i];
+    lis_vector_get_values(lisx.getRawVector(), 0, x.rows(), x.data());
 
     return status;
 }
@@ -12,9 +12,11 @@
 
 #include <vector>
 
+#include <boost/optional.hpp>
 #include <lis.h>
 
 #include "BaseLib/ConfigTree.h"
+#include "MathLib/LinAlg/Lis/LisLinearSolver.h"
 #include "MathLib/LinAlg/Lis/LisOption.h"
 
 namespace MathLib
@@ -43,12 +45,32 @@ public:
     /**
      * copy linear solvers options
      */
-    void setOption(const LisOption &option) { _lis_option = option; }
+    void setOption(const LisOption& option)
+    {
+        _lis_option = option;
+        _lis_solver.setOption(option);
+    }
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Overrides the configured tolerance in the subsequent solves, e.g., for
+    /// inexact Newton methods.
+    void setRelativeTolerance(double const tolerance)
+    {
+        _relative_tolerance = tolerance;
+    }
+
+    /// Restores the configured tolerance.
+    void resetRelativeTolerance() { _relative_tolerance = boost::none; }
+
+    /// The Lis solver object is reused, but Lis computes the preconditioner
+    /// anew in each solve; reusing it is not supported.
+    void reuseSetupInNextSolve() {}
+
 private:
     LisOption _lis_option;
+    LisLinearSolver _lis_solver;
+    boost::optional<double> _relative_tolerance;
 };
 
 } // MathLib
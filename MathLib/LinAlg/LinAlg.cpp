@@ -104,6 +104,16 @@ double normMax(PETScVector const& x)
     return norm;
 }
 
+// Explicit specialization
+// Computes the dot product of x and y
+template<>
+double dot(PETScVector const& x, PETScVector const& y)
+{
+    PetscScalar result = 0.;
+    VecDot(x.getRawVector(), y.getRawVector(), &result);
+    return result;
+}
+
 
 // Matrix
 
@@ -158,6 +168,12 @@ void matMultAdd(PETScMatrix const& A, PETScVector const& v1,
     MatMultAdd(A.getRawMatrix(), v1.getRawVector(), v2.getRawVector(), v3.getRawVector());
 }
 
+// d = diag(A)
+void getDiagonal(PETScMatrix const& A, PETScVector& d)
+{
+    MatGetDiagonal(A.getRawMatrix(), d.getRawVector());
+}
+
 void finalizeAssembly(PETScMatrix& A)
 {
     A.finalizeAssembly(MAT_FINAL_ASSEMBLY);
@@ -257,6 +273,14 @@ double normMax(EigenVector const& x)
     return x.getRawVector().lpNorm<Eigen::Infinity>();
 }
 
+// Explicit specialization
+// Computes the dot product of x and y
+template<>
+double dot(EigenVector const& x, EigenVector const& y)
+{
+    return x.getRawVector().dot(y.getRawVector());
+}
+
 
 // Matrix
 
@@ -304,6 +328,12 @@ void matMultAdd(EigenMatrix const& A, EigenVector const& v1, EigenVector const&
     v3.getRawVector() = v2.getRawVector() + A.getRawMatrix()*v1.getRawVector();
 }
 
+// d = diag(A)
+void getDiagonal(EigenMatrix const& A, EigenVector& d)
+{
+    d.getRawVector() = A.getRawMatrix().diagonal();
+}
+
 void finalizeAssembly(EigenMatrix& x)
 {
     x.getRawMatrix().makeCompressed();
@@ -84,6 +84,10 @@ double norm2(MatrixOrVector const& x);
 template<typename MatrixOrVector>
 double normMax(MatrixOrVector const& x);
 
+//! Computes the dot product of \c x and \c y.
+template<typename MatrixOrVector>
+double dot(MatrixOrVector const& x, MatrixOrVector const& y);
+
 template<typename MatrixOrVector>
 double norm(MatrixOrVector const& x, MathLib::VecNormType type)
 {
@@ -189,6 +193,9 @@ void matMult(PETScMatrix const& A, PETScVector const& x, PETScVector& y);
 void matMultAdd(PETScMatrix const& A, PETScVector const& v1,
                        PETScVector const& v2, PETScVector& v3);
 
+// d = diag(A)
+void getDiagonal(PETScMatrix const& A, PETScVector& d);
+
 void finalizeAssembly(PETScMatrix& A);
 void finalizeAssembly(PETScVector& x);
 
@@ -257,6 +264,9 @@ void matMult(EigenMatrix const& A, EigenVector const& x, EigenVector& y);
 void matMultAdd(EigenMatrix const& A, EigenVector const& v1,
                 EigenVector const& v2, EigenVector& v3);
 
+// d = diag(A)
+void getDiagonal(EigenMatrix const& A, EigenVector& d);
+
 void finalizeAssembly(EigenMatrix& x);
 void finalizeAssembly(EigenVector& A);
 
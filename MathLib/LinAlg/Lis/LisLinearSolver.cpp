@@ -34,6 +34,32 @@ LisLinearSolver::LisLinearSolver(
 {
 }
 
+LisLinearSolver::~LisLinearSolver()
+{
+    destroySolver();
+}
+
+void LisLinearSolver::setOption(const LisOption& option)
+{
+    if (option._option_string != _lis_option._option_string)
+    {
+        // Lis keeps previously set options, hence the solver is recreated.
+        destroySolver();
+    }
+    _lis_option = option;
+}
+
+void LisLinearSolver::destroySolver()
+{
+    if (_solver == nullptr)
+    {
+        return;
+    }
+    int const ierr = lis_solver_destroy(_solver);
+    checkLisError(ierr);
+    _solver = nullptr;
+}
+
 bool LisLinearSolver::solve(LisMatrix &A, LisVector &b, LisVector &x)
 {
     finalizeMatrixAssembly(A);
@@ -41,14 +67,20 @@ bool LisLinearSolver::solve(LisMatrix &A, LisVector &b, LisVector &x)
     INFO("------------------------------------------------------------------");
     INFO("*** LIS solver computation");
 
-    // Create solver
-    LIS_SOLVER solver;
-    int ierr = lis_solver_create(&solver);
-    if (!checkLisError(ierr))
-        return false;
+    int ierr = 0;
+    if (_solver == nullptr)
+    {
+        ierr = lis_solver_create(&_solver);
+        if (!checkLisError(ierr))
+        {
+            _solver = nullptr;
+            return false;
+        }
 
-    lis_solver_set_option(
-        const_cast<char*>(_lis_option._option_string.c_str()), solver);
+        lis_solver_set_option(
+            const_cast<char*>(_lis_option._option_string.c_str()), _solver);
+    }
+    LIS_SOLVER const solver = _solver;
 #ifdef _OPENMP
     INFO("-> number of threads: %i", (int) omp_get_max_threads());
 #endif
@@ -108,10 +140,6 @@ bool LisLinearSolver::solve(LisMatrix &A, LisVector &b, LisVector &x)
         INFO("-> time precond. iter   (s): %g", p_itime);
     }
 
-    // Clear solver
-    ierr = lis_solver_destroy(solver);
-    if (!checkLisError(ierr))
-        return false;
     INFO("------------------------------------------------------------------");
 
     return linear_solver_status == LIS_SUCCESS;
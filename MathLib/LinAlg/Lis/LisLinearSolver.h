@@ -47,16 +47,29 @@ public:
     LisLinearSolver(const std::string solver_name = "",
                     BaseLib::ConfigTree const*const option = nullptr);
 
+    LisLinearSolver(LisLinearSolver const&) = delete;
+    LisLinearSolver& operator=(LisLinearSolver const&) = delete;
+
+    ~LisLinearSolver();
+
     /**
      * configure linear solvers
      * @param option
      */
-    void setOption(const LisOption &option) { _lis_option = option; }
+    void setOption(const LisOption &option);
 
     bool solve(LisMatrix& A, LisVector &b, LisVector &x);
 
 private:
+    void destroySolver();
+
     LisOption _lis_option;
+
+    /// The Lis solver object is created with the current options in the first
+    /// solve and reused in subsequent solves until the options change, such
+    /// that the option string is parsed and the solver's work space is
+    /// allocated only once.
+    LIS_SOLVER _solver = nullptr;
 };
 
 } // MathLib
@@ -19,9 +19,10 @@ struct MatrixSpecifications
 {
     MatrixSpecifications(std::size_t const nrows_, std::size_t const ncols_,
                          std::vector<GlobalIndexType> const*const ghost_indices_,
-                         GlobalSparsityPattern const*const sparsity_pattern_)
+                         GlobalSparsityPattern const*const sparsity_pattern_,
+                         int const block_size_ = 1)
         : nrows(nrows_), ncols(ncols_), ghost_indices(ghost_indices_)
-        , sparsity_pattern(sparsity_pattern_)
+        , sparsity_pattern(sparsity_pattern_), block_size(block_size_)
     {
     }
 
@@ -29,6 +30,9 @@ struct MatrixSpecifications
     std::size_t const ncols;
     std::vector<GlobalIndexType> const*const ghost_indices;
     GlobalSparsityPattern const*const sparsity_pattern;
+    /// Size of the dense blocks the matrix consists of, e.g., the number of
+    /// components per node. Used by matrix types supporting block storage.
+    int const block_size;
 };
 
 } // namespace MathLib
@@ -39,14 +39,14 @@ newInstance(MatrixSpecifications const& spec)
 
     if (spec.sparsity_pattern)
     {
-        // Assert that the misuse of the sparsity pattern is consistent.
-        assert(spec.sparsity_pattern->size() == 1);
-
-        auto const max_nonzeroes = spec.sparsity_pattern->front();
+        // The per-row numbers of nonzeros of the diagonal block are followed
+        // by those of the off-diagonal block.
+        assert(spec.sparsity_pattern->size() == 2 * nrows);
 
         PETScMatrixOption mat_opt;
-        mat_opt.d_nz = max_nonzeroes;
-        mat_opt.o_nz = max_nonzeroes;
+        mat_opt.d_nnz = spec.sparsity_pattern->data();
+        mat_opt.o_nnz = spec.sparsity_pattern->data() + nrows;
+        mat_opt.block_size = spec.block_size;
         mat_opt.is_global_size = false;
         return std::make_unique<PETScMatrix>(nrows, ncols, mat_opt);
     }
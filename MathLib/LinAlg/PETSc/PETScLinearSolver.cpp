@@ -15,6 +15,11 @@
 */
 
 #include "PETScLinearSolver.h"
+
+#include <cassert>
+#include <cstring>
+
+#include "BaseLib/ConvergenceTelemetry.h"
 #include "BaseLib/RunTime.h"
 #include "MathLib/LinAlg/LinearSolverOptions.h"
 
@@ -70,6 +75,61 @@ PETScLinearSolver::PETScLinearSolver(const std::string /*prefix*/,
 
     KSPSetInitialGuessNonzero(_solver, PETSC_TRUE);
     KSPSetFromOptions(_solver);  // set run-time options
+
+    PetscReal abstol;
+    PetscReal dtol;
+    PetscInt maxits;
+    KSPGetTolerances(_solver, &_configured_rtol, &abstol, &dtol, &maxits);
+}
+
+void PETScLinearSolver::setRelativeTolerance(double const tolerance)
+{
+    PetscReal rtol;
+    PetscReal abstol;
+    PetscReal dtol;
+    PetscInt maxits;
+    KSPGetTolerances(_solver, &rtol, &abstol, &dtol, &maxits);
+    KSPSetTolerances(_solver, tolerance, abstol, dtol, maxits);
+}
+
+void PETScLinearSolver::resetRelativeTolerance()
+{
+    setRelativeTolerance(_configured_rtol);
+}
+
+void PETScLinearSolver::setFieldSplits(
+    std::vector<std::string> const& names,
+    std::vector<std::vector<PetscInt>> const& global_indices)
+{
+    assert(names.size() == global_indices.size());
+
+    PCType pc_type;
+    PCGetType(_pc, &pc_type);
+    if (pc_type == nullptr || std::strcmp(pc_type, PCFIELDSPLIT) != 0)
+    {
+        return;
+    }
+    if (_has_field_splits)
+    {
+        WARN(
+            "The fields of the fieldsplit preconditioner are already defined. "
+            "A linear solver with fieldsplit preconditioner can be used for a "
+            "single process only.");
+        return;
+    }
+
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        IS is;
+        ISCreateGeneral(PETSC_COMM_WORLD,
+                        static_cast<PetscInt>(global_indices[i].size()),
+                        global_indices[i].data(), PETSC_COPY_VALUES, &is);
+        PCFieldSplitSetIS(_pc, names[i].c_str(), is);
+        ISDestroy(&is);
+        DBUG("Defined field '%s' of the fieldsplit preconditioner.",
+             names[i].c_str());
+    }
+    _has_field_splits = true;
 }
 
 bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
@@ -84,30 +144,43 @@ bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
 #endif
 
 #if (PETSC_VERSION_NUMBER > 3040)
+    KSPSetReusePreconditioner(_solver, _reuse_setup ? PETSC_TRUE : PETSC_FALSE);
     KSPSetOperators(_solver, A.getRawMatrix(), A.getRawMatrix());
 #else
-    KSPSetOperators(_solver, A.getRawMatrix(), A.getRawMatrix(),
-                    DIFFERENT_NONZERO_PATTERN);
+    KSPSetOperators(
+        _solver, A.getRawMatrix(), A.getRawMatrix(),
+        _reuse_setup ? SAME_PRECONDITIONER : DIFFERENT_NONZERO_PATTERN);
 #endif
+    _reuse_setup = false;
 
     KSPSolve(_solver, b.getRawVector(), x.getRawVector());
 
     KSPConvergedReason reason;
     KSPGetConvergedReason(_solver, &reason);
+    if (BaseLib::ConvergenceTelemetry::isEnabled())
+    {
+        PetscInt its;
+        KSPGetIterationNumber(_solver, &its);
+        BaseLib::ConvergenceTelemetry::addLinearIterations(
+            static_cast<int>(its));
+    }
 
     bool converged = true;
     if (reason > 0)
     {
         const char* ksp_type;
         const char* pc_type;
+        const char* mat_type;
         KSPGetType(_solver, &ksp_type);
         PCGetType(_pc, &pc_type);
+        MatGetType(A.getRawMatrix(), &mat_type);
 
         PetscPrintf(PETSC_COMM_WORLD,
                     "\n================================================");
         PetscPrintf(PETSC_COMM_WORLD,
-                    "\nLinear solver %s with %s preconditioner", ksp_type,
-                    pc_type);
+                    "\nLinear solver %s with %s preconditioner (matrix type "
+                    "%s)",
+                    ksp_type, pc_type, mat_type);
 
         PetscInt its;
         KSPGetIterationNumber(_solver, &its);
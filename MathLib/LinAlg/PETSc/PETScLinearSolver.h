@@ -17,6 +17,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <petscksp.h>
 
@@ -54,6 +55,26 @@ public:
     // TODO check if some args in LinearSolver interface can be made const&.
     bool solve(PETScMatrix& A, PETScVector& b, PETScVector& x);
 
+    /// Overrides the relative tolerance of the Krylov solver in the
+    /// subsequent solves, e.g., for inexact Newton methods.
+    void setRelativeTolerance(double const tolerance);
+
+    /// Restores the relative tolerance set from the options.
+    void resetRelativeTolerance();
+
+    /// Lets the next solve() reuse the preconditioner of the previous one. The
+    /// matrix must not have been modified in between.
+    void reuseSetupInNextSolve() { _reuse_setup = true; }
+
+    /// Defines the fields of a field split preconditioner by their names and
+    /// the global indices owned by this rank. The names are used in the
+    /// options of the sub-solvers, e.g., -fieldsplit_pressure_pc_type. The
+    /// call has no effect if the preconditioner is not of type fieldsplit or
+    /// if the fields have already been defined.
+    void setFieldSplits(
+        std::vector<std::string> const& names,
+        std::vector<std::vector<PetscInt>> const& global_indices);
+
     /// Get number of iterations.
     PetscInt getNumberOfIterations() const
     {
@@ -69,6 +90,10 @@ private:
     PC _pc;       ///< Preconditioner type.
 
     double _elapsed_ctime = 0.0;  ///< Clock time
+
+    PetscReal _configured_rtol = 0.0;
+    bool _reuse_setup = false;
+    bool _has_field_splits = false;
 };
 
 }  // end namespace
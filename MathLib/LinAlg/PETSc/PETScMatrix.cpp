@@ -32,7 +32,8 @@ PETScMatrix::PETScMatrix(const PetscInt nrows, const PETScMatrixOption& mat_opt)
         _ncols = PETSC_DECIDE;
     }
 
-    create(mat_opt.d_nz, mat_opt.o_nz);
+    create(mat_opt.d_nz, mat_opt.o_nz, mat_opt.d_nnz, mat_opt.o_nnz,
+           mat_opt.block_size);
 }
 
 PETScMatrix::PETScMatrix(const PetscInt nrows, const PetscInt ncols,
@@ -50,7 +51,8 @@ PETScMatrix::PETScMatrix(const PetscInt nrows, const PetscInt ncols,
         _n_loc_cols = ncols;
     }
 
-    create(mat_opt.d_nz, mat_opt.o_nz);
+    create(mat_opt.d_nz, mat_opt.o_nz, mat_opt.d_nnz, mat_opt.o_nnz,
+           mat_opt.block_size);
 }
 
 PETScMatrix::PETScMatrix(const PETScMatrix& A)
@@ -131,19 +133,50 @@ void PETScMatrix::viewer(const std::string& file_name,
 #endif
 }
 
-void PETScMatrix::create(const PetscInt d_nz, const PetscInt o_nz)
+void PETScMatrix::create(const PetscInt d_nz, const PetscInt o_nz,
+                         PetscInt const* const d_nnz,
+                         PetscInt const* const o_nnz,
+                         const PetscInt block_size)
 {
     MatCreate(PETSC_COMM_WORLD, &_A);
     MatSetSizes(_A, _n_loc_rows, _n_loc_cols, _nrows, _ncols);
+    if (block_size > 1)
+    {
+        MatSetBlockSize(_A, block_size);
+    }
 
+    // The AIJ type is the default, which can be changed by the -mat_type
+    // option, e.g., to BAIJ.
+    MatSetType(_A, MATAIJ);
     MatSetFromOptions(_A);
 
-    MatSetType(_A, MATMPIAIJ);
-    MatSeqAIJSetPreallocation(_A, d_nz, PETSC_NULL);
-    MatMPIAIJSetPreallocation(_A, d_nz, PETSC_NULL, o_nz, PETSC_NULL);
+    if (block_size > 1 && d_nnz != nullptr && o_nnz != nullptr)
+    {
+        // All rows of a block have the same number of nonzeros.
+        std::vector<PetscInt> d_nnz_blocks(_n_loc_rows / block_size);
+        std::vector<PetscInt> o_nnz_blocks(_n_loc_rows / block_size);
+        for (std::size_t i = 0; i < d_nnz_blocks.size(); ++i)
+        {
+            d_nnz_blocks[i] = d_nnz[i * block_size] / block_size;
+            o_nnz_blocks[i] = o_nnz[i * block_size] / block_size;
+        }
+        MatXAIJSetPreallocation(_A, block_size, d_nnz_blocks.data(),
+                                o_nnz_blocks.data(), nullptr, nullptr);
+    }
+    else
+    {
+        MatSeqAIJSetPreallocation(_A, d_nz, d_nnz);
+        MatMPIAIJSetPreallocation(_A, d_nz, d_nnz, o_nz, o_nnz);
+    }
     // If pre-allocation does not work one can use MatSetUp(_A), which is much
     // slower.
 
+    // The rows of ghost entries have negative indices and are skipped in
+    // add(), i.e. each rank only sets values in its own rows. This avoids the
+    // communication of off-process entries and the corresponding reductions
+    // in MatAssemblyBegin/End.
+    MatSetOption(_A, MAT_NO_OFF_PROC_ENTRIES, PETSC_TRUE);
+
     MatGetOwnershipRange(_A, &_start_rank, &_end_rank);
     MatGetSize(_A, &_nrows, &_ncols);
     MatGetLocalSize(_A, &_n_loc_rows, &_n_loc_cols);
@@ -245,8 +245,16 @@ private:
                   local submatrix (same value is used for all local rows),
       \param o_nz Number of nonzeros per row in the off-diagonal portion of
                   local submatrix (same value is used for all local rows)
+      \param d_nnz Optional number of nonzeros in the diagonal portion of
+                  local submatrix for each local row, overrides d_nz.
+      \param o_nnz Optional number of nonzeros in the off-diagonal portion
+                  of local submatrix for each local row, overrides o_nz.
+      \param block_size Size of the dense blocks of the matrix.
     */
-    void create(const PetscInt d_nz, const PetscInt o_nz);
+    void create(const PetscInt d_nz, const PetscInt o_nz,
+                PetscInt const* const d_nnz = nullptr,
+                PetscInt const* const o_nnz = nullptr,
+                const PetscInt block_size = 1);
 
     friend bool finalizeMatrixAssembly(PETScMatrix& mat,
                                        const MatAssemblyType asm_type);
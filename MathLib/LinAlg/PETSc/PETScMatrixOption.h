@@ -27,7 +27,10 @@ struct PETScMatrixOption
         : is_global_size(true),
           n_local_cols(PETSC_DECIDE),
           d_nz(PETSC_DECIDE),
-          o_nz(PETSC_DECIDE)
+          o_nz(PETSC_DECIDE),
+          d_nnz(nullptr),
+          o_nnz(nullptr),
+          block_size(1)
     {
     }
 
@@ -56,6 +59,29 @@ struct PETScMatrixOption
             (same value is used for all local rows), the default is PETSC_DECIDE
     */
     PetscInt o_nz;
+
+    /*!
+     \brief Numbers of nonzeros in the diagonal portion of the local
+            submatrix for each local row. If given, d_nz is ignored. The
+            array must stay valid during the construction of the matrix.
+    */
+    PetscInt const* d_nnz;
+
+    /*!
+     \brief Numbers of nonzeros in the off-diagonal portion of the local
+            submatrix for each local row. If given, o_nz is ignored. The
+            array must stay valid during the construction of the matrix.
+    */
+    PetscInt const* o_nnz;
+
+    /*!
+     \brief Size of the dense blocks of the matrix, e.g., the number of
+            unknowns per node. The default is 1. With a block size greater
+            than 1, block matrix types like MATBAIJ can be selected by the
+            -mat_type option, and block preconditioners use the block
+            structure.
+    */
+    PetscInt block_size;
 };
 
 }  // end namespace
@@ -112,28 +112,38 @@ void PETScVector::finalizeAssembly()
 void PETScVector::gatherLocalVectors(PetscScalar local_array[],
                                      PetscScalar global_array[]) const
 {
-    // Collect vectors from processors.
     int size_rank;
     MPI_Comm_size(PETSC_COMM_WORLD, &size_rank);
 
-    // number of elements to be sent for each rank
-    std::vector<PetscInt> i_cnt(size_rank);
-
-    MPI_Allgather(&_size_loc, 1, MPI_INT, &i_cnt[0], 1, MPI_INT,
-                  PETSC_COMM_WORLD);
+    // The whole vector is owned by the only rank; no communication needed.
+    if (size_rank == 1)
+    {
+        std::copy_n(local_array, _size_loc, global_array);
+        return;
+    }
 
-    // collect local array
-    PetscInt offset = 0;
-    // offset in the receive vector of the data from each rank
-    std::vector<PetscInt> i_disp(size_rank);
-    for (PetscInt i = 0; i < size_rank; i++)
+    if (_gather_counts.empty())
     {
-        i_disp[i] = offset;
-        offset += i_cnt[i];
+        // number of elements to be sent for each rank
+        _gather_counts.resize(size_rank);
+
+        MPI_Allgather(&_size_loc, 1, MPI_INT, &_gather_counts[0], 1, MPI_INT,
+                      PETSC_COMM_WORLD);
+
+        // offset in the receive vector of the data from each rank
+        _gather_displacements.resize(size_rank);
+        PetscInt offset = 0;
+        for (PetscInt i = 0; i < size_rank; i++)
+        {
+            _gather_displacements[i] = offset;
+            offset += _gather_counts[i];
+        }
     }
 
-    MPI_Allgatherv(local_array, _size_loc, MPI_DOUBLE, global_array, &i_cnt[0],
-                   &i_disp[0], MPI_DOUBLE, PETSC_COMM_WORLD);
+    // collect local array
+    MPI_Allgatherv(local_array, _size_loc, MPI_DOUBLE, global_array,
+                   &_gather_counts[0], &_gather_displacements[0], MPI_DOUBLE,
+                   PETSC_COMM_WORLD);
 }
 
 void PETScVector::getGlobalVector(std::vector<PetscScalar>& u) const
@@ -257,6 +257,12 @@ private:
     /// Map global indices of ghost enrties to local indices
     mutable std::map<PetscInt, PetscInt> _global_ids2local_ids_ghost;
 
+    /// Number of entries owned by each rank and their offsets in the global
+    /// vector. Both are determined by the first gatherLocalVectors() call and
+    /// reused afterwards, since the partitioning does not change.
+    mutable std::vector<PetscInt> _gather_counts;
+    mutable std::vector<PetscInt> _gather_displacements;
+
     /*!
           \brief  Collect local vectors
           \param  local_array Local array
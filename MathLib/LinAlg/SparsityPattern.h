@@ -15,6 +15,11 @@
 namespace MathLib
 {
 /// A vector telling how many nonzeros there are in each global matrix row.
+///
+/// With PETSc the vector refers to the local rows of a rank. It contains the
+/// numbers of nonzeros in the diagonal block for each local row, followed by
+/// the numbers of nonzeros in the off-diagonal block, i.e., the d_nnz and o_nnz
+/// arrays of the PETSc preallocation.
 template <typename IndexType>
 using SparsityPattern = std::vector<IndexType>;
 }
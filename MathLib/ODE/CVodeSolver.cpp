@@ -39,7 +39,10 @@ void check_error(std::string const& f_name, int const error_flag)
 }
 
 //! Prints some statistics about an ODE solver run.
-void printStats(void* cvode_mem)
+//!
+//! \param has_linear_solver whether the dense linear solver is attached and
+//! its statistics can be queried.
+void printStats(void* cvode_mem, bool const has_linear_solver)
 {
     long int nst = 0, nfe = 0, nsetups = 0, nje = 0, nfeLS = 0, nni = 0,
              ncfn = 0, netf = 0, nge = 0;
@@ -54,8 +57,13 @@ void printStats(void* cvode_mem)
                 CVodeGetNumNonlinSolvIters(cvode_mem, &nni));
     check_error("CVodeGetNumNonlinSolvConvFails",
                 CVodeGetNumNonlinSolvConvFails(cvode_mem, &ncfn));
-    check_error("CVDlsGetNumJacEvals", CVDlsGetNumJacEvals(cvode_mem, &nje));
-    check_error("CVDlsGetNumRhsEvals", CVDlsGetNumRhsEvals(cvode_mem, &nfeLS));
+    if (has_linear_solver)
+    {
+        check_error("CVDlsGetNumJacEvals",
+                    CVDlsGetNumJacEvals(cvode_mem, &nje));
+        check_error("CVDlsGetNumRhsEvals",
+                    CVDlsGetNumRhsEvals(cvode_mem, &nfeLS));
+    }
     check_error("CVodeGetNumGEvals", CVodeGetNumGEvals(cvode_mem, &nge));
 
     DBUG("Sundials CVode solver. Statistics:");
@@ -123,6 +131,11 @@ private:
 
     //! Either solve via fixed-point iteration or via Newton-Raphson method.
     int _nonlinear_solver_iteration = CV_FUNCTIONAL;
+
+    //! Whether the dense linear solver has been attached to \c _cvode_mem.
+    //! It is only needed for the Newton iteration and is kept for all
+    //! subsequent solves of the same system size.
+    bool _has_linear_solver = false;
 };
 
 //! @}
@@ -245,8 +258,19 @@ void CVodeSolverImpl::preSolve()
     check_error("CVodeSVtolerances",
                 CVodeSVtolerances(_cvode_mem, _reltol, _abstol));
 
-    /* Call CVDense to specify the CVDENSE dense linear solver */
-    check_error("CVDense", CVDense(_cvode_mem, _num_equations));
+    if (_nonlinear_solver_iteration != CV_NEWTON)
+    {
+        // The functional iteration does not solve linear systems.
+        return;
+    }
+
+    /* Call CVDense to specify the CVDENSE dense linear solver. This is done
+     * once, because CVDense reallocates the dense matrices on each call. */
+    if (!_has_linear_solver)
+    {
+        check_error("CVDense", CVDense(_cvode_mem, _num_equations));
+        _has_linear_solver = true;
+    }
 
     if (_f->hasJacobian())
     {
@@ -273,6 +297,13 @@ void CVodeSolverImpl::preSolve()
         check_error("CVDlsSetDenseJacFn",
                     CVDlsSetDenseJacFn(_cvode_mem, df_wrapped));
     }
+    else
+    {
+        // Fall back to the difference quotient approximation, which might
+        // have been replaced for a previous function.
+        check_error("CVDlsSetDenseJacFn",
+                    CVDlsSetDenseJacFn(_cvode_mem, nullptr));
+    }
 }
 
 bool CVodeSolverImpl::solve(const double t_end)
@@ -297,7 +328,7 @@ void CVodeSolverImpl::getYDot(const double t, double const* const y,
 
 CVodeSolverImpl::~CVodeSolverImpl()
 {
-    printStats(_cvode_mem);
+    printStats(_cvode_mem, _has_linear_solver);
 
     N_VDestroy_Serial(_y);
     N_VDestroy_Serial(_abstol);
@@ -32,6 +32,7 @@ BoundaryElementsAlongPolyline::BoundaryElementsAlongPolyline(
     MeshLib::ElementSearch es(_mesh);
     es.searchByNodeIDs(node_ids_on_poly);
     auto& ele_ids_near_ply = es.getSearchedElementIDs();
+    _mesh.computeElementNeighbors();
 
     // check all edges of the elements near the polyline
     for (auto ele_id : ele_ids_near_ply)
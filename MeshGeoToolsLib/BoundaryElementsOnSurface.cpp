@@ -28,6 +28,7 @@ BoundaryElementsOnSurface::BoundaryElementsOnSurface(
     MeshLib::ElementSearch es(_mesh);
     es.searchByNodeIDs(node_ids_on_sfc);
     auto &ele_ids_near_sfc = es.getSearchedElementIDs();
+    _mesh.computeElementNeighbors();
 
     // get a list of faces made of the nodes
     for (auto ele_id : ele_ids_near_sfc) {
@@ -15,6 +15,7 @@
 #include "GeoMapper.h"
 
 #include <algorithm>
+#include <map>
 #include <sstream>
 #include <numeric>
 
@@ -133,8 +134,11 @@ void GeoMapper::mapStationData(std::vector<GeoLib::Point*> const& points)
         max_val = bounding_box.getMaxPoint()[2];
     }
 
-    for (auto * pnt : points)
+    auto const n_points_signed = static_cast<long>(points.size());
+#pragma omp parallel for schedule(dynamic, 64)
+    for (long i = 0; i < n_points_signed; ++i)
     {
+        auto* const pnt = points[i];
         double offset =
             (_grid)
                 ? (getMeshElevation((*pnt)[0], (*pnt)[1], min_val, max_val) -
@@ -154,9 +158,11 @@ void GeoMapper::mapStationData(std::vector<GeoLib::Point*> const& points)
 
 void GeoMapper::mapPointDataToDEM(std::vector<GeoLib::Point*> const& points)
 {
-    for (auto * pnt : points)
+    auto const n_points_signed = static_cast<long>(points.size());
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (long i = 0; i < n_points_signed; ++i)
     {
-        GeoLib::Point &p(*pnt);
+        GeoLib::Point &p(*points[i]);
         p[2] = getDemElevation(p);
     }
 }
@@ -168,10 +174,13 @@ void GeoMapper::mapPointDataToMeshSurface(std::vector<GeoLib::Point*> const& pnt
     double const min_val(aabb.getMinPoint()[2]);
     double const max_val(aabb.getMaxPoint()[2]);
 
-    for (auto * pnt : pnts) {
+    // The points are independent, the grid of the surface nodes is only read.
+    auto const n_pnts_signed = static_cast<long>(pnts.size());
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (long i = 0; i < n_pnts_signed; ++i) {
         // check if pnt is inside of the bounding box of the _surface_mesh
         // projected onto the y-x plane
-        GeoLib::Point &p(*pnt);
+        GeoLib::Point &p(*pnts[i]);
         if (p[0] < aabb.getMinPoint()[0] || aabb.getMaxPoint()[0] < p[0])
         {
             continue;
@@ -484,12 +493,12 @@ static bool snapPointToElementNode(MathLib::Point3d& p,
     return false;
 }
 
-static void insertSubSegments(
-    GeoLib::Polyline& ply, GeoLib::PointVec& points,
-    GeoLib::Polyline::SegmentIterator& segment_it,
+/// Inserts the points of the sub segments after the point \c j of the
+/// polyline and returns the number of inserted points.
+static std::size_t insertSubSegments(
+    GeoLib::Polyline& ply, GeoLib::PointVec& points, std::size_t const j,
     std::vector<GeoLib::LineSegment> const& sub_segments)
 {
-    std::size_t const j(segment_it.getSegmentNumber());
     std::size_t new_pnts_cnt(0);
     for (auto const& segment : sub_segments)
     {
@@ -506,19 +515,43 @@ static void insertSubSegments(
             new_pnts_cnt++;
         }
     }
-    segment_it += new_pnts_cnt;
+    return new_pnts_cnt;
 }
 
-static void mapPolylineOnSurfaceMesh(
-    GeoLib::Polyline& ply,
-    GeoLib::PointVec& orig_points,
+/// The result of mapping a polyline, which is applied to the geometry
+/// afterwards.
+struct MappedPolyline
+{
+    /// Mapped coordinates of the polyline's points by point id.
+    std::map<std::size_t, MathLib::Point3d> points;
+    /// Sub segments to be inserted by the number of the original segment.
+    std::vector<std::pair<std::size_t, std::vector<GeoLib::LineSegment>>>
+        sub_segments;
+};
+
+/// Maps the polyline without modifying it or its points, such that the
+/// polylines can be mapped concurrently.
+static MappedPolyline mapPolylineOnSurfaceMesh(
+    GeoLib::Polyline const& ply,
     MeshLib::MeshElementGrid const& mesh_element_grid)
 {
+    MappedPolyline mapped;
+    auto getPoint = [&](std::size_t const k) {
+        auto const id = ply.getPointID(k);
+        auto const it = mapped.points.find(id);
+        return it != mapped.points.end()
+                   ? it->second
+                   : MathLib::Point3d(*ply.getPoint(k));
+    };
+
     // for each segment ...
-    for (auto segment_it(ply.begin()); segment_it != ply.end(); ++segment_it)
+    for (std::size_t j = 0; j < ply.getNumberOfSegments(); ++j)
     {
+        GeoLib::LineSegment segment(
+            new GeoLib::Point(getPoint(j), ply.getPointID(j)),
+            new GeoLib::Point(getPoint(j + 1), ply.getPointID(j + 1)), true);
         auto candidate_elements(getCandidateElementsForLineSegmentIntersection(
-            mesh_element_grid, *segment_it));
+            mesh_element_grid, segment));
 
         auto mapPoint = [&candidate_elements](MathLib::Point3d& p) {
             auto const* elem(
@@ -534,13 +567,10 @@ static void mapPolylineOnSurfaceMesh(
         };
 
         // map segment begin and end point
-        auto const* beg_elem(mapPoint((*segment_it).getBeginPoint()));
-        auto const* end_elem(mapPoint((*segment_it).getEndPoint()));
-
-        // Since the mapping of the segment begin and end points the coordinates
-        // changed. The internal data structures of PointVec are possibly
-        // invalid and hence it is necessary to re-create them.
-        orig_points.resetInternalDataStructures();
+        auto const* beg_elem(mapPoint(segment.getBeginPoint()));
+        auto const* end_elem(mapPoint(segment.getEndPoint()));
+        mapped.points[ply.getPointID(j)] = segment.getBeginPoint();
+        mapped.points[ply.getPointID(j + 1)] = segment.getEndPoint();
 
         if (beg_elem == end_elem) {
             // TODO: handle cases: beg_elem == end_elem == nullptr
@@ -556,20 +586,16 @@ static void mapPolylineOnSurfaceMesh(
 
         // map the line segment (and if necessary for the mapping partition it)
         std::vector<GeoLib::LineSegment> sub_segments(mapLineSegment(
-            *segment_it, candidate_elements, beg_elem, end_elem));
-
-        if (sub_segments.empty())
-        {
-            continue;
-        }
+            segment, candidate_elements, beg_elem, end_elem));
 
         // The case sub_segment.size() == 1 is already handled above.
 
         if (sub_segments.size() > 1)
         {
-            insertSubSegments(ply, orig_points, segment_it, sub_segments);
+            mapped.sub_segments.emplace_back(j, std::move(sub_segments));
         }
     }
+    return mapped;
 }
 
 void GeoMapper::advancedMapOnMesh(MeshLib::Mesh const& mesh)
@@ -589,12 +615,40 @@ void GeoMapper::advancedMapOnMesh(MeshLib::Mesh const& mesh)
     // 2. compute mesh grid for surface
     MeshLib::MeshElementGrid const mesh_element_grid(*_surface_mesh);
 
-    // 3. map each polyline
+    // 3. map each polyline concurrently
     auto org_lines(_geo_objects.getPolylineVec(_geo_name));
     auto org_points(_geo_objects.getPointVecObj(_geo_name));
-    for (auto org_line : *org_lines)
+    std::vector<MappedPolyline> mapped_lines(org_lines->size());
+    auto const n_lines_signed = static_cast<long>(org_lines->size());
+#pragma omp parallel for schedule(dynamic)
+    for (long i = 0; i < n_lines_signed; ++i)
+    {
+        mapped_lines[i] =
+            mapPolylineOnSurfaceMesh(*(*org_lines)[i], mesh_element_grid);
+    }
+
+    // 4. apply the results in the order of the polylines
+    for (auto const& mapped_line : mapped_lines)
+    {
+        for (auto const& id_point : mapped_line.points)
+        {
+            static_cast<MathLib::Point3d&>(
+                *(*org_points->getVector())[id_point.first]) = id_point.second;
+        }
+    }
+    // Since the mapping the coordinates changed. The internal data structures
+    // of PointVec are possibly invalid and hence it is necessary to re-create
+    // them.
+    org_points->resetInternalDataStructures();
+    for (std::size_t i = 0; i < org_lines->size(); ++i)
     {
-        mapPolylineOnSurfaceMesh(*org_line, *org_points, mesh_element_grid);
+        std::size_t new_pnts_cnt(0);
+        for (auto const& segment : mapped_lines[i].sub_segments)
+        {
+            new_pnts_cnt +=
+                insertSubSegments(*(*org_lines)[i], *org_points,
+                                  segment.first + new_pnts_cnt, segment.second);
+        }
     }
 }
 
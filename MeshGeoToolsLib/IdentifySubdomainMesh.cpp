@@ -7,7 +7,8 @@
  *              http://www.opengeosys.org/project/license
  */
 
-#include <map>
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 #include "MeshLib/Elements/Element.h"
@@ -50,44 +51,34 @@ std::vector<std::size_t> identifySubdomainMeshNodes(
 std::vector<std::size_t> findElementsInMesh(
     MeshLib::Mesh const& mesh, std::vector<std::size_t> const& node_ids)
 {
-    //
-    // Collect all element ids for all nodes.
-    //
-    std::vector<std::size_t> common_element_ids;
-    // Every node is connected to at least one element.
-    auto const nnodes = node_ids.size();
-    common_element_ids.reserve(nnodes);
-
-    for (auto const node_id : node_ids)
+    if (node_ids.empty())
     {
-        auto const& connected_elements = mesh.getNode(node_id)->getElements();
-        std::transform(
-            begin(connected_elements), end(connected_elements),
-            back_inserter(common_element_ids),
-            [](MeshLib::Element const* const e) { return e->getID(); });
+        return {};
     }
 
     //
-    // Count how often an element is shared by all nodes.
-    //
-    std::map<std::size_t, int> element_counts;
-    for (auto const element_id : common_element_ids)
-    {
-        element_counts[element_id]++;
-    }
-
-    //
-    // Elements which are shared by as many nodes as the input nodes are the
-    // desired elements.
+    // The desired elements are among the elements connected to the first
+    // node. Keep those containing all of the other nodes, too.
     //
     std::vector<std::size_t> element_ids;
-    for (auto const& pair : element_counts)
+    for (auto const* const e : mesh.getNode(node_ids[0])->getElements())
     {
-        if (pair.second == static_cast<int>(nnodes))
+        auto const* const begin_nodes = e->getNodes();
+        auto const* const end_nodes = begin_nodes + e->getNumberOfNodes();
+        bool const contains_all_nodes = std::all_of(
+            std::next(begin(node_ids)), end(node_ids),
+            [&](std::size_t const node_id) {
+                return std::any_of(begin_nodes, end_nodes,
+                                   [node_id](MeshLib::Node const* const n) {
+                                       return n->getID() == node_id;
+                                   });
+            });
+        if (contains_all_nodes)
         {
-            element_ids.push_back(pair.first);
+            element_ids.push_back(e->getID());
         }
     }
+    std::sort(begin(element_ids), end(element_ids));
 
     return element_ids;
 }
@@ -250,4 +241,17 @@ void identifySubdomainMesh(MeshLib::Mesh& subdomain_mesh,
             MeshLib::MeshItemType::IntegrationPoint, force_overwrite);
     }
 }
+
+void identifySubdomainMeshes(
+    std::vector<std::unique_ptr<MeshLib::Mesh>> const& subdomain_meshes,
+    MeshLib::Mesh const& bulk_mesh,
+    MeshNodeSearcher const& mesh_node_searcher,
+    bool const force_overwrite)
+{
+    for (auto const& subdomain_mesh : subdomain_meshes)
+    {
+        identifySubdomainMesh(*subdomain_mesh, bulk_mesh, mesh_node_searcher,
+                              force_overwrite);
+    }
+}
 }  // namespace MeshGeoToolsLib
@@ -7,6 +7,11 @@
  *              http://www.opengeosys.org/project/license
  */
 
+#pragma once
+
+#include <memory>
+#include <vector>
+
 namespace MeshGeoToolsLib
 {
 class SearchLength;
@@ -28,4 +33,13 @@ void identifySubdomainMesh(MeshLib::Mesh& subdomain_mesh,
                            MeshLib::Mesh const& bulk_mesh,
                            MeshNodeSearcher const& mesh_node_searcher,
                            bool const force_overwrite = false);
+
+/// Identifies all of the subdomain meshes in the bulk mesh as in
+/// identifySubdomainMesh(). The node searcher and its spatial index of the
+/// bulk mesh nodes are built once and shared by all subdomains.
+void identifySubdomainMeshes(
+    std::vector<std::unique_ptr<MeshLib::Mesh>> const& subdomain_meshes,
+    MeshLib::Mesh const& bulk_mesh,
+    MeshNodeSearcher const& mesh_node_searcher,
+    bool const force_overwrite = false);
 }  // namespace MeshGeoToolsLib
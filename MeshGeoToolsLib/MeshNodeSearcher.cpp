@@ -25,6 +25,7 @@
 
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/MeshSearch/MeshSpatialIndex.h"
 #include "MeshLib/Node.h"
 
 namespace MeshGeoToolsLib
@@ -37,7 +38,7 @@ MeshNodeSearcher::MeshNodeSearcher(
     std::unique_ptr<MeshGeoToolsLib::SearchLength>&& search_length_algorithm,
     SearchAllNodes search_all_nodes)
     : _mesh(mesh),
-      _mesh_grid(_mesh.getNodes().cbegin(), _mesh.getNodes().cend()),
+      _spatial_index(MeshLib::MeshSpatialIndex::getMeshSpatialIndex(mesh)),
       _search_length_algorithm(std::move(search_length_algorithm)),
       _search_all_nodes(search_all_nodes)
 {
@@ -99,7 +100,8 @@ std::vector<std::size_t> MeshNodeSearcher::getMeshNodeIDs(
     {
         auto const& p = *p_ptr;
         std::vector<std::size_t> const ids =
-            _mesh_grid.getPointsInEpsilonEnvironment(p, epsilon_radius);
+            _spatial_index.getNodeGrid().getPointsInEpsilonEnvironment(
+                p, epsilon_radius);
         if (ids.empty())
         {
             OGS_FATAL(
@@ -162,7 +164,7 @@ MeshNodesOnPoint& MeshNodeSearcher::getMeshNodesOnPoint(
 
     _mesh_nodes_on_points.push_back(
         new MeshNodesOnPoint(_mesh,
-                             _mesh_grid,
+                             _spatial_index.getNodeGrid(),
                              pnt,
                              _search_length_algorithm->getSearchLength(),
                              _search_all_nodes));
@@ -182,7 +184,7 @@ MeshNodesAlongPolyline& MeshNodeSearcher::getMeshNodesAlongPolyline(
 
     // compute nodes (and supporting points) along polyline
     _mesh_nodes_along_polylines.push_back(new MeshNodesAlongPolyline(
-        _mesh, ply, _search_length_algorithm->getSearchLength(),
+        _spatial_index, ply, _search_length_algorithm->getSearchLength(),
         _search_all_nodes));
     return *_mesh_nodes_along_polylines.back();
 }
@@ -200,7 +202,7 @@ MeshNodesAlongSurface& MeshNodeSearcher::getMeshNodesAlongSurface(
 
     // compute nodes (and supporting points) on surface
     _mesh_nodes_along_surfaces.push_back(
-        new MeshNodesAlongSurface(_mesh,
+        new MeshNodesAlongSurface(_spatial_index,
                                   sfc,
                                   _search_length_algorithm->getSearchLength(),
                                   _search_all_nodes));
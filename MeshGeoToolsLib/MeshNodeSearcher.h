@@ -31,6 +31,7 @@ class Surface;
 namespace MeshLib
 {
 class Mesh;
+class MeshSpatialIndex;
 class Node;
 }
 
@@ -151,7 +152,8 @@ public:
 
 private:
     MeshLib::Mesh const& _mesh;
-    GeoLib::Grid<MeshLib::Node> _mesh_grid;
+    /// Shared with the other searches on the mesh.
+    MeshLib::MeshSpatialIndex const& _spatial_index;
     std::unique_ptr<MeshGeoToolsLib::SearchLength> _search_length_algorithm;
     SearchAllNodes _search_all_nodes;
     // with newer compiler we can omit to use a pointer here
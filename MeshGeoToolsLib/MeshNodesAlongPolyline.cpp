@@ -13,28 +13,57 @@
 #include "MeshNodesAlongPolyline.h"
 
 #include <algorithm>
+#include <array>
 
+#include "BaseLib/Algorithm.h"
 #include "BaseLib/quicksort.h"
 #include "MathLib/MathTools.h"
 #include "GeoLib/Polyline.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/MeshSearch/MeshSpatialIndex.h"
 #include "MeshLib/Node.h"
 
 namespace MeshGeoToolsLib
 {
-MeshNodesAlongPolyline::MeshNodesAlongPolyline(MeshLib::Mesh const& mesh,
-                                               GeoLib::Polyline const& ply,
-                                               double epsilon_radius,
-                                               SearchAllNodes search_all_nodes)
-    : _mesh(mesh), _ply(ply)
+MeshNodesAlongPolyline::MeshNodesAlongPolyline(
+    MeshLib::MeshSpatialIndex const& spatial_index,
+    GeoLib::Polyline const& ply,
+    double epsilon_radius,
+    SearchAllNodes search_all_nodes)
+    : _mesh(spatial_index.getMesh()), _ply(ply)
 {
     assert(epsilon_radius > 0);
     const std::size_t n_nodes(search_all_nodes == SearchAllNodes::Yes
                                   ? _mesh.getNumberOfNodes()
                                   : _mesh.getNumberOfBaseNodes());
     auto &mesh_nodes = _mesh.getNodes();
-    // loop over all nodes
-    for (std::size_t i = 0; i < n_nodes; i++) {
+
+    // only the nodes near the bounding boxes of the polyline's segments are
+    // candidates
+    std::vector<std::size_t> candidate_ids;
+    for (std::size_t k = 0; k + 1 < _ply.getNumberOfPoints(); ++k)
+    {
+        auto const& a = *_ply.getPoint(k);
+        auto const& b = *_ply.getPoint(k + 1);
+        std::array<double, 3> min;
+        std::array<double, 3> max;
+        for (int d = 0; d < 3; ++d)
+        {
+            min[d] = std::min(a[d], b[d]) - epsilon_radius;
+            max[d] = std::max(a[d], b[d]) + epsilon_radius;
+        }
+        auto const ids = spatial_index.getNodeIDsInCuboid(
+            MathLib::Point3d(min), MathLib::Point3d(max));
+        candidate_ids.insert(candidate_ids.end(), ids.begin(), ids.end());
+    }
+    BaseLib::makeVectorUnique(candidate_ids);
+
+    for (auto const i : candidate_ids)
+    {
+        if (i >= n_nodes)
+        {
+            continue;
+        }
         double dist = _ply.getDistanceAlongPolyline(*mesh_nodes[i], epsilon_radius);
         if (dist >= 0.0) {
             _msh_node_ids.push_back(mesh_nodes[i]->getID());
@@ -24,6 +24,7 @@ class Polyline;
 namespace MeshLib
 {
 class Mesh;
+class MeshSpatialIndex;
 }
 
 namespace MeshGeoToolsLib
@@ -41,14 +42,16 @@ public:
      * Constructor of object, that search mesh nodes along a
      * GeoLib::Polyline polyline within a given search radius. So the polyline
      * is something like a tube.
-     * @param mesh Mesh the search will be performed on.
+     * @param spatial_index Spatial index of the mesh the search will be
+     * performed on.
      * @param ply Along the GeoLib::Polyline ply the mesh nodes are searched.
      * @param epsilon_radius Search / tube radius
      * @param search_all_nodes switch between searching all mesh nodes and
      * searching the base nodes.
      */
     MeshNodesAlongPolyline(
-        MeshLib::Mesh const& mesh, GeoLib::Polyline const& ply,
+        MeshLib::MeshSpatialIndex const& spatial_index,
+        GeoLib::Polyline const& ply,
         double epsilon_radius,
         SearchAllNodes search_all_nodes);
 
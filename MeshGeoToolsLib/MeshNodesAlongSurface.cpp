@@ -13,27 +13,45 @@
 #include "MeshNodesAlongSurface.h"
 
 #include <algorithm>
+#include <array>
 
 #include "BaseLib/quicksort.h"
 #include "MathLib/MathTools.h"
 #include "GeoLib/Surface.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/MeshSearch/MeshSpatialIndex.h"
 #include "MeshLib/Node.h"
 
 namespace MeshGeoToolsLib
 {
-MeshNodesAlongSurface::MeshNodesAlongSurface(MeshLib::Mesh const& mesh,
-                                             GeoLib::Surface const& sfc,
-                                             double epsilon_radius,
-                                             SearchAllNodes search_all_nodes)
-    : _mesh(mesh), _sfc(sfc)
+MeshNodesAlongSurface::MeshNodesAlongSurface(
+    MeshLib::MeshSpatialIndex const& spatial_index,
+    GeoLib::Surface const& sfc,
+    double epsilon_radius,
+    SearchAllNodes search_all_nodes)
+    : _mesh(spatial_index.getMesh()), _sfc(sfc)
 {
     auto& mesh_nodes = _mesh.getNodes();
     const std::size_t n_nodes(search_all_nodes == SearchAllNodes::Yes
                                   ? _mesh.getNumberOfNodes()
                                   : _mesh.getNumberOfBaseNodes());
-    // loop over all nodes
-    for (std::size_t i = 0; i < n_nodes; i++) {
+
+    // only the nodes near the surface's bounding box are candidates
+    auto const& min = sfc.getAABB().getMinPoint();
+    auto const& max = sfc.getAABB().getMaxPoint();
+    auto const candidate_ids = spatial_index.getNodeIDsInCuboid(
+        MathLib::Point3d(std::array<double, 3>{{min[0] - epsilon_radius,
+                                                min[1] - epsilon_radius,
+                                                min[2] - epsilon_radius}}),
+        MathLib::Point3d(std::array<double, 3>{{max[0] + epsilon_radius,
+                                                max[1] + epsilon_radius,
+                                                max[2] + epsilon_radius}}));
+
+    for (auto const i : candidate_ids) {
+        if (i >= n_nodes)
+        {
+            continue;
+        }
         auto* node = mesh_nodes[i];
         if (!sfc.isPntInBoundingVolume(*node, epsilon_radius))
         {
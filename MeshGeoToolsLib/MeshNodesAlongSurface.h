@@ -24,6 +24,7 @@ class Surface;
 namespace MeshLib
 {
 class Mesh;
+class MeshSpatialIndex;
 }
 
 namespace MeshGeoToolsLib
@@ -37,7 +38,8 @@ public:
     /**
      * Constructor of object, that search mesh nodes along a
      * GeoLib::Surface object within a given search radius.
-     * @param mesh Mesh the search will be performed on.
+     * @param spatial_index Spatial index of the mesh the search will be
+     * performed on.
      * @param sfc Along the GeoLib::Surface sfc the mesh nodes are searched.
      * @param epsilon_radius Euclidean distance tolerance value. Is the distance
      * between a mesh node and the surface smaller than that value it is a mesh
@@ -45,7 +47,8 @@ public:
      * @param search_all_nodes switch between searching all mesh nodes and
      * searching the base nodes.
      */
-    MeshNodesAlongSurface(MeshLib::Mesh const& mesh, GeoLib::Surface const& sfc,
+    MeshNodesAlongSurface(MeshLib::MeshSpatialIndex const& spatial_index,
+                          GeoLib::Surface const& sfc,
                           double epsilon_radius,
                           SearchAllNodes search_all_nodes);
 
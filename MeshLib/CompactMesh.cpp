@@ -0,0 +1,79 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CompactMesh.h"
+
+#include <numeric>
+
+#include "Elements/Element.h"
+#include "Mesh.h"
+#include "Node.h"
+
+namespace MeshLib
+{
+CompactMesh::CompactMesh(Mesh const& mesh)
+{
+    auto const n_nodes = mesh.getNumberOfNodes();
+    auto const n_elements = mesh.getNumberOfElements();
+
+    _coordinates.reserve(3 * n_nodes);
+    for (auto const* node : mesh.getNodes())
+    {
+        _coordinates.insert(_coordinates.end(), node->getCoords(),
+                            node->getCoords() + 3);
+    }
+
+    _cell_types.reserve(n_elements);
+    _element_node_offsets.reserve(n_elements + 1);
+    _element_node_offsets.push_back(0);
+    for (auto const* element : mesh.getElements())
+    {
+        _cell_types.push_back(element->getCellType());
+        _element_node_offsets.push_back(_element_node_offsets.back() +
+                                        element->getNumberOfNodes());
+    }
+
+    _element_node_ids.reserve(_element_node_offsets.back());
+    _node_element_offsets.assign(n_nodes + 1, 0);
+    for (auto const* element : mesh.getElements())
+    {
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+        {
+            auto const node_id = element->getNodeIndex(i);
+            _element_node_ids.push_back(node_id);
+            ++_node_element_offsets[node_id + 1];
+        }
+    }
+
+    // Transpose the element-to-node connectivity. The elements of each node
+    // are sorted by the element ids.
+    std::partial_sum(_node_element_offsets.begin(), _node_element_offsets.end(),
+                     _node_element_offsets.begin());
+    _node_element_ids.resize(_node_element_offsets.back());
+    std::vector<std::size_t> position(_node_element_offsets.begin(),
+                                      _node_element_offsets.end() - 1);
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        for (auto const node_id : getElementNodeIDs(e))
+        {
+            _node_element_ids[position[node_id]++] = e;
+        }
+    }
+}
+
+std::size_t CompactMesh::getMemoryUsage() const
+{
+    return _coordinates.capacity() * sizeof(double) +
+           _cell_types.capacity() * sizeof(CellType) +
+           (_element_node_offsets.capacity() + _element_node_ids.capacity() +
+            _node_element_offsets.capacity() + _node_element_ids.capacity()) *
+               sizeof(std::size_t);
+}
+}  // namespace MeshLib
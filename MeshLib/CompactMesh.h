@@ -0,0 +1,221 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "BaseLib/Range.h"
+#include "MeshEnums.h"
+
+namespace MeshLib
+{
+class Mesh;
+class CompactMesh;
+
+namespace detail
+{
+/// Iterates over the items of a CompactMesh by index yielding lightweight
+/// views of the items.
+template <typename View>
+class CompactMeshIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = View;
+    using difference_type = std::ptrdiff_t;
+    using pointer = View const*;
+    using reference = View;
+
+    CompactMeshIterator(CompactMesh const& mesh, std::size_t const index)
+        : _mesh(&mesh), _index(index)
+    {
+    }
+
+    View operator*() const { return View(*_mesh, _index); }
+
+    CompactMeshIterator& operator++()
+    {
+        ++_index;
+        return *this;
+    }
+
+    bool operator==(CompactMeshIterator const& other) const
+    {
+        return _index == other._index;
+    }
+    bool operator!=(CompactMeshIterator const& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    CompactMesh const* _mesh;
+    std::size_t _index;
+};
+}  // namespace detail
+
+/// Compact, read-only representation of the nodes and elements of a mesh.
+///
+/// The node coordinates are stored contiguously, the element-to-node and
+/// node-to-element connectivities in compressed row storage, and the elements'
+/// types as tags. Compared to the Node and Element objects of a Mesh there are
+/// no per item heap allocations and virtual calls.
+///
+/// The NodeView and ElementView adaptors provide the parts of the Node and
+/// Element interfaces used in the assembly, e.g. getNode(), getNodeIndex(),
+/// and the access of the coordinates by operator[], such that code templated
+/// on the element type can use them in place of the mesh items.
+class CompactMesh final
+{
+public:
+    class ElementView;
+
+    /// View of a node of a CompactMesh.
+    class NodeView
+    {
+    public:
+        NodeView(CompactMesh const& mesh, std::size_t const id)
+            : _mesh(&mesh), _id(id)
+        {
+        }
+
+        std::size_t getID() const { return _id; }
+
+        double const* getCoords() const
+        {
+            return _mesh->_coordinates.data() + 3 * _id;
+        }
+
+        double operator[](std::size_t const k) const { return getCoords()[k]; }
+
+        /// Pointer-like access as for the nodes returned by
+        /// Element::getNode().
+        NodeView const& operator*() const { return *this; }
+        NodeView const* operator->() const { return this; }
+
+        /// Ids of the elements containing the node.
+        BaseLib::Range<std::size_t const*> getElementIDs() const
+        {
+            return _mesh->getNodeElementIDs(_id);
+        }
+
+    private:
+        CompactMesh const* _mesh;
+        std::size_t _id;
+    };
+
+    /// View of an element of a CompactMesh.
+    class ElementView
+    {
+    public:
+        ElementView(CompactMesh const& mesh, std::size_t const id)
+            : _mesh(&mesh), _id(id)
+        {
+        }
+
+        std::size_t getID() const { return _id; }
+
+        CellType getCellType() const { return _mesh->_cell_types[_id]; }
+
+        unsigned getNumberOfNodes() const
+        {
+            return static_cast<unsigned>(
+                _mesh->_element_node_offsets[_id + 1] -
+                _mesh->_element_node_offsets[_id]);
+        }
+
+        std::size_t getNodeIndex(unsigned const i) const
+        {
+            return _mesh->_element_node_ids
+                [_mesh->_element_node_offsets[_id] + i];
+        }
+
+        NodeView getNode(unsigned const i) const
+        {
+            return NodeView(*_mesh, getNodeIndex(i));
+        }
+
+        /// Ids of the element's nodes in the element's local node order.
+        BaseLib::Range<std::size_t const*> getNodeIDs() const
+        {
+            return _mesh->getElementNodeIDs(_id);
+        }
+
+    private:
+        CompactMesh const* _mesh;
+        std::size_t _id;
+    };
+
+    /// Copies the nodes' coordinates and the connectivity of the given mesh.
+    /// The mesh is not referenced afterwards.
+    explicit CompactMesh(Mesh const& mesh);
+
+    std::size_t getNumberOfNodes() const { return _coordinates.size() / 3; }
+
+    std::size_t getNumberOfElements() const { return _cell_types.size(); }
+
+    NodeView getNode(std::size_t const id) const { return NodeView(*this, id); }
+
+    ElementView getElement(std::size_t const id) const
+    {
+        return ElementView(*this, id);
+    }
+
+    BaseLib::Range<detail::CompactMeshIterator<NodeView>> getNodes() const
+    {
+        return BaseLib::Range<detail::CompactMeshIterator<NodeView>>(
+            {*this, 0}, {*this, getNumberOfNodes()});
+    }
+
+    BaseLib::Range<detail::CompactMeshIterator<ElementView>> getElements()
+        const
+    {
+        return BaseLib::Range<detail::CompactMeshIterator<ElementView>>(
+            {*this, 0}, {*this, getNumberOfElements()});
+    }
+
+    BaseLib::Range<std::size_t const*> getElementNodeIDs(
+        std::size_t const element_id) const
+    {
+        return rowRange(_element_node_offsets, _element_node_ids, element_id);
+    }
+
+    BaseLib::Range<std::size_t const*> getNodeElementIDs(
+        std::size_t const node_id) const
+    {
+        return rowRange(_node_element_offsets, _node_element_ids, node_id);
+    }
+
+    /// All of the nodes' coordinates, three per node.
+    std::vector<double> const& getCoordinates() const { return _coordinates; }
+
+    /// The number of bytes allocated for the compact representation.
+    std::size_t getMemoryUsage() const;
+
+private:
+    static BaseLib::Range<std::size_t const*> rowRange(
+        std::vector<std::size_t> const& offsets,
+        std::vector<std::size_t> const& values, std::size_t const row)
+    {
+        return BaseLib::Range<std::size_t const*>(
+            values.data() + offsets[row], values.data() + offsets[row + 1]);
+    }
+
+    std::vector<double> _coordinates;
+    std::vector<CellType> _cell_types;
+    std::vector<std::size_t> _element_node_offsets;
+    std::vector<std::size_t> _element_node_ids;
+    std::vector<std::size_t> _node_element_offsets;
+    std::vector<std::size_t> _node_element_ids;
+};
+}  // namespace MeshLib
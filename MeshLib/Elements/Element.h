@@ -100,6 +100,7 @@ public:
     virtual unsigned getNumberOfFaces() const = 0;
 
     /// Get the specified neighbor.
+    /// \pre Mesh::computeElementNeighbors() has been called.
     const Element* getNeighbor(unsigned i) const;
 
     /// Get the number of neighbors for this element.
@@ -144,6 +145,7 @@ public:
     bool hasZeroVolume() const { return this->getContent() < std::numeric_limits<double>::epsilon(); }
 
     /// Returns true if the element is located at a boundary (i.e. has at least one face without neighbour)
+    /// \pre Mesh::computeElementNeighbors() has been called.
     virtual bool isBoundaryElement() const;
 
     /// Returns true if these two indeces form an edge and false otherwise
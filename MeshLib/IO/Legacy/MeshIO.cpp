@@ -25,6 +25,7 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/FileTools.h"
+#include "BaseLib/IO/TextScanner.h"
 #include "BaseLib/StringTools.h"
 
 #include "MeshLib/Elements/Elements.h"
@@ -43,15 +44,15 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
 {
     INFO("Reading OGS legacy mesh ... ");
 
-    std::ifstream in (file_name.c_str(),std::ios::in);
-    if (!in.is_open())
+    auto scanner = BaseLib::IO::TextScanner::fromFile(file_name);
+    if (!scanner)
     {
         WARN("MeshIO::loadMeshFromFile() - Could not open file %s.", file_name.c_str());
         return nullptr;
     }
+    auto& in = *scanner;
 
-    std::string line_string;
-    getline(in, line_string);
+    std::string line_string(in.getLine());
 
     std::vector<MeshLib::Node*> nodes;
     std::vector<MeshLib::Element*> elements;
@@ -61,7 +62,7 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
     {
         while (!in.eof())
         {
-            getline(in, line_string);
+            line_string = in.getLine();
 
             // check keywords
             if (line_string.find("#STOP") != std::string::npos)
@@ -73,35 +74,31 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
                 double x;
                 double y;
                 double z;
-                double double_dummy;
                 unsigned idx;
-                getline(in, line_string);
+                line_string = in.getLine();
                 BaseLib::trim(line_string);
                 unsigned nNodes = atoi(line_string.c_str());
-                std::string s;
+                nodes.reserve(nNodes);
                 for (unsigned i = 0; i < nNodes; ++i)
                 {
-                    getline(in, line_string);
-                    std::stringstream iss(line_string);
-                    iss >> idx >> x >> y >> z;
+                    in.read(idx, x, y, z);
                     auto* node(new MeshLib::Node(x, y, z, idx));
                     nodes.push_back(node);
-                    iss >> s;
-                    if (s.find("$AREA") != std::string::npos)
-                    {
-                        iss >> double_dummy;
-                    }
+                    // Skips the rest of the line, e.g. an optional $AREA
+                    // value.
+                    in.getLine();
                 }
             }
             else if (line_string.find("$ELEMENTS") != std::string::npos)
             {
-                getline(in, line_string);
+                line_string = in.getLine();
                 BaseLib::trim(line_string);
                 unsigned nElements = atoi(line_string.c_str());
+                elements.reserve(nElements);
+                materials.reserve(nElements);
                 for (unsigned i = 0; i < nElements; ++i)
                 {
-                    getline(in, line_string);
-                    std::stringstream ss(line_string);
+                    std::stringstream ss{std::string(in.getLine())};
                     materials.push_back(readMaterialID(ss));
                     MeshLib::Element *elem(readElement(ss,nodes));
                     if (elem == nullptr) {
@@ -149,11 +146,9 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
         INFO("Nr. Nodes: %d.", nodes.size());
         INFO("Nr. Elements: %d.", elements.size());
 
-        in.close();
         return mesh;
     }
 
-    in.close();
     return nullptr;
 }
 
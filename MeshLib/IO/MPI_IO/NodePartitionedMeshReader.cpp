@@ -15,6 +15,14 @@
 
 #include "NodePartitionedMeshReader.h"
 
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_PETSC
@@ -41,6 +49,108 @@ is_safely_convertable(VALUE const& value)
     return result;
 }
 
+namespace
+{
+/// Local ids in the merged mesh of the nodes and elements of each block
+/// merged by this rank, stored for the renumbering of the bulk ids of
+/// boundary meshes.
+struct MergedBlocks
+{
+    std::vector<std::vector<std::size_t>> node_ids;
+    std::vector<std::vector<std::size_t>> element_ids;
+};
+
+std::map<std::string, MergedBlocks>& mergedBlocks()
+{
+    static std::map<std::string, MergedBlocks> merged_blocks;
+    return merged_blocks;
+}
+
+/// Calls the function with a null pointer of the value type of the
+/// PropertyVector described by the meta data.
+template <typename Function>
+void applyToValueType(MeshLib::IO::PropertyVectorMetaData const& pvmd,
+                      Function const& f)
+{
+    if (pvmd.is_int_type)
+    {
+        if (pvmd.is_data_type_signed)
+        {
+            if (pvmd.data_type_size_in_bytes == sizeof(int))
+                f(static_cast<int*>(nullptr));
+            if (pvmd.data_type_size_in_bytes == sizeof(long))
+                f(static_cast<long*>(nullptr));
+        }
+        else
+        {
+            if (pvmd.data_type_size_in_bytes == sizeof(unsigned int))
+                f(static_cast<unsigned int*>(nullptr));
+            if (pvmd.data_type_size_in_bytes == sizeof(unsigned long))
+                f(static_cast<unsigned long*>(nullptr));
+        }
+    }
+    else
+    {
+        if (pvmd.data_type_size_in_bytes == sizeof(float))
+            f(static_cast<float*>(nullptr));
+        if (pvmd.data_type_size_in_bytes == sizeof(double))
+            f(static_cast<double*>(nullptr));
+    }
+}
+
+/// Replaces the bulk ids by the ids in the merged bulk mesh.
+void renumberBulkIds(
+    MeshLib::Properties& properties, std::string const& name,
+    MeshLib::MeshItemType const item_type,
+    std::vector<std::pair<std::size_t, std::size_t>> const& sources,
+    std::vector<std::vector<std::size_t>> const& merged_bulk_ids)
+{
+    if (!properties.existsPropertyVector<std::size_t>(name))
+    {
+        return;
+    }
+    auto& bulk_ids =
+        *properties.getPropertyVector<std::size_t>(name, item_type, 1);
+    for (std::size_t i = 0; i < sources.size(); ++i)
+    {
+        bulk_ids[i] = merged_bulk_ids[sources[i].first][bulk_ids[i]];
+    }
+}
+
+/// Appends the element to the element data in the format read by
+/// setElements() but without the leading offsets, which are stored in
+/// \c starts.
+void appendElement(unsigned long const* element,
+                   std::vector<std::size_t> const& node_ids,
+                   std::vector<unsigned long>& starts,
+                   std::vector<unsigned long>& data)
+{
+    starts.push_back(data.size());
+    data.push_back(element[0]);  // material id
+    data.push_back(element[1]);  // type
+    data.push_back(element[2]);  // number of nodes
+    for (unsigned long k = 0; k < element[2]; ++k)
+    {
+        data.push_back(node_ids[element[3 + k]]);
+    }
+}
+
+/// Prepends the offsets of the elements to the element data.
+std::vector<unsigned long> toElementData(
+    std::vector<unsigned long> const& starts,
+    std::vector<unsigned long> const& data)
+{
+    std::vector<unsigned long> element_data;
+    element_data.reserve(starts.size() + data.size());
+    for (auto const start : starts)
+    {
+        element_data.push_back(starts.size() + start);
+    }
+    element_data.insert(element_data.end(), data.begin(), data.end());
+    return element_data;
+}
+}  // namespace
+
 namespace MeshLib
 {
 namespace IO
@@ -82,7 +192,44 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::read(
     std::string const fname_new = file_name_base + "_partitioned_msh_cfg" +
         std::to_string(_mpi_comm_size) + ".bin";
 
-    if(!BaseLib::IsFileExisting(fname_new)) // doesn't exist binary file.
+    // Partition files written as blocks for a multiple of the number of
+    // ranks.
+    std::string const fname_blocks =
+        file_name_base + "_partitioned_blocks.txt";
+
+    if (!BaseLib::IsFileExisting(fname_new) &&
+        BaseLib::IsFileExisting(fname_blocks))
+    {
+        std::ifstream is(fname_blocks);
+        int number_of_blocks = 0;
+        if (!(is >> number_of_blocks) || number_of_blocks < 1)
+        {
+            OGS_FATAL("Could not read the number of blocks from '%s'.",
+                      fname_blocks.c_str());
+        }
+        // The optional name of the bulk mesh's files.
+        std::string bulk_mesh_name;
+        std::getline(is >> std::ws, bulk_mesh_name);
+        if (number_of_blocks % _mpi_comm_size != 0)
+        {
+            OGS_FATAL(
+                "The mesh '%s' is partitioned into %d blocks, which cannot be "
+                "merged for %d ranks. The number of ranks must divide the "
+                "number of blocks.",
+                file_name_base.c_str(), number_of_blocks, _mpi_comm_size);
+        }
+
+        INFO("Reading binary mesh file merging %d blocks per rank ...",
+             number_of_blocks / _mpi_comm_size);
+
+        mesh = readBinaryBlocks(
+            file_name_base, number_of_blocks,
+            bulk_mesh_name.empty()
+                ? bulk_mesh_name
+                : BaseLib::joinPaths(BaseLib::extractPath(file_name_base),
+                                     bulk_mesh_name));
+    }
+    else if (!BaseLib::IsFileExisting(fname_new))  // doesn't exist binary file.
     {
         INFO("Reading ASCII mesh file ...");
 
@@ -130,9 +277,12 @@ NodePartitionedMeshReader::readBinaryDataFromFile(std::string const& filename,
     // Read data
     char file_mode[] = "native";
     MPI_File_set_view(file, offset, type, type, file_mode, MPI_INFO_NULL);
+    // All ranks read their parts of the file at the same time. The collective
+    // read allows the MPI-IO implementation to aggregate the requests into
+    // few large accesses of the file system.
     // The static cast is checked above.
-    MPI_File_read(file, data.data(), static_cast<int>(data.size()), type,
-        MPI_STATUS_IGNORE);
+    MPI_File_read_all(file, data.data(), static_cast<int>(data.size()), type,
+                      MPI_STATUS_IGNORE);
     MPI_File_close(&file);
 
     return true;
@@ -196,6 +346,285 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readBinary(
                    glb_node_ids, mesh_elems, p);
 }
 
+bool NodePartitionedMeshReader::readBinaryBlock(
+    std::string const& file_name_base, int const block_id,
+    int const number_of_blocks, Block& block) const
+{
+    const std::string fname_header = file_name_base + "_partitioned_msh_";
+    const std::string fname_num_p_ext =
+        std::to_string(number_of_blocks) + ".bin";
+    auto& info = block.mesh_info;
+
+    if (!readBinaryDataFromFile(
+            fname_header + "cfg" + fname_num_p_ext,
+            static_cast<MPI_Offset>(static_cast<unsigned>(block_id) *
+                                    sizeof(info)),
+            MPI_LONG, info))
+        return false;
+
+    block.nodes.resize(info.nodes);
+    if (!readBinaryDataFromFile(fname_header + "nod" + fname_num_p_ext,
+                                static_cast<MPI_Offset>(info.offset[2]),
+                                _mpi_node_type, block.nodes))
+        return false;
+
+    block.regular_elements.resize(info.regular_elements + info.offset[0]);
+    if (!readBinaryDataFromFile(fname_header + "ele" + fname_num_p_ext,
+                                static_cast<MPI_Offset>(info.offset[3]),
+                                MPI_LONG, block.regular_elements))
+        return false;
+
+    block.ghost_elements.resize(info.ghost_elements + info.offset[1]);
+    return readBinaryDataFromFile(fname_header + "ele_g" + fname_num_p_ext,
+                                  static_cast<MPI_Offset>(info.offset[4]),
+                                  MPI_LONG, block.ghost_elements);
+}
+
+MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readBinaryBlocks(
+    std::string const& file_name_base, int const number_of_blocks,
+    std::string const& bulk_mesh_file_name_base)
+{
+    int const blocks_per_rank = number_of_blocks / _mpi_comm_size;
+    std::vector<int> block_ids(blocks_per_rank);
+    std::iota(block_ids.begin(), block_ids.end(), _mpi_rank * blocks_per_rank);
+
+    std::vector<Block> blocks(blocks_per_rank);
+    for (int k = 0; k < blocks_per_rank; ++k)
+    {
+        if (!readBinaryBlock(file_name_base, block_ids[k], number_of_blocks,
+                             blocks[k]))
+            return nullptr;
+    }
+
+    //----------------------------------------------------------------------------------
+    // Merge the nodes. The nodes owned by the blocks are owned by this rank;
+    // the nodes of consecutive blocks have consecutive global ids, hence the
+    // owned nodes' global ids are contiguous as for a direct partitioning.
+    auto is_owned_in_block = [](PartitionedMeshInfo const& info,
+                                std::size_t const i) {
+        return i < info.active_base_nodes ||
+               (i >= info.base_nodes &&
+                i < info.base_nodes + info.active_nodes -
+                        info.active_base_nodes);
+    };
+    std::unordered_set<std::size_t> owned_nodes;
+    for (auto const& block : blocks)
+    {
+        for (std::size_t i = 0; i < block.nodes.size(); ++i)
+        {
+            if (is_owned_in_block(block.mesh_info, i))
+            {
+                owned_nodes.insert(block.nodes[i].index);
+            }
+        }
+    }
+
+    // Node order: owned base nodes, ghost base nodes, owned higher order
+    // nodes, and ghost higher order nodes.
+    ItemSources node_sources;
+    std::unordered_map<std::size_t, std::size_t> merged_node_ids;
+    auto add_nodes = [&](bool const base, bool const owned) {
+        for (std::size_t k = 0; k < blocks.size(); ++k)
+        {
+            auto const& block = blocks[k];
+            for (std::size_t i = 0; i < block.nodes.size(); ++i)
+            {
+                auto const global_id = block.nodes[i].index;
+                if ((i < block.mesh_info.base_nodes) != base ||
+                    (owned_nodes.count(global_id) > 0) != owned ||
+                    merged_node_ids.count(global_id) > 0)
+                {
+                    continue;
+                }
+                merged_node_ids[global_id] = node_sources.size();
+                node_sources.emplace_back(k, i);
+            }
+        }
+    };
+    add_nodes(true, true);
+    std::size_t const active_base_nodes = node_sources.size();
+    add_nodes(true, false);
+    std::size_t const base_nodes = node_sources.size();
+    add_nodes(false, true);
+    std::size_t const active_nodes =
+        active_base_nodes + node_sources.size() - base_nodes;
+    add_nodes(false, false);
+
+    MergedBlocks merged;
+    merged.node_ids.resize(blocks.size());
+    for (std::size_t k = 0; k < blocks.size(); ++k)
+    {
+        for (auto const& node : blocks[k].nodes)
+        {
+            merged.node_ids[k].push_back(merged_node_ids[node.index]);
+        }
+    }
+
+    std::vector<NodeData> node_data;
+    node_data.reserve(node_sources.size());
+    for (auto const& source : node_sources)
+    {
+        node_data.push_back(blocks[source.first].nodes[source.second]);
+    }
+
+    //----------------------------------------------------------------------------------
+    // Merge the elements. The regular elements of the blocks are regular;
+    // a ghost element of a block is regular if all of its nodes are owned by
+    // this rank, and is listed by all blocks owning some of its nodes.
+    auto const is_owned = [&](std::size_t const i) {
+        return i < active_base_nodes ||
+               (i >= base_nodes &&
+                i < base_nodes + active_nodes - active_base_nodes);
+    };
+
+    std::vector<unsigned long> regular_starts;
+    std::vector<unsigned long> regular_data;
+    ItemSources regular_sources;
+    std::vector<unsigned long> ghost_starts;
+    std::vector<unsigned long> ghost_data;
+    ItemSources ghost_sources;
+    // Merged ghost elements of the blocks identified by their sorted nodes,
+    // with their index among the regular or the ghost elements.
+    std::map<std::vector<std::size_t>, std::pair<bool, std::size_t>>
+        block_ghost_elements;
+    std::vector<std::pair<bool, std::size_t>> ghost_element_ids;
+
+    for (std::size_t k = 0; k < blocks.size(); ++k)
+    {
+        auto const& block = blocks[k];
+        auto const& node_ids = merged.node_ids[k];
+        for (unsigned long e = 0; e < block.mesh_info.regular_elements; ++e)
+        {
+            appendElement(&block.regular_elements[block.regular_elements[e]],
+                          node_ids, regular_starts, regular_data);
+            regular_sources.emplace_back(k, e);
+        }
+    }
+    for (std::size_t k = 0; k < blocks.size(); ++k)
+    {
+        auto const& block = blocks[k];
+        auto const& node_ids = merged.node_ids[k];
+        for (unsigned long e = 0; e < block.mesh_info.ghost_elements; ++e)
+        {
+            auto const* const element =
+                &block.ghost_elements[block.ghost_elements[e]];
+            std::vector<std::size_t> nodes(element[2]);
+            for (unsigned long n = 0; n < element[2]; ++n)
+            {
+                nodes[n] = node_ids[element[3 + n]];
+            }
+            bool const regular =
+                std::all_of(nodes.begin(), nodes.end(), is_owned);
+            std::sort(nodes.begin(), nodes.end());
+
+            auto const inserted = block_ghost_elements.emplace(
+                std::move(nodes),
+                std::make_pair(regular, regular ? regular_sources.size()
+                                                : ghost_sources.size()));
+            ghost_element_ids.push_back(inserted.first->second);
+            if (!inserted.second)
+            {
+                continue;
+            }
+            std::size_t const local_id = block.mesh_info.regular_elements + e;
+            if (regular)
+            {
+                appendElement(element, node_ids, regular_starts,
+                              regular_data);
+                regular_sources.emplace_back(k, local_id);
+            }
+            else
+            {
+                appendElement(element, node_ids, ghost_starts, ghost_data);
+                ghost_sources.emplace_back(k, local_id);
+            }
+        }
+    }
+
+    // The ghost elements follow the regular ones.
+    merged.element_ids.resize(blocks.size());
+    {
+        std::size_t regular_id = 0;
+        auto ghost_element_id = ghost_element_ids.begin();
+        for (std::size_t k = 0; k < blocks.size(); ++k)
+        {
+            auto& element_ids = merged.element_ids[k];
+            for (unsigned long e = 0;
+                 e < blocks[k].mesh_info.regular_elements;
+                 ++e)
+            {
+                element_ids.push_back(regular_id++);
+            }
+        }
+        for (std::size_t k = 0; k < blocks.size(); ++k)
+        {
+            auto& element_ids = merged.element_ids[k];
+            for (unsigned long e = 0; e < blocks[k].mesh_info.ghost_elements;
+                 ++e, ++ghost_element_id)
+            {
+                element_ids.push_back(ghost_element_id->first
+                                          ? ghost_element_id->second
+                                          : regular_sources.size() +
+                                                ghost_element_id->second);
+            }
+        }
+    }
+
+    ItemSources element_sources = std::move(regular_sources);
+    element_sources.insert(element_sources.end(), ghost_sources.begin(),
+                           ghost_sources.end());
+
+    //----------------------------------------------------------------------------------
+    // Create the mesh of the merged blocks.
+    _mesh_info = blocks.front().mesh_info;
+    _mesh_info.nodes = node_sources.size();
+    _mesh_info.base_nodes = base_nodes;
+    _mesh_info.active_base_nodes = active_base_nodes;
+    _mesh_info.active_nodes = active_nodes;
+    _mesh_info.regular_elements = regular_starts.size();
+    _mesh_info.ghost_elements = ghost_starts.size();
+
+    std::vector<MeshLib::Node*> mesh_nodes;
+    std::vector<unsigned long> glb_node_ids;
+    setNodes(node_data, mesh_nodes, glb_node_ids);
+
+    std::vector<MeshLib::Element*> mesh_elems(_mesh_info.regular_elements +
+                                              _mesh_info.ghost_elements);
+    setElements(mesh_nodes, toElementData(regular_starts, regular_data),
+                mesh_elems);
+    const bool process_ghost = true;
+    setElements(mesh_nodes, toElementData(ghost_starts, ghost_data),
+                mesh_elems, process_ghost);
+
+    MeshLib::Properties p;
+    readMergedPropertiesBinary(file_name_base, MeshLib::MeshItemType::Node,
+                               block_ids, number_of_blocks, node_sources, p);
+    readMergedPropertiesBinary(file_name_base, MeshLib::MeshItemType::Cell,
+                               block_ids, number_of_blocks, element_sources,
+                               p);
+
+    if (!bulk_mesh_file_name_base.empty())
+    {
+        auto const bulk = mergedBlocks().find(bulk_mesh_file_name_base);
+        if (bulk == mergedBlocks().end() ||
+            bulk->second.node_ids.size() != blocks.size())
+        {
+            OGS_FATAL(
+                "The blocks of the mesh '%s' refer to the blocks of the bulk "
+                "mesh '%s', which must be read before.",
+                file_name_base.c_str(), bulk_mesh_file_name_base.c_str());
+        }
+        renumberBulkIds(p, "bulk_node_ids", MeshLib::MeshItemType::Node,
+                        node_sources, bulk->second.node_ids);
+        renumberBulkIds(p, "bulk_element_ids", MeshLib::MeshItemType::Cell,
+                        element_sources, bulk->second.element_ids);
+    }
+    mergedBlocks()[file_name_base] = std::move(merged);
+
+    return newMesh(BaseLib::extractBaseName(file_name_base), mesh_nodes,
+                   glb_node_ids, mesh_elems, p);
+}
+
 MeshLib::Properties NodePartitionedMeshReader::readPropertiesBinary(
     const std::string& file_name_base) const
 {
@@ -208,24 +637,43 @@ MeshLib::Properties NodePartitionedMeshReader::readPropertiesBinary(
 void NodePartitionedMeshReader::readPropertiesBinary(
     const std::string& file_name_base, MeshLib::MeshItemType t,
     MeshLib::Properties& p) const
+{
+    std::vector<boost::optional<MeshLib::IO::PropertyVectorMetaData>> vec_pvmd;
+    std::vector<MeshLib::IO::PropertyVectorPartitionMetaData> vec_pvpmd;
+    std::ifstream is;
+    if (!openPropertiesBinary(file_name_base, t, {_mpi_rank}, _mpi_comm_size,
+                              vec_pvmd, vec_pvpmd, is))
+    {
+        return;
+    }
+
+    readDomainSpecificPartOfPropertyVectors(vec_pvmd, vec_pvpmd[0], t, is, p);
+}
+
+bool NodePartitionedMeshReader::openPropertiesBinary(
+    std::string const& file_name_base, MeshLib::MeshItemType t,
+    std::vector<int> const& partition_ids, int const number_of_partitions,
+    std::vector<boost::optional<MeshLib::IO::PropertyVectorMetaData>>&
+        vec_pvmd,
+    std::vector<MeshLib::IO::PropertyVectorPartitionMetaData>& vec_pvpmd,
+    std::ifstream& is) const
 {
     std::string const item_type =
         t == MeshLib::MeshItemType::Node ? "node" : "cell";
     const std::string fname_cfg = file_name_base + "_partitioned_" + item_type +
                                   "_properties_cfg" +
-                                  std::to_string(_mpi_comm_size) + ".bin";
-    std::ifstream is(fname_cfg.c_str(), std::ios::binary | std::ios::in);
+                                  std::to_string(number_of_partitions) + ".bin";
+    is.open(fname_cfg.c_str(), std::ios::binary | std::ios::in);
     if (!is)
     {
         WARN("Could not open file '%s'.\n"
              "\tYou can ignore this warning if the mesh does not contain %s-"
              "wise property data.", fname_cfg.c_str(), item_type.data());
-        return;
+        return false;
     }
     std::size_t number_of_properties = 0;
     is.read(reinterpret_cast<char*>(&number_of_properties), sizeof(std::size_t));
-    std::vector<boost::optional<MeshLib::IO::PropertyVectorMetaData>> vec_pvmd(
-        number_of_properties);
+    vec_pvmd.resize(number_of_properties);
     for (std::size_t i(0); i < number_of_properties; ++i)
     {
         vec_pvmd[i] = MeshLib::IO::readPropertyVectorMetaData(is);
@@ -243,15 +691,29 @@ void NodePartitionedMeshReader::readPropertiesBinary(
         MeshLib::IO::writePropertyVectorMetaData(*(vec_pvmd[i]));
         DBUG("[%d] +++++++++++++", _mpi_rank);
     }
-    auto pos = is.tellg();
-    auto offset =
-        static_cast<long>(pos) +
-        static_cast<long>(_mpi_rank *
+    auto const pos = is.tellg();
+    bool pvpmd_read_ok = true;
+    vec_pvpmd.clear();
+    for (auto const partition_id : partition_ids)
+    {
+        auto offset = static_cast<long>(pos) +
+                      static_cast<long>(
+                          partition_id *
                           sizeof(MeshLib::IO::PropertyVectorPartitionMetaData));
-    is.seekg(offset);
-    boost::optional<MeshLib::IO::PropertyVectorPartitionMetaData> pvpmd(
-        MeshLib::IO::readPropertyVectorPartitionMetaData(is));
-    bool pvpmd_read_ok = static_cast<bool>(pvpmd);
+        is.seekg(offset);
+        boost::optional<MeshLib::IO::PropertyVectorPartitionMetaData> pvpmd(
+            MeshLib::IO::readPropertyVectorPartitionMetaData(is));
+        if (!pvpmd)
+        {
+            pvpmd_read_ok = false;
+            break;
+        }
+        DBUG("[%d] offset in the PropertyVector: %d", _mpi_rank,
+             pvpmd->offset);
+        DBUG("[%d] %d tuples in partition.", _mpi_rank,
+             pvpmd->number_of_tuples);
+        vec_pvpmd.push_back(*pvpmd);
+    }
     bool all_pvpmd_read_ok;
     MPI_Allreduce(&pvpmd_read_ok, &all_pvpmd_read_ok, 1, MPI_C_BOOL, MPI_LOR,
                   _mpi_comm);
@@ -262,13 +724,11 @@ void NodePartitionedMeshReader::readPropertiesBinary(
             "Could not read the partition meta data for the mpi process %d",
             _mpi_rank);
     }
-    DBUG("[%d] offset in the PropertyVector: %d", _mpi_rank, pvpmd->offset);
-    DBUG("[%d] %d tuples in partition.", _mpi_rank, pvpmd->number_of_tuples);
     is.close();
 
     const std::string fname_val = file_name_base + "_partitioned_" + item_type +
                                   "_properties_val" +
-                                  std::to_string(_mpi_comm_size) + ".bin";
+                                  std::to_string(number_of_partitions) + ".bin";
     is.open(fname_val.c_str(), std::ios::binary | std::ios::in);
     if (!is)
     {
@@ -276,8 +736,7 @@ void NodePartitionedMeshReader::readPropertiesBinary(
             "\tYou can ignore this warning if the mesh does not contain %s-"
              "wise property data.", fname_val.c_str(), item_type.data());
     }
-
-    readDomainSpecificPartOfPropertyVectors(vec_pvmd, *pvpmd, t, is, p);
+    return true;
 }
 
 void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
@@ -296,44 +755,82 @@ void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
              _mpi_rank, global_offset,
              global_offset +
                  pvpmd.offset * vec_pvmd[i]->data_type_size_in_bytes);
-        if (vec_pvmd[i]->is_int_type)
-        {
-            if (vec_pvmd[i]->is_data_type_signed)
-            {
-                if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(int))
-                    createPropertyVectorPart<int>(is, *vec_pvmd[i], pvpmd, t,
-                                                  global_offset, p);
-                if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(long))
-                    createPropertyVectorPart<long>(is, *vec_pvmd[i], pvpmd, t,
-                                                   global_offset, p);
-            }
-            else
-            {
-                if (vec_pvmd[i]->data_type_size_in_bytes ==
-                    sizeof(unsigned int))
-                    createPropertyVectorPart<unsigned int>(
-                        is, *vec_pvmd[i], pvpmd, t, global_offset, p);
-                if (vec_pvmd[i]->data_type_size_in_bytes ==
-                    sizeof(unsigned long))
-                    createPropertyVectorPart<unsigned long>(
-                        is, *vec_pvmd[i], pvpmd, t, global_offset, p);
-            }
-        }
-        else
-        {
-            if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(float))
-                createPropertyVectorPart<float>(is, *vec_pvmd[i], pvpmd, t,
-                                                global_offset, p);
-            if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(double))
-                createPropertyVectorPart<double>(is, *vec_pvmd[i], pvpmd, t,
-                                                 global_offset, p);
-        }
+        applyToValueType(*vec_pvmd[i], [&](auto* value_type) {
+            using T = std::remove_pointer_t<decltype(value_type)>;
+            createPropertyVectorPart<T>(is, *vec_pvmd[i], pvpmd, t,
+                                        global_offset, p);
+        });
         global_offset += vec_pvmd[i]->data_type_size_in_bytes *
                          vec_pvmd[i]->number_of_tuples *
                          vec_pvmd[i]->number_of_components;
     }
 }
 
+void NodePartitionedMeshReader::readMergedPropertiesBinary(
+    std::string const& file_name_base, MeshLib::MeshItemType t,
+    std::vector<int> const& block_ids, int const number_of_blocks,
+    ItemSources const& sources, MeshLib::Properties& p) const
+{
+    std::vector<boost::optional<MeshLib::IO::PropertyVectorMetaData>> vec_pvmd;
+    std::vector<MeshLib::IO::PropertyVectorPartitionMetaData> vec_pvpmd;
+    std::ifstream is;
+    if (!openPropertiesBinary(file_name_base, t, block_ids, number_of_blocks,
+                              vec_pvmd, vec_pvpmd, is))
+    {
+        return;
+    }
+
+    unsigned long global_offset = 0;
+    for (auto const& pvmd : vec_pvmd)
+    {
+        applyToValueType(*pvmd, [&](auto* value_type) {
+            using T = std::remove_pointer_t<decltype(value_type)>;
+            createMergedPropertyVector<T>(is, *pvmd, vec_pvpmd, sources, t,
+                                          global_offset, p);
+        });
+        global_offset += pvmd->data_type_size_in_bytes *
+                         pvmd->number_of_tuples * pvmd->number_of_components;
+    }
+}
+
+template <typename T>
+void NodePartitionedMeshReader::createMergedPropertyVector(
+    std::istream& is, MeshLib::IO::PropertyVectorMetaData const& pvmd,
+    std::vector<MeshLib::IO::PropertyVectorPartitionMetaData> const& vec_pvpmd,
+    ItemSources const& sources, MeshLib::MeshItemType t,
+    unsigned long const global_offset, MeshLib::Properties& p) const
+{
+    auto const n_components = pvmd.number_of_components;
+
+    // Read the parts of all blocks.
+    std::vector<std::vector<T>> parts(vec_pvpmd.size());
+    for (std::size_t k = 0; k < vec_pvpmd.size(); ++k)
+    {
+        auto const& pvpmd = vec_pvpmd[k];
+        parts[k].resize(pvpmd.number_of_tuples * n_components);
+        is.seekg(global_offset + pvpmd.offset * sizeof(T));
+        if (!is.read(reinterpret_cast<char*>(parts[k].data()),
+                     parts[k].size() * sizeof(T)))
+        {
+            OGS_FATAL(
+                "Error in NodePartitionedMeshReader::readPropertiesBinary: "
+                "Could not read the part of block %d of the PropertyVector "
+                "'%s'.",
+                k, pvmd.property_name.c_str());
+        }
+    }
+
+    MeshLib::PropertyVector<T>* pv =
+        p.createNewPropertyVector<T>(pvmd.property_name, t, n_components);
+    pv->resize(sources.size() * n_components);
+    for (std::size_t i = 0; i < sources.size(); ++i)
+    {
+        auto const& part = parts[sources[i].first];
+        std::copy_n(&part[sources[i].second * n_components], n_components,
+                    &(*pv)[i * n_components]);
+    }
+}
+
 bool NodePartitionedMeshReader::openASCIIFiles(
     std::string const& file_name_base, std::ifstream& is_cfg,
     std::ifstream& is_node, std::ifstream& is_elem) const
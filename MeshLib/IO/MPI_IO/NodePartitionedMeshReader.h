@@ -15,6 +15,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <mpi.h>
@@ -165,6 +166,47 @@ private:
      */
     MeshLib::NodePartitionedMesh* readBinary(const std::string &file_name_base);
 
+    /// The data of one block of a mesh partitioned into blocks, i.e., the
+    /// data of one partition as read by readBinary().
+    struct Block
+    {
+        PartitionedMeshInfo mesh_info;
+        std::vector<NodeData> nodes;
+        std::vector<unsigned long> regular_elements;
+        std::vector<unsigned long> ghost_elements;
+    };
+
+    /// The block index within the blocks of this rank and the local index
+    /// in that block of each node or element of a merged mesh.
+    using ItemSources = std::vector<std::pair<std::size_t, std::size_t>>;
+
+    /// Reads the binary files of one partition written for the given number
+    /// of partitions. All ranks must call the function collectively.
+    bool readBinaryBlock(std::string const& file_name_base, int block_id,
+                         int number_of_blocks, Block& block) const;
+
+    /*!
+         \brief Create a NodePartitionedMesh object from the binary files of a
+                mesh partitioned into a number of blocks being a multiple of
+                the number of ranks.
+
+                Each rank merges consecutive blocks and derives its ghost
+                nodes and ghost elements from the blocks' ones: Nodes owned by
+                any of the merged blocks are owned by the rank, the others are
+                ghost nodes. Elements with all nodes owned by the rank are
+                regular elements, elements listed as ghost elements in several
+                of the blocks are merged into one.
+         \param file_name_base  Name of file to be read without extension.
+         \param number_of_blocks Number of partitions of the files.
+         \param bulk_mesh_file_name_base Files of the merged bulk mesh used
+                           for the renumbering of the \c bulk_node_ids and
+                           \c bulk_element_ids properties, or empty.
+         \return           Pointer to Mesh object.
+     */
+    MeshLib::NodePartitionedMesh* readBinaryBlocks(
+        std::string const& file_name_base, int number_of_blocks,
+        std::string const& bulk_mesh_file_name_base);
+
     MeshLib::Properties readPropertiesBinary(
         const std::string& file_name_base) const;
 
@@ -172,6 +214,34 @@ private:
                               MeshLib::MeshItemType t,
                               MeshLib::Properties& p) const;
 
+    /// Reads the meta data of the PropertyVectors and of their parts for the
+    /// given partitions, and opens the file of the values.
+    /// \return False if the mesh has no PropertyVectors of the item type.
+    bool openPropertiesBinary(
+        std::string const& file_name_base, MeshLib::MeshItemType t,
+        std::vector<int> const& partition_ids, int number_of_partitions,
+        std::vector<boost::optional<MeshLib::IO::PropertyVectorMetaData>>&
+            vec_pvmd,
+        std::vector<MeshLib::IO::PropertyVectorPartitionMetaData>& vec_pvpmd,
+        std::ifstream& is) const;
+
+    /// Reads the PropertyVectors of the given item type of the blocks and
+    /// merges them in the order of the given sources.
+    void readMergedPropertiesBinary(std::string const& file_name_base,
+                                    MeshLib::MeshItemType t,
+                                    std::vector<int> const& block_ids,
+                                    int number_of_blocks,
+                                    ItemSources const& sources,
+                                    MeshLib::Properties& p) const;
+
+    template <typename T>
+    void createMergedPropertyVector(
+        std::istream& is, MeshLib::IO::PropertyVectorMetaData const& pvmd,
+        std::vector<MeshLib::IO::PropertyVectorPartitionMetaData> const&
+            vec_pvpmd,
+        ItemSources const& sources, MeshLib::MeshItemType t,
+        unsigned long global_offset, MeshLib::Properties& p) const;
+
     void readDomainSpecificPartOfPropertyVectors(
         std::vector<boost::optional<MeshLib::IO::PropertyVectorMetaData>> const&
             vec_pvmd,
@@ -26,32 +26,44 @@ void PVDFile::addVTUFile(const std::string &vtu_fname, double timestep)
 {
     #ifdef USE_PETSC
         auto const vtu_file_name =
-            getVtuFileNameForPetscOutputWithoutExtension(vtu_fname);
-
-        _datasets.emplace_back(timestep, vtu_file_name + ".pvtu");
+            getVtuFileNameForPetscOutputWithoutExtension(vtu_fname) + ".pvtu";
     #else
-        _datasets.emplace_back(timestep, vtu_fname);
+        auto const& vtu_file_name = vtu_fname;
     #endif
 
-    std::ofstream fh(_pvd_filename.c_str());
-    if (!fh) {
-        OGS_FATAL("could not open file `%s'", _pvd_filename.c_str());
-    }
+    if (!_pvd_file.is_open())
+    {
+        _pvd_file.open(_pvd_filename, std::ios::out | std::ios::trunc);
+        if (!_pvd_file) {
+            OGS_FATAL("could not open file `%s'", _pvd_filename.c_str());
+        }
+
+        _pvd_file << std::setprecision(std::numeric_limits<double>::digits10);
 
-    fh << std::setprecision(std::numeric_limits<double>::digits10);
+        _pvd_file << "<?xml version=\"1.0\"?>\n"
+               "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\""
+               " compressor=\"vtkZLibDataCompressor\">\n"
+               "  <Collection>\n";
+        _pvd_end = _pvd_file.tellp();
+    }
 
-    fh << "<?xml version=\"1.0\"?>\n"
-           "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\""
-           " compressor=\"vtkZLibDataCompressor\">\n"
-           "  <Collection>\n";
+    // Overwrite the closing tags written after the previous entry.
+    _pvd_file.seekp(_pvd_end);
+    _pvd_file << "    <DataSet timestep=\"" << timestep
+              << "\" group=\"\" part=\"0\" file=\"" << vtu_file_name
+              << "\"/>\n";
+    _pvd_end = _pvd_file.tellp();
+    writeClosingTags();
+}
 
-    for (auto const& pair : _datasets)
+void PVDFile::writeClosingTags()
+{
+    _pvd_file << "  </Collection>\n</VTKFile>\n";
+    _pvd_file.flush();
+    if (!_pvd_file)
     {
-        fh << "    <DataSet timestep=\"" << pair.first
-           << "\" group=\"\" part=\"0\" file=\"" << pair.second << "\"/>\n";
+        OGS_FATAL("could not write file `%s'", _pvd_filename.c_str());
     }
-
-    fh << "  </Collection>\n</VTKFile>\n";
 }
 
 }  // namespace IO
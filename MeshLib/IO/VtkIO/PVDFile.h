@@ -10,9 +10,9 @@
 
 #pragma once
 
+#include <fstream>
 #include <string>
 #include <utility>
-#include <vector>
 
 namespace MeshLib
 {
@@ -20,6 +20,11 @@ namespace IO
 {
 
 /*! Writes a basic PVD file for use with Paraview.
+ *
+ * The file is created on the first added VTU file. Each further VTU file
+ * overwrites only the closing tags by its data set entry followed by new
+ * closing tags, such that the file stays valid between the outputs and the
+ * previous entries are never rewritten.
  */
 class PVDFile
 {
@@ -34,8 +39,13 @@ public:
     void addVTUFile(std::string const& vtu_fname, double timestep);
 
 private:
+    //! Writes the closing tags at the current position of the file.
+    void writeClosingTags();
+
     std::string const _pvd_filename;
-    std::vector<std::pair<double, std::string>> _datasets; // a vector of (time, VTU file name)
+    std::fstream _pvd_file;
+    //! Position of the closing tags, which are overwritten by the next entry.
+    std::fstream::pos_type _pvd_end;
 };
 
 } // namespace IO
@@ -34,6 +34,8 @@
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshGenerators/VtkMeshConverter.h"
 #include "MeshLib/Vtk/VtkMappedMeshSource.h"
+#include "VtuRawReader.h"
+#include "VtuZLibWriter.h"
 
 namespace MeshLib
 {
@@ -54,6 +56,16 @@ MeshLib::Mesh* VtuInterface::readVTUFile(std::string const &file_name)
         return nullptr;
     }
 
+    std::string const mesh_name (BaseLib::extractBaseNameWithoutExtension(file_name));
+
+    // Uncompressed or zlib compressed files with raw appended data are read
+    // without the VTK reader, which would hold three copies of the data at
+    // once and decompress the data in a single thread.
+    if (auto* const mesh = readAppendedRawVtuFile(file_name, mesh_name))
+    {
+        return mesh;
+    }
+
     vtkSmartPointer<vtkXMLUnstructuredGridReader> reader =
         vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
     reader->SetFileName(file_name.c_str());
@@ -66,7 +78,6 @@ MeshLib::Mesh* VtuInterface::readVTUFile(std::string const &file_name)
         return nullptr;
     }
 
-    std::string const mesh_name (BaseLib::extractBaseNameWithoutExtension(file_name));
     return MeshLib::VtkMeshConverter::convertUnstructuredGrid(vtkGrid, mesh_name);
 }
 
@@ -105,6 +116,11 @@ bool VtuInterface::writeToFile(std::string const &file_name)
     return writeVTU<vtkXMLPUnstructuredGridWriter>(vtu_file_name + ".pvtu",
                                                    mpi_size, rank);
 #else
+    // VTK's writer compresses the data arrays in a single thread.
+    if (_mesh && _use_compressor && _data_mode == vtkXMLWriter::Appended)
+    {
+        return writeAppendedZLibVtuFile(*_mesh, file_name);
+    }
     return writeVTU<vtkXMLUnstructuredGridWriter>(file_name);
 #endif
 }
@@ -0,0 +1,614 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "VtuRawReader.h"
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <RapidXML/rapidxml.hpp>
+#include <logog/include/logog.hpp>
+#include <vtk_zlib.h>
+
+#include "BaseLib/Error.h"
+#include "BaseLib/MappedFile.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/createElementFromVtkCell.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Properties.h"
+
+namespace
+{
+/// The raw appended data section of a VTU file.
+struct AppendedData
+{
+    char const* begin;
+    char const* end;
+    /// Size of the byte count preceding each data array, or of the entries
+    /// of the block header of compressed arrays.
+    std::size_t header_size;
+    /// Storage of the decompressed arrays if the data is zlib compressed,
+    /// otherwise a nullptr.
+    std::deque<std::vector<char>>* decompressed_arrays;
+};
+
+/// A data array in the raw appended data section. The data is not
+/// necessarily aligned.
+struct RawArray
+{
+    std::string name;
+    std::string type;
+    std::size_t number_of_components;
+    std::size_t value_size;
+    char const* data;
+    std::size_t number_of_values;
+};
+
+struct PropertyArray
+{
+    RawArray array;
+    MeshLib::MeshItemType item_type;
+};
+
+char const* getAttribute(rapidxml::xml_node<> const& node, char const* name)
+{
+    auto const* const attribute = node.first_attribute(name);
+    return attribute == nullptr ? nullptr : attribute->value();
+}
+
+bool isLittleEndian()
+{
+    std::uint16_t const one = 1;
+    unsigned char first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+std::size_t valueSize(std::string_view const type)
+{
+    if (type == "Int8" || type == "UInt8")
+    {
+        return 1;
+    }
+    if (type == "Int16" || type == "UInt16")
+    {
+        return 2;
+    }
+    if (type == "Int32" || type == "UInt32" || type == "Float32")
+    {
+        return 4;
+    }
+    if (type == "Int64" || type == "UInt64" || type == "Float64")
+    {
+        return 8;
+    }
+    return 0;
+}
+
+template <typename T>
+T valueAt(char const* const data, std::size_t const i)
+{
+    T value;
+    std::memcpy(&value, data + i * sizeof(T), sizeof(T));
+    return value;
+}
+
+/// Decompresses an array stored in the block format of VTK's zlib compressor,
+/// i.e. preceded by the number of blocks, the block size, the size of a
+/// partial last block, and the compressed sizes of the blocks. The blocks are
+/// decompressed concurrently.
+/// \return The decompressed array or a nullptr if the data is invalid.
+std::vector<char> const* decompressArray(char const* const header,
+                                         AppendedData const& appended_data)
+{
+    auto const word = [&](std::size_t const i) -> std::size_t {
+        return appended_data.header_size == 8
+                   ? valueAt<std::uint64_t>(header, i)
+                   : valueAt<std::uint32_t>(header, i);
+    };
+    auto const available =
+        static_cast<std::size_t>(appended_data.end - header);
+    if (available < 3 * appended_data.header_size)
+    {
+        return nullptr;
+    }
+    std::size_t const n_blocks = word(0);
+    std::size_t const block_size = word(1);
+    std::size_t const last_block_size = word(2) == 0 ? block_size : word(2);
+    if (n_blocks > available / appended_data.header_size - 3 ||
+        last_block_size > block_size)
+    {
+        return nullptr;
+    }
+
+    char const* const blocks_begin =
+        header + (3 + n_blocks) * appended_data.header_size;
+    std::vector<char const*> compressed_blocks(n_blocks);
+    std::vector<std::size_t> compressed_sizes(n_blocks);
+    std::size_t compressed_size = 0;
+    for (std::size_t b = 0; b < n_blocks; ++b)
+    {
+        compressed_blocks[b] = blocks_begin + compressed_size;
+        compressed_sizes[b] = word(3 + b);
+        compressed_size += compressed_sizes[b];
+    }
+    if (compressed_size >
+        static_cast<std::size_t>(appended_data.end - blocks_begin))
+    {
+        return nullptr;
+    }
+
+    auto& decompressed = appended_data.decompressed_arrays->emplace_back(
+        n_blocks == 0 ? 0 : (n_blocks - 1) * block_size + last_block_size);
+
+    int failed = 0;
+    // OpenMP 2.0 (MSVC) supports only signed loop counters.
+    auto const n = static_cast<std::ptrdiff_t>(n_blocks);
+#pragma omp parallel for schedule(dynamic) reduction(+ : failed)
+    for (std::ptrdiff_t b = 0; b < n; ++b)
+    {
+        auto const size = b == n - 1 ? last_block_size : block_size;
+        auto decompressed_size = static_cast<uLongf>(size);
+        if (uncompress(reinterpret_cast<Bytef*>(decompressed.data() +
+                                                b * block_size),
+                       &decompressed_size,
+                       reinterpret_cast<Bytef const*>(compressed_blocks[b]),
+                       static_cast<uLong>(compressed_sizes[b])) != Z_OK ||
+            decompressed_size != size)
+        {
+            failed++;
+        }
+    }
+    if (failed > 0)
+    {
+        return nullptr;
+    }
+    return &decompressed;
+}
+
+/// Returns the i-th value of an array of non-negative integers.
+std::size_t indexAt(RawArray const& array, std::size_t const i)
+{
+    switch (array.value_size)
+    {
+        case 1:
+            return valueAt<std::uint8_t>(array.data, i);
+        case 2:
+            return valueAt<std::uint16_t>(array.data, i);
+        case 4:
+            return valueAt<std::uint32_t>(array.data, i);
+        default:
+            return valueAt<std::uint64_t>(array.data, i);
+    }
+}
+
+std::optional<RawArray> getRawArray(rapidxml::xml_node<> const& data_array,
+                                    AppendedData const& appended_data)
+{
+    char const* const name = getAttribute(data_array, "Name");
+    char const* const type = getAttribute(data_array, "type");
+    char const* const format = getAttribute(data_array, "format");
+    char const* const offset = getAttribute(data_array, "offset");
+    if (name == nullptr || type == nullptr || format == nullptr ||
+        offset == nullptr || std::strcmp(format, "appended") != 0)
+    {
+        return {};
+    }
+    std::size_t const value_size = valueSize(type);
+    if (value_size == 0)
+    {
+        return {};
+    }
+    char const* const components =
+        getAttribute(data_array, "NumberOfComponents");
+    std::size_t const number_of_components =
+        components == nullptr ? 1 : std::stoul(components);
+
+    std::size_t const offset_value = std::stoull(offset);
+    auto const appended_size =
+        static_cast<std::size_t>(appended_data.end - appended_data.begin);
+    if (appended_size < appended_data.header_size ||
+        offset_value > appended_size - appended_data.header_size)
+    {
+        return {};
+    }
+    char const* const header = appended_data.begin + offset_value;
+    char const* data;
+    std::size_t size_in_bytes;
+    if (appended_data.decompressed_arrays != nullptr)
+    {
+        auto const* const decompressed = decompressArray(header, appended_data);
+        if (decompressed == nullptr)
+        {
+            return {};
+        }
+        data = decompressed->data();
+        size_in_bytes = decompressed->size();
+    }
+    else
+    {
+        size_in_bytes = appended_data.header_size == 8
+                            ? valueAt<std::uint64_t>(header, 0)
+                            : valueAt<std::uint32_t>(header, 0);
+        data = header + appended_data.header_size;
+        if (static_cast<std::size_t>(appended_data.end - data) < size_in_bytes)
+        {
+            return {};
+        }
+    }
+    if (number_of_components == 0 ||
+        size_in_bytes % (value_size * number_of_components) != 0)
+    {
+        return {};
+    }
+
+    return RawArray{name,       type, number_of_components,
+                    value_size, data, size_in_bytes / value_size};
+}
+
+rapidxml::xml_node<> const* findDataArray(rapidxml::xml_node<> const& parent,
+                                          char const* const name)
+{
+    for (auto const* data_array = parent.first_node("DataArray");
+         data_array != nullptr;
+         data_array = data_array->next_sibling("DataArray"))
+    {
+        char const* const array_name = getAttribute(*data_array, "Name");
+        if (array_name != nullptr && std::strcmp(array_name, name) == 0)
+        {
+            return data_array;
+        }
+    }
+    return nullptr;
+}
+
+/// Collects the data arrays of the given node. Returns false if one of the
+/// arrays is not stored in the raw appended data.
+bool collectPropertyArrays(rapidxml::xml_node<> const* const parent,
+                           MeshLib::MeshItemType const item_type,
+                           AppendedData const& appended_data,
+                           std::vector<PropertyArray>& property_arrays)
+{
+    if (parent == nullptr)
+    {
+        return true;
+    }
+    for (auto const* data_array = parent->first_node("DataArray");
+         data_array != nullptr;
+         data_array = data_array->next_sibling("DataArray"))
+    {
+        auto array = getRawArray(*data_array, appended_data);
+        if (!array)
+        {
+            return false;
+        }
+        property_arrays.push_back({std::move(*array), item_type});
+    }
+    return true;
+}
+
+template <typename T>
+void createPropertyVector(RawArray const& array,
+                          MeshLib::MeshItemType const item_type,
+                          MeshLib::Properties& properties)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "The property values are copied bytewise.");
+    if (sizeof(T) != array.value_size)
+    {
+        OGS_FATAL("Size mismatch converting the array '%s'.",
+                  array.name.c_str());
+    }
+
+    auto* const vec = properties.createNewPropertyVector<T>(
+        array.name, item_type, array.number_of_components);
+    if (!vec)
+    {
+        WARN("Array %s could not be converted to PropertyVector.",
+             array.name.c_str());
+        return;
+    }
+    vec->resize(array.number_of_values);
+    std::memcpy(vec->data(), array.data, array.number_of_values * sizeof(T));
+}
+
+/// Creates the property vectors with the same value types as
+/// MeshLib::VtkMeshConverter does.
+void createPropertyVector(PropertyArray const& property_array,
+                          MeshLib::Properties& properties)
+{
+    auto const& array = property_array.array;
+    auto const item_type = property_array.item_type;
+    using UInt64 = std::conditional_t<sizeof(unsigned long) == 8,
+                                      unsigned long, unsigned long long>;
+
+    if (array.type == "Float64")
+    {
+        createPropertyVector<double>(array, item_type, properties);
+    }
+    else if (array.type == "Float32")
+    {
+        createPropertyVector<float>(array, item_type, properties);
+    }
+    else if (array.type == "Int32")
+    {
+        createPropertyVector<int>(array, item_type, properties);
+    }
+    else if (array.type == "Int8")
+    {
+        createPropertyVector<char>(array, item_type, properties);
+    }
+    else if (array.type == "UInt64")
+    {
+        createPropertyVector<UInt64>(array, item_type, properties);
+    }
+    else if (array.type == "UInt32")
+    {
+        // MaterialIDs are assumed to be integers
+        if (array.name == "MaterialIDs")
+        {
+            createPropertyVector<int>(array, item_type, properties);
+        }
+        else
+        {
+            createPropertyVector<unsigned>(array, item_type, properties);
+        }
+    }
+    else
+    {
+        WARN(
+            "Array '%s' in VTU file uses unsupported data type '%s'. The data "
+            "array will not be available.",
+            array.name.c_str(), array.type.c_str());
+    }
+}
+
+void deleteNodesAndElements(std::vector<MeshLib::Node*> const& nodes,
+                            std::vector<MeshLib::Element*> const& elements)
+{
+    for (auto* element : elements)
+    {
+        delete element;
+    }
+    for (auto* node : nodes)
+    {
+        delete node;
+    }
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+MeshLib::Mesh* readAppendedRawVtuFile(std::string const& file_name,
+                                      std::string const& mesh_name)
+{
+    BaseLib::MappedFile const file(file_name);
+    if (file.data() == nullptr)
+    {
+        DBUG("Could not map the file '%s' into memory.", file_name.c_str());
+        return nullptr;
+    }
+    std::string_view const content(file.data(), file.size());
+
+    // The xml header precedes the appended data and is terminated to be
+    // parsed separately from the binary data.
+    auto const appended_data_tag = content.find("<AppendedData");
+    auto const appended_data_tag_end = content.find('>', appended_data_tag);
+    if (appended_data_tag_end == std::string_view::npos)
+    {
+        DBUG("The file '%s' has no appended data.", file_name.c_str());
+        return nullptr;
+    }
+    if (content.substr(appended_data_tag,
+                       appended_data_tag_end - appended_data_tag)
+            .find("encoding=\"raw\"") == std::string_view::npos)
+    {
+        DBUG("The appended data of the file '%s' is not raw encoded.",
+             file_name.c_str());
+        return nullptr;
+    }
+    auto const appended_data_begin = content.find('_', appended_data_tag_end);
+    if (appended_data_begin == std::string_view::npos)
+    {
+        return nullptr;
+    }
+
+    std::string const closing_tag = "</VTKFile>";
+    std::vector<char> xml_header(file.data(), file.data() + appended_data_tag);
+    xml_header.insert(xml_header.end(), closing_tag.begin(), closing_tag.end());
+    xml_header.push_back('\0');
+
+    rapidxml::xml_document<> doc;
+    try
+    {
+        doc.parse<0>(xml_header.data());
+    }
+    catch (rapidxml::parse_error const& e)
+    {
+        DBUG("Could not parse the xml header of the file '%s': %s.",
+             file_name.c_str(), e.what());
+        return nullptr;
+    }
+
+    auto const* const vtk_file = doc.first_node("VTKFile");
+    if (vtk_file == nullptr)
+    {
+        return nullptr;
+    }
+    char const* const type = getAttribute(*vtk_file, "type");
+    char const* const byte_order = getAttribute(*vtk_file, "byte_order");
+    char const* const header_type = getAttribute(*vtk_file, "header_type");
+    char const* const compressor = getAttribute(*vtk_file, "compressor");
+    if (type == nullptr || std::strcmp(type, "UnstructuredGrid") != 0 ||
+        (compressor != nullptr &&
+         std::strcmp(compressor, "vtkZLibDataCompressor") != 0) ||
+        byte_order == nullptr ||
+        std::strcmp(byte_order,
+                    isLittleEndian() ? "LittleEndian" : "BigEndian") != 0)
+    {
+        DBUG(
+            "The file '%s' is not an uncompressed or zlib compressed "
+            "unstructured grid in native byte order.",
+            file_name.c_str());
+        return nullptr;
+    }
+    // The decompressed arrays are kept until the mesh is created.
+    std::deque<std::vector<char>> decompressed_arrays;
+    AppendedData const appended_data{
+        file.data() + appended_data_begin + 1, file.data() + file.size(),
+        header_type != nullptr && std::strcmp(header_type, "UInt64") == 0
+            ? std::size_t{8}
+            : std::size_t{4},
+        compressor == nullptr ? nullptr : &decompressed_arrays};
+
+    auto const* const grid = vtk_file->first_node("UnstructuredGrid");
+    auto const* const piece =
+        grid == nullptr ? nullptr : grid->first_node("Piece");
+    if (piece == nullptr || piece->next_sibling("Piece") != nullptr)
+    {
+        DBUG("The file '%s' does not contain exactly one piece.",
+             file_name.c_str());
+        return nullptr;
+    }
+    char const* const number_of_points = getAttribute(*piece, "NumberOfPoints");
+    char const* const number_of_cells = getAttribute(*piece, "NumberOfCells");
+    auto const* const points_node = piece->first_node("Points");
+    auto const* const cells_node = piece->first_node("Cells");
+    if (number_of_points == nullptr || number_of_cells == nullptr ||
+        points_node == nullptr || cells_node == nullptr ||
+        findDataArray(*cells_node, "faces") != nullptr)
+    {
+        return nullptr;
+    }
+    std::size_t const n_points = std::stoull(number_of_points);
+    std::size_t const n_cells = std::stoull(number_of_cells);
+    if (n_points == 0)
+    {
+        return nullptr;
+    }
+
+    auto const* const points_array = points_node->first_node("DataArray");
+    auto const* const connectivity_array =
+        findDataArray(*cells_node, "connectivity");
+    auto const* const offsets_array = findDataArray(*cells_node, "offsets");
+    auto const* const types_array = findDataArray(*cells_node, "types");
+    if (points_array == nullptr || connectivity_array == nullptr ||
+        offsets_array == nullptr || types_array == nullptr)
+    {
+        return nullptr;
+    }
+    auto const points = getRawArray(*points_array, appended_data);
+    auto const connectivity = getRawArray(*connectivity_array, appended_data);
+    auto const offsets = getRawArray(*offsets_array, appended_data);
+    auto const types = getRawArray(*types_array, appended_data);
+    if (!points || !connectivity || !offsets || !types ||
+        points->type.compare(0, 5, "Float") != 0 ||
+        points->number_of_values != 3 * n_points ||
+        connectivity->type.find("Int") == std::string::npos ||
+        offsets->type.find("Int") == std::string::npos ||
+        types->type != "UInt8" || types->number_of_values != n_cells ||
+        (offsets->number_of_values != n_cells &&
+         offsets->number_of_values != n_cells + 1))
+    {
+        DBUG("The file '%s' contains unsupported point or cell arrays.",
+             file_name.c_str());
+        return nullptr;
+    }
+
+    std::vector<PropertyArray> property_arrays;
+    if (!collectPropertyArrays(grid->first_node("FieldData"),
+                               MeshLib::MeshItemType::IntegrationPoint,
+                               appended_data, property_arrays) ||
+        !collectPropertyArrays(piece->first_node("PointData"),
+                               MeshLib::MeshItemType::Node, appended_data,
+                               property_arrays) ||
+        !collectPropertyArrays(piece->first_node("CellData"),
+                               MeshLib::MeshItemType::Cell, appended_data,
+                               property_arrays))
+    {
+        DBUG("The file '%s' contains data arrays not in the appended data.",
+             file_name.c_str());
+        return nullptr;
+    }
+
+    std::vector<MeshLib::Node*> nodes(n_points);
+    bool const double_coordinates = points->value_size == 8;
+    for (std::size_t i = 0; i < n_points; ++i)
+    {
+        auto const coordinate = [&](std::size_t const k) -> double {
+            return double_coordinates
+                       ? valueAt<double>(points->data, 3 * i + k)
+                       : valueAt<float>(points->data, 3 * i + k);
+        };
+        nodes[i] = new MeshLib::Node(coordinate(0), coordinate(1),
+                                     coordinate(2), i);
+    }
+
+    // Newer VTK versions write the offsets including the leading zero.
+    bool const offsets_with_begin = offsets->number_of_values == n_cells + 1;
+    std::vector<MeshLib::Element*> elements;
+    elements.reserve(n_cells);
+    for (std::size_t i = 0; i < n_cells; ++i)
+    {
+        std::size_t const begin =
+            offsets_with_begin ? indexAt(*offsets, i)
+                               : (i == 0 ? 0 : indexAt(*offsets, i - 1));
+        std::size_t const end = indexAt(*offsets, offsets_with_begin ? i + 1 : i);
+        int const cell_type = static_cast<int>(indexAt(*types, i));
+
+        MeshLib::Element* element = nullptr;
+        bool valid_node_ids = true;
+        if (begin <= end && end <= connectivity->number_of_values)
+        {
+            // Invalid node ids are replaced to not access out of range, the
+            // element is discarded afterwards.
+            auto const node_id = [&](unsigned const k) -> std::size_t {
+                if (begin + k < end)
+                {
+                    auto const id = indexAt(*connectivity, begin + k);
+                    if (id < n_points)
+                    {
+                        return id;
+                    }
+                }
+                valid_node_ids = false;
+                return 0;
+            };
+            element = createElementFromVtkCell(cell_type, nodes, node_id, i);
+        }
+        if (element == nullptr || !valid_node_ids ||
+            element->getNumberOfNodes() != end - begin)
+        {
+            ERR("Unsupported or invalid cell %d of type %d in the file '%s'.",
+                i, cell_type, file_name.c_str());
+            delete element;
+            deleteNodesAndElements(nodes, elements);
+            return nullptr;
+        }
+        elements.push_back(element);
+    }
+
+    auto* const mesh = new MeshLib::Mesh(mesh_name, nodes, elements);
+    for (auto const& property_array : property_arrays)
+    {
+        createPropertyVector(property_array, mesh->getProperties());
+    }
+    return mesh;
+}
+}  // namespace IO
+}  // namespace MeshLib
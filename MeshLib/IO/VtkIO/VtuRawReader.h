@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/// Reads a VTU file storing all data arrays uncompressed or zlib compressed in
+/// the raw appended data section directly into an OGS mesh.
+///
+/// The file is memory mapped and the nodes, elements, and property vectors are
+/// created from the mapped data without intermediate VTK data structures. The
+/// blocks of compressed arrays are decompressed concurrently.
+/// \return The mesh or a nullptr if the file is not in the supported format,
+/// e.g. compressed otherwise, ascii or base64 encoded, or of different byte
+/// order.
+MeshLib::Mesh* readAppendedRawVtuFile(std::string const& file_name,
+                                      std::string const& mesh_name);
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,422 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "VtuZLibWriter.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#include <vtk_zlib.h>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Properties.h"
+#include "MeshLib/VtkOGSEnum.h"
+
+namespace
+{
+/// Uncompressed size of the blocks the arrays are split into, the same as the
+/// default of VTK's XML writer.
+std::size_t const block_size = 32768;
+
+/// The default compression level of VTK's zlib compressor.
+int const compression_level = 5;
+
+/// A data array to be written to the appended data section.
+struct DataArray
+{
+    std::string name;
+    char const* type;
+    std::size_t number_of_components;
+    /// Written for the field data only, the number of tuples of the point
+    /// and cell data is given by the piece.
+    std::size_t number_of_tuples;
+    char const* data;
+    std::size_t size_in_bytes;
+
+    /// The number of blocks, the block size, the size of a partial last block
+    /// or zero, and the compressed sizes of all blocks.
+    std::vector<std::uint64_t> header;
+    std::vector<std::vector<Bytef>> compressed_blocks;
+    /// Offset of the header in the appended data section.
+    std::size_t offset;
+};
+
+struct DataArrays
+{
+    std::vector<DataArray> field_data;
+    std::vector<DataArray> point_data;
+    std::vector<DataArray> cell_data;
+};
+
+bool isLittleEndian()
+{
+    std::uint16_t const one = 1;
+    unsigned char first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+template <typename T>
+DataArray makeDataArray(std::string name, char const* const type,
+                        std::size_t const number_of_components,
+                        std::vector<T> const& values)
+{
+    return {std::move(name),
+            type,
+            number_of_components,
+            number_of_components == 0 ? 0
+                                      : values.size() / number_of_components,
+            reinterpret_cast<char const*>(values.data()),
+            values.size() * sizeof(T),
+            {},
+            {},
+            0};
+}
+
+/// Adds the property to the arrays if it has the value type T. The type names
+/// are the ones VTK uses for the value types of MeshLib::VtkMappedMeshSource.
+template <typename T>
+bool addPropertyArray(MeshLib::Properties const& properties,
+                      std::string const& name, char const* const type,
+                      DataArrays& arrays)
+{
+    if (!properties.existsPropertyVector<T>(name))
+    {
+        return false;
+    }
+    auto const& property = *properties.getPropertyVector<T>(name);
+    auto array = makeDataArray(name, type, property.getNumberOfComponents(),
+                               property);
+
+    switch (property.getMeshItemType())
+    {
+        case MeshLib::MeshItemType::Node:
+            arrays.point_data.push_back(std::move(array));
+            break;
+        case MeshLib::MeshItemType::Cell:
+            arrays.cell_data.push_back(std::move(array));
+            break;
+        case MeshLib::MeshItemType::IntegrationPoint:
+            arrays.field_data.push_back(std::move(array));
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+void addPropertyArrays(MeshLib::Properties const& properties,
+                       DataArrays& arrays)
+{
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        if (addPropertyArray<double>(properties, name, "Float64", arrays) ||
+            addPropertyArray<float>(properties, name, "Float32", arrays) ||
+            addPropertyArray<int>(properties, name, "Int32", arrays) ||
+            addPropertyArray<unsigned>(properties, name, "UInt32", arrays) ||
+            addPropertyArray<std::size_t>(properties, name, "UInt64",
+                                          arrays) ||
+            addPropertyArray<char>(properties, name, "Int8", arrays))
+        {
+            continue;
+        }
+
+        OGS_FATAL(
+            "Mesh property '%s' with unknown data type. Please check the data "
+            "type of the mesh properties. The available data types are:"
+            "\n\t double,"
+            "\n\t float,"
+            "\n\t int,"
+            "\n\t unsigned,"
+            "\n\t size_t,"
+            "\n\t char.",
+            name.c_str());
+    }
+}
+
+/// Returns the local index of the OGS node which is the k-th node of the
+/// element in VTK's node order, cf. MeshLib::VtkMappedMeshSource.
+unsigned ogsNodeIndex(MeshLib::CellType const cell_type, unsigned const k)
+{
+    if (cell_type == MeshLib::CellType::PRISM6)
+    {
+        return k < 3 ? k + 3 : k - 3;
+    }
+    if (cell_type == MeshLib::CellType::PRISM15)
+    {
+        if (k < 3)
+        {
+            return k + 3;
+        }
+        if (k < 6)
+        {
+            return k - 3;
+        }
+        if (k < 9)
+        {
+            return 14 - k;
+        }
+        if (k < 12)
+        {
+            return 23 - k;
+        }
+        if (k == 12)
+        {
+            return 9;
+        }
+        return k == 13 ? 11 : 10;
+    }
+    return k;
+}
+
+std::string escapeXml(std::string const& text)
+{
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char const c : text)
+    {
+        switch (c)
+        {
+            case '&':
+                escaped += "&amp;";
+                break;
+            case '<':
+                escaped += "&lt;";
+                break;
+            case '>':
+                escaped += "&gt;";
+                break;
+            case '"':
+                escaped += "&quot;";
+                break;
+            default:
+                escaped += c;
+        }
+    }
+    return escaped;
+}
+
+bool compressBlock(DataArray& array, std::size_t const block)
+{
+    auto const begin = block * block_size;
+    auto const size = std::min(block_size, array.size_in_bytes - begin);
+    auto& compressed = array.compressed_blocks[block];
+
+    auto compressed_size = compressBound(static_cast<uLong>(size));
+    compressed.resize(compressed_size);
+    if (compress2(compressed.data(), &compressed_size,
+                  reinterpret_cast<Bytef const*>(array.data + begin),
+                  static_cast<uLong>(size), compression_level) != Z_OK)
+    {
+        return false;
+    }
+    compressed.resize(compressed_size);
+    return true;
+}
+
+/// Compresses the blocks of all arrays concurrently and sets the headers and
+/// the offsets of the arrays.
+bool compressBlocks(std::vector<DataArray*> const& arrays)
+{
+    std::vector<std::pair<DataArray*, std::size_t>> blocks;
+    for (auto* const array : arrays)
+    {
+        auto const n_blocks =
+            (array->size_in_bytes + block_size - 1) / block_size;
+        array->compressed_blocks.resize(n_blocks);
+        for (std::size_t block = 0; block < n_blocks; ++block)
+        {
+            blocks.emplace_back(array, block);
+        }
+    }
+
+    int failed = 0;
+    // OpenMP 2.0 (MSVC) supports only signed loop counters.
+    auto const n_blocks = static_cast<std::ptrdiff_t>(blocks.size());
+#pragma omp parallel for schedule(dynamic) reduction(+ : failed)
+    for (std::ptrdiff_t i = 0; i < n_blocks; ++i)
+    {
+        if (!compressBlock(*blocks[i].first, blocks[i].second))
+        {
+            failed++;
+        }
+    }
+    if (failed > 0)
+    {
+        return false;
+    }
+
+    std::size_t offset = 0;
+    for (auto* const array : arrays)
+    {
+        auto& header = array->header;
+        header = {array->compressed_blocks.size(), block_size,
+                  array->size_in_bytes % block_size};
+        for (auto const& compressed : array->compressed_blocks)
+        {
+            header.push_back(compressed.size());
+        }
+        array->offset = offset;
+        offset += header.size() * sizeof(std::uint64_t);
+        for (auto const& compressed : array->compressed_blocks)
+        {
+            offset += compressed.size();
+        }
+    }
+    return true;
+}
+
+void writeDataArrayTag(std::ostream& os, DataArray const& array,
+                       bool const with_number_of_tuples, char const* indent)
+{
+    os << indent << "<DataArray type=\"" << array.type << "\" Name=\""
+       << escapeXml(array.name) << "\"";
+    if (array.number_of_components != 1)
+    {
+        os << " NumberOfComponents=\"" << array.number_of_components << "\"";
+    }
+    if (with_number_of_tuples)
+    {
+        os << " NumberOfTuples=\"" << array.number_of_tuples << "\"";
+    }
+    os << " format=\"appended\" offset=\"" << array.offset << "\"/>\n";
+}
+
+void writeDataArrayTags(std::ostream& os, char const* const tag,
+                        std::vector<DataArray> const& arrays,
+                        bool const with_number_of_tuples, char const* indent)
+{
+    if (arrays.empty())
+    {
+        return;
+    }
+    std::string const array_indent = std::string(indent) + "  ";
+    os << indent << "<" << tag << ">\n";
+    for (auto const& array : arrays)
+    {
+        writeDataArrayTag(os, array, with_number_of_tuples,
+                          array_indent.c_str());
+    }
+    os << indent << "</" << tag << ">\n";
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+bool writeAppendedZLibVtuFile(MeshLib::Mesh const& mesh,
+                              std::string const& file_name)
+{
+    std::vector<double> points;
+    points.reserve(3 * mesh.getNumberOfNodes());
+    for (auto const* node : mesh.getNodes())
+    {
+        points.insert(points.end(), node->getCoords(), node->getCoords() + 3);
+    }
+
+    std::vector<std::int64_t> connectivity;
+    std::vector<std::int64_t> offsets;
+    std::vector<std::uint8_t> types;
+    offsets.reserve(mesh.getNumberOfElements());
+    types.reserve(mesh.getNumberOfElements());
+    for (auto const* element : mesh.getElements())
+    {
+        auto const cell_type = element->getCellType();
+        for (unsigned k = 0; k < element->getNumberOfNodes(); ++k)
+        {
+            connectivity.push_back(static_cast<std::int64_t>(
+                element->getNodeIndex(ogsNodeIndex(cell_type, k))));
+        }
+        offsets.push_back(static_cast<std::int64_t>(connectivity.size()));
+        types.push_back(static_cast<std::uint8_t>(OGSToVtkCellType(cell_type)));
+    }
+
+    DataArrays arrays;
+    addPropertyArrays(mesh.getProperties(), arrays);
+    std::vector<DataArray> point_arrays{
+        makeDataArray("Points", "Float64", 3, points)};
+    std::vector<DataArray> cell_arrays{
+        makeDataArray("connectivity", "Int64", 1, connectivity),
+        makeDataArray("offsets", "Int64", 1, offsets),
+        makeDataArray("types", "UInt8", 1, types)};
+
+    // The order of the arrays in the appended data section.
+    std::vector<DataArray*> all_arrays;
+    for (auto* section : {&arrays.field_data, &arrays.point_data,
+                          &arrays.cell_data, &point_arrays, &cell_arrays})
+    {
+        for (auto& array : *section)
+        {
+            all_arrays.push_back(&array);
+        }
+    }
+    if (!compressBlocks(all_arrays))
+    {
+        ERR("Compressing the data arrays of the mesh '%s' failed.",
+            mesh.getName().c_str());
+        return false;
+    }
+
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        ERR("Could not open the file '%s' for writing.", file_name.c_str());
+        return false;
+    }
+
+    os << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+       << (isLittleEndian() ? "LittleEndian" : "BigEndian")
+       << "\" header_type=\"UInt64\" compressor=\"vtkZLibDataCompressor\">\n"
+       << "  <UnstructuredGrid>\n";
+    writeDataArrayTags(os, "FieldData", arrays.field_data, true, "    ");
+    os << "    <Piece NumberOfPoints=\"" << mesh.getNumberOfNodes()
+       << "\" NumberOfCells=\"" << mesh.getNumberOfElements() << "\">\n";
+    writeDataArrayTags(os, "PointData", arrays.point_data, false, "      ");
+    writeDataArrayTags(os, "CellData", arrays.cell_data, false, "      ");
+    writeDataArrayTags(os, "Points", point_arrays, false, "      ");
+    writeDataArrayTags(os, "Cells", cell_arrays, false, "      ");
+    os << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n"
+       << "  <AppendedData encoding=\"raw\">\n"
+       << "   _";
+    for (auto const* array : all_arrays)
+    {
+        os.write(reinterpret_cast<char const*>(array->header.data()),
+                 array->header.size() * sizeof(std::uint64_t));
+        for (auto const& compressed : array->compressed_blocks)
+        {
+            os.write(reinterpret_cast<char const*>(compressed.data()),
+                     compressed.size());
+        }
+    }
+    os << "\n  </AppendedData>\n"
+       << "</VTKFile>\n";
+
+    if (!os)
+    {
+        ERR("Writing the file '%s' failed.", file_name.c_str());
+        return false;
+    }
+    return true;
+}
+}  // namespace IO
+}  // namespace MeshLib
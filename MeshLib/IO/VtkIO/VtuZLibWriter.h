@@ -0,0 +1,32 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/// Writes the mesh and its properties to a VTU file storing all data arrays
+/// zlib compressed in the raw appended data section.
+///
+/// The file has the same layout as written by VTK's XML writer with the zlib
+/// compressor, i.e. each array is split into blocks of 32 KiB which are
+/// compressed independently. Here the blocks of all arrays are compressed
+/// concurrently.
+/// \return True on success, false on error.
+bool writeAppendedZLibVtuFile(MeshLib::Mesh const& mesh,
+                              std::string const& file_name);
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,633 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "XdmfHdfWriter.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+#include <hdf5.h>
+#include <logog/include/logog.hpp>
+
+#ifdef USE_PETSC
+#include <petsc.h>
+#endif
+
+#include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#ifdef USE_PETSC
+#include "MeshLib/NodePartitionedMesh.h"
+#endif
+
+static_assert(std::is_same<hid_t, std::int64_t>::value,
+              "The HDF5 file id is stored as std::int64_t.");
+
+namespace
+{
+/// HDF5 type and XDMF number type of the property vector value types.
+template <typename T>
+struct HdfType;
+
+template <>
+struct HdfType<double>
+{
+    static hid_t type() { return H5T_NATIVE_DOUBLE; }
+    static constexpr char const* xdmf = "Float";
+};
+template <>
+struct HdfType<float>
+{
+    static hid_t type() { return H5T_NATIVE_FLOAT; }
+    static constexpr char const* xdmf = "Float";
+};
+template <>
+struct HdfType<int>
+{
+    static hid_t type() { return H5T_NATIVE_INT; }
+    static constexpr char const* xdmf = "Int";
+};
+template <>
+struct HdfType<long>
+{
+    static hid_t type() { return H5T_NATIVE_LONG; }
+    static constexpr char const* xdmf = "Int";
+};
+template <>
+struct HdfType<unsigned>
+{
+    static hid_t type() { return H5T_NATIVE_UINT; }
+    static constexpr char const* xdmf = "UInt";
+};
+template <>
+struct HdfType<unsigned long>
+{
+    static hid_t type() { return H5T_NATIVE_ULONG; }
+    static constexpr char const* xdmf = "UInt";
+};
+template <>
+struct HdfType<char>
+{
+    static hid_t type() { return H5T_NATIVE_CHAR; }
+    static constexpr char const* xdmf = "Char";
+};
+template <>
+struct HdfType<unsigned char>
+{
+    static hid_t type() { return H5T_NATIVE_UCHAR; }
+    static constexpr char const* xdmf = "UChar";
+};
+
+/// XDMF topology type of the mixed topology and the node ordering, which
+/// follows VTK, cf. VtkMappedMeshSource.
+std::pair<int, std::vector<std::size_t>> xdmfCell(
+    MeshLib::Element const& element)
+{
+    auto const n = element.getNumberOfNodes();
+    std::vector<std::size_t> ids(n);
+    for (unsigned i = 0; i < n; ++i)
+    {
+        ids[i] = element.getNodeIndex(i);
+    }
+
+    switch (element.getCellType())
+    {
+        case MeshLib::CellType::POINT1:
+            return {1, std::move(ids)};
+        case MeshLib::CellType::LINE2:
+            return {2, std::move(ids)};
+        case MeshLib::CellType::LINE3:
+            return {34, std::move(ids)};
+        case MeshLib::CellType::TRI3:
+            return {4, std::move(ids)};
+        case MeshLib::CellType::TRI6:
+            return {36, std::move(ids)};
+        case MeshLib::CellType::QUAD4:
+            return {5, std::move(ids)};
+        case MeshLib::CellType::QUAD8:
+            return {37, std::move(ids)};
+        case MeshLib::CellType::QUAD9:
+            return {35, std::move(ids)};
+        case MeshLib::CellType::TET4:
+            return {6, std::move(ids)};
+        case MeshLib::CellType::TET10:
+            return {38, std::move(ids)};
+        case MeshLib::CellType::PYRAMID5:
+            return {7, std::move(ids)};
+        case MeshLib::CellType::PYRAMID13:
+            return {39, std::move(ids)};
+        case MeshLib::CellType::HEX8:
+            return {9, std::move(ids)};
+        case MeshLib::CellType::HEX20:
+            return {48, std::move(ids)};
+        case MeshLib::CellType::HEX27:
+            return {50, std::move(ids)};
+        case MeshLib::CellType::PRISM6:
+        {
+            for (unsigned i = 0; i < 3; ++i)
+            {
+                std::swap(ids[i], ids[i + 3]);
+            }
+            return {8, std::move(ids)};
+        }
+        case MeshLib::CellType::PRISM15:
+        {
+            auto const ogs_ids = ids;
+            for (unsigned i = 0; i < 3; ++i)
+            {
+                ids[i] = ogs_ids[i + 3];
+                ids[i + 3] = ogs_ids[i];
+                ids[6 + i] = ogs_ids[8 - i];
+                ids[9 + i] = ogs_ids[14 - i];
+            }
+            ids[12] = ogs_ids[9];
+            ids[13] = ogs_ids[11];
+            ids[14] = ogs_ids[10];
+            return {40, std::move(ids)};
+        }
+        default:
+            OGS_FATAL(
+                "The element type '%s' is not supported by the XDMF output.",
+                MeshLib::CellType2String(element.getCellType()).c_str());
+    }
+}
+
+std::string xdmfAttributeType(int const number_of_components)
+{
+    switch (number_of_components)
+    {
+        case 1:
+            return "Scalar";
+        case 3:
+            return "Vector";
+        case 6:
+            return "Tensor6";
+        case 9:
+            return "Tensor";
+        default:
+            return "Matrix";
+    }
+}
+
+std::string xdmfCenter(MeshLib::MeshItemType const item_type)
+{
+    return item_type == MeshLib::MeshItemType::Node ? "Node" : "Cell";
+}
+
+/// The collective output needs a partitioned mesh and a parallel HDF5
+/// library.
+bool isCollective(MeshLib::Mesh const& mesh)
+{
+#if defined(USE_PETSC) && defined(H5_HAVE_PARALLEL)
+    return dynamic_cast<MeshLib::NodePartitionedMesh const*>(&mesh) !=
+           nullptr;
+#else
+    (void)mesh;
+    return false;
+#endif
+}
+
+std::string fileBaseOfRank(std::string file_base, bool const collective)
+{
+#ifdef USE_PETSC
+    if (!collective)
+    {
+        int rank;
+        MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+        file_base += "_" + std::to_string(rank);
+    }
+#else
+    (void)collective;
+#endif
+    return file_base;
+}
+
+void checkHdf(herr_t const status, std::string const& what)
+{
+    if (status < 0)
+    {
+        OGS_FATAL("HDF5 error: %s.", what.c_str());
+    }
+}
+
+#ifdef USE_PETSC
+/// Returns the sum of the local values of the ranks before this rank and the
+/// sum of the values of all ranks.
+std::pair<std::size_t, std::size_t> offsetAndSum(std::size_t const local)
+{
+    unsigned long value = local;
+    unsigned long offset = 0;
+    unsigned long sum = 0;
+    MPI_Exscan(&value, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM,
+               PETSC_COMM_WORLD);
+    MPI_Allreduce(&value, &sum, 1, MPI_UNSIGNED_LONG, MPI_SUM,
+                  PETSC_COMM_WORLD);
+    int rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    // The result of MPI_Exscan is undefined on the first rank.
+    return {rank == 0 ? 0 : offset, sum};
+}
+#endif
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+std::size_t XdmfHdfWriter::Rows::numberOfLocalRows() const
+{
+    std::size_t n = 0;
+    for (auto const& run : runs)
+    {
+        n += run.second;
+    }
+    return n;
+}
+
+XdmfHdfWriter::XdmfHdfWriter(MeshLib::Mesh const& mesh, std::string file_base,
+                             bool const compression)
+    : _mesh(mesh),
+      _collective(isCollective(mesh)),
+      _file_base(fileBaseOfRank(std::move(file_base), _collective)),
+      // Filters need collective chunk writes, which are not supported by all
+      // parallel HDF5 versions.
+      _compression(!_collective && compression &&
+                   H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0)
+{
+    selectNodesAndElements();
+
+    auto const hdf_path = _file_base + ".h5";
+    hid_t const file_access = H5Pcreate(H5P_FILE_ACCESS);
+#if defined(USE_PETSC) && defined(H5_HAVE_PARALLEL)
+    if (_collective)
+    {
+        int rank;
+        MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+        _writes_xdmf = rank == 0;
+        checkHdf(H5Pset_fapl_mpio(file_access, PETSC_COMM_WORLD, MPI_INFO_NULL),
+                 "setting the MPI-IO file driver");
+    }
+#endif
+    _hdf_file =
+        H5Fcreate(hdf_path.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, file_access);
+    H5Pclose(file_access);
+    if (_hdf_file < 0)
+    {
+        OGS_FATAL("Could not create the HDF5 file '%s'.", hdf_path.c_str());
+    }
+
+    if (_writes_xdmf)
+    {
+        auto const xdmf_path = _file_base + ".xdmf";
+        _xdmf_file.open(xdmf_path, std::ios::out | std::ios::trunc);
+        if (!_xdmf_file)
+        {
+            OGS_FATAL("Could not create the XDMF file '%s'.",
+                      xdmf_path.c_str());
+        }
+        _xdmf_file << "<?xml version=\"1.0\" ?>\n"
+                      "<Xdmf Version=\"3.0\">\n"
+                      "  <Domain>\n"
+                      "    <Grid Name=\""
+                   << _mesh.getName()
+                   << "\" GridType=\"Collection\" "
+                      "CollectionType=\"Temporal\">\n";
+        _xdmf_end = _xdmf_file.tellp();
+        writeXdmfClosingTags();
+    }
+
+    writeGeometryAndTopology();
+}
+
+XdmfHdfWriter::~XdmfHdfWriter()
+{
+    if (_hdf_file >= 0)
+    {
+        H5Fclose(_hdf_file);
+    }
+}
+
+void XdmfHdfWriter::selectNodesAndElements()
+{
+    auto const number_of_nodes = _mesh.getNumberOfNodes();
+    auto const number_of_elements = _mesh.getNumberOfElements();
+
+    if (!_collective)
+    {
+        _node_ids.resize(number_of_nodes);
+        std::iota(_node_ids.begin(), _node_ids.end(), 0);
+        _element_ids.resize(number_of_elements);
+        std::iota(_element_ids.begin(), _element_ids.end(), 0);
+        _node_rows = {{{0, number_of_nodes}}, number_of_nodes};
+        _element_rows = {{{0, number_of_elements}}, number_of_elements};
+        return;
+    }
+
+#ifdef USE_PETSC
+    auto const& mesh = static_cast<MeshLib::NodePartitionedMesh const&>(_mesh);
+
+    // Each node is active in exactly one partition.
+    std::vector<std::pair<std::size_t, std::size_t>> global_and_local_ids;
+    for (std::size_t i = 0; i < number_of_nodes; ++i)
+    {
+        if (!mesh.isGhostNode(i))
+        {
+            global_and_local_ids.emplace_back(mesh.getGlobalNodeID(i), i);
+        }
+    }
+    std::sort(global_and_local_ids.begin(), global_and_local_ids.end());
+    _node_rows = {{}, mesh.getNumberOfGlobalNodes()};
+    for (auto const& ids : global_and_local_ids)
+    {
+        _node_ids.push_back(ids.second);
+        auto& runs = _node_rows.runs;
+        if (!runs.empty() &&
+            runs.back().first + runs.back().second == ids.first)
+        {
+            ++runs.back().second;
+        }
+        else
+        {
+            runs.emplace_back(ids.first, 1);
+        }
+    }
+
+    // Regular and ghost elements are owned by the partition of their node
+    // with the smallest global id, which contains the element.
+    for (std::size_t e = 0; e < number_of_elements; ++e)
+    {
+        auto const& element = *_mesh.getElement(e);
+        std::size_t min_node = element.getNodeIndex(0);
+        for (unsigned i = 1; i < element.getNumberOfNodes(); ++i)
+        {
+            auto const node = element.getNodeIndex(i);
+            if (mesh.getGlobalNodeID(node) < mesh.getGlobalNodeID(min_node))
+            {
+                min_node = node;
+            }
+        }
+        if (!mesh.isGhostNode(min_node))
+        {
+            _element_ids.push_back(e);
+        }
+    }
+    auto const offset_and_sum = offsetAndSum(_element_ids.size());
+    _element_rows = {{{offset_and_sum.first, _element_ids.size()}},
+                     offset_and_sum.second};
+#endif
+}
+
+template <typename T>
+std::string XdmfHdfWriter::writeDataset(std::string const& path,
+                                        T const* data, Rows const& rows,
+                                        int const number_of_components)
+{
+    auto const number_of_local_rows = rows.numberOfLocalRows();
+    std::array<hsize_t, 2> const dims = {
+        static_cast<hsize_t>(rows.global_number_of_rows),
+        static_cast<hsize_t>(number_of_components)};
+    hid_t const file_space = H5Screate_simple(2, dims.data(), nullptr);
+    H5Sselect_none(file_space);
+    for (auto const& run : rows.runs)
+    {
+        std::array<hsize_t, 2> const start = {
+            static_cast<hsize_t>(run.first), 0};
+        std::array<hsize_t, 2> const count = {
+            static_cast<hsize_t>(run.second), dims[1]};
+        checkHdf(H5Sselect_hyperslab(file_space, H5S_SELECT_OR, start.data(),
+                                     nullptr, count.data(), nullptr),
+                 "selecting the rows of the dataset '" + path + "'");
+    }
+    // An empty selection still needs a valid memory space and buffer.
+    std::array<hsize_t, 2> const local_dims = {
+        std::max<hsize_t>(number_of_local_rows, 1), dims[1]};
+    hid_t const memory_space = H5Screate_simple(2, local_dims.data(), nullptr);
+    T const dummy{};
+    if (number_of_local_rows == 0)
+    {
+        H5Sselect_none(memory_space);
+        data = &dummy;
+    }
+
+    hid_t const link_properties = H5Pcreate(H5P_LINK_CREATE);
+    H5Pset_create_intermediate_group(link_properties, 1);
+    hid_t const dataset_properties = H5Pcreate(H5P_DATASET_CREATE);
+    if (_compression && dims[0] > 0)
+    {
+        H5Pset_chunk(dataset_properties, 2, dims.data());
+        H5Pset_deflate(dataset_properties, 1);
+    }
+    hid_t const transfer_properties = H5Pcreate(H5P_DATASET_XFER);
+#if defined(USE_PETSC) && defined(H5_HAVE_PARALLEL)
+    if (_collective)
+    {
+        H5Pset_dxpl_mpio(transfer_properties, H5FD_MPIO_COLLECTIVE);
+    }
+#endif
+
+    hid_t const dataset =
+        H5Dcreate2(_hdf_file, path.c_str(), HdfType<T>::type(), file_space,
+                   link_properties, dataset_properties, H5P_DEFAULT);
+    if (dataset < 0)
+    {
+        OGS_FATAL("Could not create the HDF5 dataset '%s'.", path.c_str());
+    }
+    checkHdf(H5Dwrite(dataset, HdfType<T>::type(), memory_space, file_space,
+                      transfer_properties, data),
+             "writing the dataset '" + path + "'");
+
+    H5Dclose(dataset);
+    H5Pclose(transfer_properties);
+    H5Pclose(dataset_properties);
+    H5Pclose(link_properties);
+    H5Sclose(memory_space);
+    H5Sclose(file_space);
+
+    std::ostringstream item;
+    item << "<DataItem Dimensions=\"" << dims[0] << " " << dims[1]
+         << "\" Format=\"HDF\" NumberType=\"" << HdfType<T>::xdmf
+         << "\" Precision=\"" << sizeof(T) << "\">"
+         << BaseLib::extractBaseName(_file_base) << ".h5:" << path
+         << "</DataItem>";
+    return item.str();
+}
+
+template <typename T>
+std::string XdmfHdfWriter::writeProperty(
+    std::string const& path, MeshLib::PropertyVector<T> const& property)
+{
+    auto const number_of_components = property.getNumberOfComponents();
+    bool const is_node_property =
+        property.getMeshItemType() == MeshLib::MeshItemType::Node;
+    auto const& rows = is_node_property ? _node_rows : _element_rows;
+    if (!_collective)
+    {
+        return writeDataset(path, property.data(), rows, number_of_components);
+    }
+
+    auto const& ids = is_node_property ? _node_ids : _element_ids;
+    std::vector<T> values;
+    values.reserve(ids.size() * number_of_components);
+    for (auto const id : ids)
+    {
+        auto const* const tuple = property.data() + id * number_of_components;
+        values.insert(values.end(), tuple, tuple + number_of_components);
+    }
+    return writeDataset(path, values.data(), rows, number_of_components);
+}
+
+void XdmfHdfWriter::writeGeometryAndTopology()
+{
+    std::vector<double> coordinates;
+    coordinates.reserve(3 * _node_ids.size());
+    for (auto const id : _node_ids)
+    {
+        auto const* const node = _mesh.getNode(id);
+        coordinates.insert(coordinates.end(), node->getCoords(),
+                           node->getCoords() + 3);
+    }
+    _geometry_item =
+        writeDataset("/geometry", coordinates.data(), _node_rows, 3);
+
+    auto const global_node_id = [this](std::size_t const id) {
+#ifdef USE_PETSC
+        if (_collective)
+        {
+            return static_cast<MeshLib::NodePartitionedMesh const&>(_mesh)
+                .getGlobalNodeID(id);
+        }
+#endif
+        return id;
+    };
+
+    // Mixed topology: the XDMF cell type, for polyvertices and polylines the
+    // number of nodes, and the node ids of each element.
+    std::vector<unsigned long> topology;
+    for (auto const id : _element_ids)
+    {
+        auto const cell = xdmfCell(*_mesh.getElement(id));
+        topology.push_back(cell.first);
+        if (cell.first == 1 || cell.first == 2)
+        {
+            topology.push_back(cell.second.size());
+        }
+        for (auto const node_id : cell.second)
+        {
+            topology.push_back(global_node_id(node_id));
+        }
+    }
+    Rows topology_rows = {{{0, topology.size()}}, topology.size()};
+#ifdef USE_PETSC
+    if (_collective)
+    {
+        auto const offset_and_sum = offsetAndSum(topology.size());
+        topology_rows = {{{offset_and_sum.first, topology.size()}},
+                         offset_and_sum.second};
+    }
+#endif
+    _topology_item =
+        writeDataset("/topology", topology.data(), topology_rows, 1);
+
+    checkHdf(H5Fflush(_hdf_file, H5F_SCOPE_LOCAL), "flushing the file");
+}
+
+void XdmfHdfWriter::writeStep(double const t)
+{
+    auto const group = "/t_" + std::to_string(_number_of_steps);
+
+    std::ostringstream grid;
+    grid.precision(std::numeric_limits<double>::digits10 + 1);
+    grid << "      <Grid Name=\"" << _mesh.getName() << "_"
+         << _number_of_steps << "\" GridType=\"Uniform\">\n"
+         << "        <Time Value=\"" << t << "\"/>\n"
+         << "        <Geometry GeometryType=\"XYZ\">" << _geometry_item
+         << "</Geometry>\n"
+         << "        <Topology TopologyType=\"Mixed\" NumberOfElements=\""
+         << _element_rows.global_number_of_rows << "\">" << _topology_item
+         << "</Topology>\n";
+
+    // The collective output creates the datasets on all ranks in the same
+    // order.
+    auto const& properties = _mesh.getProperties();
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        auto const write = [&](auto* const type_tag) {
+            using T = std::remove_pointer_t<decltype(type_tag)>;
+            if (!properties.existsPropertyVector<T>(name))
+            {
+                return false;
+            }
+            auto const& p = *properties.getPropertyVector<T>(name);
+            auto const item_type = p.getMeshItemType();
+            if (item_type != MeshLib::MeshItemType::Node &&
+                item_type != MeshLib::MeshItemType::Cell)
+            {
+                DBUG("Skipping the property '%s' in the XDMF output.",
+                     name.c_str());
+                return true;
+            }
+            grid << "        <Attribute Name=\"" << name
+                 << "\" AttributeType=\""
+                 << xdmfAttributeType(p.getNumberOfComponents())
+                 << "\" Center=\"" << xdmfCenter(item_type) << "\">"
+                 << writeProperty(group + "/" + name, p) << "</Attribute>\n";
+            return true;
+        };
+
+        if (!(write(static_cast<double*>(nullptr)) ||
+              write(static_cast<float*>(nullptr)) ||
+              write(static_cast<int*>(nullptr)) ||
+              write(static_cast<long*>(nullptr)) ||
+              write(static_cast<unsigned*>(nullptr)) ||
+              write(static_cast<unsigned long*>(nullptr)) ||
+              write(static_cast<char*>(nullptr)) ||
+              write(static_cast<unsigned char*>(nullptr))))
+        {
+            DBUG(
+                "Skipping the property '%s' of unsupported type in the XDMF "
+                "output.",
+                name.c_str());
+        }
+    }
+    grid << "      </Grid>\n";
+    checkHdf(H5Fflush(_hdf_file, H5F_SCOPE_LOCAL), "flushing the file");
+
+    if (_writes_xdmf)
+    {
+        // Overwrite the closing tags of the previous step.
+        _xdmf_file.seekp(_xdmf_end);
+        _xdmf_file << grid.str();
+        _xdmf_end = _xdmf_file.tellp();
+        writeXdmfClosingTags();
+    }
+
+    ++_number_of_steps;
+}
+void XdmfHdfWriter::writeXdmfClosingTags()
+{
+    _xdmf_file << "    </Grid>\n"
+                  "  </Domain>\n"
+                  "</Xdmf>\n";
+    _xdmf_file.flush();
+    if (!_xdmf_file)
+    {
+        OGS_FATAL("Could not write the XDMF file '%s.xdmf'.",
+                  _file_base.c_str());
+    }
+}
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,123 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+template <typename T>
+class PropertyVector;
+
+namespace IO
+{
+/// Writes the time series of the node and cell data of a mesh to a single
+/// HDF5 file, which is described by an XDMF3 file for visualization, e.g., in
+/// ParaView.
+///
+/// The geometry and the topology of the mesh are written once on
+/// construction. Each call of writeStep() appends the current property
+/// vectors of the mesh as datasets of a new group of the HDF5 file and a grid
+/// referencing them to the XDMF file. Both files are flushed after each step.
+///
+/// With PETSc and a parallel HDF5 library the ranks write a partitioned mesh
+/// collectively to a single shared file: every node is written by the rank
+/// owning it at the row of its global id, every element by the rank owning
+/// the node of its element with the smallest global id, and the element rows
+/// of the ranks follow each other in order of the ranks. Without parallel
+/// HDF5 each rank writes the own partition to files whose names are suffixed
+/// with the rank.
+class XdmfHdfWriter final
+{
+public:
+    /// Creates the files \c file_base.h5 and \c file_base.xdmf and writes the
+    /// geometry and topology of the \c mesh. The mesh must not change its
+    /// nodes or elements during the lifetime of the writer.
+    ///
+    /// \param compression Enables deflate compression of the datasets if the
+    /// HDF5 library provides it. It is not used for the collective output.
+    XdmfHdfWriter(MeshLib::Mesh const& mesh, std::string file_base,
+                  bool const compression);
+
+    XdmfHdfWriter(XdmfHdfWriter const&) = delete;
+    XdmfHdfWriter& operator=(XdmfHdfWriter const&) = delete;
+
+    ~XdmfHdfWriter();
+
+    /// Writes the node and cell property vectors of the mesh for time \c t.
+    void writeStep(double const t);
+
+private:
+    /// Rows of a global dataset written by this process as runs of
+    /// consecutive rows given by the first row and the length of the run.
+    struct Rows
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> runs;
+        std::size_t global_number_of_rows;
+
+        std::size_t numberOfLocalRows() const;
+    };
+
+    /// Determines the nodes and elements written by this process.
+    void selectNodesAndElements();
+
+    void writeGeometryAndTopology();
+
+    /// Writes the closing tags at the current position of the XDMF file,
+    /// which keeps the file valid between the steps.
+    void writeXdmfClosingTags();
+
+    /// Writes the local \c rows of a dataset with \c number_of_components
+    /// columns and returns its XDMF data item. The \c data contains the local
+    /// rows in the order of the runs.
+    template <typename T>
+    std::string writeDataset(std::string const& path, T const* data,
+                             Rows const& rows,
+                             int const number_of_components);
+
+    /// Writes a property vector holding the values of all local nodes or
+    /// elements.
+    template <typename T>
+    std::string writeProperty(std::string const& path,
+                              MeshLib::PropertyVector<T> const& property);
+
+    MeshLib::Mesh const& _mesh;
+    /// All ranks write to the same files.
+    bool const _collective;
+    std::string const _file_base;
+    bool const _compression;
+    /// Only the first rank writes the XDMF file in the collective output.
+    bool _writes_xdmf = true;
+
+    /// Local ids of the written nodes and elements in the order of their rows.
+    std::vector<std::size_t> _node_ids;
+    std::vector<std::size_t> _element_ids;
+    Rows _node_rows;
+    Rows _element_rows;
+
+    std::int64_t _hdf_file = -1;
+    std::fstream _xdmf_file;
+    /// Position of the closing tags of the XDMF file, which are overwritten by
+    /// the next step.
+    std::fstream::pos_type _xdmf_end;
+
+    std::string _geometry_item;
+    std::string _topology_item;
+    std::size_t _number_of_steps = 0;
+};
+}  // namespace IO
+}  // namespace MeshLib
@@ -27,6 +27,7 @@
 #include "Elements/Hex.h"
 #include "Elements/Pyramid.h"
 #include "Elements/Prism.h"
+#include "NodeAdjacencyTable.h"
 
 namespace MeshLib
 {
@@ -37,7 +38,7 @@ Mesh::Mesh(std::string name,
                elements,
            Properties const& properties,
            const std::size_t n_base_nodes)
-    : _id(_counter_value - 1),
+    : _id(_counter_id),
       _mesh_dimension(0),
       _edge_length(std::numeric_limits<double>::max(), 0),
       _node_distance(std::numeric_limits<double>::max(), 0),
@@ -60,15 +61,11 @@ Mesh::Mesh(std::string name,
     }
     this->setDimension();
     this->setElementsConnectedToNodes();
-    this->setNodesConnectedByElements();
-    this->setElementNeighbors();
-
-    this->calcEdgeLengthRange();
 }
 
 Mesh::Mesh(const Mesh &mesh)
-    : _id(_counter_value-1), _mesh_dimension(mesh.getDimension()),
-      _edge_length(mesh._edge_length.first, mesh._edge_length.second),
+    : _id(_counter_id), _mesh_dimension(mesh.getDimension()),
+      _edge_length(std::numeric_limits<double>::max(), 0),
       _node_distance(mesh._node_distance.first, mesh._node_distance.second),
       _name(mesh.getName()), _nodes(mesh.getNumberOfNodes()), _elements(mesh.getNumberOfElements()),
       _n_base_nodes(mesh.getNumberOfBaseNodes()),
@@ -98,8 +95,6 @@ Mesh::Mesh(const Mesh &mesh)
         this->setDimension();
     }
     this->setElementsConnectedToNodes();
-    //this->setNodesConnectedByElements();
-    this->setElementNeighbors();
 }
 
 Mesh::~Mesh()
@@ -184,7 +179,39 @@ void Mesh::setElementsConnectedToNodes()
     }
 }
 
-void Mesh::calcEdgeLengthRange()
+double Mesh::getMinEdgeLength() const
+{
+    std::call_once(_edge_length_computed, [this] { calcEdgeLengthRange(); });
+    return _edge_length.first;
+}
+
+double Mesh::getMaxEdgeLength() const
+{
+    std::call_once(_edge_length_computed, [this] { calcEdgeLengthRange(); });
+    return _edge_length.second;
+}
+
+void Mesh::computeElementNeighbors() const
+{
+    std::call_once(_element_neighbors_computed,
+                   [this] { setElementNeighbors(); });
+}
+
+void Mesh::computeNodesConnectedByElements() const
+{
+    std::call_once(_connected_nodes_computed,
+                   [this] { setNodesConnectedByElements(); });
+}
+
+NodeAdjacencyTable const& Mesh::getNodeAdjacencyTable() const
+{
+    std::call_once(_node_adjacency_table_computed, [this] {
+        _node_adjacency_table = std::make_unique<NodeAdjacencyTable>(*this);
+    });
+    return *_node_adjacency_table;
+}
+
+void Mesh::calcEdgeLengthRange() const
 {
     this->_edge_length.first  = std::numeric_limits<double>::max();
     this->_edge_length.second = 0;
@@ -201,7 +228,7 @@ void Mesh::calcEdgeLengthRange()
     this->_edge_length.second = sqrt(this->_edge_length.second);
 }
 
-void Mesh::setElementNeighbors()
+void Mesh::setElementNeighbors() const
 {
     std::vector<Element*> neighbors;
     for (auto element : _elements)
@@ -228,7 +255,7 @@ void Mesh::setElementNeighbors()
     }
 }
 
-void Mesh::setNodesConnectedByElements()
+void Mesh::setNodesConnectedByElements() const
 {
     // Allocate temporary space for adjacent nodes.
     std::vector<Node*> adjacent_nodes;
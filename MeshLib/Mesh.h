@@ -16,6 +16,7 @@
 
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -34,6 +35,7 @@ namespace MeshLib
 {
     class Node;
     class Element;
+    class NodeAdjacencyTable;
 
 /**
  * A basic mesh.
@@ -84,10 +86,28 @@ public:
     const Element* getElement(std::size_t idx) const { return _elements[idx]; }
 
     /// Get the minimum edge length over all elements of the mesh.
-    double getMinEdgeLength() const { return _edge_length.first; }
+    /// The edge lengths are computed on the first call.
+    double getMinEdgeLength() const;
 
     /// Get the maximum edge length over all elements of the mesh.
-    double getMaxEdgeLength() const { return _edge_length.second; }
+    /// The edge lengths are computed on the first call.
+    double getMaxEdgeLength() const;
+
+    /// Fills in the neighbor-information for elements unless this has been
+    /// done before. Has to be called before Element::getNeighbor() or
+    /// Element::isBoundaryElement() are used on the mesh's elements.
+    /// Thread-safe.
+    void computeElementNeighbors() const;
+
+    /// Computes the element-connectivity of nodes unless this has been done
+    /// before. Has to be called before Node::getConnectedNodes() is used on
+    /// the mesh's nodes. Thread-safe.
+    void computeNodesConnectedByElements() const;
+
+    /// The topological adjacency of the mesh's nodes in compressed rows,
+    /// which is computed on the first call and shared by all users of the
+    /// mesh graph. Thread-safe.
+    NodeAdjacencyTable const& getNodeAdjacencyTable() const;
 
     /// Get the number of elements
     std::size_t getNumberOfElements() const { return _elements.size(); }
@@ -138,7 +158,7 @@ public:
 
 protected:
     /// Set the minimum and maximum length over the edges of the mesh.
-    void calcEdgeLengthRange();
+    void calcEdgeLengthRange() const;
 
     /// Sets the dimension of the mesh.
     void setDimension();
@@ -148,11 +168,11 @@ protected:
 
     /// Fills in the neighbor-information for elements.
     /// Note: Using this implementation, an element e can only have neighbors that have the same dimensionality as e.
-    void setElementNeighbors();
+    void setElementNeighbors() const;
 
     /// Computes the element-connectivity of nodes. Two nodes i and j are
     /// connected if they are shared by an element.
-    void setNodesConnectedByElements();
+    void setNodesConnectedByElements() const;
 
     /// Check if all the nonlinear nodes are stored at the end of the node vector
     void checkNonlinearNodeIDs() const;
@@ -163,7 +183,7 @@ protected:
     std::size_t const _id;
     unsigned _mesh_dimension;
     /// The minimal and maximal edge length over all elements in the mesh
-    std::pair<double, double> _edge_length;
+    mutable std::pair<double, double> _edge_length;
     /// The minimal and maximal distance of nodes within an element over all elements in the mesh
     std::pair<double, double> _node_distance;
     std::string _name;
@@ -173,6 +193,15 @@ protected:
     Properties _properties;
 
     bool _is_axially_symmetric = false;
+
+    /// The adjacency information and the edge lengths are not needed for
+    /// many meshes, e.g. most boundary meshes, and are computed once on
+    /// demand.
+    mutable std::once_flag _edge_length_computed;
+    mutable std::once_flag _element_neighbors_computed;
+    mutable std::once_flag _connected_nodes_computed;
+    mutable std::once_flag _node_adjacency_table_computed;
+    mutable std::unique_ptr<NodeAdjacencyTable> _node_adjacency_table;
 }; /* class */
 
 
@@ -12,8 +12,9 @@
  *
  */
 
-#include <vector>
+#include <algorithm>
 #include <fstream>
+#include <vector>
 
 #include "Mesh2MeshPropertyInterpolation.h"
 
@@ -31,7 +32,13 @@ namespace MeshLib {
 
 Mesh2MeshPropertyInterpolation::Mesh2MeshPropertyInterpolation(
     Mesh const& src_mesh, std::string const& property_name)
-    : _src_mesh(src_mesh), _property_name(property_name)
+    : Mesh2MeshPropertyInterpolation(src_mesh,
+                                     std::vector<std::string>{property_name})
+{}
+
+Mesh2MeshPropertyInterpolation::Mesh2MeshPropertyInterpolation(
+    Mesh const& src_mesh, std::vector<std::string> property_names)
+    : _src_mesh(src_mesh), _property_names(std::move(property_names))
 {}
 
 bool Mesh2MeshPropertyInterpolation::setPropertiesForMesh(Mesh& dest_mesh) const
@@ -51,46 +58,59 @@ bool Mesh2MeshPropertyInterpolation::setPropertiesForMesh(Mesh& dest_mesh) const
         return false;
     }
 
-    MeshLib::PropertyVector<double>* dest_properties;
-    if (dest_mesh.getProperties().existsPropertyVector<double>(_property_name))
-    {
-        dest_properties =
-            dest_mesh.getProperties().getPropertyVector<double>(_property_name);
-    }
-    else
+    std::vector<MeshLib::PropertyVector<double>*> dest_properties;
+    for (auto const& property_name : _property_names)
     {
-        INFO("Create new PropertyVector '%s' of type double.",
-             _property_name.c_str());
-        dest_properties =
-            dest_mesh.getProperties().createNewPropertyVector<double>(
-                _property_name, MeshItemType::Cell, 1);
-        if (!dest_properties)
+        MeshLib::PropertyVector<double>* dest_property;
+        if (dest_mesh.getProperties().existsPropertyVector<double>(
+                property_name))
+        {
+            dest_property = dest_mesh.getProperties().getPropertyVector<double>(
+                property_name);
+        }
+        else
         {
-            WARN(
-                "Could not get or create a PropertyVector of type double"
-                " using the given name '%s'.",
-                _property_name.c_str());
-            return false;
+            INFO("Create new PropertyVector '%s' of type double.",
+                 property_name.c_str());
+            dest_property =
+                dest_mesh.getProperties().createNewPropertyVector<double>(
+                    property_name, MeshItemType::Cell, 1);
+            if (!dest_property)
+            {
+                WARN(
+                    "Could not get or create a PropertyVector of type double"
+                    " using the given name '%s'.",
+                    property_name.c_str());
+                return false;
+            }
         }
+        if (dest_property->size() != dest_mesh.getNumberOfElements())
+        {
+            dest_property->resize(dest_mesh.getNumberOfElements());
+        }
+        dest_properties.push_back(dest_property);
     }
-    if (dest_properties->size() != dest_mesh.getNumberOfElements())
+
+    std::vector<std::vector<double>> src_node_properties(
+        _property_names.size(),
+        std::vector<double>(_src_mesh.getNumberOfNodes()));
+    for (std::size_t i = 0; i < _property_names.size(); ++i)
     {
-        dest_properties->resize(dest_mesh.getNumberOfElements());
+        interpolateElementPropertiesToNodeProperties(_property_names[i],
+                                                     src_node_properties[i]);
     }
 
-    interpolatePropertiesForMesh(dest_mesh, *dest_properties);
+    interpolatePropertiesForMesh(dest_mesh, dest_properties,
+                                 src_node_properties);
 
     return true;
 }
 
 void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
-    Mesh& dest_mesh, MeshLib::PropertyVector<double>& dest_properties) const
+    Mesh const& dest_mesh,
+    std::vector<MeshLib::PropertyVector<double>*> const& dest_properties,
+    std::vector<std::vector<double>> const& src_node_properties) const
 {
-    std::vector<double> interpolated_src_node_properties(
-        _src_mesh.getNumberOfNodes());
-    interpolateElementPropertiesToNodeProperties(
-        interpolated_src_node_properties);
-
     // idea: looping over the destination elements and calculate properties
     // from interpolated_src_node_properties to accelerate the (source) point
     // search construct a grid
@@ -99,10 +119,18 @@ void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
                                          64);
 
     auto const& dest_elements(dest_mesh.getElements());
-    const std::size_t n_dest_elements(dest_elements.size());
-    for (std::size_t k(0); k < n_dest_elements; k++)
+    auto const n_dest_elements =
+        static_cast<std::ptrdiff_t>(dest_elements.size());
+    std::size_t const n_properties = dest_properties.size();
+
+    // OGS_FATAL must not be called within the parallel region. The element
+    // with the smallest id without source values is reported afterwards.
+    auto failed_element = n_dest_elements;
+
+#pragma omp parallel for schedule(dynamic, 64)
+    for (std::ptrdiff_t k = 0; k < n_dest_elements; k++)
     {
-        MeshLib::Element& dest_element(*dest_elements[k]);
+        MeshLib::Element const& dest_element(*dest_elements[k]);
         if (dest_element.getGeomType() == MeshElemType::LINE)
         {
             continue;
@@ -119,7 +147,7 @@ void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
             elem_aabb.getMinPoint(), elem_aabb.getMaxPoint(), nodes);
 
         std::size_t cnt(0);
-        double average_value(0.0);
+        std::vector<double> average_values(n_properties, 0.0);
 
         for (auto const* nodes_vec : nodes)
         {
@@ -128,8 +156,11 @@ void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
                 if (elem_aabb.containsPointXY(*node) &&
                     MeshLib::isPointInElementXY(*node, dest_element))
                 {
-                    average_value +=
-                        interpolated_src_node_properties[node->getID()];
+                    for (std::size_t i = 0; i < n_properties; ++i)
+                    {
+                        average_values[i] +=
+                            src_node_properties[i][node->getID()];
+                    }
                     cnt++;
                 }
             }
@@ -137,31 +168,43 @@ void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
 
         if (cnt == 0)
         {
-            OGS_FATAL(
-                "Mesh2MeshInterpolation: Could not find values in source mesh "
-                "for the element %d.",
-                k);
+#pragma omp critical(ogs_mesh2mesh_property_interpolation)
+            failed_element = std::min(failed_element, k);
+            continue;
         }
-        dest_properties[k] = average_value / cnt;
+        for (std::size_t i = 0; i < n_properties; ++i)
+        {
+            (*dest_properties[i])[k] = average_values[i] / cnt;
+        }
+    }
+
+    if (failed_element < n_dest_elements)
+    {
+        OGS_FATAL(
+            "Mesh2MeshInterpolation: Could not find values in source mesh "
+            "for the element %d.",
+            failed_element);
     }
 }
 
 void Mesh2MeshPropertyInterpolation::interpolateElementPropertiesToNodeProperties(
+    std::string const& property_name,
     std::vector<double> &interpolated_properties) const
 {
     // fetch the source of property values
-    if (!_src_mesh.getProperties().existsPropertyVector<double>(_property_name))
+    if (!_src_mesh.getProperties().existsPropertyVector<double>(property_name))
     {
         WARN("Did not find PropertyVector<double> '%s'.",
-             _property_name.c_str());
+             property_name.c_str());
         return;
     }
     auto const* elem_props =
-        _src_mesh.getProperties().getPropertyVector<double>(_property_name);
+        _src_mesh.getProperties().getPropertyVector<double>(property_name);
 
     std::vector<MeshLib::Node*> const& src_nodes(_src_mesh.getNodes());
-    const std::size_t n_src_nodes(src_nodes.size());
-    for (std::size_t k(0); k < n_src_nodes; k++)
+    auto const n_src_nodes = static_cast<std::ptrdiff_t>(src_nodes.size());
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < n_src_nodes; k++)
     {
         const std::size_t n_con_elems(src_nodes[k]->getNumberOfElements());
         interpolated_properties[k] =
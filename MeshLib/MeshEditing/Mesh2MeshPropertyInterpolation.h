@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "MeshLib/PropertyVector.h"
 
 namespace MeshLib {
@@ -39,7 +42,17 @@ public:
                                    std::string const& property_name);
 
     /**
-     * Calculates entries for the property vector and sets appropriate indices
+     * Constructor taking the source or input mesh and several properties,
+     * which are all interpolated in one pass over the destination mesh.
+     * @param src_mesh the mesh the given property information is assigned to.
+     * @param property_names are the names of PropertyVectors in the \c
+     * source_mesh
+     */
+    Mesh2MeshPropertyInterpolation(Mesh const& src_mesh,
+                                   std::vector<std::string> property_names);
+
+    /**
+     * Calculates entries for the property vectors and sets appropriate indices
      * in the mesh elements.
      * @param mesh the mesh the property information will be calculated and set
      * via weighted interpolation
@@ -49,25 +62,32 @@ public:
 
 private:
     /**
+     * The destination elements are processed in parallel. The source nodes
+     * within a destination element are searched once for all properties.
      * @param dest_mesh
-     * @param dest_properties
+     * @param dest_properties one entry for each of the property names
+     * @param src_node_properties the source properties interpolated to the
+     * source nodes, one entry for each of the property names
      */
     void interpolatePropertiesForMesh(
-        Mesh& dest_mesh,
-        MeshLib::PropertyVector<double>& dest_properties) const;
+        Mesh const& dest_mesh,
+        std::vector<MeshLib::PropertyVector<double>*> const& dest_properties,
+        std::vector<std::vector<double>> const& src_node_properties) const;
 
     /**
      * Method interpolates the element wise given properties to the nodes of the
      * element
+     * @param property_name the name of the source element property
      * @param interpolated_properties the vector must have the same number of
      * entries as the source mesh has number of nodes, the content of the
      * particular entries will be overwritten
      */
     void interpolateElementPropertiesToNodeProperties(
+        std::string const& property_name,
         std::vector<double>& interpolated_properties) const;
 
     Mesh const& _src_mesh;
-    std::string const& _property_name;
+    std::vector<std::string> const _property_names;
 };
 
 } // end namespace MeshLib
@@ -14,6 +14,7 @@
 
 #include "MeshRevision.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include <logog/include/logog.hpp>
@@ -74,51 +75,72 @@ MeshLib::Mesh* MeshRevision::simplifyMesh(const std::string &new_mesh_name,
             "MaterialIDs", MeshItemType::Cell, 1);
     }
 
-    for (std::size_t k(0); k<elements.size(); ++k) {
-        MeshLib::Element const*const elem(elements[k]);
-        unsigned n_unique_nodes(this->getNumberOfUniqueNodes(elem));
-        if (n_unique_nodes == elem->getNumberOfBaseNodes()
-            && elem->getDimension() >= min_elem_dim)
+    // Blocks of elements are revised in parallel into separate vectors, which
+    // are concatenated in the original element order afterwards.
+    std::size_t const n_elements(elements.size());
+    std::size_t const block_size(65536);
+    std::vector<std::vector<MeshLib::Element*>> revised_elements(
+        std::min(block_size, n_elements));
+    for (std::size_t block_begin = 0; block_begin < n_elements;
+         block_begin += block_size)
+    {
+        auto const n_block_elements = static_cast<std::ptrdiff_t>(
+            std::min(block_size, n_elements - block_begin));
+        auto unknown_element = n_block_elements;
+#pragma omp parallel for schedule(dynamic, 256)
+        for (std::ptrdiff_t i = 0; i < n_block_elements; ++i)
         {
-            ElementErrorCode e(elem->validate());
-            if (e[ElementErrorFlag::NonCoplanar])
+            MeshLib::Element const*const elem(elements[block_begin + i]);
+            auto& revised = revised_elements[i];
+            revised.clear();
+            unsigned n_unique_nodes(this->getNumberOfUniqueNodes(elem));
+            if (n_unique_nodes == elem->getNumberOfBaseNodes()
+                && elem->getDimension() >= min_elem_dim)
             {
-                std::size_t const n_new_elements(
-                    subdivideElement(elem, new_nodes, new_elements));
-                if (n_new_elements == 0)
+                ElementErrorCode e(elem->validate());
+                if (e[ElementErrorFlag::NonCoplanar])
                 {
-                    ERR("Element %d has unknown element type.", k);
-                    this->resetNodeIDs();
-                    this->cleanUp(new_nodes, new_elements);
-                    return nullptr;
-                }
-                if (material_vec)
-                {
-                    new_material_vec->insert(new_material_vec->end(),
-                                             n_new_elements,
-                                             (*material_vec)[k]);
-                }
-            } else {
-                new_elements.push_back(MeshLib::copyElement(elem, new_nodes));
-                // copy material values
-                if (material_vec)
-                {
-                    new_material_vec->push_back((*material_vec)[k]);
+                    if (subdivideElement(elem, new_nodes, revised) == 0)
+                    {
+#pragma omp critical(ogs_mesh_revision_unknown_element)
+                        unknown_element = std::min(unknown_element, i);
+                    }
+                } else {
+                    revised.push_back(MeshLib::copyElement(elem, new_nodes));
                 }
             }
+            else if (n_unique_nodes < elem->getNumberOfBaseNodes() && n_unique_nodes>1) {
+                reduceElement(elem, n_unique_nodes, new_nodes, revised,
+                              min_elem_dim);
+            } else
+            {
+#pragma omp critical(ogs_mesh_revision_log)
+                ERR ("Something is wrong, more unique nodes than actual nodes");
+            }
         }
-        else if (n_unique_nodes < elem->getNumberOfBaseNodes() && n_unique_nodes>1) {
-            std::size_t const n_new_elements(reduceElement(
-                elem, n_unique_nodes, new_nodes, new_elements, min_elem_dim)
-            );
-            if (!material_vec)
+
+        for (std::ptrdiff_t i = 0; i < n_block_elements; ++i)
+        {
+            auto const& revised = revised_elements[i];
+            new_elements.insert(new_elements.end(), revised.begin(),
+                                revised.end());
+            // copy material values
+            if (material_vec)
             {
-                continue;
+                new_material_vec->insert(new_material_vec->end(),
+                                         revised.size(),
+                                         (*material_vec)[block_begin + i]);
             }
-            new_material_vec->insert(new_material_vec->end(),
-                n_new_elements, (*material_vec)[k]);
-        } else
-            ERR ("Something is wrong, more unique nodes than actual nodes");
+        }
+
+        if (unknown_element < n_block_elements)
+        {
+            ERR("Element %d has unknown element type.",
+                block_begin + unknown_element);
+            this->resetNodeIDs();
+            this->cleanUp(new_nodes, new_elements);
+            return nullptr;
+        }
     }
 
     this->resetNodeIDs();
@@ -143,43 +165,62 @@ std::vector<std::size_t> MeshRevision::collapseNodeIndices(double eps) const
 
     GeoLib::Grid<MeshLib::Node> const grid(nodes.begin(), nodes.end(), 64);
 
-    for (std::size_t k = 0; k < nNodes; ++k)
-    {
-        MeshLib::Node const*const node(nodes[k]);
-        if (node->getID() != k)
+    // The nodes closer than eps are searched in parallel for blocks of nodes.
+    // The collapsing depends on the order of the nodes and is done serially
+    // afterwards for each block.
+    std::size_t const block_size(65536);
+    std::vector<std::vector<std::size_t>> close_node_ids(
+        std::min(block_size, nNodes));
+    for (std::size_t block_begin = 0; block_begin < nNodes;
+         block_begin += block_size)
+    {
+        auto const n_block_nodes = static_cast<std::ptrdiff_t>(
+            std::min(block_size, nNodes - block_begin));
+#pragma omp parallel for schedule(dynamic, 256)
+        for (std::ptrdiff_t i = 0; i < n_block_nodes; ++i)
         {
-            continue;
+            MeshLib::Node const* const node(nodes[block_begin + i]);
+            auto& close_ids = close_node_ids[i];
+            close_ids.clear();
+            std::vector<std::vector<MeshLib::Node*> const*> node_vectors(
+                grid.getPntVecsOfGridCellsIntersectingCube(*node, half_eps));
+            for (auto const* const cell_vector : node_vectors)
+            {
+                for (MeshLib::Node const* const test_node : *cell_vector)
+                {
+                    if (test_node != node &&
+                        MathLib::sqrDist(node->getCoords(),
+                                         test_node->getCoords()) < sqr_eps)
+                    {
+                        close_ids.push_back(test_node->getID());
+                    }
+                }
+            }
         }
-        std::vector<std::vector<MeshLib::Node*> const*> node_vectors(
-            grid.getPntVecsOfGridCellsIntersectingCube(*node, half_eps));
 
-        const std::size_t nVectors(node_vectors.size());
-        for (std::size_t i = 0; i < nVectors; ++i)
+        for (std::ptrdiff_t i = 0; i < n_block_nodes; ++i)
         {
-            const std::vector<MeshLib::Node*> &cell_vector(*node_vectors[i]);
-            const std::size_t nGridCellNodes(cell_vector.size());
-            for (std::size_t j = 0; j < nGridCellNodes; ++j)
+            std::size_t const k(block_begin + i);
+            if (nodes[k]->getID() != k)
+            {
+                continue;
+            }
+            for (auto const test_id : close_node_ids[i])
             {
-                MeshLib::Node const*const test_node(cell_vector[j]);
                 // are node indices already identical (i.e. nodes will be collapsed)
-                if (id_map[node->getID()] == id_map[test_node->getID()])
+                if (id_map[k] == id_map[test_id])
                 {
                     continue;
                 }
 
                 // if test_node has already been collapsed to another node x, ignore it
                 // (if the current node would need to be collapsed with x it would already have happened when x was tested)
-                if (test_node->getID() != id_map[test_node->getID()])
+                if (test_id != id_map[test_id])
                 {
                     continue;
                 }
 
-                // calc distance
-                if (MathLib::sqrDist(node->getCoords(),
-                                     test_node->getCoords()) < sqr_eps)
-                {
-                    id_map[test_node->getID()] = node->getID();
-                }
+                id_map[test_id] = k;
             }
         }
     }
@@ -129,6 +129,7 @@ void LayeredVolume::addLayerToMesh(const MeshLib::Mesh &dem_mesh, unsigned layer
 
 void LayeredVolume::addLayerBoundaries(const MeshLib::Mesh &layer, std::size_t nLayers)
 {
+    layer.computeElementNeighbors();
     const unsigned nLayerBoundaries (nLayers-1);
     const std::size_t nNodes (layer.getNumberOfNodes());
     const std::vector<MeshLib::Element*> &layer_elements (layer.getElements());
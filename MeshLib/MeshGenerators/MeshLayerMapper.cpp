@@ -15,6 +15,8 @@
 #include "MeshLayerMapper.h"
 
 #include <algorithm>
+#include <array>
+#include <numeric>
 
 #include <logog/include/logog.hpp>
 
@@ -54,16 +56,30 @@ MeshLib::Mesh* MeshLayerMapper::createStaticLayers(MeshLib::Mesh const& mesh, st
     }
 
     const std::size_t nNodes = mesh.getNumberOfNodes();
-    // count number of 2d elements in the original mesh
-    const std::size_t nElems (std::count_if(mesh.getElements().begin(), mesh.getElements().end(),
-            [](MeshLib::Element const* elem) { return (elem->getDimension() == 2);}));
+    // collect the 2d elements of the original mesh
+    std::vector<MeshLib::Element const*> sfc_elems;
+    for (MeshLib::Element const* elem : mesh.getElements())
+    {
+        if (elem->getDimension() == 2)
+        {
+            sfc_elems.push_back(elem);
+        }
+    }
+    const std::size_t nElems(sfc_elems.size());
+    if (std::any_of(sfc_elems.cbegin(), sfc_elems.cend(),
+                    [](MeshLib::Element const* elem) {
+                        return elem->getGeomType() !=
+                                   MeshLib::MeshElemType::TRIANGLE &&
+                               elem->getGeomType() !=
+                                   MeshLib::MeshElemType::QUAD;
+                    }))
+    {
+        OGS_FATAL("MeshLayerMapper: Unknown element type to extrude.");
+    }
 
-    const std::size_t nOrgElems (mesh.getNumberOfElements());
     const std::vector<MeshLib::Node*> &nodes = mesh.getNodes();
-    const std::vector<MeshLib::Element*> &elems = mesh.getElements();
     std::vector<MeshLib::Node*> new_nodes(nNodes + (nLayers * nNodes));
-    std::vector<MeshLib::Element*> new_elems;
-    new_elems.reserve(nElems * nLayers);
+    std::vector<MeshLib::Element*> new_elems(nElems * nLayers);
     MeshLib::Properties properties;
     auto* const materials = properties.createNewPropertyVector<int>(
         "MaterialIDs", MeshLib::MeshItemType::Cell);
@@ -72,64 +88,51 @@ MeshLib::Mesh* MeshLayerMapper::createStaticLayers(MeshLib::Mesh const& mesh, st
         ERR("Could not create PropertyVector object 'MaterialIDs'.");
         return nullptr;
     }
+    materials->resize(nElems * nLayers);
 
-    materials->reserve(nElems * nLayers);
-    double z_offset (0.0);
+    std::vector<double> z_offsets(nLayers + 1, 0.0);
+    std::partial_sum(thickness.cbegin(), thickness.cend(),
+                     z_offsets.begin() + 1);
 
-    for (unsigned layer_id = 0; layer_id <= nLayers; ++layer_id)
+    // add the nodes of all layers
+    auto const n_new_nodes_signed = static_cast<long>(new_nodes.size());
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (long i = 0; i < n_new_nodes_signed; ++i)
     {
-        // add nodes for new layer
-        unsigned node_offset (nNodes * layer_id);
-        if (layer_id > 0)
-        {
-            z_offset += thickness[layer_id - 1];
-        }
+        MeshLib::Node const& node = *nodes[i % nNodes];
+        new_nodes[i] = new MeshLib::Node(node[0], node[1],
+                                         node[2] - z_offsets[i / nNodes]);
+    }
+
+    // create prism or hex elements connecting each layer with the one above
+    auto const n_new_elems_signed = static_cast<long>(new_elems.size());
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (long i = 0; i < n_new_elems_signed; ++i)
+    {
+        const MeshLib::Element* sfc_elem(sfc_elems[i % nElems]);
+        const std::size_t layer_id = i / nElems + 1;
+        const std::size_t node_offset = nNodes * (layer_id - 1);
 
-        std::transform(nodes.cbegin(), nodes.cend(), new_nodes.begin() + node_offset,
-            [&z_offset](MeshLib::Node* node){ return new MeshLib::Node((*node)[0], (*node)[1], (*node)[2]-z_offset); });
+        const unsigned nElemNodes(sfc_elem->getNumberOfBaseNodes());
+        auto** e_nodes = new MeshLib::Node*[2 * nElemNodes];
 
-        // starting with 2nd layer create prism or hex elements connecting the last layer with the current one
-        if (layer_id == 0)
+        for (unsigned j=0; j<nElemNodes; ++j)
         {
-            continue;
+            const std::size_t node_id = sfc_elem->getNode(j)->getID() + node_offset;
+            e_nodes[j] = new_nodes[node_id+nNodes];
+            e_nodes[j+nElemNodes] = new_nodes[node_id];
         }
-
-        node_offset -= nNodes;
-        const unsigned mat_id (nLayers - layer_id);
-
-        for (unsigned i = 0; i < nOrgElems; ++i)
+        if (sfc_elem->getGeomType() == MeshLib::MeshElemType::TRIANGLE)
+        {
+            // extrude triangles to prism
+            new_elems[i] = new MeshLib::Prism(e_nodes);
+        }
+        else
         {
-            const MeshLib::Element* sfc_elem( elems[i] );
-            if (sfc_elem->getDimension() < 2)
-            {  // ignore line-elements
-                continue;
-            }
-
-            const unsigned nElemNodes(sfc_elem->getNumberOfBaseNodes());
-            auto** e_nodes = new MeshLib::Node*[2 * nElemNodes];
-
-            for (unsigned j=0; j<nElemNodes; ++j)
-            {
-                const unsigned node_id = sfc_elem->getNode(j)->getID() + node_offset;
-                e_nodes[j] = new_nodes[node_id+nNodes];
-                e_nodes[j+nElemNodes] = new_nodes[node_id];
-            }
-            if (sfc_elem->getGeomType() == MeshLib::MeshElemType::TRIANGLE)
-            {
-                // extrude triangles to prism
-                new_elems.push_back(new MeshLib::Prism(e_nodes));
-            }
-            else if (sfc_elem->getGeomType() == MeshLib::MeshElemType::QUAD)
-            {
-                // extrude quads to hexes
-                new_elems.push_back(new MeshLib::Hex(e_nodes));
-            }
-            else
-            {
-                OGS_FATAL("MeshLayerMapper: Unknown element type to extrude.");
-            }
-            materials->push_back(mat_id);
+            // extrude quads to hexes
+            new_elems[i] = new MeshLib::Hex(e_nodes);
         }
+        (*materials)[i] = nLayers - layer_id;
     }
     return new MeshLib::Mesh(mesh_name, new_nodes, new_elems, properties);
 }
@@ -161,26 +164,56 @@ bool MeshLayerMapper::createRasterLayers(
 
     this->_minimum_thickness = minimum_thickness;
     std::size_t const nNodes = mesh.getNumberOfNodes();
-    _nodes.reserve(nLayers * nNodes);
-
-    // number of triangles in the original mesh
-    std::size_t const nElems (std::count_if(mesh.getElements().begin(), mesh.getElements().end(),
-        [](MeshLib::Element const* elem)
-            { return (elem->getGeomType() == MeshLib::MeshElemType::TRIANGLE);}));
-    _elements.reserve(nElems * (nLayers-1));
-    _materials.reserve(nElems *  (nLayers-1));
+    auto const nNodes_signed = static_cast<long>(nNodes);
+
+    // Create the nodes column by column, i.e., sample all rasters for one
+    // surface node. The node of layer i at surface node n has the index
+    // i * nNodes + n.
+    std::vector<MeshLib::Node*> const& top_nodes = top->getNodes();
+    std::vector<MeshLib::Node*> const& bottom_nodes = bottom->getNodes();
+    _nodes.resize(nLayers * nNodes);
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (long n = 0; n < nNodes_signed; ++n)
+    {
+        _nodes[n] = new MeshLib::Node(*bottom_nodes[n]);
+        for (std::size_t i = 1; i < nLayers; ++i)
+        {
+            _nodes[i * nNodes + n] =
+                getNewLayerNode(*top_nodes[n], *_nodes[(i - 1) * nNodes + n],
+                                *rasters[i], i * nNodes + n);
+        }
+    }
 
-    // add bottom layer
-    std::vector<MeshLib::Node*> const& nodes = bottom->getNodes();
-    for (MeshLib::Node* node : nodes)
+    // Create the elements of all layers into a flat array; collapsed elements
+    // leave a null pointer, which is skipped afterwards.
+    std::vector<MeshLib::Element const*> triangles;
+    for (MeshLib::Element const* elem : top->getElements())
+    {
+        if (elem->getGeomType() == MeshLib::MeshElemType::TRIANGLE)
+        {
+            triangles.push_back(elem);
+        }
+    }
+    std::size_t const nElems = triangles.size();
+    auto const n_layer_elements_signed =
+        static_cast<long>(nElems * (nLayers - 1));
+    std::vector<MeshLib::Element*> layer_elements(nElems * (nLayers - 1));
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (long e = 0; e < n_layer_elements_signed; ++e)
     {
-        _nodes.push_back(new MeshLib::Node(*node));
+        layer_elements[e] =
+            createLayerElement(*triangles[e % nElems], e / nElems, nNodes);
     }
 
-    // add the other layers
-    for (std::size_t i = 0; i < nLayers - 1; ++i)
+    _elements.reserve(layer_elements.size());
+    _materials.reserve(layer_elements.size());
+    for (std::size_t e = 0; e < layer_elements.size(); ++e)
     {
-        addLayerToMesh(*top, i, *rasters[i + 1]);
+        if (layer_elements[e] != nullptr)
+        {
+            _elements.push_back(layer_elements[e]);
+            _materials.push_back(e / nElems);
+        }
     }
 
     return true;
@@ -188,16 +221,9 @@ bool MeshLayerMapper::createRasterLayers(
 
 void MeshLayerMapper::addLayerToMesh(const MeshLib::Mesh &dem_mesh, unsigned layer_id, GeoLib::Raster const& raster)
 {
-    const unsigned pyramid_base[3][4] =
-    {
-        {1, 3, 4, 2}, // Point 4 missing
-        {2, 4, 3, 0}, // Point 5 missing
-        {0, 3, 4, 1}, // Point 6 missing
-    };
-
     std::size_t const nNodes = dem_mesh.getNumberOfNodes();
     std::vector<MeshLib::Node*> const& nodes = dem_mesh.getNodes();
-    int const last_layer_node_offset = layer_id * nNodes;
+    std::size_t const last_layer_node_offset = layer_id * nNodes;
 
     // add nodes for new layer
     for (std::size_t i = 0; i < nNodes; ++i)
@@ -207,60 +233,73 @@ void MeshLayerMapper::addLayerToMesh(const MeshLib::Mesh &dem_mesh, unsigned lay
                                          raster, _nodes.size()));
     }
 
-    std::vector<MeshLib::Element*> const& elems = dem_mesh.getElements();
-    std::size_t const nElems (dem_mesh.getNumberOfElements());
-
-    for (std::size_t i=0; i<nElems; ++i)
+    for (MeshLib::Element const* elem : dem_mesh.getElements())
     {
-        MeshLib::Element* elem (elems[i]);
         if (elem->getGeomType() != MeshLib::MeshElemType::TRIANGLE)
         {
             continue;
         }
-        unsigned node_counter(3);
-        unsigned missing_idx(0);
-        std::array<MeshLib::Node*, 6> new_elem_nodes;
-        for (unsigned j=0; j<3; ++j)
+        if (auto* new_elem = createLayerElement(*elem, layer_id, nNodes))
         {
-            new_elem_nodes[j] = _nodes[_nodes[last_layer_node_offset + elem->getNodeIndex(j)]->getID()];
-            new_elem_nodes[node_counter] = (_nodes[last_layer_node_offset + elem->getNodeIndex(j) + nNodes]);
-            if (new_elem_nodes[j]->getID() !=
-                new_elem_nodes[node_counter]->getID())
-            {
-                node_counter++;
-            }
-            else
-            {
-                missing_idx = j;
-            }
+            _elements.push_back(new_elem);
+            _materials.push_back(layer_id);
         }
+    }
+}
+
+MeshLib::Element* MeshLayerMapper::createLayerElement(
+    MeshLib::Element const& sfc_elem, std::size_t const layer_id,
+    std::size_t const nNodes) const
+{
+    const unsigned pyramid_base[3][4] =
+    {
+        {1, 3, 4, 2}, // Point 4 missing
+        {2, 4, 3, 0}, // Point 5 missing
+        {0, 3, 4, 1}, // Point 6 missing
+    };
 
-        switch (node_counter)
+    std::size_t const last_layer_node_offset = layer_id * nNodes;
+    unsigned node_counter(3);
+    unsigned missing_idx(0);
+    std::array<MeshLib::Node*, 6> new_elem_nodes;
+    for (unsigned j=0; j<3; ++j)
+    {
+        new_elem_nodes[j] = _nodes[_nodes[last_layer_node_offset + sfc_elem.getNodeIndex(j)]->getID()];
+        new_elem_nodes[node_counter] = (_nodes[last_layer_node_offset + sfc_elem.getNodeIndex(j) + nNodes]);
+        if (new_elem_nodes[j]->getID() !=
+            new_elem_nodes[node_counter]->getID())
         {
-        case 6:
-            _elements.push_back(new MeshLib::Prism(new_elem_nodes));
-            _materials.push_back(layer_id);
-            break;
-        case 5:
-            std::array<MeshLib::Node*, 5> pyramid_nodes;
-            pyramid_nodes[0] = new_elem_nodes[pyramid_base[missing_idx][0]];
-            pyramid_nodes[1] = new_elem_nodes[pyramid_base[missing_idx][1]];
-            pyramid_nodes[2] = new_elem_nodes[pyramid_base[missing_idx][2]];
-            pyramid_nodes[3] = new_elem_nodes[pyramid_base[missing_idx][3]];
-            pyramid_nodes[4] = new_elem_nodes[missing_idx];
-            _elements.push_back(new MeshLib::Pyramid(pyramid_nodes));
-            _materials.push_back(layer_id);
-            break;
-        case 4:
-            std::array<MeshLib::Node*, 4> tet_nodes;
-            std::copy(new_elem_nodes.begin(), new_elem_nodes.begin() + node_counter, tet_nodes.begin());
-            _elements.push_back(new MeshLib::Tet(tet_nodes));
-            _materials.push_back(layer_id);
-            break;
-        default:
-            continue;
+            node_counter++;
+        }
+        else
+        {
+            missing_idx = j;
         }
     }
+
+    switch (node_counter)
+    {
+    case 6:
+        return new MeshLib::Prism(new_elem_nodes);
+    case 5:
+    {
+        std::array<MeshLib::Node*, 5> pyramid_nodes;
+        pyramid_nodes[0] = new_elem_nodes[pyramid_base[missing_idx][0]];
+        pyramid_nodes[1] = new_elem_nodes[pyramid_base[missing_idx][1]];
+        pyramid_nodes[2] = new_elem_nodes[pyramid_base[missing_idx][2]];
+        pyramid_nodes[3] = new_elem_nodes[pyramid_base[missing_idx][3]];
+        pyramid_nodes[4] = new_elem_nodes[missing_idx];
+        return new MeshLib::Pyramid(pyramid_nodes);
+    }
+    case 4:
+    {
+        std::array<MeshLib::Node*, 4> tet_nodes;
+        std::copy(new_elem_nodes.begin(), new_elem_nodes.begin() + node_counter, tet_nodes.begin());
+        return new MeshLib::Tet(tet_nodes);
+    }
+    default:
+        return nullptr;
+    }
 }
 
 bool MeshLayerMapper::layerMapping(MeshLib::Mesh &new_mesh, GeoLib::Raster const& raster, double noDataReplacementValue = 0.0)
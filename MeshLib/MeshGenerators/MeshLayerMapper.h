@@ -69,6 +69,15 @@ private:
     void addLayerToMesh(const MeshLib::Mesh& dem_mesh,
                         unsigned layer_id,
                         GeoLib::Raster const& raster) override;
+
+    /// Creates the element of the given layer above the surface triangle
+    /// \c sfc_elem from the already created nodes of the layers \c layer_id
+    /// and \c layer_id + 1. Depending on the collapsed nodes this is a prism,
+    /// pyramid, or tetrahedron; if all nodes are collapsed a nullptr is
+    /// returned.
+    MeshLib::Element* createLayerElement(MeshLib::Element const& sfc_elem,
+                                         std::size_t const layer_id,
+                                         std::size_t const nNodes) const;
 };
 
 } // end namespace MeshLib
@@ -8,7 +8,8 @@
 
 #include "QuadraticMeshGenerator.h"
 
-#include <set>
+#include <algorithm>
+#include <numeric>
 
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/Elements/Hex.h"
@@ -20,125 +21,209 @@
 #include "MeshLib/MeshEditing/DuplicateMeshComponents.h"
 #include "MeshLib/Node.h"
 
-/// Given an (linear) element divide all its edges by inserting a point in the
-/// middle and return a new element.
+/// Given a linear element return a new quadratic element with the base nodes
+/// of the linear element followed by the given middle nodes of its edges.
 template <typename QuadraticElement>
-std::unique_ptr<QuadraticElement> convertLinearToQuadratic(
-    MeshLib::Element const& e)
+MeshLib::Element* convertLinearToQuadratic(
+    MeshLib::Element const& e, std::vector<MeshLib::Node*> const& nodes,
+    std::size_t const* const edge_node_ids)
 {
     int const n_all_nodes = QuadraticElement::n_all_nodes;
     int const n_base_nodes = QuadraticElement::n_base_nodes;
     assert(n_base_nodes == e.getNumberOfBaseNodes());
 
-    // Copy base nodes of element to the quadratic element new nodes'.
-    std::array<MeshLib::Node*, n_all_nodes> nodes;
+    std::array<MeshLib::Node*, n_all_nodes> element_nodes;
     for (int i = 0; i < n_base_nodes; i++)
     {
-        nodes[i] = const_cast<MeshLib::Node*>(e.getNode(i));
+        element_nodes[i] = nodes[e.getNodeIndex(i)];
     }
-
-    // For each edge create a middle node.
     int const number_of_edges = e.getNumberOfEdges();
     for (int i = 0; i < number_of_edges; i++)
     {
-        auto const& a = *e.getEdgeNode(i, 0);
-        auto const& b = *e.getEdgeNode(i, 1);
-
-        nodes[n_base_nodes + i] = new MeshLib::Node(
-            (a[0] + b[0]) / 2, (a[1] + b[1]) / 2, (a[2] + b[2]) / 2);
+        element_nodes[n_base_nodes + i] = nodes[edge_node_ids[i]];
     }
 
-    return std::make_unique<QuadraticElement>(nodes, e.getID());
+    return new QuadraticElement(element_nodes, e.getID());
 }
 
 /// Return a new quadratic element corresponding to the linear element's type.
-std::unique_ptr<MeshLib::Element> createQuadraticElement(
-    MeshLib::Element const& e)
+MeshLib::Element* createQuadraticElement(
+    MeshLib::Element const& e, std::vector<MeshLib::Node*> const& nodes,
+    std::size_t const* const edge_node_ids)
 {
     if (e.getCellType() == MeshLib::CellType::LINE2)
     {
-        return convertLinearToQuadratic<MeshLib::Line3>(e);
+        return convertLinearToQuadratic<MeshLib::Line3>(e, nodes,
+                                                        edge_node_ids);
     }
     if (e.getCellType() == MeshLib::CellType::TRI3)
     {
-        return convertLinearToQuadratic<MeshLib::Tri6>(e);
+        return convertLinearToQuadratic<MeshLib::Tri6>(e, nodes,
+                                                       edge_node_ids);
     }
     if (e.getCellType() == MeshLib::CellType::TET4)
     {
-        return convertLinearToQuadratic<MeshLib::Tet10>(e);
+        return convertLinearToQuadratic<MeshLib::Tet10>(e, nodes,
+                                                        edge_node_ids);
     }
     if (e.getCellType() == MeshLib::CellType::QUAD4)
     {
-        return convertLinearToQuadratic<MeshLib::Quad8>(e);
+        return convertLinearToQuadratic<MeshLib::Quad8>(e, nodes,
+                                                        edge_node_ids);
     }
     if (e.getCellType() == MeshLib::CellType::HEX8)
     {
-        return convertLinearToQuadratic<MeshLib::Hex20>(e);
+        return convertLinearToQuadratic<MeshLib::Hex20>(e, nodes,
+                                                        edge_node_ids);
     }
 
     OGS_FATAL("Mesh element type %s is not supported",
               MeshLib::CellType2String(e.getCellType()).c_str());
 }
 
-struct nodeByCoordinatesComparator
+namespace
 {
-    bool operator()(MeshLib::Node* a, MeshLib::Node* b) const
-    {
-        return *a < *b;
-    }
+/// An edge of an element stored with its node of the smaller id.
+struct EdgeEnd
+{
+    /// The id of the node of the edge with the larger id.
+    std::size_t other_node_id;
+    /// The position of the edge in the list of edges of all elements.
+    std::size_t element_edge;
 };
+}  // namespace
 
 namespace MeshLib
 {
 std::unique_ptr<Mesh> createQuadraticOrderMesh(Mesh const& linear_mesh)
 {
-    // Clone the linear mesh nodes.
-    auto quadratic_mesh_nodes = MeshLib::copyNodeVector(linear_mesh.getNodes());
+    auto const& linear_mesh_elements = linear_mesh.getElements();
+    auto const n_elements = linear_mesh_elements.size();
+    auto const n_linear_nodes = linear_mesh.getNumberOfNodes();
 
-    // Temporary container for unique quadratic nodes with O(log(n)) search.
-    std::set<MeshLib::Node*, nodeByCoordinatesComparator> unique_nodes;
+    // Check the element types before the parallel conversion.
+    for (auto const* e : linear_mesh_elements)
+    {
+        auto const cell_type = e->getCellType();
+        if (cell_type != MeshLib::CellType::LINE2 &&
+            cell_type != MeshLib::CellType::TRI3 &&
+            cell_type != MeshLib::CellType::TET4 &&
+            cell_type != MeshLib::CellType::QUAD4 &&
+            cell_type != MeshLib::CellType::HEX8)
+        {
+            OGS_FATAL("Mesh element type %s is not supported",
+                      MeshLib::CellType2String(cell_type).c_str());
+        }
+    }
 
-    // Create new elements with the quadratic nodes
-    std::vector<MeshLib::Element*> quadratic_elements;
-    auto const& linear_mesh_elements = linear_mesh.getElements();
-    for (MeshLib::Element const* e : linear_mesh_elements)
+    // The edges of element e are numbered from element_edge_offsets[e].
+    std::vector<std::size_t> element_edge_offsets(n_elements + 1, 0);
+    for (std::size_t e = 0; e < n_elements; ++e)
     {
-        auto quadratic_element = createQuadraticElement(*e);
+        element_edge_offsets[e + 1] =
+            element_edge_offsets[e] +
+            linear_mesh_elements[e]->getNumberOfEdges();
+    }
+    auto const n_element_edges = element_edge_offsets.back();
 
-        // Replace the base nodes with cloned linear nodes.
-        int const number_base_nodes = quadratic_element->getNumberOfBaseNodes();
-        for (int i = 0; i < number_base_nodes; ++i)
+    // Enumerate all edges once, grouped by their node with the smaller id,
+    // instead of searching for already created middle nodes.
+    std::vector<std::size_t> node_edge_offsets(n_linear_nodes + 1, 0);
+    for (auto const* e : linear_mesh_elements)
+    {
+        for (unsigned i = 0; i < e->getNumberOfEdges(); ++i)
         {
-            quadratic_element->setNode(
-                i, quadratic_mesh_nodes[quadratic_element->getNodeIndex(i)]);
+            auto const a = e->getEdgeNode(i, 0)->getID();
+            auto const b = e->getEdgeNode(i, 1)->getID();
+            ++node_edge_offsets[std::min(a, b) + 1];
         }
+    }
+    std::partial_sum(node_edge_offsets.begin(), node_edge_offsets.end(),
+                     node_edge_offsets.begin());
 
-        // Make the new (middle-edge) nodes unique.
-        int const number_all_nodes = quadratic_element->getNumberOfNodes();
-        for (int i = number_base_nodes; i < number_all_nodes; ++i)
+    std::vector<EdgeEnd> edge_ends(n_element_edges);
+    {
+        std::vector<std::size_t> positions(node_edge_offsets.begin(),
+                                           node_edge_offsets.end() - 1);
+        for (std::size_t e = 0; e < n_elements; ++e)
         {
-            Node* original_node =
-                const_cast<Node*>(quadratic_element->getNode(i));
+            auto const& element = *linear_mesh_elements[e];
+            for (unsigned i = 0; i < element.getNumberOfEdges(); ++i)
+            {
+                auto const a = element.getEdgeNode(i, 0)->getID();
+                auto const b = element.getEdgeNode(i, 1)->getID();
+                edge_ends[positions[std::min(a, b)]++] = {
+                    std::max(a, b), element_edge_offsets[e] + i};
+            }
+        }
+    }
 
-            auto it = unique_nodes.insert(original_node);
-            if (!it.second)  // same node was already inserted before, no
-                             // insertion
+    // Sort the edges of each node and count the distinct ones, which get a
+    // middle node each.
+    auto const n_linear_nodes_signed = static_cast<long>(n_linear_nodes);
+    std::vector<std::size_t> node_middle_node_offsets(n_linear_nodes + 1, 0);
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (long n = 0; n < n_linear_nodes_signed; ++n)
+    {
+        auto const begin = edge_ends.begin() + node_edge_offsets[n];
+        auto const end = edge_ends.begin() + node_edge_offsets[n + 1];
+        std::sort(begin, end, [](EdgeEnd const& x, EdgeEnd const& y) {
+            return x.other_node_id < y.other_node_id;
+        });
+        std::size_t n_distinct = 0;
+        for (auto it = begin; it != end; ++it)
+        {
+            if (it == begin || it->other_node_id != (it - 1)->other_node_id)
             {
-                // Replace the element's node with the unique node.
-                quadratic_element->setNode(i, *it.first);
-                // And delete the original node
-                delete original_node;
+                ++n_distinct;
             }
         }
+        node_middle_node_offsets[n + 1] = n_distinct;
+    }
+    std::partial_sum(node_middle_node_offsets.begin(),
+                     node_middle_node_offsets.end(),
+                     node_middle_node_offsets.begin());
+    auto const n_middle_nodes = node_middle_node_offsets.back();
 
-        quadratic_elements.push_back(quadratic_element.release());
+    // Clone the linear mesh nodes and create the middle nodes in the order of
+    // the edges.
+    auto quadratic_mesh_nodes = MeshLib::copyNodeVector(linear_mesh.getNodes());
+    quadratic_mesh_nodes.resize(n_linear_nodes + n_middle_nodes);
+    auto const& linear_nodes = linear_mesh.getNodes();
+    std::vector<std::size_t> edge_node_ids(n_element_edges);
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (long n = 0; n < n_linear_nodes_signed; ++n)
+    {
+        auto const begin = edge_ends.begin() + node_edge_offsets[n];
+        auto const end = edge_ends.begin() + node_edge_offsets[n + 1];
+        std::size_t node_id = n_linear_nodes + node_middle_node_offsets[n];
+        for (auto it = begin; it != end; ++it)
+        {
+            if (it != begin && it->other_node_id == (it - 1)->other_node_id)
+            {
+                edge_node_ids[it->element_edge] = node_id - 1;
+                continue;
+            }
+            auto const& a = *linear_nodes[n];
+            auto const& b = *linear_nodes[it->other_node_id];
+            quadratic_mesh_nodes[node_id] =
+                new MeshLib::Node((a[0] + b[0]) / 2, (a[1] + b[1]) / 2,
+                                  (a[2] + b[2]) / 2, node_id);
+            edge_node_ids[it->element_edge] = node_id;
+            ++node_id;
+        }
     }
 
-    // Add the unique quadratic nodes to the cloned linear nodes.
-    quadratic_mesh_nodes.reserve(linear_mesh.getNodes().size() +
-                                 unique_nodes.size());
-    std::copy(unique_nodes.begin(), unique_nodes.end(),
-              std::back_inserter(quadratic_mesh_nodes));
+    // Create new elements with the quadratic nodes.
+    std::vector<MeshLib::Element*> quadratic_elements(n_elements);
+    auto const n_elements_signed = static_cast<long>(n_elements);
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (long e = 0; e < n_elements_signed; ++e)
+    {
+        quadratic_elements[e] = createQuadraticElement(
+            *linear_mesh_elements[e], quadratic_mesh_nodes,
+            edge_node_ids.data() + element_edge_offsets[e]);
+    }
 
     return std::make_unique<MeshLib::Mesh>(
         linear_mesh.getName(), quadratic_mesh_nodes, quadratic_elements,
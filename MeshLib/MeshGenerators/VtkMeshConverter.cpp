@@ -14,8 +14,8 @@
 
 #include "VtkMeshConverter.h"
 
-#include "MeshLib/Elements/Elements.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/createElementFromVtkCell.h"
 #include "MeshLib/Node.h"
 
 // Conversion from Image to QuadMesh
@@ -39,22 +39,6 @@
 
 namespace MeshLib
 {
-namespace detail
-{
-template <class T_ELEMENT>
-MeshLib::Element* createElementWithSameNodeOrder(
-    const std::vector<MeshLib::Node*>& nodes, vtkIdList* const node_ids,
-    std::size_t const element_id)
-{
-    auto** ele_nodes = new MeshLib::Node*[T_ELEMENT::n_all_nodes];
-    for (unsigned k(0); k < T_ELEMENT::n_all_nodes; k++)
-    {
-        ele_nodes[k] = nodes[node_ids->GetId(k)];
-    }
-    return new T_ELEMENT(ele_nodes, element_id);
-}
-}  // namespace detail
-
 MeshLib::Mesh* VtkMeshConverter::convertUnstructuredGrid(
     vtkUnstructuredGrid* grid, std::string const& mesh_name)
 {
@@ -77,161 +61,22 @@ MeshLib::Mesh* VtkMeshConverter::convertUnstructuredGrid(
     const std::size_t nElems = grid->GetNumberOfCells();
     std::vector<MeshLib::Element*> elements(nElems);
     auto node_ids = vtkSmartPointer<vtkIdList>::New();
+    auto const node_id = [&node_ids](unsigned const k) {
+        return node_ids->GetId(k);
+    };
     for (std::size_t i = 0; i < nElems; i++)
     {
-        MeshLib::Element* elem;
         grid->GetCellPoints(i, node_ids);
 
         int cell_type = grid->GetCellType(i);
-        switch (cell_type)
+        MeshLib::Element* const elem =
+            createElementFromVtkCell(cell_type, nodes, node_id, i);
+        if (elem == nullptr)
         {
-            case VTK_VERTEX:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Point>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_LINE:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Line>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_TRIANGLE:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Tri>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUAD:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Quad>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_PIXEL:
-            {
-                auto** quad_nodes = new MeshLib::Node*[4];
-                quad_nodes[0] = nodes[node_ids->GetId(0)];
-                quad_nodes[1] = nodes[node_ids->GetId(1)];
-                quad_nodes[2] = nodes[node_ids->GetId(3)];
-                quad_nodes[3] = nodes[node_ids->GetId(2)];
-                elem = new MeshLib::Quad(quad_nodes, i);
-                break;
-            }
-            case VTK_TETRA:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Tet>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_HEXAHEDRON:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Hex>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_VOXEL:
-            {
-                auto** voxel_nodes = new MeshLib::Node*[8];
-                voxel_nodes[0] = nodes[node_ids->GetId(0)];
-                voxel_nodes[1] = nodes[node_ids->GetId(1)];
-                voxel_nodes[2] = nodes[node_ids->GetId(3)];
-                voxel_nodes[3] = nodes[node_ids->GetId(2)];
-                voxel_nodes[4] = nodes[node_ids->GetId(4)];
-                voxel_nodes[5] = nodes[node_ids->GetId(5)];
-                voxel_nodes[6] = nodes[node_ids->GetId(7)];
-                voxel_nodes[7] = nodes[node_ids->GetId(6)];
-                elem = new MeshLib::Hex(voxel_nodes, i);
-                break;
-            }
-            case VTK_PYRAMID:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Pyramid>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_WEDGE:
-            {
-                auto** prism_nodes = new MeshLib::Node*[6];
-                for (unsigned j = 0; j < 3; ++j)
-                {
-                    prism_nodes[j] = nodes[node_ids->GetId(j + 3)];
-                    prism_nodes[j + 3] = nodes[node_ids->GetId(j)];
-                }
-                elem = new MeshLib::Prism(prism_nodes, i);
-                break;
-            }
-            case VTK_QUADRATIC_EDGE:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Line3>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_TRIANGLE:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Tri6>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_QUAD:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Quad8>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_BIQUADRATIC_QUAD:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Quad9>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_TETRA:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Tet10>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_HEXAHEDRON:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Hex20>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_PYRAMID:
-            {
-                elem =
-                    detail::createElementWithSameNodeOrder<MeshLib::Pyramid13>(
-                        nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_WEDGE:
-            {
-                auto** prism_nodes = new MeshLib::Node*[15];
-                for (unsigned j = 0; j < 3; ++j)
-                {
-                    prism_nodes[j] = nodes[node_ids->GetId(j + 3)];
-                    prism_nodes[j + 3] = nodes[node_ids->GetId(j)];
-                }
-                for (unsigned j = 0; j < 3; ++j)
-                {
-                    prism_nodes[6 + j] = nodes[node_ids->GetId(8 - j)];
-                }
-                prism_nodes[9] = nodes[node_ids->GetId(12)];
-                prism_nodes[10] = nodes[node_ids->GetId(14)];
-                prism_nodes[11] = nodes[node_ids->GetId(13)];
-                for (unsigned j = 0; j < 3; ++j)
-                {
-                    prism_nodes[12 + j] = nodes[node_ids->GetId(11 - j)];
-                }
-                elem = new MeshLib::Prism15(prism_nodes, i);
-                break;
-            }
-            default:
-                ERR("VtkMeshConverter::convertUnstructuredGrid(): Unknown mesh "
-                    "element type '%d'.",
-                    cell_type);
-                return nullptr;
+            ERR("VtkMeshConverter::convertUnstructuredGrid(): Unknown mesh "
+                "element type '%d'.",
+                cell_type);
+            return nullptr;
         }
 
         elements[i] = elem;
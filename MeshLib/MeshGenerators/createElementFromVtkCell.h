@@ -0,0 +1,148 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <vtkCellType.h>
+
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Node.h"
+
+namespace MeshLib
+{
+namespace detail
+{
+template <class T_ELEMENT, typename NodeIdGetter>
+MeshLib::Element* createElementWithSameNodeOrder(
+    std::vector<MeshLib::Node*> const& nodes, NodeIdGetter const& node_id,
+    std::size_t const element_id)
+{
+    auto** ele_nodes = new MeshLib::Node*[T_ELEMENT::n_all_nodes];
+    for (unsigned k(0); k < T_ELEMENT::n_all_nodes; k++)
+    {
+        ele_nodes[k] = nodes[node_id(k)];
+    }
+    return new T_ELEMENT(ele_nodes, element_id);
+}
+}  // namespace detail
+
+/// Creates an element of the given VTK cell type. The ids of the cell's nodes
+/// are provided in the VTK node order by \c node_id(k) for the k-th node of
+/// the cell.
+/// \return The new element or a nullptr if the cell type is not supported.
+template <typename NodeIdGetter>
+MeshLib::Element* createElementFromVtkCell(
+    int const cell_type, std::vector<MeshLib::Node*> const& nodes,
+    NodeIdGetter const& node_id, std::size_t const element_id)
+{
+    switch (cell_type)
+    {
+        case VTK_VERTEX:
+            return detail::createElementWithSameNodeOrder<MeshLib::Point>(
+                nodes, node_id, element_id);
+        case VTK_LINE:
+            return detail::createElementWithSameNodeOrder<MeshLib::Line>(
+                nodes, node_id, element_id);
+        case VTK_TRIANGLE:
+            return detail::createElementWithSameNodeOrder<MeshLib::Tri>(
+                nodes, node_id, element_id);
+        case VTK_QUAD:
+            return detail::createElementWithSameNodeOrder<MeshLib::Quad>(
+                nodes, node_id, element_id);
+        case VTK_PIXEL:
+        {
+            auto** quad_nodes = new MeshLib::Node*[4];
+            quad_nodes[0] = nodes[node_id(0)];
+            quad_nodes[1] = nodes[node_id(1)];
+            quad_nodes[2] = nodes[node_id(3)];
+            quad_nodes[3] = nodes[node_id(2)];
+            return new MeshLib::Quad(quad_nodes, element_id);
+        }
+        case VTK_TETRA:
+            return detail::createElementWithSameNodeOrder<MeshLib::Tet>(
+                nodes, node_id, element_id);
+        case VTK_HEXAHEDRON:
+            return detail::createElementWithSameNodeOrder<MeshLib::Hex>(
+                nodes, node_id, element_id);
+        case VTK_VOXEL:
+        {
+            auto** voxel_nodes = new MeshLib::Node*[8];
+            voxel_nodes[0] = nodes[node_id(0)];
+            voxel_nodes[1] = nodes[node_id(1)];
+            voxel_nodes[2] = nodes[node_id(3)];
+            voxel_nodes[3] = nodes[node_id(2)];
+            voxel_nodes[4] = nodes[node_id(4)];
+            voxel_nodes[5] = nodes[node_id(5)];
+            voxel_nodes[6] = nodes[node_id(7)];
+            voxel_nodes[7] = nodes[node_id(6)];
+            return new MeshLib::Hex(voxel_nodes, element_id);
+        }
+        case VTK_PYRAMID:
+            return detail::createElementWithSameNodeOrder<MeshLib::Pyramid>(
+                nodes, node_id, element_id);
+        case VTK_WEDGE:
+        {
+            auto** prism_nodes = new MeshLib::Node*[6];
+            for (unsigned j = 0; j < 3; ++j)
+            {
+                prism_nodes[j] = nodes[node_id(j + 3)];
+                prism_nodes[j + 3] = nodes[node_id(j)];
+            }
+            return new MeshLib::Prism(prism_nodes, element_id);
+        }
+        case VTK_QUADRATIC_EDGE:
+            return detail::createElementWithSameNodeOrder<MeshLib::Line3>(
+                nodes, node_id, element_id);
+        case VTK_QUADRATIC_TRIANGLE:
+            return detail::createElementWithSameNodeOrder<MeshLib::Tri6>(
+                nodes, node_id, element_id);
+        case VTK_QUADRATIC_QUAD:
+            return detail::createElementWithSameNodeOrder<MeshLib::Quad8>(
+                nodes, node_id, element_id);
+        case VTK_BIQUADRATIC_QUAD:
+            return detail::createElementWithSameNodeOrder<MeshLib::Quad9>(
+                nodes, node_id, element_id);
+        case VTK_QUADRATIC_TETRA:
+            return detail::createElementWithSameNodeOrder<MeshLib::Tet10>(
+                nodes, node_id, element_id);
+        case VTK_QUADRATIC_HEXAHEDRON:
+            return detail::createElementWithSameNodeOrder<MeshLib::Hex20>(
+                nodes, node_id, element_id);
+        case VTK_QUADRATIC_PYRAMID:
+            return detail::createElementWithSameNodeOrder<MeshLib::Pyramid13>(
+                nodes, node_id, element_id);
+        case VTK_QUADRATIC_WEDGE:
+        {
+            auto** prism_nodes = new MeshLib::Node*[15];
+            for (unsigned j = 0; j < 3; ++j)
+            {
+                prism_nodes[j] = nodes[node_id(j + 3)];
+                prism_nodes[j + 3] = nodes[node_id(j)];
+            }
+            for (unsigned j = 0; j < 3; ++j)
+            {
+                prism_nodes[6 + j] = nodes[node_id(8 - j)];
+            }
+            prism_nodes[9] = nodes[node_id(12)];
+            prism_nodes[10] = nodes[node_id(14)];
+            prism_nodes[11] = nodes[node_id(13)];
+            for (unsigned j = 0; j < 3; ++j)
+            {
+                prism_nodes[12 + j] = nodes[node_id(11 - j)];
+            }
+            return new MeshLib::Prism15(prism_nodes, element_id);
+        }
+        default:
+            return nullptr;
+    }
+}
+}  // namespace MeshLib
@@ -32,9 +32,11 @@ AngleSkewMetric::AngleSkewMetric(Mesh const& mesh) :
 void AngleSkewMetric::calculateQuality ()
 {
     const std::vector<MeshLib::Element*>& elements(_mesh.getElements());
-    const std::size_t nElements (_mesh.getNumberOfElements());
+    auto const nElements =
+        static_cast<std::ptrdiff_t>(_mesh.getNumberOfElements());
 
-    for (std::size_t k(0); k < nElements; k++)
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < nElements; k++)
     {
         Element const& elem (*elements[k]);
         switch (elem.getGeomType())
@@ -28,8 +28,10 @@ void EdgeRatioMetric::calculateQuality()
 {
     // get all elements of mesh
     const std::vector<MeshLib::Element*>& elements(_mesh.getElements());
-    const std::size_t nElements (_mesh.getNumberOfElements());
-    for (std::size_t k(0); k < nElements; k++)
+    auto const nElements =
+        static_cast<std::ptrdiff_t>(_mesh.getNumberOfElements());
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < nElements; k++)
     {
         Element const& elem (*elements[k]);
         switch (elem.getGeomType())
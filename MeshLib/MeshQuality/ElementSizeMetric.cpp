@@ -14,6 +14,8 @@
 
 #include "ElementSizeMetric.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 namespace MeshLib
@@ -46,39 +48,32 @@ void ElementSizeMetric::calculateQuality()
 std::size_t ElementSizeMetric::calc1dQuality()
 {
     const std::vector<MeshLib::Element*> &elements(_mesh.getElements());
-    const std::size_t nElems(elements.size());
+    auto const nElems = static_cast<std::ptrdiff_t>(elements.size());
     std::size_t error_count(0);
 
-    for (std::size_t k(0); k < nElems; k++)
+#pragma omp parallel for reduction(+ : error_count)
+    for (std::ptrdiff_t k = 0; k < nElems; k++)
     {
-        double area(std::numeric_limits<double>::max());
         _element_quality_metric[k] = elements[k]->getContent();
         if (_element_quality_metric[k] <
             sqrt(fabs(std::numeric_limits<double>::epsilon())))
         {
             error_count++;
         }
-
-        // update _min and _max values
-        if (_min > area)
-        {
-            _min = area;
-        }
-        if (_max < area)
-        {
-            _max = area;
-        }
     }
+
+    updateMinMax(1);
     return error_count;
 }
 
 std::size_t ElementSizeMetric::calc2dQuality()
 {
     const std::vector<MeshLib::Element*> &elements(_mesh.getElements());
-    const std::size_t nElems(elements.size());
+    auto const nElems = static_cast<std::ptrdiff_t>(elements.size());
     std::size_t error_count(0);
 
-    for (std::size_t k(0); k < nElems; k++)
+#pragma omp parallel for reduction(+ : error_count)
+    for (std::ptrdiff_t k = 0; k < nElems; k++)
     {
         Element const& elem (*elements[k]);
 
@@ -92,28 +87,21 @@ std::size_t ElementSizeMetric::calc2dQuality()
         {
             error_count++;
         }
-
-        // update _min and _max values
-        if (_min > area)
-        {
-            _min = area;
-        }
-        if (_max < area)
-        {
-            _max = area;
-        }
         _element_quality_metric[k] = area;
     }
+
+    updateMinMax(2);
     return error_count;
 }
 
 std::size_t ElementSizeMetric::calc3dQuality()
 {
     const std::vector<MeshLib::Element*>& elements(_mesh.getElements());
-    const std::size_t nElems(elements.size());
+    auto const nElems = static_cast<std::ptrdiff_t>(elements.size());
     std::size_t error_count(0);
 
-    for (std::size_t k(0); k < nElems; k++)
+#pragma omp parallel for reduction(+ : error_count)
+    for (std::ptrdiff_t k = 0; k < nElems; k++)
     {
         Element const& elem (*elements[k]);
         if (elem.getDimension()<3)
@@ -127,18 +115,25 @@ std::size_t ElementSizeMetric::calc3dQuality()
         {
             error_count++;
         }
+        _element_quality_metric[k] = volume;
+    }
 
-        if (_min > volume)
-        {
-            _min = volume;
-        }
-        if (_max < volume)
+    updateMinMax(3);
+    return error_count;
+}
+
+void ElementSizeMetric::updateMinMax(unsigned const min_dimension)
+{
+    const std::vector<MeshLib::Element*>& elements(_mesh.getElements());
+    for (std::size_t k(0); k < elements.size(); k++)
+    {
+        if (elements[k]->getDimension() < min_dimension)
         {
-            _max = volume;
+            continue;
         }
-        _element_quality_metric[k] = volume;
+        _min = std::min(_min, _element_quality_metric[k]);
+        _max = std::max(_max, _element_quality_metric[k]);
     }
-    return error_count;
 }
 
 } // end namespace MeshLib
@@ -34,5 +34,9 @@ private:
     std::size_t calc1dQuality();
     std::size_t calc2dQuality();
     std::size_t calc3dQuality();
+
+    /// Updates the minimum and maximum quality values with the values of the
+    /// elements of at least the given dimension.
+    void updateMinMax(unsigned min_dimension);
 };
 }  // namespace MeshLib
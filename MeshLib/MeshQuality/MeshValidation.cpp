@@ -59,13 +59,19 @@ std::vector<ElementErrorCode> MeshValidation::testElementGeometry(const MeshLib:
     std::fill_n(error_count, 4, 0);
     const std::size_t nElements (mesh.getNumberOfElements());
     const std::vector<MeshLib::Element*> &elements (mesh.getElements());
-    std::vector<ElementErrorCode> error_code_vector;
-    error_code_vector.reserve(nElements);
+    std::vector<ElementErrorCode> error_code_vector(nElements);
+
+    // The elements are validated independently of each other.
+    auto const n_elements = static_cast<std::ptrdiff_t>(nElements);
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < n_elements; ++i)
+    {
+        error_code_vector[i] = elements[i]->validate();
+    }
 
     for (std::size_t i=0; i<nElements; ++i)
     {
-        const ElementErrorCode e = elements[i]->validate();
-        error_code_vector.push_back(e);
+        const ElementErrorCode e = error_code_vector[i];
         if (e.none())
         {
             continue;
@@ -158,6 +164,7 @@ unsigned MeshValidation::detectHoles(MeshLib::Mesh const& mesh)
 
     auto boundary_mesh = MeshLib::BoundaryExtraction::getBoundaryElementsAsMesh(
         mesh, "bulk_node_ids", "bulk_element_ids", "bulk_face_ids");
+    boundary_mesh->computeElementNeighbors();
     std::vector<MeshLib::Element*> const& elements(
         boundary_mesh->getElements());
 
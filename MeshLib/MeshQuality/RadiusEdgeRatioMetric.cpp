@@ -27,8 +27,10 @@ RadiusEdgeRatioMetric::RadiusEdgeRatioMetric(Mesh const& mesh)
 void RadiusEdgeRatioMetric::calculateQuality ()
 {
     std::vector<MeshLib::Element*> const& elements(_mesh.getElements());
-    std::size_t const nElements (_mesh.getNumberOfElements());
-    for (std::size_t k(0); k < nElements; k++)
+    auto const nElements =
+        static_cast<std::ptrdiff_t>(_mesh.getNumberOfElements());
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < nElements; k++)
     {
         Element const& elem (*elements[k]);
         std::size_t const n_nodes (elem.getNumberOfBaseNodes());
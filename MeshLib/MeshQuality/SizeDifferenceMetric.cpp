@@ -26,10 +26,13 @@ ElementQualityMetric(mesh)
 void SizeDifferenceMetric::calculateQuality()
 {
     std::vector<MeshLib::Element*> const& elements(_mesh.getElements());
-    std::size_t const nElements (_mesh.getNumberOfElements());
+    auto const nElements =
+        static_cast<std::ptrdiff_t>(_mesh.getNumberOfElements());
     std::size_t const mesh_dim (_mesh.getDimension());
+    _mesh.computeElementNeighbors();
 
-    for (std::size_t k=0; k < nElements; ++k)
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < nElements; k++)
     {
         Element const& elem (*elements[k]);
         if (elem.getDimension() < mesh_dim)
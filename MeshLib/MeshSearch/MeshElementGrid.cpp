@@ -195,6 +195,10 @@ MeshElementGrid::getGridCellCoordinates(MathLib::Point3d const& p) const
         } else if (_aabb.getMaxPoint()[k] <= p[k]) {
             valid = false;
             coords[k] = _n_steps[k]-1;
+        } else if (_n_steps[k] == 1) {
+            // The extent of a flat mesh in this direction is the smallest
+            // double, hence its inverse step size is infinite.
+            coords[k] = 0;
         } else {
             coords[k] = static_cast<std::size_t>(d * _inverse_step_sizes[k]);
         }
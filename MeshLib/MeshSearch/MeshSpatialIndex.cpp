@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MeshSpatialIndex.h"
+
+#include <algorithm>
+
+#include <logog/include/logog.hpp>
+
+#include "MeshLib/Mesh.h"
+
+namespace MeshLib
+{
+std::vector<std::unique_ptr<MeshSpatialIndex>>
+    MeshSpatialIndex::_mesh_spatial_indices;
+
+MeshSpatialIndex::MeshSpatialIndex(Mesh const& mesh)
+    : _mesh(mesh), _node_grid(mesh.getNodes().cbegin(), mesh.getNodes().cend())
+{
+    DBUG("Built the spatial index of the nodes of mesh '%s'.",
+         mesh.getName().c_str());
+}
+
+MeshElementGrid const& MeshSpatialIndex::getElementGrid() const
+{
+    if (!_element_grid)
+    {
+        _element_grid = std::make_unique<MeshElementGrid>(_mesh);
+        DBUG("Built the spatial index of the elements of mesh '%s'.",
+             _mesh.getName().c_str());
+    }
+    return *_element_grid;
+}
+
+std::vector<std::size_t> MeshSpatialIndex::getNodeIDsInCuboid(
+    MathLib::Point3d const& min_pnt, MathLib::Point3d const& max_pnt) const
+{
+    std::vector<std::vector<Node*> const*> cells;
+    _node_grid.getPntVecsOfGridCellsIntersectingCuboid(min_pnt, max_pnt,
+                                                       cells);
+
+    std::vector<std::size_t> node_ids;
+    for (auto const* cell : cells)
+    {
+        for (auto const* node : *cell)
+        {
+            node_ids.push_back(node->getID());
+        }
+    }
+    // Each node is in exactly one grid cell.
+    std::sort(node_ids.begin(), node_ids.end());
+    return node_ids;
+}
+
+MeshSpatialIndex const& MeshSpatialIndex::getMeshSpatialIndex(
+    Mesh const& mesh)
+{
+    std::size_t const mesh_id = mesh.getID();
+    if (_mesh_spatial_indices.size() < mesh_id + 1)
+    {
+        _mesh_spatial_indices.resize(mesh_id + 1);
+    }
+
+    if (!_mesh_spatial_indices[mesh_id])
+    {
+        _mesh_spatial_indices[mesh_id] =
+            std::make_unique<MeshSpatialIndex>(mesh);
+    }
+    return *_mesh_spatial_indices[mesh_id];
+}
+}  // namespace MeshLib
@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "GeoLib/Grid.h"
+#include "MathLib/Point3d.h"
+#include "MeshLib/MeshSearch/MeshElementGrid.h"
+#include "MeshLib/Node.h"
+
+namespace MeshLib
+{
+class Mesh;
+
+/// Spatial search structures of a mesh, i.e. a grid of the mesh nodes and a
+/// grid of the mesh elements, built once per mesh and shared by all searches
+/// on that mesh.
+///
+/// The node grid is built on construction, the element grid on the first
+/// request.
+/// @attention It is assumed that the mesh does not change its geometry while
+/// the index lives.
+class MeshSpatialIndex final
+{
+public:
+    explicit MeshSpatialIndex(Mesh const& mesh);
+
+    Mesh const& getMesh() const { return _mesh; }
+
+    GeoLib::Grid<Node> const& getNodeGrid() const { return _node_grid; }
+
+    MeshElementGrid const& getElementGrid() const;
+
+    /// Returns the ids of the nodes of all grid cells intersecting the axis
+    /// aligned cuboid given by the min and max points. The ids are sorted and
+    /// unique. The nodes are a superset of the nodes within the cuboid.
+    std::vector<std::size_t> getNodeIDsInCuboid(
+        MathLib::Point3d const& min_pnt, MathLib::Point3d const& max_pnt) const;
+
+    /**
+     * Returns a (possibly new) spatial index for the mesh.
+     * A new one will be created, if it does not already exists.
+     */
+    static MeshSpatialIndex const& getMeshSpatialIndex(Mesh const& mesh);
+
+private:
+    Mesh const& _mesh;
+    GeoLib::Grid<Node> const _node_grid;
+    mutable std::unique_ptr<MeshElementGrid> _element_grid;
+
+    /// Spatial indices for the meshes indexed by the meshs' ids.
+    static std::vector<std::unique_ptr<MeshSpatialIndex>>
+        _mesh_spatial_indices;
+};
+}  // namespace MeshLib
@@ -92,6 +92,7 @@ std::size_t NodeSearch::searchBoundaryNodes()
     }
     else if (_mesh.getDimension() == 2)
     {
+        _mesh.computeElementNeighbors();
         for (MeshLib::Element const* elem : _mesh.getElements())
         {
             if (elem->getDimension() < _mesh.getDimension())
@@ -120,6 +121,7 @@ std::size_t NodeSearch::searchBoundaryNodes()
     }
     else
     {
+        _mesh.computeElementNeighbors();
         for (MeshLib::Element const* elem : _mesh.getElements())
         {
             if (elem->getDimension() < _mesh.getDimension())
@@ -17,6 +17,7 @@
 #include <boost/math/constants/constants.hpp>
 #include <logog/include/logog.hpp>
 #include <memory>
+#include <numeric>
 
 #include "MeshLib/Elements/Line.h"
 #include "MeshLib/Elements/Point.h"
@@ -205,6 +206,7 @@ MeshLib::Mesh* MeshSurfaceExtraction::getMeshSurface(
     }
 
     INFO("Extracting mesh surface...");
+    subsfc_mesh.computeElementNeighbors();
     std::vector<MeshLib::Element*> sfc_elements;
     std::vector<std::size_t> element_ids_map;
     std::vector<std::size_t> face_ids_map;
@@ -263,15 +265,48 @@ void MeshSurfaceExtraction::get2DSurfaceElements(
     double const cos_theta(std::cos(angle * pi / 180.0));
     MathLib::Vector3 const norm_dir(dir.getNormalizedVector());
 
-    for (auto const* elem : all_elements)
+    // The candidates are the 2d elements themselves and the faces of the 3d
+    // elements without neighbour. They are counted first, such that they can
+    // be created in parallel in the order of the elements.
+    auto const n_elements = static_cast<std::ptrdiff_t>(all_elements.size());
+    std::vector<std::size_t> offsets(all_elements.size() + 1, 0);
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < n_elements; ++i)
     {
-        const unsigned element_dimension(elem->getDimension());
+        auto const& elem = *all_elements[i];
+        const unsigned element_dimension(elem.getDimension());
         if (element_dimension < mesh_dimension)
         {
             continue;
         }
-
         if (element_dimension == 2)
+        {
+            offsets[i + 1] = 1;
+            continue;
+        }
+        const unsigned nFaces(elem.getNumberOfFaces());
+        for (unsigned j = 0; j < nFaces; ++j)
+        {
+            if (elem.getNeighbor(j) == nullptr)
+            {
+                offsets[i + 1]++;
+            }
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    // Candidates not facing the given direction remain nullptr.
+    std::vector<MeshLib::Element*> candidates(offsets.back(), nullptr);
+    std::vector<unsigned> candidate_face_ids(offsets.back(), 0);
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < n_elements; ++i)
+    {
+        if (offsets[i] == offsets[i + 1])
+        {
+            continue;
+        }
+        auto const* elem = all_elements[i];
+        if (elem->getDimension() == 2)
         {
             if (!complete_surface)
             {
@@ -283,49 +318,57 @@ void MeshSurfaceExtraction::get2DSurfaceElements(
                     continue;
                 }
             }
-            sfc_elements.push_back(elem->clone());
-            element_to_bulk_element_id_map.push_back(elem->getID());
-            element_to_bulk_face_id_map.push_back(0);
+            candidates[offsets[i]] = elem->clone();
+            continue;
         }
-        else
+
+        std::size_t k = offsets[i];
+        const unsigned nFaces(elem->getNumberOfFaces());
+        for (unsigned j = 0; j < nFaces; ++j)
         {
-            if (!elem->isBoundaryElement())
+            if (elem->getNeighbor(j) != nullptr)
             {
                 continue;
             }
-            const unsigned nFaces(elem->getNumberOfFaces());
-            for (unsigned j = 0; j < nFaces; ++j)
+            auto const candidate = k++;
+
+            auto const face =
+                std::unique_ptr<MeshLib::Element const>{elem->getFace(j)};
+            if (!complete_surface)
             {
-                if (elem->getNeighbor(j) != nullptr)
+                if (MathLib::scalarProduct(
+                        FaceRule::getSurfaceNormal(face.get())
+                            .getNormalizedVector(),
+                        norm_dir) < cos_theta)
                 {
                     continue;
                 }
+            }
+            if (face->getGeomType() == MeshElemType::TRIANGLE)
+            {
+                candidates[candidate] = new MeshLib::Tri(
+                    *static_cast<const MeshLib::Tri*>(face.get()));
+            }
+            else
+            {
+                candidates[candidate] = new MeshLib::Quad(
+                    *static_cast<const MeshLib::Quad*>(face.get()));
+            }
+            candidate_face_ids[candidate] = j;
+        }
+    }
 
-                auto const face =
-                    std::unique_ptr<MeshLib::Element const>{elem->getFace(j)};
-                if (!complete_surface)
-                {
-                    if (MathLib::scalarProduct(
-                            FaceRule::getSurfaceNormal(face.get())
-                                .getNormalizedVector(),
-                            norm_dir) < cos_theta)
-                    {
-                        continue;
-                    }
-                }
-                if (face->getGeomType() == MeshElemType::TRIANGLE)
-                {
-                    sfc_elements.push_back(new MeshLib::Tri(
-                        *static_cast<const MeshLib::Tri*>(face.get())));
-                }
-                else
-                {
-                    sfc_elements.push_back(new MeshLib::Quad(
-                        *static_cast<const MeshLib::Quad*>(face.get())));
-                }
-                element_to_bulk_element_id_map.push_back(elem->getID());
-                element_to_bulk_face_id_map.push_back(j);
+    for (std::size_t i = 0; i < all_elements.size(); ++i)
+    {
+        for (std::size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            if (candidates[k] == nullptr)
+            {
+                continue;
             }
+            sfc_elements.push_back(candidates[k]);
+            element_to_bulk_element_id_map.push_back(all_elements[i]->getID());
+            element_to_bulk_face_id_map.push_back(candidate_face_ids[k]);
         }
     }
 }
@@ -334,6 +377,7 @@ std::vector<MeshLib::Node*> MeshSurfaceExtraction::getSurfaceNodes(
     const MeshLib::Mesh& mesh, const MathLib::Vector3& dir, double angle)
 {
     INFO("Extracting surface nodes...");
+    mesh.computeElementNeighbors();
     std::vector<MeshLib::Element*> sfc_elements;
     std::vector<std::size_t> element_to_bulk_element_id_map;
     std::vector<std::size_t> element_to_bulk_face_id_map;
@@ -353,53 +397,64 @@ std::vector<MeshLib::Node*> MeshSurfaceExtraction::getSurfaceNodes(
     return surface_nodes;
 }
 
-void createSurfaceElementsFromElement(
-    MeshLib::Element const& surface_element,
-    std::vector<MeshLib::Element*>& surface_elements,
-    std::vector<std::size_t>& element_to_bulk_element_id_map,
-    std::vector<std::size_t>& element_to_bulk_face_id_map)
-{
-    const unsigned n_faces(surface_element.getNumberOfBoundaries());
-    for (unsigned j = 0; j < n_faces; ++j)
-    {
-        if (surface_element.getNeighbor(j) != nullptr)
-        {
-            continue;
-        }
-
-        surface_elements.push_back(
-            const_cast<MeshLib::Element*>(surface_element.getBoundary(j)));
-        element_to_bulk_face_id_map.push_back(j);
-        element_to_bulk_element_id_map.push_back(surface_element.getID());
-    }
-}
-
 std::tuple<std::vector<MeshLib::Element*>, std::vector<std::size_t>,
            std::vector<std::size_t>>
 createBoundaryElements(MeshLib::Mesh const& bulk_mesh)
 {
-    std::vector<std::size_t> element_to_bulk_element_id_map;
-    std::vector<std::size_t> element_to_bulk_face_id_map;
-    std::vector<MeshLib::Element*> surface_elements;
-
+    bulk_mesh.computeElementNeighbors();
     auto const& bulk_elements = bulk_mesh.getElements();
     auto const mesh_dimension = bulk_mesh.getDimension();
 
-    for (auto const* elem : bulk_elements)
+    // Count the boundaries without neighbour of each element first, such that
+    // the boundary elements can be created in parallel in the order of the
+    // bulk elements.
+    auto const n_bulk_elements =
+        static_cast<std::ptrdiff_t>(bulk_elements.size());
+    std::vector<std::size_t> offsets(bulk_elements.size() + 1, 0);
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < n_bulk_elements; ++i)
     {
-        const unsigned element_dimension(elem->getDimension());
-        if (element_dimension < mesh_dimension)
+        auto const& elem = *bulk_elements[i];
+        if (elem.getDimension() < mesh_dimension)
         {
             continue;
         }
+        const unsigned n_faces(elem.getNumberOfBoundaries());
+        for (unsigned j = 0; j < n_faces; ++j)
+        {
+            if (elem.getNeighbor(j) == nullptr)
+            {
+                offsets[i + 1]++;
+            }
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
 
-        if (!elem->isBoundaryElement())
+    std::vector<MeshLib::Element*> surface_elements(offsets.back());
+    std::vector<std::size_t> element_to_bulk_element_id_map(offsets.back());
+    std::vector<std::size_t> element_to_bulk_face_id_map(offsets.back());
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < n_bulk_elements; ++i)
+    {
+        if (offsets[i] == offsets[i + 1])
         {
             continue;
         }
-        createSurfaceElementsFromElement(*elem, surface_elements,
-                                         element_to_bulk_element_id_map,
-                                         element_to_bulk_face_id_map);
+        auto const& elem = *bulk_elements[i];
+        std::size_t k = offsets[i];
+        const unsigned n_faces(elem.getNumberOfBoundaries());
+        for (unsigned j = 0; j < n_faces; ++j)
+        {
+            if (elem.getNeighbor(j) != nullptr)
+            {
+                continue;
+            }
+            surface_elements[k] =
+                const_cast<MeshLib::Element*>(elem.getBoundary(j));
+            element_to_bulk_face_id_map[k] = j;
+            element_to_bulk_element_id_map[k] = elem.getID();
+            ++k;
+        }
     }
     return {surface_elements, element_to_bulk_element_id_map,
             element_to_bulk_face_id_map};
@@ -58,6 +58,7 @@ public:
     Node(const Node &node);
 
     /// Return all the nodes connected to this one
+    /// \pre Mesh::computeNodesConnectedByElements() has been called.
     const std::vector<MeshLib::Node*>& getConnectedNodes() const { return _connected_nodes; }
 
     /// Get an element the node is part of.
@@ -90,7 +91,7 @@ protected:
     void clearElements() { _elements.clear(); }
 
     /// Resets the connected nodes of this node. The connected nodes are
-    /// generated by Mesh::setNodesConnectedByElements().
+    /// generated by Mesh::computeNodesConnectedByElements().
     void setConnectedNodes(std::vector<Node*> &connected_nodes)
     {
         _connected_nodes = connected_nodes;
@@ -0,0 +1,101 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "NodeAdjacencyTable.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "Elements/Element.h"
+#include "Mesh.h"
+#include "Node.h"
+
+namespace
+{
+/// Collects the sorted and unique ids of the nodes of all elements containing
+/// the given node into \c ids.
+void collectAdjacentNodes(MeshLib::Node const& node,
+                          std::vector<std::size_t>& ids)
+{
+    ids.clear();
+    for (auto const* const element : node.getElements())
+    {
+        auto const n_nodes = element->getNumberOfNodes();
+        for (unsigned i = 0; i < n_nodes; ++i)
+        {
+            ids.push_back(element->getNodeIndex(i));
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+}  // namespace
+
+namespace MeshLib
+{
+NodeAdjacencyTable::NodeAdjacencyTable(std::vector<Node*> const& nodes)
+{
+    createTable(nodes);
+}
+
+NodeAdjacencyTable::NodeAdjacencyTable(Mesh const& mesh)
+{
+    auto const& nodes = mesh.getNodes();
+    auto const n_nodes = static_cast<std::ptrdiff_t>(nodes.size());
+
+    // Count the adjacent nodes, then fill the rows. Both passes collect the
+    // element nodes of each node in a thread-local buffer.
+    _offsets.assign(n_nodes + 1, 0);
+#pragma omp parallel
+    {
+        std::vector<std::size_t> ids;
+#pragma omp for
+        for (std::ptrdiff_t n = 0; n < n_nodes; ++n)
+        {
+            collectAdjacentNodes(*nodes[n], ids);
+            _offsets[n + 1] = ids.size();
+        }
+    }
+    std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+
+    _adjacent_nodes.resize(_offsets.back());
+#pragma omp parallel
+    {
+        std::vector<std::size_t> ids;
+#pragma omp for
+        for (std::ptrdiff_t n = 0; n < n_nodes; ++n)
+        {
+            collectAdjacentNodes(*nodes[n], ids);
+            std::copy(ids.begin(), ids.end(),
+                      _adjacent_nodes.begin() + _offsets[n]);
+        }
+    }
+}
+
+void NodeAdjacencyTable::createTable(std::vector<Node*> const& nodes)
+{
+    _offsets.assign(nodes.size() + 1, 0);
+    for (auto const* const n_ptr : nodes)
+    {
+        _offsets[n_ptr->getID() + 1] = n_ptr->getConnectedNodes().size();
+    }
+    std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+
+    _adjacent_nodes.resize(_offsets.back());
+    for (auto const* const n_ptr : nodes)
+    {
+        std::vector<Node*> const& connected_nodes = n_ptr->getConnectedNodes();
+        std::transform(connected_nodes.cbegin(), connected_nodes.cend(),
+                       _adjacent_nodes.begin() + _offsets[n_ptr->getID()],
+                       [](Node const* const n) { return n->getID(); });
+    }
+}
+
+}   // namespace MeshLib
@@ -10,14 +10,14 @@
 
 #pragma once
 
-#include <algorithm>
 #include <vector>
 
-#include "Node.h"
-
+#include "BaseLib/Range.h"
 
 namespace MeshLib
 {
+class Mesh;
+class Node;
 
 /// Representation of topological node adjacency.
 ///
@@ -26,60 +26,49 @@ namespace MeshLib
 /// adjacent if and only if there is a mesh element E including nodes i and j.
 /// This information is represented by the NodeAdjacenceTable.
 ///
-/// The topological adjacency of nodes is created by
-/// Mesh::setNodesConnectedByElements() which is usually called upon mesh
-/// construction.
-class
-NodeAdjacencyTable
+/// The adjacent nodes are stored in compressed rows, i.e. the ids of the
+/// adjacent nodes of all nodes are contiguous in one array, sorted by the id
+/// within each row. A node is adjacent to itself.
+///
+/// The table of a mesh is computed once on demand by
+/// Mesh::getNodeAdjacencyTable() and shared by its users, e.g. the sparsity
+/// pattern and the node reordering.
+class NodeAdjacencyTable
 {
-
 public:
     NodeAdjacencyTable() = default;
 
-    explicit
-    NodeAdjacencyTable(std::vector<Node*> const& nodes)
-    {
-        _data.resize(nodes.size());
+    /// Creates the table from the topological adjacency of the nodes, which
+    /// is created by Mesh::computeNodesConnectedByElements(), which has to be
+    /// called before.
+    explicit NodeAdjacencyTable(std::vector<Node*> const& nodes);
 
-        createTable(nodes);
-    }
+    /// Creates the table directly from the element-node connectivity of the
+    /// mesh. The rows are computed in parallel.
+    explicit NodeAdjacencyTable(Mesh const& mesh);
 
-    std::size_t size() const
-    {
-        return _data.size();
-    }
+    std::size_t size() const { return _offsets.size() - 1; }
 
     std::size_t getNodeDegree(std::size_t const node_id) const
     {
-        return _data[node_id].size();
+        return _offsets[node_id + 1] - _offsets[node_id];
     }
 
-    std::vector<std::size_t> const& getAdjacentNodes(std::size_t const node_id) const
+    BaseLib::Range<std::size_t const*> getAdjacentNodes(
+        std::size_t const node_id) const
     {
-        return _data[node_id];
+        return BaseLib::Range<std::size_t const*>(
+            _adjacent_nodes.data() + _offsets[node_id],
+            _adjacent_nodes.data() + _offsets[node_id + 1]);
     }
 
-    void createTable(std::vector<Node*> const& nodes)
-    {
-        if (_data.size() != nodes.size())
-        {
-            _data.resize(nodes.size());
-        }
-
-        for (auto n_ptr : nodes)
-        {
-            std::vector<Node*> const& connected_nodes = n_ptr->getConnectedNodes();
-            std::vector<std::size_t>& row = _data[n_ptr->getID()];
-            row.reserve(connected_nodes.size());
-            std::transform(connected_nodes.cbegin(), connected_nodes.cend(),
-                std::back_inserter(row),
-                [](Node const* const n) { return n->getID(); });
-        }
-    }
+    void createTable(std::vector<Node*> const& nodes);
 
 private:
-    std::vector<std::vector<std::size_t>> _data;
-
+    /// Offsets into \c _adjacent_nodes for each node, with a final entry equal
+    /// to the number of adjacencies.
+    std::vector<std::size_t> _offsets = {0};
+    std::vector<std::size_t> _adjacent_nodes;
 };
 
 }   // namespace MeshLib
@@ -21,6 +21,7 @@
 
 #include "Mesh.h"
 #include "Node.h"
+#include "NodeAdjacencyTable.h"
 
 namespace MeshLib
 {
@@ -141,14 +142,14 @@ public:
     /// Get the maximum number of connected nodes to node.
     std::size_t getMaximumNConnectedNodesToNode() const
     {
-        std::vector<Node*>::const_iterator it_max_ncn = std::max_element(
-            _nodes.cbegin(), _nodes.cend(),
-            [](Node const* const node_a, Node const* const node_b) {
-                return (node_a->getConnectedNodes().size() <
-                        node_b->getConnectedNodes().size());
-            });
+        auto const& adjacency = getNodeAdjacencyTable();
+        std::size_t max_degree = 0;
+        for (std::size_t i = 0; i < adjacency.size(); ++i)
+        {
+            max_degree = std::max(max_degree, adjacency.getNodeDegree(i));
+        }
         // Return the number of connected nodes +1 for the node itself.
-        return (*it_max_ncn)->getConnectedNodes().size() + 1;
+        return max_degree + 1;
     }
 
     bool isForSingleThread() const { return _is_single_thread; }
@@ -85,65 +85,21 @@ int VtkMappedMeshSource::RequestData(vtkInformation* /*request*/,
     output->SetPoints(this->Points.GetPointer());
 
     // Cells
-    auto elems = _mesh->getElements();
-    output->Allocate(elems.size());
-    for (auto& cell : elems)
+    if (_cells_mesh != _mesh)
     {
-        auto cellType = OGSToVtkCellType(cell->getCellType());
-
-        const MeshLib::Element* const elem = cell;
-        const unsigned numNodes(elem->getNumberOfNodes());
-        const MeshLib::Node* const* nodes = cell->getNodes();
-        vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
-        ptIds->SetNumberOfIds(numNodes);
-
-        for (unsigned i = 0; i < numNodes; ++i)
-        {
-            ptIds->SetId(i, nodes[i]->getID());
-        }
-
-        if (cellType == VTK_WEDGE)
-        {
-            for (unsigned i = 0; i < 3; ++i)
-            {
-                const auto prism_swap_id = ptIds->GetId(i);
-                ptIds->SetId(i, ptIds->GetId(i + 3));
-                ptIds->SetId(i + 3, prism_swap_id);
-            }
-        }
-        else if (cellType == VTK_QUADRATIC_WEDGE)
-        {
-            std::array<vtkIdType, 15> ogs_nodeIds;
-            for (unsigned i = 0; i < 15; ++i)
-            {
-                ogs_nodeIds[i] = ptIds->GetId(i);
-            }
-            for (unsigned i = 0; i < 3; ++i)
-            {
-                ptIds->SetId(i, ogs_nodeIds[i + 3]);
-                ptIds->SetId(i + 3, ogs_nodeIds[i]);
-            }
-            for (unsigned i = 0; i < 3; ++i)
-            {
-                ptIds->SetId(6 + i, ogs_nodeIds[8 - i]);
-            }
-            for (unsigned i = 0; i < 3; ++i)
-            {
-                ptIds->SetId(9 + i, ogs_nodeIds[14 - i]);
-            }
-            ptIds->SetId(12, ogs_nodeIds[9]);
-            ptIds->SetId(13, ogs_nodeIds[11]);
-            ptIds->SetId(14, ogs_nodeIds[10]);
-        }
-
-        output->InsertNextCell(cellType, ptIds);
+        buildCells();
     }
+    output->SetCells(this->CellTypes.GetPointer(),
+                     this->CellLocations.GetPointer(), this->Cells.GetPointer());
 
     // Arrays
     MeshLib::Properties const& properties = _mesh->getProperties();
     std::vector<std::string> const& propertyNames =
         properties.getPropertyVectorNames();
 
+    this->PointData->Initialize();
+    this->CellData->Initialize();
+    this->FieldData->Initialize();
     for (auto const& name : propertyNames)
     {
         if (addProperty<double>(properties, name))
@@ -200,6 +156,72 @@ int VtkMappedMeshSource::RequestInformation(
     return 1;
 }
 
+void VtkMappedMeshSource::buildCells()
+{
+    auto elems = _mesh->getElements();
+    this->CellTypes->Reset();
+    this->CellTypes->Allocate(elems.size());
+    this->CellLocations->Reset();
+    this->CellLocations->Allocate(elems.size());
+    this->Cells->Reset();
+    for (auto& cell : elems)
+    {
+        auto cellType = OGSToVtkCellType(cell->getCellType());
+
+        const MeshLib::Element* const elem = cell;
+        const unsigned numNodes(elem->getNumberOfNodes());
+        const MeshLib::Node* const* nodes = cell->getNodes();
+        vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
+        ptIds->SetNumberOfIds(numNodes);
+
+        for (unsigned i = 0; i < numNodes; ++i)
+        {
+            ptIds->SetId(i, nodes[i]->getID());
+        }
+
+        if (cellType == VTK_WEDGE)
+        {
+            for (unsigned i = 0; i < 3; ++i)
+            {
+                const auto prism_swap_id = ptIds->GetId(i);
+                ptIds->SetId(i, ptIds->GetId(i + 3));
+                ptIds->SetId(i + 3, prism_swap_id);
+            }
+        }
+        else if (cellType == VTK_QUADRATIC_WEDGE)
+        {
+            std::array<vtkIdType, 15> ogs_nodeIds;
+            for (unsigned i = 0; i < 15; ++i)
+            {
+                ogs_nodeIds[i] = ptIds->GetId(i);
+            }
+            for (unsigned i = 0; i < 3; ++i)
+            {
+                ptIds->SetId(i, ogs_nodeIds[i + 3]);
+                ptIds->SetId(i + 3, ogs_nodeIds[i]);
+            }
+            for (unsigned i = 0; i < 3; ++i)
+            {
+                ptIds->SetId(6 + i, ogs_nodeIds[8 - i]);
+            }
+            for (unsigned i = 0; i < 3; ++i)
+            {
+                ptIds->SetId(9 + i, ogs_nodeIds[14 - i]);
+            }
+            ptIds->SetId(12, ogs_nodeIds[9]);
+            ptIds->SetId(13, ogs_nodeIds[11]);
+            ptIds->SetId(14, ogs_nodeIds[10]);
+        }
+
+        this->CellTypes->InsertNextValue(static_cast<unsigned char>(cellType));
+        this->CellLocations->InsertNextValue(
+            this->Cells->GetNumberOfConnectivityEntries());
+        this->Cells->InsertNextCell(ptIds);
+    }
+
+    _cells_mesh = _mesh;
+}
+
 template <typename T>
 bool VtkMappedMeshSource::addProperty(MeshLib::Properties const& properties,
                                       std::string const& prop_name) const
@@ -23,12 +23,15 @@
 #include <string>
 
 #include <vtkAOSDataArrayTemplate.h>
+#include <vtkCellArray.h>
 #include <vtkCellData.h>
 #include <vtkFieldData.h>
+#include <vtkIdTypeArray.h>
 #include <vtkNew.h>
 #include <vtkPointData.h>
 #include <vtkUnstructuredGrid.h>
 #include <vtkUnstructuredGridAlgorithm.h>
+#include <vtkUnsignedCharArray.h>
 
 #include "MeshLib/Properties.h"
 #include "MeshLib/PropertyVector.h"
@@ -41,6 +44,11 @@ class Mesh;
 
 /// Adapter which maps a MeshLib::Mesh to a vtkUnstructuredGridAlgorithm.
 /// Allows for zero-copy access of the mesh from the visualization side.
+///
+/// The cells are built on the first update only and are reused by the
+/// following updates of the same mesh, which only map the current property
+/// vectors. Therefore a source can be kept and updated repeatedly, e.g. for
+/// each time step.
 class VtkMappedMeshSource final : public vtkUnstructuredGridAlgorithm
 {
 public:
@@ -51,7 +59,8 @@ public:
     VtkMappedMeshSource(const VtkMappedMeshSource&) = delete;
     void operator=(const VtkMappedMeshSource&) = delete;
 
-    /// Sets the mesh. Calling is mandatory
+    /// Sets the mesh. Calling is mandatory. The elements of the mesh must not
+    /// change as long as the mesh is set, because the cells are reused.
     void SetMesh(const MeshLib::Mesh* mesh)
     {
         this->_mesh = mesh;
@@ -82,7 +91,12 @@ private:
     bool addProperty(MeshLib::Properties const& properties,
                      std::string const& prop_name) const;
 
+    /// Converts the elements of the mesh into the VTK cell arrays.
+    void buildCells();
+
     const MeshLib::Mesh* _mesh;
+    /// The mesh the cell arrays were built for.
+    const MeshLib::Mesh* _cells_mesh = nullptr;
 
     int NumberOfDimensions{0};
     int NumberOfNodes{0};
@@ -91,6 +105,9 @@ private:
     vtkNew<vtkPointData> PointData;
     vtkNew<vtkCellData> CellData;
     vtkNew<vtkFieldData> FieldData;
+    vtkNew<vtkUnsignedCharArray> CellTypes;
+    vtkNew<vtkIdTypeArray> CellLocations;
+    vtkNew<vtkCellArray> Cells;
 };
 
 } // Namespace MeshLib
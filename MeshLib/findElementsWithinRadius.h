@@ -29,6 +29,9 @@ namespace MeshLib
 /// (an edge or a face) but not the nodes falls inside the search radius.
 ///
 /// \note For radius 0 only the given element's id is returned.
+///
+/// \pre Mesh::computeElementNeighbors() has been called for the element's
+/// mesh.
 std::vector<std::size_t> findElementsWithinRadius(Element const& start_element,
                                                   double const radius_squared);
 
@@ -0,0 +1,72 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "AssemblyOrder.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+
+#include "MathLib/HilbertCurve.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace NumLib
+{
+std::vector<std::size_t> computeAssemblyOrder(MeshLib::Mesh const& mesh)
+{
+    auto const& elements = mesh.getElements();
+    auto const n_elements = elements.size();
+
+    std::vector<MathLib::Point3d> centers;
+    centers.reserve(n_elements);
+    for (auto const* element : elements)
+    {
+        centers.emplace_back(element->getCenterOfGravity());
+    }
+    auto const hilbert_positions =
+        MathLib::computeHilbertCurvePositions(centers);
+
+    auto const* const material_ids = MeshLib::materialIDs(mesh);
+    auto const key = [&](std::size_t const e) {
+        return std::make_tuple(
+            elements[e]->getCellType(),
+            material_ids == nullptr ? 0 : (*material_ids)[e],
+            hilbert_positions[e], e);
+    };
+
+    std::vector<std::size_t> order(n_elements);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](std::size_t const a, std::size_t const b) {
+                  return key(a) < key(b);
+              });
+    return order;
+}
+
+void sortByAssemblyOrder(std::vector<std::vector<std::size_t>>& groups,
+                         std::vector<std::size_t> const& assembly_order)
+{
+    std::vector<std::size_t> rank(assembly_order.size());
+    for (std::size_t i = 0; i < assembly_order.size(); ++i)
+    {
+        rank[assembly_order[i]] = i;
+    }
+
+    for (auto& group : groups)
+    {
+        std::sort(group.begin(), group.end(),
+                  [&](std::size_t const a, std::size_t const b) {
+                      return rank[a] < rank[b];
+                  });
+    }
+}
+}  // namespace NumLib
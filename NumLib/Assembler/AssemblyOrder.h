@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace NumLib
+{
+/**
+ * Computes an order of the mesh elements for the element loops of the global
+ * assembly. The elements are sorted by their cell type, then by their
+ * material id, and finally along a Hilbert curve through their centers.
+ *
+ * Consecutively assembled elements then mostly share the local assembler
+ * type and the material models, and their nodes are close in memory, which
+ * improves the reuse of the instruction and data caches.
+ *
+ * \return a permutation of the element ids.
+ */
+std::vector<std::size_t> computeAssemblyOrder(MeshLib::Mesh const& mesh);
+
+/// Sorts the element ids of each of the given groups, e.g. of the colors of an
+/// NumLib::ElementColoring, according to the given \c assembly_order.
+void sortByAssemblyOrder(std::vector<std::vector<std::size_t>>& groups,
+                         std::vector<std::size_t> const& assembly_order);
+}  // namespace NumLib
@@ -0,0 +1,88 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "ElementColoring.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+
+namespace NumLib
+{
+ElementColoring computeElementColoring(MeshLib::Mesh const& mesh)
+{
+    auto const& elements = mesh.getElements();
+    auto const n_elements = elements.size();
+
+    constexpr int no_color = -1;
+    std::vector<int> element_colors(n_elements, no_color);
+
+    // The colors are assigned in rounds of 64 colors each; the colors used at
+    // a node in the current round are stored as bits.
+    using ColorMask = std::uint64_t;
+    constexpr int colors_per_round = std::numeric_limits<ColorMask>::digits;
+    std::vector<ColorMask> node_colors(mesh.getNumberOfNodes());
+
+    int n_colors = 0;
+    for (std::size_t n_uncolored = n_elements; n_uncolored > 0;
+         n_colors += colors_per_round)
+    {
+        std::fill(node_colors.begin(), node_colors.end(), ColorMask{0});
+
+        for (std::size_t e = 0; e < n_elements; ++e)
+        {
+            if (element_colors[e] != no_color)
+            {
+                continue;
+            }
+
+            auto const& element = *elements[e];
+            auto const n_nodes = element.getNumberOfNodes();
+
+            ColorMask used_colors = 0;
+            for (unsigned i = 0; i < n_nodes; ++i)
+            {
+                used_colors |= node_colors[element.getNodeIndex(i)];
+            }
+            if (used_colors == std::numeric_limits<ColorMask>::max())
+            {
+                // All colors of this round are used by neighbors.
+                continue;
+            }
+
+            int color = 0;
+            while ((used_colors >> color) & 1u)
+            {
+                ++color;
+            }
+
+            for (unsigned i = 0; i < n_nodes; ++i)
+            {
+                node_colors[element.getNodeIndex(i)] |= ColorMask{1} << color;
+            }
+            element_colors[e] = n_colors + color;
+            --n_uncolored;
+        }
+    }
+
+    ElementColoring coloring(
+        n_elements == 0
+            ? 0
+            : *std::max_element(element_colors.begin(), element_colors.end()) +
+                  1);
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        coloring[element_colors[e]].push_back(e);
+    }
+    return coloring;
+}
+}  // namespace NumLib
@@ -0,0 +1,38 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace NumLib
+{
+/// Element ids grouped by color. Elements of the same color do not share any
+/// node.
+using ElementColoring = std::vector<std::vector<std::size_t>>;
+
+/**
+ * Computes a greedy coloring of the mesh elements based on the node-element
+ * connectivity, such that no two elements of the same color share a node.
+ *
+ * Because all degrees of freedom of a NumLib::LocalToGlobalIndexMap are
+ * associated with mesh nodes, the local matrices and vectors of the elements
+ * of one color are added to disjoint global entries and can be assembled
+ * concurrently without synchronization.
+ *
+ * The element ids within each color are sorted in ascending order.
+ */
+ElementColoring computeElementColoring(MeshLib::Mesh const& mesh);
+}  // namespace NumLib
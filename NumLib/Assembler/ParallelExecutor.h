@@ -0,0 +1,267 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace NumLib
+{
+namespace detail
+{
+/// Calls \c f(context, i) for all \c i in [0, \c n) distributed over the
+/// available OpenMP threads.
+///
+/// Each thread creates its own \c context by calling \c make_context() before
+/// its first iteration and destroys it after its last one, which allows for
+/// thread-local resources like allocation scopes. \c make_context must not
+/// throw.
+///
+/// The iterations are scheduled dynamically in chunks of \c chunk_size, such
+/// that threads which finish their elements early take over further elements
+/// from the others. Small chunks suit few iterations of very different cost.
+/// Exceptions cannot leave an OpenMP parallel region. Therefore the first
+/// exception thrown by any call of \c f is caught, the remaining iterations
+/// are skipped and the exception is rethrown after the parallel region.
+///
+/// Without OpenMP the calls are executed serially in ascending order.
+template <typename MakeContext, typename F>
+void parallelForWithContext(std::size_t const n,
+                            MakeContext const& make_context, F const& f,
+                            int const chunk_size = 16)
+{
+    (void)chunk_size;  // unused without OpenMP
+    std::exception_ptr exception = nullptr;
+    bool failed = false;
+
+    // OpenMP 2.0 (MSVC) supports only signed loop counters.
+    auto const size = static_cast<std::ptrdiff_t>(n);
+#pragma omp parallel
+    {
+        auto context = make_context();
+
+#pragma omp for schedule(dynamic, chunk_size)
+        for (std::ptrdiff_t i = 0; i < size; i++)
+        {
+            bool skip;
+#pragma omp atomic read
+            skip = failed;
+            if (skip)
+            {
+                continue;
+            }
+
+            try
+            {
+                f(context, static_cast<std::size_t>(i));
+            }
+            catch (...)
+            {
+#pragma omp critical(ogs_parallel_executor_exception)
+                {
+                    if (!exception)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+#pragma omp atomic write
+                failed = true;
+            }
+        }
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+/// Calls \c f(i) for all \c i in [0, \c n) distributed over the available
+/// OpenMP threads, cf. parallelForWithContext().
+template <typename F>
+void parallelFor(std::size_t const n, F const& f, int const chunk_size = 16)
+{
+    parallelForWithContext(
+        n, [] { return 0; },
+        [&f](int /*context*/, std::size_t const i) { f(i); }, chunk_size);
+}
+
+}  // namespace detail
+
+/// Executor having the same interface as the SerialExecutor, but distributing
+/// the calls over the available OpenMP threads.
+///
+/// \attention The callbacks are called concurrently for different elements of
+/// the container. Therefore they must not modify shared state without proper
+/// synchronization. In particular, the object passed to the member function
+/// variants must be thread-safe.
+///
+/// \note The additional arguments are passed on to each call as lvalue
+/// references, they are never moved from.
+struct ParallelExecutor
+{
+    /// Parallel version of SerialExecutor::executeDereferenced().
+    template <typename F, typename C, typename... Args_>
+    static void executeDereferenced(F const& f, C const& c, Args_&&... args)
+    {
+        detail::parallelFor(c.size(), [&](std::size_t const i) {
+            f(i, *c[i], args...);
+        });
+    }
+
+    /// Parallel version of SerialExecutor::executeMemberDereferenced().
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    static void executeMemberDereferenced(Object& object, Method method,
+                                          Container const& container,
+                                          Args&&... args)
+    {
+        detail::parallelFor(container.size(), [&](std::size_t const i) {
+            (object.*method)(i, *container[i], args...);
+        });
+    }
+
+    /// Parallel version of
+    /// SerialExecutor::executeSelectedMemberDereferenced().
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    static void executeSelectedMemberDereferenced(
+        Object& object, Method method, Container const& container,
+        std::vector<std::size_t> const& active_container_ids, Args&&... args)
+    {
+        if (active_container_ids.empty())
+        {
+            executeMemberDereferenced(object, method, container, args...);
+            return;
+        }
+
+        detail::parallelFor(
+            active_container_ids.size(), [&](std::size_t const i) {
+                auto const id = active_container_ids[i];
+                (object.*method)(id, *container[id], args...);
+            });
+    }
+
+    /// Executes the given \c method of the given \c object for the selected
+    /// elements from the input \c container color by color. The elements of
+    /// one color are processed concurrently, the colors one after another.
+    ///
+    /// \param object               the object whose method will be called.
+    /// \param method               the method being called.
+    /// \param container            collection of objects having pointer
+    ///                             semantics.
+    /// \param colors               the ids of the elements of \c container
+    ///                             grouped by color, cf.
+    ///                             NumLib::computeElementColoring().
+    /// \param active_container_ids The IDs of active elements of \c container.
+    ///                             If empty, all elements are processed.
+    /// \param args                 further arguments passed on to the method.
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    static void executeSelectedMemberDereferencedByColor(
+        Object& object, Method method, Container const& container,
+        std::vector<std::vector<std::size_t>> const& colors,
+        std::vector<std::size_t> const& active_container_ids, Args&&... args)
+    {
+        std::vector<bool> is_active;
+        if (!active_container_ids.empty())
+        {
+            is_active.resize(container.size(), false);
+            for (auto const id : active_container_ids)
+            {
+                is_active[id] = true;
+            }
+        }
+
+        for (auto const& color : colors)
+        {
+            detail::parallelFor(color.size(), [&](std::size_t const i) {
+                auto const id = color[i];
+                if (!is_active.empty() && !is_active[id])
+                {
+                    return;
+                }
+                (object.*method)(id, *container[id], args...);
+            });
+        }
+    }
+
+    /// Parallel version of SerialExecutor::executeMemberOnDereferenced().
+    template <typename Container, typename Method, typename... Args>
+    static void executeMemberOnDereferenced(Method method,
+                                            Container const& container,
+                                            Args&&... args)
+    {
+        detail::parallelFor(container.size(), [&](std::size_t const i) {
+            ((*container[i]).*method)(i, args...);
+        });
+    }
+
+    /// Parallel version of
+    /// SerialExecutor::executeSelectedMemberOnDereferenced().
+    template <typename Container, typename Method, typename... Args>
+    static void executeSelectedMemberOnDereferenced(
+        Method method, Container const& container,
+        std::vector<std::size_t> const& active_container_ids, Args&&... args)
+    {
+        if (active_container_ids.empty())
+        {
+            executeMemberOnDereferenced(method, container, args...);
+            return;
+        }
+
+        detail::parallelFor(
+            active_container_ids.size(), [&](std::size_t const i) {
+                auto const id = active_container_ids[i];
+                ((*container[id]).*method)(id, args...);
+            });
+    }
+
+    /// Parallel version of SerialExecutor::transformDereferenced().
+    template <typename F, typename C, typename Data, typename... Args_>
+    static void transformDereferenced(F const& f, C const& c, Data& data,
+                                      Args_&&... args)
+    {
+        assert(c.size() == data.size());
+
+        detail::parallelFor(c.size(), [&](std::size_t const i) {
+            f(i, *c[i], data[i], args...);
+        });
+    }
+};
+
+/// Returns the number of the calling thread inside of a parallel region
+/// started by the ParallelExecutor, or zero outside of such a region.
+inline int getThreadNumber()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+/// Returns the maximum number of threads used by the ParallelExecutor.
+inline int getMaxNumberOfThreads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+}  // namespace NumLib
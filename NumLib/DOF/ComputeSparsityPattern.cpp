@@ -10,56 +10,173 @@
 
 #include "ComputeSparsityPattern.h"
 
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
 #include "LocalToGlobalIndexMap.h"
+#include "BaseLib/Range.h"
+#include "MeshLib/Mesh.h"
 #include "MeshLib/NodeAdjacencyTable.h"
 
+namespace
+{
+/// A mapping   mesh node id -> global indices in compressed rows.
+/// It acts as a cache for dof table queries.
+class GlobalIndicesOfNodes
+{
+public:
+    GlobalIndicesOfNodes(NumLib::LocalToGlobalIndexMap const& dof_table,
+                         MeshLib::Mesh const& mesh)
+    {
+        auto const n_nodes = static_cast<long>(mesh.getNumberOfNodes());
+        auto const n_components = dof_table.getNumberOfComponents();
+
+        // Each node has at most one index per component. The indices are
+        // queried component-wise, which does not allocate, and compacted
+        // afterwards.
+        _offsets.assign(n_nodes + 1, 0);
+        _indices.resize(n_nodes * n_components);
+#pragma omp parallel for
+        for (long n = 0; n < n_nodes; ++n)
+        {
+            MeshLib::Location const l(mesh.getID(),
+                                      MeshLib::MeshItemType::Node, n);
+            std::size_t count = 0;
+            for (int c = 0; c < n_components; ++c)
+            {
+                auto const global_index = dof_table.getGlobalIndex(l, c);
+                if (global_index != std::numeric_limits<GlobalIndexType>::max())
+                {
+                    _indices[n * n_components + count++] = global_index;
+                }
+            }
+            _offsets[n + 1] = count;
+        }
+
+        for (long n = 0; n < n_nodes; ++n)
+        {
+            auto const first = _indices.begin() + n * n_components;
+            std::copy(first, first + _offsets[n + 1],
+                      _indices.begin() + _offsets[n]);
+            _offsets[n + 1] += _offsets[n];
+        }
+        _indices.resize(_offsets.back());
+    }
+
+    BaseLib::Range<GlobalIndexType const*> operator[](
+        std::size_t const node_id) const
+    {
+        return BaseLib::Range<GlobalIndexType const*>(
+            _indices.data() + _offsets[node_id],
+            _indices.data() + _offsets[node_id + 1]);
+    }
+
+    std::vector<GlobalIndexType> const& getAllIndices() const
+    {
+        return _indices;
+    }
+
+private:
+    std::vector<std::size_t> _offsets;
+    std::vector<GlobalIndexType> _indices;
+};
+
 #ifdef USE_PETSC
-#include "MeshLib/NodePartitionedMesh.h"
+/// In a partitioned mesh the non-ghost global indices of a rank form a
+/// contiguous range. Ghost indices are negative.
+GlobalIndexType getRangeBegin(GlobalIndicesOfNodes const& global_idcs)
+{
+    auto range_begin = std::numeric_limits<GlobalIndexType>::max();
+    for (auto const global_index : global_idcs.getAllIndices())
+    {
+        if (global_index >= 0)
+        {
+            range_begin = std::min(range_begin, global_index);
+        }
+    }
+    return range_begin == std::numeric_limits<GlobalIndexType>::max()
+               ? 0
+               : range_begin;
+}
 
 GlobalSparsityPattern computeSparsityPatternPETSc(
-    NumLib::LocalToGlobalIndexMap const& dof_table,
-    MeshLib::Mesh const& mesh)
+    NumLib::LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
 {
-    assert(dynamic_cast<MeshLib::NodePartitionedMesh const*>(&mesh));
-    auto const& npmesh =
-        *static_cast<MeshLib::NodePartitionedMesh const*>(&mesh);
+    GlobalIndicesOfNodes const global_idcs(dof_table, mesh);
+    auto const range_begin = getRangeBegin(global_idcs);
+    auto const n_local_rows =
+        static_cast<GlobalIndexType>(dof_table.dofSizeWithoutGhosts());
+
+    // The diagonal counts of all local rows are followed by the off-diagonal
+    // counts, cf. MathLib::SparsityPattern.
+    GlobalSparsityPattern sparsity_pattern(2 * n_local_rows, 0);
 
-    auto const max_nonzeroes =   dof_table.getNumberOfComponents()
-                               * npmesh.getMaximumNConnectedNodesToNode();
+    auto const& adjacency = mesh.getNodeAdjacencyTable();
+    auto const n_nodes = static_cast<long>(adjacency.size());
 
-    // The sparsity pattern is misused here in the sense that it will only
-    // contain a single value.
-    return GlobalSparsityPattern(1, max_nonzeroes);
+    // Each global index belongs to exactly one node, hence, the nodes write to
+    // disjoint entries of the sparsity pattern.
+#pragma omp parallel for
+    for (long n = 0; n < n_nodes; ++n)
+    {
+        // A ghost node either has ghost indices only, or it is not part of
+        // the dof table at all; its rows are stored by another rank.
+        if (global_idcs[n].empty() || *global_idcs[n].begin() < 0)
+        {
+            continue;
+        }
+
+        GlobalIndexType n_diagonal = 0;
+        GlobalIndexType n_off_diagonal = 0;
+        for (auto const an : adjacency.getAdjacentNodes(n))
+        {
+            for (auto const global_index : global_idcs[an])
+            {
+                if (global_index >= 0)
+                {
+                    ++n_diagonal;
+                }
+                else
+                {
+                    ++n_off_diagonal;
+                }
+            }
+        }
+        for (auto const global_index : global_idcs[n])
+        {
+            auto const row = global_index - range_begin;
+            assert(0 <= row && row < n_local_rows);
+            sparsity_pattern[row] = n_diagonal;
+            sparsity_pattern[n_local_rows + row] = n_off_diagonal;
+        }
+    }
+
+    return sparsity_pattern;
 }
 #else
 GlobalSparsityPattern computeSparsityPatternNonPETSc(
     NumLib::LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
 {
-    MeshLib::NodeAdjacencyTable node_adjacency_table;
-    node_adjacency_table.createTable(mesh.getNodes());
-
-    // A mapping   mesh node id -> global indices
-    // It acts as a cache for dof table queries.
-    std::vector<std::vector<GlobalIndexType>> global_idcs;
-
-    global_idcs.reserve(mesh.getNumberOfNodes());
-    for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
-    {
-        MeshLib::Location l(mesh.getID(), MeshLib::MeshItemType::Node, n);
-        global_idcs.push_back(dof_table.getGlobalIndices(l));
-    }
+    GlobalIndicesOfNodes const global_idcs(dof_table, mesh);
 
     GlobalSparsityPattern sparsity_pattern(dof_table.dofSizeWithGhosts());
 
-    // Map adjacent mesh nodes to "adjacent global indices".
-    for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
+    auto const& adjacency = mesh.getNodeAdjacencyTable();
+    auto const n_nodes = static_cast<long>(adjacency.size());
+
+    // Map adjacent mesh nodes to "adjacent global indices". Each global index
+    // belongs to exactly one node, hence, the nodes write to disjoint entries
+    // of the sparsity pattern.
+#pragma omp parallel for
+    for (long n = 0; n < n_nodes; ++n)
     {
-        unsigned n_connected_dof = 0;
-        for (auto an : node_adjacency_table.getAdjacentNodes(n))
+        GlobalIndexType n_connected_dof = 0;
+        for (auto const an : adjacency.getAdjacentNodes(n))
         {
             n_connected_dof += global_idcs[an].size();
         }
-        for (auto global_index : global_idcs[n])
+        for (auto const global_index : global_idcs[n])
         {
             sparsity_pattern[global_index] = n_connected_dof;
         }
@@ -68,6 +185,7 @@ GlobalSparsityPattern computeSparsityPatternNonPETSc(
     return sparsity_pattern;
 }
 #endif
+}  // namespace
 
 namespace NumLib
 {
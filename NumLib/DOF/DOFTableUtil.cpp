@@ -9,6 +9,8 @@
  */
 
 #include "DOFTableUtil.h"
+
+#include <algorithm>
 #include <cassert>
 
 namespace NumLib
@@ -126,18 +128,11 @@ std::vector<GlobalIndexType> getIndices(
     NumLib::LocalToGlobalIndexMap const& dof_table)
 {
     assert(dof_table.size() > mesh_item_id);
-    std::vector<GlobalIndexType> indices;
 
     // Local matrices and vectors will always be ordered by component
     // no matter what the order of the global matrix is.
-    for (int c = 0; c < dof_table.getNumberOfComponents(); ++c)
-    {
-        auto const& idcs = dof_table(mesh_item_id, c).rows;
-        indices.reserve(indices.size() + idcs.size());
-        indices.insert(indices.end(), idcs.begin(), idcs.end());
-    }
-
-    return indices;
+    auto const idcs = dof_table.getElementIndices(mesh_item_id);
+    return {idcs.begin(), idcs.end()};
 }
 
 NumLib::LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
@@ -146,18 +141,45 @@ NumLib::LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
     std::vector<GlobalIndexType>& indices)
 {
     assert(dof_table.size() > id);
-    indices.clear();
 
     // Local matrices and vectors will always be ordered by component,
     // no matter what the order of the global matrix is.
-    for (int c = 0; c < dof_table.getNumberOfComponents(); ++c)
+    auto const idcs = dof_table.getElementIndices(id);
+    indices.assign(idcs.begin(), idcs.end());
+
+    return NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
+}
+
+std::vector<GlobalIndexType> getNonGhostGlobalIndices(
+    LocalToGlobalIndexMap const& dof_table, int const variable_id)
+{
+    std::vector<GlobalIndexType> global_indices;
+
+    int const n_components =
+        dof_table.getNumberOfVariableComponents(variable_id);
+    for (int component = 0; component < n_components; ++component)
     {
-        auto const& idcs = dof_table(id, c).rows;
-        indices.reserve(indices.size() + idcs.size());
-        indices.insert(indices.end(), idcs.begin(), idcs.end());
+        auto const& mesh_subset =
+            dof_table.getMeshSubset(variable_id, component);
+        auto const mesh_id = mesh_subset.getMeshID();
+        global_indices.reserve(global_indices.size() +
+                               mesh_subset.getNumberOfNodes());
+        for (auto const* node : mesh_subset.getNodes())
+        {
+            MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
+                                      node->getID());
+            auto const global_index =
+                dof_table.getGlobalIndex(l, variable_id, component);
+            // Ghost indices are negative.
+            if (global_index >= 0)
+            {
+                global_indices.push_back(global_index);
+            }
+        }
     }
 
-    return NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
+    std::sort(global_indices.begin(), global_indices.end());
+    return global_indices;
 }
 
 double norm(GlobalVector const& x, unsigned const global_component,
@@ -43,6 +43,11 @@ LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
     NumLib::LocalToGlobalIndexMap const& dof_table,
     std::vector<GlobalIndexType>& indices);
 
+//! Returns the sorted global indices of all components of the given variable
+//! excluding the indices of ghost nodes.
+std::vector<GlobalIndexType> getNonGhostGlobalIndices(
+    LocalToGlobalIndexMap const& dof_table, int const variable_id);
+
 //! Computes the specified norm of the given global component of the given vector x.
 //! \remark
 //! \c x is typically the solution vector of a monolithically coupled process
@@ -42,19 +42,22 @@ template <typename ElementIterator>
 void LocalToGlobalIndexMap::findGlobalIndicesWithElementID(
     ElementIterator first, ElementIterator last,
     std::vector<MeshLib::Node*> const& nodes, std::size_t const mesh_id,
-    const int comp_id, const int comp_id_write)
+    const int comp_id, const int comp_id_write, Table& table) const
 {
     std::unordered_set<MeshLib::Node*> const set_nodes(nodes.begin(), nodes.end());
 
     // For each element find the global indices for node/element
     // components.
-    for (ElementIterator e = first; e != last; ++e)
+    auto const n_elements = static_cast<std::ptrdiff_t>(std::distance(first, last));
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < n_elements; ++i)
     {
+        auto const* const e = first[i];
         LineIndex indices;
-        indices.reserve((*e)->getNumberOfNodes());
+        indices.reserve(e->getNumberOfNodes());
 
-        for (auto* n = (*e)->getNodes();
-             n < (*e)->getNodes()+(*e)->getNumberOfNodes(); ++n)
+        for (auto* n = e->getNodes();
+             n < e->getNodes()+e->getNumberOfNodes(); ++n)
         {
             // Check if the element's node is in the given list of nodes.
             if (set_nodes.find(*n) == set_nodes.end())
@@ -66,8 +69,7 @@ void LocalToGlobalIndexMap::findGlobalIndicesWithElementID(
             indices.push_back(_mesh_component_map.getGlobalIndex(l, comp_id));
         }
 
-        indices.shrink_to_fit();
-        _rows((*e)->getID(), comp_id_write) = std::move(indices);
+        table[offsetIndex(e->getID(), comp_id_write)] = std::move(indices);
     }
 }
 
@@ -75,22 +77,24 @@ template <typename ElementIterator>
 void LocalToGlobalIndexMap::findGlobalIndices(
     ElementIterator first, ElementIterator last,
     std::vector<MeshLib::Node*> const& nodes, std::size_t const mesh_id,
-    const int comp_id, const int comp_id_write)
+    const int comp_id, const int comp_id_write, Table& table) const
 {
-    _rows.resize(std::distance(first, last), _mesh_subsets.size());
+    auto const n_elements = static_cast<std::ptrdiff_t>(std::distance(first, last));
+    table.resize(offsetIndex(n_elements, 0));
 
     std::unordered_set<MeshLib::Node*> const set_nodes(nodes.begin(), nodes.end());
 
     // For each element find the global indices for node/element
     // components.
-    std::size_t elem_id = 0;
-    for (ElementIterator e = first; e != last; ++e, ++elem_id)
+#pragma omp parallel for
+    for (std::ptrdiff_t elem_id = 0; elem_id < n_elements; ++elem_id)
     {
+        auto const* const e = first[elem_id];
         LineIndex indices;
-        indices.reserve((*e)->getNumberOfNodes());
+        indices.reserve(e->getNumberOfNodes());
 
-        for (auto* n = (*e)->getNodes();
-             n < (*e)->getNodes() + (*e)->getNumberOfNodes(); ++n)
+        for (auto* n = e->getNodes();
+             n < e->getNodes() + e->getNumberOfNodes(); ++n)
         {
             // Check if the element's node is in the given list of nodes.
             if (set_nodes.find(*n) == set_nodes.end())
@@ -108,11 +112,31 @@ void LocalToGlobalIndexMap::findGlobalIndices(
             indices.push_back(global_index);
         }
 
-        indices.shrink_to_fit();
-        _rows(elem_id, comp_id_write) = std::move(indices);
+        table[offsetIndex(elem_id, comp_id_write)] = std::move(indices);
     }
 }
 
+void LocalToGlobalIndexMap::compressTable(Table&& table)
+{
+    auto const n_lines = static_cast<std::ptrdiff_t>(table.size());
+    _offsets.resize(n_lines + 1);
+    _offsets[0] = 0;
+    for (std::ptrdiff_t i = 0; i < n_lines; ++i)
+    {
+        _offsets[i + 1] = _offsets[i] + table[i].size();
+    }
+
+    _indices.resize(_offsets.back());
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < n_lines; ++i)
+    {
+        std::copy(table[i].begin(), table[i].end(),
+                  _indices.begin() + _offsets[i]);
+        LineIndex().swap(table[i]);
+    }
+    table.clear();
+}
+
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
     std::vector<MeshLib::MeshSubset>&& mesh_subsets,
     NumLib::ComponentOrder const order)
@@ -124,11 +148,14 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
     std::vector<MeshLib::MeshSubset>&& mesh_subsets,
     std::vector<int> const& vec_var_n_components,
-    NumLib::ComponentOrder const order)
+    NumLib::ComponentOrder const order,
+    std::vector<std::size_t> const& node_order)
     : _mesh_subsets(std::move(mesh_subsets)),
-      _mesh_component_map(_mesh_subsets, order),
+      _mesh_component_map(_mesh_subsets, order, node_order),
       _variable_component_offsets(to_cumulative(vec_var_n_components))
 {
+    Table table;
+
     // For each element of that MeshSubset save a line of global indices.
     for (int variable_id = 0; variable_id < static_cast<int>(vec_var_n_components.size());
          ++variable_id)
@@ -144,25 +171,28 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
 
             findGlobalIndices(ms.elementsBegin(), ms.elementsEnd(),
                               ms.getNodes(), mesh_id, global_component_id,
-                              global_component_id);
+                              global_component_id, table);
         }
     }
+
+    compressTable(std::move(table));
 }
 
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
     std::vector<MeshLib::MeshSubset>&& mesh_subsets,
     std::vector<int> const& vec_var_n_components,
     std::vector<std::vector<MeshLib::Element*> const*> const& vec_var_elements,
-    NumLib::ComponentOrder const order)
+    NumLib::ComponentOrder const order,
+    std::vector<std::size_t> const& node_order)
     : _mesh_subsets(std::move(mesh_subsets)),
-      _mesh_component_map(_mesh_subsets, order),
+      _mesh_component_map(_mesh_subsets, order, node_order),
       _variable_component_offsets(to_cumulative(vec_var_n_components))
 {
     assert(vec_var_n_components.size() == vec_var_elements.size());
 
     // For each element of that MeshSubset save a line of global indices.
 
-    // _rows should be resized based on an element ID
+    // The table should be resized based on an element ID
     std::size_t max_elem_id = 0;
     for (std::vector<MeshLib::Element*>const* eles : vec_var_elements)
     {
@@ -171,7 +201,7 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
             max_elem_id = std::max(max_elem_id, e->getID());
         }
     }
-    _rows.resize(max_elem_id + 1, _mesh_subsets.size());
+    Table table(offsetIndex(max_elem_id + 1, 0));
 
     for (int variable_id = 0; variable_id < static_cast<int>(vec_var_n_components.size());
          ++variable_id)
@@ -188,9 +218,11 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
 
             findGlobalIndicesWithElementID(
                 var_elements.cbegin(), var_elements.cend(), ms.getNodes(),
-                mesh_id, global_component_id, global_component_id);
+                mesh_id, global_component_id, global_component_id, table);
         }
     }
+
+    compressTable(std::move(table));
 }
 
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
@@ -213,6 +245,7 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
             _mesh_subsets.size(), global_component_ids.size());
     }
 
+    Table table;
     for (int i = 0; i < static_cast<int>(global_component_ids.size()); ++i)
     {
         auto const& ms = _mesh_subsets[i];
@@ -222,8 +255,10 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
         std::size_t const mesh_id = ms.getMeshID();
 
         findGlobalIndices(elements.cbegin(), elements.cend(), ms.getNodes(),
-                          mesh_id, global_component_ids[i], i);
+                          mesh_id, global_component_ids[i], i, table);
     }
+
+    compressTable(std::move(table));
 }
 
 LocalToGlobalIndexMap* LocalToGlobalIndexMap::deriveBoundaryConstrainedMap(
@@ -334,36 +369,42 @@ int LocalToGlobalIndexMap::getNumberOfComponents() const
 
 std::size_t LocalToGlobalIndexMap::size() const
 {
-    return _rows.rows();
+    if (_mesh_subsets.empty())
+    {
+        return 0;
+    }
+    return (_offsets.size() - 1) / _mesh_subsets.size();
 }
 
-LocalToGlobalIndexMap::RowColumnIndices LocalToGlobalIndexMap::operator()(
+LocalToGlobalIndexMap::RowColumnIndexRanges LocalToGlobalIndexMap::operator()(
     std::size_t const mesh_item_id, const int component_id) const
 {
-    return RowColumnIndices(_rows(mesh_item_id, component_id),
-                            _columns(mesh_item_id, component_id));
+    auto const i = offsetIndex(mesh_item_id, component_id);
+    IndexRange const indices{_indices.data() + _offsets[i],
+                             _indices.data() + _offsets[i + 1]};
+    return {indices, indices};
+}
+
+LocalToGlobalIndexMap::IndexRange LocalToGlobalIndexMap::getElementIndices(
+    std::size_t const mesh_item_id) const
+{
+    return {_indices.data() + _offsets[offsetIndex(mesh_item_id, 0)],
+            _indices.data() + _offsets[offsetIndex(mesh_item_id + 1, 0)]};
 }
 
 std::size_t
 LocalToGlobalIndexMap::getNumberOfElementDOF(std::size_t const mesh_item_id) const
 {
-    std::size_t ndof = 0;
-
-    for (Table::Index c = 0; c < _rows.cols(); ++c)
-    {
-        ndof += _rows(mesh_item_id, c).size();
-    }
-
-    return ndof;
+    return getElementIndices(mesh_item_id).size();
 }
 
 std::size_t
 LocalToGlobalIndexMap::getNumberOfElementComponents(std::size_t const mesh_item_id) const
 {
     std::size_t n = 0;
-    for (Table::Index c = 0; c < _rows.cols(); ++c)
+    for (int c = 0; c < getNumberOfComponents(); ++c)
     {
-        if (!_rows(mesh_item_id, c).empty())
+        if (!(*this)(mesh_item_id, c).rows.empty())
         {
             n++;
         }
@@ -380,7 +421,7 @@ std::vector<int> LocalToGlobalIndexMap::getElementVariableIDs(
         for (int j=0; j<getNumberOfVariableComponents(i); j++)
         {
             auto comp_id = getGlobalComponent(i, j);
-            if (!_rows(mesh_item_id, comp_id).empty())
+            if (!(*this)(mesh_item_id, comp_id).rows.empty())
             {
                 vec.push_back(i);
             }
@@ -421,6 +462,11 @@ std::vector<GlobalIndexType> const& LocalToGlobalIndexMap::getGhostIndices()
     return _mesh_component_map.getGhostIndices();
 }
 
+int LocalToGlobalIndexMap::getBlockSize() const
+{
+    return _mesh_component_map.getBlockSize();
+}
+
 /// Computes the index in a local (for DDC) vector for a given location and
 /// component; forwarded from MeshComponentMap.
 GlobalIndexType LocalToGlobalIndexMap::getLocalIndex(
@@ -449,14 +495,14 @@ std::ostream& operator<<(std::ostream& os, LocalToGlobalIndexMap const& map)
     std::size_t const max_lines = 10;
     std::size_t lines_printed = 0;
 
-    os << "Rows of the local to global index map; " << map._rows.size()
+    os << "Rows of the local to global index map; " << map._offsets.size() - 1
         << " rows\n";
     for (std::size_t e=0; e<map.size(); ++e)
     {
         os << "== e " << e << " ==\n";
         for (int c = 0; c < map.getNumberOfComponents(); ++c)
         {
-            auto const& line = map._rows(e, c);
+            auto const line = map(e, c).rows;
 
             os << "c" << c << " { ";
             std::copy(line.cbegin(), line.cend(),
@@ -14,6 +14,7 @@
 #include <iosfwd>
 #endif  // NDEBUG
 
+#include <algorithm>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -40,6 +41,12 @@ namespace NumLib
 /// The number of rows should be equal to the number of mesh items and the
 /// number of columns should be equal to the number of the components on that
 /// mesh item.
+///
+/// The indices are stored in compressed rows: the indices of all mesh items
+/// and components are contiguous in one array, ordered by the mesh item first
+/// and by the component second, and are addressed by an array of offsets.
+/// Hence the indices of one mesh item and component, as well as the indices
+/// of all components of one mesh item, are a contiguous range.
 class LocalToGlobalIndexMap final
 {
     // Enables using std::make_unique with private constructors from within
@@ -54,6 +61,51 @@ public:
     using RowColumnIndices = MathLib::RowColumnIndices<GlobalIndexType>;
     using LineIndex = RowColumnIndices::LineIndex;
 
+    /// Read-only view of a contiguous range of global indices stored in the
+    /// map. It is valid as long as the map exists.
+    class IndexRange
+    {
+    public:
+        using value_type = GlobalIndexType;
+        using const_iterator = GlobalIndexType const*;
+        using iterator = const_iterator;
+
+        IndexRange(const_iterator const begin, const_iterator const end)
+            : _begin(begin), _end(end)
+        {
+        }
+
+        const_iterator begin() const { return _begin; }
+        const_iterator end() const { return _end; }
+        const_iterator cbegin() const { return _begin; }
+        const_iterator cend() const { return _end; }
+
+        std::size_t size() const { return _end - _begin; }
+        bool empty() const { return _begin == _end; }
+
+        GlobalIndexType operator[](std::size_t const i) const
+        {
+            return _begin[i];
+        }
+
+        bool operator==(IndexRange const& other) const
+        {
+            return std::equal(_begin, _end, other._begin, other._end);
+        }
+
+    private:
+        const_iterator _begin;
+        const_iterator _end;
+    };
+
+    /// Row and column indices of one mesh item and component, which are
+    /// equal.
+    struct RowColumnIndexRanges
+    {
+        IndexRange rows;
+        IndexRange columns;
+    };
+
 public:
     /// Creates a MeshComponentMap internally and stores the global indices for
     /// each mesh element of the given mesh_subsets.
@@ -71,9 +123,12 @@ public:
     /// The size of the vector should be equal to the number of variables. Sum of the entries
     /// should be equal to the size of the mesh_subsets.
     /// \param order  type of ordering values in a vector
+    /// \param node_order  the node ids in the order in which they are
+    /// numbered, see MeshComponentMap::MeshComponentMap().
     LocalToGlobalIndexMap(std::vector<MeshLib::MeshSubset>&& mesh_subsets,
                           std::vector<int> const& vec_var_n_components,
-                          NumLib::ComponentOrder const order);
+                          NumLib::ComponentOrder const order,
+                          std::vector<std::size_t> const& node_order = {});
 
     /// Creates a MeshComponentMap internally and stores the global indices for
     /// the given mesh elements
@@ -84,12 +139,15 @@ public:
     /// should be equal to the size of the mesh_subsets.
     /// \param vec_var_elements  a vector of active mesh elements for each variable.
     /// \param order  type of ordering values in a vector
+    /// \param node_order  the node ids in the order in which they are
+    /// numbered, see MeshComponentMap::MeshComponentMap().
     LocalToGlobalIndexMap(
         std::vector<MeshLib::MeshSubset>&& mesh_subsets,
         std::vector<int> const& vec_var_n_components,
         std::vector<std::vector<MeshLib::Element*> const*> const&
             vec_var_elements,
-        NumLib::ComponentOrder const order);
+        NumLib::ComponentOrder const order,
+        std::vector<std::size_t> const& node_order = {});
 
     /// Derive a LocalToGlobalIndexMap constrained to the mesh subset and mesh
     /// subset's elements. A new mesh component map will be constructed using
@@ -123,8 +181,12 @@ public:
 
     int getNumberOfComponents() const;
 
-    RowColumnIndices operator()(std::size_t const mesh_item_id,
-                                const int component_id) const;
+    RowColumnIndexRanges operator()(std::size_t const mesh_item_id,
+                                    const int component_id) const;
+
+    /// The indices of all components of the mesh item, ordered by the
+    /// component.
+    IndexRange getElementIndices(std::size_t const mesh_item_id) const;
 
     std::size_t getNumberOfElementDOF(std::size_t const mesh_item_id) const;
 
@@ -147,6 +209,9 @@ public:
     /// Get ghost indices, forwarded from MeshComponentMap.
     std::vector<GlobalIndexType> const& getGhostIndices() const;
 
+    /// Block size of the global indices, forwarded from MeshComponentMap.
+    int getBlockSize() const;
+
     /// Computes the index in a local (for DDC) vector for a given location and
     /// component; forwarded from MeshComponentMap.
     GlobalIndexType getLocalIndex(MeshLib::Location const& l,
@@ -179,30 +244,43 @@ public:
         ConstructorTag /*unused*/);
 
 private:
+    /// Indices for each mesh item and component, stored row-wise, from which
+    /// the compressed rows are built.
+    using Table = std::vector<LineIndex>;
+
     template <typename ElementIterator>
     void findGlobalIndices(ElementIterator first, ElementIterator last,
                            std::vector<MeshLib::Node*> const& nodes,
                            std::size_t const mesh_id, const int comp_id,
-                           const int comp_id_write);
+                           const int comp_id_write, Table& table) const;
 
     template <typename ElementIterator>
     void findGlobalIndicesWithElementID(
         ElementIterator first, ElementIterator last,
         std::vector<MeshLib::Node*> const& nodes, std::size_t const mesh_id,
-        const int comp_id, const int comp_id_write);
+        const int comp_id, const int comp_id_write, Table& table) const;
+
+    /// Moves the indices of the table into the compressed rows.
+    void compressTable(Table&& table);
+
+    std::size_t offsetIndex(std::size_t const mesh_item_id,
+                            int const component_id) const
+    {
+        return mesh_item_id * _mesh_subsets.size() + component_id;
+    }
 
     /// A vector of mesh subsets for each process variables' components.
     std::vector<MeshLib::MeshSubset> _mesh_subsets;
     NumLib::MeshComponentMap _mesh_component_map;
 
-    using Table = Eigen::Matrix<LineIndex, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
-
-    /// Table contains for each element (first index) and each component (second index)
-    /// a vector (\c LineIndex) of indices in the global stiffness matrix or vector
-    Table _rows;
+    /// Offsets into \c _indices for each element (first index) and each
+    /// component (second index), stored row-wise, with a final entry equal to
+    /// the number of indices.
+    std::vector<std::size_t> _offsets;
 
-    /// \see _rows
-    Table const& _columns = _rows;
+    /// Indices in the global stiffness matrix or vector of all elements and
+    /// components. The row and column indices are the same.
+    std::vector<GlobalIndexType> _indices;
 
     std::vector<int> const _variable_component_offsets;
 #ifndef NDEBUG
@@ -79,6 +79,10 @@ public:
     //! method twice in a row in the same \c x!
     virtual void releaseVector(GlobalVector const& x) = 0;
 
+    //! Deletes the storage of all released vectors. Used to free the vectors
+    //! which were only needed during the setup.
+    virtual void freeUnusedVectors() = 0;
+
     virtual ~VectorProvider() = default;
 };
 
@@ -114,6 +118,10 @@ public:
     //! method twice in a row in the same \c A!
     virtual void releaseMatrix(GlobalMatrix const& A) = 0;
 
+    //! Deletes the storage of all released matrices. Used to free the
+    //! matrices which were only needed during the setup.
+    virtual void freeUnusedMatrices() = 0;
+
     virtual ~MatrixProvider() = default;
 };
 
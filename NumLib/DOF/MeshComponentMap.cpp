@@ -12,6 +12,9 @@
 
 #include "MeshComponentMap.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "BaseLib/Error.h"
 #include "MeshLib/MeshSubset.h"
 
@@ -19,6 +22,30 @@
 #include "MeshLib/NodePartitionedMesh.h"
 #endif
 
+namespace
+{
+/// The global indices form blocks of the size of the number of components if
+/// they are ordered by location and all components are defined on the same
+/// nodes.
+int computeBlockSize(std::vector<MeshLib::MeshSubset> const& components,
+                     NumLib::ComponentOrder const order)
+{
+    if (order != NumLib::ComponentOrder::BY_LOCATION || components.size() < 2)
+    {
+        return 1;
+    }
+
+    auto const& first = components.front();
+    bool const same_nodes = std::all_of(
+        components.begin() + 1, components.end(),
+        [&first](MeshLib::MeshSubset const& c) {
+            return c.getMeshID() == first.getMeshID() &&
+                   c.getNodes() == first.getNodes();
+        });
+    return same_nodes ? static_cast<int>(components.size()) : 1;
+}
+}  // namespace
+
 namespace NumLib
 {
 using namespace detail;
@@ -28,15 +55,18 @@ GlobalIndexType const MeshComponentMap::nop =
 
 #ifdef USE_PETSC
 MeshComponentMap::MeshComponentMap(
-    std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order)
+    std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order,
+    std::vector<std::size_t> const& node_order)
 {
+    _block_size = computeBlockSize(components, order);
+
     // Use PETSc with single thread
     const MeshLib::NodePartitionedMesh& partitioned_mesh =
         static_cast<const MeshLib::NodePartitionedMesh&>(
             components[0].getMesh());
     if (partitioned_mesh.isForSingleThread())
     {
-        createSerialMeshComponentMap(components, order);
+        createSerialMeshComponentMap(components, order, node_order);
         return;
     }
 
@@ -103,9 +133,12 @@ MeshComponentMap::MeshComponentMap(
 }
 #else
 MeshComponentMap::MeshComponentMap(
-    std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order)
+    std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order,
+    std::vector<std::size_t> const& node_order)
 {
-    createSerialMeshComponentMap(components, order);
+    _block_size = computeBlockSize(components, order);
+
+    createSerialMeshComponentMap(components, order, node_order);
 }
 #endif  // end of USE_PETSC
 
@@ -310,6 +343,36 @@ std::vector<GlobalIndexType> MeshComponentMap::getGlobalIndicesByComponent(
     return global_indices;
 }
 
+void MeshComponentMap::renumberByNodeOrder(
+    std::vector<std::size_t> const& node_order, ComponentOrder const order)
+{
+    std::vector<std::size_t> rank(node_order.size());
+    for (std::size_t i = 0; i < node_order.size(); ++i)
+    {
+        rank[node_order[i]] = i;
+    }
+
+    std::vector<Line> lines(_dict.begin(), _dict.end());
+    auto const key = [&](Line const& l) {
+        auto const node_rank = rank[l.location.item_id];
+        auto const comp_id = static_cast<std::size_t>(l.comp_id);
+        return order == ComponentOrder::BY_LOCATION
+                   ? std::make_pair(node_rank, comp_id)
+                   : std::make_pair(comp_id, node_rank);
+    };
+    std::sort(lines.begin(), lines.end(), [&](Line const& a, Line const& b) {
+        return key(a) < key(b);
+    });
+
+    _dict.clear();
+    GlobalIndexType global_index = 0;
+    for (auto& line : lines)
+    {
+        line.global_index = global_index++;
+        _dict.insert(line);
+    }
+}
+
 GlobalIndexType MeshComponentMap::getLocalIndex(
     Location const& l,
     int const comp_id,
@@ -354,7 +417,8 @@ GlobalIndexType MeshComponentMap::getLocalIndex(
 }
 
 void MeshComponentMap::createSerialMeshComponentMap(
-    std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order)
+    std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order,
+    std::vector<std::size_t> const& node_order)
 {
     // construct dict (and here we number global_index by component type)
     GlobalIndexType global_index = 0;
@@ -373,6 +437,23 @@ void MeshComponentMap::createSerialMeshComponentMap(
     }
     _num_local_dof = _dict.size();
 
+    if (!node_order.empty())
+    {
+        for (auto const& c : components)
+        {
+            if (c.getMeshID() != components.front().getMeshID() ||
+                c.getMesh().getNumberOfNodes() != node_order.size())
+            {
+                OGS_FATAL(
+                    "The node order can only be applied to components "
+                    "defined on the nodes of a single mesh with %d nodes.",
+                    node_order.size());
+            }
+        }
+        renumberByNodeOrder(node_order, order);
+        return;
+    }
+
     if (order == ComponentOrder::BY_LOCATION)
     {
         renumberByLocation();
@@ -34,8 +34,14 @@ public:
 public:
     /// \param components   a vector of components
     /// \param order        type of ordering values in a vector
+    /// \param node_order   the node ids of the components' mesh in the order
+    ///                     in which they are numbered, cf.
+    ///                     NumLib::computeNodeOrder(). If empty, the nodes are
+    ///                     numbered in the mesh order. Only used without
+    ///                     domain decomposition.
     MeshComponentMap(std::vector<MeshLib::MeshSubset> const& components,
-                     ComponentOrder order);
+                     ComponentOrder order,
+                     std::vector<std::size_t> const& node_order = {});
 
     /// Creates a multi-component subset of the current mesh component map.
     /// The order (BY_LOCATION/BY_COMPONENT) of components is the same as of the
@@ -120,6 +126,12 @@ public:
     /// with ghost nodes (for DDC with node-wise mesh partitioning).
     std::size_t dofSizeWithoutGhosts() const { return _num_local_dof; }
 
+    /// The number of consecutive global indices which belong to the same
+    /// location. It is equal to the number of components if all components
+    /// are defined on the same nodes and ordered by location, and one
+    /// otherwise.
+    int getBlockSize() const { return _block_size; }
+
     /// Get ghost indices (for DDC).
     std::vector<GlobalIndexType> const& getGhostIndices() const
     {
@@ -169,6 +181,11 @@ private:
 
     void renumberByLocation(GlobalIndexType offset = 0);
 
+    /// Renumbers the global indices following the given node order, either
+    /// location-wise or component-wise depending on the \c order.
+    void renumberByNodeOrder(std::vector<std::size_t> const& node_order,
+                             ComponentOrder order);
+
     detail::ComponentGlobalIndexDict _dict;
 
     /// Number of local unknowns excluding those associated
@@ -183,11 +200,15 @@ private:
     /// Global ID for ghost entries
     std::vector<GlobalIndexType> _ghosts_indices;
 
+    /// \copydoc getBlockSize()
+    int _block_size = 1;
+
     /// \param components   a vector of components
     /// \param order        type of ordering values in a vector
+    /// \param node_order   the node ids in the order of their numbering
     void createSerialMeshComponentMap(
         std::vector<MeshLib::MeshSubset> const& components,
-        ComponentOrder order);
+        ComponentOrder order, std::vector<std::size_t> const& node_order);
 };
 
 }  // namespace NumLib
@@ -0,0 +1,118 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "NodeOrdering.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include "MathLib/HilbertCurve.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/NodeAdjacencyTable.h"
+
+namespace
+{
+std::vector<std::size_t> computeReverseCuthillMcKeeOrder(
+    MeshLib::Mesh const& mesh)
+{
+    auto const& adjacency = mesh.getNodeAdjacencyTable();
+    auto const n_nodes = adjacency.size();
+
+    auto const degree = [&](std::size_t const id) {
+        return adjacency.getNodeDegree(id);
+    };
+
+    // Start each connected part of the mesh at a node of minimal degree,
+    // which is typically located at the boundary.
+    std::vector<std::size_t> start_candidates(n_nodes);
+    std::iota(start_candidates.begin(), start_candidates.end(), 0);
+    std::stable_sort(start_candidates.begin(), start_candidates.end(),
+                     [&](std::size_t const a, std::size_t const b) {
+                         return degree(a) < degree(b);
+                     });
+
+    std::vector<bool> visited(n_nodes, false);
+    std::vector<std::size_t> order;
+    order.reserve(n_nodes);
+    std::vector<std::size_t> neighbors;
+    for (auto const start : start_candidates)
+    {
+        if (visited[start])
+        {
+            continue;
+        }
+
+        // Breadth first search visiting the neighbors by increasing degree.
+        visited[start] = true;
+        order.push_back(start);
+        for (std::size_t head = order.size() - 1; head < order.size(); ++head)
+        {
+            neighbors.clear();
+            for (auto const id : adjacency.getAdjacentNodes(order[head]))
+            {
+                if (!visited[id])
+                {
+                    visited[id] = true;
+                    neighbors.push_back(id);
+                }
+            }
+            std::stable_sort(neighbors.begin(), neighbors.end(),
+                             [&](std::size_t const a, std::size_t const b) {
+                                 return degree(a) < degree(b);
+                             });
+            order.insert(order.end(), neighbors.begin(), neighbors.end());
+        }
+    }
+
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+std::vector<std::size_t> computeHilbertCurveOrder(MeshLib::Mesh const& mesh)
+{
+    auto const& nodes = mesh.getNodes();
+
+    std::vector<MathLib::Point3d> points;
+    points.reserve(nodes.size());
+    for (auto const* const node : nodes)
+    {
+        points.emplace_back(*node);
+    }
+    auto const positions = MathLib::computeHilbertCurvePositions(points);
+
+    std::vector<std::size_t> order(nodes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](std::size_t const a, std::size_t const b) {
+                  return std::make_pair(positions[a], a) <
+                         std::make_pair(positions[b], b);
+              });
+    return order;
+}
+}  // namespace
+
+namespace NumLib
+{
+std::vector<std::size_t> computeNodeOrder(MeshLib::Mesh const& mesh,
+                                          NodeOrdering const ordering)
+{
+    switch (ordering)
+    {
+        case NodeOrdering::MESH:
+            return {};
+        case NodeOrdering::REVERSE_CUTHILL_MCKEE:
+            return computeReverseCuthillMcKeeOrder(mesh);
+        case NodeOrdering::HILBERT_CURVE:
+            return computeHilbertCurveOrder(mesh);
+    }
+    return {};
+}
+}  // namespace NumLib
@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace NumLib
+{
+/// Orderings of the mesh nodes used for numbering the global indices.
+enum class NodeOrdering
+{
+    MESH,                   ///< Order of the mesh nodes.
+    REVERSE_CUTHILL_MCKEE,  ///< Bandwidth reducing order of the node graph.
+    HILBERT_CURVE           ///< Order along a Hilbert curve.
+};
+
+/// Computes the given \c ordering of the mesh nodes.
+///
+/// The reverse Cuthill-McKee ordering reduces the bandwidth of the global
+/// matrices, which improves the quality of incomplete factorizations. The
+/// Hilbert curve ordering places spatially close nodes close in the global
+/// vectors, which improves the cache usage of the sparse matrix-vector
+/// products. Both orderings are useful for meshes with an arbitrary node
+/// order, e.g. as generated by Gmsh.
+///
+/// \return the node ids in the computed order, or an empty vector for
+/// NodeOrdering::MESH.
+std::vector<std::size_t> computeNodeOrder(MeshLib::Mesh const& mesh,
+                                          NodeOrdering ordering);
+}  // namespace NumLib
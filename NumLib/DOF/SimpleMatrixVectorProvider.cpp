@@ -10,6 +10,7 @@
 
 #include "SimpleMatrixVectorProvider.h"
 
+#include <algorithm>
 #include <cassert>
 #include <logog/include/logog.hpp>
 
@@ -63,6 +64,9 @@ SimpleMatrixVectorProvider::
 get_(std::size_t& id,
      std::map<std::size_t, MatVec*>& unused_map,
      std::map<MatVec*, std::size_t>& used_map,
+     std::map<MatVec const*, Layout>& layouts,
+     Statistics& statistics,
+     Layout const& layout,
      Args&&... args)
 {
     if (id >= _next_id) {
@@ -72,30 +76,95 @@ get_(std::size_t& id,
             " Hence, I will abort now.");
     }
 
+    auto it = unused_map.end();
     if (do_search)
     {
-        auto it = unused_map.find(id);
-        if (it != unused_map.end())
-        {  // unused matrix/vector found
-            return {::detail::transfer(unused_map, used_map, it), false};
-        }
+        it = unused_map.find(id);
+    }
+    if (it == unused_map.end())
+    {
+        // recycle an unused matrix/vector of the same layout
+        it = std::find_if(unused_map.begin(), unused_map.end(),
+                          [&](auto const& id_ptr) {
+                              return layouts.at(id_ptr.second) == layout;
+                          });
     }
 
-    // not searched or not found, so create a new one
+    ++statistics.in_use;
+    statistics.max_in_use = std::max(statistics.max_in_use, statistics.in_use);
+
+    if (it != unused_map.end())
+    {  // unused matrix/vector found
+        id = it->first;
+        auto* const ptr = ::detail::transfer(unused_map, used_map, it);
+        layouts[ptr] = layout;
+        return {ptr, false};
+    }
+
+    // not found, so create a new one
     id = _next_id++;
     auto res = used_map.emplace(
         MathLib::MatrixVectorTraits<MatVec>::newInstance(std::forward<Args>(args)...).release(),
         id);
     assert(res.second && "Emplacement failed.");
+    layouts[res.first->first] = layout;
+    ++statistics.allocated;
+    statistics.max_allocated =
+        std::max(statistics.max_allocated, statistics.allocated);
     return { res.first->first, true };
 }
 
+template <typename MatVec>
+void SimpleMatrixVectorProvider::release_(
+    MatVec const& x,
+    std::map<std::size_t, MatVec*>& unused_map,
+    std::map<MatVec*, std::size_t>& used_map,
+    Statistics& statistics)
+{
+    auto it = used_map.find(const_cast<MatVec*>(&x));
+    if (it == used_map.end()) {
+        OGS_FATAL(
+            "The given matrix/vector has not been found. Cannot release it. "
+            "Aborting.");
+    }
+    ::detail::transfer(used_map, unused_map, it);
+    --statistics.in_use;
+}
+
+template <typename MatVec>
+void SimpleMatrixVectorProvider::freeUnused_(
+    std::map<std::size_t, MatVec*>& unused_map,
+    std::map<MatVec const*, Layout>& layouts,
+    Statistics& statistics)
+{
+    for (auto& id_ptr : unused_map)
+    {
+        layouts.erase(id_ptr.second);
+        delete id_ptr.second;
+    }
+    statistics.allocated -= unused_map.size();
+    unused_map.clear();
+}
+
+namespace
+{
+template <typename MatVec, typename Layout>
+Layout layoutOfCopy(std::map<MatVec const*, Layout> const& layouts,
+                    MatVec const& x)
+{
+    auto const it = layouts.find(&x);
+    return it == layouts.end() ? Layout{} : it->second;
+}
+}  // namespace
+
 template<bool do_search, typename... Args>
 std::pair<GlobalMatrix*, bool>
 SimpleMatrixVectorProvider::
-getMatrix_(std::size_t& id, Args&&... args)
+getMatrix_(std::size_t& id, Layout const& layout, Args&&... args)
 {
-    return get_<do_search>(id, _unused_matrices, _used_matrices, std::forward<Args>(args)...);
+    return get_<do_search>(id, _unused_matrices, _used_matrices,
+                           _matrix_layouts, _matrix_statistics, layout,
+                           std::forward<Args>(args)...);
 }
 
 
@@ -103,23 +172,28 @@ GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix()
 {
+    std::lock_guard<std::mutex> const lock(_mutex);
     std::size_t id = 0u;
-    return *getMatrix_<false>(id).first;
+    return *getMatrix_<false>(id, Layout{}).first;
 }
 
 GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix(std::size_t& id)
 {
-    return *getMatrix_<true>(id).first;
+    std::lock_guard<std::mutex> const lock(_mutex);
+    return *getMatrix_<true>(id, Layout{}).first;
 }
 
 GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix(MathLib::MatrixSpecifications const& ms)
 {
+    std::lock_guard<std::mutex> const lock(_mutex);
     std::size_t id = 0u;
-    return *getMatrix_<false>(id, ms).first;
+    return *getMatrix_<false>(
+                id, Layout{ms.nrows, ms.ncols, ms.sparsity_pattern, true}, ms)
+                .first;
     // TODO assert that the returned object always is of the right size
 }
 
@@ -127,7 +201,10 @@ GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix(MathLib::MatrixSpecifications const& ms, std::size_t& id)
 {
-    return *getMatrix_<true>(id, ms).first;
+    std::lock_guard<std::mutex> const lock(_mutex);
+    return *getMatrix_<true>(
+                id, Layout{ms.nrows, ms.ncols, ms.sparsity_pattern, true}, ms)
+                .first;
     // TODO assert that the returned object always is of the right size
 }
 
@@ -136,7 +213,10 @@ SimpleMatrixVectorProvider::
 getMatrix(GlobalMatrix const& A)
 {
     std::size_t id = 0u;
-    auto const& res = getMatrix_<false>(id, A);
+    auto const res = [&] {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        return getMatrix_<false>(id, layoutOfCopy(_matrix_layouts, A), A);
+    }();
     if (!res.second)
     {  // no new object has been created
         LinAlg::copy(A, *res.first);
@@ -148,7 +228,10 @@ GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix(GlobalMatrix const& A, std::size_t& id)
 {
-    auto const& res = getMatrix_<true>(id, A);
+    auto const res = [&] {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        return getMatrix_<true>(id, layoutOfCopy(_matrix_layouts, A), A);
+    }();
     if (!res.second)
     {  // no new object has been created
         LinAlg::copy(A, *res.first);
@@ -160,20 +243,24 @@ void
 SimpleMatrixVectorProvider::
 releaseMatrix(GlobalMatrix const& A)
 {
-    auto it = _used_matrices.find(const_cast<GlobalMatrix*>(&A));
-    if (it == _used_matrices.end()) {
-        OGS_FATAL("The given matrix has not been found. Cannot release it. Aborting.");
-    } else {
-        ::detail::transfer(_used_matrices, _unused_matrices, it);
-    }
+    std::lock_guard<std::mutex> const lock(_mutex);
+    release_(A, _unused_matrices, _used_matrices, _matrix_statistics);
+}
+
+void SimpleMatrixVectorProvider::freeUnusedMatrices()
+{
+    std::lock_guard<std::mutex> const lock(_mutex);
+    freeUnused_(_unused_matrices, _matrix_layouts, _matrix_statistics);
 }
 
 template<bool do_search, typename... Args>
 std::pair<GlobalVector*, bool>
 SimpleMatrixVectorProvider::
-getVector_(std::size_t& id, Args&&... args)
+getVector_(std::size_t& id, Layout const& layout, Args&&... args)
 {
-    return get_<do_search>(id, _unused_vectors, _used_vectors, std::forward<Args>(args)...);
+    return get_<do_search>(id, _unused_vectors, _used_vectors,
+                           _vector_layouts, _vector_statistics, layout,
+                           std::forward<Args>(args)...);
 }
 
 
@@ -181,23 +268,28 @@ GlobalVector&
 SimpleMatrixVectorProvider::
 getVector()
 {
+    std::lock_guard<std::mutex> const lock(_mutex);
     std::size_t id = 0u;
-    return *getVector_<false>(id).first;
+    return *getVector_<false>(id, Layout{}).first;
 }
 
 GlobalVector&
 SimpleMatrixVectorProvider::
 getVector(std::size_t& id)
 {
-    return *getVector_<true>(id).first;
+    std::lock_guard<std::mutex> const lock(_mutex);
+    return *getVector_<true>(id, Layout{}).first;
 }
 
 GlobalVector&
 SimpleMatrixVectorProvider::
 getVector(MathLib::MatrixSpecifications const& ms)
 {
+    std::lock_guard<std::mutex> const lock(_mutex);
     std::size_t id = 0u;
-    return *getVector_<false>(id, ms).first;
+    return *getVector_<false>(
+                id, Layout{ms.nrows, 1, ms.ghost_indices, true}, ms)
+                .first;
     // TODO assert that the returned object always is of the right size
 }
 
@@ -205,7 +297,10 @@ GlobalVector&
 SimpleMatrixVectorProvider::
 getVector(MathLib::MatrixSpecifications const& ms, std::size_t& id)
 {
-    return *getVector_<true>(id, ms).first;
+    std::lock_guard<std::mutex> const lock(_mutex);
+    return *getVector_<true>(
+                id, Layout{ms.nrows, 1, ms.ghost_indices, true}, ms)
+                .first;
     // TODO assert that the returned object always is of the right size
 }
 
@@ -214,7 +309,10 @@ SimpleMatrixVectorProvider::
 getVector(GlobalVector const& x)
 {
     std::size_t id = 0u;
-    auto const& res = getVector_<false>(id, x);
+    auto const res = [&] {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        return getVector_<false>(id, layoutOfCopy(_vector_layouts, x), x);
+    }();
     if (!res.second)
     {  // no new object has been created
         LinAlg::copy(x, *res.first);
@@ -226,7 +324,10 @@ GlobalVector&
 SimpleMatrixVectorProvider::
 getVector(GlobalVector const& x, std::size_t& id)
 {
-    auto const& res = getVector_<true>(id, x);
+    auto const res = [&] {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        return getVector_<true>(id, layoutOfCopy(_vector_layouts, x), x);
+    }();
     if (!res.second)
     {  // no new object has been created
         LinAlg::copy(x, *res.first);
@@ -238,17 +339,26 @@ void
 SimpleMatrixVectorProvider::
 releaseVector(GlobalVector const& x)
 {
-    auto it = _used_vectors.find(const_cast<GlobalVector*>(&x));
-    if (it == _used_vectors.end()) {
-        OGS_FATAL("The given vector has not been found. Cannot release it. Aborting.");
-    } else {
-        ::detail::transfer(_used_vectors, _unused_vectors, it);
-    }
+    std::lock_guard<std::mutex> const lock(_mutex);
+    release_(x, _unused_vectors, _used_vectors, _vector_statistics);
+}
+
+void SimpleMatrixVectorProvider::freeUnusedVectors()
+{
+    std::lock_guard<std::mutex> const lock(_mutex);
+    freeUnused_(_unused_vectors, _vector_layouts, _vector_statistics);
 }
 
 SimpleMatrixVectorProvider::
 ~SimpleMatrixVectorProvider()
 {
+    INFO(
+        "At most %d global matrices and %d global vectors have been in use at "
+        "the same time; at most %d matrices and %d vectors have been "
+        "allocated.",
+        _matrix_statistics.max_in_use, _vector_statistics.max_in_use,
+        _matrix_statistics.max_allocated, _vector_statistics.max_allocated);
+
     if ((!_used_matrices.empty()) || (!_used_vectors.empty())) {
         WARN("There are still some matrices and vectors in use."
              " This might be an indicator of a possible waste of memory.");
@@ -12,6 +12,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "MatrixProviderUser.h"
 
@@ -22,8 +23,18 @@ namespace NumLib
  *
  * This is a simple implementation of the MatrixProvider and VectorProvider interfaces.
  *
- * It is simple insofar it does not reuse released matrices/vectors, but keeps them in
- * memory until they are acquired again by the user.
+ * Released matrices/vectors are kept in a pool until they are acquired again
+ * by the user, either by their id, or by a request for an object of the same
+ * layout, i.e., the same size and sparsity pattern or ghost indices. Hence,
+ * temporaries acquired without an id are recycled, too. The pool is emptied by
+ * freeUnusedMatrices() and freeUnusedVectors().
+ *
+ * The maximum numbers of matrices and vectors in use at the same time are
+ * reported on destruction.
+ *
+ * The provider may be used from several threads at once, e.g., by processes
+ * solved concurrently; the bookkeeping is serialized, whereas the copying of
+ * the values of matrices and vectors is not.
  */
 class SimpleMatrixVectorProvider final
         : public MatrixProvider
@@ -47,6 +58,8 @@ public:
 
     void releaseVector(GlobalVector const& x) override;
 
+    void freeUnusedVectors() override;
+
     GlobalMatrix& getMatrix() override;
     GlobalMatrix& getMatrix(std::size_t& id) override;
 
@@ -58,14 +71,47 @@ public:
 
     void releaseMatrix(GlobalMatrix const& A) override;
 
+    void freeUnusedMatrices() override;
+
     ~SimpleMatrixVectorProvider() override;
 
 private:
+    /// The layout a matrix or vector has been acquired with. Unused objects
+    /// of equal and reusable layouts are interchangeable.
+    struct Layout
+    {
+        std::size_t nrows = 0;
+        std::size_t ncols = 0;
+        /// The sparsity pattern of matrices or the ghost indices of vectors.
+        void const* pattern = nullptr;
+        /// False for uninitialized objects, which might be resized by their
+        /// users, and for copies of objects with an unknown layout.
+        bool reusable = false;
+
+        bool operator==(Layout const& other) const
+        {
+            return reusable && other.reusable && nrows == other.nrows &&
+                   ncols == other.ncols && pattern == other.pattern;
+        }
+    };
+
+    struct Statistics
+    {
+        std::size_t in_use = 0;
+        std::size_t max_in_use = 0;
+        std::size_t allocated = 0;
+        std::size_t max_allocated = 0;
+    };
+
     template<bool do_search, typename... Args>
-    std::pair<GlobalMatrix*, bool> getMatrix_(std::size_t& id, Args&&... args);
+    std::pair<GlobalMatrix*, bool> getMatrix_(std::size_t& id,
+                                              Layout const& layout,
+                                              Args&&... args);
 
     template<bool do_search, typename... Args>
-    std::pair<GlobalVector*, bool> getVector_(std::size_t& id, Args&&... args);
+    std::pair<GlobalVector*, bool> getVector_(std::size_t& id,
+                                              Layout const& layout,
+                                              Args&&... args);
 
     // returns a pair with the pointer to the matrix/vector and
     // a boolean indicating if a new object has been built (then true else false)
@@ -74,15 +120,36 @@ private:
     get_(std::size_t& id,
          std::map<std::size_t, MatVec*>& unused_map,
          std::map<MatVec*, std::size_t>& used_map,
+         std::map<MatVec const*, Layout>& layouts,
+         Statistics& statistics,
+         Layout const& layout,
          Args&&... args);
 
+    template <typename MatVec>
+    void release_(MatVec const& x,
+                  std::map<std::size_t, MatVec*>& unused_map,
+                  std::map<MatVec*, std::size_t>& used_map,
+                  Statistics& statistics);
+
+    template <typename MatVec>
+    void freeUnused_(std::map<std::size_t, MatVec*>& unused_map,
+                     std::map<MatVec const*, Layout>& layouts,
+                     Statistics& statistics);
+
     std::size_t _next_id = 1;
 
     std::map<std::size_t, GlobalMatrix*> _unused_matrices;
     std::map<GlobalMatrix*, std::size_t> _used_matrices;
+    std::map<GlobalMatrix const*, Layout> _matrix_layouts;
+    Statistics _matrix_statistics;
 
     std::map<std::size_t, GlobalVector*> _unused_vectors;
     std::map<GlobalVector*, std::size_t> _used_vectors;
+    std::map<GlobalVector const*, Layout> _vector_layouts;
+    Statistics _vector_statistics;
+
+    /// Serializes the access to the maps and statistics above.
+    std::mutex _mutex;
 };
 
 
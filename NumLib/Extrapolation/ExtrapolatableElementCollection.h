@@ -13,9 +13,11 @@
 #include <functional>
 #include <vector>
 
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
 
 #include "ExtrapolatableElement.h"
+#include "IntegrationPointValuesBuffer.h"
 
 namespace NumLib
 {
@@ -67,6 +69,45 @@ public:
         std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
         std::vector<double>& cache) const = 0;
 
+    /*! Appends the integration point values of a specific element to the
+     * \c buffer of all elements' values.
+     *
+     * \param num_components The number of components of the property at each
+     * integration point.
+     *
+     * The other parameters are the same as for getIntegrationPointValues(). The
+     * default implementation copies the values returned by
+     * getIntegrationPointValues(), which are ordered component by component,
+     * into the buffer. Implementations computing the values on-the-fly can
+     * write them to the buffer directly instead.
+     */
+    virtual void appendIntegrationPointValues(
+        std::size_t const id, unsigned const num_components, const double t,
+        std::vector<GlobalVector*> const& x,
+        std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
+        IntegrationPointValuesBuffer& buffer,
+        std::vector<double>& cache) const
+    {
+        auto const& values =
+            getIntegrationPointValues(id, t, x, dof_table, cache);
+
+        if (values.size() % num_components != 0)
+        {
+            OGS_FATAL(
+                "The number of computed integration point values is not "
+                "divisable by the number of num_components. Maybe the "
+                "computed property is not a %d-component vector for each "
+                "integration point.",
+                num_components);
+        }
+        auto const num_int_pts = values.size() / num_components;
+
+        buffer.appendElement(num_int_pts, num_components) =
+            Eigen::Map<IntegrationPointValuesBuffer::Matrix const>(
+                values.data(), num_components, num_int_pts)
+                .transpose();
+    }
+
     //! Returns the number of elements whose properties shall be extrapolated.
     virtual std::size_t size() const = 0;
 
@@ -102,6 +143,16 @@ public:
             std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
             std::vector<double>& cache)>;
 
+    /*! A method appending integration point values of some property to the
+     * buffer of all elements' values, see
+     * ExtrapolatableElementCollection::appendIntegrationPointValues().
+     */
+    using IntegrationPointValuesWriter = std::function<void(
+        LocalAssembler const& loc_asm, const double t,
+        std::vector<GlobalVector*> const& x,
+        std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
+        IntegrationPointValuesBuffer& buffer)>;
+
     /*! Constructs a new instance.
      *
      * \param local_assemblers a collection of local assemblers whose
@@ -117,6 +168,22 @@ public:
     {
     }
 
+    /*! Constructs a new instance.
+     *
+     * \param local_assemblers a collection of local assemblers whose
+     * integration point values shall be extrapolated.
+     * \param integration_point_values_writer a LocalAssembler method appending
+     * integration point values of some property for that local assembler to
+     * the buffer of all elements' values.
+     */
+    ExtrapolatableLocalAssemblerCollection(
+        LocalAssemblerCollection const& local_assemblers,
+        IntegrationPointValuesWriter const& integration_point_values_writer)
+        : _local_assemblers(local_assemblers),
+          _integration_point_values_writer{integration_point_values_writer}
+    {
+    }
+
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         std::size_t const id, unsigned const integration_point) const override
     {
@@ -131,14 +198,53 @@ public:
         std::vector<double>& cache) const override
     {
         auto const& loc_asm = *_local_assemblers[id];
-        return _integration_point_values_method(loc_asm, t, x, dof_table,
-                                                cache);
+        if (_integration_point_values_method)
+        {
+            return _integration_point_values_method(loc_asm, t, x, dof_table,
+                                                    cache);
+        }
+
+        // Only a writer is given; its values are reordered component by
+        // component into the cache.
+        IntegrationPointValuesBuffer buffer;
+        _integration_point_values_writer(loc_asm, t, x, dof_table, buffer);
+        auto const values = buffer.asMatrix();
+        cache.resize(values.size());
+        Eigen::Map<IntegrationPointValuesBuffer::Matrix>(
+            cache.data(), values.cols(), values.rows()) = values.transpose();
+        return cache;
+    }
+
+    void appendIntegrationPointValues(
+        std::size_t const id, unsigned const num_components, const double t,
+        std::vector<GlobalVector*> const& x,
+        std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
+        IntegrationPointValuesBuffer& buffer,
+        std::vector<double>& cache) const override
+    {
+        if (!_integration_point_values_writer)
+        {
+            ExtrapolatableElementCollection::appendIntegrationPointValues(
+                id, num_components, t, x, dof_table, buffer, cache);
+            return;
+        }
+
+        auto const& loc_asm = *_local_assemblers[id];
+        _integration_point_values_writer(loc_asm, t, x, dof_table, buffer);
+        if (buffer.getNumberOfComponents() != num_components)
+        {
+            OGS_FATAL(
+                "The integration point values written have %d components, "
+                "but %d components were expected.",
+                buffer.getNumberOfComponents(), num_components);
+        }
     }
 
     std::size_t size() const override { return _local_assemblers.size(); }
 private:
     LocalAssemblerCollection const& _local_assemblers;
     IntegrationPointValuesMethod const _integration_point_values_method;
+    IntegrationPointValuesWriter const _integration_point_values_writer;
 };
 
 //! Creates an ExtrapolatableLocalAssemblerCollection, which can be used to
@@ -0,0 +1,95 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "BaseLib/Error.h"
+
+namespace NumLib
+{
+/*! Contiguous storage of the integration point values of all elements.
+ *
+ * The values are stored in one row-major matrix with one row per integration
+ * point and one column per component. The elements' values are appended one
+ * after the other; the rows of the element appended as the \c i-th one start
+ * at getOffsets()[i].
+ *
+ * The storage is kept by clear(), so a buffer filled repeatedly for the same
+ * elements is allocated only once.
+ */
+class IntegrationPointValuesBuffer
+{
+public:
+    using Matrix =
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+    //! Removes all values.
+    void clear()
+    {
+        _num_components = 0;
+        _values.clear();
+        _offsets.assign(1, 0);
+    }
+
+    //! Appends the rows of an element with \c num_integration_points
+    //! integration points and returns them to be written by the caller. All
+    //! elements must have the same number of components.
+    //!
+    //! \attention The returned block is valid only until the next call of
+    //! appendElement() or clear().
+    Eigen::Map<Matrix> appendElement(std::size_t const num_integration_points,
+                                     unsigned const num_components)
+    {
+        if (_offsets.size() == 1)
+        {
+            _num_components = num_components;
+        }
+        else if (num_components != _num_components)
+        {
+            OGS_FATAL(
+                "Integration point values with %d components can not be "
+                "appended to values with %d components.",
+                num_components, _num_components);
+        }
+
+        auto const offset = _offsets.back();
+        _offsets.push_back(offset + num_integration_points);
+        _values.resize(_offsets.back() * _num_components);
+        return {_values.data() + offset * _num_components,
+                static_cast<Eigen::Index>(num_integration_points),
+                static_cast<Eigen::Index>(_num_components)};
+    }
+
+    //! The number of components of the values, or zero if no element was
+    //! appended yet.
+    unsigned getNumberOfComponents() const { return _num_components; }
+
+    //! Offsets of the elements' rows; the last entry is the total number of
+    //! integration points.
+    std::vector<std::size_t> const& getOffsets() const { return _offsets; }
+
+    //! The values of all elements appended since the last clear().
+    Eigen::Map<Matrix const> asMatrix() const
+    {
+        return {_values.data(), static_cast<Eigen::Index>(_offsets.back()),
+                static_cast<Eigen::Index>(_num_components)};
+    }
+
+private:
+    unsigned _num_components = 0;
+    std::vector<double> _values;
+    std::vector<std::size_t> _offsets{0};
+};
+}  // namespace NumLib
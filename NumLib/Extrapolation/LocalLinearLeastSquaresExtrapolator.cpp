@@ -11,12 +11,12 @@
 #include "LocalLinearLeastSquaresExtrapolator.h"
 
 #include <Eigen/SVD>
+#include <unordered_map>
 #include <logog/include/logog.hpp>
 
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
-#include "NumLib/Assembler/SerialExecutor.h"
 #include "NumLib/Function/Interpolation.h"
 #include "ExtrapolatableElementCollection.h"
 
@@ -85,19 +85,38 @@ void LocalLinearLeastSquaresExtrapolator::extrapolate(
     }
     _nodal_values->setZero();
 
+    gatherIntegrationPointValues(num_components, extrapolatables, t, x,
+                                 dof_table);
+
+    // The sums of the element-wise least squares solutions. Both, the
+    // integration point values and the result, are stored location-wise.
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> const
+        nodal_values =
+            _extrapolation_operator * _integration_point_values.asMatrix();
+
+    auto const indices = getNodalIndices(num_components);
+    std::vector<double> counts_values;
+    counts_values.reserve(indices.size());
+    for (auto const count : _operator_counts)
+    {
+        counts_values.insert(counts_values.end(), num_components, count);
+    }
+
     // counts the writes to each nodal value, i.e., the summands in order to
     // compute the average afterwards
     auto counts =
         MathLib::MatrixVectorTraits<GlobalVector>::newInstance(*_nodal_values);
     counts->setZero();
 
-    auto const size = extrapolatables.size();
-    for (std::size_t i = 0; i < size; ++i)
+    if (!indices.empty())
     {
-        extrapolateElement(i, num_components, extrapolatables, t, x, dof_table,
-                           *counts);
+        // Nodal_values are passed as a raw pointer, because PETScVector and
+        // EigenVector implementations differ slightly.
+        _nodal_values->add(indices, nodal_values.data());
+        counts->add(indices, counts_values.data());
     }
     MathLib::LinAlg::finalizeAssembly(*_nodal_values);
+    MathLib::LinAlg::finalizeAssembly(*counts);
 
     MathLib::LinAlg::componentwiseDivide(*_nodal_values, *_nodal_values,
                                          *counts);
@@ -106,9 +125,9 @@ void LocalLinearLeastSquaresExtrapolator::extrapolate(
 void LocalLinearLeastSquaresExtrapolator::calculateResiduals(
     const unsigned num_components,
     ExtrapolatableElementCollection const& extrapolatables,
-    const double t,
-    std::vector<GlobalVector*> const& x,
-    std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table)
+    const double /*t*/,
+    std::vector<GlobalVector*> const& /*x*/,
+    std::vector<NumLib::LocalToGlobalIndexMap const*> const& /*dof_table*/)
 {
     auto const num_element_dof_result = static_cast<GlobalIndexType>(
         _dof_table_single_component.size() * num_components);
@@ -128,207 +147,211 @@ void LocalLinearLeastSquaresExtrapolator::calculateResiduals(
         OGS_FATAL("mismatch in number of D.o.F.");
     }
 
+    // The integration point values gathered by extrapolate() are reused.
+    auto const& offsets = _integration_point_values.getOffsets();
+    if (offsets.size() != extrapolatables.size() + 1 ||
+        (offsets.back() > 0 &&
+         _integration_point_values.getNumberOfComponents() != num_components))
+    {
+        OGS_FATAL(
+            "The residuals can be calculated only for the most recent "
+            "extrapolation.");
+    }
+
+    MathLib::LinAlg::setLocalAccessibleVector(*_nodal_values);
+    auto const nodal_values_vec =
+        _nodal_values->get(getNodalIndices(num_components));
+    auto const nodal_values = MathLib::toMatrix(
+        nodal_values_vec, _operator_indices.size(), num_components);
+
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> const
+        differences = _interpolation_operator * nodal_values -
+                      _integration_point_values.asMatrix();
+
     auto const size = extrapolatables.size();
-    for (std::size_t i = 0; i < size; ++i)
+    for (std::size_t element_index = 0; element_index < size; ++element_index)
     {
-        calculateResidualElement(i, num_components, extrapolatables, t, x,
-                                 dof_table);
+        auto const offset = offsets[element_index];
+        auto const num_int_pts = offsets[element_index + 1] - offset;
+
+        for (unsigned comp = 0; comp < num_components; ++comp)
+        {
+            double const residual =
+                differences.col(comp).segment(offset, num_int_pts).squaredNorm();
+
+            auto const eidx = static_cast<GlobalIndexType>(
+                num_components * element_index + comp);
+            // The residual is set to the root mean square value.
+            auto const root_mean_square = std::sqrt(residual / num_int_pts);
+            _residuals->set(eidx, root_mean_square);
+        }
     }
     MathLib::LinAlg::finalizeAssembly(*_residuals);
 }
 
-void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
-    std::size_t const element_index,
+void LocalLinearLeastSquaresExtrapolator::gatherIntegrationPointValues(
     const unsigned num_components,
     ExtrapolatableElementCollection const& extrapolatables,
     const double t,
     std::vector<GlobalVector*> const& x,
-    std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
-    GlobalVector& counts)
+    std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table)
 {
-    auto const& integration_point_values =
-        extrapolatables.getIntegrationPointValues(
-            element_index, t, x, dof_table, _integration_point_values_cache);
-
-    auto const& N_0 = extrapolatables.getShapeMatrix(element_index, 0);
-    auto const num_nodes = static_cast<unsigned>(N_0.cols());
-    auto const num_values =
-        static_cast<unsigned>(integration_point_values.size());
-
-    if (num_values % num_components != 0)
+    _integration_point_values.clear();
+    auto const size = extrapolatables.size();
+    for (std::size_t element_index = 0; element_index < size; ++element_index)
     {
-        OGS_FATAL(
-            "The number of computed integration point values is not divisable "
-            "by the number of num_components. Maybe the computed property is "
-            "not a %d-component vector for each integration point.",
-            num_components);
+        extrapolatables.appendIntegrationPointValues(
+            element_index, num_components, t, x, dof_table,
+            _integration_point_values, _integration_point_values_cache);
     }
 
-    // number of integration points in the element
-    const auto num_int_pts = num_values / num_components;
-
-    if (num_int_pts < num_nodes)
+    auto const& offsets = _integration_point_values.getOffsets();
+    if (offsets != _operator_integration_point_offsets)
     {
-        OGS_FATAL(
-            "Least squares is not possible if there are more nodes than"
-            "integration points.");
+        buildOperators(extrapolatables);
+        _operator_integration_point_offsets = offsets;
     }
+}
+
+void LocalLinearLeastSquaresExtrapolator::buildOperators(
+    ExtrapolatableElementCollection const& extrapolatables)
+{
+    DBUG("Assembling the extrapolation operator.");
+
+    _operator_indices.clear();
+    _operator_counts.clear();
+    std::unordered_map<GlobalIndexType, Eigen::Index> operator_rows;
 
-    auto const pair_it_inserted = _qr_decomposition_cache.emplace(
-        std::make_pair(num_nodes, num_int_pts), CachedData{});
+    std::vector<Eigen::Triplet<double>> extrapolation_entries;
+    std::vector<Eigen::Triplet<double>> interpolation_entries;
 
-    auto& cached_data = pair_it_inserted.first->second;
-    if (pair_it_inserted.second)
+    auto const& offsets = _integration_point_values.getOffsets();
+    auto const size = extrapolatables.size();
+    for (std::size_t element_index = 0; element_index < size; ++element_index)
     {
-        DBUG("Computing new singular value decomposition");
+        auto const offset = offsets[element_index];
+        auto const num_int_pts =
+            static_cast<unsigned>(offsets[element_index + 1] - offset);
 
-        // interpolation_matrix * nodal_values = integration_point_values
-        // We are going to pseudo-invert this relation now using singular value
-        // decomposition.
-        auto& interpolation_matrix = cached_data.A;
-        interpolation_matrix.resize(num_int_pts, num_nodes);
+        auto const& N_0 = extrapolatables.getShapeMatrix(element_index, 0);
+        auto const num_nodes = static_cast<unsigned>(N_0.cols());
 
-        interpolation_matrix.row(0) = N_0;
-        for (unsigned int_pt = 1; int_pt < num_int_pts; ++int_pt)
+        if (num_int_pts < num_nodes)
         {
-            auto const& shp_mat =
-                extrapolatables.getShapeMatrix(element_index, int_pt);
-            assert(shp_mat.cols() == num_nodes);
-
-            // copy shape matrix to extrapolation matrix row-wise
-            interpolation_matrix.row(int_pt) = shp_mat;
+            OGS_FATAL(
+                "Least squares is not possible if there are more nodes than"
+                "integration points.");
         }
 
-        // JacobiSVD is extremely reliable, but fast only for small matrices.
-        // But we usually have small matrices and we don't compute very often.
-        // Cf.
-        // http://eigen.tuxfamily.org/dox/group__TopicLinearAlgebraDecompositions.html
-        //
-        // Decomposes interpolation_matrix = U S V^T.
-        Eigen::JacobiSVD<Eigen::MatrixXd> svd(
-            interpolation_matrix, Eigen::ComputeThinU | Eigen::ComputeThinV);
-
-        auto const& S = svd.singularValues();
-        auto const& U = svd.matrixU();
-        auto const& V = svd.matrixV();
-
-        // Compute and save the pseudo inverse V * S^{-1} * U^T.
-        auto const rank = svd.rank();
-        assert(rank == num_nodes);
-
-        // cf. http://eigen.tuxfamily.org/dox/JacobiSVD_8h_source.html
-        cached_data.A_pinv.noalias() = V.leftCols(rank) *
-                                       S.head(rank).asDiagonal().inverse() *
-                                       U.leftCols(rank).transpose();
-    }
-    else if (cached_data.A.row(0) != N_0)
-    {
-        OGS_FATAL("The cached and the passed shapematrices differ.");
-    }
+        auto const pair_it_inserted = _qr_decomposition_cache.emplace(
+            std::make_pair(num_nodes, num_int_pts), CachedData{});
 
-    auto const& global_indices =
-        _dof_table_single_component(element_index, 0).rows;
+        auto& cached_data = pair_it_inserted.first->second;
+        if (pair_it_inserted.second)
+        {
+            DBUG("Computing new singular value decomposition");
 
-    if (num_components == 1)
-    {
-        auto const integration_point_values_vec =
-            MathLib::toVector(integration_point_values);
-
-        // Apply the pre-computed pseudo-inverse.
-        Eigen::VectorXd const nodal_values =
-            cached_data.A_pinv * integration_point_values_vec;
-
-        // TODO does that give rise to PETSc problems? E.g., writing to ghost
-        // nodes? Furthermore: Is ghost nodes communication necessary for PETSc?
-        _nodal_values->add(global_indices, nodal_values);
-        counts.add(global_indices,
-                   std::vector<double>(global_indices.size(), 1.0));
-    }
-    else
-    {
-        auto const integration_point_values_mat = MathLib::toMatrix(
-            integration_point_values, num_components, num_int_pts);
+            // interpolation_matrix * nodal_values = integration_point_values
+            // We are going to pseudo-invert this relation now using singular
+            // value decomposition.
+            auto& interpolation_matrix = cached_data.A;
+            interpolation_matrix.resize(num_int_pts, num_nodes);
 
-        // Apply the pre-computed pseudo-inverse.
-        Eigen::MatrixXd const nodal_values =
-            cached_data.A_pinv * integration_point_values_mat.transpose();
+            interpolation_matrix.row(0) = N_0;
+            for (unsigned int_pt = 1; int_pt < num_int_pts; ++int_pt)
+            {
+                auto const& shp_mat =
+                    extrapolatables.getShapeMatrix(element_index, int_pt);
+                assert(shp_mat.cols() == num_nodes);
 
-        std::vector<GlobalIndexType> indices;
-        indices.reserve(num_components * global_indices.size());
+                // copy shape matrix to extrapolation matrix row-wise
+                interpolation_matrix.row(int_pt) = shp_mat;
+            }
 
-        // _nodal_values is ordered location-wise
-        for (unsigned comp = 0; comp < num_components; ++comp)
+            // JacobiSVD is extremely reliable, but fast only for small
+            // matrices. But we usually have small matrices and we don't
+            // compute very often. Cf.
+            // http://eigen.tuxfamily.org/dox/group__TopicLinearAlgebraDecompositions.html
+            //
+            // Decomposes interpolation_matrix = U S V^T.
+            Eigen::JacobiSVD<Eigen::MatrixXd> svd(
+                interpolation_matrix,
+                Eigen::ComputeThinU | Eigen::ComputeThinV);
+
+            auto const& S = svd.singularValues();
+            auto const& U = svd.matrixU();
+            auto const& V = svd.matrixV();
+
+            // Compute and save the pseudo inverse V * S^{-1} * U^T.
+            auto const rank = svd.rank();
+            assert(rank == num_nodes);
+
+            // cf. http://eigen.tuxfamily.org/dox/JacobiSVD_8h_source.html
+            cached_data.A_pinv.noalias() = V.leftCols(rank) *
+                                           S.head(rank).asDiagonal().inverse() *
+                                           U.leftCols(rank).transpose();
+        }
+        else if (cached_data.A.row(0) != N_0)
         {
-            for (auto i : global_indices)
-            {
-                indices.push_back(num_components * i + comp);
-            }
+            OGS_FATAL("The cached and the passed shapematrices differ.");
         }
 
-        // Nodal_values are passed as a raw pointer, because PETScVector and
-        // EigenVector implementations differ slightly.
-        _nodal_values->add(indices, nodal_values.data());
-        counts.add(indices, std::vector<double>(indices.size(), 1.0));
-    }
-}
+        auto const& global_indices =
+            _dof_table_single_component(element_index, 0).rows;
 
-void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
-    std::size_t const element_index,
-    const unsigned num_components,
-    ExtrapolatableElementCollection const& extrapolatables,
-    const double t,
-    std::vector<GlobalVector*> const& x,
-    std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table)
-{
-    auto const& int_pt_vals = extrapolatables.getIntegrationPointValues(
-        element_index, t, x, dof_table, _integration_point_values_cache);
+        for (unsigned i = 0; i < num_nodes; ++i)
+        {
+            auto const row_inserted = operator_rows.emplace(
+                global_indices[i],
+                static_cast<Eigen::Index>(_operator_indices.size()));
+            if (row_inserted.second)
+            {
+                _operator_indices.push_back(global_indices[i]);
+                _operator_counts.push_back(0.0);
+            }
+            auto const row = row_inserted.first->second;
+            _operator_counts[row] += 1.0;
 
-    auto const num_values = static_cast<unsigned>(int_pt_vals.size());
-    if (num_values % num_components != 0)
-    {
-        OGS_FATAL(
-            "The number of computed integration point values is not divisable "
-            "by the number of num_components. Maybe the computed property is "
-            "not a %d-component vector for each integration point.",
-            num_components);
+            for (unsigned int_pt = 0; int_pt < num_int_pts; ++int_pt)
+            {
+                auto const column =
+                    static_cast<Eigen::Index>(offset + int_pt);
+                extrapolation_entries.emplace_back(
+                    row, column, cached_data.A_pinv(i, int_pt));
+                interpolation_entries.emplace_back(
+                    column, row, cached_data.A(int_pt, i));
+            }
+        }
     }
 
-    // number of integration points in the element
-    const auto num_int_pts = num_values / num_components;
-
-    const auto& global_indices =
-        _dof_table_single_component(element_index, 0).rows;
-    const auto num_nodes = static_cast<unsigned>(global_indices.size());
+    auto const num_rows = static_cast<Eigen::Index>(_operator_indices.size());
+    auto const num_columns =
+        static_cast<Eigen::Index>(offsets.back());
 
-    auto const& interpolation_matrix =
-        _qr_decomposition_cache.find({num_nodes, num_int_pts})->second.A;
+    _extrapolation_operator.resize(num_rows, num_columns);
+    _extrapolation_operator.setFromTriplets(extrapolation_entries.begin(),
+                                            extrapolation_entries.end());
+    _interpolation_operator.resize(num_columns, num_rows);
+    _interpolation_operator.setFromTriplets(interpolation_entries.begin(),
+                                            interpolation_entries.end());
+}
 
-    Eigen::VectorXd nodal_vals_element(num_nodes);
-    auto const int_pt_vals_mat =
-        MathLib::toMatrix(int_pt_vals, num_components, num_int_pts);
+std::vector<GlobalIndexType> LocalLinearLeastSquaresExtrapolator::getNodalIndices(
+    const unsigned num_components) const
+{
+    std::vector<GlobalIndexType> indices;
+    indices.reserve(num_components * _operator_indices.size());
 
-    MathLib::LinAlg::setLocalAccessibleVector(
-        *_nodal_values);  // For access in the for-loop.
-    for (unsigned comp = 0; comp < num_components; ++comp)
+    // _nodal_values is ordered location-wise
+    for (auto const i : _operator_indices)
     {
-        // filter nodal values of the current element
-        for (unsigned i = 0; i < num_nodes; ++i)
+        for (unsigned comp = 0; comp < num_components; ++comp)
         {
             // TODO PETSc negative indices?
-            auto const idx = num_components * global_indices[i] + comp;
-            nodal_vals_element[i] = _nodal_values->get(idx);
+            indices.push_back(num_components * i + comp);
         }
-
-        double const residual = (interpolation_matrix * nodal_vals_element -
-                                 int_pt_vals_mat.row(comp).transpose())
-                                    .squaredNorm();
-
-        auto const eidx =
-            static_cast<GlobalIndexType>(num_components * element_index + comp);
-        // The residual is set to the root mean square value.
-        auto const root_mean_square = std::sqrt(residual / num_int_pts);
-        _residuals->set(eidx, root_mean_square);
     }
+    return indices;
 }
 
 }  // namespace NumLib
@@ -12,9 +12,12 @@
 
 #include <map>
 
+#include <Eigen/Sparse>
+
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "NumLib/DOF/GlobalMatrixProviders.h"
 #include "Extrapolator.h"
+#include "IntegrationPointValuesBuffer.h"
 
 namespace NumLib
 {
@@ -34,6 +37,12 @@ namespace NumLib
  * to the use of the least squares which requires an exact or overdetermined
  * equation system.
  * \endparblock
+ *
+ * The element-wise pseudo-inverses are assembled once into a sparse
+ * extrapolation operator mapping all integration point values to the nodal
+ * values. It is rebuilt only if the number of integration points of some
+ * element changes. The extrapolation and the residual computation are sparse
+ * matrix products then, which are threaded by Eigen if OpenMP is enabled.
  */
 class LocalLinearLeastSquaresExtrapolator : public Extrapolator
 {
@@ -80,23 +89,25 @@ public:
     }
 
 private:
-    //! Extrapolate one element.
-    void extrapolateElement(
-        std::size_t const element_index, const unsigned num_components,
-        ExtrapolatableElementCollection const& extrapolatables, const double t,
-        std::vector<GlobalVector*> const& x,
-        std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
-        GlobalVector& counts);
-
-    //! Compute the residuals for one element
-    void calculateResidualElement(
-        std::size_t const element_index,
+    //! Collects the integration point values of all elements into
+    //! _integration_point_values and rebuilds the extrapolation operators if
+    //! the numbers of integration points have changed.
+    void gatherIntegrationPointValues(
         const unsigned num_components,
-        ExtrapolatableElementCollection const& extrapolatables,
-        const double t,
+        ExtrapolatableElementCollection const& extrapolatables, const double t,
         std::vector<GlobalVector*> const& x,
         std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table);
 
+    //! Assembles the sparse extrapolation and interpolation operators from
+    //! the element-wise pseudo-inverses.
+    void buildOperators(
+        ExtrapolatableElementCollection const& extrapolatables);
+
+    //! Returns the global indices of the operator rows for each component,
+    //! ordered location-wise like _nodal_values.
+    std::vector<GlobalIndexType> getNodalIndices(
+        const unsigned num_components) const;
+
     std::unique_ptr<GlobalVector> _nodal_values;  //!< extrapolated nodal values
     std::unique_ptr<GlobalVector> _residuals;     //!< extrapolation residuals
 
@@ -106,6 +117,27 @@ private:
     //! Avoids frequent reallocations.
     std::vector<double> _integration_point_values_cache;
 
+    //! Integration point values of all elements, written directly by the
+    //! extrapolatables; one column per component. Its storage is reused by
+    //! subsequent extrapolations.
+    IntegrationPointValuesBuffer _integration_point_values;
+
+    //! Offsets of the integration points the operators were built for.
+    std::vector<std::size_t> _operator_integration_point_offsets;
+
+    //! Global single-component indices of the operator rows.
+    std::vector<GlobalIndexType> _operator_indices;
+
+    //! Number of elements contributing to each operator row.
+    std::vector<double> _operator_counts;
+
+    //! Maps the integration point values to the (not yet averaged) nodal
+    //! values. Its rows correspond to _operator_indices.
+    Eigen::SparseMatrix<double, Eigen::RowMajor> _extrapolation_operator;
+
+    //! Interpolates the nodal values back to the integration points.
+    Eigen::SparseMatrix<double, Eigen::RowMajor> _interpolation_operator;
+
     //! Stores a matrix and its Moore-Penrose pseudo-inverse.
     struct CachedData
     {
@@ -13,6 +13,7 @@
 #include "MathLib/Integration/GaussLegendre.h"
 #include "MathLib/Integration/GaussLegendreTri.h"
 #include "MathLib/TemplateWeightedPoint.h"
+#include "WeightedPointTable.h"
 
 namespace NumLib
 {
@@ -39,6 +40,9 @@ public:
     {
         _order = 2;  // fixed
         _n_sampl_pt = getNumberOfPoints(_order);
+        _weighted_points =
+            getWeightedPointTable<IntegrationGaussLegendrePrism,
+                                  WeightedPoint>(_order);
     }
 
     /// return current integration order.
@@ -50,7 +54,10 @@ public:
     /// \copydoc NumLib::IntegrationGaussLegendreRegular::getWeightedPoint(unsigned) const
     WeightedPoint getWeightedPoint(unsigned igp) const
     {
-        return getWeightedPoint(getIntegrationOrder(), igp);
+        // Unsupported orders are not tabulated.
+        return _weighted_points != nullptr
+                   ? _weighted_points[igp]
+                   : getWeightedPoint(getIntegrationOrder(), igp);
     }
 
     /// \copydoc NumLib::IntegrationGaussLegendreRegular::getWeightedPoint(unsigned, unsigned)
@@ -90,6 +97,8 @@ public:
 private:
     unsigned _order{2};
     unsigned _n_sampl_pt{0};
+    //! The weighted points of the current order.
+    WeightedPoint const* _weighted_points = nullptr;
 };
 
 }  // namespace NumLib
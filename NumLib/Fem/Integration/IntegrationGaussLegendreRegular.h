@@ -17,6 +17,7 @@
 
 #include "MathLib/Integration/GaussLegendre.h"
 #include "MathLib/TemplateWeightedPoint.h"
+#include "WeightedPointTable.h"
 
 namespace NumLib
 {
@@ -43,8 +44,11 @@ public:
     /// Change the integration order.
     void setIntegrationOrder(unsigned order)
     {
-        this->_n_sampl_pt = static_cast<unsigned>(std::pow(order, N_DIM));
+        this->_n_sampl_pt = getNumberOfPoints(order);
         this->_order = order;
+        _weighted_points =
+            getWeightedPointTable<IntegrationGaussLegendreRegular<N_DIM>,
+                                  WeightedPoint>(_order);
     }
 
     /// return current integration order.
@@ -53,13 +57,25 @@ public:
     /// return the number of sampling points
     unsigned getNumberOfPoints() const { return _n_sampl_pt; }
 
+    /// Get the number of integration points.
+    ///
+    /// @param order     The number of integration points per direction
+    /// @return the number of points
+    static unsigned getNumberOfPoints(unsigned order)
+    {
+        return static_cast<unsigned>(std::pow(order, N_DIM));
+    }
+
     /// Get coordinates of the integration point.
     ///
     /// @param igp       The integration point index
     /// @return a weighted point
     WeightedPoint getWeightedPoint(unsigned igp) const
     {
-        return getWeightedPoint(getIntegrationOrder(), igp);
+        // Unsupported orders are not tabulated.
+        return _weighted_points != nullptr
+                   ? _weighted_points[igp]
+                   : getWeightedPoint(getIntegrationOrder(), igp);
     }
 
     /// Get position indexes in r-s-t axis.
@@ -89,6 +105,8 @@ private:
 private:
     unsigned _order;
     unsigned _n_sampl_pt{0};
+    //! The weighted points of the current order.
+    WeightedPoint const* _weighted_points = nullptr;
 };
 
 }  // namespace NumLib
@@ -12,6 +12,7 @@
 
 #include "MathLib/Integration/GaussLegendreTet.h"
 #include "MathLib/TemplateWeightedPoint.h"
+#include "WeightedPointTable.h"
 
 namespace NumLib
 {
@@ -38,6 +39,9 @@ public:
     {
         _order = order;
         _n_sampl_pt = getNumberOfPoints(order);
+        _weighted_points =
+            getWeightedPointTable<IntegrationGaussLegendreTet,
+                                  WeightedPoint>(_order);
     }
 
     /// return current integration order.
@@ -54,7 +58,10 @@ public:
      */
     WeightedPoint getWeightedPoint(unsigned igp) const
     {
-        return getWeightedPoint(getIntegrationOrder(), igp);
+        // Unsupported orders are not tabulated.
+        return _weighted_points != nullptr
+                   ? _weighted_points[igp]
+                   : getWeightedPoint(getIntegrationOrder(), igp);
     }
 
     /**
@@ -107,6 +114,8 @@ public:
 private:
     unsigned _order;
     unsigned _n_sampl_pt{0};
+    //! The weighted points of the current order.
+    WeightedPoint const* _weighted_points = nullptr;
 };
 
 }  // namespace NumLib
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+namespace NumLib
+{
+/// Returns the weighted points of the integration rule \c Method for the given
+/// \c order, or a nullptr if the order is not supported.
+///
+/// The points of all supported orders are computed once by
+/// Method::getWeightedPoint(order, igp), such that the integration loops read
+/// them from a table instead of computing position indices and dispatching on
+/// the order for each point.
+template <typename Method, typename WeightedPoint>
+WeightedPoint const* getWeightedPointTable(unsigned const order)
+{
+    constexpr unsigned max_order = 4;
+    static std::array<std::vector<WeightedPoint>, max_order + 1> const tables =
+        [] {
+            std::array<std::vector<WeightedPoint>, max_order + 1> tables;
+            for (unsigned o = 1; o <= max_order; ++o)
+            {
+                unsigned const n_points = Method::getNumberOfPoints(o);
+                tables[o].reserve(n_points);
+                for (unsigned igp = 0; igp < n_points; ++igp)
+                {
+                    tables[o].push_back(Method::getWeightedPoint(o, igp));
+                }
+            }
+            return tables;
+        }();
+
+    if (order > max_order || tables[order].empty())
+    {
+        return nullptr;
+    }
+    return tables[order].data();
+}
+}  // namespace NumLib
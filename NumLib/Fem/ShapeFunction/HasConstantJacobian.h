@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <type_traits>
+
+namespace NumLib
+{
+class ShapeLine2;
+class ShapeTri3;
+class ShapeTet4;
+
+/// Compile-time trait for shape functions with an affine mapping between the
+/// natural and the physical element, i.e. linear simplices. For those the
+/// derivatives dNdr, the Jacobian, its inverse and dNdx are constant within an
+/// element and need to be computed only once.
+template <typename ShapeFunction>
+struct HasConstantJacobian : std::false_type
+{
+};
+
+template <>
+struct HasConstantJacobian<ShapeLine2> : std::true_type
+{
+};
+
+template <>
+struct HasConstantJacobian<ShapeTri3> : std::true_type
+{
+};
+
+template <>
+struct HasConstantJacobian<ShapeTet4> : std::true_type
+{
+};
+
+template <typename ShapeFunction>
+constexpr bool hasConstantJacobian = HasConstantJacobian<ShapeFunction>::value;
+}  // namespace NumLib
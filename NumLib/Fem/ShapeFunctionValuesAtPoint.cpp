@@ -0,0 +1,179 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ShapeFunctionValuesAtPoint.h"
+
+#include <array>
+
+#include <Eigen/Dense>
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex20.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "NumLib/Fem/ShapeFunction/ShapeLine2.h"
+#include "NumLib/Fem/ShapeFunction/ShapeLine3.h"
+#include "NumLib/Fem/ShapeFunction/ShapePrism15.h"
+#include "NumLib/Fem/ShapeFunction/ShapePrism6.h"
+#include "NumLib/Fem/ShapeFunction/ShapePyra13.h"
+#include "NumLib/Fem/ShapeFunction/ShapePyra5.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad4.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad8.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad9.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTet10.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTet4.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTri3.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTri6.h"
+
+namespace NumLib
+{
+namespace
+{
+using NaturalCoordinates = std::array<double, 3>;
+
+//! Computes the natural coordinates of the point \c p in the \c element by
+//! Newton's method starting at \c r. For elements of a lower dimension than
+//! the space the distance to the element is minimized.
+template <typename ShapeFunction>
+NaturalCoordinates naturalCoordinates(MeshLib::Element const& element,
+                                      MathLib::Point3d const& p,
+                                      NaturalCoordinates r)
+{
+    constexpr int dim = ShapeFunction::DIM;
+    constexpr int n_nodes = ShapeFunction::NPOINTS;
+    std::array<double, n_nodes> N;
+    std::array<double, dim * n_nodes> dN;
+
+    int const max_iterations = 20;
+    for (int iteration = 0; iteration < max_iterations; ++iteration)
+    {
+        ShapeFunction::computeShapeFunction(r, N);
+        ShapeFunction::computeGradShapeFunction(r, dN);
+
+        Eigen::Vector3d residual(p[0], p[1], p[2]);
+        Eigen::Matrix<double, 3, dim> J =
+            Eigen::Matrix<double, 3, dim>::Zero();
+        for (int i = 0; i < n_nodes; ++i)
+        {
+            auto const& x = *element.getNode(i);
+            for (int k = 0; k < 3; ++k)
+            {
+                residual[k] -= N[i] * x[k];
+                for (int d = 0; d < dim; ++d)
+                {
+                    J(k, d) += dN[d * n_nodes + i] * x[k];
+                }
+            }
+        }
+
+        Eigen::Matrix<double, dim, 1> const dr =
+            (J.transpose() * J).ldlt().solve(J.transpose() * residual);
+        for (int d = 0; d < dim; ++d)
+        {
+            r[d] += dr[d];
+        }
+        if (dr.norm() < 1e-12)
+        {
+            return r;
+        }
+    }
+    WARN(
+        "The natural coordinates of the point (%g, %g, %g) in element %d did "
+        "not converge.",
+        p[0], p[1], p[2], element.getID());
+    return r;
+}
+
+template <typename ShapeFunction>
+std::vector<double> shapeFunctionValues(NaturalCoordinates const& r)
+{
+    std::array<double, ShapeFunction::NPOINTS> N;
+    ShapeFunction::computeShapeFunction(r, N);
+    return {N.begin(), N.end()};
+}
+
+//! The initial guess \c r is the center of the reference element.
+template <typename ShapeFunction, typename LinearShapeFunction>
+std::pair<std::vector<double>, std::vector<double>> shapeFunctionValuesAt(
+    MeshLib::Element const& element, MathLib::Point3d const& p,
+    NaturalCoordinates const& r)
+{
+    auto const r_p = naturalCoordinates<ShapeFunction>(element, p, r);
+    return {shapeFunctionValues<ShapeFunction>(r_p),
+            shapeFunctionValues<LinearShapeFunction>(r_p)};
+}
+}  // namespace
+
+std::pair<std::vector<double>, std::vector<double>> shapeFunctionValuesAtPoint(
+    MeshLib::Element const& element, MathLib::Point3d const& p)
+{
+    NaturalCoordinates const center{{0, 0, 0}};
+    NaturalCoordinates const triangle_center{{1. / 3, 1. / 3, 0}};
+    NaturalCoordinates const tetrahedron_center{{0.25, 0.25, 0.25}};
+
+    switch (element.getCellType())
+    {
+        case MeshLib::CellType::POINT1:
+            return {{1.}, {1.}};
+        case MeshLib::CellType::LINE2:
+            return shapeFunctionValuesAt<ShapeLine2, ShapeLine2>(element, p,
+                                                                 center);
+        case MeshLib::CellType::LINE3:
+            return shapeFunctionValuesAt<ShapeLine3, ShapeLine2>(element, p,
+                                                                 center);
+        case MeshLib::CellType::TRI3:
+            return shapeFunctionValuesAt<ShapeTri3, ShapeTri3>(
+                element, p, triangle_center);
+        case MeshLib::CellType::TRI6:
+            return shapeFunctionValuesAt<ShapeTri6, ShapeTri3>(
+                element, p, triangle_center);
+        case MeshLib::CellType::QUAD4:
+            return shapeFunctionValuesAt<ShapeQuad4, ShapeQuad4>(element, p,
+                                                                 center);
+        case MeshLib::CellType::QUAD8:
+            return shapeFunctionValuesAt<ShapeQuad8, ShapeQuad4>(element, p,
+                                                                 center);
+        case MeshLib::CellType::QUAD9:
+            return shapeFunctionValuesAt<ShapeQuad9, ShapeQuad4>(element, p,
+                                                                 center);
+        case MeshLib::CellType::TET4:
+            return shapeFunctionValuesAt<ShapeTet4, ShapeTet4>(
+                element, p, tetrahedron_center);
+        case MeshLib::CellType::TET10:
+            return shapeFunctionValuesAt<ShapeTet10, ShapeTet4>(
+                element, p, tetrahedron_center);
+        case MeshLib::CellType::HEX8:
+            return shapeFunctionValuesAt<ShapeHex8, ShapeHex8>(element, p,
+                                                               center);
+        case MeshLib::CellType::HEX20:
+            return shapeFunctionValuesAt<ShapeHex20, ShapeHex8>(element, p,
+                                                                center);
+        case MeshLib::CellType::PRISM6:
+            return shapeFunctionValuesAt<ShapePrism6, ShapePrism6>(
+                element, p, triangle_center);
+        case MeshLib::CellType::PRISM15:
+            return shapeFunctionValuesAt<ShapePrism15, ShapePrism6>(
+                element, p, triangle_center);
+        case MeshLib::CellType::PYRAMID5:
+            return shapeFunctionValuesAt<ShapePyra5, ShapePyra5>(element, p,
+                                                                 center);
+        case MeshLib::CellType::PYRAMID13:
+            return shapeFunctionValuesAt<ShapePyra13, ShapePyra5>(element, p,
+                                                                  center);
+        default:
+            OGS_FATAL(
+                "Shape function values at a point are not supported in "
+                "elements of cell type %d.",
+                static_cast<int>(element.getCellType()));
+    }
+}
+}  // namespace NumLib
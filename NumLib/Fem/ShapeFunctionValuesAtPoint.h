@@ -0,0 +1,34 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "MathLib/Point3d.h"
+
+namespace MeshLib
+{
+class Element;
+}
+
+namespace NumLib
+{
+//! Returns the shape function values at the point \c p for all nodes and for
+//! the base nodes of the \c element, e.g., for interpolating linear variables
+//! on higher order meshes.
+//!
+//! The natural coordinates of the point are computed by Newton's method. For
+//! elements of a lower dimension than the space the distance to the element
+//! is minimized. The point is not required to be inside the element.
+std::pair<std::vector<double>, std::vector<double>> shapeFunctionValuesAtPoint(
+    MeshLib::Element const& element, MathLib::Point3d const& p);
+}  // namespace NumLib
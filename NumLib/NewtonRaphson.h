@@ -15,6 +15,8 @@
 
 #include <Eigen/Dense>
 
+#include "BaseLib/Error.h"
+
 namespace NumLib
 {
 
@@ -22,12 +24,19 @@ struct NewtonRaphsonSolverParameters
 {
     int const maximum_iterations;
     double const error_tolerance;
+    int const jacobian_update_interval = 1;
+    bool const broyden_update = false;
 };
 
 /// Newton-Raphson solver for system of equations using an Eigen linear solvers
 /// library.
 /// The current implementation does not update the solution itself, but calls a
 /// function for the solution's update with the current increment.
+///
+/// Optionally the Jacobian is evaluated and decomposed only every few
+/// iterations. In between either the last decomposition is reused (chord
+/// iterations) or the Jacobian is corrected by Broyden's rank-one update and
+/// decomposed again without calling the Jacobian update function.
 template <typename LinearSolver, typename JacobianMatrix,
           typename JacobianMatrixUpdate, typename ResidualVector,
           typename ResidualUpdate, typename SolutionUpdate>
@@ -45,8 +54,17 @@ public:
           _solution_update(solution_update),
           _maximum_iterations(solver_parameters.maximum_iterations),
           _tolerance_squared(solver_parameters.error_tolerance *
-                             solver_parameters.error_tolerance)
+                             solver_parameters.error_tolerance),
+          _jacobian_update_interval(solver_parameters.jacobian_update_interval),
+          _broyden_update(solver_parameters.broyden_update)
     {
+        if (_jacobian_update_interval < 1)
+        {
+            OGS_FATAL(
+                "The Jacobian update interval of the local Newton method must "
+                "be positive, got %d.",
+                _jacobian_update_interval);
+        }
     }
 
     /// Returns true and the iteration number if succeeded, otherwise false and
@@ -58,19 +76,44 @@ public:
         ResidualVector residual;
         do
         {
+            bool const evaluate_jacobian =
+                iteration % _jacobian_update_interval == 0;
+
             // The jacobian and the residual are updated simulataniously to keep
             // consistency. The jacobian is used after the non-linear solver
             // onward.
-            _jacobian_update(jacobian);
+            if (evaluate_jacobian)
+            {
+                _jacobian_update(jacobian);
+            }
             _residual_update(residual);
 
             if (residual.squaredNorm() < _tolerance_squared)
             {
+                if (!evaluate_jacobian)
+                {
+                    // The callers use the jacobian and the decomposition for
+                    // the tangent, which must not be approximate.
+                    _jacobian_update(jacobian);
+                    _linear_solver.compute(jacobian);
+                }
                 break;  // convergence criteria fulfilled.
             }
 
-            increment.noalias() =
-                _linear_solver.compute(jacobian).solve(-residual);
+            if (!evaluate_jacobian && _broyden_update)
+            {
+                // Broyden's update J += (dr - J dx) dx^T / (dx^T dx) with
+                // J dx = -r_prev, since the previous increment was solved for
+                // with a direct solver.
+                jacobian.noalias() +=
+                    residual * (increment.transpose() / increment.squaredNorm());
+            }
+
+            if (evaluate_jacobian || _broyden_update)
+            {
+                _linear_solver.compute(jacobian);
+            }
+            increment.noalias() = _linear_solver.solve(-residual);
             // DBUG("Local linear solver accuracy |J dx - r| = %g",
             //      (jacobian * increment + residual).norm());
 
@@ -99,5 +142,12 @@ private:
     SolutionUpdate _solution_update;
     const int _maximum_iterations;  ///< Maximum number of iterations.
     const double _tolerance_squared;    ///< Error tolerance for the residual.
+    /// Number of iterations after which the Jacobian is evaluated and
+    /// decomposed again. The default 1 is the full Newton method, larger
+    /// values result in chord iterations reusing the decomposition.
+    const int _jacobian_update_interval;
+    /// If the Jacobian is corrected by Broyden's rank-one update and decomposed
+    /// again in the iterations in which it is not evaluated.
+    const bool _broyden_update;
 };
 }  // namespace NumLib
@@ -13,6 +13,7 @@
 #include <limits>
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/ConvergenceTelemetry.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 
@@ -49,6 +50,7 @@ void ConvergenceCriterionPerComponentDeltaX::checkDeltaX(
 
     bool satisfied_abs = true;
     bool satisfied_rel = true;
+    std::vector<double> increment_norms;
 
     for (unsigned global_component = 0; global_component < _abstols.size();
          ++global_component)
@@ -58,6 +60,7 @@ void ConvergenceCriterionPerComponentDeltaX::checkDeltaX(
                              *_dof_table, *_mesh);
         auto norm_x =
             norm(x, global_component, _norm_type, *_dof_table, *_mesh);
+        increment_norms.push_back(error_dx);
 
         INFO(
             "Convergence criterion, component %u: |dx|=%.4e, |x|=%.4e, "
@@ -71,6 +74,8 @@ void ConvergenceCriterionPerComponentDeltaX::checkDeltaX(
             satisfied_rel && checkRelativeTolerance(_reltols[global_component],
                                                     error_dx, norm_x);
     }
+    BaseLib::ConvergenceTelemetry::setIncrementNorms(
+        std::move(increment_norms));
 
     _satisfied = _satisfied && (satisfied_abs || satisfied_rel);
 }
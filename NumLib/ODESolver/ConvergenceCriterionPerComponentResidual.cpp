@@ -12,6 +12,7 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/ConvergenceTelemetry.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 
@@ -49,6 +50,7 @@ void ConvergenceCriterionPerComponentResidual::checkDeltaX(
         OGS_FATAL("D.o.f. table or mesh have not been set.");
     }
 
+    std::vector<double> increment_norms;
     for (unsigned global_component = 0; global_component < _abstols.size();
          ++global_component)
     {
@@ -57,6 +59,7 @@ void ConvergenceCriterionPerComponentResidual::checkDeltaX(
                              *_dof_table, *_mesh);
         auto norm_x =
             norm(x, global_component, _norm_type, *_dof_table, *_mesh);
+        increment_norms.push_back(error_dx);
 
         INFO(
             "Convergence criterion, component %u: |dx|=%.4e, |x|=%.4e, "
@@ -65,6 +68,8 @@ void ConvergenceCriterionPerComponentResidual::checkDeltaX(
             (norm_x == 0. ? std::numeric_limits<double>::quiet_NaN()
                           : (error_dx / norm_x)));
     }
+    BaseLib::ConvergenceTelemetry::setIncrementNorms(
+        std::move(increment_norms));
 }
 
 
@@ -80,6 +85,7 @@ void ConvergenceCriterionPerComponentResidual::checkResidual(
     // Make sure that in the first iteration the relative residual tolerance is
     // not satisfied.
     bool satisfied_rel = !_is_first_iteration;
+    std::vector<double> residual_norms;
 
     for (unsigned global_component = 0; global_component < _abstols.size();
          ++global_component)
@@ -87,6 +93,7 @@ void ConvergenceCriterionPerComponentResidual::checkResidual(
         // TODO short cut if tol <= 0.0
         auto norm_res = norm(residual, global_component, _norm_type,
                              *_dof_table, *_mesh);
+        residual_norms.push_back(norm_res);
 
         if (_is_first_iteration) {
             INFO("Convergence criterion, component %u: |r0|=%.4e", global_component, norm_res);
@@ -107,6 +114,7 @@ void ConvergenceCriterionPerComponentResidual::checkResidual(
             checkRelativeTolerance(_reltols[global_component], norm_res,
                                    _residual_norms_0[global_component]);
     }
+    BaseLib::ConvergenceTelemetry::setResidualNorms(std::move(residual_norms));
 
     _satisfied = _satisfied && (satisfied_abs || satisfied_rel);
 }
@@ -12,6 +12,7 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/ConvergenceTelemetry.h"
 #include "MathLib/LinAlg/LinAlg.h"
 
 namespace NumLib
@@ -37,6 +38,7 @@ void ConvergenceCriterionResidual::checkDeltaX(
 {
     auto error_dx = MathLib::LinAlg::norm(minus_delta_x, _norm_type);
     auto norm_x = MathLib::LinAlg::norm(x, _norm_type);
+    BaseLib::ConvergenceTelemetry::setIncrementNorms({error_dx});
 
     INFO("Convergence criterion: |dx|=%.4e, |x|=%.4e, |dx|/|x|=%.4e", error_dx,
          norm_x,
@@ -47,6 +49,7 @@ void ConvergenceCriterionResidual::checkDeltaX(
 void ConvergenceCriterionResidual::checkResidual(const GlobalVector& residual)
 {
     auto norm_res = MathLib::LinAlg::norm(residual, _norm_type);
+    BaseLib::ConvergenceTelemetry::setResidualNorms({norm_res});
 
     if (_is_first_iteration)
     {
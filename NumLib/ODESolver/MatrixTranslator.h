@@ -62,6 +62,14 @@ public:
     virtual void computeJacobian(GlobalMatrix const& Jac_in,
                                  GlobalMatrix& Jac_out) const = 0;
 
+    /*! Returns whether the residual is \f$ r = M \cdot \hat x + K \cdot x_N -
+     * b \f$ with the matrices of the current iteration only.
+     *
+     * Then the residual can be summed up from element contributions, and the
+     * global \c M and \c K need not be assembled for computeResidual().
+     */
+    virtual bool isResidualElementwise() const { return false; }
+
     /*! Allows to store the given matrices internally for later use.
      *
      * \remark
@@ -128,6 +136,10 @@ public:
     void computeJacobian(GlobalMatrix const& Jac_in,
                          GlobalMatrix& Jac_out) const override;
 
+    //! The schemes using this translator evaluate the ODE at the new
+    //! timestep, i.e., \f$ x_C = x_N \f$.
+    bool isResidualElementwise() const override { return true; }
+
 private:
     TimeDiscretization const&
         _time_disc;  //!< the time discretization used.
@@ -10,16 +10,41 @@
 
 #include "NonlinearSolver.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <Eigen/Core>
+#include <Eigen/QR>
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/ConvergenceTelemetry.h"
 #include "BaseLib/Error.h"
 #include "BaseLib/RunTime.h"
+#include "BaseLib/Timing.h"
 #include "ConvergenceCriterion.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "NumLib/DOF/GlobalMatrixProviders.h"
 #include "NumLib/Exceptions.h"
 
+namespace
+{
+//! Relative tolerance of the linear solver in the current Newton iteration.
+double eisenstatWalkerTolerance(NumLib::EisenstatWalker const& ew,
+                                double const previous_tolerance,
+                                double const residual_ratio)
+{
+    double eta = ew.gamma * std::pow(residual_ratio, ew.alpha);
+    double const safeguard = ew.gamma * std::pow(previous_tolerance, ew.alpha);
+    if (safeguard > 0.1)
+    {
+        eta = std::max(eta, safeguard);
+    }
+    return std::clamp(eta, ew.eta_min, ew.eta_max);
+}
+}  // namespace
+
 namespace NumLib
 {
 void NonlinearSolver<NonlinearSolverTag::Picard>::assemble(
@@ -68,7 +93,28 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         &NumLib::GlobalVectorProvider::provider.getVector(_x_new_id);
     LinAlg::copy(*x[process_id], *x_new[process_id]);  // set initial guess
 
+    AndersonHistory anderson_history;
+    if (_anderson)
+    {
+        auto& provider = NumLib::GlobalVectorProvider::provider;
+        auto const depth = static_cast<std::size_t>(_anderson->depth);
+        _anderson_ids.resize(2 * depth + 2, 0u);
+        for (std::size_t i = 0; i < depth; ++i)
+        {
+            anderson_history.delta_f.push_back(
+                &provider.getVector(*x[process_id], _anderson_ids[2 * i]));
+            anderson_history.delta_g.push_back(
+                &provider.getVector(*x[process_id], _anderson_ids[2 * i + 1]));
+        }
+        anderson_history.minus_f =
+            &provider.getVector(*x[process_id], _anderson_ids[2 * depth]);
+        anderson_history.g =
+            &provider.getVector(*x[process_id], _anderson_ids[2 * depth + 1]);
+    }
+
     bool error_norms_met = false;
+    double previous_increment_norm = 0;
+    double contraction_rate = 0;
 
     _convergence_criterion->preFirstIteration();
 
@@ -94,7 +140,8 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         sys.assemble(x_new, process_id);
         sys.getA(A);
         sys.getRhs(rhs);
-        INFO("[time] Assembly took %g s.", time_assembly.elapsed());
+        double const assembly_time = time_assembly.elapsed();
+        INFO("[time] Assembly took %g s.", assembly_time);
 
         // Subract non-equilibrium initial residuum if set
         if (_r_neq != nullptr)
@@ -103,7 +150,11 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         }
 
         timer_dirichlet.start();
-        sys.applyKnownSolutionsPicard(A, rhs, *x_new[process_id]);
+        {
+            static auto& region = BaseLib::Timing::getRegion("dirichlet_bcs");
+            BaseLib::Timing::ScopedTimer const timer{region};
+            sys.applyKnownSolutionsPicard(A, rhs, *x_new[process_id]);
+        }
         time_dirichlet += timer_dirichlet.elapsed();
         INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet);
 
@@ -114,11 +165,51 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
             _convergence_criterion->checkResidual(res);
         }
 
-        BaseLib::RunTime time_linear_solver;
-        time_linear_solver.start();
-        bool iteration_succeeded =
-            _linear_solver.solve(A, rhs, *x_new[process_id]);
-        INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
+        bool iteration_succeeded = true;
+        double linear_solver_time = 0;
+        if (sys.isADiagonal())
+        {
+            // The known solutions keep the matrix diagonal.
+            auto& diagonal = NumLib::GlobalVectorProvider::provider.getVector(
+                rhs, _diagonal_id);
+            LinAlg::getDiagonal(A, diagonal);
+            LinAlg::componentwiseDivide(*x_new[process_id], rhs, diagonal);
+            NumLib::GlobalVectorProvider::provider.releaseVector(diagonal);
+        }
+        else if (auto const reduced_basis = _reduced_bases.find(process_id);
+                 reduced_basis != _reduced_bases.end())
+        {
+            BaseLib::RunTime time_reduced_solve;
+            time_reduced_solve.start();
+            iteration_succeeded = reduced_basis->second->solve(
+                A, rhs, *x_new[process_id]);
+            linear_solver_time = time_reduced_solve.elapsed();
+            INFO("[time] Reduced solve of %d modes took %g s.",
+                 static_cast<int>(reduced_basis->second->size()),
+                 linear_solver_time);
+        }
+        else
+        {
+            if (sys.isAUnchanged() && _linear_solver_setup_system == &sys)
+            {
+                INFO(
+                    "Picard: The matrix is unchanged; reusing its "
+                    "factorization.");
+                _linear_solver.reuseSetupInNextSolve();
+            }
+
+            BaseLib::RunTime time_linear_solver;
+            time_linear_solver.start();
+            iteration_succeeded = [&] {
+                static auto& region =
+                    BaseLib::Timing::getRegion("linear_solver", true);
+                BaseLib::Timing::ScopedTimer const timer{region};
+                return _linear_solver.solve(A, rhs, *x_new[process_id]);
+            }();
+            _linear_solver_setup_system = &sys;
+            linear_solver_time = time_linear_solver.elapsed();
+            INFO("[time] Linear solver took %g s.", linear_solver_time);
+        }
 
         if (!iteration_succeeded)
         {
@@ -159,6 +250,9 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
 
         if (!iteration_succeeded)
         {
+            BaseLib::ConvergenceTelemetry::finishIteration(
+                process_id, iteration, assembly_time, linear_solver_time,
+                false);
             // Don't compute error norms, break here.
             error_norms_met = false;
             break;
@@ -178,9 +272,27 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
             error_norms_met = _convergence_criterion->isSatisfied();
         }
 
+        // x holds the increment until it is updated below.
+        LinAlg::axpy(*x[process_id], -1.0, *x_new[process_id]);
+        double const increment_norm =
+            LinAlg::norm(*x[process_id], MathLib::VecNormType::NORM2);
+        if (previous_increment_norm > 0)
+        {
+            contraction_rate = increment_norm / previous_increment_norm;
+        }
+        previous_increment_norm = increment_norm;
+
+        if (_anderson && !error_norms_met)
+        {
+            accelerate(*x[process_id], *x_new[process_id], anderson_history);
+        }
+
         // Update x s.t. in the next iteration we will compute the right delta x
         LinAlg::copy(*x_new[process_id], *x[process_id]);
 
+        BaseLib::ConvergenceTelemetry::finishIteration(
+            process_id, iteration, assembly_time, linear_solver_time,
+            error_norms_met);
         INFO("[time] Iteration #%u took %g s.", iteration,
              time_iteration.elapsed());
 
@@ -207,8 +319,90 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(A);
     NumLib::GlobalVectorProvider::provider.releaseVector(rhs);
     NumLib::GlobalVectorProvider::provider.releaseVector(*x_new[process_id]);
+    if (_anderson)
+    {
+        auto& provider = NumLib::GlobalVectorProvider::provider;
+        for (std::size_t i = 0; i < anderson_history.delta_f.size(); ++i)
+        {
+            provider.releaseVector(*anderson_history.delta_f[i]);
+            provider.releaseVector(*anderson_history.delta_g[i]);
+        }
+        provider.releaseVector(*anderson_history.minus_f);
+        provider.releaseVector(*anderson_history.g);
+    }
+
+    return {error_norms_met, iteration, contraction_rate};
+}
+
+void NonlinearSolver<NonlinearSolverTag::Picard>::accelerate(
+    GlobalVector const& minus_f, GlobalVector& x_new,
+    AndersonHistory& history) const
+{
+    namespace LinAlg = MathLib::LinAlg;
+    auto const& anderson = *_anderson;
+    auto const depth = history.delta_f.size();
+
+    double const f_norm = LinAlg::norm(minus_f, MathLib::VecNormType::NORM2);
+    if (history.has_last_iteration)
+    {
+        if (f_norm > anderson.max_residual_ratio * history.f_norm)
+        {
+            DBUG(
+                "Picard: The fixed-point residual grew from %g to %g; "
+                "discarding the Anderson history.",
+                history.f_norm, f_norm);
+            history.size = 0;
+            history.next = 0;
+        }
+        else
+        {
+            if (history.size == depth && anderson.restart)
+            {
+                history.size = 0;
+                history.next = 0;
+            }
+            // delta_f = f - f_last, delta_g = g - g_last.
+            auto& delta_f = *history.delta_f[history.next];
+            auto& delta_g = *history.delta_g[history.next];
+            LinAlg::copy(*history.minus_f, delta_f);
+            LinAlg::axpy(delta_f, -1, minus_f);
+            LinAlg::copy(x_new, delta_g);
+            LinAlg::axpy(delta_g, -1, *history.g);
+            history.size = std::min(history.size + 1, depth);
+            history.next = (history.next + 1) % depth;
+        }
+    }
 
-    return {error_norms_met, iteration};
+    LinAlg::copy(minus_f, *history.minus_f);
+    LinAlg::copy(x_new, *history.g);
+    history.f_norm = f_norm;
+    history.has_last_iteration = true;
+
+    auto const n = static_cast<int>(history.size);
+    if (n == 0)
+    {
+        return;
+    }
+
+    // Minimizes |f - dF c| by the normal equations, which is sufficient for
+    // the few columns of dF, and combines x_new = g - dG c.
+    Eigen::MatrixXd G(n, n);
+    Eigen::VectorXd b(n);
+    for (int i = 0; i < n; ++i)
+    {
+        b[i] = -LinAlg::dot(*history.delta_f[i], minus_f);
+        for (int j = 0; j <= i; ++j)
+        {
+            G(i, j) = G(j, i) =
+                LinAlg::dot(*history.delta_f[i], *history.delta_f[j]);
+        }
+    }
+    Eigen::VectorXd const c = G.completeOrthogonalDecomposition().solve(b);
+    for (int i = 0; i < n; ++i)
+    {
+        LinAlg::axpy(x_new, -c[i], *history.delta_g[i]);
+    }
+    DBUG("Picard: Anderson acceleration with %d previous iterations.", n);
 }
 
 void NonlinearSolver<NonlinearSolverTag::Newton>::assemble(
@@ -234,6 +428,471 @@ void NonlinearSolver<NonlinearSolverTag::Newton>::
     _equation_system->getResidual(*x[process_id], *_r_neq);
 }
 
+void NonlinearSolver<NonlinearSolverTag::Newton>::assembleEquationSystem(
+    std::vector<GlobalVector*> const& x, int const process_id,
+    bool const with_jacobian) const
+{
+    if (with_jacobian || !_residual_only_assembly)
+    {
+        _equation_system->assemble(x, process_id);
+    }
+    else
+    {
+        _equation_system->assembleResidual(x, process_id);
+    }
+}
+
+double NonlinearSolver<NonlinearSolverTag::Newton>::lineSearch(
+    std::vector<GlobalVector*> const& x, GlobalVector const& res,
+    GlobalVector& minus_delta_x, int const process_id)
+{
+    namespace LinAlg = MathLib::LinAlg;
+    static auto& region = BaseLib::Timing::getRegion("line_search");
+    BaseLib::Timing::ScopedTimer const timer{region};
+
+    auto& sys = *_equation_system;
+    auto const& ls = *_line_search;
+    auto const norm_type = _convergence_criterion->getVectorNormType();
+
+    std::vector<GlobalVector*> x_trial{x};
+    x_trial[process_id] = &NumLib::GlobalVectorProvider::provider.getVector(
+        *x[process_id], _x_new_id);
+    auto& res_trial =
+        NumLib::GlobalVectorProvider::provider.getVector(res, _res_trial_id);
+
+    // Computes the residual at the trial point for the given step length.
+    // Returns false if the assembly failed.
+    auto const computeResidual = [&](double const step) {
+        LinAlg::copy(*x[process_id], *x_trial[process_id]);
+        LinAlg::axpy(*x_trial[process_id], -_damping * step, minus_delta_x);
+        try
+        {
+            assembleEquationSystem(x_trial, process_id, false);
+        }
+        catch (AssemblyException const& e)
+        {
+            DBUG("Line search: The assembly failed for the step %g: %s", step,
+                 e.what());
+            return false;
+        }
+        sys.getResidual(*x_trial[process_id], res_trial);
+        if (_r_neq != nullptr)
+        {
+            LinAlg::axpy(res_trial, -1, *_r_neq);
+        }
+        // The increment is zero at the known solutions already.
+        sys.applyKnownSolutionsNewton(res_trial, minus_delta_x);
+        return true;
+    };
+
+    double step = 1.0;
+    switch (ls.type)
+    {
+        case LineSearch::Type::Backtracking:
+        {
+            double const f0 = LinAlg::norm(res, norm_type);
+            double const phi0 = f0 * f0;
+            // The step with the smallest residual is used if none reduces the
+            // residual sufficiently.
+            double best_step = ls.min_step;
+            double best_f = std::numeric_limits<double>::infinity();
+            bool accepted = false;
+            for (int i = 0; i < ls.max_iterations && step >= ls.min_step; ++i)
+            {
+                if (!computeResidual(step))
+                {
+                    step *= 0.5;
+                    continue;
+                }
+                double const f = LinAlg::norm(res_trial, norm_type);
+                DBUG("Line search: step %g, residual norm %g (initial %g).",
+                     step, f, f0);
+                if (f <= (1 - ls.sufficient_decrease * _damping * step) * f0)
+                {
+                    accepted = true;
+                    break;
+                }
+                if (f < best_f)
+                {
+                    best_f = f;
+                    best_step = step;
+                }
+                // Minimizer of the quadratic interpolating the squared norm
+                // and its slope at zero and its value at the current step.
+                double const s = _damping * step;
+                double const denominator = f * f - phi0 + 2 * phi0 * s;
+                double const next_step =
+                    denominator > 0 ? phi0 * s * step / denominator
+                                    : 0.5 * step;
+                step = std::clamp(next_step, 0.1 * step, 0.5 * step);
+            }
+            if (!accepted)
+            {
+                step = best_step;
+                WARN(
+                    "Line search: The residual did not decrease sufficiently. "
+                    "Using the step %g.",
+                    step);
+            }
+            break;
+        }
+        case LineSearch::Type::CriticalPoint:
+        {
+            double previous_step = 0;
+            double previous_slope = LinAlg::dot(res, minus_delta_x);
+            for (int i = 0; i < ls.max_iterations; ++i)
+            {
+                if (!computeResidual(step))
+                {
+                    step = 0.5 * (previous_step + step);
+                    continue;
+                }
+                double const slope = LinAlg::dot(res_trial, minus_delta_x);
+                DBUG("Line search: step %g, slope %g (previous %g).", step,
+                     slope, previous_slope);
+                if (slope == previous_slope)
+                {
+                    break;
+                }
+                double next_step = step - slope * (step - previous_step) /
+                                              (slope - previous_slope);
+                if (next_step < ls.min_step)
+                {
+                    // The secant extrapolates beyond the current point.
+                    next_step = 0.5 * (step + previous_step);
+                }
+                next_step = std::min(next_step, 1.0);
+                previous_step = step;
+                previous_slope = slope;
+                step = next_step;
+                if (std::abs(step - previous_step) < ls.min_step)
+                {
+                    break;
+                }
+            }
+            break;
+        }
+    }
+    INFO("Line search: step length %g.", step);
+
+    NumLib::GlobalVectorProvider::provider.releaseVector(res_trial);
+    NumLib::GlobalVectorProvider::provider.releaseVector(*x_trial[process_id]);
+    return step;
+}
+
+bool NonlinearSolver<NonlinearSolverTag::Newton>::solveJacobianFree(
+    std::vector<GlobalVector*> const& x, GlobalVector const& res,
+    GlobalMatrix& J, GlobalVector& minus_delta_x, double const tolerance,
+    int const process_id)
+{
+    namespace LinAlg = MathLib::LinAlg;
+    static auto& region = BaseLib::Timing::getRegion("jacobian_free_krylov");
+    BaseLib::Timing::ScopedTimer const timer{region};
+
+    auto& sys = *_equation_system;
+    auto const& jf = *_jacobian_free;
+    auto& provider = NumLib::GlobalVectorProvider::provider;
+    auto const m = jf.krylov_dimension;
+
+    // Krylov basis V and the preconditioned basis Z of flexible GMRES.
+    _krylov_basis_ids.resize(m + 1, 0u);
+    _krylov_preconditioned_ids.resize(m, 0u);
+    std::vector<GlobalVector*> V;
+    std::vector<GlobalVector*> Z;
+    for (auto& id : _krylov_basis_ids)
+    {
+        V.push_back(&provider.getVector(res, id));
+    }
+    for (auto& id : _krylov_preconditioned_ids)
+    {
+        Z.push_back(&provider.getVector(res, id));
+    }
+    auto& w = provider.getVector(res, _krylov_work_id);
+    std::vector<GlobalVector*> x_perturbed{x};
+    x_perturbed[process_id] =
+        &provider.getVector(*x[process_id], _x_new_id);
+    auto& res_perturbed = provider.getVector(res, _res_trial_id);
+
+    double const x_norm =
+        LinAlg::norm(*x[process_id], MathLib::VecNormType::NORM2);
+
+    // Jz = J z by forward differences of the residual. Returns false if the
+    // assembly failed.
+    auto const multiply = [&](GlobalVector const& z, GlobalVector& Jz) {
+        double const z_norm = LinAlg::norm(z, MathLib::VecNormType::NORM2);
+        if (z_norm == 0)
+        {
+            Jz.setZero();
+            return true;
+        }
+        double const h = jf.perturbation * (1 + x_norm) / z_norm;
+        LinAlg::copy(*x[process_id], *x_perturbed[process_id]);
+        LinAlg::axpy(*x_perturbed[process_id], h, z);
+        try
+        {
+            assembleEquationSystem(x_perturbed, process_id, false);
+        }
+        catch (AssemblyException const& e)
+        {
+            ERR("Newton: The assembly of a Jacobian-vector product failed: %s",
+                e.what());
+            return false;
+        }
+        sys.getResidual(*x_perturbed[process_id], res_perturbed);
+        if (_r_neq != nullptr)
+        {
+            LinAlg::axpy(res_perturbed, -1, *_r_neq);
+        }
+        // The rows of the known solutions vanish, hence, the Krylov vectors
+        // are zero there.
+        sys.applyKnownSolutionsNewton(res_perturbed, Jz);
+        LinAlg::copy(res_perturbed, Jz);
+        LinAlg::axpy(Jz, -1, res);
+        LinAlg::scale(Jz, 1 / h);
+        return true;
+    };
+
+    // z = J_p^{-1} v with the assembled Jacobian J_p, which is factorized or
+    // set up in the first application only. The vector v is modified.
+    bool first_preconditioner_application = true;
+    auto const precondition = [&](GlobalVector& v, GlobalVector& z) {
+        if (!first_preconditioner_application)
+        {
+            _linear_solver.reuseSetupInNextSolve();
+        }
+        first_preconditioner_application = false;
+        z.setZero();
+        return _linear_solver.solve(J, v, z);
+    };
+
+    double const res_norm = LinAlg::norm(res, MathLib::VecNormType::NORM2);
+    double const target = tolerance * res_norm;
+
+    Eigen::MatrixXd H(m + 1, m);
+    Eigen::VectorXd g(m + 1);
+    Eigen::VectorXd cs(m);
+    Eigen::VectorXd sn(m);
+
+    int iterations = 0;
+    double residual = res_norm;
+    bool const success = [&] {
+        // Start from the initial guess in minus_delta_x.
+        if (!multiply(minus_delta_x, w))
+        {
+            return false;
+        }
+        LinAlg::copy(res, *V[0]);
+        LinAlg::axpy(*V[0], -1, w);
+        double beta = LinAlg::norm(*V[0], MathLib::VecNormType::NORM2);
+        residual = beta;
+        while (beta > target)
+        {
+            LinAlg::scale(*V[0], 1 / beta);
+            H.setZero();
+            g.setZero();
+            g[0] = beta;
+
+            int k = 0;
+            for (int j = 0; j < m && iterations < jf.max_iterations; ++j)
+            {
+                LinAlg::copy(*V[j], w);
+                if (!precondition(w, *Z[j]) || !multiply(*Z[j], w))
+                {
+                    return false;
+                }
+                // Modified Gram-Schmidt orthogonalization.
+                for (int i = 0; i <= j; ++i)
+                {
+                    H(i, j) = LinAlg::dot(w, *V[i]);
+                    LinAlg::axpy(w, -H(i, j), *V[i]);
+                }
+                double const h_next =
+                    LinAlg::norm(w, MathLib::VecNormType::NORM2);
+                ++iterations;
+                k = j + 1;
+
+                // Givens rotations for the least squares problem.
+                for (int i = 0; i < j; ++i)
+                {
+                    double const t = cs[i] * H(i, j) + sn[i] * H(i + 1, j);
+                    H(i + 1, j) = -sn[i] * H(i, j) + cs[i] * H(i + 1, j);
+                    H(i, j) = t;
+                }
+                double const d = std::hypot(H(j, j), h_next);
+                if (d == 0)
+                {
+                    ERR("Newton: Breakdown of the Jacobian-free GMRES.");
+                    return false;
+                }
+                cs[j] = H(j, j) / d;
+                sn[j] = h_next / d;
+                H(j, j) = d;
+                g[j + 1] = -sn[j] * g[j];
+                g[j] = cs[j] * g[j];
+
+                residual = std::abs(g[j + 1]);
+                DBUG("Newton: GMRES iteration %d, residual %g.", iterations,
+                     residual);
+                if (residual <= target || h_next == 0)
+                {
+                    break;
+                }
+                if (j + 1 < m)
+                {
+                    LinAlg::copy(w, *V[j + 1]);
+                    LinAlg::scale(*V[j + 1], 1 / h_next);
+                }
+            }
+
+            Eigen::VectorXd const y =
+                H.topLeftCorner(k, k).triangularView<Eigen::Upper>().solve(
+                    g.head(k));
+            for (int i = 0; i < k; ++i)
+            {
+                LinAlg::axpy(minus_delta_x, y[i], *Z[i]);
+            }
+
+            if (residual <= target || iterations >= jf.max_iterations)
+            {
+                break;
+            }
+
+            // Restart with the residual of the linear system.
+            if (!multiply(minus_delta_x, w))
+            {
+                return false;
+            }
+            LinAlg::copy(res, *V[0]);
+            LinAlg::axpy(*V[0], -1, w);
+            beta = LinAlg::norm(*V[0], MathLib::VecNormType::NORM2);
+            residual = beta;
+        }
+        return residual <= target;
+    }();
+
+    INFO("Newton: Jacobian-free GMRES took %d iterations, relative residual "
+         "%g.",
+         iterations, res_norm > 0 ? residual / res_norm : 0.0);
+    BaseLib::ConvergenceTelemetry::addLinearIterations(iterations);
+    if (!success)
+    {
+        ERR("Newton: The Jacobian-free GMRES did not converge.");
+    }
+
+    provider.releaseVector(res_perturbed);
+    provider.releaseVector(*x_perturbed[process_id]);
+    provider.releaseVector(w);
+    for (auto* v : Z)
+    {
+        provider.releaseVector(*v);
+    }
+    for (auto* v : V)
+    {
+        provider.releaseVector(*v);
+    }
+    return success;
+}
+
+void NonlinearSolver<NonlinearSolverTag::Newton>::computeInitialGuess(
+    GlobalMatrix const& J, GlobalVector const& res,
+    GlobalVector& minus_delta_x, bool const first_iteration,
+    int const process_id)
+{
+    namespace LinAlg = MathLib::LinAlg;
+    static auto& region = BaseLib::Timing::getRegion("initial_guess");
+    BaseLib::Timing::ScopedTimer const timer{region};
+
+    auto& history = _initial_guess_history[process_id];
+    bool const extrapolate = _initial_guess.extrapolation && first_iteration &&
+                             history.has_previous_increment;
+    if (extrapolate)
+    {
+        LinAlg::copy(*history.previous_increment, minus_delta_x);
+    }
+    else
+    {
+        minus_delta_x.setZero();
+    }
+
+    auto const n = static_cast<int>(history.subspace.size());
+    if (n == 0)
+    {
+        return;
+    }
+
+    // Minimizes |r0 - W c| with the residual r0 = res - J (-dx) of the guess
+    // and the images W = J U of the subspace vectors U by the normal
+    // equations, which is sufficient for the few vectors of the subspace.
+    auto& provider = NumLib::GlobalVectorProvider::provider;
+    auto& r0 = provider.getVector(res, _guess_residual_id);
+    if (extrapolate)
+    {
+        auto& w = provider.getVector(res, _krylov_work_id);
+        LinAlg::matMult(J, minus_delta_x, w);
+        LinAlg::axpy(r0, -1, w);
+        provider.releaseVector(w);
+    }
+
+    _guess_image_ids.resize(n, 0u);
+    std::vector<GlobalVector*> W;
+    for (int i = 0; i < n; ++i)
+    {
+        W.push_back(&provider.getVector(res, _guess_image_ids[i]));
+        LinAlg::matMult(J, *history.subspace[i], *W[i]);
+    }
+
+    Eigen::MatrixXd G(n, n);
+    Eigen::VectorXd b(n);
+    for (int i = 0; i < n; ++i)
+    {
+        b[i] = LinAlg::dot(*W[i], r0);
+        for (int j = 0; j <= i; ++j)
+        {
+            G(i, j) = G(j, i) = LinAlg::dot(*W[i], *W[j]);
+        }
+    }
+    Eigen::VectorXd const c = G.completeOrthogonalDecomposition().solve(b);
+    for (int i = 0; i < n; ++i)
+    {
+        LinAlg::axpy(minus_delta_x, c[i], *history.subspace[i]);
+    }
+
+    double const r0_norm = LinAlg::norm(r0, MathLib::VecNormType::NORM2);
+    double const reduced_norm =
+        std::sqrt(std::max(0.0, r0_norm * r0_norm - b.dot(c)));
+    DBUG(
+        "Newton: The recycled subspace of dimension %d reduces the residual "
+        "of the initial guess from %g to %g.",
+        n, r0_norm, reduced_norm);
+
+    for (auto* w : W)
+    {
+        provider.releaseVector(*w);
+    }
+    provider.releaseVector(r0);
+}
+
+void NonlinearSolver<NonlinearSolverTag::Newton>::recycleSolution(
+    GlobalVector const& minus_delta_x, int const process_id)
+{
+    auto const dimension =
+        static_cast<std::size_t>(_initial_guess.recycled_subspace_dimension);
+    if (dimension == 0)
+    {
+        return;
+    }
+
+    auto& history = _initial_guess_history[process_id];
+    if (history.subspace.size() < dimension)
+    {
+        history.subspace.push_back(
+            &NumLib::GlobalVectorProvider::provider.getVector(minus_delta_x));
+        return;
+    }
+    MathLib::LinAlg::copy(minus_delta_x, *history.subspace[history.next]);
+    history.next = (history.next + 1) % dimension;
+}
+
 NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
     std::vector<GlobalVector*>& x,
     std::function<void(int, std::vector<GlobalVector*> const&)> const&
@@ -248,17 +907,77 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
     auto& minus_delta_x =
         NumLib::GlobalVectorProvider::provider.getVector(
             _minus_delta_x_id);
-    auto& J =
-        NumLib::GlobalMatrixProvider::provider.getMatrix(_J_id);
+    auto& J = _constant_J != nullptr
+                  ? *_constant_J
+                  : NumLib::GlobalMatrixProvider::provider.getMatrix(_J_id);
 
     bool error_norms_met = false;
+    double previous_increment_norm = 0;
+    double contraction_rate = 0;
 
     // TODO be more efficient
     // init minus_delta_x to the right size
     LinAlg::copy(*x[process_id], minus_delta_x);
 
+    bool const use_initial_guess =
+        _initial_guess.extrapolation ||
+        _initial_guess.recycled_subspace_dimension > 0;
+    GlobalVector* x_start = nullptr;
+    if (_initial_guess.extrapolation)
+    {
+        x_start = &NumLib::GlobalVectorProvider::provider.getVector(
+            *x[process_id], _x_start_id);
+    }
+
     _convergence_criterion->preFirstIteration();
 
+    // Assembles the equation system and computes the residual, and the
+    // Jacobian if requested. Returns false if the assembly failed.
+    auto const assemble = [&](bool const with_jacobian) {
+        try
+        {
+            assembleEquationSystem(x, process_id, with_jacobian);
+        }
+        catch (AssemblyException const& e)
+        {
+            ERR("Abort nonlinear iteration. Repeating timestep. Reason: %s",
+                e.what());
+            return false;
+        }
+        sys.getResidual(*x[process_id], res);
+        if (with_jacobian)
+        {
+            sys.getJacobian(J);
+        }
+
+        // Subract non-equilibrium initial residuum if set
+        if (_r_neq != nullptr)
+            LinAlg::axpy(res, -1, *_r_neq);
+
+        minus_delta_x.setZero();
+        return true;
+    };
+
+    auto const applyKnownSolutions = [&](bool const to_jacobian) {
+        static auto& region = BaseLib::Timing::getRegion("dirichlet_bcs");
+        BaseLib::Timing::ScopedTimer const timer{region};
+        if (to_jacobian)
+        {
+            sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
+        }
+        else
+        {
+            // The known solutions have been applied to the reused Jacobian
+            // already.
+            sys.applyKnownSolutionsNewton(res, minus_delta_x);
+        }
+    };
+
+    int lagged_iterations = 0;
+    double previous_residual_norm = 0;
+    double linear_solver_tolerance =
+        _eisenstat_walker ? _eisenstat_walker->eta_max : 0;
+
     int iteration = 1;
     for (; iteration <= _maxiter;
          ++iteration, _convergence_criterion->reset())
@@ -276,44 +995,134 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
 
         sys.preIteration(iteration, *x[process_id]);
 
+        bool lag_jacobian =
+            _constant_jacobian
+                ? _constant_J_system == &sys &&
+                      sys.areKnownSolutionIdsUnchanged()
+                : iteration > 1 && lagged_iterations <
+                                       _jacobian_lagging.max_lagged_iterations;
+
         BaseLib::RunTime time_assembly;
         time_assembly.start();
-        try
+        if (!assemble(!lag_jacobian))
         {
-            sys.assemble(x, process_id);
-        }
-        catch (AssemblyException const& e)
-        {
-            ERR("Abort nonlinear iteration. Repeating timestep. Reason: %s",
-                e.what());
             error_norms_met = false;
             iteration = _maxiter;
             break;
         }
-        sys.getResidual(*x[process_id], res);
-        sys.getJacobian(J);
-        INFO("[time] Assembly took %g s.", time_assembly.elapsed());
-
-        // Subract non-equilibrium initial residuum if set
-        if (_r_neq != nullptr)
-            LinAlg::axpy(res, -1, *_r_neq);
-
-        minus_delta_x.setZero();
+        double assembly_time = time_assembly.elapsed();
+        INFO("[time] Assembly took %g s.", assembly_time);
 
         timer_dirichlet.start();
-        sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
+        applyKnownSolutions(!lag_jacobian);
         time_dirichlet += timer_dirichlet.elapsed();
+
+        double residual_ratio = 0;
+        if (_jacobian_lagging.max_lagged_iterations > 0 || _eisenstat_walker)
+        {
+            auto const residual_norm =
+                LinAlg::norm(res, MathLib::VecNormType::NORM2);
+            if (previous_residual_norm > 0)
+            {
+                residual_ratio = residual_norm / previous_residual_norm;
+            }
+            previous_residual_norm = residual_norm;
+        }
+
+        if (lag_jacobian && !_constant_jacobian &&
+            residual_ratio > _jacobian_lagging.max_residual_ratio)
+        {
+            INFO(
+                "Newton: The residual decreased by the factor %g only. "
+                "Recomputing the Jacobian.",
+                residual_ratio);
+            lag_jacobian = false;
+
+            if (_residual_only_assembly)
+            {
+                time_assembly.start();
+                if (!assemble(true))
+                {
+                    error_norms_met = false;
+                    iteration = _maxiter;
+                    break;
+                }
+                INFO("[time] Assembly took %g s.", time_assembly.elapsed());
+                assembly_time += time_assembly.elapsed();
+            }
+            else
+            {
+                // The Jacobian has been assembled already.
+                sys.getJacobian(J);
+            }
+
+            timer_dirichlet.start();
+            applyKnownSolutions(true);
+            time_dirichlet += timer_dirichlet.elapsed();
+        }
         INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet);
 
+        if (lag_jacobian)
+        {
+            INFO("Newton: Reusing the Jacobian of a previous iteration.");
+            ++lagged_iterations;
+            _linear_solver.reuseSetupInNextSolve();
+        }
+        else
+        {
+            lagged_iterations = 0;
+        }
+
+        if (_eisenstat_walker)
+        {
+            if (iteration > 1)
+            {
+                linear_solver_tolerance = eisenstatWalkerTolerance(
+                    *_eisenstat_walker, linear_solver_tolerance,
+                    residual_ratio);
+            }
+            DBUG("Newton: Relative tolerance of the linear solver %g.",
+                 linear_solver_tolerance);
+            if (!_jacobian_free)
+            {
+                _linear_solver.setRelativeTolerance(linear_solver_tolerance);
+            }
+        }
+
         if (!sys.isLinear() && _convergence_criterion->hasResidualCheck())
         {
             _convergence_criterion->checkResidual(res);
         }
 
+        if (use_initial_guess)
+        {
+            computeInitialGuess(J, res, minus_delta_x, iteration == 1,
+                                process_id);
+            sys.applyKnownSolutionsNewton(res, minus_delta_x);
+        }
+
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(J, res, minus_delta_x);
-        INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
+        bool iteration_succeeded = [&] {
+            static auto& region =
+                BaseLib::Timing::getRegion("linear_solver", true);
+            BaseLib::Timing::ScopedTimer const timer{region};
+            if (_jacobian_free)
+            {
+                return solveJacobianFree(
+                    x, res, J, minus_delta_x,
+                    _eisenstat_walker ? linear_solver_tolerance
+                                      : _jacobian_free->tolerance,
+                    process_id);
+            }
+            return _linear_solver.solve(J, res, minus_delta_x);
+        }();
+        double const linear_solver_time = time_linear_solver.elapsed();
+        INFO("[time] Linear solver took %g s.", linear_solver_time);
+        if (_constant_jacobian)
+        {
+            _constant_J_system = iteration_succeeded ? &sys : nullptr;
+        }
 
         if (!iteration_succeeded)
         {
@@ -321,16 +1130,23 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
         }
         else
         {
+            recycleSolution(minus_delta_x, process_id);
+
             // TODO could be solved in a better way
             // cf.
             // http://www.mcs.anl.gov/petsc/petsc-current/docs/manualpages/Vec/VecWAXPY.html
 
+            double const step =
+                _line_search && !sys.isLinear()
+                    ? lineSearch(x, res, minus_delta_x, process_id)
+                    : 1.0;
+
             // Copy pointers, replace the one for the given process id.
             std::vector<GlobalVector*> x_new{x};
             x_new[process_id] =
                 &NumLib::GlobalVectorProvider::provider.getVector(
                     *x[process_id], _x_new_id);
-            LinAlg::axpy(*x_new[process_id], -_damping, minus_delta_x);
+            LinAlg::axpy(*x_new[process_id], -_damping * step, minus_delta_x);
 
             if (postIterationCallback)
             {
@@ -365,11 +1181,22 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
 
         if (!iteration_succeeded)
         {
+            BaseLib::ConvergenceTelemetry::finishIteration(
+                process_id, iteration, assembly_time, linear_solver_time,
+                false);
             // Don't compute further error norms, but break here.
             error_norms_met = false;
             break;
         }
 
+        double const increment_norm =
+            LinAlg::norm(minus_delta_x, MathLib::VecNormType::NORM2);
+        if (previous_increment_norm > 0)
+        {
+            contraction_rate = increment_norm / previous_increment_norm;
+        }
+        previous_increment_norm = increment_norm;
+
         if (sys.isLinear()) {
             error_norms_met = true;
         } else {
@@ -382,6 +1209,9 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             error_norms_met = _convergence_criterion->isSatisfied();
         }
 
+        BaseLib::ConvergenceTelemetry::finishIteration(
+            process_id, iteration, assembly_time, linear_solver_time,
+            error_norms_met);
         INFO("[time] Iteration #%u took %g s.", iteration,
              time_iteration.elapsed());
 
@@ -405,12 +1235,46 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             _maxiter);
     }
 
-    NumLib::GlobalMatrixProvider::provider.releaseMatrix(J);
+    if (_eisenstat_walker && !_jacobian_free)
+    {
+        _linear_solver.resetRelativeTolerance();
+    }
+
+    if (x_start != nullptr)
+    {
+        auto& history = _initial_guess_history[process_id];
+        history.has_previous_increment = error_norms_met;
+        if (error_norms_met)
+        {
+            if (history.previous_increment == nullptr)
+            {
+                history.previous_increment =
+                    &NumLib::GlobalVectorProvider::provider.getVector(
+                        *x_start);
+            }
+            else
+            {
+                LinAlg::copy(*x_start, *history.previous_increment);
+            }
+            // -dx = x_start - x
+            LinAlg::axpy(*history.previous_increment, -1, *x[process_id]);
+        }
+        NumLib::GlobalVectorProvider::provider.releaseVector(*x_start);
+    }
+
+    if (_constant_jacobian)
+    {
+        _constant_J = &J;
+    }
+    else
+    {
+        NumLib::GlobalMatrixProvider::provider.releaseMatrix(J);
+    }
     NumLib::GlobalVectorProvider::provider.releaseVector(res);
     NumLib::GlobalVectorProvider::provider.releaseVector(
         minus_delta_x);
 
-    return {error_norms_met, iteration};
+    return {error_norms_met, iteration, contraction_rate};
 }
 
 std::pair<std::unique_ptr<NonlinearSolverBase>, NonlinearSolverTag>
@@ -425,8 +1289,38 @@ createNonlinearSolver(GlobalLinearSolver& linear_solver,
     if (type == "Picard") {
         auto const tag = NonlinearSolverTag::Picard;
         using ConcreteNLS = NonlinearSolver<tag>;
-        return std::make_pair(
-            std::make_unique<ConcreteNLS>(linear_solver, max_iter), tag);
+        auto nonlinear_solver =
+            std::make_unique<ConcreteNLS>(linear_solver, max_iter);
+
+        if (auto const anderson_config =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__anderson_acceleration}
+            config.getConfigSubtreeOptional("anderson_acceleration"))
+        {
+            AndersonAcceleration anderson;
+            anderson.depth =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__anderson_acceleration__depth}
+                anderson_config->getConfigParameter<int>("depth",
+                                                         anderson.depth);
+            anderson.restart =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__anderson_acceleration__restart}
+                anderson_config->getConfigParameter<bool>("restart",
+                                                          anderson.restart);
+            anderson.max_residual_ratio =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__anderson_acceleration__max_residual_ratio}
+                anderson_config->getConfigParameter<double>(
+                    "max_residual_ratio", anderson.max_residual_ratio);
+            if (anderson.depth < 1 || !(anderson.max_residual_ratio > 0))
+            {
+                OGS_FATAL(
+                    "Invalid Anderson acceleration parameters: depth = %d, "
+                    "max_residual_ratio = %g. Required are depth >= 1 and "
+                    "max_residual_ratio > 0.",
+                    anderson.depth, anderson.max_residual_ratio);
+            }
+            nonlinear_solver->setAndersonAcceleration(anderson);
+        }
+
+        return std::make_pair(std::move(nonlinear_solver), tag);
     }
     if (type == "Newton")
     {
@@ -441,9 +1335,180 @@ createNonlinearSolver(GlobalLinearSolver& linear_solver,
         }
         auto const tag = NonlinearSolverTag::Newton;
         using ConcreteNLS = NonlinearSolver<tag>;
-        return std::make_pair(
-            std::make_unique<ConcreteNLS>(linear_solver, max_iter, damping),
-            tag);
+        auto nonlinear_solver =
+            std::make_unique<ConcreteNLS>(linear_solver, max_iter, damping);
+
+        nonlinear_solver->setResidualOnlyAssembly(
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__residual_only_assembly}
+            config.getConfigParameter<bool>("residual_only_assembly", false));
+
+        nonlinear_solver->setConstantJacobian(
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__constant_jacobian}
+            config.getConfigParameter<bool>("constant_jacobian", false));
+
+        if (auto const lagging_config =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__jacobian_lagging}
+            config.getConfigSubtreeOptional("jacobian_lagging"))
+        {
+            JacobianLagging lagging;
+            lagging.max_lagged_iterations =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__jacobian_lagging__max_lagged_iterations}
+                lagging_config->getConfigParameter<int>(
+                    "max_lagged_iterations");
+            lagging.max_residual_ratio =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__jacobian_lagging__max_residual_ratio}
+                lagging_config->getConfigParameter<double>(
+                    "max_residual_ratio", lagging.max_residual_ratio);
+            if (lagging.max_lagged_iterations < 0 ||
+                lagging.max_residual_ratio <= 0)
+            {
+                OGS_FATAL(
+                    "The number of lagged iterations must be non-negative and "
+                    "the maximum residual ratio positive, got %d and %g.",
+                    lagging.max_lagged_iterations, lagging.max_residual_ratio);
+            }
+            nonlinear_solver->setJacobianLagging(lagging);
+        }
+
+        if (auto const ew_config =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__eisenstat_walker}
+            config.getConfigSubtreeOptional("eisenstat_walker"))
+        {
+            EisenstatWalker ew;
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__eisenstat_walker__eta_max}
+            ew.eta_max = ew_config->getConfigParameter<double>("eta_max",
+                                                               ew.eta_max);
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__eisenstat_walker__eta_min}
+            ew.eta_min = ew_config->getConfigParameter<double>("eta_min",
+                                                               ew.eta_min);
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__eisenstat_walker__gamma}
+            ew.gamma = ew_config->getConfigParameter<double>("gamma", ew.gamma);
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__eisenstat_walker__alpha}
+            ew.alpha = ew_config->getConfigParameter<double>("alpha", ew.alpha);
+            if (!(0 < ew.eta_min && ew.eta_min <= ew.eta_max &&
+                  ew.eta_max < 1) ||
+                !(0 < ew.gamma && ew.gamma <= 1) ||
+                !(1 < ew.alpha && ew.alpha <= 2))
+            {
+                OGS_FATAL(
+                    "Invalid Eisenstat-Walker parameters: eta_min = %g, "
+                    "eta_max = %g, gamma = %g, alpha = %g. Required are 0 < "
+                    "eta_min <= eta_max < 1, 0 < gamma <= 1, and 1 < alpha <= "
+                    "2.",
+                    ew.eta_min, ew.eta_max, ew.gamma, ew.alpha);
+            }
+            nonlinear_solver->setEisenstatWalker(ew);
+        }
+
+        if (auto const ls_config =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__line_search}
+            config.getConfigSubtreeOptional("line_search"))
+        {
+            LineSearch ls;
+            auto const ls_type =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__line_search__type}
+                ls_config->getConfigParameter<std::string>("type");
+            if (ls_type == "Backtracking")
+            {
+                ls.type = LineSearch::Type::Backtracking;
+            }
+            else if (ls_type == "CriticalPoint")
+            {
+                ls.type = LineSearch::Type::CriticalPoint;
+            }
+            else
+            {
+                OGS_FATAL(
+                    "Unknown line search type '%s'. Possible values are "
+                    "Backtracking and CriticalPoint.",
+                    ls_type.c_str());
+            }
+            ls.max_iterations =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__line_search__max_iterations}
+                ls_config->getConfigParameter<int>("max_iterations",
+                                                   ls.max_iterations);
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__line_search__min_step}
+            ls.min_step = ls_config->getConfigParameter<double>("min_step",
+                                                                ls.min_step);
+            ls.sufficient_decrease =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__line_search__sufficient_decrease}
+                ls_config->getConfigParameter<double>("sufficient_decrease",
+                                                      ls.sufficient_decrease);
+            if (ls.max_iterations < 1 ||
+                !(0 < ls.min_step && ls.min_step < 1) ||
+                !(0 < ls.sufficient_decrease && ls.sufficient_decrease < 1))
+            {
+                OGS_FATAL(
+                    "Invalid line search parameters: max_iterations = %d, "
+                    "min_step = %g, sufficient_decrease = %g. Required are "
+                    "max_iterations >= 1, 0 < min_step < 1, and 0 < "
+                    "sufficient_decrease < 1.",
+                    ls.max_iterations, ls.min_step, ls.sufficient_decrease);
+            }
+            nonlinear_solver->setLineSearch(ls);
+        }
+
+        if (auto const jf_config =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__jacobian_free}
+            config.getConfigSubtreeOptional("jacobian_free"))
+        {
+            JacobianFree jf;
+            jf.krylov_dimension =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__jacobian_free__krylov_dimension}
+                jf_config->getConfigParameter<int>("krylov_dimension",
+                                                   jf.krylov_dimension);
+            jf.max_iterations =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__jacobian_free__max_iterations}
+                jf_config->getConfigParameter<int>("max_iterations",
+                                                   jf.max_iterations);
+            jf.tolerance =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__jacobian_free__tolerance}
+                jf_config->getConfigParameter<double>("tolerance",
+                                                      jf.tolerance);
+            jf.perturbation =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__jacobian_free__perturbation}
+                jf_config->getConfigParameter<double>("perturbation",
+                                                      jf.perturbation);
+            if (jf.krylov_dimension < 1 || jf.max_iterations < 1 ||
+                !(0 < jf.tolerance && jf.tolerance < 1) ||
+                !(jf.perturbation > 0))
+            {
+                OGS_FATAL(
+                    "Invalid Jacobian-free parameters: krylov_dimension = %d, "
+                    "max_iterations = %d, tolerance = %g, perturbation = %g. "
+                    "Required are krylov_dimension >= 1, max_iterations >= 1, "
+                    "0 < tolerance < 1, and perturbation > 0.",
+                    jf.krylov_dimension, jf.max_iterations, jf.tolerance,
+                    jf.perturbation);
+            }
+            nonlinear_solver->setJacobianFree(jf);
+        }
+
+        if (auto const guess_config =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__initial_guess}
+            config.getConfigSubtreeOptional("initial_guess"))
+        {
+            InitialGuess guess;
+            guess.extrapolation =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__initial_guess__extrapolation}
+                guess_config->getConfigParameter<bool>("extrapolation",
+                                                       guess.extrapolation);
+            guess.recycled_subspace_dimension =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__initial_guess__recycled_subspace_dimension}
+                guess_config->getConfigParameter<int>(
+                    "recycled_subspace_dimension",
+                    guess.recycled_subspace_dimension);
+            if (guess.recycled_subspace_dimension < 0)
+            {
+                OGS_FATAL(
+                    "The dimension of the recycled subspace must be "
+                    "non-negative, got %d.",
+                    guess.recycled_subspace_dimension);
+            }
+            nonlinear_solver->setInitialGuess(guess);
+        }
+
+        return std::make_pair(std::move(nonlinear_solver), tag);
     }
     OGS_FATAL("Unsupported nonlinear solver type");
 }
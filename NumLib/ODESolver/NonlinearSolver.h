@@ -10,13 +10,18 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
 #include <logog/include/logog.hpp>
 
 #include "ConvergenceCriterion.h"
 #include "NonlinearSolverStatus.h"
 #include "NonlinearSystem.h"
+#include "ReducedBasis.h"
 #include "Types.h"
 
 namespace BaseLib
@@ -67,6 +72,9 @@ public:
             postIterationCallback,
         int const process_id) = 0;
 
+    //! The linear solver used for the linearized equation systems.
+    virtual GlobalLinearSolver& getLinearSolver() const = 0;
+
     virtual ~NonlinearSolverBase() = default;
 };
 
@@ -80,6 +88,111 @@ public:
 template <NonlinearSolverTag NLTag>
 class NonlinearSolver;
 
+/*! Settings of the modified Newton method, in which the Jacobian of a
+ * previous iteration and its factorization or preconditioner are reused.
+ */
+struct JacobianLagging
+{
+    //! Maximum number of consecutive iterations reusing the Jacobian. Zero
+    //! disables the lagging.
+    int max_lagged_iterations = 0;
+
+    //! The Jacobian is recomputed if the ratio of the residual norms of two
+    //! subsequent iterations exceeds this value.
+    double max_residual_ratio = 0.5;
+};
+
+/*! Parameters of the adaptive tolerances of the linear solver according to
+ * Eisenstat and Walker (1996), choice 2.
+ *
+ * The relative tolerance in iteration \f$k\f$ is \f$ \eta_k = \gamma
+ * (\|r_k\| / \|r_{k-1}\|)^\alpha \f$, safeguarded by \f$ \eta_k \geq
+ * \gamma \eta_{k-1}^\alpha \f$ if the latter exceeds 0.1, and limited to
+ * \f$[\eta_\mathrm{min}, \eta_\mathrm{max}]\f$.
+ */
+struct EisenstatWalker
+{
+    double eta_max = 0.9;  //!< also the tolerance of the first iteration
+    double eta_min = 1e-8;
+    double gamma = 0.9;
+    double alpha = 2.0;
+};
+
+/*! Settings of the line search along the Newton direction \f$ -\Delta x
+ * \f$, which determines the step length \f$ \lambda \in (0, 1] \f$ of the
+ * update \f$ x - \lambda \Delta x \f$.
+ */
+struct LineSearch
+{
+    enum class Type
+    {
+        //! Backtracking until the residual norm decreases sufficiently. The
+        //! trial step lengths are obtained by quadratic interpolation.
+        Backtracking,
+        //! Secant iteration for a critical point of the residual along the
+        //! search direction, i.e., for \f$ r(x - \lambda \Delta x) \cdot
+        //! \Delta x = 0 \f$.
+        CriticalPoint
+    };
+
+    Type type = Type::Backtracking;
+
+    //! Maximum number of residual evaluations.
+    int max_iterations = 5;
+
+    //! Smallest step length; for the critical point search also the
+    //! tolerance of the step length.
+    double min_step = 1e-4;
+
+    //! Backtracking accepts a step if the residual norm is reduced by at
+    //! least the fraction \f$ c \lambda \f$.
+    double sufficient_decrease = 1e-4;
+};
+
+/*! Settings of the Jacobian-free Newton-Krylov method.
+ *
+ * The Newton system is solved by flexible GMRES, in which the products of the
+ * Jacobian with vectors \f$ v \f$ are approximated by forward differences of
+ * the residual, \f$ J v \approx (r(x + h v) - r(x)) / h \f$. The assembled
+ * Jacobian serves as right preconditioner only; it is applied by the
+ * configured linear solver and can be lagged over several iterations.
+ */
+struct JacobianFree
+{
+    //! Number of Krylov vectors before GMRES is restarted.
+    int krylov_dimension = 30;
+
+    //! Maximum number of GMRES iterations including restarts.
+    int max_iterations = 100;
+
+    //! Relative residual tolerance of GMRES. It is replaced by the
+    //! Eisenstat-Walker tolerances if these are configured.
+    double tolerance = 1e-6;
+
+    //! Relative perturbation of the solution for the difference quotients.
+    double perturbation = 1e-7;
+};
+
+/*! Settings of the initial guesses of the linear solver in the Newton
+ * iterations, which otherwise start from zero.
+ *
+ * The extrapolation of the previous increment assumes that each call of
+ * solve() computes one timestep of similar size, i.e., a monolithic scheme.
+ * The recycled subspace is spanned by the latest Newton updates of previous
+ * iterations and timesteps; the initial guess is corrected within it by
+ * minimizing the residual of the linear system.
+ */
+struct InitialGuess
+{
+    //! Start the first iteration from the total increment of the previous
+    //! converged solve().
+    bool extrapolation = false;
+
+    //! Number of previous Newton updates spanning the recycled subspace. Zero
+    //! disables the recycling.
+    int recycled_subspace_dimension = 0;
+};
+
 /*! Find a solution to a nonlinear equation using the Newton-Raphson method.
  */
 template <>
@@ -125,12 +238,99 @@ public:
             postIterationCallback,
         int const process_id) override;
 
+    GlobalLinearSolver& getLinearSolver() const override
+    {
+        return _linear_solver;
+    }
+
     void compensateNonEquilibriumInitialResiduum(bool const value)
     {
         _compensate_non_equilibrium_initial_residuum = value;
     }
 
+    void setJacobianLagging(JacobianLagging const& jacobian_lagging)
+    {
+        _jacobian_lagging = jacobian_lagging;
+    }
+
+    void setEisenstatWalker(EisenstatWalker const& eisenstat_walker)
+    {
+        _eisenstat_walker = eisenstat_walker;
+    }
+
+    void setLineSearch(LineSearch const& line_search)
+    {
+        _line_search = line_search;
+    }
+
+    void setJacobianFree(JacobianFree const& jacobian_free)
+    {
+        _jacobian_free = jacobian_free;
+    }
+
+    void setInitialGuess(InitialGuess const& initial_guess)
+    {
+        _initial_guess = initial_guess;
+    }
+
+    //! Omits the Jacobian from the assembly where it is not needed, i.e., in
+    //! lagged iterations and for the trial points of the line search. This
+    //! requires the process to implement the assembly without Jacobian.
+    void setResidualOnlyAssembly(bool const value)
+    {
+        _residual_only_assembly = value;
+    }
+
+    //! Treats the Jacobian as constant: it is assembled and factorized once
+    //! and reused in all iterations of all subsequent solves, until the ids
+    //! of the known solutions change or a linear solve fails. This is exact
+    //! for linear problems with a constant tangent, e.g., load cases of a
+    //! linear elastic body solved as successive timesteps.
+    void setConstantJacobian(bool const value) { _constant_jacobian = value; }
+
 private:
+    //! Assembles the equation system at \c x, optionally without the
+    //! Jacobian.
+    void assembleEquationSystem(std::vector<GlobalVector*> const& x,
+                                int const process_id,
+                                bool const with_jacobian) const;
+
+    //! Returns the step length along \c minus_delta_x found by the line
+    //! search starting from \c x with the residual \c res.
+    double lineSearch(std::vector<GlobalVector*> const& x,
+                      GlobalVector const& res, GlobalVector& minus_delta_x,
+                      int const process_id);
+
+    //! Solves \f$ J (-\Delta x) = r \f$ by Jacobian-free flexible GMRES
+    //! preconditioned with the assembled Jacobian \c J.
+    bool solveJacobianFree(std::vector<GlobalVector*> const& x,
+                           GlobalVector const& res, GlobalMatrix& J,
+                           GlobalVector& minus_delta_x, double const tolerance,
+                           int const process_id);
+
+    //! Sets \c minus_delta_x to the extrapolated increment in the first
+    //! iteration and to zero otherwise, and corrects it within the recycled
+    //! subspace.
+    void computeInitialGuess(GlobalMatrix const& J, GlobalVector const& res,
+                             GlobalVector& minus_delta_x,
+                             bool const first_iteration, int const process_id);
+
+    //! Adds the solution of the linear system to the recycled subspace.
+    void recycleSolution(GlobalVector const& minus_delta_x,
+                         int const process_id);
+
+    //! Data kept between calls of solve() for the initial guesses of one
+    //! process. The vectors are owned by the GlobalVectorProvider.
+    struct InitialGuessHistory
+    {
+        //! Total \f$ -\Delta x \f$ of the previous converged solve().
+        GlobalVector* previous_increment = nullptr;
+        bool has_previous_increment = false;
+        std::vector<GlobalVector*> subspace;
+        //! Position of the next vector replaced in the full subspace.
+        std::size_t next = 0;
+    };
+
     GlobalLinearSolver& _linear_solver;
     System* _equation_system = nullptr;
 
@@ -138,6 +338,25 @@ private:
     ConvergenceCriterion* _convergence_criterion = nullptr;
     int const _maxiter;  //!< maximum number of iterations
 
+    JacobianLagging _jacobian_lagging;
+    InitialGuess _initial_guess;
+    std::map<int, InitialGuessHistory> _initial_guess_history;
+    //! Adaptive linear solver tolerances; disabled if not set.
+    boost::optional<EisenstatWalker> _eisenstat_walker;
+    //! Line search; disabled if not set.
+    boost::optional<LineSearch> _line_search;
+    //! Jacobian-free Newton-Krylov method; disabled if not set.
+    boost::optional<JacobianFree> _jacobian_free;
+    bool _residual_only_assembly = false;
+
+    bool _constant_jacobian = false;
+    //! The Jacobian kept between the solves if it is constant. It is owned
+    //! by the GlobalMatrixProvider.
+    GlobalMatrix* _constant_J = nullptr;
+    //! The system whose Jacobian and factorization are held, or nullptr if
+    //! they have to be recomputed.
+    System const* _constant_J_system = nullptr;
+
     //! A positive damping factor. The default value 1.0 gives a non-damped
     //! Newton method. Common values are in the range 0.5 to 0.7 for somewhat
     //! conservative method and seldom become smaller than 0.2 for very
@@ -150,6 +369,15 @@ private:
     std::size_t _minus_delta_x_id = 0u;  //!< ID of the \f$ -\Delta x\f$ vector.
     std::size_t _x_new_id =
         0u;  //!< ID of the vector storing \f$ x - (-\Delta x) \f$.
+    std::size_t _res_trial_id = 0u;  //!< ID of the line search residual.
+    //! IDs of the Krylov basis and of its preconditioned vectors.
+    std::vector<std::size_t> _krylov_basis_ids;
+    std::vector<std::size_t> _krylov_preconditioned_ids;
+    std::size_t _krylov_work_id = 0u;  //!< ID of a work vector of GMRES.
+    std::size_t _x_start_id = 0u;  //!< ID of the solution at the start.
+    //! IDs of the residual and of the images of the recycled subspace.
+    std::size_t _guess_residual_id = 0u;
+    std::vector<std::size_t> _guess_image_ids;
 
     /// Enables computation of the non-equilibrium initial residuum \f$ r_{\rm
     /// neq} \f$ before the first time step. The forces are zero if the external
@@ -159,6 +387,27 @@ private:
     bool _compensate_non_equilibrium_initial_residuum = false;
 };
 
+/*! Settings of the Anderson acceleration of the Picard iterations
+ * (Walker and Ni, 2011).
+ *
+ * The next iterate is the combination of the latest solutions \f$ g_i \f$ of
+ * the linearized systems whose fixed-point residuals \f$ f_i = g_i - x_i \f$
+ * combine to the smallest residual in the least-squares sense.
+ */
+struct AndersonAcceleration
+{
+    //! Number of previous iterations used for the combination.
+    int depth = 5;
+
+    //! If set, the history is discarded when it is full. Otherwise the oldest
+    //! iteration is replaced.
+    bool restart = false;
+
+    //! The history is discarded and the plain Picard update is used if the
+    //! norm of the fixed-point residual grows by more than this factor.
+    double max_residual_ratio = 1.0;
+};
+
 /*! Find a solution to a nonlinear equation using the Picard fixpoint iteration
  * method.
  *
@@ -203,12 +452,54 @@ public:
             postIterationCallback,
         int const process_id) override;
 
+    GlobalLinearSolver& getLinearSolver() const override
+    {
+        return _linear_solver;
+    }
+
     void compensateNonEquilibriumInitialResiduum(bool const value)
     {
         _compensate_non_equilibrium_initial_residuum = value;
     }
 
+    void setAndersonAcceleration(AndersonAcceleration const& anderson)
+    {
+        _anderson = anderson;
+    }
+
+    //! Solves the linearized equation systems of the given process in the
+    //! subspace of the reduced basis instead of calling the linear solver.
+    void setReducedBasis(int const process_id,
+                         std::shared_ptr<ReducedBasis const> reduced_basis)
+    {
+        _reduced_bases[process_id] = std::move(reduced_basis);
+    }
+
 private:
+    //! The fixed-point residuals and solutions of the linearized systems of
+    //! the previous Picard iterations of one solve(). The vectors are owned
+    //! by the GlobalVectorProvider.
+    struct AndersonHistory
+    {
+        //! Differences of subsequent residuals and solutions.
+        std::vector<GlobalVector*> delta_f;
+        std::vector<GlobalVector*> delta_g;
+        //! Number of valid differences and the position of the next one.
+        std::size_t size = 0;
+        std::size_t next = 0;
+        //! The negative residual and the solution of the last iteration.
+        GlobalVector* minus_f = nullptr;
+        GlobalVector* g = nullptr;
+        double f_norm = 0;
+        bool has_last_iteration = false;
+    };
+
+    //! Replaces \c x_new, the solution of the linearized system, by the
+    //! accelerated iterate and updates the \c history.
+    //! \param minus_f the negative fixed-point residual \f$ x - x_{new} \f$.
+    void accelerate(GlobalVector const& minus_f, GlobalVector& x_new,
+                    AndersonHistory& history) const;
+
     GlobalLinearSolver& _linear_solver;
     System* _equation_system = nullptr;
 
@@ -216,11 +507,26 @@ private:
     ConvergenceCriterion* _convergence_criterion = nullptr;
     const int _maxiter;  //!< maximum number of iterations
 
+    //! Anderson acceleration; disabled if not set.
+    boost::optional<AndersonAcceleration> _anderson;
+    //! IDs of the vectors of the Anderson history.
+    std::vector<std::size_t> _anderson_ids;
+
+    //! Reduced bases of the processes solved by a reduced order model.
+    std::map<int, std::shared_ptr<ReducedBasis const>> _reduced_bases;
+
     GlobalVector* _r_neq = nullptr;  //!< non-equilibrium initial residuum.
     std::size_t _A_id = 0u;      //!< ID of the \f$ A \f$ matrix.
     std::size_t _rhs_id = 0u;    //!< ID of the right-hand side vector.
     std::size_t _x_new_id = 0u;  //!< ID of the vector storing the solution of
                                  //! the linearized equation.
+    //! ID of the diagonal of a diagonal \f$ A \f$, see
+    //! System::isADiagonal().
+    std::size_t _diagonal_id = 0u;
+
+    //! The equation system whose matrix has been factorized or
+    //! preconditioned in the last linear solve, see System::isAUnchanged().
+    System const* _linear_solver_setup_system = nullptr;
 
     // clang-format off
     /// \copydoc NumLib::NonlinearSolver<NonlinearSolverTag::Newton>::_compensate_non_equilibrium_initial_residuum
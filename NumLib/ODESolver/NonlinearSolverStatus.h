@@ -16,5 +16,9 @@ struct NonlinearSolverStatus
 {
     bool error_norms_met = false;
     int number_iterations = -1;
+    /// Ratio of the norms of the last and the second to last solution
+    /// increments. Values close to or above one indicate that the iterations
+    /// hardly converge. Zero if less than two iterations were made.
+    double contraction_rate = 0;
 };
 }  // namespace NumLib
@@ -40,6 +40,12 @@ public:
     virtual void assemble(std::vector<GlobalVector*> const& x,
                           int const process_id) = 0;
 
+    //! Assembles the equation system at the point \c x like assemble() but
+    //! without the Jacobian. Afterwards getResidual() may be used, whereas the
+    //! Jacobian of the last assemble() call is kept.
+    virtual void assembleResidual(std::vector<GlobalVector*> const& x,
+                                  int const process_id) = 0;
+
     /*! Writes the residual at point \c x to \c res.
      *
      * \pre assemble() must have been called before with the same argument \c x.
@@ -69,6 +75,19 @@ public:
     virtual void applyKnownSolutionsNewton(
         GlobalMatrix& Jac, GlobalVector& res,
         GlobalVector& minus_delta_x) const = 0;
+
+    //! Apply known solutions to \c res and \c minus_delta_x only, e.g., if
+    //! they have already been applied to the Jacobian in a previous
+    //! iteration.
+    //! \pre computeKnownSolutions() must have been called before.
+    virtual void applyKnownSolutionsNewton(
+        GlobalVector& res, GlobalVector& minus_delta_x) const = 0;
+
+    //! Returns true if the ids of the known solutions are the same as at the
+    //! previous computeKnownSolutions(). Then a Jacobian to which the known
+    //! solutions have been applied before can be reused.
+    //! \pre computeKnownSolutions() must have been called before.
+    virtual bool areKnownSolutionIdsUnchanged() const { return false; }
 };
 
 /*! A System of nonlinear equations to be solved with the Picard fixpoint
@@ -108,6 +127,19 @@ public:
     //! \pre computeKnownSolutions() must have been called before.
     virtual void applyKnownSolutionsPicard(GlobalMatrix& A, GlobalVector& rhs,
                                            GlobalVector& x) const = 0;
+
+    //! Returns true if the matrix written by getA(), after the application of
+    //! the known solutions, is the same as after the previous assemble(). Then
+    //! the factorization or preconditioner of the previous linear solve can be
+    //! reused.
+    //! \pre computeKnownSolutions() and assemble() must have been called
+    //! before.
+    virtual bool isAUnchanged() const { return false; }
+
+    //! Returns true if the matrix written by getA() is diagonal, e.g., for
+    //! an explicit time discretization with lumped mass matrix. Then the
+    //! linearized system is solved without the linear solver.
+    virtual bool isADiagonal() const { return false; }
 };
 
 //! @}
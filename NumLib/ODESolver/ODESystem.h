@@ -66,6 +66,49 @@ public:
     {
         return nullptr;  // by default there are no known solutions
     }
+
+    /*! Switches the ODE with the given \c process_id to time-invariant
+     * matrices.
+     *
+     * Afterwards assemble() only assembles the domain contributions to \c M,
+     * \c K and \c b, which are assumed to be independent of \c t, \c dt and
+     * \c x, such that they are assembled only once. The contributions of the
+     * natural boundary conditions and source terms are assembled separately
+     * in each timestep by assembleNaturalBCsAndSourceTerms().
+     *
+     * \return whether the ODE system has time-invariant matrices. If not, the
+     * assembly is unchanged.
+     */
+    virtual bool useTimeInvariantMatrices(int const /*process_id*/)
+    {
+        return false;
+    }
+
+    /*! Assembles the contributions of the natural boundary conditions and
+     * source terms at the provided state (\c t, \c x).
+     *
+     * Only called if useTimeInvariantMatrices() returned true. The
+     * contributions to \c K must be time-invariant, too, because they are
+     * only used in the first assembly.
+     */
+    virtual void assembleNaturalBCsAndSourceTerms(
+        const double /*t*/, std::vector<GlobalVector*> const& /*x*/,
+        int const /*process_id*/, GlobalMatrix& /*K*/, GlobalVector& /*b*/)
+    {
+    }
+
+    /*! Switches the assembly of the ODE with the given \c process_id to a
+     * lumped mass matrix for the explicit forward Euler scheme.
+     *
+     * Afterwards assemble() adds the row sums of the local mass matrices to
+     * the diagonal of the global \c M and subtracts the domain contributions
+     * \f$ K_e \cdot x_e \f$ from the local \c b, as for elementwise
+     * residuals. The global \c M and \c K need no storage for the whole
+     * sparsity pattern.
+     *
+     * \return whether the ODE system supports the lumped mass matrix.
+     */
+    virtual bool enableLumpedMass(int const /*process_id*/) { return false; }
 };
 
 /*! Interface for a first-order implicit quasi-linear ODE.
@@ -135,6 +178,24 @@ public:
                                       int const process_id, GlobalMatrix& M,
                                       GlobalMatrix& K, GlobalVector& b,
                                       GlobalMatrix& Jac) = 0;
+
+    /*! Switches the assembly of the ODE with the given \c process_id to
+     * elementwise residuals.
+     *
+     * Afterwards assembleWithJacobian() and assemble() subtract the domain
+     * contributions \f$ M_e \cdot \hat x_e + K_e \cdot x_e \f$ from the
+     * local \c b of each element, such that \c b holds the negative residual
+     * of the domain. Only boundary conditions and source terms still add to
+     * the global \c M and \c K, which therefore need no storage for the
+     * whole sparsity pattern.
+     *
+     * \return whether the ODE system supports elementwise residuals. If not,
+     * the assembly is unchanged.
+     */
+    virtual bool enableElementwiseResidual(int const /*process_id*/)
+    {
+        return false;
+    }
 };
 
 //! @}
@@ -0,0 +1,157 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ReducedBasis.h"
+
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+
+#include <Eigen/Eigenvalues>
+#include <Eigen/LU>
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+
+namespace NumLib
+{
+void SnapshotCollector::addSnapshot(GlobalVector const& x)
+{
+#ifdef USE_PETSC
+    (void)x;
+    OGS_FATAL("Reduced order models are not implemented for PETSc.");
+#else
+    _snapshots.push_back(x.getRawVector());
+#endif
+}
+
+Eigen::MatrixXd SnapshotCollector::computeBasis(
+    double const energy_fraction) const
+{
+    auto const m = static_cast<Eigen::Index>(_snapshots.size());
+    if (m == 0)
+    {
+        OGS_FATAL("A POD basis cannot be computed without snapshots.");
+    }
+
+    Eigen::MatrixXd correlation(m, m);
+    for (Eigen::Index i = 0; i < m; ++i)
+    {
+        for (Eigen::Index j = 0; j <= i; ++j)
+        {
+            correlation(i, j) = correlation(j, i) =
+                _snapshots[i].dot(_snapshots[j]);
+        }
+    }
+
+    // The eigenvalues are in increasing order.
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> const eigen(correlation);
+    Eigen::VectorXd const& lambda = eigen.eigenvalues();
+    double const total = lambda.cwiseMax(0).sum();
+    // Modes below the round-off of the correlation matrix are not
+    // orthonormalizable.
+    double const cutoff = 1e-12 * lambda[m - 1];
+
+    Eigen::Index r = 0;
+    for (double energy = 0; r < m && energy < energy_fraction * total; ++r)
+    {
+        if (lambda[m - 1 - r] <= cutoff)
+        {
+            break;
+        }
+        energy += lambda[m - 1 - r];
+    }
+
+    Eigen::MatrixXd basis =
+        Eigen::MatrixXd::Zero(_snapshots.front().size(), r);
+    for (Eigen::Index k = 0; k < r; ++k)
+    {
+        for (Eigen::Index i = 0; i < m; ++i)
+        {
+            basis.col(k) += eigen.eigenvectors()(i, m - 1 - k) * _snapshots[i];
+        }
+        basis.col(k) /= std::sqrt(lambda[m - 1 - k]);
+    }
+    INFO("POD basis of %d modes from %d snapshots.", static_cast<int>(r),
+         static_cast<int>(m));
+    return basis;
+}
+
+ReducedBasis::ReducedBasis(Eigen::MatrixXd basis) : _basis(std::move(basis)) {}
+
+bool ReducedBasis::solve(GlobalMatrix const& A, GlobalVector const& rhs,
+                         GlobalVector& x) const
+{
+#ifdef USE_PETSC
+    (void)A, (void)rhs, (void)x;
+    OGS_FATAL("Reduced order models are not implemented for PETSc.");
+#else
+    if (A.getRawMatrix().rows() != _basis.rows())
+    {
+        OGS_FATAL(
+            "The reduced basis has %d rows but the equation system %d "
+            "unknowns.",
+            static_cast<int>(_basis.rows()),
+            static_cast<int>(A.getRawMatrix().rows()));
+    }
+    Eigen::MatrixXd const A_V = A.getRawMatrix() * _basis;
+    Eigen::MatrixXd const A_reduced = _basis.transpose() * A_V;
+    Eigen::PartialPivLU<Eigen::MatrixXd> const lu(A_reduced);
+    if (!(std::abs(lu.determinant()) > 0))
+    {
+        ERR("The reduced equation system is singular.");
+        return false;
+    }
+    x.getRawVector() =
+        _basis * lu.solve(_basis.transpose() * rhs.getRawVector());
+    return true;
+#endif
+}
+
+void writeReducedBasis(std::string const& file_name,
+                       Eigen::MatrixXd const& basis)
+{
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        OGS_FATAL("Could not open the file '%s' for writing.",
+                  file_name.c_str());
+    }
+    std::int64_t const size[2] = {basis.rows(), basis.cols()};
+    os.write(reinterpret_cast<char const*>(size), sizeof(size));
+    os.write(reinterpret_cast<char const*>(basis.data()),
+             basis.size() * sizeof(double));
+    if (!os)
+    {
+        OGS_FATAL("Could not write the reduced basis to '%s'.",
+                  file_name.c_str());
+    }
+}
+
+Eigen::MatrixXd readReducedBasis(std::string const& file_name)
+{
+    std::ifstream is(file_name, std::ios::binary);
+    std::int64_t size[2];
+    if (!is.read(reinterpret_cast<char*>(size), sizeof(size)) ||
+        size[0] < 0 || size[1] < 0)
+    {
+        OGS_FATAL("Could not read the reduced basis from '%s'.",
+                  file_name.c_str());
+    }
+    Eigen::MatrixXd basis(size[0], size[1]);
+    if (!is.read(reinterpret_cast<char*>(basis.data()),
+                 basis.size() * sizeof(double)))
+    {
+        OGS_FATAL("The reduced basis file '%s' is truncated.",
+                  file_name.c_str());
+    }
+    return basis;
+}
+}  // namespace NumLib
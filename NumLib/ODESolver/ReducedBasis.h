@@ -0,0 +1,81 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
+
+namespace NumLib
+{
+//! \addtogroup ODESolver
+//! @{
+
+/*! Collects solutions of a process as snapshots for a proper orthogonal
+ * decomposition (POD).
+ *
+ * The basis is computed by the method of snapshots, i.e., from the
+ * eigenvectors of the small correlation matrix \f$ S^T S \f$ of the snapshot
+ * matrix \f$ S \f$, whose number of columns is the number of snapshots.
+ */
+class SnapshotCollector final
+{
+public:
+    void addSnapshot(GlobalVector const& x);
+
+    std::size_t numberOfSnapshots() const { return _snapshots.size(); }
+
+    /*! Returns the orthonormal POD basis as the columns of a matrix.
+     *
+     * \param energy_fraction the basis comprises the fewest modes whose
+     *        eigenvalues sum up to at least this fraction of the total.
+     */
+    Eigen::MatrixXd computeBasis(double const energy_fraction) const;
+
+private:
+    std::vector<Eigen::VectorXd> _snapshots;
+};
+
+/*! Solves the linearized equation systems in the subspace spanned by a reduced
+ * basis \f$ V \f$, i.e., \f$ x = V (V^T A V)^{-1} V^T b \f$ (Galerkin
+ * projection).
+ *
+ * Only the dense reduced system is factorized. The global equation system is
+ * still assembled from all elements.
+ */
+class ReducedBasis final
+{
+public:
+    explicit ReducedBasis(Eigen::MatrixXd basis);
+
+    //! \return false if the reduced system is singular.
+    bool solve(GlobalMatrix const& A, GlobalVector const& rhs,
+               GlobalVector& x) const;
+
+    Eigen::Index size() const { return _basis.cols(); }
+
+private:
+    Eigen::MatrixXd const _basis;
+};
+
+//! Writes the basis in a binary format: the numbers of rows and of columns as
+//! 64 bit integers followed by the entries in column-major order.
+void writeReducedBasis(std::string const& file_name,
+                       Eigen::MatrixXd const& basis);
+
+//! Reads a basis written by writeReducedBasis().
+Eigen::MatrixXd readReducedBasis(std::string const& file_name);
+
+//! @}
+}  // namespace NumLib
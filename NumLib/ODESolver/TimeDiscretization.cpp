@@ -11,6 +11,8 @@
 
 #include "TimeDiscretization.h"
 
+#include <cmath>
+
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 
 namespace NumLib
@@ -53,12 +55,45 @@ double TimeDiscretization::computeRelativeChangeFromPreviousTimestep(
     return norm_dx / std::numeric_limits<double>::epsilon();
 }
 
+double TimeDiscretization::getRelativeLocalErrorEstimate(
+    GlobalVector const& /*x*/, MathLib::VecNormType /*norm_type*/)
+{
+    OGS_FATAL(
+        "The local error estimate is not available for the chosen time "
+        "discretization scheme. Use the backward Euler scheme.");
+}
+
 double BackwardEuler::getRelativeChangeFromPreviousTimestep(
     GlobalVector const& x, MathLib::VecNormType norm_type)
 {
     return computeRelativeChangeFromPreviousTimestep(x, _x_old, norm_type);
 }
 
+double BackwardEuler::getRelativeLocalErrorEstimate(
+    GlobalVector const& x, MathLib::VecNormType norm_type)
+{
+    if (!_x_older)
+    {
+        _x_older = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(x);
+        _x_predicted =
+            MathLib::MatrixVectorTraits<GlobalVector>::newInstance(x);
+    }
+    // Two preceding solutions are needed for the extrapolation.
+    if (std::isnan(_delta_t_older))
+    {
+        return 0.0;
+    }
+
+    // x_predicted = (1 + ratio) * x_old - ratio * x_older
+    double const ratio = _delta_t / _delta_t_older;
+    MathLib::LinAlg::copy(_x_old, *_x_predicted);
+    MathLib::LinAlg::axpby(*_x_predicted, -ratio, 1.0 + ratio, *_x_older);
+
+    return _delta_t / (_delta_t + _delta_t_older) *
+           computeRelativeChangeFromPreviousTimestep(x, *_x_predicted,
+                                                     norm_type);
+}
+
 double ForwardEuler::getRelativeChangeFromPreviousTimestep(
     GlobalVector const& x, MathLib::VecNormType norm_type)
 {
@@ -128,6 +128,17 @@ public:
     virtual double getRelativeChangeFromPreviousTimestep(
         GlobalVector const& x, MathLib::VecNormType norm_type) = 0;
 
+    /*! Get an estimate of the relative local truncation error of the current
+     *  timestep, which is computed by an embedded scheme of higher order.
+     *
+     * The default implementation reports that no such estimate is available.
+     *
+     * \param x         The solution at the current timestep.
+     * \param norm_type The type of global vector norm.
+     */
+    virtual double getRelativeLocalErrorEstimate(
+        GlobalVector const& x, MathLib::VecNormType norm_type);
+
     /*! Indicate that the current timestep is done and that you will proceed to
      * the next one.
      *
@@ -272,9 +283,26 @@ public:
     double getRelativeChangeFromPreviousTimestep(
         GlobalVector const& x, MathLib::VecNormType norm_type) override;
 
+    /*! Estimates the local truncation error by the difference of the solution
+     *  and the linear extrapolation \f$ u^p \f$ of the two preceding
+     *  solutions, which is the second order predictor of the BDF(2) scheme,
+     *  as \f$ e_n = \Delta t_n / (\Delta t_n + \Delta t_{n-1})
+     *  \|u^{n+1}-u^p\|/\|u^{n+1}\| \f$.
+     *
+     * The preceding solutions are stored from the first call on, which
+     * returns zero.
+     */
+    double getRelativeLocalErrorEstimate(
+        GlobalVector const& x, MathLib::VecNormType norm_type) override;
+
     void pushState(const double /*t*/, GlobalVector const& x,
                    InternalMatrixStorage const& /*strg*/) override
     {
+        if (_x_older)
+        {
+            MathLib::LinAlg::copy(_x_old, *_x_older);
+            _delta_t_older = _delta_t;
+        }
         MathLib::LinAlg::copy(x, _x_old);
     }
 
@@ -306,13 +334,42 @@ private:
     double _delta_t =
         std::numeric_limits<double>::quiet_NaN();  //!< the timestep size
     GlobalVector& _x_old;   //!< the solution from the preceding timestep
+
+    //! The solution from the timestep before the preceding one, only stored
+    //! for the local error estimate.
+    std::unique_ptr<GlobalVector> _x_older;
+    //! The timestep size before the preceding one.
+    double _delta_t_older = std::numeric_limits<double>::quiet_NaN();
+    //! Used to store the extrapolated solution \f$ u^p \f$.
+    std::unique_ptr<GlobalVector> _x_predicted;
 };
 
-//! Forward Euler scheme.
+/*! Forward Euler scheme.
+ *
+ * With a lumped mass matrix the scheme is explicit: \f$ M \f$ is replaced by
+ * the diagonal matrix of the row sums of the local mass matrices, such that
+ * the new solution follows without a linear solver. The domain part of
+ * \f$ K \cdot x \f$ is computed elementwise then, without a global \f$ K \f$.
+ * The time step size is limited to a fraction of the stability limit
+ * estimated in the assembly; the preload provides the estimate for the first
+ * time step.
+ */
 class ForwardEuler final : public TimeDiscretization
 {
 public:
-    ForwardEuler() : _x_old(NumLib::GlobalVectorProvider::provider.getVector())
+    /*! Constructs a new instance.
+     *
+     * \param lumped_mass whether the explicit scheme with lumped mass matrix
+     *                    is used.
+     * \param time_step_safety_factor the fraction of the estimated stability
+     *                    limit the time step size is limited to if the mass
+     *                    matrix is lumped.
+     */
+    explicit ForwardEuler(bool const lumped_mass = false,
+                          double const time_step_safety_factor = 1.0)
+        : _lumped_mass(lumped_mass),
+          _time_step_safety_factor(time_step_safety_factor),
+          _x_old(NumLib::GlobalVectorProvider::provider.getVector())
     {
     }
 
@@ -374,9 +431,18 @@ public:
 
     bool isLinearTimeDisc() const override { return true; }
     double getDxDx() const override { return 0.0; }
+    bool needsPreload() const override { return _lumped_mass; }
     //! Returns the solution from the preceding timestep.
     GlobalVector const& getXOld() const { return _x_old; }
+    //! Returns whether the explicit scheme with lumped mass matrix is used.
+    bool isMassLumped() const { return _lumped_mass; }
+    //! Returns the fraction of the estimated stability limit the time step
+    //! size is limited to.
+    double getTimeStepSafetyFactor() const { return _time_step_safety_factor; }
+
 private:
+    bool const _lumped_mass;
+    double const _time_step_safety_factor;
     double _t = std::numeric_limits<double>::quiet_NaN();  //!< \f$ t_C \f$
     double _t_old =
         std::numeric_limits<double>::quiet_NaN();  //!< the time of the
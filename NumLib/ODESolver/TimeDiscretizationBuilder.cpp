@@ -28,7 +28,21 @@ std::unique_ptr<TimeDiscretization> createTimeDiscretization(
     //! \ogs_file_param_special{prj__time_loop__processes__process__time_discretization__ForwardEuler}
     if (type == "ForwardEuler")
     {
-        return std::make_unique<ForwardEuler>();
+        auto const lumped_mass =
+            //! \ogs_file_param{prj__time_loop__processes__process__time_discretization__ForwardEuler__lumped_mass}
+            config.getConfigParameter<bool>("lumped_mass", false);
+        auto const time_step_safety_factor =
+            //! \ogs_file_param{prj__time_loop__processes__process__time_discretization__ForwardEuler__time_step_safety_factor}
+            config.getConfigParameter<double>("time_step_safety_factor", 0.9);
+        if (!(time_step_safety_factor > 0 && time_step_safety_factor <= 1))
+        {
+            OGS_FATAL(
+                "The time step safety factor of the forward Euler scheme must "
+                "be in (0, 1], got %g.",
+                time_step_safety_factor);
+        }
+        return std::make_unique<ForwardEuler>(lumped_mass,
+                                              time_step_safety_factor);
     }
     //! \ogs_file_param_special{prj__time_loop__processes__process__time_discretization__CrankNicolson}
     if (type == "CrankNicolson")
@@ -10,6 +10,9 @@
 
 #include "TimeDiscretizedODESystem.h"
 
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/ApplyKnownSolution.h"
 #include "MathLib/LinAlg/UnifiedMatrixSetters.h"
 #include "NumLib/IndexValueVector.h"
@@ -50,14 +53,45 @@ TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
       _time_disc(time_discretization),
       _mat_trans(createMatrixTranslator<ODETag>(time_discretization))
 {
+    if (auto const* const forward_euler =
+            dynamic_cast<ForwardEuler const*>(&time_discretization);
+        forward_euler != nullptr && forward_euler->isMassLumped())
+    {
+        OGS_FATAL(
+            "The forward Euler scheme with lumped mass matrix requires the "
+            "Picard nonlinear solver.");
+    }
+
+    auto const matrix_specification = _ode.getMatrixSpecifications(process_id);
     _Jac = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _Jac_id);
+        matrix_specification, _Jac_id);
+    _b = &NumLib::GlobalVectorProvider::provider.getVector(
+        matrix_specification, _b_id);
+
+    if (_mat_trans->isResidualElementwise() &&
+        _ode.enableElementwiseResidual(process_id))
+    {
+        // M and K only receive the contributions of boundary conditions, the
+        // entries are inserted on demand.
+        INFO(
+            "Assembling the residual of process %d elementwise without global "
+            "M and K matrices.",
+            process_id);
+        MathLib::MatrixSpecifications const boundary_specification{
+            matrix_specification.nrows, matrix_specification.ncols,
+            matrix_specification.ghost_indices, nullptr,
+            matrix_specification.block_size};
+        _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            boundary_specification, _M_id);
+        _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            boundary_specification, _K_id);
+        return;
+    }
+
     _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _M_id);
+        matrix_specification, _M_id);
     _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _K_id);
-    _b = &NumLib::GlobalVectorProvider::provider.getVector(
-        _ode.getMatrixSpecifications(process_id), _b_id);
+        matrix_specification, _K_id);
 }
 
 TimeDiscretizedODESystem<
@@ -122,6 +156,52 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     }
 }
 
+void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                              NonlinearSolverTag::Newton>::
+    assembleResidual(std::vector<GlobalVector*> const& x_new_timestep,
+                     int const process_id)
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    auto const t = _time_disc.getCurrentTime();
+    auto const dt = _time_disc.getCurrentTimeIncrement();
+    auto const& x_curr = _time_disc.getCurrentX(*x_new_timestep[process_id]);
+
+    std::vector<GlobalVector*> xdot(x_new_timestep.size());
+    for (auto& v : xdot)
+    {
+        v = &NumLib::GlobalVectorProvider::provider.getVector();
+        _time_disc.getXdot(*x_new_timestep[process_id], *v);
+    }
+
+    _M->setZero();
+    _K->setZero();
+    _b->setZero();
+
+    _ode.preAssemble(t, dt, x_curr);
+    try
+    {
+        _ode.assemble(t, dt, x_new_timestep, xdot, process_id, *_M, *_K, *_b);
+    }
+    catch (AssemblyException const&)
+    {
+        for (auto& v : xdot)
+        {
+            NumLib::GlobalVectorProvider::provider.releaseVector(*v);
+        }
+        throw;
+    }
+
+    LinAlg::finalizeAssembly(*_M);
+    LinAlg::finalizeAssembly(*_K);
+    LinAlg::finalizeAssembly(*_b);
+
+    for (auto& v : xdot)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*v);
+    }
+}
+
 void TimeDiscretizedODESystem<
     ODESystemTag::FirstOrderImplicitQuasilinear,
     NonlinearSolverTag::Newton>::getResidual(GlobalVector const& x_new_timestep,
@@ -152,6 +232,17 @@ void TimeDiscretizedODESystem<
 {
     _known_solutions =
         _ode.getKnownSolutions(_time_disc.getCurrentTime(), x, process_id);
+
+    std::vector<Index> ids;
+    if (_known_solutions)
+    {
+        for (auto const& bc : *_known_solutions)
+        {
+            std::copy(bc.ids.cbegin(), bc.ids.cend(), std::back_inserter(ids));
+        }
+    }
+    _known_solution_ids_changed = ids != _known_solution_ids;
+    _known_solution_ids = std::move(ids);
 }
 
 void TimeDiscretizedODESystem<
@@ -183,6 +274,29 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     MathLib::applyKnownSolution(Jac, res, minus_delta_x, ids, values);
 }
 
+void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                              NonlinearSolverTag::Newton>::
+    applyKnownSolutionsNewton(GlobalVector& res,
+                              GlobalVector& minus_delta_x) const
+{
+    if (!_known_solutions)
+    {
+        return;
+    }
+
+    // For the Newton method the values must be zero
+    for (auto const& bc : *_known_solutions)
+    {
+        for (auto const id : bc.ids)
+        {
+            MathLib::setVector(res, id, 0.0);
+            MathLib::setVector(minus_delta_x, id, 0.0);
+        }
+    }
+    MathLib::LinAlg::finalizeAssembly(res);
+    MathLib::LinAlg::finalizeAssembly(minus_delta_x);
+}
+
 TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
                          NonlinearSolverTag::Picard>::
     TimeDiscretizedODESystem(const int process_id, ODE& ode,
@@ -191,12 +305,65 @@ TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
       _time_disc(time_discretization),
       _mat_trans(createMatrixTranslator<ODETag>(time_discretization))
 {
+    _b = &NumLib::GlobalVectorProvider::provider.getVector(
+        ode.getMatrixSpecifications(process_id), _b_id);
+
+    if (auto const* const forward_euler =
+            dynamic_cast<ForwardEuler const*>(&time_discretization);
+        forward_euler != nullptr && forward_euler->isMassLumped())
+    {
+        if (!_ode.enableLumpedMass(process_id))
+        {
+            OGS_FATAL(
+                "Process %d does not support the forward Euler scheme with "
+                "lumped mass matrix.",
+                process_id);
+        }
+        INFO(
+            "Solving process %d explicitly with lumped mass matrix and "
+            "elementwise stiffness terms.",
+            process_id);
+        _lumped_mass = true;
+        // M only receives its diagonal and K only the contributions of
+        // boundary conditions; the entries are inserted on demand.
+        auto const matrix_specification =
+            _ode.getMatrixSpecifications(process_id);
+        MathLib::MatrixSpecifications const boundary_specification{
+            matrix_specification.nrows, matrix_specification.ncols,
+            matrix_specification.ghost_indices, nullptr,
+            matrix_specification.block_size};
+        _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            boundary_specification, _M_id);
+        _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            boundary_specification, _K_id);
+        return;
+    }
+
     _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
         ode.getMatrixSpecifications(process_id), _M_id);
     _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
         ode.getMatrixSpecifications(process_id), _K_id);
-    _b = &NumLib::GlobalVectorProvider::provider.getVector(
-        ode.getMatrixSpecifications(process_id), _b_id);
+
+    if (_ode.useTimeInvariantMatrices(process_id))
+    {
+        INFO(
+            "Assembling the matrices of process %d only once; they are "
+            "refactorized only if the timestep size changes.",
+            process_id);
+        auto const matrix_specification =
+            _ode.getMatrixSpecifications(process_id);
+        _time_invariant_matrices = true;
+        _b_domain = &NumLib::GlobalVectorProvider::provider.getVector(
+            matrix_specification, _b_domain_id);
+        // Only boundary conditions add to this matrix, the entries are
+        // inserted on demand.
+        MathLib::MatrixSpecifications const boundary_specification{
+            matrix_specification.nrows, matrix_specification.ncols,
+            matrix_specification.ghost_indices, nullptr,
+            matrix_specification.block_size};
+        _K_discarded = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            boundary_specification, _K_discarded_id);
+    }
 }
 
 TimeDiscretizedODESystem<
@@ -206,6 +373,11 @@ TimeDiscretizedODESystem<
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_M);
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_K);
     NumLib::GlobalVectorProvider::provider.releaseVector(*_b);
+    if (_time_invariant_matrices)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_b_domain);
+        NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_K_discarded);
+    }
 }
 
 void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
@@ -225,12 +397,65 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
         _time_disc.getXdot(*x_new_timestep[process_id], *v);
     }
 
-    _M->setZero();
-    _K->setZero();
-    _b->setZero();
-
     _ode.preAssemble(t, dt, x_curr);
-    _ode.assemble(t, dt, x_new_timestep, xdot, process_id, *_M, *_K, *_b);
+
+    if (!_time_invariant_matrices)
+    {
+        _M->setZero();
+        _K->setZero();
+        _b->setZero();
+
+        _ode.assemble(t, dt, x_new_timestep, xdot, process_id, *_M, *_K, *_b);
+
+        LinAlg::finalizeAssembly(*_M);
+        LinAlg::finalizeAssembly(*_K);
+        LinAlg::finalizeAssembly(*_b);
+    }
+    else
+    {
+        assembleWithTimeInvariantMatrices(t, dt, x_new_timestep, xdot,
+                                          process_id);
+    }
+}
+
+void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                              NonlinearSolverTag::Picard>::
+    assembleWithTimeInvariantMatrices(
+        double const t, double const dt,
+        std::vector<GlobalVector*> const& x_new_timestep,
+        std::vector<GlobalVector*> const& xdot, int const process_id)
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    auto const new_x_weight = _time_disc.getNewXWeight();
+    _A_unchanged = _time_invariant_matrices_assembled &&
+                   new_x_weight == _A_new_x_weight &&
+                   !_known_solution_ids_changed;
+    _A_new_x_weight = new_x_weight;
+
+    // The boundary conditions add to K only in the first assembly.
+    GlobalMatrix* K_bc = _K_discarded;
+    if (!_time_invariant_matrices_assembled)
+    {
+        _M->setZero();
+        _K->setZero();
+        _b_domain->setZero();
+
+        _ode.assemble(t, dt, x_new_timestep, xdot, process_id, *_M, *_K,
+                      *_b_domain);
+
+        LinAlg::finalizeAssembly(*_b_domain);
+        K_bc = _K;
+        _time_invariant_matrices_assembled = true;
+    }
+    else
+    {
+        _K_discarded->setZero();
+    }
+
+    LinAlg::copy(*_b_domain, *_b);
+    _ode.assembleNaturalBCsAndSourceTerms(t, x_new_timestep, process_id,
+                                          *K_bc, *_b);
 
     LinAlg::finalizeAssembly(*_M);
     LinAlg::finalizeAssembly(*_K);
@@ -244,6 +469,23 @@ void TimeDiscretizedODESystem<
 {
     _known_solutions =
         _ode.getKnownSolutions(_time_disc.getCurrentTime(), x, process_id);
+
+    if (!_time_invariant_matrices)
+    {
+        return;
+    }
+
+    // The matrix A with applied known solutions only depends on their ids.
+    std::vector<Index> ids;
+    if (_known_solutions)
+    {
+        for (auto const& bc : *_known_solutions)
+        {
+            std::copy(bc.ids.cbegin(), bc.ids.cend(), std::back_inserter(ids));
+        }
+    }
+    _known_solution_ids_changed = ids != _known_solution_ids;
+    _known_solution_ids = std::move(ids);
 }
 
 void TimeDiscretizedODESystem<
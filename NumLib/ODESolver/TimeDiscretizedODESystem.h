@@ -11,6 +11,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "MatrixTranslator.h"
 #include "NonlinearSystem.h"
@@ -86,6 +87,9 @@ public:
     void assemble(std::vector<GlobalVector*> const& x_new_timestep,
                   int const process_id) override;
 
+    void assembleResidual(std::vector<GlobalVector*> const& x_new_timestep,
+                          int const process_id) override;
+
     void getResidual(GlobalVector const& x_new_timestep,
                      GlobalVector& res) const override;
 
@@ -99,6 +103,14 @@ public:
     void applyKnownSolutionsNewton(GlobalMatrix& Jac, GlobalVector& res,
                                    GlobalVector& minus_delta_x) const override;
 
+    void applyKnownSolutionsNewton(GlobalVector& res,
+                                   GlobalVector& minus_delta_x) const override;
+
+    bool areKnownSolutionIdsUnchanged() const override
+    {
+        return !_known_solution_ids_changed;
+    }
+
     bool isLinear() const override
     {
         return _time_disc.isLinearTimeDisc() || _ode.isLinear();
@@ -136,6 +148,9 @@ private:
     using Index = MathLib::MatrixVectorTraits<GlobalMatrix>::Index;
     std::vector<NumLib::IndexValueVector<Index>> const* _known_solutions =
         nullptr;  //!< stores precomputed values for known solutions
+    //! Ids of the known solutions of the last computeKnownSolutions().
+    std::vector<Index> _known_solution_ids;
+    bool _known_solution_ids_changed = true;
 
     GlobalMatrix* _Jac;  //!< the Jacobian of the residual
     GlobalMatrix* _M;    //!< Matrix \f$ M \f$.
@@ -207,6 +222,10 @@ public:
         return _time_disc.isLinearTimeDisc() || _ode.isLinear();
     }
 
+    bool isAUnchanged() const override { return _A_unchanged; }
+
+    bool isADiagonal() const override { return _lumped_mass; }
+
     void preIteration(const unsigned iter, GlobalVector const& x) override
     {
         _ode.preIteration(iter, x);
@@ -230,6 +249,14 @@ public:
     }
 
 private:
+    //! Assembles \c _M, \c _K and the domain part of \c _b in the first call
+    //! only, and \c _b from the latter and the boundary conditions and source
+    //! terms in each call.
+    void assembleWithTimeInvariantMatrices(
+        double const t, double const dt,
+        std::vector<GlobalVector*> const& x_new_timestep,
+        std::vector<GlobalVector*> const& xdot, int const process_id);
+
     ODE& _ode;             //!< ode the ODE being wrapped
     TimeDisc& _time_disc;  //!< the time discretization to being used
 
@@ -247,6 +274,30 @@ private:
     std::size_t _M_id = 0u;  //!< ID of the \c _M matrix.
     std::size_t _K_id = 0u;  //!< ID of the \c _K matrix.
     std::size_t _b_id = 0u;  //!< ID of the \c _b vector.
+
+    //! Whether \c _M is the lumped mass matrix of the explicit forward Euler
+    //! scheme, see ODESystem::enableLumpedMass().
+    bool _lumped_mass = false;
+
+    //! If set, \c _M, \c _K and the domain part of \c _b are assembled only
+    //! once, see ODESystem::useTimeInvariantMatrices().
+    bool _time_invariant_matrices = false;
+    //! Whether the time-invariant matrices have already been assembled.
+    bool _time_invariant_matrices_assembled = false;
+    //! Domain part of \f$ b \f$ for time-invariant matrices.
+    GlobalVector* _b_domain = nullptr;
+    //! Receives the discarded contributions of the boundary conditions to
+    //! \f$ K \f$ for time-invariant matrices.
+    GlobalMatrix* _K_discarded = nullptr;
+    std::size_t _b_domain_id = 0u;     //!< ID of the \c _b_domain vector.
+    std::size_t _K_discarded_id = 0u;  //!< ID of the \c _K_discarded matrix.
+
+    //! Weight of \f$ M \f$ in the matrix \f$ A \f$ of the last assembly.
+    double _A_new_x_weight = 0;
+    //! Ids of the known solutions of the last computeKnownSolutions().
+    std::vector<Index> _known_solution_ids;
+    bool _known_solution_ids_changed = true;
+    bool _A_unchanged = false;  //!< \see isAUnchanged()
 };
 
 //! @}
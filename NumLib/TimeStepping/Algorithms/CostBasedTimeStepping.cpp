@@ -0,0 +1,203 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "CostBasedTimeStepping.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Algorithm.h"
+#include "BaseLib/FileTools.h"
+
+namespace NumLib
+{
+CostBasedTimeStepping::CostBasedTimeStepping(
+    double const t_initial, double const t_end, double const min_dt,
+    double const max_dt, double const initial_dt, double const max_multiplier,
+    double const rejection_multiplier, double const max_contraction_rate,
+    double const tol, std::vector<double>&& fixed_output_times)
+    : TimeStepAlgorithm(t_initial, t_end),
+      _min_dt(min_dt),
+      _max_dt(max_dt),
+      _initial_dt(initial_dt),
+      _max_multiplier(max_multiplier),
+      _rejection_multiplier(rejection_multiplier),
+      _max_contraction_rate(max_contraction_rate),
+      _tol(tol),
+      _fixed_output_times(std::move(fixed_output_times))
+{
+    if (_max_multiplier <= 1)
+    {
+        OGS_FATAL("The maximum multiplier must be greater than one.");
+    }
+    if (_rejection_multiplier <= 0 || _rejection_multiplier >= 1)
+    {
+        OGS_FATAL("The rejection multiplier must be between zero and one.");
+    }
+    if (_max_contraction_rate <= 0)
+    {
+        OGS_FATAL("The maximum contraction rate must be positive.");
+    }
+
+    // Remove possible duplicated elements. Result will be sorted.
+    BaseLib::makeVectorUnique(_fixed_output_times);
+}
+
+bool CostBasedTimeStepping::next(double const solution_error,
+                                 int const number_iterations)
+{
+    if (_ts_current.steps() == 0)
+    {
+        _ts_prev = _ts_current;
+        _ts_current += limitStepSize(_initial_dt);
+        return true;
+    }
+
+    double const dt = _ts_current.dt();
+    double const cost = _wall_clock_time > 0
+                            ? _wall_clock_time
+                            : std::max(number_iterations, 1);
+    bool const is_error_too_large = _tol > 0 && solution_error > _tol;
+
+    if (!_accepted || is_error_too_large)
+    {
+        // The work spent on the rejected step is charged to the step taken
+        // in its place.
+        _wasted_cost += cost;
+
+        double const multiplier =
+            _accepted ? std::min(0.9 * std::sqrt(_tol / solution_error), 1.0)
+                      : _rejection_multiplier;
+        _accepted = false;
+
+        _ts_current = _ts_prev;
+        _ts_current += limitStepSize(dt * multiplier);
+
+        if (is_error_too_large)
+        {
+            WARN(
+                "This step is rejected because the local error estimate %g "
+                "exceeds the given tolerance of %g.\n"
+                "\t This time step will be repeated with a new time step size "
+                "of %g\n"
+                "\t or the simulation will be halted.",
+                solution_error, _tol, _ts_current.dt());
+            return false;
+        }
+        return true;
+    }
+
+    double const efficiency = dt / (cost + _wasted_cost);
+    double const multiplier = computeMultiplier(efficiency, solution_error);
+    DBUG(
+        "Cost based time stepping: step size %g, cost %g, wasted cost %g, "
+        "efficiency %g, contraction rate %g, multiplier %g.",
+        dt, cost, _wasted_cost, efficiency, _contraction_rate, multiplier);
+
+    _wasted_cost = 0;
+    _previous_dt = dt;
+    _previous_efficiency = efficiency;
+
+    _ts_prev = _ts_current;
+    _dt_vector.push_back(dt);
+    _ts_current += limitStepSize(dt * multiplier);
+
+    return true;
+}
+
+double CostBasedTimeStepping::computeMultiplier(
+    double const efficiency, double const solution_error) const
+{
+    double multiplier = _max_multiplier;
+    if (!std::isnan(_previous_efficiency))
+    {
+        // Hill climbing on the efficiency: keep the direction of the last
+        // change while the efficiency grows, otherwise reverse it with a
+        // smaller change.
+        bool const was_increased = _ts_current.dt() >= _previous_dt;
+        if (efficiency >= _previous_efficiency)
+        {
+            multiplier = was_increased ? _max_multiplier : 1 / _max_multiplier;
+        }
+        else
+        {
+            multiplier = was_increased ? 1 / std::sqrt(_max_multiplier)
+                                       : std::sqrt(_max_multiplier);
+        }
+    }
+
+    // Slowly contracting iterations indicate that larger steps might fail.
+    if (_contraction_rate > _max_contraction_rate)
+    {
+        multiplier =
+            std::min(multiplier, _max_contraction_rate / _contraction_rate);
+    }
+
+    // Step size control of a first order scheme.
+    if (_tol > 0 && solution_error > 0)
+    {
+        multiplier =
+            std::min(multiplier, 0.9 * std::sqrt(_tol / solution_error));
+    }
+
+    return multiplier;
+}
+
+double CostBasedTimeStepping::limitStepSize(double const dt) const
+{
+    double dt_limited = std::clamp(dt, _min_dt, _max_dt);
+
+    double const t_next = dt_limited + _ts_prev.current();
+    if (t_next > end())
+    {
+        dt_limited = end() - _ts_prev.current();
+    }
+
+    return possiblyClampDtToNextFixedTime(_ts_prev.current(), dt_limited,
+                                          _fixed_output_times);
+}
+
+bool CostBasedTimeStepping::canReduceTimestepSize() const
+{
+    return _ts_current.dt() > _min_dt;
+}
+
+void CostBasedTimeStepping::addFixedOutputTimes(
+    std::vector<double> const& extra_fixed_output_times)
+{
+    _fixed_output_times.insert(_fixed_output_times.end(),
+                               extra_fixed_output_times.begin(),
+                               extra_fixed_output_times.end());
+
+    // Remove possible duplicated elements. Result will be sorted.
+    BaseLib::makeVectorUnique(_fixed_output_times);
+}
+
+void CostBasedTimeStepping::writeCheckpoint(std::ostream& os) const
+{
+    TimeStepAlgorithm::writeCheckpoint(os);
+    BaseLib::writeValueBinary(os, _wasted_cost);
+    BaseLib::writeValueBinary(os, _previous_dt);
+    BaseLib::writeValueBinary(os, _previous_efficiency);
+    BaseLib::writeValueBinary(os, _accepted);
+}
+
+void CostBasedTimeStepping::readCheckpoint(std::istream& is)
+{
+    TimeStepAlgorithm::readCheckpoint(is);
+    _wasted_cost = BaseLib::readBinaryValue<double>(is);
+    _previous_dt = BaseLib::readBinaryValue<double>(is);
+    _previous_efficiency = BaseLib::readBinaryValue<double>(is);
+    _accepted = BaseLib::readBinaryValue<bool>(is);
+}
+
+}  // namespace NumLib
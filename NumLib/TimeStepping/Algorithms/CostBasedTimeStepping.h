@@ -0,0 +1,149 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "TimeStepAlgorithm.h"
+
+namespace NumLib
+{
+/**
+ * \brief Time stepping maximizing the simulated time per computational cost.
+ *
+ * The cost of a step is its wall clock time, or the number of non-linear
+ * iterations if the wall clock time is not known. The costs of rejected steps
+ * are added to the cost of the step which finally succeeds in their place. The
+ * efficiency of an accepted step is its size divided by that cost.
+ *
+ * The step size is changed by a multiplier \f$\alpha\f$ after each accepted
+ * step. It keeps the direction of the last change, i.e. \f$\alpha =
+ * \alpha_{\max}\f$ or \f$\alpha = 1/\alpha_{\max}\f$, as long as the efficiency
+ * grows, and reverses the direction with the damped multiplier
+ * \f$\sqrt{\alpha_{\max}}\f$ or \f$1/\sqrt{\alpha_{\max}}\f$ otherwise.
+ *
+ * A contraction rate \f$\rho\f$ of the non-linear iterations above the maximum
+ * \f$\rho_{\max}\f$ predicts a failure of larger steps, and the multiplier is
+ * limited to \f$\rho_{\max}/\rho\f$.
+ *
+ * If a tolerance \f$\epsilon\f$ is given, the local truncation error estimate
+ * \f$e_n\f$ of the time discretization (see
+ * NumLib::TimeDiscretization::getRelativeLocalErrorEstimate()) additionally
+ * limits the multiplier to \f$0.9 \sqrt{\epsilon/e_n}\f$, and steps with
+ * \f$e_n > \epsilon\f$ are rejected.
+ *
+ * A step is repeated with the rejection multiplier if the non-linear solver
+ * fails. The step size is always bounded by the minimum and maximum allowed
+ * value.
+ */
+class CostBasedTimeStepping final : public TimeStepAlgorithm
+{
+public:
+    /**
+     * @param t_initial             start time
+     * @param t_end                 end time
+     * @param min_dt                the minimum allowed time step size
+     * @param max_dt                the maximum allowed time step size
+     * @param initial_dt            initial time step size
+     * @param max_multiplier
+     * \copydoc NumLib::CostBasedTimeStepping::_max_multiplier
+     * @param rejection_multiplier
+     * \copydoc NumLib::CostBasedTimeStepping::_rejection_multiplier
+     * @param max_contraction_rate
+     * \copydoc NumLib::CostBasedTimeStepping::_max_contraction_rate
+     * @param tol
+     * \copydoc NumLib::CostBasedTimeStepping::_tol
+     * @param fixed_output_times
+     * \copydoc NumLib::CostBasedTimeStepping::_fixed_output_times
+     */
+    CostBasedTimeStepping(double const t_initial,
+                          double const t_end,
+                          double const min_dt,
+                          double const max_dt,
+                          double const initial_dt,
+                          double const max_multiplier,
+                          double const rejection_multiplier,
+                          double const max_contraction_rate,
+                          double const tol,
+                          std::vector<double>&& fixed_output_times);
+
+    bool next(double solution_error, int number_iterations) override;
+
+    bool accepted() const override { return _accepted; }
+    void setAcceptedOrNot(bool accepted) override { _accepted = accepted; };
+
+    bool isSolutionErrorComputationNeeded() const override
+    {
+        return _tol > 0;
+    }
+
+    bool isLocalErrorEstimateNeeded() const override { return _tol > 0; }
+
+    void setCostOfLastStep(double const wall_clock_time,
+                           double const contraction_rate) override
+    {
+        _wall_clock_time = wall_clock_time;
+        _contraction_rate = contraction_rate;
+    }
+
+    bool canReduceTimestepSize() const override;
+
+    void addFixedOutputTimes(
+        std::vector<double> const& extra_fixed_output_times) override;
+
+    void writeCheckpoint(std::ostream& os) const override;
+
+    void readCheckpoint(std::istream& is) override;
+
+private:
+    /// Computes the multiplier of the size of an accepted step of the given
+    /// efficiency.
+    double computeMultiplier(double const efficiency,
+                             double const solution_error) const;
+
+    /// Bounds the step size by the allowed range, the end time and the fixed
+    /// output times.
+    double limitStepSize(double const dt) const;
+
+    /// The minimum allowed time step size.
+    double const _min_dt;
+    /// The maximum allowed time step size.
+    double const _max_dt;
+    /// Initial time step size.
+    double const _initial_dt;
+    /// The maximum multiplier of the step size after an accepted step.
+    double const _max_multiplier;
+    /// The multiplier of the step size of a step repeated because the
+    /// non-linear solver failed.
+    double const _rejection_multiplier;
+    /// The contraction rate of the non-linear iterations above which larger
+    /// steps are expected to fail.
+    double const _max_contraction_rate;
+    /// Tolerance of the relative local truncation error estimate. Zero
+    /// disables the error control.
+    double const _tol;
+    /// Timesteps to be taken independent of the time stepping scheme.
+    std::vector<double> _fixed_output_times;
+
+    /// Wall clock time of the last step.
+    double _wall_clock_time = 0;
+    /// Contraction rate of the non-linear iterations of the last step.
+    double _contraction_rate = 0;
+    /// Costs of the rejected steps since the last accepted step.
+    double _wasted_cost = 0;
+    /// Size and efficiency of the last accepted step.
+    double _previous_dt = 0;
+    double _previous_efficiency = std::numeric_limits<double>::quiet_NaN();
+    /// True, if the timestep is accepted.
+    bool _accepted = true;
+};
+
+}  // namespace NumLib
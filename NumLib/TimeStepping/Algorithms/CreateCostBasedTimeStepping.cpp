@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "CreateCostBasedTimeStepping.h"
+
+#include <string>
+
+#include "BaseLib/Algorithm.h"
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "CostBasedTimeStepping.h"
+#include "TimeStepAlgorithm.h"
+
+namespace NumLib
+{
+class TimeStepAlgorithm;
+std::unique_ptr<TimeStepAlgorithm> createCostBasedTimeStepping(
+    BaseLib::ConfigTree const& config)
+{
+    //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__type}
+    config.checkConfigParameter("type", "CostBasedTimeStepping");
+
+    //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__CostBasedTimeStepping__t_initial}
+    auto const t_initial = config.getConfigParameter<double>("t_initial");
+    //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__CostBasedTimeStepping__t_end}
+    auto const t_end = config.getConfigParameter<double>("t_end");
+    //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__CostBasedTimeStepping__initial_dt}
+    auto const initial_dt = config.getConfigParameter<double>("initial_dt");
+    //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__CostBasedTimeStepping__minimum_dt}
+    auto const minimum_dt = config.getConfigParameter<double>("minimum_dt");
+    //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__CostBasedTimeStepping__maximum_dt}
+    auto const maximum_dt = config.getConfigParameter<double>("maximum_dt");
+
+    auto const maximum_multiplier =
+        //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__CostBasedTimeStepping__maximum_multiplier}
+        config.getConfigParameter<double>("maximum_multiplier", 2.0);
+    auto const rejection_multiplier =
+        //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__CostBasedTimeStepping__rejection_multiplier}
+        config.getConfigParameter<double>("rejection_multiplier", 0.5);
+    auto const maximum_contraction_rate =
+        //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__CostBasedTimeStepping__maximum_contraction_rate}
+        config.getConfigParameter<double>("maximum_contraction_rate", 0.8);
+    auto const tol =
+        //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__CostBasedTimeStepping__tol}
+        config.getConfigParameter<double>("tol", 0.0);
+
+    auto fixed_output_times =
+        //! \ogs_file_param{prj__time_loop__processes__process__time_stepping__CostBasedTimeStepping__fixed_output_times}
+        config.getConfigParameter<std::vector<double>>("fixed_output_times",
+                                                       std::vector<double>{});
+
+    return std::make_unique<CostBasedTimeStepping>(
+        t_initial, t_end, minimum_dt, maximum_dt, initial_dt,
+        maximum_multiplier, rejection_multiplier, maximum_contraction_rate,
+        tol, std::move(fixed_output_times));
+}
+}  // namespace NumLib
@@ -0,0 +1,30 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <memory>
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace NumLib
+{
+class TimeStepAlgorithm;
+}
+
+namespace NumLib
+{
+/// Create a CostBasedTimeStepping time stepper from the given
+/// configuration.
+std::unique_ptr<TimeStepAlgorithm> createCostBasedTimeStepping(
+    BaseLib::ConfigTree const& config);
+}  // namespace NumLib
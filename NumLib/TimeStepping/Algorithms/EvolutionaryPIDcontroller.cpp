@@ -17,6 +17,7 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/Algorithm.h"
+#include "BaseLib/FileTools.h"
 
 namespace NumLib
 {
@@ -184,4 +185,20 @@ bool EvolutionaryPIDcontroller::canReduceTimestepSize() const
     // further.
     return !(_ts_current.dt() == _h_min && _ts_prev.dt() == _h_min);
 }
+
+void EvolutionaryPIDcontroller::writeCheckpoint(std::ostream& os) const
+{
+    TimeStepAlgorithm::writeCheckpoint(os);
+    BaseLib::writeValueBinary(os, _e_n_minus1);
+    BaseLib::writeValueBinary(os, _e_n_minus2);
+    BaseLib::writeValueBinary(os, _is_accepted);
+}
+
+void EvolutionaryPIDcontroller::readCheckpoint(std::istream& is)
+{
+    TimeStepAlgorithm::readCheckpoint(is);
+    _e_n_minus1 = BaseLib::readBinaryValue<double>(is);
+    _e_n_minus2 = BaseLib::readBinaryValue<double>(is);
+    _is_accepted = BaseLib::readBinaryValue<bool>(is);
+}
 }  // namespace NumLib
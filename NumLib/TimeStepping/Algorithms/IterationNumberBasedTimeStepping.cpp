@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "BaseLib/Algorithm.h"
+#include "BaseLib/FileTools.h"
 
 namespace NumLib
 {
@@ -157,4 +158,20 @@ bool IterationNumberBasedTimeStepping::canReduceTimestepSize() const
     return !(_ts_current.dt() == _min_dt && _ts_prev.dt() == _min_dt);
 }
 
+void IterationNumberBasedTimeStepping::writeCheckpoint(std::ostream& os) const
+{
+    TimeStepAlgorithm::writeCheckpoint(os);
+    BaseLib::writeValueBinary(os, _iter_times);
+    BaseLib::writeValueBinary(os, _n_rejected_steps);
+    BaseLib::writeValueBinary(os, _accepted);
+}
+
+void IterationNumberBasedTimeStepping::readCheckpoint(std::istream& is)
+{
+    TimeStepAlgorithm::readCheckpoint(is);
+    _iter_times = BaseLib::readBinaryValue<int>(is);
+    _n_rejected_steps = BaseLib::readBinaryValue<int>(is);
+    _accepted = BaseLib::readBinaryValue<bool>(is);
+}
+
 }  // namespace NumLib
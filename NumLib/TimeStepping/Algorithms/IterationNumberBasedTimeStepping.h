@@ -109,6 +109,10 @@ public:
 
     void addFixedOutputTimes(
         std::vector<double> const& extra_fixed_output_times) override;
+
+    void writeCheckpoint(std::ostream& os) const override;
+
+    void readCheckpoint(std::istream& is) override;
 private:
     /// Calculate the next time step size.
     double getNextTimeStepSize() const;
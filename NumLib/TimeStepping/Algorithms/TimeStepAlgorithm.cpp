@@ -11,8 +11,42 @@
 
 #include <algorithm>
 
+#include "BaseLib/FileTools.h"
+
 namespace NumLib
 {
+namespace
+{
+void writeTimeStep(std::ostream& os, TimeStep const& ts)
+{
+    BaseLib::writeValueBinary(os, ts.previous());
+    BaseLib::writeValueBinary(os, ts.current());
+    BaseLib::writeValueBinary(os, static_cast<std::uint64_t>(ts.steps()));
+}
+
+TimeStep readTimeStep(std::istream& is)
+{
+    auto const previous = BaseLib::readBinaryValue<double>(is);
+    auto const current = BaseLib::readBinaryValue<double>(is);
+    auto const steps = BaseLib::readBinaryValue<std::uint64_t>(is);
+    return TimeStep{previous, current, static_cast<std::size_t>(steps)};
+}
+}  // namespace
+
+void TimeStepAlgorithm::writeCheckpoint(std::ostream& os) const
+{
+    writeTimeStep(os, _ts_prev);
+    writeTimeStep(os, _ts_current);
+    BaseLib::writeVectorBinary(os, _dt_vector);
+}
+
+void TimeStepAlgorithm::readCheckpoint(std::istream& is)
+{
+    _ts_prev = readTimeStep(is);
+    _ts_current = readTimeStep(is);
+    BaseLib::readVectorBinary(is, _dt_vector);
+}
+
 double possiblyClampDtToNextFixedTime(
     double const t, double const dt,
     std::vector<double> const& fixed_output_times)
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <cmath>
+#include <iosfwd>
 #include <vector>
 
 #include "BaseLib/Error.h"
@@ -113,6 +114,22 @@ public:
     /// solution error. The default return value is false.
     virtual bool isSolutionErrorComputationNeeded() const { return false; }
 
+    /// Get a flag to indicate whether this algorithm needs the estimate of the
+    /// local truncation error of the time discretization as solution error
+    /// instead of the relative change of the solution. The default return
+    /// value is false.
+    virtual bool isLocalErrorEstimateNeeded() const { return false; }
+
+    /// Informs the algorithm about the cost of the last step before next() is
+    /// called.
+    /// \param wall_clock_time Wall clock time spent on the last step.
+    /// \param contraction_rate Contraction rate of the non-linear iterations
+    ///        of the last step, see NumLib::NonlinearSolverStatus.
+    virtual void setCostOfLastStep(double const /*wall_clock_time*/,
+                                   double const /*contraction_rate*/)
+    {
+    }
+
     /// Query the timestepper if further time step size reduction is possible.
     virtual bool canReduceTimestepSize() const { return false; }
 
@@ -126,6 +143,13 @@ public:
     {
     }
 
+    /// Writes the time stepping state in binary form for a restart from a
+    /// checkpoint. Derived classes having additional state extend this.
+    virtual void writeCheckpoint(std::ostream& os) const;
+
+    /// Restores the state written by writeCheckpoint().
+    virtual void readCheckpoint(std::istream& is);
+
 protected:
     /// initial time
     const double _t_initial;
@@ -17,6 +17,7 @@
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
 
+#include "NumLib/TimeStepping/Algorithms/CreateCostBasedTimeStepping.h"
 #include "NumLib/TimeStepping/Algorithms/CreateEvolutionaryPIDcontroller.h"
 #include "NumLib/TimeStepping/Algorithms/CreateFixedTimeStepping.h"
 #include "NumLib/TimeStepping/Algorithms/CreateIterationNumberBasedTimeStepping.h"
@@ -48,12 +49,17 @@ std::unique_ptr<TimeStepAlgorithm> createTimeStepper(
     {
         return NumLib::createIterationNumberBasedTimeStepping(config);
     }
+    if (type == "CostBasedTimeStepping")
+    {
+        return NumLib::createCostBasedTimeStepping(config);
+    }
     OGS_FATAL(
         "Unknown time stepping type: '%s'. The available types are: "
         "\n\tSingleStep,"
         "\n\tFixedTimeStepping,"
-        "\n\tEvolutionaryPIDcontroller,",
-        "\n\tIterationNumberBasedTimeStepping\n",
+        "\n\tEvolutionaryPIDcontroller,"
+        "\n\tIterationNumberBasedTimeStepping,"
+        "\n\tCostBasedTimeStepping\n",
         type.data());
 }
 
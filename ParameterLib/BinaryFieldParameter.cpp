@@ -0,0 +1,269 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BinaryFieldParameter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/FileTools.h"
+#include "BaseLib/MappedFile.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/NodePartitionedMesh.h"
+
+namespace
+{
+bool isLittleEndian()
+{
+    std::uint16_t const one = 1;
+    unsigned char first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+/// Returns the global ids of the mesh items if they differ from the ids of
+/// the mesh items, or an empty vector otherwise.
+std::vector<std::size_t> getGlobalIds(MeshLib::Mesh const& mesh,
+                                      MeshLib::MeshItemType const item_type)
+{
+    bool const is_cell = item_type == MeshLib::MeshItemType::Cell;
+    auto const bulk_ids_name = is_cell ? "bulk_element_ids" : "bulk_node_ids";
+    auto const num_items =
+        is_cell ? mesh.getNumberOfElements() : mesh.getNumberOfNodes();
+
+    auto const& properties = mesh.getProperties();
+    if (properties.existsPropertyVector<std::size_t>(bulk_ids_name))
+    {
+        auto const& bulk_ids =
+            *properties.getPropertyVector<std::size_t>(bulk_ids_name);
+        if (bulk_ids.size() != num_items)
+        {
+            OGS_FATAL(
+                "The size %d of the property '%s' of mesh '%s' differs from "
+                "the number %d of mesh items.",
+                bulk_ids.size(), bulk_ids_name, mesh.getName().c_str(),
+                num_items);
+        }
+        return {bulk_ids.begin(), bulk_ids.end()};
+    }
+
+    auto const* const partitioned_mesh =
+        dynamic_cast<MeshLib::NodePartitionedMesh const*>(&mesh);
+    if (partitioned_mesh == nullptr || partitioned_mesh->isForSingleThread())
+    {
+        return {};
+    }
+    if (is_cell)
+    {
+        OGS_FATAL(
+            "A BinaryField parameter for elements on the partitioned mesh '%s' "
+            "requires the property 'bulk_element_ids' with the global element "
+            "ids.",
+            mesh.getName().c_str());
+    }
+    std::vector<std::size_t> global_ids(num_items);
+    for (std::size_t i = 0; i < num_items; ++i)
+    {
+        global_ids[i] = partitioned_mesh->getGlobalNodeID(i);
+    }
+    return global_ids;
+}
+}  // namespace
+
+namespace ParameterLib
+{
+BinaryFieldParameter::BinaryFieldParameter(
+    std::string const& name_, MeshLib::Mesh const& mesh,
+    std::unique_ptr<BaseLib::MappedFile>&& file,
+    MeshLib::MeshItemType const item_type, int const num_components,
+    std::vector<std::size_t>&& global_ids)
+    : Parameter<double>(name_, &mesh),
+      _file(std::move(file)),
+      _item_type(item_type),
+      _num_components(num_components),
+      _global_ids(std::move(global_ids))
+{
+}
+
+BinaryFieldParameter::~BinaryFieldParameter() = default;
+
+void BinaryFieldParameter::readValues(std::size_t const id,
+                                      double* const values) const
+{
+    auto const global_id = _global_ids.empty() ? id : _global_ids[id];
+    std::memcpy(values,
+                _file->data() + global_id * _num_components * sizeof(double),
+                _num_components * sizeof(double));
+    if (!isLittleEndian())
+    {
+        std::transform(values, values + _num_components, values,
+                       [](double const v) { return BaseLib::swapEndianness(v); });
+    }
+}
+
+std::vector<double> BinaryFieldParameter::operator()(
+    double const /*t*/, SpatialPosition const& pos) const
+{
+    auto const id = _item_type == MeshLib::MeshItemType::Cell
+                        ? pos.getElementID()
+                        : pos.getNodeID();
+    if (!id)
+    {
+        OGS_FATAL(
+            "Trying to access a BinaryFieldParameter but the %s id is not "
+            "specified.",
+            _item_type == MeshLib::MeshItemType::Cell ? "element" : "node");
+    }
+    std::vector<double> cache(_num_components);
+    readValues(*id, cache.data());
+
+    if (!this->_coordinate_system)
+    {
+        return cache;
+    }
+
+    return this->rotateWithCoordinateSystem(cache, pos);
+}
+
+void BinaryFieldParameter::operator()(double const t,
+                                      SpatialPosition const& pos,
+                                      double* const values) const
+{
+    auto const id = _item_type == MeshLib::MeshItemType::Cell
+                        ? pos.getElementID()
+                        : pos.getNodeID();
+    if (this->_coordinate_system || !id)
+    {
+        Parameter<double>::operator()(t, pos, values);
+        return;
+    }
+    readValues(*id, values);
+}
+
+Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>
+BinaryFieldParameter::getNodalValuesOnElement(MeshLib::Element const& element,
+                                              double const t) const
+{
+    auto const n_nodes = element.getNumberOfNodes();
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> result(
+        n_nodes, _num_components);
+
+    SpatialPosition x_position;
+    if (_item_type == MeshLib::MeshItemType::Cell)
+    {
+        // Column vector of values, copied for each node.
+        x_position.setElementID(element.getID());
+        auto const& values = this->operator()(t, x_position);
+        auto const row_values =
+            Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1> const>(
+                values.data(), values.size());
+        for (unsigned i = 0; i < n_nodes; ++i)
+        {
+            result.row(i) = row_values;
+        }
+        return result;
+    }
+
+    auto const nodes = element.getNodes();
+    for (unsigned i = 0; i < n_nodes; ++i)
+    {
+        x_position.setNodeID(nodes[i]->getID());
+        auto const& values = this->operator()(t, x_position);
+        result.row(i) =
+            Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1> const>(
+                values.data(), values.size());
+    }
+    return result;
+}
+
+std::unique_ptr<ParameterBase> createBinaryFieldParameter(
+    std::string const& name, BaseLib::ConfigTree const& config,
+    MeshLib::Mesh const& mesh)
+{
+    //! \ogs_file_param{prj__parameters__parameter__type}
+    config.checkConfigParameter("type", "BinaryField");
+    auto const file_name =
+        //! \ogs_file_param{prj__parameters__parameter__BinaryField__file}
+        config.getConfigParameter<std::string>("file");
+    auto const item_type_name =
+        //! \ogs_file_param{prj__parameters__parameter__BinaryField__mesh_item_type}
+        config.getConfigParameter<std::string>("mesh_item_type", "Cell");
+    auto const num_components =
+        //! \ogs_file_param{prj__parameters__parameter__BinaryField__number_of_components}
+        config.getConfigParameter<int>("number_of_components", 1);
+
+    MeshLib::MeshItemType item_type;
+    if (item_type_name == "Cell")
+    {
+        item_type = MeshLib::MeshItemType::Cell;
+    }
+    else if (item_type_name == "Node")
+    {
+        item_type = MeshLib::MeshItemType::Node;
+    }
+    else
+    {
+        OGS_FATAL(
+            "Unknown mesh item type '%s' of the BinaryField parameter '%s'. "
+            "Possible values are 'Cell' and 'Node'.",
+            item_type_name.c_str(), name.c_str());
+    }
+    if (num_components < 1)
+    {
+        OGS_FATAL(
+            "The number of components of the BinaryField parameter '%s' must "
+            "be positive, got %d.",
+            name.c_str(), num_components);
+    }
+
+    auto const path =
+        BaseLib::joinPaths(BaseLib::getProjectDirectory(), file_name);
+    auto file = std::make_unique<BaseLib::MappedFile>(path);
+    if (file->data() == nullptr)
+    {
+        OGS_FATAL("Could not map the file '%s' of the BinaryField parameter.",
+                  path.c_str());
+    }
+    auto const item_size = num_components * sizeof(double);
+    if (file->size() % item_size != 0)
+    {
+        OGS_FATAL(
+            "The size %d bytes of the file '%s' is not a multiple of the size "
+            "of %d doubles.",
+            file->size(), path.c_str(), num_components);
+    }
+    auto const num_file_items = file->size() / item_size;
+
+    auto global_ids = getGlobalIds(mesh, item_type);
+    auto const num_items = item_type == MeshLib::MeshItemType::Cell
+                               ? mesh.getNumberOfElements()
+                               : mesh.getNumberOfNodes();
+    auto const max_id =
+        global_ids.empty()
+            ? num_items
+            : *std::max_element(global_ids.begin(), global_ids.end()) + 1;
+    if (max_id > num_file_items)
+    {
+        OGS_FATAL(
+            "The file '%s' contains the values of %d mesh items, but the "
+            "values of %d mesh items are required.",
+            path.c_str(), num_file_items, max_id);
+    }
+    DBUG("Mapped the values of %d mesh items from the file '%s'.",
+         num_file_items, path.c_str());
+
+    return std::make_unique<BinaryFieldParameter>(
+        name, mesh, std::move(file), item_type, num_components,
+        std::move(global_ids));
+}
+
+}  // namespace ParameterLib
@@ -0,0 +1,75 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include "MeshLib/Location.h"
+
+#include "Parameter.h"
+
+namespace BaseLib
+{
+class MappedFile;
+}  // namespace BaseLib
+
+namespace ParameterLib
+{
+/// A parameter represented by a raw binary file of little-endian doubles with
+/// the values of all components of each mesh element or node, ordered by the
+/// element or node id.
+///
+/// The file is mapped into memory instead of being read, so only the pages
+/// holding values of the used mesh items are loaded. The values are looked up
+/// by the global ids of the mesh items, i.e. by the \c bulk_element_ids or
+/// \c bulk_node_ids property if present, by the global node ids of a
+/// partitioned mesh, or by the mesh item ids otherwise. Hence one file of the
+/// whole domain serves all partitions and subdomain meshes.
+struct BinaryFieldParameter final : public Parameter<double>
+{
+    /// \param global_ids the global id of each mesh item, or empty if the ids
+    /// of the mesh items are used.
+    BinaryFieldParameter(std::string const& name_,
+                         MeshLib::Mesh const& mesh,
+                         std::unique_ptr<BaseLib::MappedFile>&& file,
+                         MeshLib::MeshItemType const item_type,
+                         int const num_components,
+                         std::vector<std::size_t>&& global_ids);
+
+    ~BinaryFieldParameter() override;
+
+    bool isTimeDependent() const override { return false; }
+
+    int getNumberOfComponents() const override { return _num_components; }
+
+    std::vector<double> operator()(double const t,
+                                   SpatialPosition const& pos) const override;
+
+    void operator()(double const t, SpatialPosition const& pos,
+                    double* const values) const override;
+
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>
+    getNodalValuesOnElement(MeshLib::Element const& element,
+                            double const t) const override;
+
+private:
+    /// Copies the values of the mesh item with the given local id.
+    void readValues(std::size_t const id, double* const values) const;
+
+    std::unique_ptr<BaseLib::MappedFile> const _file;
+    MeshLib::MeshItemType const _item_type;
+    int const _num_components;
+    std::vector<std::size_t> const _global_ids;
+};
+
+std::unique_ptr<ParameterBase> createBinaryFieldParameter(
+    std::string const& name, BaseLib::ConfigTree const& config,
+    MeshLib::Mesh const& mesh);
+
+}  // namespace ParameterLib
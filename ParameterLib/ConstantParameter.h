@@ -50,6 +50,17 @@ struct ConstantParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(_values, pos);
     }
 
+    void operator()(double const t, SpatialPosition const& pos,
+                    T* const values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::operator()(t, pos, values);
+            return;
+        }
+        std::copy(_values.begin(), _values.end(), values);
+    }
+
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
         MeshLib::Element const& element, double const /*t*/) const override
     {
@@ -31,6 +31,17 @@ struct CurveScaledParameter final : public Parameter<T>
     }
 
     bool isTimeDependent() const override { return true; }
+
+    boost::optional<double> getTimeFactor(double const t) const override
+    {
+        auto const factor = _parameter->getTimeFactor(t);
+        if (!factor)
+        {
+            return boost::none;
+        }
+        return _curve.getValue(t) * *factor;
+    }
+
     void initialize(
         std::vector<std::unique_ptr<ParameterBase>> const& parameters) override
     {
@@ -44,6 +55,8 @@ struct CurveScaledParameter final : public Parameter<T>
         return _parameter->getNumberOfComponents();
     }
 
+    using Parameter<T>::operator();
+
     std::vector<T> operator()(double const t,
                               SpatialPosition const& pos) const override
     {
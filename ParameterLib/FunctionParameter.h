@@ -10,9 +10,15 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <exprtk.hpp>
 
 #include "MeshLib/Elements/Element.h"
@@ -28,6 +34,11 @@ namespace ParameterLib
 ///
 /// Currently, x, y, and z are supported as variables
 /// of the functions.
+///
+/// exprtk stores the values of the variables in the symbol table. Therefore
+/// each OpenMP thread evaluates its own copy of the symbol table and of the
+/// compiled expressions, which makes the parameter usable from the parallel
+/// assembly.
 template <typename T>
 struct FunctionParameter final : public Parameter<T>
 {
@@ -49,21 +60,16 @@ struct FunctionParameter final : public Parameter<T>
                       std::vector<std::string> const& vec_expression_str)
         : Parameter<T>(name, &mesh), _vec_expression_str(vec_expression_str)
     {
-        _symbol_table.add_constants();
-        _symbol_table.create_variable("x");
-        _symbol_table.create_variable("y");
-        _symbol_table.create_variable("z");
-
-        _vec_expression.resize(_vec_expression_str.size());
-        for (unsigned i = 0; i < _vec_expression_str.size(); i++)
+#ifdef _OPENMP
+        int const number_of_threads = omp_get_max_threads();
+#else
+        int const number_of_threads = 1;
+#endif
+        _evaluators.reserve(number_of_threads);
+        for (int i = 0; i < number_of_threads; i++)
         {
-            _vec_expression[i].register_symbol_table(_symbol_table);
-            parser_t parser;
-            if (!parser.compile(_vec_expression_str[i], _vec_expression[i]))
-            {
-                OGS_FATAL("Error: %s\tExpression: %s\n", parser.error().c_str(),
-                          _vec_expression_str[i].c_str());
-            }
+            _evaluators.push_back(
+                std::make_unique<Evaluator>(_vec_expression_str));
         }
     }
 
@@ -71,49 +77,161 @@ struct FunctionParameter final : public Parameter<T>
 
     int getNumberOfComponents() const override
     {
-        return _vec_expression.size();
+        return _vec_expression_str.size();
     }
 
+    using Parameter<T>::operator();
+
     std::vector<T> operator()(double const /*t*/,
                               SpatialPosition const& pos) const override
     {
         std::vector<T> cache(getNumberOfComponents());
-        auto& x = _symbol_table.get_variable("x")->ref();
-        auto& y = _symbol_table.get_variable("y")->ref();
-        auto& z = _symbol_table.get_variable("z")->ref();
-        if (pos.getCoordinates())
+        evaluate(pos, cache.data());
+
+        if (!this->_coordinate_system)
         {
-            auto const coords = pos.getCoordinates().get();
-            x = coords[0];
-            y = coords[1];
-            z = coords[2];
+            return cache;
         }
-        else if (pos.getNodeID())
+
+        return this->rotateWithCoordinateSystem(cache, pos);
+    }
+
+    void operator()(double const t, SpatialPosition const& pos,
+                    T* const values) const override
+    {
+        if (this->_coordinate_system)
         {
-            auto const& node =
-                *ParameterBase::_mesh->getNode(pos.getNodeID().get());
-            x = node[0];
-            y = node[1];
-            z = node[2];
+            Parameter<T>::operator()(t, pos, values);
+            return;
         }
+        evaluate(pos, values);
+    }
 
-        for (unsigned i = 0; i < _vec_expression.size(); i++)
+    /// Evaluates the expressions at all given points. The values of the
+    /// components of the i-th point are written to
+    /// \c values[i * getNumberOfComponents() ...], i.e. \c values must hold
+    /// coordinates.size() * getNumberOfComponents() entries.
+    ///
+    /// The batch evaluation looks up the calling thread's symbol table only
+    /// once. The coordinate system of the parameter is not applied.
+    void evaluate(std::vector<std::array<double, 3>> const& coordinates,
+                  T* const values) const
+    {
+        auto& evaluator = getEvaluator();
+        auto const n_components = evaluator.expressions.size();
+        for (std::size_t p = 0; p < coordinates.size(); p++)
         {
-            cache[i] = _vec_expression[i].value();
+            *evaluator.x = coordinates[p][0];
+            *evaluator.y = coordinates[p][1];
+            *evaluator.z = coordinates[p][2];
+            for (std::size_t i = 0; i < n_components; i++)
+            {
+                values[p * n_components + i] = evaluator.expressions[i].value();
+            }
         }
+    }
 
-        if (!this->_coordinate_system)
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
+        MeshLib::Element const& element, double const t) const override
+    {
+        if (this->_coordinate_system)
         {
-            return cache;
+            return Parameter<T>::getNodalValuesOnElement(element, t);
         }
 
-        return this->rotateWithCoordinateSystem(cache, pos);
+        auto const n_nodes = element.getNumberOfNodes();
+        std::vector<std::array<double, 3>> coordinates(n_nodes);
+        for (unsigned i = 0; i < n_nodes; ++i)
+        {
+            auto const& node = *element.getNode(i);
+            coordinates[i] = {node[0], node[1], node[2]};
+        }
+
+        // Row major storage matches the layout of the batch evaluation.
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+            result(n_nodes, getNumberOfComponents());
+        evaluate(coordinates, result.data());
+        return result;
     }
 
 private:
+    struct Evaluator
+    {
+        explicit Evaluator(std::vector<std::string> const& vec_expression_str)
+        {
+            symbol_table.add_constants();
+            symbol_table.create_variable("x");
+            symbol_table.create_variable("y");
+            symbol_table.create_variable("z");
+            x = &symbol_table.get_variable("x")->ref();
+            y = &symbol_table.get_variable("y")->ref();
+            z = &symbol_table.get_variable("z")->ref();
+
+            expressions.resize(vec_expression_str.size());
+            for (unsigned i = 0; i < vec_expression_str.size(); i++)
+            {
+                expressions[i].register_symbol_table(symbol_table);
+                parser_t parser;
+                if (!parser.compile(vec_expression_str[i], expressions[i]))
+                {
+                    OGS_FATAL("Error: %s\tExpression: %s\n",
+                              parser.error().c_str(),
+                              vec_expression_str[i].c_str());
+                }
+            }
+        }
+
+        symbol_table_t symbol_table;
+        std::vector<expression_t> expressions;
+        T* x = nullptr;
+        T* y = nullptr;
+        T* z = nullptr;
+    };
+
+    Evaluator& getEvaluator() const
+    {
+#ifdef _OPENMP
+        auto const thread = static_cast<std::size_t>(omp_get_thread_num());
+#else
+        std::size_t const thread = 0;
+#endif
+        if (thread >= _evaluators.size())
+        {
+            OGS_FATAL(
+                "FunctionParameter '%s' was created for %d threads but is "
+                "evaluated in thread %d.",
+                this->name.c_str(), _evaluators.size(), thread);
+        }
+        return *_evaluators[thread];
+    }
+
+    void evaluate(SpatialPosition const& pos, T* const values) const
+    {
+        auto& evaluator = getEvaluator();
+        if (pos.getCoordinates())
+        {
+            auto const coords = pos.getCoordinates().get();
+            *evaluator.x = coords[0];
+            *evaluator.y = coords[1];
+            *evaluator.z = coords[2];
+        }
+        else if (pos.getNodeID())
+        {
+            auto const& node =
+                *ParameterBase::_mesh->getNode(pos.getNodeID().get());
+            *evaluator.x = node[0];
+            *evaluator.y = node[1];
+            *evaluator.z = node[2];
+        }
+
+        for (std::size_t i = 0; i < evaluator.expressions.size(); i++)
+        {
+            values[i] = evaluator.expressions[i].value();
+        }
+    }
+
     std::vector<std::string> const _vec_expression_str;
-    symbol_table_t _symbol_table;
-    std::vector<expression_t> _vec_expression;
+    std::vector<std::unique_ptr<Evaluator>> _evaluators;
 };
 
 std::unique_ptr<ParameterBase> createFunctionParameter(
@@ -78,6 +78,26 @@ struct GroupBasedParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(values, pos);
     }
 
+    void operator()(double const t, SpatialPosition const& pos,
+                    T* const values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::operator()(t, pos, values);
+            return;
+        }
+
+        auto const item_id = getMeshItemID(pos, type<MeshItemType>());
+        assert(item_id);
+        int const index = _property_index[item_id.get()];
+        auto const& group_values = _vec_values[index];
+        if (group_values.empty())
+        {
+            OGS_FATAL("No data found for the group index %d", index);
+        }
+        std::copy(group_values.begin(), group_values.end(), values);
+    }
+
 private:
     template <MeshLib::MeshItemType ITEM_TYPE>
     struct type
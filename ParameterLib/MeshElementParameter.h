@@ -63,6 +63,29 @@ struct MeshElementParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(cache, pos);
     }
 
+    void operator()(double const t, SpatialPosition const& pos,
+                    T* const values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::operator()(t, pos, values);
+            return;
+        }
+
+        auto const e = pos.getElementID();
+        if (!e)
+        {
+            OGS_FATAL(
+                "Trying to access a MeshElementParameter but the element id is "
+                "not specified.");
+        }
+        auto const num_comp = _property.getNumberOfComponents();
+        for (int c = 0; c < num_comp; ++c)
+        {
+            values[c] = _property.getComponent(*e, c);
+        }
+    }
+
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
         MeshLib::Element const& element, double const t) const override
     {
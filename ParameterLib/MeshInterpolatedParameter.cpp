@@ -0,0 +1,219 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MeshInterpolatedParameter.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "BaseLib/Algorithm.h"
+#include "BaseLib/ConfigTree.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshSearch/MeshElementGrid.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Fem/ShapeFunctionValuesAtPoint.h"
+
+namespace
+{
+double searchTolerance(MeshLib::MeshElementGrid const& grid)
+{
+    auto const& min = grid.getMinPoint();
+    auto const& max = grid.getMaxPoint();
+    return 1e-10 *
+           std::max({max[0] - min[0], max[1] - min[1], max[2] - min[2]});
+}
+}  // namespace
+
+namespace ParameterLib
+{
+MeshInterpolatedParameter::MeshInterpolatedParameter(
+    std::string const& name_, MeshLib::Mesh const& mesh,
+    MeshLib::Mesh const& source_mesh,
+    MeshLib::PropertyVector<double> const& property)
+    : Parameter<double>(name_, &mesh),
+      _source_mesh(source_mesh),
+      _property(property),
+      _grid(std::make_unique<MeshLib::MeshElementGrid>(source_mesh)),
+      _eps(searchTolerance(*_grid))
+{
+    auto const num_comp = getNumberOfComponents();
+    auto const& nodes = mesh.getNodes();
+    _nodal_values.resize(nodes.size() * num_comp);
+
+    // The first node outside of the source mesh, if any.
+    auto outside_node_id = std::numeric_limits<long>::max();
+    auto const n_signed = static_cast<long>(nodes.size());
+#pragma omp parallel for schedule(dynamic, 1024) \
+    reduction(min : outside_node_id)
+    for (long i = 0; i < n_signed; ++i)
+    {
+        if (!interpolate(*nodes[i], &_nodal_values[i * num_comp]))
+        {
+            outside_node_id = std::min(outside_node_id, i);
+        }
+    }
+    if (outside_node_id != std::numeric_limits<long>::max())
+    {
+        auto const& p = *nodes[outside_node_id];
+        OGS_FATAL(
+            "The node %d at (%g, %g, %g) of mesh '%s' is not inside the "
+            "source mesh '%s' of the parameter '%s'.",
+            outside_node_id, p[0], p[1], p[2], mesh.getName().c_str(),
+            source_mesh.getName().c_str(), name.c_str());
+    }
+}
+
+MeshInterpolatedParameter::~MeshInterpolatedParameter() = default;
+
+int MeshInterpolatedParameter::getNumberOfComponents() const
+{
+    return _property.getNumberOfComponents();
+}
+
+bool MeshInterpolatedParameter::interpolate(MathLib::Point3d const& p,
+                                            double* const values) const
+{
+    MathLib::Point3d const p_min{{p[0] - _eps, p[1] - _eps, p[2] - _eps}};
+    MathLib::Point3d const p_max{{p[0] + _eps, p[1] + _eps, p[2] + _eps}};
+    auto const candidates = _grid->getElementsInVolume(p_min, p_max);
+    auto const element =
+        std::find_if(candidates.begin(), candidates.end(),
+                     [&](auto const* e) { return e->isPntInElement(p, _eps); });
+    if (element == candidates.end())
+    {
+        return false;
+    }
+
+    auto const num_comp = getNumberOfComponents();
+    if (_property.getMeshItemType() == MeshLib::MeshItemType::Cell)
+    {
+        for (int c = 0; c < num_comp; ++c)
+        {
+            values[c] = _property.getComponent((*element)->getID(), c);
+        }
+        return true;
+    }
+
+    auto const N = NumLib::shapeFunctionValuesAtPoint(**element, p).first;
+    std::fill_n(values, num_comp, 0.0);
+    for (std::size_t i = 0; i < N.size(); ++i)
+    {
+        auto const node_id = (*element)->getNodeIndex(i);
+        for (int c = 0; c < num_comp; ++c)
+        {
+            values[c] += N[i] * _property.getComponent(node_id, c);
+        }
+    }
+    return true;
+}
+
+std::vector<double> MeshInterpolatedParameter::operator()(
+    double const /*t*/, SpatialPosition const& pos) const
+{
+    auto const num_comp = getNumberOfComponents();
+    std::vector<double> cache(num_comp);
+    if (auto const n = pos.getNodeID())
+    {
+        std::copy_n(&_nodal_values[*n * num_comp], num_comp, cache.begin());
+    }
+    else if (auto const& x = pos.getCoordinates())
+    {
+        if (!interpolate(*x, cache.data()))
+        {
+            OGS_FATAL(
+                "The point (%g, %g, %g) is not inside the source mesh '%s' of "
+                "the parameter '%s'.",
+                (*x)[0], (*x)[1], (*x)[2], _source_mesh.getName().c_str(),
+                name.c_str());
+        }
+    }
+    else
+    {
+        OGS_FATAL(
+            "Trying to access a MeshInterpolatedParameter but neither the "
+            "node id nor the coordinates are specified.");
+    }
+
+    if (!this->_coordinate_system)
+    {
+        return cache;
+    }
+
+    return this->rotateWithCoordinateSystem(cache, pos);
+}
+
+Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>
+MeshInterpolatedParameter::getNodalValuesOnElement(
+    MeshLib::Element const& element, double const t) const
+{
+    auto const n_nodes = element.getNumberOfNodes();
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> result(
+        n_nodes, getNumberOfComponents());
+
+    SpatialPosition x_position;
+    auto const nodes = element.getNodes();
+    for (unsigned i = 0; i < n_nodes; ++i)
+    {
+        x_position.setNodeID(nodes[i]->getID());
+        auto const& values = this->operator()(t, x_position);
+        result.row(i) =
+            Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1> const>(
+                values.data(), values.size());
+    }
+    return result;
+}
+
+std::unique_ptr<ParameterBase> createMeshInterpolatedParameter(
+    std::string const& name, BaseLib::ConfigTree const& config,
+    MeshLib::Mesh const& mesh,
+    std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes)
+{
+    //! \ogs_file_param{prj__parameters__parameter__type}
+    config.checkConfigParameter("type", "MeshInterpolated");
+    auto const source_mesh_name =
+        //! \ogs_file_param{prj__parameters__parameter__MeshInterpolated__source_mesh}
+        config.getConfigParameter<std::string>("source_mesh");
+    auto const field_name =
+        //! \ogs_file_param{prj__parameters__parameter__MeshInterpolated__field_name}
+        config.getConfigParameter<std::string>("field_name");
+    DBUG("Interpolating field_name %s of mesh %s", field_name.c_str(),
+         source_mesh_name.c_str());
+
+#ifdef USE_PETSC
+    OGS_FATAL(
+        "The MeshInterpolated parameter '%s' is not supported in parallel "
+        "runs.",
+        name.c_str());
+#endif
+
+    auto const& source_mesh = *BaseLib::findElementOrError(
+        begin(meshes), end(meshes),
+        [&source_mesh_name](auto const& m) {
+            return m->getName() == source_mesh_name;
+        },
+        "Expected to find a mesh named " + source_mesh_name + ".");
+
+    auto const& property =
+        source_mesh.getProperties().getPropertyVector<double>(field_name);
+    if (property->getMeshItemType() != MeshLib::MeshItemType::Node &&
+        property->getMeshItemType() != MeshLib::MeshItemType::Cell)
+    {
+        OGS_FATAL(
+            "The mesh property `%s' of the source mesh '%s' is neither a nodal "
+            "nor a cell property.",
+            field_name.c_str(), source_mesh_name.c_str());
+    }
+
+    return std::make_unique<MeshInterpolatedParameter>(name, mesh,
+                                                       source_mesh, *property);
+}
+
+}  // namespace ParameterLib
@@ -0,0 +1,77 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include "Parameter.h"
+
+namespace MeshLib
+{
+class MeshElementGrid;
+template <typename T>
+class PropertyVector;
+}  // namespace MeshLib
+
+namespace ParameterLib
+{
+/// A parameter interpolating a field of another mesh, the source mesh, at the
+/// positions of the parameter's mesh. The source mesh is typically the result
+/// of a simulation on a coarser mesh, e.g. a steady state or spin-up, whose
+/// solution becomes the initial condition of the simulation on the finer
+/// mesh.
+///
+/// The source element containing the position is searched. A nodal field is
+/// interpolated with the shape functions of that element, a cell field takes
+/// the value of that element. The values at the nodes of the parameter's mesh
+/// are interpolated once on construction. Other positions, e.g. integration
+/// points for an initial stress, are interpolated when the parameter is
+/// evaluated, which requires the coordinates of the position.
+struct MeshInterpolatedParameter final : public Parameter<double>
+{
+    MeshInterpolatedParameter(std::string const& name_,
+                              MeshLib::Mesh const& mesh,
+                              MeshLib::Mesh const& source_mesh,
+                              MeshLib::PropertyVector<double> const& property);
+
+    ~MeshInterpolatedParameter() override;
+
+    bool isTimeDependent() const override { return false; }
+
+    int getNumberOfComponents() const override;
+
+    using Parameter<double>::operator();
+
+    std::vector<double> operator()(double const t,
+                                   SpatialPosition const& pos) const override;
+
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>
+    getNodalValuesOnElement(MeshLib::Element const& element,
+                            double const t) const override;
+
+private:
+    /// Interpolates the field at the point \c p into \c values. Returns false
+    /// if the point is not inside the source mesh.
+    bool interpolate(MathLib::Point3d const& p, double* const values) const;
+
+    MeshLib::Mesh const& _source_mesh;
+    MeshLib::PropertyVector<double> const& _property;
+    std::unique_ptr<MeshLib::MeshElementGrid> const _grid;
+    /// Tolerance of the search for the containing source element.
+    double const _eps;
+    /// The interpolated values at the nodes of the parameter's mesh.
+    std::vector<double> _nodal_values;
+};
+
+std::unique_ptr<ParameterBase> createMeshInterpolatedParameter(
+    std::string const& name, BaseLib::ConfigTree const& config,
+    MeshLib::Mesh const& mesh,
+    std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes);
+
+}  // namespace ParameterLib
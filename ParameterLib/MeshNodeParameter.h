@@ -42,6 +42,8 @@ struct MeshNodeParameter final : public Parameter<T>
         return _property.getNumberOfComponents();
     }
 
+    using Parameter<T>::operator();
+
     std::vector<T> operator()(double const /*t*/,
                               SpatialPosition const& pos) const override
     {
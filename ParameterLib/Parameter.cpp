@@ -12,11 +12,13 @@
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
 
+#include "BinaryFieldParameter.h"
 #include "ConstantParameter.h"
 #include "CurveScaledParameter.h"
 #include "FunctionParameter.h"
 #include "GroupBasedParameter.h"
 #include "MeshElementParameter.h"
+#include "MeshInterpolatedParameter.h"
 #include "MeshNodeParameter.h"
 #include "TimeDependentHeterogeneousParameter.h"
 
@@ -46,6 +48,11 @@ std::unique_ptr<ParameterBase> createParameter(
         "Expected to find a mesh named " + mesh_name + ".");
 
     // Create parameter based on the provided type.
+    if (type == "BinaryField")
+    {
+        INFO("BinaryFieldParameter: %s", name.c_str());
+        return createBinaryFieldParameter(name, config, mesh);
+    }
     if (type == "Constant")
     {
         INFO("ConstantParameter: %s", name.c_str());
@@ -71,6 +78,11 @@ std::unique_ptr<ParameterBase> createParameter(
         INFO("MeshElementParameter: %s", name.c_str());
         return createMeshElementParameter(name, config, mesh);
     }
+    if (type == "MeshInterpolated")
+    {
+        INFO("MeshInterpolatedParameter: %s", name.c_str());
+        return createMeshInterpolatedParameter(name, config, mesh, meshes);
+    }
     if (type == "MeshNode")
     {
         INFO("MeshNodeParameter: %s", name.c_str());
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <utility>
@@ -57,6 +58,19 @@ struct ParameterBase
 
     virtual bool isTimeDependent() const = 0;
 
+    /// Returns the factor \f$ f(t) \f$ if the values of the parameter are
+    /// the product of \f$ f(t) \f$ and values independent of time, and
+    /// nothing otherwise. For parameters which are not time-dependent the
+    /// factor is one.
+    virtual boost::optional<double> getTimeFactor(double const /*t*/) const
+    {
+        if (isTimeDependent())
+        {
+            return boost::none;
+        }
+        return 1.0;
+    }
+
     void setCoordinateSystem(CoordinateSystem const& coordinate_system)
     {
         _coordinate_system = coordinate_system;
@@ -71,6 +85,8 @@ struct ParameterBase
 
     MeshLib::Mesh const* mesh() const { return _mesh; }
 
+    bool hasCoordinateSystem() const { return !!_coordinate_system; }
+
     std::string const name;
 
 protected:
@@ -152,6 +168,18 @@ struct Parameter : public ParameterBase
     virtual std::vector<T> operator()(double const t,
                                       SpatialPosition const& pos) const = 0;
 
+    //! Writes the parameter value at the given time and position into the
+    //! array \c values, which must hold getNumberOfComponents() entries.
+    //!
+    //! The default implementation copies the result of the above operator;
+    //! the derived classes may provide implementations not allocating memory.
+    virtual void operator()(double const t, SpatialPosition const& pos,
+                            T* const values) const
+    {
+        auto const result = this->operator()(t, pos);
+        std::copy(result.begin(), result.end(), values);
+    }
+
     //! Returns a matrix of values for all nodes of the given element.
     //
     // The matrix is of the shape NxC, where N is the number of nodes and C is
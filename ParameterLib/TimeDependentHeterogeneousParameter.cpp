@@ -12,6 +12,9 @@
 
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
+#include "MeshElementParameter.h"
+#include "MeshLib/Mesh.h"
+#include "MeshNodeParameter.h"
 #include "Utils.h"
 
 namespace ParameterLib
@@ -37,12 +40,142 @@ bool TimeDependentHeterogeneousParameter::isTimeDependent() const
 
 std::vector<double> TimeDependentHeterogeneousParameter::operator()(
     double const t, SpatialPosition const& pos) const
+{
+    std::vector<double> values(getNumberOfComponents());
+    (*this)(t, pos, values.data());
+    return values;
+}
+
+void TimeDependentHeterogeneousParameter::operator()(
+    double const t, SpatialPosition const& pos, double* const values) const
 {
     // No local coordinate transformation here, which might happen twice
     // otherwise.
     assert(!this->_coordinate_system ||
            "Coordinate system not expected to be set for curve scaled "
            "parameters.");
+
+    if (auto const* const field = getField(t))
+    {
+        auto const id = _field_type == FieldType::Node ? pos.getNodeID()
+                                                       : pos.getElementID();
+        auto const n = getNumberOfComponents();
+        if (id && (*id + 1) * n <= field->values.size())
+        {
+            std::copy_n(field->values.data() + *id * n, n, values);
+            return;
+        }
+    }
+
+    auto const result = interpolate(t, pos);
+    std::copy(result.begin(), result.end(), values);
+}
+
+auto TimeDependentHeterogeneousParameter::getField(double const t) const
+    -> Field const*
+{
+    if (_field_type == FieldType::None)
+    {
+        return nullptr;
+    }
+    for (auto const& f : _fields)
+    {
+        auto const* const field = f.load(std::memory_order_acquire);
+        if (field && field->t == t)
+        {
+            return field;
+        }
+    }
+
+    std::lock_guard<std::mutex> const lock(_field_mutex);
+    if (_field_type == FieldType::Unknown)
+    {
+        _field_type = computeFieldType();
+    }
+    if (_field_type == FieldType::None)
+    {
+        return nullptr;
+    }
+    // Another thread might have computed the field meanwhile.
+    for (auto const& f : _fields)
+    {
+        auto const* const field = f.load(std::memory_order_acquire);
+        if (field && field->t == t)
+        {
+            return field;
+        }
+    }
+
+    auto const& mesh = *_time_parameter_mapping[0].second->mesh();
+    auto const n_items = _field_type == FieldType::Node
+                             ? mesh.getNumberOfNodes()
+                             : mesh.getNumberOfElements();
+    auto const n = getNumberOfComponents();
+
+    auto field = std::make_unique<Field>();
+    field->t = t;
+    field->values.resize(n_items * n);
+    SpatialPosition pos;
+    for (std::size_t i = 0; i < n_items; ++i)
+    {
+        if (_field_type == FieldType::Node)
+        {
+            pos.setNodeID(i);
+        }
+        else
+        {
+            pos.setElementID(i);
+        }
+        auto const values = interpolate(t, pos);
+        std::copy(values.begin(), values.end(), field->values.data() + i * n);
+    }
+
+    auto const k = _next_field;
+    _next_field = 1 - _next_field;
+    _fields[k].store(field.get(), std::memory_order_release);
+    _owned_fields[k] = std::move(field);
+    return _fields[k].load(std::memory_order_relaxed);
+}
+
+auto TimeDependentHeterogeneousParameter::computeFieldType() const -> FieldType
+{
+    auto const* const mesh = _time_parameter_mapping[0].second->mesh();
+    auto const all_of = [&](auto const& is_type) {
+        return std::all_of(_time_parameter_mapping.begin(),
+                           _time_parameter_mapping.end(),
+                           [&](PairTimeParameter const& p) {
+                               return is_type(p.second) &&
+                                      p.second->mesh() == mesh &&
+                                      !p.second->hasCoordinateSystem();
+                           });
+    };
+
+    if (mesh == nullptr)
+    {
+        return FieldType::None;
+    }
+    if (all_of([](Parameter<double> const* p) {
+            return dynamic_cast<MeshNodeParameter<double> const*>(p) !=
+                   nullptr;
+        }))
+    {
+        DBUG("Caching the node values of parameter '%s'.", name.c_str());
+        return FieldType::Node;
+    }
+    if (all_of([](Parameter<double> const* p) {
+            return dynamic_cast<MeshElementParameter<double> const*>(p) !=
+                   nullptr;
+        }))
+    {
+        DBUG("Caching the element values of parameter '%s'.", name.c_str());
+        return FieldType::Element;
+    }
+    return FieldType::None;
+}
+
+std::vector<double> TimeDependentHeterogeneousParameter::interpolate(
+    double const t, SpatialPosition const& pos) const
+{
     if (t < _time_parameter_mapping[0].first)
     {
         return _time_parameter_mapping[0].second->operator()(t, pos);
@@ -11,6 +11,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 #include "Parameter.h"
 
@@ -34,10 +38,24 @@ public:
 
     bool isTimeDependent() const override;
 
+    using Parameter<double>::operator();
+
     /// @copydoc Parameter::operator()()
+    ///
+    /// If all referenced parameters are mesh node parameters or all are mesh
+    /// element parameters of the same mesh, the interpolated field is
+    /// computed once for each time \c t and the values are looked up. The
+    /// fields of the last two times are kept.
+    ///
+    /// \attention Concurrent calls must not use more than two different
+    /// times, because the field of a third time replaces one of the fields
+    /// being read.
     std::vector<double> operator()(double const t,
                                    SpatialPosition const& pos) const override;
 
+    void operator()(double const t, SpatialPosition const& pos,
+                    double* const values) const override;
+
     /// The TimeDependentHeterogeneousParameter depends in each time step on a
     /// parameter. Since, at construction time of the
     /// TimeDependentHeterogeneousParameter other parameter needs not to be
@@ -47,8 +65,43 @@ public:
         std::vector<std::unique_ptr<ParameterBase>> const& parameters) override;
 
 private:
+    /// Location of the values of the interpolated field.
+    enum class FieldType
+    {
+        Unknown,  ///< Not determined yet.
+        None,     ///< The values are not cached.
+        Node,
+        Element
+    };
+
+    /// The interpolated field at the time \c t.
+    struct Field
+    {
+        double t;
+        std::vector<double> values;  ///< Components of all nodes/elements.
+    };
+
+    /// Interpolates the referenced parameters at the given time and position.
+    std::vector<double> interpolate(double const t,
+                                    SpatialPosition const& pos) const;
+
+    /// Returns the field at the time \c t, or nullptr if the values are not
+    /// cached.
+    Field const* getField(double const t) const;
+
+    /// Determines the type of the field from the referenced parameters.
+    FieldType computeFieldType() const;
+
     std::vector<PairTimeParameterName> _time_parameter_name_mapping;
     std::vector<PairTimeParameter> _time_parameter_mapping;
+
+    mutable std::mutex _field_mutex;
+    mutable std::atomic<FieldType> _field_type{FieldType::Unknown};
+    /// The fields being read; they are owned by \c _owned_fields.
+    mutable std::array<std::atomic<Field const*>, 2> _fields{};
+    mutable std::array<std::unique_ptr<Field>, 2> _owned_fields;
+    /// Index of the field replaced next.
+    mutable std::size_t _next_field = 0;
 };
 
 std::unique_ptr<ParameterBase> createTimeDependentHeterogeneousParameter(
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <memory>
 #include <vector>
 
 #include "BaseLib/Error.h"
@@ -53,6 +54,16 @@ public:
         OGS_FATAL("not implemented.");
     }
 
+    //! Creates an independent instance with the same settings. Used for
+    //! providing each thread of a parallel assembly with its own Jacobian
+    //! assembler, because implementations may hold scratch data.
+    virtual std::unique_ptr<AbstractJacobianAssembler> copy() const
+    {
+        OGS_FATAL(
+            "The chosen Jacobian assembler cannot be used for parallel "
+            "assembly.");
+    }
+
     virtual ~AbstractJacobianAssembler() = default;
 };
 
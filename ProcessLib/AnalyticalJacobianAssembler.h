@@ -49,6 +49,11 @@ public:
         std::vector<double>& local_M_data, std::vector<double>& local_K_data,
         std::vector<double>& local_b_data, std::vector<double>& local_Jac_data,
         LocalCoupledSolutions const& local_coupled_solutions) override;
+
+    std::unique_ptr<AbstractJacobianAssembler> copy() const override
+    {
+        return std::make_unique<AnalyticalJacobianAssembler>();
+    }
 };
 
 }  // namespace ProcessLib
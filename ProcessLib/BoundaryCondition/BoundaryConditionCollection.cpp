@@ -10,6 +10,8 @@
 
 #include "BoundaryConditionCollection.h"
 
+#include "NeumannBoundaryCondition.h"
+
 namespace ProcessLib
 {
 void BoundaryConditionCollection::applyNaturalBC(
@@ -40,6 +42,8 @@ void BoundaryConditionCollection::addBCsForProcessVariables(
                   std::back_inserter(_boundary_conditions));
     }
 
+    fuseNeumannBoundaryConditions(_boundary_conditions);
+
     // For each BC there will be storage for Dirichlet BC. This storage will be
     // uninitialized by default, and has to be filled by the respective BC
     // object if needed.
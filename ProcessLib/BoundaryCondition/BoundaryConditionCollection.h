@@ -52,6 +52,7 @@ public:
     void addBoundaryCondition(std::unique_ptr<BoundaryCondition>&& bc)
     {
         _boundary_conditions.push_back(std::move(bc));
+        _dirichlet_bcs.resize(_boundary_conditions.size());
     }
 
     void preTimestep(const double t, std::vector<GlobalVector*> const& x,
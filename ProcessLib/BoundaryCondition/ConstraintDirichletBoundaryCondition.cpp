@@ -16,6 +16,8 @@
 
 #include "MeshLib/MeshSearch/NodeSearch.h"  // for getUniqueNodes
 #include "MeshLib/Node.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
+#include "NumLib/Assembler/SerialExecutor.h"
 #include "ParameterLib/Utils.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 
@@ -30,7 +32,8 @@ ConstraintDirichletBoundaryCondition::ConstraintDirichletBoundaryCondition(
     std::function<Eigen::Vector3d(std::size_t const, MathLib::Point3d const&,
                                   double const,
                                   std::vector<GlobalVector*> const&)>
-        getFlux)
+        getFlux,
+    std::function<bool()> isFluxThreadSafe)
     : _parameter(parameter),
       _variable_id(variable_id),
       _component_id(component_id),
@@ -39,7 +42,8 @@ ConstraintDirichletBoundaryCondition::ConstraintDirichletBoundaryCondition(
       _constraint_threshold(constraint_threshold),
       _lower(lower),
       _bulk_mesh(bulk_mesh),
-      _getFlux(getFlux)
+      _getFlux(getFlux),
+      _isFluxThreadSafe(std::move(isFluxThreadSafe))
 {
     if (variable_id >=
             static_cast<int>(dof_table_bulk.getNumberOfVariables()) ||
@@ -114,17 +118,23 @@ void ConstraintDirichletBoundaryCondition::preTimestep(
     DBUG(
         "ConstraintDirichletBoundaryCondition::preTimestep: computing flux "
         "constraints");
-    for (auto const* boundary_element : _bc_mesh.getElements())
+    // The local assemblers are indexed by the boundary element ids.
+    auto const integrate =
+        [&](std::size_t const /*id*/,
+            ConstraintDirichletBoundaryConditionLocalAssemblerInterface&
+                local_assembler,
+            double& flux_value) {
+            flux_value = local_assembler.integrate(x, t, _getFlux);
+        };
+
+    if (_isFluxThreadSafe())
     {
-        _flux_values[boundary_element->getID()] =
-            _local_assemblers[boundary_element->getID()]->integrate(
-                x, t,
-                [this](std::size_t const element_id,
-                       MathLib::Point3d const& pnt, double const t,
-                       std::vector<GlobalVector*> const& x) {
-                    return _getFlux(element_id, pnt, t, x);
-                });
+        NumLib::ParallelExecutor::transformDereferenced(
+            integrate, _local_assemblers, _flux_values);
+        return;
     }
+    NumLib::SerialExecutor::transformDereferenced(integrate, _local_assemblers,
+                                                  _flux_values);
 }
 
 void ConstraintDirichletBoundaryCondition::getEssentialBCValues(
@@ -323,6 +333,9 @@ createConstraintDirichletBoundaryCondition(
                                 MathLib::Point3d const& pnt, double const t,
                                 std::vector<GlobalVector*> const& x) {
             return constraining_process.getFlux(element_id, pnt, t, x);
+        },
+        [&constraining_process]() {
+            return constraining_process.isParallelAssemblyUsed();
         });
 }
 
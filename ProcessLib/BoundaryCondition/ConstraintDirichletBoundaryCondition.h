@@ -49,6 +49,11 @@ public:
     /// @param getFlux The function used for the flux calculation.
     /// @note The function has to be stored by value, else the process value is
     /// not captured properly.
+    /// @param isFluxThreadSafe Returns true if \c getFlux may be called
+    /// concurrently. Then the fluxes of the boundary elements are computed in
+    /// parallel. It is queried in each preTimestep() call because the
+    /// constraining process is configured after the boundary condition is
+    /// created.
     ConstraintDirichletBoundaryCondition(
         ParameterLib::Parameter<double> const& parameter,
         NumLib::LocalToGlobalIndexMap const& dof_table_bulk,
@@ -59,7 +64,8 @@ public:
         std::function<Eigen::Vector3d(std::size_t const,
                                       MathLib::Point3d const&, double const,
                                       std::vector<GlobalVector*> const&)>
-            getFlux);
+            getFlux,
+        std::function<bool()> isFluxThreadSafe);
 
     void preTimestep(double const t, std::vector<GlobalVector*> const& x,
                      int const process_id) override;
@@ -117,6 +123,9 @@ private:
                                   double const,
                                   std::vector<GlobalVector*> const&)>
         _getFlux;
+
+    /// Returns true if _getFlux may be called concurrently.
+    std::function<bool()> _isFluxThreadSafe;
 };
 
 /// The function parses the config tree and creates a
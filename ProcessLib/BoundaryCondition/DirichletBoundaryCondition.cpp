@@ -44,15 +44,48 @@ DirichletBoundaryCondition::DirichletBoundaryCondition(
     // and component id.
     _dof_table_boundary.reset(dof_table_bulk.deriveBoundaryConstrainedMap(
         variable_id, {component_id}, std::move(bc_mesh_subset)));
+
+    // The constrained global indices don't change during the simulation.
+    _global_ids.reserve(bc_nodes.size());
+    _node_ids.reserve(bc_nodes.size());
+    for (auto const* const node : bc_nodes)
+    {
+        auto const id = node->getID();
+        auto const global_index = _dof_table_boundary->getGlobalIndex(
+            {_bc_mesh.getID(), MeshLib::MeshItemType::Node, id}, variable_id,
+            component_id);
+        // Ghost entries, which have negative indices, are dropped, cf.
+        // getEssentialBCValuesLocal().
+        if (global_index == NumLib::MeshComponentMap::nop || global_index < 0)
+        {
+            continue;
+        }
+        _global_ids.push_back(global_index);
+        _node_ids.push_back(id);
+    }
 }
 
 void DirichletBoundaryCondition::getEssentialBCValues(
-    const double t, GlobalVector const& x,
+    const double t, GlobalVector const& /*x*/,
     NumLib::IndexValueVector<GlobalIndexType>& bc_values) const
 {
-    getEssentialBCValuesLocal(_parameter, _bc_mesh, _bc_mesh.getNodes(),
-                              *_dof_table_boundary, _variable_id, _component_id,
-                              t, x, bc_values);
+    bool const values_valid =
+        _values_time && (!_parameter.isTimeDependent() || *_values_time == t);
+    if (!values_valid)
+    {
+        ParameterLib::SpatialPosition pos;
+        _values.resize(_node_ids.size());
+        for (std::size_t i = 0; i < _node_ids.size(); ++i)
+        {
+            pos.setNodeID(_node_ids[i]);
+            _values[i] = _parameter(t, pos).front();
+        }
+        _values_time = t;
+    }
+
+    // The assignments reuse the memory of the given vectors.
+    bc_values.ids = _global_ids;
+    bc_values.values = _values;
 }
 
 std::unique_ptr<DirichletBoundaryCondition> createDirichletBoundaryCondition(
@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "BoundaryCondition.h"
 
 namespace BaseLib
@@ -38,6 +41,8 @@ public:
         NumLib::LocalToGlobalIndexMap const& dof_table_bulk,
         int const variable_id, int const component_id);
 
+    /// The values are cached for the whole simulation if the parameter is
+    /// not time-dependent, and for the last time \c t otherwise.
     void getEssentialBCValues(
         const double t, GlobalVector const& x,
         NumLib::IndexValueVector<GlobalIndexType>& bc_values) const override;
@@ -49,6 +54,17 @@ private:
     std::unique_ptr<NumLib::LocalToGlobalIndexMap const> _dof_table_boundary;
     int const _variable_id;
     int const _component_id;
+
+    /// Global indices of the constrained nodes, computed once at
+    /// construction.
+    std::vector<GlobalIndexType> _global_ids;
+    /// Ids of the boundary mesh nodes corresponding to \c _global_ids.
+    std::vector<std::size_t> _node_ids;
+
+    /// Values at the nodes of \c _node_ids at the time \c _values_time, which
+    /// is unset if no values have been computed yet.
+    mutable std::vector<double> _values;
+    mutable std::optional<double> _values_time;
 };
 
 std::unique_ptr<DirichletBoundaryCondition> createDirichletBoundaryCondition(
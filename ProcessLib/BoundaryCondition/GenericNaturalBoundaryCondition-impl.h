@@ -8,11 +8,29 @@
  *
  */
 
+#include <type_traits>
+
 #include "GenericNaturalBoundaryConditionLocalAssembler.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 
 namespace ProcessLib
 {
+namespace detail
+{
+template <typename Data, typename = void>
+struct HasTimeFactor : std::false_type
+{
+};
+
+/// True if the boundary condition data have a getTimeFactor(t) method.
+template <typename Data>
+struct HasTimeFactor<Data, std::void_t<decltype(std::declval<Data const&>()
+                                                    .getTimeFactor(0.0))>>
+    : std::true_type
+{
+};
+}  // namespace detail
+
 template <typename BoundaryConditionData,
           template <typename, typename, unsigned>
           class LocalAssemblerImplementation>
@@ -24,7 +42,12 @@ GenericNaturalBoundaryCondition<BoundaryConditionData,
         NumLib::LocalToGlobalIndexMap const& dof_table_bulk,
         int const variable_id, int const component_id,
         unsigned const global_dim, MeshLib::Mesh const& bc_mesh, Data&& data)
-    : _data(std::forward<Data>(data)), _bc_mesh(bc_mesh)
+    : _data(std::forward<Data>(data)),
+      _bc_mesh(bc_mesh),
+      _variable_id(variable_id),
+      _component_id(component_id),
+      _integration_order(integration_order),
+      _shapefunction_order(shapefunction_order)
 {
     static_assert(std::is_same<typename std::decay<BoundaryConditionData>::type,
                                typename std::decay<Data>::type>::value,
@@ -81,9 +104,22 @@ void GenericNaturalBoundaryCondition<BoundaryConditionData,
                    GlobalVector& b,
                    GlobalMatrix* Jac)
 {
-    GlobalExecutor::executeMemberOnDereferenced(
-        &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
-        _local_assemblers, *_dof_table_boundary, t, x, process_id, K, b, Jac);
+    auto const assemble = [&](GlobalVector& b_) {
+        GlobalExecutor::executeMemberOnDereferenced(
+            &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
+            _local_assemblers, *_dof_table_boundary, t, x, process_id, K, b_,
+            Jac);
+    };
+
+    if constexpr (detail::HasTimeFactor<BoundaryConditionData>::value)
+    {
+        if (auto const factor = _data.getTimeFactor(t))
+        {
+            _time_scaled_rhs.add(*factor, b, assemble);
+            return;
+        }
+    }
+    assemble(b);
 }
 
 }  // namespace ProcessLib
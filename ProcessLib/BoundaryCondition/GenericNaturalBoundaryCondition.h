@@ -12,6 +12,7 @@
 
 #include "BoundaryCondition.h"
 #include "MeshLib/MeshSubset.h"
+#include "ProcessLib/Utils/TimeScaledRhs.h"
 
 namespace ProcessLib
 {
@@ -35,10 +36,34 @@ public:
 
     /// Calls local assemblers which calculate their contributions to the global
     /// matrix and the right-hand-side.
+    ///
+    /// If the boundary condition data provide a time factor, see
+    /// NeumannBoundaryConditionData::getTimeFactor(), the right-hand side is
+    /// integrated only once and scaled afterwards.
     void applyNaturalBC(const double t, std::vector<GlobalVector*> const& x,
                         int const process_id, GlobalMatrix& K, GlobalVector& b,
                         GlobalMatrix* Jac) override;
 
+    /// Returns true if \c other is defined on the same boundary mesh for the
+    /// same variable component with the same integration and shape function
+    /// orders, i.e., if both have identical local assemblers apart from their
+    /// data.
+    bool hasSameLocalAssemblers(
+        GenericNaturalBoundaryCondition const& other) const
+    {
+        return &_bc_mesh == &other._bc_mesh &&
+               _variable_id == other._variable_id &&
+               _component_id == other._component_id &&
+               _integration_order == other._integration_order &&
+               _shapefunction_order == other._shapefunction_order;
+    }
+
+    /// The local assemblers refer to the returned data, so modifications
+    /// affect all subsequent assemblies. The data must not be modified after
+    /// the first assembly, which might have stored a time-scaled right-hand
+    /// side.
+    BoundaryConditionData& getData() { return _data; }
+
 private:
     /// Data used in the assembly of the specific boundary condition.
     BoundaryConditionData _data;
@@ -46,6 +71,11 @@ private:
     /// A lower-dimensional mesh on which the boundary condition is defined.
     MeshLib::Mesh const& _bc_mesh;
 
+    int const _variable_id;
+    int const _component_id;
+    unsigned const _integration_order;
+    unsigned const _shapefunction_order;
+
     /// Local dof table, a subset of the global one restricted to the
     /// participating number of _elements of the boundary condition.
     std::unique_ptr<NumLib::LocalToGlobalIndexMap> _dof_table_boundary;
@@ -54,6 +84,8 @@ private:
     std::vector<
         std::unique_ptr<GenericNaturalBoundaryConditionLocalAssemblerInterface>>
         _local_assemblers;
+
+    TimeScaledRhs _time_scaled_rhs;
 };
 
 }  // namespace ProcessLib
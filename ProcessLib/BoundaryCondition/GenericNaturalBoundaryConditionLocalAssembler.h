@@ -61,7 +61,8 @@ private:
         ns_and_weights.reserve(integration_method.getNumberOfPoints());
 
         auto sms = initShapeMatrices<ShapeFunction, ShapeMatricesType,
-                                     IntegrationMethod, GlobalDim>(
+                                     IntegrationMethod, GlobalDim,
+                                     NumLib::ShapeMatrixType::N_J>(
             e, is_axially_symmetric, integration_method);
         for (unsigned ip = 0; ip < sms.size(); ++ip)
         {
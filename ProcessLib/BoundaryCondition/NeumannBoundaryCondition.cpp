@@ -9,6 +9,10 @@
  */
 
 #include "NeumannBoundaryCondition.h"
+
+#include <algorithm>
+#include <iterator>
+
 #include "ParameterLib/Utils.h"
 
 namespace ProcessLib
@@ -67,7 +71,47 @@ std::unique_ptr<NeumannBoundaryCondition> createNeumannBoundaryCondition(
     return std::make_unique<NeumannBoundaryCondition>(
         integration_order, shapefunction_order, dof_table, variable_id,
         component_id, global_dim, bc_mesh,
-        NeumannBoundaryConditionData{param, integral_measure});
+        NeumannBoundaryConditionData{{{param, integral_measure}}});
+}
+
+void fuseNeumannBoundaryConditions(
+    std::vector<std::unique_ptr<BoundaryCondition>>& bcs)
+{
+    std::vector<NeumannBoundaryCondition*> fused_bcs;
+    std::size_t n_fused = 0;
+    for (auto& bc : bcs)
+    {
+        auto* const neumann_bc =
+            dynamic_cast<NeumannBoundaryCondition*>(bc.get());
+        if (neumann_bc == nullptr)
+        {
+            continue;
+        }
+
+        auto const fused_bc = std::find_if(
+            fused_bcs.begin(), fused_bcs.end(), [&](auto const* other) {
+                return other->hasSameLocalAssemblers(*neumann_bc);
+            });
+        if (fused_bc == fused_bcs.end())
+        {
+            fused_bcs.push_back(neumann_bc);
+            continue;
+        }
+
+        auto const& terms = neumann_bc->getData().terms;
+        std::copy(terms.begin(), terms.end(),
+                  std::back_inserter((*fused_bc)->getData().terms));
+        bc.reset();
+        n_fused++;
+    }
+
+    if (n_fused == 0)
+    {
+        return;
+    }
+    DBUG("Fused %d Neumann BCs into other Neumann BCs on the same boundary.",
+         n_fused);
+    bcs.erase(std::remove(bcs.begin(), bcs.end(), nullptr), bcs.end());
 }
 
 }  // namespace ProcessLib
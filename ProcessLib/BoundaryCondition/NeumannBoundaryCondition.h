@@ -28,4 +28,12 @@ std::unique_ptr<NeumannBoundaryCondition> createNeumannBoundaryCondition(
     std::vector<std::unique_ptr<ParameterLib::ParameterBase>> const&
         parameters);
 
+/// Fuses the Neumann boundary conditions of \c bcs which are defined on the
+/// same boundary mesh for the same variable component into the first of them.
+/// Their terms are assembled in a single element loop then, sharing the shape
+/// matrices and the global scatter. The fused boundary conditions are removed
+/// from \c bcs; the order of the remaining ones is kept.
+void fuseNeumannBoundaryConditions(
+    std::vector<std::unique_ptr<BoundaryCondition>>& bcs);
+
 }  // namespace ProcessLib
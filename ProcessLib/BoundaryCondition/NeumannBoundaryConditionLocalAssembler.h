@@ -20,8 +20,34 @@ namespace ProcessLib
 {
 struct NeumannBoundaryConditionData final
 {
-    ParameterLib::Parameter<double> const& neumann_bc_parameter;
-    ParameterLib::Parameter<double> const* const integral_measure;
+    struct Term
+    {
+        ParameterLib::Parameter<double> const& neumann_bc_parameter;
+        ParameterLib::Parameter<double> const* integral_measure;
+    };
+
+    /// The contributions of all terms are summed up. Several Neumann boundary
+    /// conditions on the same boundary can be fused into one this way, cf.
+    /// fuseNeumannBoundaryConditions().
+    std::vector<Term> terms;
+
+    /// Returns the factor \f$ f(t) \f$ if the assembled right-hand side is
+    /// the product of \f$ f(t) \f$ and a time-independent vector, i.e., for a
+    /// single term whose parameter only varies in time by a factor, cf.
+    /// ParameterLib::ParameterBase::getTimeFactor().
+    boost::optional<double> getTimeFactor(double const t) const
+    {
+        if (terms.size() != 1)
+        {
+            return boost::none;
+        }
+        auto const& term = terms.front();
+        if (term.integral_measure && term.integral_measure->isTimeDependent())
+        {
+            return boost::none;
+        }
+        return term.neumann_bc_parameter.getTimeFactor(t);
+    }
 };
 
 template <typename ShapeFunction, typename IntegrationMethod,
@@ -36,7 +62,7 @@ class NeumannBoundaryConditionLocalAssembler final
     using NodalVectorType = typename Base::NodalVectorType;
 
 public:
-    /// The neumann_bc_value factor is directly integrated into the local
+    /// The neumann_bc_value factors are directly integrated into the local
     /// element matrix.
     NeumannBoundaryConditionLocalAssembler(
         MeshLib::Element const& e,
@@ -61,30 +87,54 @@ public:
         unsigned const n_integration_points =
             Base::_integration_method.getNumberOfPoints();
 
-        // Get element nodes for the interpolation from nodes to integration
-        // point.
-        NodalVectorType parameter_node_values =
-            _data.neumann_bc_parameter
-                .getNodalValuesOnElement(Base::_element, t)
-                .template topRows<ShapeFunction::MeshElement::n_all_nodes>();
-
         ParameterLib::SpatialPosition position;
         position.setElementID(Base::_element.getID());
 
-        double integral_measure = 1.0;
-        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        // Get element nodes for the interpolation from nodes to integration
+        // point. The terms without an integral measure are summed up at the
+        // nodes and integrated together.
+        NodalVectorType summed_node_values =
+            NodalVectorType::Zero(_local_rhs.size());
+        bool has_summed_terms = false;
+        for (auto const& term : _data.terms)
         {
-            position.setIntegrationPoint(ip);
-            auto const& ip_data = Base::_ns_and_weights[ip];
-            auto const& N = ip_data.N;
-            auto const& w = ip_data.weight;
+            NodalVectorType const parameter_node_values =
+                term.neumann_bc_parameter
+                    .getNodalValuesOnElement(Base::_element, t)
+                    .template topRows<
+                        ShapeFunction::MeshElement::n_all_nodes>();
 
-            if (_data.integral_measure)
+            if (!term.integral_measure)
             {
-                integral_measure = (*_data.integral_measure)(t, position)[0];
+                summed_node_values += parameter_node_values;
+                has_summed_terms = true;
+                continue;
+            }
+
+            for (unsigned ip = 0; ip < n_integration_points; ip++)
+            {
+                position.setIntegrationPoint(ip);
+                auto const& ip_data = Base::_ns_and_weights[ip];
+                auto const& N = ip_data.N;
+                auto const& w = ip_data.weight;
+
+                double const integral_measure =
+                    (*term.integral_measure)(t, position)[0];
+                _local_rhs.noalias() +=
+                    N * parameter_node_values.dot(N) * w * integral_measure;
+            }
+        }
+
+        if (has_summed_terms)
+        {
+            for (unsigned ip = 0; ip < n_integration_points; ip++)
+            {
+                auto const& ip_data = Base::_ns_and_weights[ip];
+                auto const& N = ip_data.N;
+                auto const& w = ip_data.weight;
+
+                _local_rhs.noalias() += N * summed_node_values.dot(N) * w;
             }
-            _local_rhs.noalias() +=
-                N * parameter_node_values.dot(N) * w * integral_measure;
         }
 
         auto const indices = NumLib::getIndices(id, dof_table_boundary);
@@ -40,9 +40,11 @@ public:
         BHEInflowPythonBoundaryConditionPythonSideInterface& py_bc_object)
         : _in_out_global_indices(std::move(in_out_global_indices)),
           _bhe(bhe),
-          _py_bc_object(py_bc_object)
+          _py_bc_object(py_bc_object),
+          _dataframe_index(
+              std::get<3>(py_bc_object.dataframe_network).size())
     {
-        const auto g_idx_T_out = in_out_global_indices.second;
+        const auto g_idx_T_out = _in_out_global_indices.second;
 
         // store the bc node ids to BHE network dataframe
         std::get<3>(_py_bc_object.dataframe_network).emplace_back(g_idx_T_out);
@@ -55,31 +57,15 @@ public:
         bc_values.ids.resize(1);
         bc_values.values.resize(1);
         auto const& data_exchange = _py_bc_object.dataframe_network;
-        // get the number of all boundary nodes
-        const std::size_t n_bc_nodes = std::get<3>(data_exchange).size();
 
         // get T_in bc_id
         bc_values.ids[0] = _in_out_global_indices.first;
 
-        // get T_out bc_id
-        auto const boundary_node_id = _in_out_global_indices.second;
-
         // return T_in from currently BHE dataframe column 2,
         // update flowrate and HeatTransferCoefficients for each BHE
-        for (std::size_t i = 0; i < n_bc_nodes; i++)
-        {
-            // auto pair_flag_value =
-            // _bc_data.bc_object->getDirichletBCValue(boundary_node_id);
-            auto const dataframe_node_id = std::get<3>(data_exchange);
-            auto const dataframe_Tin_val = std::get<1>(data_exchange);
-            auto const dataframe_BHE_flowrate = std::get<4>(data_exchange);
-            if (dataframe_node_id[i] == boundary_node_id)
-            {
-                bc_values.values[0] = dataframe_Tin_val[i];
-                _bhe.updateHeatTransferCoefficients(dataframe_BHE_flowrate[i]);
-                break;
-            }
-        }
+        bc_values.values[0] = std::get<1>(data_exchange)[_dataframe_index];
+        _bhe.updateHeatTransferCoefficients(
+            std::get<4>(data_exchange)[_dataframe_index]);
 
         // store the current time to network dataframe
         std::get<0>(_py_bc_object.dataframe_network) = t;
@@ -89,6 +75,8 @@ private:
     std::pair<GlobalIndexType, GlobalIndexType> const _in_out_global_indices;
     BHEType& _bhe;
     BHEInflowPythonBoundaryConditionPythonSideInterface& _py_bc_object;
+    /// Position of this BHE in the columns of the BHE network dataframe.
+    std::size_t const _dataframe_index;
 };
 
 template <typename BHEType>
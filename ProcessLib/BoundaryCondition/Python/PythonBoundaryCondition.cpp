@@ -11,7 +11,9 @@
 #include "PythonBoundaryCondition.h"
 
 #include <pybind11/pybind11.h>
+#include <cmath>
 #include <iostream>
+#include <limits>
 
 #include "MeshLib/MeshSearch/NodeSearch.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
@@ -78,6 +80,15 @@ PythonBoundaryCondition::PythonBoundaryCondition(
         shapefunction_order, _local_assemblers,
         _bc_data.boundary_mesh.isAxiallySymmetric(), integration_order,
         _bc_data);
+
+    _integration_point_offsets.reserve(_local_assemblers.size() + 1);
+    _integration_point_offsets.push_back(0);
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        _integration_point_offsets.push_back(
+            _integration_point_offsets.back() +
+            local_assembler->getNumberOfIntegrationPoints());
+    }
 }
 
 void PythonBoundaryCondition::getEssentialBCValues(
@@ -89,31 +100,44 @@ void PythonBoundaryCondition::getEssentialBCValues(
 
     auto const nodes = _bc_data.boundary_mesh.getNodes();
 
-    auto const& bulk_node_ids_map =
-        *_bc_data.boundary_mesh.getProperties().getPropertyVector<std::size_t>(
-            "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
+    auto const& bulk_node_ids_map = _bc_data.bulk_node_ids;
 
     bc_values.ids.clear();
     bc_values.values.clear();
 
-    bc_values.ids.reserve(_bc_data.boundary_mesh.getNumberOfNodes());
-    bc_values.values.reserve(_bc_data.boundary_mesh.getNumberOfNodes());
+    auto const num_nodes = _bc_data.boundary_mesh.getNumberOfNodes();
+    if (num_nodes == 0)
+    {
+        return;
+    }
+    bc_values.ids.reserve(num_nodes);
+    bc_values.values.reserve(num_nodes);
+
+    auto const num_var = _dof_table_boundary->getNumberOfVariables();
+    int num_comp_total = 0;
+    for (int var = 0; var < num_var; ++var)
+    {
+        num_comp_total +=
+            _dof_table_boundary->getNumberOfVariableComponents(var);
+    }
 
-    std::vector<double> primary_variables;
+    // gather the data of all nodes for a single Python call
+    Eigen::MatrixXd coords(num_nodes, 3);
+    Eigen::MatrixXd primary_variables(num_nodes, num_comp_total);
+    std::vector<std::size_t> node_ids(num_nodes);
 
-    for (auto const* node : _bc_data.boundary_mesh.getNodes())
+    for (std::size_t i = 0; i < num_nodes; ++i)
     {
-        auto const boundary_node_id = node->getID();
+        auto const boundary_node_id = nodes[i]->getID();
         auto const bulk_node_id = bulk_node_ids_map[boundary_node_id];
 
         // gather primary variable values
-        primary_variables.clear();
-        auto const num_var = _dof_table_boundary->getNumberOfVariables();
+        int global_comp = 0;
         for (int var = 0; var < num_var; ++var)
         {
             auto const num_comp =
                 _dof_table_boundary->getNumberOfVariableComponents(var);
-            for (int comp = 0; comp < num_comp; ++comp)
+            for (int comp = 0; comp < num_comp; ++comp, ++global_comp)
             {
                 MeshLib::Location loc{_bc_data.bulk_mesh_id,
                                       MeshLib::MeshItemType::Node,
@@ -133,26 +157,43 @@ void PythonBoundaryCondition::getEssentialBCValues(
                         bulk_node_id, var, comp);
                 }
 
-                primary_variables.push_back(x[dof_idx]);
+                primary_variables(i, global_comp) = x[dof_idx];
             }
         }
 
-        auto* xs = nodes[boundary_node_id]->getCoords();  // TODO DDC problems?
-        auto pair_flag_value = _bc_data.bc_object->getDirichletBCValue(
-            t, {xs[0], xs[1], xs[2]}, boundary_node_id, primary_variables);
-        if (!_bc_data.bc_object->isOverriddenEssential())
-        {
-            DBUG(
-                "Method `getDirichletBCValue' not overridden in Python "
-                "script.");
-            return;
-        }
+        auto* xs = nodes[i]->getCoords();  // TODO DDC problems?
+        coords.row(i) << xs[0], xs[1], xs[2];
+        node_ids[i] = boundary_node_id;
+    }
 
-        if (!pair_flag_value.first)
+    auto const flags_values = _bc_data.bc_object->getDirichletBCValues(
+        t, coords, node_ids, primary_variables);
+    if (!_bc_data.bc_object->isOverriddenEssential())
+    {
+        DBUG(
+            "Method `getDirichletBCValue' not overridden in Python "
+            "script.");
+        return;
+    }
+
+    auto const& is_dirichlet = flags_values.first;
+    auto const& values = flags_values.second;
+    if (is_dirichlet.size() != num_nodes || values.size() != num_nodes)
+    {
+        OGS_FATAL(
+            "The Python BC must return a flag and a value for each of the %d "
+            "boundary nodes. %d flags and %d values returned from Python.",
+            num_nodes, is_dirichlet.size(), values.size());
+    }
+
+    for (std::size_t i = 0; i < num_nodes; ++i)
+    {
+        if (!is_dirichlet[i])
         {
             continue;
         }
 
+        auto const bulk_node_id = bulk_node_ids_map[node_ids[i]];
         MeshLib::Location l(_bc_data.bulk_mesh_id, MeshLib::MeshItemType::Node,
                             bulk_node_id);
         const auto dof_idx = _bc_data.dof_table_bulk.getGlobalIndex(
@@ -174,27 +215,103 @@ void PythonBoundaryCondition::getEssentialBCValues(
         if (dof_idx >= 0)
         {
             bc_values.ids.emplace_back(dof_idx);
-            bc_values.values.emplace_back(pair_flag_value.second);
+            bc_values.values.emplace_back(values[i]);
         }
     }
 }
 
 void PythonBoundaryCondition::applyNaturalBC(
     const double t, std::vector<GlobalVector*> const& x, int const process_id,
-    GlobalMatrix& K, GlobalVector& b, GlobalMatrix* Jac)
+    GlobalMatrix& /*K*/, GlobalVector& b, GlobalMatrix* Jac)
 {
+    auto const num_integration_points = _integration_point_offsets.back();
+    if (!_is_natural_bc || num_integration_points == 0)
+    {
+        return;
+    }
+
     FlushStdoutGuard guard(_flush_stdout);
 
-    try
+    // gather the data of all integration points for a single Python call
+    Eigen::MatrixXd coords(num_integration_points, 3);
+    Eigen::MatrixXd primary_variables(
+        num_integration_points, _bc_data.dof_table_bulk.getNumberOfComponents());
+    for (std::size_t i = 0; i < _local_assemblers.size(); ++i)
     {
-        GlobalExecutor::executeMemberOnDereferenced(
-            &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
-            _local_assemblers, *_dof_table_boundary, t, x, process_id, K, b,
-            Jac);
+        _local_assemblers[i]->getIntegrationPointData(
+            *x[process_id], _integration_point_offsets[i], coords,
+            primary_variables);
     }
-    catch (MethodNotOverriddenInDerivedClassException const& /*e*/)
+
+    auto flags_fluxes_dFluxes =
+        _bc_data.bc_object->getFluxes(t, coords, primary_variables);
+    if (!_bc_data.bc_object->isOverriddenNatural())
     {
+        // getFlux() is not overridden in Python, so we can skip the whole BC
+        // assembly (i.e., for all boundary elements) now and later.
         DBUG("Method `getFlux' not overridden in Python script.");
+        _is_natural_bc = false;
+        return;
+    }
+    if (Jac)
+    {
+        computeMissingFluxJacobians(
+            *_bc_data.bc_object, t, coords, primary_variables,
+            std::get<0>(flags_fluxes_dFluxes),
+            std::get<1>(flags_fluxes_dFluxes),
+            std::get<2>(flags_fluxes_dFluxes));
+    }
+
+    for (std::size_t i = 0; i < _local_assemblers.size(); ++i)
+    {
+        _local_assemblers[i]->assembleFluxes(
+            i, *_dof_table_boundary, _integration_point_offsets[i],
+            std::get<0>(flags_fluxes_dFluxes),
+            std::get<1>(flags_fluxes_dFluxes),
+            std::get<2>(flags_fluxes_dFluxes), b, Jac);
+    }
+}
+
+void computeMissingFluxJacobians(
+    PythonBoundaryConditionPythonSideInterface const& bc_object, double const t,
+    Eigen::MatrixXd const& coords, Eigen::MatrixXd const& primary_variables,
+    std::vector<bool> const& is_natural, std::vector<double> const& fluxes,
+    std::vector<std::vector<double>>& flux_jacobians)
+{
+    auto const num_points = primary_variables.rows();
+    auto const num_comp_total = primary_variables.cols();
+
+    std::vector<Eigen::Index> missing_points;
+    for (Eigen::Index i = 0; i < num_points; ++i)
+    {
+        if (is_natural[i] && flux_jacobians[i].empty())
+        {
+            missing_points.push_back(i);
+            flux_jacobians[i].resize(num_comp_total);
+        }
+    }
+    if (missing_points.empty())
+    {
+        return;
+    }
+
+    Eigen::VectorXd const eps =
+        std::sqrt(std::numeric_limits<double>::epsilon()) *
+        primary_variables.cwiseAbs().cwiseMax(1.0).rowwise().maxCoeff();
+
+    Eigen::MatrixXd perturbed_primary_variables = primary_variables;
+    for (Eigen::Index comp = 0; comp < num_comp_total; ++comp)
+    {
+        perturbed_primary_variables.col(comp) += eps;
+        auto const perturbed_fluxes = std::get<1>(
+            bc_object.getFluxes(t, coords, perturbed_primary_variables));
+        perturbed_primary_variables.col(comp) = primary_variables.col(comp);
+
+        for (auto const i : missing_points)
+        {
+            flux_jacobians[i][comp] =
+                (perturbed_fluxes[i] - fluxes[i]) / eps[i];
+        }
     }
 }
 
@@ -257,7 +374,9 @@ std::unique_ptr<PythonBoundaryCondition> createPythonBoundaryCondition(
         PythonBoundaryConditionData{
             bc, dof_table, bulk_mesh_id,
             dof_table.getGlobalComponent(variable_id, component_id),
-            boundary_mesh},
+            boundary_mesh,
+            *boundary_mesh.getProperties().getPropertyVector<std::size_t>(
+                "bulk_node_ids", MeshLib::MeshItemType::Node, 1)},
         integration_order, shapefunction_order, global_dim, flush_stdout);
 }
 
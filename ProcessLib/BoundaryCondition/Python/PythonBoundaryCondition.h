@@ -38,8 +38,52 @@ struct PythonBoundaryConditionData
 
     //! The boundary mesh, i.e., the domain of this BC.
     const MeshLib::Mesh& boundary_mesh;
+
+    //! The bulk node ids of the boundary mesh's nodes, resolved once.
+    MeshLib::PropertyVector<std::size_t> const& bulk_node_ids;
+};
+
+//! Local assembler interface of the natural Python BC, which evaluates the
+//! fluxes of all integration points of the boundary in a single Python call.
+class PythonBoundaryConditionLocalAssemblerInterface
+{
+public:
+    virtual ~PythonBoundaryConditionLocalAssemblerInterface() = default;
+
+    virtual unsigned getNumberOfIntegrationPoints() const = 0;
+
+    //! Writes the positions and the primary variables at the integration
+    //! points of the element to the rows of \c coords and \c
+    //! primary_variables starting at \c offset.
+    virtual void getIntegrationPointData(
+        GlobalVector const& x, std::size_t const offset,
+        Eigen::MatrixXd& coords, Eigen::MatrixXd& primary_variables) const = 0;
+
+    //! Assembles the fluxes at the integration points of the element, which
+    //! are stored in the entries starting at \c offset.
+    virtual void assembleFluxes(
+        std::size_t const boundary_element_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        std::size_t const offset, std::vector<bool> const& is_natural,
+        std::vector<double> const& fluxes,
+        std::vector<std::vector<double>> const& flux_jacobians,
+        GlobalVector& b, GlobalMatrix* Jac) const = 0;
 };
 
+//! Computes the derivatives of the fluxes w.r.t. the primary variables by
+//! forward differences for the integration points for which Python returned
+//! none.
+//!
+//! The flux at an integration point depends on the primary variables at that
+//! point only. Hence the integration points do not interact and are all
+//! perturbed at once, i.e., one additional Python call is made per component
+//! instead of one per d.o.f.
+void computeMissingFluxJacobians(
+    PythonBoundaryConditionPythonSideInterface const& bc_object, double const t,
+    Eigen::MatrixXd const& coords, Eigen::MatrixXd const& primary_variables,
+    std::vector<bool> const& is_natural, std::vector<double> const& fluxes,
+    std::vector<std::vector<double>>& flux_jacobians);
+
 //! A boundary condition whose values are computed by a Python script.
 class PythonBoundaryCondition final : public BoundaryCondition
 {
@@ -66,10 +110,17 @@ private:
     std::unique_ptr<NumLib::LocalToGlobalIndexMap> _dof_table_boundary;
 
     //! Local assemblers for all elements of the boundary mesh.
-    std::vector<
-        std::unique_ptr<GenericNaturalBoundaryConditionLocalAssemblerInterface>>
+    std::vector<std::unique_ptr<PythonBoundaryConditionLocalAssemblerInterface>>
         _local_assemblers;
 
+    //! Offsets of the integration points of each boundary element in the
+    //! arguments of the Python BC's getFluxes().
+    std::vector<std::size_t> _integration_point_offsets;
+
+    //! Whether getFlux() or getFluxes() is overridden in Python. Set to false
+    //! once detected to skip the natural BC altogether.
+    bool _is_natural_bc = true;
+
     //! Whether or not to flush standard output before and after each call to
     //! Python code. Ensures right order of output messages and therefore
     //! simplifies debugging.
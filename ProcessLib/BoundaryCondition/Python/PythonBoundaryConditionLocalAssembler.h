@@ -20,17 +20,12 @@
 
 namespace ProcessLib
 {
-//! Can be thrown to indicate that a member function is not overridden in a
-//! derived class (in particular, if a Python class inherits from a C++ class).
-struct MethodNotOverriddenInDerivedClassException
-{
-};
-
 template <typename ShapeFunction, typename IntegrationMethod,
           unsigned GlobalDim>
 class PythonBoundaryConditionLocalAssembler final
     : public GenericNaturalBoundaryConditionLocalAssembler<
-          ShapeFunction, IntegrationMethod, GlobalDim>
+          ShapeFunction, IntegrationMethod, GlobalDim>,
+      public PythonBoundaryConditionLocalAssemblerInterface
 {
     using Base = GenericNaturalBoundaryConditionLocalAssembler<
         ShapeFunction, IntegrationMethod, GlobalDim>;
@@ -44,33 +39,14 @@ public:
         PythonBoundaryConditionData const& data)
         : Base(e, is_axially_symmetric, integration_order), _data(data)
     {
-    }
-
-    void assemble(std::size_t const boundary_element_id,
-                  NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
-                  double const t, std::vector<GlobalVector*> const& x,
-                  int const process_id, GlobalMatrix& /*K*/, GlobalVector& b,
-                  GlobalMatrix* Jac) override
-    {
-        using ShapeMatricesType =
-            ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
-        auto const fe = NumLib::createIsoparametricFiniteElement<
-            ShapeFunction, ShapeMatricesType>(Base::_element);
-
-        unsigned const num_integration_points =
-            Base::_integration_method.getNumberOfPoints();
         auto const num_var = _data.dof_table_bulk.getNumberOfVariables();
         auto const num_nodes = Base::_element.getNumberOfNodes();
         auto const num_comp_total =
             _data.dof_table_bulk.getNumberOfComponents();
 
-        auto const& bulk_node_ids_map =
-            *_data.boundary_mesh.getProperties()
-                 .template getPropertyVector<std::size_t>(
-                     "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
-
-        // gather primary variables
-        Eigen::MatrixXd primary_variables_mat(num_nodes, num_comp_total);
+        // The bulk d.o.f. indices are resolved once, because the mesh property
+        // and d.o.f. table lookups are too expensive for each assembly.
+        _bulk_dof_indices.resize(num_nodes * num_comp_total);
         for (int var = 0; var < num_var; ++var)
         {
             auto const num_comp =
@@ -78,7 +54,7 @@ public:
             for (int comp = 0; comp < num_comp; ++comp)
             {
                 auto const global_component =
-                    dof_table_boundary.getGlobalComponent(var, comp);
+                    _data.dof_table_bulk.getGlobalComponent(var, comp);
 
                 for (unsigned element_node_id = 0; element_node_id < num_nodes;
                      ++element_node_id)
@@ -87,7 +63,7 @@ public:
                         Base::_element.getNode(element_node_id);
                     auto const boundary_node_id = node->getID();
                     auto const bulk_node_id =
-                        bulk_node_ids_map[boundary_node_id];
+                        _data.bulk_node_ids[boundary_node_id];
                     MeshLib::Location loc{_data.bulk_mesh_id,
                                           MeshLib::MeshItemType::Node,
                                           bulk_node_id};
@@ -104,51 +80,111 @@ public:
                             "e.g., the HM process.",
                             bulk_node_id, var, comp);
                     }
-                    primary_variables_mat(element_node_id, global_component) =
-                        (*x[process_id])[dof_idx];
+                    _bulk_dof_indices[global_component * num_nodes +
+                                      element_node_id] = dof_idx;
                 }
             }
         }
+    }
+
+    unsigned getNumberOfIntegrationPoints() const override
+    {
+        return Base::_integration_method.getNumberOfPoints();
+    }
+
+    void getIntegrationPointData(
+        GlobalVector const& x, std::size_t const offset,
+        Eigen::MatrixXd& coords,
+        Eigen::MatrixXd& primary_variables) const override
+    {
+        using ShapeMatricesType =
+            ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
+        auto const fe = NumLib::createIsoparametricFiniteElement<
+            ShapeFunction, ShapeMatricesType>(Base::_element);
+
+        unsigned const num_integration_points =
+            Base::_integration_method.getNumberOfPoints();
+        auto const num_nodes = Base::_element.getNumberOfNodes();
+        auto const num_comp_total =
+            _data.dof_table_bulk.getNumberOfComponents();
+
+        // gather primary variables
+        Eigen::MatrixXd primary_variables_mat(num_nodes, num_comp_total);
+        for (int global_component = 0; global_component < num_comp_total;
+             ++global_component)
+        {
+            for (unsigned element_node_id = 0; element_node_id < num_nodes;
+                 ++element_node_id)
+            {
+                primary_variables_mat(element_node_id, global_component) =
+                    x[_bulk_dof_indices[global_component * num_nodes +
+                                        element_node_id]];
+            }
+        }
+
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            auto const& N = Base::_ns_and_weights[ip].N;
+            auto const ip_coords = fe.interpolateCoordinates(N);
+            coords.row(offset + ip) << ip_coords[0], ip_coords[1],
+                ip_coords[2];
+            // Assumption: all primary variables have same shape functions.
+            primary_variables.row(offset + ip).noalias() =
+                N * primary_variables_mat;
+        }
+    }
+
+    void assembleFluxes(std::size_t const boundary_element_id,
+                        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+                        std::size_t const offset,
+                        std::vector<bool> const& is_natural,
+                        std::vector<double> const& fluxes,
+                        std::vector<std::vector<double>> const& flux_jacobians,
+                        GlobalVector& b, GlobalMatrix* Jac) const override
+    {
+        unsigned const num_integration_points =
+            Base::_integration_method.getNumberOfPoints();
+        auto const num_nodes = Base::_element.getNumberOfNodes();
+        auto const num_comp_total =
+            _data.dof_table_bulk.getNumberOfComponents();
+
+        if (is_natural.size() < offset + num_integration_points ||
+            fluxes.size() < offset + num_integration_points ||
+            flux_jacobians.size() < offset + num_integration_points)
+        {
+            OGS_FATAL(
+                "The Python BC must return a flag, a flux and its derivative "
+                "for each of the %d integration points. %d flags, %d fluxes "
+                "and %d derivatives returned from Python.",
+                offset + num_integration_points, is_natural.size(),
+                fluxes.size(), flux_jacobians.size());
+        }
 
         Eigen::VectorXd local_rhs = Eigen::VectorXd::Zero(num_nodes);
         Eigen::MatrixXd local_Jac =
             Eigen::MatrixXd::Zero(num_nodes, num_nodes * num_comp_total);
-        std::vector<double> prim_vars_data(num_comp_total);
-        auto prim_vars = MathLib::toVector(prim_vars_data);
 
         for (unsigned ip = 0; ip < num_integration_points; ip++)
         {
             auto const& N = Base::_ns_and_weights[ip].N;
             auto const& w = Base::_ns_and_weights[ip].weight;
-            auto const coords = fe.interpolateCoordinates(N);
-            prim_vars =
-                N * primary_variables_mat;  // Assumption: all primary variables
-                                            // have same shape functions.
-            auto const flag_flux_dFlux =
-                _data.bc_object->getFlux(t, coords, prim_vars_data);
-            if (!_data.bc_object->isOverriddenNatural())
-            {
-                // getFlux() is not overridden in Python, so we can skip the
-                // whole BC assembly (i.e., for all boundary elements).
-                throw MethodNotOverriddenInDerivedClassException{};
-            }
 
-            if (!std::get<0>(flag_flux_dFlux))
+            if (!is_natural[offset + ip])
             {
                 // No flux value for this integration point. Skip assembly of
                 // the entire element.
                 return;
             }
-            auto const flux = std::get<1>(flag_flux_dFlux);
-            auto const& dFlux = std::get<2>(flag_flux_dFlux);
+            auto const flux = fluxes[offset + ip];
+            auto const& dFlux = flux_jacobians[offset + ip];
 
             local_rhs.noalias() += N * (flux * w);
 
-            if (static_cast<int>(dFlux.size()) != num_comp_total)
+            // An empty derivative has been replaced by a finite difference
+            // approximation if a Jacobian is assembled.
+            if (!dFlux.empty() &&
+                static_cast<int>(dFlux.size()) != num_comp_total)
             {
-                // This strict check is technically mandatory only if a Jacobian
-                // is assembled. However, it is done as a consistency check also
-                // for cases without Jacobian assembly.
                 OGS_FATAL(
                     "The Python BC must return the derivative of the flux "
                     "w.r.t. each primary variable. %d components expected. %d "
@@ -172,9 +208,11 @@ public:
             }
         }
 
-        auto const& indices_specific_component =
+        auto const indices_range =
             dof_table_boundary(boundary_element_id, _data.global_component_id)
                 .rows;
+        std::vector<GlobalIndexType> const indices_specific_component(
+            indices_range.begin(), indices_range.end());
         b.add(indices_specific_component, local_rhs);
 
         if (Jac)
@@ -188,8 +226,45 @@ public:
         }
     }
 
+    //! Assembles this element alone with a separate Python call.
+    void assemble(std::size_t const boundary_element_id,
+                  NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+                  double const t, std::vector<GlobalVector*> const& x,
+                  int const process_id, GlobalMatrix& /*K*/, GlobalVector& b,
+                  GlobalMatrix* Jac) override
+    {
+        auto const num_integration_points = getNumberOfIntegrationPoints();
+        Eigen::MatrixXd coords(num_integration_points, 3);
+        Eigen::MatrixXd primary_variables(
+            num_integration_points,
+            _data.dof_table_bulk.getNumberOfComponents());
+        getIntegrationPointData(*x[process_id], 0, coords, primary_variables);
+
+        auto flags_fluxes_dFluxes =
+            _data.bc_object->getFluxes(t, coords, primary_variables);
+        if (!_data.bc_object->isOverriddenNatural())
+        {
+            return;
+        }
+        if (Jac)
+        {
+            computeMissingFluxJacobians(*_data.bc_object, t, coords,
+                                        primary_variables,
+                                        std::get<0>(flags_fluxes_dFluxes),
+                                        std::get<1>(flags_fluxes_dFluxes),
+                                        std::get<2>(flags_fluxes_dFluxes));
+        }
+        assembleFluxes(boundary_element_id, dof_table_boundary, 0,
+                       std::get<0>(flags_fluxes_dFluxes),
+                       std::get<1>(flags_fluxes_dFluxes),
+                       std::get<2>(flags_fluxes_dFluxes), b, Jac);
+    }
+
 private:
     PythonBoundaryConditionData const& _data;
+
+    //! Bulk d.o.f. indices of the element's nodes ordered by component.
+    std::vector<GlobalIndexType> _bulk_dof_indices;
 };
 
 }  // namespace ProcessLib
@@ -10,6 +10,7 @@
 
 #include "PythonBoundaryConditionModule.h"
 
+#include <pybind11/eigen.h>
 #include <pybind11/stl.h>
 
 #include "PythonBoundaryConditionPythonSideInterface.h"
@@ -36,6 +37,17 @@ public:
                           primary_variables);
     }
 
+    std::pair<std::vector<bool>, std::vector<double>> getDirichletBCValues(
+        double t, Eigen::MatrixXd const& coords,
+        std::vector<std::size_t> const& node_ids,
+        Eigen::MatrixXd const& primary_variables) const override
+    {
+        using Ret = std::pair<std::vector<bool>, std::vector<double>>;
+        PYBIND11_OVERLOAD(Ret, PythonBoundaryConditionPythonSideInterface,
+                          getDirichletBCValues, t, coords, node_ids,
+                          primary_variables);
+    }
+
     std::tuple<bool, double, std::vector<double>> getFlux(
         double t, std::array<double, 3> x,
         std::vector<double> const& primary_variables) const override
@@ -44,6 +56,17 @@ public:
         PYBIND11_OVERLOAD(Ret, PythonBoundaryConditionPythonSideInterface,
                           getFlux, t, x, primary_variables);
     }
+
+    std::tuple<std::vector<bool>, std::vector<double>,
+               std::vector<std::vector<double>>>
+    getFluxes(double t, Eigen::MatrixXd const& coords,
+              Eigen::MatrixXd const& primary_variables) const override
+    {
+        using Ret = std::tuple<std::vector<bool>, std::vector<double>,
+                               std::vector<std::vector<double>>>;
+        PYBIND11_OVERLOAD(Ret, PythonBoundaryConditionPythonSideInterface,
+                          getFluxes, t, coords, primary_variables);
+    }
 };
 
 void pythonBindBoundaryCondition(pybind11::module& m)
@@ -58,7 +81,11 @@ void pythonBindBoundaryCondition(pybind11::module& m)
 
     pybc.def("getDirichletBCValue",
              &PythonBoundaryConditionPythonSideInterface::getDirichletBCValue);
+    pybc.def("getDirichletBCValues",
+             &PythonBoundaryConditionPythonSideInterface::getDirichletBCValues);
     pybc.def("getFlux", &PythonBoundaryConditionPythonSideInterface::getFlux);
+    pybc.def("getFluxes",
+             &PythonBoundaryConditionPythonSideInterface::getFluxes);
 }
 
 }  // namespace ProcessLib
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <Eigen/Core>
+
 namespace ProcessLib
 {
 //! Base class for boundary conditions.
@@ -34,13 +36,53 @@ public:
         return {false, std::numeric_limits<double>::quiet_NaN()};
     }
 
+    /*!
+     * Computes Dirichlet boundary condition values for all boundary nodes at
+     * once (time, positions of the nodes and primary variables at the nodes as
+     * the rows of NumPy arrays, node ids).
+     *
+     * The default implementation calls getDirichletBCValue() for each node.
+     * Overriding this method avoids the overhead of a Python call per node.
+     *
+     * \return a pair (is_dirichlet, values) of sequences with one entry per
+     * node.
+     */
+    virtual std::pair<std::vector<bool>, std::vector<double>>
+    getDirichletBCValues(double t, Eigen::MatrixXd const& coords,
+                         std::vector<std::size_t> const& node_ids,
+                         Eigen::MatrixXd const& primary_variables) const
+    {
+        auto const num_nodes = node_ids.size();
+        std::vector<bool> is_dirichlet(num_nodes, false);
+        std::vector<double> values(num_nodes,
+                                   std::numeric_limits<double>::quiet_NaN());
+        std::vector<double> node_primary_variables(primary_variables.cols());
+        for (std::size_t i = 0; i < num_nodes; ++i)
+        {
+            Eigen::VectorXd::Map(node_primary_variables.data(),
+                                 node_primary_variables.size()) =
+                primary_variables.row(i);
+            auto const flag_value = getDirichletBCValue(
+                t, {coords(i, 0), coords(i, 1), coords(i, 2)}, node_ids[i],
+                node_primary_variables);
+            if (!_overridden_essential)
+            {
+                break;
+            }
+            is_dirichlet[i] = flag_value.first;
+            values[i] = flag_value.second;
+        }
+        return {std::move(is_dirichlet), std::move(values)};
+    }
+
     /*!
      * Computes the flux for the provided arguments (time, position, primary
      * variables at that position).
      *
      * \return a pair (is_natural, flux, flux_jacobian) indicating if a natural
      * BC shall be set at that position and (if so) the flux at that node and
-     * the derivative of the flux w.r.t. all primary variables.
+     * the derivative of the flux w.r.t. all primary variables. If the
+     * derivative is empty, it is approximated by finite differences.
      */
     virtual std::tuple<bool, double, std::vector<double>> getFlux(
         double /*t*/,
@@ -52,16 +94,61 @@ public:
             false, std::numeric_limits<double>::quiet_NaN(), {}};
     }
 
-    //! Tells if getDirichletBCValue() has been overridden in the derived class
-    //! in Python.
+    /*!
+     * Computes the fluxes for all integration points of the boundary at once
+     * (time, positions and primary variables at the integration points as the
+     * rows of NumPy arrays).
+     *
+     * The default implementation calls getFlux() for each integration point.
+     * Overriding this method avoids the overhead of a Python call per
+     * integration point.
+     *
+     * \return a tuple (is_natural, fluxes, flux_jacobians) of sequences with
+     * one entry per integration point, the latter being the derivatives of
+     * the flux w.r.t. all primary variables.
+     */
+    virtual std::tuple<std::vector<bool>, std::vector<double>,
+                       std::vector<std::vector<double>>>
+    getFluxes(double t, Eigen::MatrixXd const& coords,
+              Eigen::MatrixXd const& primary_variables) const
+    {
+        auto const num_points = static_cast<std::size_t>(coords.rows());
+        std::vector<bool> is_natural(num_points, false);
+        std::vector<double> fluxes(num_points,
+                                   std::numeric_limits<double>::quiet_NaN());
+        std::vector<std::vector<double>> flux_jacobians(num_points);
+        std::vector<double> point_primary_variables(primary_variables.cols());
+        for (std::size_t i = 0; i < num_points; ++i)
+        {
+            Eigen::VectorXd::Map(point_primary_variables.data(),
+                                 point_primary_variables.size()) =
+                primary_variables.row(i);
+            auto flag_flux_dFlux =
+                getFlux(t, {coords(i, 0), coords(i, 1), coords(i, 2)},
+                        point_primary_variables);
+            if (!_overridden_natural)
+            {
+                break;
+            }
+            is_natural[i] = std::get<0>(flag_flux_dFlux);
+            fluxes[i] = std::get<1>(flag_flux_dFlux);
+            flux_jacobians[i] = std::move(std::get<2>(flag_flux_dFlux));
+        }
+        return {std::move(is_natural), std::move(fluxes),
+                std::move(flux_jacobians)};
+    }
+
+    //! Tells if getDirichletBCValue() or getDirichletBCValues() has been
+    //! overridden in the derived class in Python.
     //!
-    //! \pre getDirichletBCValue() must already have been called
-    //! once.
+    //! \pre getDirichletBCValue() or getDirichletBCValues() must already have
+    //! been called once.
     bool isOverriddenEssential() const { return _overridden_essential; }
 
-    //! Tells if getFlux() has been overridden in the derived class in Python.
+    //! Tells if getFlux() or getFluxes() has been overridden in the derived
+    //! class in Python.
     //!
-    //! \pre getFlux() must already have been called once.
+    //! \pre getFlux() or getFluxes() must already have been called once.
     bool isOverriddenNatural() const { return _overridden_natural; }
 
     virtual ~PythonBoundaryConditionPythonSideInterface() = default;
@@ -87,9 +87,11 @@ void CentralDifferencesJacobianAssembler::assembleWithJacobian(
                 MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
             auto const local_M_m =
                 MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-            local_Jac.col(i).noalias() +=
-                // dM/dxi * x_dot
-                (local_M_p - local_M_m) * local_xdot / (2.0 * eps);
+            // dM/dxi * x_dot
+            // The difference quotient is written as two products in order to
+            // avoid a temporary matrix for the difference.
+            local_Jac.col(i).noalias() += (0.5 / eps) * local_M_p * local_xdot;
+            local_Jac.col(i).noalias() -= (0.5 / eps) * local_M_m * local_xdot;
             local_M_data.clear();
             _local_M_data.clear();
         }
@@ -98,9 +100,9 @@ void CentralDifferencesJacobianAssembler::assembleWithJacobian(
                 MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
             auto const local_K_m =
                 MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-            local_Jac.col(i).noalias() +=
-                // dK/dxi * x
-                (local_K_p - local_K_m) * local_x / (2.0 * eps);
+            // dK/dxi * x
+            local_Jac.col(i).noalias() += (0.5 / eps) * local_K_p * local_x;
+            local_Jac.col(i).noalias() -= (0.5 / eps) * local_K_m * local_x;
             local_K_data.clear();
             _local_K_data.clear();
         }
@@ -0,0 +1,258 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "Checkpoint.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <numeric>
+
+#ifdef USE_PETSC
+#include <mpi.h>
+#endif
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+#include "BaseLib/RunTime.h"
+#include "ChemistryLib/ChemicalSolverInterface.h"
+#include "MathLib/LinAlg/LinAlg.h"
+
+#include "ProcessData.h"
+
+namespace
+{
+constexpr std::uint64_t checkpoint_magic = 0x54504b4353474f;  // "OGSCKPT"
+constexpr std::uint32_t checkpoint_version = 1;
+
+std::string checkpointFileName(std::string const& file_name_base)
+{
+#ifdef USE_PETSC
+    int rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    return file_name_base + "_" + std::to_string(rank) + ".ckpt";
+#else
+    return file_name_base + ".ckpt";
+#endif
+}
+
+std::vector<GlobalIndexType> ownedIndices(GlobalVector const& x)
+{
+    std::vector<GlobalIndexType> indices(x.getRangeEnd() - x.getRangeBegin());
+    std::iota(indices.begin(), indices.end(), x.getRangeBegin());
+    return indices;
+}
+
+void writeSolution(std::ostream& os, GlobalVector const& x)
+{
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+    auto const indices = ownedIndices(x);
+    BaseLib::writeValueBinary(os, static_cast<std::int64_t>(x.getRangeBegin()));
+    BaseLib::writeVectorBinary(os, x.get(indices));
+}
+
+void readSolution(std::istream& is, GlobalVector& x)
+{
+    auto const range_begin = BaseLib::readBinaryValue<std::int64_t>(is);
+    std::vector<double> values;
+    BaseLib::readVectorBinary(is, values);
+
+    auto const indices = ownedIndices(x);
+    if (!is || range_begin != x.getRangeBegin() ||
+        values.size() != indices.size())
+    {
+        OGS_FATAL(
+            "The solution in the checkpoint does not match the solution "
+            "vector. The restart requires the same mesh and partitioning.");
+    }
+
+#ifdef USE_PETSC
+    x.set(indices, values);
+#else
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        x.set(indices[i], values[i]);
+    }
+#endif
+    MathLib::LinAlg::finalizeAssembly(x);
+}
+
+/// The state of a process shared by the sub-processes of a staggered scheme is
+/// stored once with its first sub-process.
+bool isFirstOccurrenceOfProcess(
+    std::vector<std::unique_ptr<ProcessLib::ProcessData>> const&
+        per_process_data,
+    ProcessLib::ProcessData const& process_data)
+{
+    auto const first = std::find_if(
+        per_process_data.begin(), per_process_data.end(),
+        [&process_data](auto const& pd) {
+            return &pd->process == &process_data.process;
+        });
+    return first->get() == &process_data;
+}
+}  // namespace
+
+namespace ProcessLib
+{
+std::unique_ptr<CheckpointConfig> createCheckpointConfig(
+    BaseLib::ConfigTree const& config, std::string const& output_directory)
+{
+    //! \ogs_file_param{prj__time_loop__checkpoint__prefix}
+    auto const prefix = config.getConfigParameter<std::string>("prefix");
+
+    auto const every_n_timesteps =
+        //! \ogs_file_param{prj__time_loop__checkpoint__every_n_timesteps}
+        config.getConfigParameter<int>("every_n_timesteps", 1);
+    if (every_n_timesteps < 0)
+    {
+        OGS_FATAL(
+            "The checkpoint frequency every_n_timesteps must not be negative, "
+            "got %d.",
+            every_n_timesteps);
+    }
+
+    auto const restart_from =
+        //! \ogs_file_param{prj__time_loop__checkpoint__restart_from}
+        config.getConfigParameter<std::string>("restart_from", "");
+
+    return std::make_unique<CheckpointConfig>(CheckpointConfig{
+        BaseLib::joinPaths(output_directory, prefix), every_n_timesteps,
+        restart_from.empty() ? restart_from
+                             : BaseLib::joinPaths(output_directory,
+                                                  restart_from)});
+}
+
+void writeCheckpoint(
+    std::string const& file_name_base, CheckpointTimeState const& time_state,
+    std::vector<std::unique_ptr<ProcessData>> const& per_process_data,
+    std::vector<GlobalVector*> const& process_solutions,
+    ChemistryLib::ChemicalSolverInterface const* chemical_system)
+{
+    BaseLib::RunTime time_checkpoint;
+    time_checkpoint.start();
+
+    auto const file_name = checkpointFileName(file_name_base);
+    DBUG("Writing checkpoint '%s'.", file_name.c_str());
+
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        OGS_FATAL("Could not open checkpoint file '%s' for writing.",
+                  file_name.c_str());
+    }
+
+    BaseLib::writeValueBinary(os, checkpoint_magic);
+    BaseLib::writeValueBinary(os, checkpoint_version);
+
+    BaseLib::writeValueBinary(os, time_state.t);
+    BaseLib::writeValueBinary(os, time_state.dt);
+    BaseLib::writeValueBinary(
+        os, static_cast<std::uint64_t>(time_state.accepted_steps));
+    BaseLib::writeValueBinary(
+        os, static_cast<std::uint64_t>(time_state.rejected_steps));
+
+    BaseLib::writeValueBinary(
+        os, static_cast<std::uint64_t>(per_process_data.size()));
+    for (auto const& process_data : per_process_data)
+    {
+        auto const process_id = process_data->process_id;
+        writeSolution(os, *process_solutions[process_id]);
+        process_data->timestepper->writeCheckpoint(os);
+        if (isFirstOccurrenceOfProcess(per_process_data, *process_data))
+        {
+            process_data->process.writeCheckpoint(os);
+        }
+    }
+
+    BaseLib::writeValueBinary(os, chemical_system != nullptr);
+    if (chemical_system != nullptr)
+    {
+        chemical_system->writeCheckpoint(os);
+    }
+
+    if (!os)
+    {
+        OGS_FATAL("Error while writing checkpoint file '%s'.",
+                  file_name.c_str());
+    }
+    INFO("[time] Writing checkpoint '%s' took %g s.", file_name.c_str(),
+         time_checkpoint.elapsed());
+}
+
+CheckpointTimeState readCheckpoint(
+    std::string const& file_name_base,
+    std::vector<std::unique_ptr<ProcessData>> const& per_process_data,
+    std::vector<GlobalVector*> const& process_solutions,
+    ChemistryLib::ChemicalSolverInterface* chemical_system)
+{
+    auto const file_name = checkpointFileName(file_name_base);
+    INFO("Restarting from checkpoint '%s'.", file_name.c_str());
+
+    std::ifstream is(file_name, std::ios::binary);
+    if (!is)
+    {
+        OGS_FATAL("Could not open checkpoint file '%s'.", file_name.c_str());
+    }
+
+    if (BaseLib::readBinaryValue<std::uint64_t>(is) != checkpoint_magic ||
+        BaseLib::readBinaryValue<std::uint32_t>(is) != checkpoint_version)
+    {
+        OGS_FATAL("The file '%s' is not a checkpoint of this OGS version.",
+                  file_name.c_str());
+    }
+
+    CheckpointTimeState time_state;
+    time_state.t = BaseLib::readBinaryValue<double>(is);
+    time_state.dt = BaseLib::readBinaryValue<double>(is);
+    time_state.accepted_steps = BaseLib::readBinaryValue<std::uint64_t>(is);
+    time_state.rejected_steps = BaseLib::readBinaryValue<std::uint64_t>(is);
+
+    if (BaseLib::readBinaryValue<std::uint64_t>(is) != per_process_data.size())
+    {
+        OGS_FATAL(
+            "The number of processes in the checkpoint '%s' differs from the "
+            "project file.",
+            file_name.c_str());
+    }
+    for (auto const& process_data : per_process_data)
+    {
+        auto const process_id = process_data->process_id;
+        readSolution(is, *process_solutions[process_id]);
+        process_data->timestepper->readCheckpoint(is);
+        if (isFirstOccurrenceOfProcess(per_process_data, *process_data))
+        {
+            process_data->process.readCheckpoint(is);
+        }
+    }
+
+    if (BaseLib::readBinaryValue<bool>(is) != (chemical_system != nullptr))
+    {
+        OGS_FATAL(
+            "The checkpoint '%s' and the project file differ in the use of a "
+            "chemical solver.",
+            file_name.c_str());
+    }
+    if (chemical_system != nullptr)
+    {
+        chemical_system->readCheckpoint(is);
+    }
+
+    if (!is)
+    {
+        OGS_FATAL("Error while reading checkpoint file '%s'.",
+                  file_name.c_str());
+    }
+    return time_state;
+}
+}  // namespace ProcessLib
@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace ChemistryLib
+{
+class ChemicalSolverInterface;
+}
+
+namespace ProcessLib
+{
+struct ProcessData;
+
+/// Settings for writing checkpoints and restarting from them.
+struct CheckpointConfig
+{
+    /// Path prefix of the checkpoint files including the output directory.
+    std::string prefix;
+    /// A checkpoint is written in every n-th accepted timestep.
+    int every_n_timesteps;
+    /// The checkpoint to restart from, without the rank suffix and
+    /// extension. Empty if the simulation is not restarted.
+    std::string restart_from;
+};
+
+std::unique_ptr<CheckpointConfig> createCheckpointConfig(
+    BaseLib::ConfigTree const& config, std::string const& output_directory);
+
+/// The time loop state stored in a checkpoint.
+struct CheckpointTimeState
+{
+    /// Time of the last accepted timestep.
+    double t;
+    /// Size of the next timestep.
+    double dt;
+    std::size_t accepted_steps;
+    std::size_t rejected_steps;
+};
+
+/// Writes a binary checkpoint containing the time loop state, the solutions,
+/// the time steppers', processes', and the chemical solver's states.
+///
+/// Each MPI rank writes its own file containing its part of the solutions.
+/// Therefore, a restart requires the same partitioning.
+void writeCheckpoint(
+    std::string const& file_name_base, CheckpointTimeState const& time_state,
+    std::vector<std::unique_ptr<ProcessData>> const& per_process_data,
+    std::vector<GlobalVector*> const& process_solutions,
+    ChemistryLib::ChemicalSolverInterface const* chemical_system);
+
+/// Restores the states written by writeCheckpoint(). The solution vectors
+/// must already have their final sizes.
+CheckpointTimeState readCheckpoint(
+    std::string const& file_name_base,
+    std::vector<std::unique_ptr<ProcessData>> const& per_process_data,
+    std::vector<GlobalVector*> const& process_solutions,
+    ChemistryLib::ChemicalSolverInterface* chemical_system);
+}  // namespace ProcessLib
@@ -185,54 +185,7 @@ public:
             &local_x[pressure_index], pressure_size);
 
         auto const number_of_components = num_nodal_dof - 1;
-        for (int component_id = 0; component_id < number_of_components;
-             ++component_id)
-        {
-            /*  Partitioned assembler matrix
-             *  |  pp | pc1 | pc2 | pc3 |
-             *  |-----|-----|-----|-----|
-             *  | c1p | c1c1|  0  |  0  |
-             *  |-----|-----|-----|-----|
-             *  | c2p |  0  | c2c2|  0  |
-             *  |-----|-----|-----|-----|
-             *  | c3p |  0  |  0  | c3c3|
-             */
-            auto concentration_index =
-                pressure_size + component_id * concentration_size;
-
-            auto KCC =
-                local_K.template block<concentration_size, concentration_size>(
-                    concentration_index, concentration_index);
-            auto MCC =
-                local_M.template block<concentration_size, concentration_size>(
-                    concentration_index, concentration_index);
-            auto MCp =
-                local_M.template block<concentration_size, pressure_size>(
-                    concentration_index, pressure_index);
-            auto MpC =
-                local_M.template block<pressure_size, concentration_size>(
-                    pressure_index, concentration_index);
-
-            auto local_C = Eigen::Map<const NodalVectorType>(
-                &local_x[concentration_index], concentration_size);
-
-            assembleBlockMatrices(component_id, t, dt, local_C, local_p, KCC,
-                                  MCC, MCp, MpC, Kpp, Mpp, Bp);
-        }
-    }
 
-    void assembleBlockMatrices(
-        int const component_id, double const t, double const dt,
-        Eigen::Ref<const NodalVectorType> const& C_nodal_values,
-        Eigen::Ref<const NodalVectorType> const& p_nodal_values,
-        Eigen::Ref<LocalBlockMatrixType> KCC,
-        Eigen::Ref<LocalBlockMatrixType> MCC,
-        Eigen::Ref<LocalBlockMatrixType> MCp,
-        Eigen::Ref<LocalBlockMatrixType> MpC,
-        Eigen::Ref<LocalBlockMatrixType> Kpp,
-        Eigen::Ref<LocalBlockMatrixType> Mpp,
-        Eigen::Ref<LocalSegmentVectorType> Bp)
-    {
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
@@ -255,9 +208,24 @@ public:
         // Assume that the component name is the same as the process variable
         // name. Components are shifted by one because the first one is always
         // pressure.
-        auto const& component = phase.component(
-            _transport_process_variables[component_id].get().getName());
+        std::vector<MaterialPropertyLib::Component const*> components;
+        components.reserve(number_of_components);
+        for (auto const& process_variable : _transport_process_variables)
+        {
+            components.push_back(
+                &phase.component(process_variable.get().getName()));
+        }
 
+        auto const& solute_dispersivity_transverse = medium.template value<
+            double>(
+            MaterialPropertyLib::PropertyType::transversal_dispersivity);
+
+        auto const& solute_dispersivity_longitudinal =
+            medium.template value<double>(
+                MaterialPropertyLib::PropertyType::longitudinal_dispersivity);
+
+        // The component independent quantities are computed once per
+        // integration point and shared by all components.
         for (unsigned ip(0); ip < n_integration_points; ++ip)
         {
             pos.setIntegrationPoint(ip);
@@ -267,131 +235,192 @@ public:
             auto const& dNdx = ip_data.dNdx;
             auto const& w = ip_data.integration_weight;
 
-            double C_int_pt = 0.0;
             double p_int_pt = 0.0;
-
-            NumLib::shapeFunctionInterpolate(C_nodal_values, N, C_int_pt);
-            NumLib::shapeFunctionInterpolate(p_nodal_values, N, p_int_pt);
-
-            vars[static_cast<int>(
-                MaterialPropertyLib::Variable::concentration)] = C_int_pt;
+            NumLib::shapeFunctionInterpolate(local_p, N, p_int_pt);
             vars[static_cast<int>(
                 MaterialPropertyLib::Variable::phase_pressure)] = p_int_pt;
 
-            // porosity model
-            auto const porosity =
-                medium.property(MaterialPropertyLib::PropertyType::porosity)
-                    .template value<double>(vars, pos, t, dt);
-
-            auto const& retardation_factor =
-                component
-                    .property(
-                        MaterialPropertyLib::PropertyType::retardation_factor)
-                    .template value<double>(vars, pos, t, dt);
-
-            auto const& solute_dispersivity_transverse = medium.template value<
-                double>(
-                MaterialPropertyLib::PropertyType::transversal_dispersivity);
-
-            auto const& solute_dispersivity_longitudinal =
-                medium.template value<double>(
-                    MaterialPropertyLib::PropertyType::
-                        longitudinal_dispersivity);
+            auto const N_t_N = (N.transpose() * N).eval();
 
-            // Use the fluid density model to compute the density
-            // TODO (renchao): concentration of which component as the argument
-            // for calculation of fluid density
-            auto const density =
-                phase.property(MaterialPropertyLib::PropertyType::density)
-                    .template value<double>(vars, pos, t, dt);
+            // The medium and fluid properties depend on the component only
+            // through its concentration. They are evaluated again only if the
+            // concentration differs from the one of the previous component.
+            double porosity = 0.0;
+            double density = 0.0;
+            double drho_dp = 0.0;
+            double drho_dC = 0.0;
+            GlobalDimMatrixType K_over_mu;
+            GlobalDimVectorType velocity;
+            double last_C_int_pt = std::numeric_limits<double>::quiet_NaN();
+
+            for (int component_id = 0; component_id < number_of_components;
+                 ++component_id)
+            {
+                /*  Partitioned assembler matrix
+                 *  |  pp | pc1 | pc2 | pc3 |
+                 *  |-----|-----|-----|-----|
+                 *  | c1p | c1c1|  0  |  0  |
+                 *  |-----|-----|-----|-----|
+                 *  | c2p |  0  | c2c2|  0  |
+                 *  |-----|-----|-----|-----|
+                 *  | c3p |  0  |  0  | c3c3|
+                 */
+                auto concentration_index =
+                    pressure_size + component_id * concentration_size;
+
+                auto KCC = local_K.template block<concentration_size,
+                                                  concentration_size>(
+                    concentration_index, concentration_index);
+                auto MCC = local_M.template block<concentration_size,
+                                                  concentration_size>(
+                    concentration_index, concentration_index);
+                auto MCp =
+                    local_M.template block<concentration_size, pressure_size>(
+                        concentration_index, pressure_index);
+                auto MpC =
+                    local_M.template block<pressure_size, concentration_size>(
+                        pressure_index, concentration_index);
+
+                auto local_C = Eigen::Map<const NodalVectorType>(
+                    &local_x[concentration_index], concentration_size);
+
+                double C_int_pt = 0.0;
+                NumLib::shapeFunctionInterpolate(local_C, N, C_int_pt);
+                vars[static_cast<int>(
+                    MaterialPropertyLib::Variable::concentration)] = C_int_pt;
+
+                if (component_id == 0 || C_int_pt != last_C_int_pt)
+                {
+                    last_C_int_pt = C_int_pt;
+
+                    // porosity model
+                    porosity =
+                        medium
+                            .property(
+                                MaterialPropertyLib::PropertyType::porosity)
+                            .template value<double>(vars, pos, t, dt);
+
+                    // Use the fluid density model to compute the density
+                    // TODO (renchao): concentration of which component as the
+                    // argument for calculation of fluid density
+                    density =
+                        phase
+                            .property(
+                                MaterialPropertyLib::PropertyType::density)
+                            .template value<double>(vars, pos, t, dt);
+
+                    auto const& K =
+                        MaterialPropertyLib::formEigenTensor<GlobalDim>(
+                            medium
+                                .property(MaterialPropertyLib::PropertyType::
+                                              permeability)
+                                .value(vars, pos, t, dt));
+
+                    // Use the viscosity model to compute the viscosity
+                    auto const mu =
+                        phase
+                            .property(
+                                MaterialPropertyLib::PropertyType::viscosity)
+                            .template value<double>(vars, pos, t, dt);
+
+                    K_over_mu = K / mu;
+                    velocity =
+                        _process_data.has_gravity
+                            ? GlobalDimVectorType(
+                                  -K_over_mu * (dNdx * local_p - density * b))
+                            : GlobalDimVectorType(-K_over_mu * dNdx * local_p);
+
+                    drho_dp =
+                        phase
+                            .property(
+                                MaterialPropertyLib::PropertyType::density)
+                            .template dValue<double>(
+                                vars,
+                                MaterialPropertyLib::Variable::phase_pressure,
+                                pos, t, dt);
+
+                    drho_dC =
+                        phase
+                            .property(
+                                MaterialPropertyLib::PropertyType::density)
+                            .template dValue<double>(
+                                vars,
+                                MaterialPropertyLib::Variable::concentration,
+                                pos, t, dt);
+                }
 
-            auto const decay_rate =
-                component
-                    .property(MaterialPropertyLib::PropertyType::decay_rate)
-                    .template value<double>(vars, pos, t, dt);
+                auto const& component = *components[component_id];
 
-            auto const& molecular_diffusion_coefficient =
-                MaterialPropertyLib::formEigenTensor<GlobalDim>(
+                auto const& retardation_factor =
                     component
                         .property(MaterialPropertyLib::PropertyType::
-                                      molecular_diffusion)
-                        .value(vars, pos, t, dt));
-
-            auto const& K = MaterialPropertyLib::formEigenTensor<GlobalDim>(
-                medium.property(MaterialPropertyLib::PropertyType::permeability)
-                    .value(vars, pos, t, dt));
-
-            // Use the viscosity model to compute the viscosity
-            auto const mu =
-                phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars, pos, t, dt);
-
-            GlobalDimMatrixType const K_over_mu = K / mu;
-            GlobalDimVectorType const velocity =
-                _process_data.has_gravity
-                    ? GlobalDimVectorType(-K_over_mu *
-                                          (dNdx * p_nodal_values - density * b))
-                    : GlobalDimVectorType(-K_over_mu * dNdx * p_nodal_values);
-
-            const double drho_dp =
-                phase.property(MaterialPropertyLib::PropertyType::density)
-                    .template dValue<double>(
-                        vars, MaterialPropertyLib::Variable::phase_pressure,
-                        pos, t, dt);
+                                      retardation_factor)
+                        .template value<double>(vars, pos, t, dt);
 
-            const double drho_dC =
-                phase.property(MaterialPropertyLib::PropertyType::density)
-                    .template dValue<double>(
-                        vars, MaterialPropertyLib::Variable::concentration, pos,
-                        t, dt);
+                auto const decay_rate =
+                    component
+                        .property(MaterialPropertyLib::PropertyType::decay_rate)
+                        .template value<double>(vars, pos, t, dt);
 
-            double const velocity_magnitude = velocity.norm();
-            GlobalDimMatrixType const hydrodynamic_dispersion =
-                velocity_magnitude != 0.0
-                    ? GlobalDimMatrixType(porosity *
-                                              molecular_diffusion_coefficient +
-                                          solute_dispersivity_transverse *
-                                              velocity_magnitude * I +
-                                          (solute_dispersivity_longitudinal -
-                                           solute_dispersivity_transverse) /
-                                              velocity_magnitude * velocity *
-                                              velocity.transpose())
-                    : GlobalDimMatrixType(porosity *
-                                              molecular_diffusion_coefficient +
-                                          solute_dispersivity_transverse *
-                                              velocity_magnitude * I);
-            const double R_times_phi(retardation_factor * porosity);
-            GlobalDimVectorType const mass_density_flow = velocity * density;
-            auto const N_t_N = (N.transpose() * N).eval();
-            if (_process_data.non_advective_form)
-            {
-                MCp.noalias() += N_t_N * (C_int_pt * R_times_phi * drho_dp * w);
-                MCC.noalias() += N_t_N * (C_int_pt * R_times_phi * drho_dC * w);
-                KCC.noalias() -= dNdx.transpose() * mass_density_flow * N * w;
-            }
-            else
-            {
+                auto const& molecular_diffusion_coefficient =
+                    MaterialPropertyLib::formEigenTensor<GlobalDim>(
+                        component
+                            .property(MaterialPropertyLib::PropertyType::
+                                          molecular_diffusion)
+                            .value(vars, pos, t, dt));
+
+                double const velocity_magnitude = velocity.norm();
+                GlobalDimMatrixType const hydrodynamic_dispersion =
+                    velocity_magnitude != 0.0
+                        ? GlobalDimMatrixType(
+                              porosity * molecular_diffusion_coefficient +
+                              solute_dispersivity_transverse *
+                                  velocity_magnitude * I +
+                              (solute_dispersivity_longitudinal -
+                               solute_dispersivity_transverse) /
+                                  velocity_magnitude * velocity *
+                                  velocity.transpose())
+                        : GlobalDimMatrixType(
+                              porosity * molecular_diffusion_coefficient +
+                              solute_dispersivity_transverse *
+                                  velocity_magnitude * I);
+                const double R_times_phi(retardation_factor * porosity);
+                GlobalDimVectorType const mass_density_flow =
+                    velocity * density;
+                if (_process_data.non_advective_form)
+                {
+                    MCp.noalias() +=
+                        N_t_N * (C_int_pt * R_times_phi * drho_dp * w);
+                    MCC.noalias() +=
+                        N_t_N * (C_int_pt * R_times_phi * drho_dC * w);
+                    KCC.noalias() -=
+                        dNdx.transpose() * mass_density_flow * N * w;
+                }
+                else
+                {
+                    KCC.noalias() += N.transpose() *
+                                     mass_density_flow.transpose() * dNdx * w;
+                }
+                MCC.noalias() += N_t_N * (R_times_phi * density * w);
                 KCC.noalias() +=
-                    N.transpose() * mass_density_flow.transpose() * dNdx * w;
-            }
-            MCC.noalias() += N_t_N * (R_times_phi * density * w);
-            KCC.noalias() += dNdx.transpose() * hydrodynamic_dispersion * dNdx *
-                                 (density * w) +
-                             N_t_N * (decay_rate * R_times_phi * density * w);
-
-            MpC.noalias() += N_t_N * (porosity * drho_dC * w);
+                    dNdx.transpose() * hydrodynamic_dispersion * dNdx *
+                        (density * w) +
+                    N_t_N * (decay_rate * R_times_phi * density * w);
 
-            // Calculate Mpp, Kpp, and bp in the first loop over components
-            if (component_id == 0)
-            {
-                Mpp.noalias() += N_t_N * (porosity * drho_dp * w);
-                Kpp.noalias() +=
-                    dNdx.transpose() * K_over_mu * dNdx * (density * w);
+                MpC.noalias() += N_t_N * (porosity * drho_dC * w);
 
-                if (_process_data.has_gravity)
+                // Calculate Mpp, Kpp, and bp for the first component
+                if (component_id == 0)
                 {
-                    Bp.noalias() += dNdx.transpose() * K_over_mu * b *
-                                    (density * density * w);
+                    Mpp.noalias() += N_t_N * (porosity * drho_dp * w);
+                    Kpp.noalias() +=
+                        dNdx.transpose() * K_over_mu * dNdx * (density * w);
+
+                    if (_process_data.has_gravity)
+                    {
+                        Bp.noalias() += dNdx.transpose() * K_over_mu * b *
+                                        (density * density * w);
+                    }
                 }
             }
         }
@@ -110,10 +110,9 @@ void ComponentTransportProcess::assembleConcreteProcess(
             [&]() { return std::ref(*_local_to_global_index_map); });
     }
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot, process_id, M, K,
-        b, _coupled_solutions);
+    executeGlobalAssembly(&VectorMatrixAssembler::assemble, _local_assemblers,
+                          pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot,
+                          process_id, M, K, b, _coupled_solutions);
 }
 
 void ComponentTransportProcess::setCoupledSolutionsOfPreviousTimeStep()
@@ -141,10 +140,10 @@ void ComponentTransportProcess::assembleWithJacobianConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
-        dxdot_dx, dx_dx, process_id, M, K, b, Jac, _coupled_solutions);
+    executeGlobalAssembly(
+        &VectorMatrixAssembler::assembleWithJacobian, _local_assemblers,
+        pv.getActiveElementIDs(), dof_table, t, dt, x, xdot, dxdot_dx, dx_dx,
+        process_id, M, K, b, Jac, _coupled_solutions);
 }
 
 Eigen::Vector3d ComponentTransportProcess::getFlux(
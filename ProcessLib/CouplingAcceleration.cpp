@@ -0,0 +1,294 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CouplingAcceleration.h"
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/DOF/GlobalMatrixProviders.h"
+
+namespace
+{
+std::vector<GlobalVector*> getVectors(std::vector<GlobalVector*> const& x)
+{
+    std::vector<GlobalVector*> vectors;
+    vectors.reserve(x.size());
+    for (auto const* x_i : x)
+    {
+        vectors.push_back(
+            &NumLib::GlobalVectorProvider::provider.getVector(*x_i));
+    }
+    return vectors;
+}
+
+void releaseVectors(std::vector<GlobalVector*>& vectors)
+{
+    for (auto* v : vectors)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*v);
+    }
+    vectors.clear();
+}
+
+/// Inner product of two stacked vectors.
+double dot(std::vector<GlobalVector*> const& x,
+           std::vector<GlobalVector*> const& y)
+{
+    double result = 0;
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        result += MathLib::LinAlg::dot(*x[i], *y[i]);
+    }
+    return result;
+}
+}  // namespace
+
+namespace ProcessLib
+{
+CouplingAcceleration::CouplingAcceleration(double const initial_relaxation)
+    : _initial_relaxation(initial_relaxation)
+{
+}
+
+CouplingAcceleration::~CouplingAcceleration()
+{
+    releaseVectors(_minus_residuals);
+}
+
+void CouplingAcceleration::computeResiduals(
+    std::vector<GlobalVector*> const& x_in, std::vector<GlobalVector*> const& x)
+{
+    if (_minus_residuals.empty())
+    {
+        _minus_residuals = getVectors(x);
+    }
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        MathLib::LinAlg::copy(*x_in[i], *_minus_residuals[i]);
+        MathLib::LinAlg::axpy(*_minus_residuals[i], -1, *x[i]);
+    }
+}
+
+void CouplingAcceleration::relax(double const omega,
+                                 std::vector<GlobalVector*> const& x_in,
+                                 std::vector<GlobalVector*> const& x) const
+{
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        MathLib::LinAlg::axpy(*x_in[i], -omega, *_minus_residuals[i]);
+        MathLib::LinAlg::copy(*x_in[i], *x[i]);
+    }
+}
+
+AitkenRelaxation::~AitkenRelaxation()
+{
+    releaseVectors(_previous_minus_residuals);
+}
+
+void AitkenRelaxation::accelerate(std::vector<GlobalVector*> const& x_in,
+                                  std::vector<GlobalVector*> const& x)
+{
+    double const norm_squared = dot(_minus_residuals, _minus_residuals);
+    if (!_has_previous_residual)
+    {
+        _omega = _initial_relaxation;
+    }
+    else
+    {
+        // The signs of the negative residuals cancel.
+        double const cross = dot(_previous_minus_residuals, _minus_residuals);
+        double const numerator = cross - _previous_residual_norm_squared;
+        double const denominator =
+            norm_squared - 2 * cross + _previous_residual_norm_squared;
+        if (denominator > 0)
+        {
+            _omega = -_omega * numerator / denominator;
+        }
+    }
+    DBUG("Aitken relaxation factor of the coupling iteration: %g.", _omega);
+
+    relax(_omega, x_in, x);
+
+    if (_previous_minus_residuals.empty())
+    {
+        _previous_minus_residuals = getVectors(x);
+    }
+    std::swap(_minus_residuals, _previous_minus_residuals);
+    _previous_residual_norm_squared = norm_squared;
+    _has_previous_residual = true;
+}
+
+InterfaceQuasiNewton::InterfaceQuasiNewton(double const initial_relaxation,
+                                           int const max_columns)
+    : CouplingAcceleration(initial_relaxation), _max_columns(max_columns)
+{
+}
+
+InterfaceQuasiNewton::~InterfaceQuasiNewton()
+{
+    reset();
+    for (auto& vectors : _unused)
+    {
+        releaseVectors(vectors);
+    }
+}
+
+void InterfaceQuasiNewton::reset()
+{
+    auto recycle = [this](std::vector<GlobalVector*>& vectors) {
+        if (!vectors.empty())
+        {
+            _unused.push_back(std::move(vectors));
+            vectors.clear();
+        }
+    };
+    recycle(_previous_minus_residuals);
+    recycle(_previous_solutions);
+    for (auto& column : _delta_minus_residuals)
+    {
+        recycle(column);
+    }
+    for (auto& column : _delta_solutions)
+    {
+        recycle(column);
+    }
+    _delta_minus_residuals.clear();
+    _delta_solutions.clear();
+    _has_previous_iteration = false;
+}
+
+std::vector<GlobalVector*> InterfaceQuasiNewton::getUnusedVectors(
+    std::vector<GlobalVector*> const& x)
+{
+    if (_unused.empty())
+    {
+        return getVectors(x);
+    }
+    auto vectors = std::move(_unused.back());
+    _unused.pop_back();
+    return vectors;
+}
+
+void InterfaceQuasiNewton::accelerate(std::vector<GlobalVector*> const& x_in,
+                                      std::vector<GlobalVector*> const& x)
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    if (_has_previous_iteration)
+    {
+        if (_delta_minus_residuals.size() == _max_columns)
+        {
+            _unused.push_back(std::move(_delta_minus_residuals.back()));
+            _unused.push_back(std::move(_delta_solutions.back()));
+            _delta_minus_residuals.pop_back();
+            _delta_solutions.pop_back();
+        }
+        // The differences overwrite the values of the previous iteration.
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            LinAlg::aypx(*_previous_minus_residuals[i], -1,
+                         *_minus_residuals[i]);
+            LinAlg::aypx(*_previous_solutions[i], -1, *x[i]);
+        }
+        _delta_minus_residuals.push_front(std::move(_previous_minus_residuals));
+        _delta_solutions.push_front(std::move(_previous_solutions));
+    }
+
+    _previous_solutions = getUnusedVectors(x);
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        LinAlg::copy(*x[i], *_previous_solutions[i]);
+    }
+
+    auto const n = static_cast<int>(_delta_minus_residuals.size());
+    if (n == 0)
+    {
+        relax(_initial_relaxation, x_in, x);
+    }
+    else
+    {
+        // Minimizes |V c + (x_in - x)| for the differences V of the negative
+        // residuals by the normal equations, which is sufficient for the few
+        // columns, and combines x + W c with the differences W of the
+        // solutions.
+        Eigen::MatrixXd G(n, n);
+        Eigen::VectorXd b(n);
+        for (int i = 0; i < n; ++i)
+        {
+            b[i] = -dot(_delta_minus_residuals[i], _minus_residuals);
+            for (int j = 0; j <= i; ++j)
+            {
+                G(i, j) = G(j, i) = dot(_delta_minus_residuals[i],
+                                        _delta_minus_residuals[j]);
+            }
+        }
+        Eigen::VectorXd const c = G.completeOrthogonalDecomposition().solve(b);
+        for (std::size_t p = 0; p < x.size(); ++p)
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                LinAlg::axpy(*x[p], c[i], *_delta_solutions[i][p]);
+            }
+            LinAlg::copy(*x[p], *x_in[p]);
+        }
+        DBUG("IQN-ILS coupling iteration with %d previous iterations.", n);
+    }
+
+    _previous_minus_residuals = std::move(_minus_residuals);
+    _minus_residuals = getUnusedVectors(x);
+    _has_previous_iteration = true;
+}
+
+std::unique_ptr<CouplingAcceleration> createCouplingAcceleration(
+    BaseLib::ConfigTree const& config)
+{
+    //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__type}
+    auto const type = config.getConfigParameter<std::string>("type");
+    auto const initial_relaxation =
+        //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__initial_relaxation}
+        config.getConfigParameter<double>("initial_relaxation", 0.5);
+    if (!(initial_relaxation > 0 && initial_relaxation <= 1))
+    {
+        OGS_FATAL(
+            "The initial relaxation factor of the coupling acceleration must "
+            "be in (0, 1], got %g.",
+            initial_relaxation);
+    }
+
+    if (type == "Aitken")
+    {
+        return std::make_unique<AitkenRelaxation>(initial_relaxation);
+    }
+    if (type == "IQN-ILS")
+    {
+        auto const max_columns =
+            //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__max_columns}
+            config.getConfigParameter<int>("max_columns", 10);
+        if (max_columns < 1)
+        {
+            OGS_FATAL(
+                "The maximum number of columns of IQN-ILS must be at least 1, "
+                "got %d.",
+                max_columns);
+        }
+        return std::make_unique<InterfaceQuasiNewton>(initial_relaxation,
+                                                      max_columns);
+    }
+    OGS_FATAL(
+        "Unknown coupling acceleration type '%s'. Possible values are "
+        "'Aitken' and 'IQN-ILS'.",
+        type.c_str());
+}
+}  // namespace ProcessLib
@@ -0,0 +1,146 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace ProcessLib
+{
+/// Accelerates the staggered coupling iterations of several processes.
+///
+/// One coupling iteration maps the solutions \f$x_k\f$ of all processes at its
+/// beginning to the solutions \f$\tilde x_k\f$ computed in it. Instead of
+/// \f$\tilde x_k\f$, the next coupling iteration starts from a combination of
+/// the current and previous iterates, which reduces the coupling residual
+/// \f$r_k = \tilde x_k - x_k\f$ faster.
+///
+/// The solutions of all processes are treated as one stacked vector, i.e. the
+/// inner products are summed over the processes. The vectors are owned by the
+/// GlobalVectorProvider; the history is kept by rotating pointers instead of
+/// copying vectors.
+class CouplingAcceleration
+{
+public:
+    /// \param initial_relaxation the relaxation factor of the first coupling
+    /// iteration of each time step.
+    explicit CouplingAcceleration(double const initial_relaxation);
+
+    virtual ~CouplingAcceleration();
+
+    CouplingAcceleration(CouplingAcceleration const&) = delete;
+    CouplingAcceleration& operator=(CouplingAcceleration const&) = delete;
+
+    /// Discards the previous iterations at the beginning of a time step.
+    virtual void reset() = 0;
+
+    /// Computes the negative coupling residuals \c x_in - \c x of all
+    /// processes, where \c x_in are the solutions at the beginning of the
+    /// coupling iteration and \c x the solutions computed in it.
+    void computeResiduals(std::vector<GlobalVector*> const& x_in,
+                          std::vector<GlobalVector*> const& x);
+
+    /// The negative coupling residual of the given process computed by the
+    /// last call of computeResiduals().
+    GlobalVector const& getMinusResidual(int const process_id) const
+    {
+        return *_minus_residuals[process_id];
+    }
+
+    /// Overwrites both \c x_in and \c x by the solutions the next coupling
+    /// iteration starts from. Requires computeResiduals() to be called for
+    /// the same vectors before.
+    virtual void accelerate(std::vector<GlobalVector*> const& x_in,
+                            std::vector<GlobalVector*> const& x) = 0;
+
+protected:
+    /// Sets \f$x_{in} := x_{in} + \omega r\f$ and copies it to \c x.
+    void relax(double const omega, std::vector<GlobalVector*> const& x_in,
+               std::vector<GlobalVector*> const& x) const;
+
+    double const _initial_relaxation;
+    std::vector<GlobalVector*> _minus_residuals;
+};
+
+/// Aitken's dynamic relaxation (Irons and Tuck, 1969). The relaxation factor
+/// is updated in each coupling iteration by
+/// \f$\omega_k = -\omega_{k-1} r_{k-1}^T (r_k - r_{k-1}) /
+/// \|r_k - r_{k-1}\|^2\f$.
+class AitkenRelaxation final : public CouplingAcceleration
+{
+public:
+    using CouplingAcceleration::CouplingAcceleration;
+
+    ~AitkenRelaxation() override;
+
+    void reset() override { _has_previous_residual = false; }
+
+    void accelerate(std::vector<GlobalVector*> const& x_in,
+                    std::vector<GlobalVector*> const& x) override;
+
+    double getRelaxation() const { return _omega; }
+
+private:
+    double _omega = 0;
+    bool _has_previous_residual = false;
+    std::vector<GlobalVector*> _previous_minus_residuals;
+    double _previous_residual_norm_squared = 0;
+};
+
+/// The interface quasi-Newton method with an approximation of the inverse
+/// Jacobian from a least-squares model (IQN-ILS, Degroote et al., 2009). The
+/// Jacobian of the residual is approximated from the differences of the
+/// residuals and of the computed solutions of the previous coupling iterations
+/// of the time step.
+class InterfaceQuasiNewton final : public CouplingAcceleration
+{
+public:
+    /// \param max_columns the maximum number of previous coupling iterations
+    /// used; the oldest one is discarded if exceeded.
+    InterfaceQuasiNewton(double const initial_relaxation,
+                         int const max_columns);
+
+    ~InterfaceQuasiNewton() override;
+
+    void reset() override;
+
+    void accelerate(std::vector<GlobalVector*> const& x_in,
+                    std::vector<GlobalVector*> const& x) override;
+
+private:
+    std::vector<GlobalVector*> getUnusedVectors(
+        std::vector<GlobalVector*> const& x);
+
+    std::size_t const _max_columns;
+    bool _has_previous_iteration = false;
+    std::vector<GlobalVector*> _previous_minus_residuals;
+    std::vector<GlobalVector*> _previous_solutions;
+    /// Differences of the negative residuals and of the computed solutions of
+    /// subsequent coupling iterations, the newest first.
+    std::deque<std::vector<GlobalVector*>> _delta_minus_residuals;
+    std::deque<std::vector<GlobalVector*>> _delta_solutions;
+    /// Stacked vectors of discarded columns for reuse.
+    std::vector<std::vector<GlobalVector*>> _unused;
+};
+
+/// Creates the coupling acceleration from the configuration of the global
+/// process coupling.
+std::unique_ptr<CouplingAcceleration> createCouplingAcceleration(
+    BaseLib::ConfigTree const& config);
+}  // namespace ProcessLib
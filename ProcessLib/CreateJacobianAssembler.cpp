@@ -14,6 +14,7 @@
 #include "AnalyticalJacobianAssembler.h"
 #include "CentralDifferencesJacobianAssembler.h"
 #include "CompareJacobiansJacobianAssembler.h"
+#include "ForwardDifferencesJacobianAssembler.h"
 
 namespace ProcessLib
 {
@@ -36,6 +37,10 @@ std::unique_ptr<AbstractJacobianAssembler> createJacobianAssembler(
     {
         return createCentralDifferencesJacobianAssembler(*config);
     }
+    if (type == "ForwardDifferences")
+    {
+        return createForwardDifferencesJacobianAssembler(*config);
+    }
     if (type == "CompareJacobians")
     {
         return createCompareJacobiansJacobianAssembler(*config);
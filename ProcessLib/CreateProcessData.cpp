@@ -97,6 +97,87 @@ std::vector<std::unique_ptr<ProcessData>> createPerProcessData(
             pcs_config.getConfigParameter<bool>(
                 "compensate_non_equilibrium_initial_residuum", false);
 
+        auto const number_of_subcycles =
+            //! \ogs_file_param{prj__time_loop__processes__process__subcycles}
+            pcs_config.getConfigParameter<int>("subcycles", 1);
+        if (number_of_subcycles < 1)
+        {
+            OGS_FATAL(
+                "The number of subcycles of the process '%s' must be positive, "
+                "but %d was given.",
+                pcs_name.c_str(), number_of_subcycles);
+        }
+        // The state of the time discretization is reset to the beginning of
+        // the time step by NumLib::TimeDiscretization::setInitialState(),
+        // which only suffices for one-step schemes.
+        if (number_of_subcycles > 1 &&
+            dynamic_cast<NumLib::BackwardEuler*>(time_disc.get()) == nullptr)
+        {
+            OGS_FATAL(
+                "Subcycles of the process '%s' are only implemented for the "
+                "BackwardEuler time discretization.",
+                pcs_name.c_str());
+        }
+
+        auto predictor = createSolutionPredictor(
+            //! \ogs_file_param{prj__time_loop__processes__process__predictor}
+            pcs_config.getConfigParameter<std::string>("predictor", "none"));
+
+        std::unique_ptr<ReducedOrderModelSnapshots>
+            reduced_order_model_snapshots;
+        if (auto const rom_config =
+                //! \ogs_file_param{prj__time_loop__processes__process__reduced_order_model}
+                pcs_config.getConfigSubtreeOptional("reduced_order_model"))
+        {
+            auto const mode =
+                //! \ogs_file_param{prj__time_loop__processes__process__reduced_order_model__mode}
+                rom_config->getConfigParameter<std::string>("mode");
+            auto const basis_file =
+                //! \ogs_file_param{prj__time_loop__processes__process__reduced_order_model__basis_file}
+                rom_config->getConfigParameter<std::string>("basis_file");
+            if (mode == "offline")
+            {
+                auto const energy_fraction =
+                    //! \ogs_file_param{prj__time_loop__processes__process__reduced_order_model__energy_fraction}
+                    rom_config->getConfigParameter<double>("energy_fraction",
+                                                           0.99999);
+                if (!(energy_fraction > 0 && energy_fraction <= 1))
+                {
+                    OGS_FATAL(
+                        "The energy fraction of the POD basis must be in (0, "
+                        "1], got %g.",
+                        energy_fraction);
+                }
+                reduced_order_model_snapshots =
+                    std::make_unique<ReducedOrderModelSnapshots>(
+                        ReducedOrderModelSnapshots{basis_file, energy_fraction,
+                                                   {}});
+            }
+            else if (mode == "online")
+            {
+                auto* picard =
+                    dynamic_cast<NumLib::NonlinearSolver<
+                        NumLib::NonlinearSolverTag::Picard>*>(&nl_slv);
+                if (picard == nullptr)
+                {
+                    OGS_FATAL(
+                        "The online mode of the reduced order model of the "
+                        "process '%s' requires the Picard nonlinear solver.",
+                        pcs_name.c_str());
+                }
+                picard->setReducedBasis(
+                    process_id, std::make_shared<NumLib::ReducedBasis const>(
+                                    NumLib::readReducedBasis(basis_file)));
+            }
+            else
+            {
+                OGS_FATAL(
+                    "Unknown reduced order model mode '%s'. Possible values "
+                    "are 'offline' and 'online'.",
+                    mode.c_str());
+            }
+        }
+
         //! \ogs_file_param{prj__time_loop__processes__process__output}
         auto output = pcs_config.getConfigSubtreeOptional("output");
         if (output)
@@ -115,6 +196,10 @@ std::vector<std::unique_ptr<ProcessData>> createPerProcessData(
             makeProcessData(std::move(timestepper), nl_slv, process_id, pcs,
                             std::move(time_disc), std::move(conv_crit),
                             compensate_non_equilibrium_initial_residuum));
+        per_process_data.back()->number_of_subcycles = number_of_subcycles;
+        per_process_data.back()->predictor = std::move(predictor);
+        per_process_data.back()->reduced_order_model_snapshots =
+            std::move(reduced_order_model_snapshots);
         ++process_id;
     }
 
@@ -10,13 +10,55 @@
 
 #include "CreateTimeLoop.h"
 
+#include <set>
+
 #include "BaseLib/ConfigTree.h"
+#include "ProcessLib/Checkpoint.h"
+#include "ProcessLib/CouplingAcceleration.h"
 #include "ProcessLib/CreateProcessData.h"
 #include "ProcessLib/Output/CreateOutput.h"
 #include "ProcessLib/Output/Output.h"
 
 #include "TimeLoop.h"
 
+namespace
+{
+/// The processes solved concurrently must be uncoupled and must not share
+/// their solvers.
+void checkConcurrentProcesses(
+    std::vector<std::unique_ptr<ProcessLib::ProcessData>> const&
+        per_process_data)
+{
+#ifdef USE_PETSC
+    OGS_FATAL("The concurrent processes are not supported in parallel runs.");
+#endif
+    if (!per_process_data[0]->process.isMonolithicSchemeUsed())
+    {
+        OGS_FATAL(
+            "The concurrent processes are not possible with the staggered "
+            "scheme because the processes are coupled.");
+    }
+
+    std::set<NumLib::NonlinearSolverBase const*> nonlinear_solvers;
+    std::set<GlobalLinearSolver const*> linear_solvers;
+    for (auto const& process_data : per_process_data)
+    {
+        auto const& nonlinear_solver = process_data->nonlinear_solver;
+        if (!nonlinear_solvers.insert(&nonlinear_solver).second ||
+            !linear_solvers.insert(&nonlinear_solver.getLinearSolver())
+                 .second)
+        {
+            OGS_FATAL(
+                "The process #%d shares its nonlinear or linear solver with "
+                "another process, which is not possible for concurrent "
+                "processes. Please configure a separate solver for each "
+                "process.",
+                process_data->process_id);
+        }
+    }
+}
+}  // namespace
+
 namespace ProcessLib
 {
 std::unique_ptr<TimeLoop> createTimeLoop(
@@ -34,6 +76,7 @@ std::unique_ptr<TimeLoop> createTimeLoop(
     std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>
         global_coupling_conv_criteria;
     int max_coupling_iterations = 1;
+    std::unique_ptr<CouplingAcceleration> coupling_acceleration;
     if (coupling_config)
     {
         max_coupling_iterations
@@ -54,6 +97,14 @@ std::unique_ptr<TimeLoop> createTimeLoop(
                 NumLib::createConvergenceCriterion(
                     coupling_convergence_criterion_config));
         }
+
+        if (auto const acceleration_config =
+                //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration}
+            coupling_config->getConfigSubtreeOptional("acceleration"))
+        {
+            coupling_acceleration =
+                createCouplingAcceleration(*acceleration_config);
+        }
     }
 
     auto output =
@@ -91,9 +142,29 @@ std::unique_ptr<TimeLoop> createTimeLoop(
         per_process_data[minmax_iter.second - per_process_data.begin()]
             ->timestepper->end();
 
+    auto const checkpoint_tree =
+        //! \ogs_file_param{prj__time_loop__checkpoint}
+        config.getConfigSubtreeOptional("checkpoint");
+    std::unique_ptr<CheckpointConfig> checkpoint_config;
+    if (checkpoint_tree)
+    {
+        checkpoint_config =
+            createCheckpointConfig(*checkpoint_tree, output_directory);
+    }
+
+    bool const concurrent_processes =
+        //! \ogs_file_param{prj__time_loop__concurrent_processes}
+        config.getConfigParameter<bool>("concurrent_processes", false);
+    if (concurrent_processes)
+    {
+        checkConcurrentProcesses(per_process_data);
+    }
+
     return std::make_unique<TimeLoop>(
         std::move(output), std::move(per_process_data), max_coupling_iterations,
-        std::move(global_coupling_conv_criteria), std::move(phreeqc_io),
-        start_time, end_time);
+        std::move(global_coupling_conv_criteria),
+        std::move(coupling_acceleration), std::move(phreeqc_io),
+        std::move(checkpoint_config), concurrent_processes, start_time,
+        end_time);
 }
 }  // namespace ProcessLib
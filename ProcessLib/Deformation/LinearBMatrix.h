@@ -81,5 +81,26 @@ BMatrixType computeBMatrix(DNDX_Type const& dNdx,
 
     return B;
 }
+
+/// Returns the volumetric part of a B-matrix, i.e., the sum of its normal
+/// strain rows, which are the first three rows in Kelvin vector notation.
+template <typename BMatrixType>
+Eigen::Matrix<double, 1, BMatrixType::ColsAtCompileTime> volumetricBMatrixPart(
+    BMatrixType const& B)
+{
+    return B.template topRows<3>().colwise().sum();
+}
+
+/// Replaces the volumetric part of the B-matrix by \c b_bar, usually its
+/// average over the element (B-bar method). The deviatoric part is kept.
+/// This avoids the volumetric locking of low order elements for nearly
+/// incompressible materials.
+template <typename BMatrixType, typename BBarType>
+void applyBBar(BBarType const& b_bar, BMatrixType& B)
+{
+    Eigen::Matrix<double, 1, BMatrixType::ColsAtCompileTime> const correction =
+        (b_bar - volumetricBMatrixPart(B)) / 3.;
+    B.template topRows<3>().rowwise() += correction;
+}
 }  // namespace LinearBMatrix
 }  // namespace ProcessLib
@@ -36,12 +36,13 @@ struct MaterialForcesInterface
 template <int DisplacementDim, typename ShapeFunction,
           typename ShapeMatricesType, typename NodalForceVectorType,
           typename NodalDisplacementVectorType, typename GradientVectorType,
-          typename GradientMatrixType, typename IPData,
+          typename GradientMatrixType, typename IPData, typename IPView,
           typename IntegrationMethod>
 std::vector<double> const& getMaterialForces(
     std::vector<double> const& local_x, std::vector<double>& nodal_values,
     IntegrationMethod const& _integration_method, IPData const& _ip_data,
-    MeshLib::Element const& element, bool const is_axially_symmetric)
+    IPView const& ip_view, MeshLib::Element const& element,
+    bool const is_axially_symmetric)
 {
     unsigned const n_integration_points =
         _integration_method.getNumberOfPoints();
@@ -52,11 +53,11 @@ std::vector<double> const& getMaterialForces(
 
     for (unsigned ip = 0; ip < n_integration_points; ip++)
     {
-        auto const& sigma = _ip_data[ip].sigma;
+        auto const& sigma = ip_view.sigma(ip);
         auto const& N = _ip_data[ip].N;
         auto const& dNdx = _ip_data[ip].dNdx;
 
-        auto const& psi = _ip_data[ip].free_energy_density;
+        auto const psi = ip_view.free_energy_density(ip);
 
         auto const x_coord =
             interpolateXCoordinate<ShapeFunction, ShapeMatricesType>(
@@ -147,7 +148,7 @@ std::vector<double> const& getMaterialForces(
                 "other than 2 and 3.");
         }
 
-        auto const& w = _ip_data[ip].integration_weight;
+        auto const w = ip_view.integration_weight(ip);
         local_b += G.transpose() * eshelby_stress * w;
     }
 
@@ -0,0 +1,277 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "MathLib/KelvinVector.h"
+
+namespace ProcessLib
+{
+namespace Deformation
+{
+/// Stores the stresses, strains, free energy densities, and integration
+/// weights of the integration points of all elements of a process in a
+/// structure-of-arrays layout.
+///
+/// The data of the integration points of one element are contiguous, and the
+/// elements follow each other in the order of their allocation. Elements
+/// access their data through a MechanicsIntegrationPointView.
+///
+/// The stresses and strains are double-buffered: for each allocation one of
+/// the two buffers holds the current and the other one the previous state.
+/// Accepting a state only swaps the roles of the buffers instead of copying
+/// the data, see MechanicsIntegrationPointView::pushBackState().
+///
+/// \attention The store must not be resized while views are being used
+/// concurrently, i.e., all allocations have to happen during the construction
+/// of the local assemblers.
+template <int DisplacementDim>
+struct MechanicsIntegrationPointStore final
+{
+    using KelvinVectorType =
+        MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
+    using KelvinVectorArray =
+        std::vector<KelvinVectorType,
+                    Eigen::aligned_allocator<KelvinVectorType>>;
+
+    /// The integration points of one element.
+    struct Allocation
+    {
+        std::size_t offset;
+        std::size_t size;
+        /// Index of the buffer holding the current state.
+        unsigned char current_buffer = 0;
+        /// If set, the current state equals the previous one and is read from
+        /// the previous buffer.
+        bool state_accepted = true;
+    };
+
+    /// Appends zero-initialized data for \c n integration points and returns
+    /// the index of the allocation.
+    std::size_t allocate(std::size_t const n)
+    {
+        auto const offset = size();
+        auto const new_size = offset + n;
+
+        for (int buffer = 0; buffer < 2; ++buffer)
+        {
+            sigma[buffer].resize(new_size, KelvinVectorType::Zero());
+            eps[buffer].resize(new_size, KelvinVectorType::Zero());
+        }
+        free_energy_density.resize(new_size, 0.0);
+        integration_weight.resize(new_size, 0.0);
+
+        allocations.push_back({offset, n});
+        return allocations.size() - 1;
+    }
+
+    /// Total number of integration points.
+    std::size_t size() const { return integration_weight.size(); }
+
+    /// Copies the current stresses and strains of all integration points in
+    /// the order of the allocations, e.g., for writing a checkpoint.
+    void getState(KelvinVectorArray& sigma_out,
+                  KelvinVectorArray& eps_out) const
+    {
+        sigma_out.resize(size());
+        eps_out.resize(size());
+        for (auto const& a : allocations)
+        {
+            auto const buffer = a.state_accepted ? 1 - a.current_buffer
+                                                 : a.current_buffer;
+            copyRange(sigma[buffer], a, sigma_out);
+            copyRange(eps[buffer], a, eps_out);
+        }
+    }
+
+    /// Sets the current and the previous stresses and strains of all
+    /// integration points to the given ones, cf. getState().
+    void setState(KelvinVectorArray const& sigma_in,
+                  KelvinVectorArray const& eps_in)
+    {
+        assert(sigma_in.size() == size() && eps_in.size() == size());
+        for (auto& a : allocations)
+        {
+            a.state_accepted = true;
+            auto const previous_buffer = 1 - a.current_buffer;
+            copyRange(sigma_in, a, sigma[previous_buffer]);
+            copyRange(eps_in, a, eps[previous_buffer]);
+        }
+    }
+
+    std::array<KelvinVectorArray, 2> sigma;
+    std::array<KelvinVectorArray, 2> eps;
+    std::vector<double> free_energy_density;
+    std::vector<double> integration_weight;
+
+    std::vector<Allocation> allocations;
+
+private:
+    static void copyRange(KelvinVectorArray const& from, Allocation const& a,
+                          KelvinVectorArray& to)
+    {
+        auto const begin = static_cast<std::ptrdiff_t>(a.offset);
+        auto const end = static_cast<std::ptrdiff_t>(a.offset + a.size);
+        std::copy(from.begin() + begin, from.begin() + end,
+                  to.begin() + begin);
+    }
+};
+
+/// Provides access to the integration point data of a single element, which
+/// are stored in a MechanicsIntegrationPointStore.
+///
+/// The current stresses and strains are either the ones being computed in the
+/// ongoing timestep or, after pushBackState(), the accepted ones, which are
+/// also the previous ones of the next timestep.
+template <int DisplacementDim>
+class MechanicsIntegrationPointView final
+{
+public:
+    using Store = MechanicsIntegrationPointStore<DisplacementDim>;
+    using KelvinVectorType = typename Store::KelvinVectorType;
+
+    /// Allocates the data of \c n integration points in the given \c store.
+    MechanicsIntegrationPointView(Store& store, std::size_t const n)
+        : _store(store),
+          _allocation(store.allocate(n)),
+          _offset(store.allocations[_allocation].offset),
+          _size(n)
+    {
+    }
+
+    std::size_t size() const { return _size; }
+
+    KelvinVectorType& sigma(unsigned const ip)
+    {
+        return _store.sigma[currentBuffer()][index(ip)];
+    }
+    KelvinVectorType const& sigma(unsigned const ip) const
+    {
+        return _store.sigma[currentBuffer()][index(ip)];
+    }
+
+    KelvinVectorType const& sigma_prev(unsigned const ip) const
+    {
+        return _store.sigma[previousBuffer()][index(ip)];
+    }
+
+    KelvinVectorType& eps(unsigned const ip)
+    {
+        return _store.eps[currentBuffer()][index(ip)];
+    }
+    KelvinVectorType const& eps(unsigned const ip) const
+    {
+        return _store.eps[currentBuffer()][index(ip)];
+    }
+
+    KelvinVectorType const& eps_prev(unsigned const ip) const
+    {
+        return _store.eps[previousBuffer()][index(ip)];
+    }
+
+    double& free_energy_density(unsigned const ip)
+    {
+        return _store.free_energy_density[index(ip)];
+    }
+    double free_energy_density(unsigned const ip) const
+    {
+        return _store.free_energy_density[index(ip)];
+    }
+
+    double& integration_weight(unsigned const ip)
+    {
+        return _store.integration_weight[index(ip)];
+    }
+    double integration_weight(unsigned const ip) const
+    {
+        return _store.integration_weight[index(ip)];
+    }
+
+    /// Pointers to the contiguous data of the element's integration points,
+    /// e.g., for batched constitutive updates.
+    KelvinVectorType* sigma_data()
+    {
+        return &_store.sigma[currentBuffer()][_offset];
+    }
+    KelvinVectorType const* sigma_prev_data() const
+    {
+        return &_store.sigma[previousBuffer()][_offset];
+    }
+    KelvinVectorType const* eps_data() const
+    {
+        return &_store.eps[currentBuffer()][_offset];
+    }
+    KelvinVectorType const* eps_prev_data() const
+    {
+        return &_store.eps[previousBuffer()][_offset];
+    }
+
+    /// Starts the computation of a new state from the previous one. The
+    /// current stresses and strains of all integration points of the element
+    /// have to be written before they are read again, because they are no
+    /// longer copies of the previous ones.
+    void beginStateUpdate() { allocation().state_accepted = false; }
+
+    /// Accepts the current stresses and strains of all integration points of
+    /// the element as the previous ones by swapping the buffers. Nothing is
+    /// copied.
+    ///
+    /// A state computed in a rejected timestep is discarded by the next call
+    /// of beginStateUpdate(), which starts again from the previous state.
+    void pushBackState()
+    {
+        auto& a = allocation();
+        if (!a.state_accepted)
+        {
+            a.current_buffer = 1 - a.current_buffer;
+            a.state_accepted = true;
+        }
+    }
+
+private:
+    typename Store::Allocation& allocation()
+    {
+        return _store.allocations[_allocation];
+    }
+    typename Store::Allocation const& allocation() const
+    {
+        return _store.allocations[_allocation];
+    }
+
+    unsigned currentBuffer() const
+    {
+        auto const& a = allocation();
+        return a.state_accepted ? 1 - a.current_buffer : a.current_buffer;
+    }
+
+    unsigned previousBuffer() const { return 1 - allocation().current_buffer; }
+
+    std::size_t index(unsigned const ip) const
+    {
+        assert(ip < _size);
+        return _offset + ip;
+    }
+
+    Store& _store;
+    std::size_t const _allocation;
+    std::size_t const _offset;
+    std::size_t const _size;
+};
+
+}  // namespace Deformation
+}  // namespace ProcessLib
@@ -0,0 +1,160 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ForwardDifferencesJacobianAssembler.h"
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "LocalAssemblerInterface.h"
+
+namespace ProcessLib
+{
+ForwardDifferencesJacobianAssembler::ForwardDifferencesJacobianAssembler(
+    std::vector<double>&& absolute_epsilons)
+    : _absolute_epsilons(std::move(absolute_epsilons))
+{
+    if (_absolute_epsilons.empty())
+    {
+        OGS_FATAL("No values for the absolute epsilons have been given.");
+    }
+}
+
+void ForwardDifferencesJacobianAssembler::assembleWithJacobian(
+    LocalAssemblerInterface& local_assembler, const double t, double const dt,
+    const std::vector<double>& local_x_data,
+    const std::vector<double>& local_xdot_data, const double dxdot_dx,
+    const double dx_dx, std::vector<double>& local_M_data,
+    std::vector<double>& local_K_data, std::vector<double>& local_b_data,
+    std::vector<double>& local_Jac_data)
+{
+    if (local_x_data.size() % _absolute_epsilons.size() != 0)
+    {
+        OGS_FATAL(
+            "The number of specified epsilons (%u) and the number of local "
+            "d.o.f.s (%u) do not match, i.e., the latter is not divisable by "
+            "the former.",
+            _absolute_epsilons.size(), local_x_data.size());
+    }
+
+    auto const num_r_c =
+        static_cast<Eigen::MatrixXd::Index>(local_x_data.size());
+
+    auto const local_x =
+        MathLib::toVector<Eigen::VectorXd>(local_x_data, num_r_c);
+    auto const local_xdot =
+        MathLib::toVector<Eigen::VectorXd>(local_xdot_data, num_r_c);
+
+    auto local_Jac =
+        MathLib::createZeroedMatrix(local_Jac_data, num_r_c, num_r_c);
+    _local_x_perturbed_data = local_x_data;
+
+    auto const num_dofs_per_component =
+        local_x_data.size() / _absolute_epsilons.size();
+
+    // Assemble with unperturbed local x. The result is the output and the
+    // reference of all difference quotients.
+    local_assembler.assemble(t, dt, local_x_data, local_xdot_data, local_M_data,
+                             local_K_data, local_b_data);
+
+    // Residual  res := M xdot + K x - b
+    // Computing Jac := dres/dx
+    //                = M dxdot/dx + dM/dx xdot + K dx/dx + dK/dx x - db/dx
+    // The loop computes the dM/dx, dK/dx and db/dx terms, the rest is computed
+    // afterwards.
+    for (Eigen::MatrixXd::Index i = 0; i < num_r_c; ++i)
+    {
+        // assume that local_x_data is ordered by component.
+        auto const component = i / num_dofs_per_component;
+        auto const eps = _absolute_epsilons[component];
+
+        _local_x_perturbed_data[i] += eps;
+        local_assembler.assemble(t, dt, _local_x_perturbed_data,
+                                 local_xdot_data, _local_M_data, _local_K_data,
+                                 _local_b_data);
+        _local_x_perturbed_data[i] = local_x_data[i];
+
+        if (!local_M_data.empty())
+        {
+            auto const local_M =
+                MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+            auto const local_M_p =
+                MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
+            // dM/dxi * x_dot
+            local_Jac.col(i).noalias() += (1.0 / eps) * local_M_p * local_xdot;
+            local_Jac.col(i).noalias() -= (1.0 / eps) * local_M * local_xdot;
+            _local_M_data.clear();
+        }
+        if (!local_K_data.empty())
+        {
+            auto const local_K =
+                MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+            auto const local_K_p =
+                MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
+            // dK/dxi * x
+            local_Jac.col(i).noalias() += (1.0 / eps) * local_K_p * local_x;
+            local_Jac.col(i).noalias() -= (1.0 / eps) * local_K * local_x;
+            _local_K_data.clear();
+        }
+        if (!local_b_data.empty())
+        {
+            auto const local_b =
+                MathLib::toVector<Eigen::VectorXd>(local_b_data, num_r_c);
+            auto const local_b_p =
+                MathLib::toVector<Eigen::VectorXd>(_local_b_data, num_r_c);
+            // db/dxi
+            local_Jac.col(i).noalias() -= (local_b_p - local_b) / eps;
+            _local_b_data.clear();
+        }
+    }
+
+    // Compute remaining terms of the Jacobian.
+    if (dxdot_dx != 0.0 && !local_M_data.empty())
+    {
+        auto local_M = MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+        local_Jac.noalias() += local_M * dxdot_dx;
+    }
+    if (dx_dx != 0.0 && !local_K_data.empty())
+    {
+        auto local_K = MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+        local_Jac.noalias() += local_K * dx_dx;
+    }
+}
+
+std::unique_ptr<ForwardDifferencesJacobianAssembler>
+createForwardDifferencesJacobianAssembler(BaseLib::ConfigTree const& config)
+{
+    //! \ogs_file_param{prj__processes__process__jacobian_assembler__type}
+    config.checkConfigParameter("type", "ForwardDifferences");
+
+    auto const rel_eps =
+        //! \ogs_file_param{prj__processes__process__jacobian_assembler__ForwardDifferences__relative_epsilons}
+        config.getConfigParameter<std::vector<double>>("relative_epsilons");
+    auto const comp_mag =
+        //! \ogs_file_param{prj__processes__process__jacobian_assembler__ForwardDifferences__component_magnitudes}
+        config.getConfigParameter<std::vector<double>>("component_magnitudes");
+
+    if (rel_eps.size() != comp_mag.size())
+    {
+        OGS_FATAL(
+            "The numbers of components of <relative_epsilons> and "
+            "<component_magnitudes> do not match.");
+    }
+
+    std::vector<double> abs_eps(rel_eps.size());
+    for (std::size_t i = 0; i < rel_eps.size(); ++i)
+    {
+        abs_eps[i] = rel_eps[i] * comp_mag[i];
+    }
+
+    return std::make_unique<ForwardDifferencesJacobianAssembler>(
+        std::move(abs_eps));
+}
+
+}  // namespace ProcessLib
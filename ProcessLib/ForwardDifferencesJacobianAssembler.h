@@ -0,0 +1,81 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include "AbstractJacobianAssembler.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}  // BaseLib
+
+namespace ProcessLib
+{
+//! Assembles the Jacobian matrix using forward differences.
+//!
+//! Compared to the CentralDifferencesJacobianAssembler the unperturbed
+//! assembly is reused for all columns of the Jacobian, which halves the number
+//! of calls of the local assembler at the price of a first order accurate
+//! Jacobian.
+class ForwardDifferencesJacobianAssembler final
+    : public AbstractJacobianAssembler
+{
+public:
+    //! Constructs a new instance.
+    //!
+    //! \param absolute_epsilons perturbations of the components of the local
+    //! solution vector used for evaluating the finite differences.
+    //!
+    //! \note The size of \c absolute_epsilons defines the "number of
+    //! components" of the local solution vector, cf.
+    //! CentralDifferencesJacobianAssembler.
+    explicit ForwardDifferencesJacobianAssembler(
+        std::vector<double>&& absolute_epsilons);
+
+    //! Assembles the Jacobian, the matrices \f$M\f$ and \f$K\f$, and the vector
+    //! \f$b\f$.
+    //! The number of calls of the assemble() method of the given
+    //! \c local_assembler is \f$N+1\f$ if \f$N\f$ is the size of \c local_x.
+    //!
+    //! \attention It is assumed that the local vectors and matrices are ordered
+    //! by component.
+    void assembleWithJacobian(LocalAssemblerInterface& local_assembler,
+                              double const t, double const dt,
+                              std::vector<double> const& local_x,
+                              std::vector<double> const& local_xdot,
+                              const double dxdot_dx, const double dx_dx,
+                              std::vector<double>& local_M_data,
+                              std::vector<double>& local_K_data,
+                              std::vector<double>& local_b_data,
+                              std::vector<double>& local_Jac_data) override;
+
+    std::unique_ptr<AbstractJacobianAssembler> copy() const override
+    {
+        return std::make_unique<ForwardDifferencesJacobianAssembler>(
+            std::vector<double>(_absolute_epsilons));
+    }
+
+private:
+    std::vector<double> const _absolute_epsilons;
+
+    // temporary data only stored here in order to avoid frequent memory
+    // reallocations.
+    std::vector<double> _local_M_data;
+    std::vector<double> _local_K_data;
+    std::vector<double> _local_b_data;
+    std::vector<double> _local_x_perturbed_data;
+};
+
+std::unique_ptr<ForwardDifferencesJacobianAssembler>
+createForwardDifferencesJacobianAssembler(BaseLib::ConfigTree const& config);
+
+}  // namespace ProcessLib
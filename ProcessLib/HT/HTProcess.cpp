@@ -117,10 +117,9 @@ void HTProcess::assembleConcreteProcess(const double t, double const dt,
 
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot, process_id, M, K,
-        b, _coupled_solutions);
+    executeGlobalAssembly(&VectorMatrixAssembler::assemble, _local_assemblers,
+                          pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot,
+                          process_id, M, K, b, _coupled_solutions);
 }
 
 void HTProcess::assembleWithJacobianConcreteProcess(
@@ -146,10 +145,10 @@ void HTProcess::assembleWithJacobianConcreteProcess(
 
     // Call global assembler for each local assembly item.
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot,
-        dxdot_dx, dx_dx, process_id, M, K, b, Jac, _coupled_solutions);
+    executeGlobalAssembly(
+        &VectorMatrixAssembler::assembleWithJacobian, _local_assemblers,
+        pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot, dxdot_dx, dx_dx,
+        process_id, M, K, b, Jac, _coupled_solutions);
 }
 
 void HTProcess::preTimestepConcreteProcess(std::vector<GlobalVector*> const& x,
@@ -82,7 +82,11 @@ public:
               element, is_axially_symmetric, _integration_method)),
           _heat_fluxes(
               GlobalDim,
-              std::vector<double>(_integration_method.getNumberOfPoints()))
+              std::vector<double>(_integration_method.getNumberOfPoints())),
+          _constant_local_matrices(
+              !_process_data.thermal_conductivity.isTimeDependent() &&
+              !_process_data.heat_capacity.isTimeDependent() &&
+              !_process_data.density.isTimeDependent())
     {
         // This assertion is valid only if all nodal d.o.f. use the same shape
         // matrices.
@@ -102,6 +106,13 @@ public:
         // matrices.
         assert(local_matrix_size == ShapeFunction::NPOINTS * NUM_NODAL_DOF);
 
+        if (!_cached_local_K_data.empty())
+        {
+            local_M_data = _cached_local_M_data;
+            local_K_data = _cached_local_K_data;
+            return;
+        }
+
         auto local_M = MathLib::createZeroedMatrix<NodalMatrixType>(
             local_M_data, local_matrix_size, local_matrix_size);
         auto local_K = MathLib::createZeroedMatrix<NodalMatrixType>(
@@ -122,11 +133,20 @@ public:
             auto const heat_capacity = _process_data.heat_capacity(t, pos)[0];
             auto const density = _process_data.density(t, pos)[0];
 
-            local_K.noalias() += sm.dNdx.transpose() * k * sm.dNdx * sm.detJ *
-                                 wp.getWeight() * sm.integralMeasure;
-            local_M.noalias() += sm.N.transpose() * density * heat_capacity *
-                                 sm.N * sm.detJ * wp.getWeight() *
-                                 sm.integralMeasure;
+            double const w = sm.detJ * wp.getWeight() * sm.integralMeasure;
+
+            // The scalar factors are collected first, s.t. the products are
+            // evaluated as a single scaled matrix-matrix product without
+            // scaling the nodal matrices.
+            local_K.noalias() += (k * w) * sm.dNdx.transpose() * sm.dNdx;
+            local_M.noalias() +=
+                (density * heat_capacity * w) * sm.N.transpose() * sm.N;
+        }
+
+        if (_constant_local_matrices)
+        {
+            _cached_local_M_data = local_M_data;
+            _cached_local_K_data = local_K_data;
         }
     }
 
@@ -209,6 +229,13 @@ private:
         _shape_matrices;
 
     std::vector<std::vector<double>> _heat_fluxes;
+
+    /// The local matrices depend neither on the primary variable nor, if all
+    /// parameters are time independent, on the time. Then they are computed
+    /// in the first assembly only and copied from the cache afterwards.
+    bool const _constant_local_matrices;
+    std::vector<double> _cached_local_M_data;
+    std::vector<double> _cached_local_K_data;
 };
 
 }  // namespace HeatConduction
@@ -118,12 +118,20 @@ void HeatTransportBHEProcess::constructDofTable()
         vec_var_elements.push_back(&bhe_elements);
     }
 
+    // The BHE unknowns of a node are only coupled to the soil temperatures of
+    // the BHE nodes. If a node ordering is requested, all unknowns are
+    // numbered by location, which places the BHE unknowns next to these soil
+    // temperatures instead of behind all of them and so reduces the
+    // bandwidth of the global matrix.
+    auto const node_order = NumLib::computeNodeOrder(_mesh, _node_ordering);
     _local_to_global_index_map =
         std::make_unique<NumLib::LocalToGlobalIndexMap>(
             std::move(all_mesh_subsets),
             vec_n_components,
             vec_var_elements,
-            NumLib::ComponentOrder::BY_COMPONENT);
+            node_order.empty() ? NumLib::ComponentOrder::BY_COMPONENT
+                               : NumLib::ComponentOrder::BY_LOCATION,
+            node_order);
 
     // in case of debugging the dof table, activate the following line
     // std::cout << *_local_to_global_index_map << "\n";
@@ -169,10 +177,9 @@ void HeatTransportBHEProcess::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_table, t, dt, x, xdot, process_id, M, K,
-        b, _coupled_solutions);
+    executeGlobalAssembly(&VectorMatrixAssembler::assemble, _local_assemblers,
+                          pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
+                          process_id, M, K, b, _coupled_solutions);
 }
 
 void HeatTransportBHEProcess::assembleWithJacobianConcreteProcess(
@@ -215,11 +222,12 @@ NumLib::IterationResult HeatTransportBHEProcess::postIterationConcreteProcess(
     // update flowrate in network if network exist a dynamic flowrate in time
     auto const cur_time =
         std::get<0>(_process_data.py_bc_object->dataframe_network);
-    if (std::get<0>(_process_data.py_bc_object->tespyHydroSolver(cur_time)))
+    auto const tespy_hydro_result =
+        _process_data.py_bc_object->tespyHydroSolver(cur_time);
+    if (std::get<0>(tespy_hydro_result))
     {
         // calculate the current flowrate in each BHE from TESPy
-        auto const cur_flowrate =
-            std::get<1>(_process_data.py_bc_object->tespyHydroSolver(cur_time));
+        auto const& cur_flowrate = std::get<1>(tespy_hydro_result);
         for (std::size_t i = 0; i < n_bc_nodes; i++)
             std::get<4>(_process_data.py_bc_object->dataframe_network)[i] =
                 cur_flowrate[i];
@@ -251,7 +259,7 @@ NumLib::IterationResult HeatTransportBHEProcess::postIterationConcreteProcess(
             "Method `tespyThermalSolver' not overridden in Python "
             "script.");
     }
-    auto const cur_Tin = std::get<2>(tespy_result);
+    auto const& cur_Tin = std::get<2>(tespy_result);
 
     // update the T_in
     for (std::size_t i = 0; i < n_bc_nodes; i++)
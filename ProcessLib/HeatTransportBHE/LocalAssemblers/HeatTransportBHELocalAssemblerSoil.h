@@ -80,9 +80,6 @@ private:
 
     IntegrationMethod const _integration_method;
 
-    std::vector<ShapeMatrices, Eigen::aligned_allocator<ShapeMatrices>>
-        _shape_matrices;
-
     std::size_t const _element_id;
 
     SecondaryData<typename ShapeMatrices::ShapeType> _secondary_data;
@@ -14,6 +14,7 @@
 #include <logog/include/logog.hpp>
 
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "ProcessLib/Utils/CreateLocalAssemblersInParallel.h"
 
 #include "LocalDataInitializer.h"
 
@@ -47,7 +48,7 @@ void createLocalAssemblers(
     LocalDataInitializer initializer(dof_table, shapefunction_order);
 
     DBUG("Calling local assembler builder for all mesh elements.");
-    GlobalExecutor::transformDereferenced(
+    createLocalAssemblersInParallel(
         initializer, mesh_elements, local_assemblers,
         std::forward<ExtraCtorArgs>(extra_ctor_args)...);
 }
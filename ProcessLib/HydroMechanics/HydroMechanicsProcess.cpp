@@ -394,9 +394,9 @@ void HydroMechanicsProcess<DisplacementDim>::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        dof_table, t, dt, x, xdot, process_id, M, K, b, _coupled_solutions);
+    executeGlobalAssembly(
+        &VectorMatrixAssembler::assemble, _local_assemblers, {}, dof_table, t,
+        dt, x, xdot, process_id, M, K, b, _coupled_solutions);
 }
 
 template <int DisplacementDim>
@@ -438,10 +438,10 @@ void HydroMechanicsProcess<DisplacementDim>::
 
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot,
-        dxdot_dx, dx_dx, process_id, M, K, b, Jac, _coupled_solutions);
+    executeGlobalAssembly(
+        &VectorMatrixAssembler::assembleWithJacobian, _local_assemblers,
+        pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot, dxdot_dx, dx_dx,
+        process_id, M, K, b, Jac, _coupled_solutions);
 
     auto copyRhs = [&](int const variable_id, auto& output_vector) {
         if (_use_monolithic_scheme)
@@ -9,6 +9,8 @@
 
 #include "MeshUtils.h"
 
+#include <unordered_map>
+
 #include "BaseLib/Algorithm.h"
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/Mesh.h"
@@ -78,22 +80,13 @@ void findFracutreIntersections(
         vec_junction_nodeID_matIDs)
 {
     auto const n_fractures = vec_fracture_mat_IDs.size();
-    std::map<unsigned, unsigned> matID_to_fid;
+    std::unordered_map<int, unsigned> matID_to_fid;
+    matID_to_fid.reserve(n_fractures);
     for (unsigned i = 0; i < n_fractures; i++)
     {
         matID_to_fid[vec_fracture_mat_IDs[i]] = i;
     }
 
-    // make a vector all fracture nodes
-    std::vector<std::size_t> all_fracture_nodes;
-    for (auto& vec : vec_fracture_nodes)
-    {
-        for (auto* node : vec)
-        {
-            all_fracture_nodes.push_back(node->getID());
-        }
-    }
-
     // create a table of a node id and connected material IDs
     std::map<std::size_t, std::vector<std::size_t>> frac_nodeID_to_matIDs;
     for (unsigned i = 0; i < n_fractures; i++)
@@ -255,26 +248,36 @@ void getFractureMatrixDataInMesh(
     BaseLib::makeVectorUnique(vec_fracture_mat_IDs);
     DBUG("-> found %d fracture material groups", vec_fracture_mat_IDs.size());
 
-    // create a vector of fracture elements for each material
-    vec_fracture_elements.resize(vec_fracture_mat_IDs.size());
-    for (unsigned frac_id = 0; frac_id < vec_fracture_mat_IDs.size(); frac_id++)
+    auto const n_fractures = vec_fracture_mat_IDs.size();
+    std::unordered_map<int, unsigned> matID_to_fid;
+    matID_to_fid.reserve(n_fractures);
+    for (unsigned frac_id = 0; frac_id < n_fractures; frac_id++)
+    {
+        matID_to_fid[vec_fracture_mat_IDs[frac_id]] = frac_id;
+    }
+
+    // create a vector of fracture elements for each material in a single pass
+    // over all fracture elements
+    vec_fracture_elements.resize(n_fractures);
+    for (MeshLib::Element* e : all_fracture_elements)
+    {
+        vec_fracture_elements[matID_to_fid[(*material_ids)[e->getID()]]]
+            .push_back(e);
+    }
+    for (unsigned frac_id = 0; frac_id < n_fractures; frac_id++)
     {
-        const auto frac_mat_id = vec_fracture_mat_IDs[frac_id];
-        std::vector<MeshLib::Element*>& vec_elements =
-            vec_fracture_elements[frac_id];
-        std::copy_if(all_fracture_elements.begin(), all_fracture_elements.end(),
-                     std::back_inserter(vec_elements),
-                     [&](MeshLib::Element* e) {
-                         return (*material_ids)[e->getID()] == frac_mat_id;
-                     });
-        DBUG("-> found %d elements on the fracture %d", vec_elements.size(),
-             frac_id);
+        DBUG("-> found %d elements on the fracture %d",
+             vec_fracture_elements[frac_id].size(), frac_id);
     }
 
-    // get a vector of fracture nodes for each material
-    vec_fracture_nodes.resize(vec_fracture_mat_IDs.size());
-    for (unsigned frac_id = 0; frac_id < vec_fracture_mat_IDs.size(); frac_id++)
+    // get a vector of fracture nodes for each material. The fractures are
+    // independent of each other and processed in parallel.
+    vec_fracture_nodes.resize(n_fractures);
+#pragma omp parallel for schedule(dynamic, 16)
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(n_fractures);
+         i++)
     {
+        auto const frac_id = static_cast<unsigned>(i);
         std::vector<MeshLib::Node*>& vec_nodes = vec_fracture_nodes[frac_id];
         for (MeshLib::Element* e : vec_fracture_elements[frac_id])
         {
@@ -291,7 +294,11 @@ void getFractureMatrixDataInMesh(
             vec_nodes, [](MeshLib::Node* node1, MeshLib::Node* node2) {
                 return node1->getID() < node2->getID();
             });
-        DBUG("-> found %d nodes on the fracture %d", vec_nodes.size(), frac_id);
+    }
+    for (unsigned frac_id = 0; frac_id < n_fractures; frac_id++)
+    {
+        DBUG("-> found %d nodes on the fracture %d",
+             vec_fracture_nodes[frac_id].size(), frac_id);
     }
 
     // find branch/junction nodes which connect to multiple fractures
@@ -303,10 +310,15 @@ void getFractureMatrixDataInMesh(
 
     // create a vector fracture elements and connected matrix elements,
     // which are passed to a DoF table
-    for (unsigned fid = 0; fid < vec_fracture_elements.size(); fid++)
+    vec_fracture_matrix_elements.resize(n_fractures);
+#pragma omp parallel for schedule(dynamic, 16)
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(n_fractures);
+         i++)
     {
+        auto const fid = static_cast<unsigned>(i);
         auto const& fracture_elements = vec_fracture_elements[fid];
-        std::vector<MeshLib::Element*> vec_ele;
+        std::vector<MeshLib::Element*>& vec_ele =
+            vec_fracture_matrix_elements[fid];
         // first, collect matrix elements
         for (MeshLib::Element* e : fracture_elements)
         {
@@ -344,8 +356,6 @@ void getFractureMatrixDataInMesh(
         std::copy(intersected_fracture_elements[fid].begin(),
                   intersected_fracture_elements[fid].end(),
                   std::back_inserter(vec_ele));
-
-        vec_fracture_matrix_elements.push_back(vec_ele);
     }
 }
 
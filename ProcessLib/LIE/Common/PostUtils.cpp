@@ -9,6 +9,8 @@
 
 #include "PostUtils.h"
 
+#include <map>
+
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/MeshEditing/DuplicateMeshComponents.h"
 #include "MeshLib/Node.h"
@@ -41,6 +43,16 @@ std::vector<int> const& getMaterialIdsForNode(
     assert(itr != vec_nodeID_matIDs.end());
     return itr->second;
 };
+
+void checkRelevantProperties(MeshLib::Mesh const& mesh)
+{
+    if (!mesh.getProperties().hasPropertyVector("displacement") ||
+        !mesh.getProperties().hasPropertyVector("displacement_jump1") ||
+        !mesh.getProperties().hasPropertyVector("levelset1"))
+    {
+        OGS_FATAL("The given mesh does not have relevant properties");
+    }
+}
 }  // namespace
 
 PostProcessTool::PostProcessTool(
@@ -53,44 +65,36 @@ PostProcessTool::PostProcessTool(
         vec_branch_nodeID_matIDs,
     std::vector<std::pair<std::size_t, std::vector<int>>> const&
         vec_junction_nodeID_matIDs)
-    : _org_mesh(org_mesh)
+    : _org_mesh(org_mesh),
+      _n_fractures(vec_vec_fracture_nodes.size()),
+      _n_junctions(vec_junction_nodeID_matIDs.size())
 {
-    if (!org_mesh.getProperties().hasPropertyVector("displacement") ||
-        !org_mesh.getProperties().hasPropertyVector("displacement_jump1") ||
-        !org_mesh.getProperties().hasPropertyVector("levelset1"))
-    {
-        OGS_FATAL("The given mesh does not have relevant properties");
-    }
-
-    // clone nodes and elements
-    std::vector<MeshLib::Node*> new_nodes(
-        MeshLib::copyNodeVector(org_mesh.getNodes()));
-    std::vector<MeshLib::Element*> new_eles(
-        MeshLib::copyElementVector(org_mesh.getElements(), new_nodes));
+    checkRelevantProperties(org_mesh);
 
     // duplicate fracture nodes (two dup. nodes created at a branch)
+    auto const n_org_nodes = org_mesh.getNumberOfNodes();
+    std::map<std::size_t, std::vector<std::size_t>> map_dup_newNodeIDs;
     for (auto const& vec_fracture_nodes : vec_vec_fracture_nodes)
     {
         for (auto const* org_node : vec_fracture_nodes)
         {
-            auto duplicated_node =
-                new MeshLib::Node(org_node->getCoords(), new_nodes.size());
-            new_nodes.push_back(duplicated_node);
-            _map_dup_newNodeIDs[org_node->getID()].push_back(
-                duplicated_node->getID());
+            map_dup_newNodeIDs[org_node->getID()].push_back(
+                n_org_nodes + _duplicated_node_org_ids.size());
+            _duplicated_node_org_ids.push_back(org_node->getID());
         }
     }
     // at a junction, generate one more duplicated node (total 4 nodes)
     for (auto& entry : vec_junction_nodeID_matIDs)
     {
-        auto* org_node = org_mesh.getNode(entry.first);
-        auto duplicated_node =
-            new MeshLib::Node(org_node->getCoords(), new_nodes.size());
-        new_nodes.push_back(duplicated_node);
-        _map_dup_newNodeIDs[org_node->getID()].push_back(
-            duplicated_node->getID());
+        map_dup_newNodeIDs[entry.first].push_back(
+            n_org_nodes + _duplicated_node_org_ids.size());
+        _duplicated_node_org_ids.push_back(entry.first);
     }
 
+    // The node ids of the split elements including the replacements made so
+    // far.
+    std::map<std::size_t, std::vector<std::size_t>> element_node_ids;
+
     // split elements using the new duplicated nodes
     for (unsigned fracture_id = 0;
          fracture_id < vec_vec_fracture_matrix_elements.size();
@@ -118,18 +122,25 @@ PostProcessTool::PostProcessTool(
             }
 
             // replace fracture nodes with duplicated ones
-            MeshLib::Element* e = new_eles[eid];
-            for (unsigned i = 0; i < e->getNumberOfNodes(); i++)
+            auto& node_ids = element_node_ids[eid];
+            if (node_ids.empty())
+            {
+                for (unsigned i = 0; i < org_e->getNumberOfNodes(); i++)
+                {
+                    node_ids.push_back(org_e->getNodeIndex(i));
+                }
+            }
+            for (unsigned i = 0; i < node_ids.size(); i++)
             {
-                const auto node_id = e->getNodeIndex(i);
+                const auto node_id = node_ids[i];
                 if (!includesNodeID(vec_fracture_nodes, node_id))
                 {
                     continue;
                 }
 
                 // list of duplicated node IDs
-                auto itr = _map_dup_newNodeIDs.find(node_id);
-                if (itr == _map_dup_newNodeIDs.end())
+                auto itr = map_dup_newNodeIDs.find(node_id);
+                if (itr == map_dup_newNodeIDs.end())
                 {
                     continue;
                 }
@@ -202,20 +213,67 @@ PostProcessTool::PostProcessTool(
                 }
 
                 // replace node
-                e->setNode(i, new_nodes[new_node_id]);
+                node_ids[i] = new_node_id;
+                _node_replacements.push_back({eid, i, new_node_id});
             }
         }
     }
 
+    createOutputMesh();
+}
+
+PostProcessTool::PostProcessTool(MeshLib::Mesh const& org_mesh,
+                                 PostProcessTool const& tool)
+    : _org_mesh(org_mesh),
+      _duplicated_node_org_ids(tool._duplicated_node_org_ids),
+      _node_replacements(tool._node_replacements),
+      _n_fractures(tool._n_fractures),
+      _n_junctions(tool._n_junctions)
+{
+    checkRelevantProperties(org_mesh);
+    if (org_mesh.getNumberOfNodes() + _duplicated_node_org_ids.size() !=
+            tool.getOutputMesh().getNumberOfNodes() ||
+        org_mesh.getNumberOfElements() !=
+            tool.getOutputMesh().getNumberOfElements())
+    {
+        OGS_FATAL(
+            "The mesh '%s' does not have the same nodes and elements as the "
+            "mesh '%s'.",
+            org_mesh.getName().c_str(),
+            tool.getOutputMesh().getName().c_str());
+    }
+
+    createOutputMesh();
+}
+
+void PostProcessTool::createOutputMesh()
+{
+    // clone nodes and elements
+    std::vector<MeshLib::Node*> new_nodes(
+        MeshLib::copyNodeVector(_org_mesh.getNodes()));
+    new_nodes.reserve(new_nodes.size() + _duplicated_node_org_ids.size());
+    for (auto const org_node_id : _duplicated_node_org_ids)
+    {
+        new_nodes.push_back(new MeshLib::Node(
+            _org_mesh.getNode(org_node_id)->getCoords(), new_nodes.size()));
+    }
+    std::vector<MeshLib::Element*> new_eles(
+        MeshLib::copyElementVector(_org_mesh.getElements(), new_nodes));
+
+    for (auto const& replacement : _node_replacements)
+    {
+        new_eles[replacement.element_id]->setNode(
+            replacement.local_node_id, new_nodes[replacement.new_node_id]);
+    }
+
     // new mesh
-    _output_mesh = std::make_unique<MeshLib::Mesh>(org_mesh.getName(),
+    _output_mesh = std::make_unique<MeshLib::Mesh>(_org_mesh.getName(),
                                                    new_nodes, new_eles);
     createProperties<int>();
     createProperties<double>();
     copyProperties<int>();
     copyProperties<double>();
-    calculateTotalDisplacement(vec_vec_fracture_nodes.size(),
-                               vec_junction_nodeID_matIDs.size());
+    calculateTotalDisplacement(_n_fractures, _n_junctions);
 }
 
 template <typename T>
@@ -292,15 +350,14 @@ void PostProcessTool::copyProperties()
                 }
             }
             // copy duplicated
-            for (auto itr : _map_dup_newNodeIDs)
+            auto const n_org_nodes = _org_mesh.getNumberOfNodes();
+            for (std::size_t k = 0; k < _duplicated_node_org_ids.size(); k++)
             {
+                auto const org_node_id = _duplicated_node_org_ids[k];
                 for (int j = 0; j < n_dest_comp; j++)
                 {
-                    for (unsigned k = 0; k < itr.second.size(); k++)
-                    {
-                        (*dest_prop)[itr.second[k] * n_dest_comp + j] =
-                            (*dest_prop)[itr.first * n_dest_comp + j];
-                    }
+                    (*dest_prop)[(n_org_nodes + k) * n_dest_comp + j] =
+                        (*dest_prop)[org_node_id * n_dest_comp + j];
                 }
             }
         }
@@ -9,7 +9,6 @@
 
 #pragma once
 
-#include <map>
 #include <memory>
 #include <vector>
 
@@ -41,9 +40,19 @@ public:
         std::vector<std::pair<std::size_t, std::vector<int>>> const&
             vec_junction_nodeID_matIDs);
 
+    /// Post-processes another result of the same simulation, e.g. a later
+    /// timestep. The nodes, elements, and level sets of \c org_mesh must be
+    /// the same as the ones of the mesh \c tool was created for, because the
+    /// node duplication of \c tool is reused.
+    PostProcessTool(MeshLib::Mesh const& org_mesh,
+                    PostProcessTool const& tool);
+
     MeshLib::Mesh const& getOutputMesh() const { return *_output_mesh; }
 
 private:
+    /// Copies the nodes and elements of the original mesh, adds the
+    /// duplicated nodes, and connects the split elements to them.
+    void createOutputMesh();
     template <typename T>
     void createProperties();
     template <typename T>
@@ -51,9 +60,23 @@ private:
     void calculateTotalDisplacement(unsigned const n_fractures,
                                     unsigned const n_junctions);
 
+    /// A node of an element replaced by a duplicated node.
+    struct NodeReplacement
+    {
+        std::size_t element_id;
+        unsigned local_node_id;
+        std::size_t new_node_id;
+    };
+
     MeshLib::Mesh const& _org_mesh;
     std::unique_ptr<MeshLib::Mesh> _output_mesh;
-    std::map<std::size_t, std::vector<std::size_t>> _map_dup_newNodeIDs;
+    /// The original node ids of the duplicated nodes. The k-th duplicated
+    /// node has the id <tt>_org_mesh.getNumberOfNodes() + k</tt>.
+    std::vector<std::size_t> _duplicated_node_org_ids;
+    /// The replacements in the order they are applied.
+    std::vector<NodeReplacement> _node_replacements;
+    unsigned _n_fractures = 0;
+    unsigned _n_junctions = 0;
 };
 
 }  // namespace LIE
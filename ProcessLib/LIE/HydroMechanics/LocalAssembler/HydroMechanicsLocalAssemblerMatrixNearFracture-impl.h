@@ -12,6 +12,8 @@
 
 #include "HydroMechanicsLocalAssemblerMatrixNearFracture.h"
 
+#include "ProcessLib/LIE/Common/LevelSetFunction.h"
+
 namespace ProcessLib
 {
 namespace LIE
@@ -35,12 +37,19 @@ HydroMechanicsLocalAssemblerMatrixNearFracture<ShapeFunctionDisplacement,
                                          ShapeFunctionPressure,
                                          IntegrationMethod, GlobalDim>(
           e, n_variables, local_matrix_size, dofIndex_to_localIndex,
-          is_axially_symmetric, integration_order, process_data),
-      _e_center_coords(e.getCenterOfGravity().getCoords())
+          is_axially_symmetric, integration_order, process_data)
 {
     // currently not supporting multiple fractures
-    _fracture_props.push_back(process_data.fracture_property.get());
-    _fracID_to_local.insert({0, 0});
+    std::vector<FractureProperty*> const fracture_props{
+        process_data.fracture_property.get()};
+    std::unordered_map<int, int> const fracID_to_local{{0, 0}};
+
+    // levelset value of the element
+    // remark: this assumes the levelset function is uniform within an element.
+    // It depends on the geometry only and is evaluated once.
+    Eigen::Vector3d const e_center_coords(e.getCenterOfGravity().getCoords());
+    _ele_levelset = uGlobalEnrichments(fracture_props, {}, fracID_to_local,
+                                       e_center_coords)[0];
 }
 
 template <typename ShapeFunctionDisplacement, typename ShapeFunctionPressure,
@@ -78,13 +87,7 @@ void HydroMechanicsLocalAssemblerMatrixNearFracture<
     auto J_uu = local_J.block(displacement_index, displacement_index,
                               displacement_size, displacement_size);
 
-    // levelset value of the element
-    // remark: this assumes the levelset function is uniform within an element
-    std::vector<double> levelsets = uGlobalEnrichments(
-        _fracture_props, _junction_props, _fracID_to_local, _e_center_coords);
-    double const ele_levelset = levelsets[0];  // single fracture
-
-    if (ele_levelset == 0)
+    if (_ele_levelset == 0)
     {
         // no DoF exists for displacement jumps. do the normal assembly
         Base::assembleBlockMatricesWithJacobian(
@@ -98,8 +101,8 @@ void HydroMechanicsLocalAssemblerMatrixNearFracture<
     auto const g = local_x.segment(displacement_jump_index, displacement_size);
     auto const g_dot =
         local_x_dot.segment(displacement_jump_index, displacement_size);
-    Eigen::VectorXd const total_u = u + ele_levelset * g;
-    Eigen::VectorXd const total_u_dot = u_dot + ele_levelset * g_dot;
+    Eigen::VectorXd const total_u = u + _ele_levelset * g;
+    Eigen::VectorXd const total_u_dot = u_dot + _ele_levelset * g_dot;
 
     // evaluate residuals and Jacobians for pressure and displacements
     Base::assembleBlockMatricesWithJacobian(t, dt, p, p_dot, total_u,
@@ -119,12 +122,12 @@ void HydroMechanicsLocalAssemblerMatrixNearFracture<
     auto J_gg = local_J.block(displacement_jump_index, displacement_jump_index,
                               displacement_size, displacement_size);
 
-    rhs_g = ele_levelset * rhs_u;
-    J_pg = ele_levelset * J_pu;
-    J_ug = ele_levelset * J_uu;
-    J_gp = ele_levelset * J_up;
-    J_gu = ele_levelset * J_uu;
-    J_gg = ele_levelset * ele_levelset * J_uu;
+    rhs_g = _ele_levelset * rhs_u;
+    J_pg = _ele_levelset * J_pu;
+    J_ug = _ele_levelset * J_uu;
+    J_gp = _ele_levelset * J_up;
+    J_gu = _ele_levelset * J_uu;
+    J_gg = _ele_levelset * _ele_levelset * J_uu;
 }
 
 template <typename ShapeFunctionDisplacement, typename ShapeFunctionPressure,
@@ -142,13 +145,7 @@ void HydroMechanicsLocalAssemblerMatrixNearFracture<
     }
     auto u = local_x.segment(displacement_index, displacement_size);
 
-    // levelset value of the element
-    // remark: this assumes the levelset function is uniform within an element
-    std::vector<double> levelsets = uGlobalEnrichments(
-        _fracture_props, _junction_props, _fracID_to_local, _e_center_coords);
-    double const ele_levelset = levelsets[0];  // single fracture
-
-    if (ele_levelset == 0)
+    if (_ele_levelset == 0)
     {
         // no DoF exists for displacement jumps. do the normal assembly
         Base::postTimestepConcreteWithBlockVectors(t, dt, p, u);
@@ -159,7 +156,7 @@ void HydroMechanicsLocalAssemblerMatrixNearFracture<
 
     // compute true displacements
     auto const g = local_x.segment(displacement_jump_index, displacement_size);
-    Eigen::VectorXd const total_u = u + ele_levelset * g;
+    Eigen::VectorXd const total_u = u + _ele_levelset * g;
 
     // evaluate residuals and Jacobians for pressure and displacements
     Base::postTimestepConcreteWithBlockVectors(t, dt, p, total_u);
@@ -89,10 +89,8 @@ private:
     static const int displacement_jump_index =
         displacement_index + displacement_size;
 
-    std::vector<FractureProperty*> _fracture_props;
-    std::vector<JunctionProperty*> _junction_props;
-    std::unordered_map<int, int> _fracID_to_local;
-    Eigen::Vector3d _e_center_coords;
+    /// Enrichment value of the element for the single fracture.
+    double _ele_levelset = 0;
 };
 
 }  // namespace HydroMechanics
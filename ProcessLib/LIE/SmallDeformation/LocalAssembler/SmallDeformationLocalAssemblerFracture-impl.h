@@ -43,9 +43,6 @@ SmallDeformationLocalAssemblerFracture<ShapeFunction, IntegrationMethod,
           dofIndex_to_localIndex),
       _process_data(process_data),
       _integration_method(integration_order),
-      _shape_matrices(initShapeMatrices<ShapeFunction, ShapeMatricesType,
-                                        IntegrationMethod, DisplacementDim>(
-          e, is_axially_symmetric, _integration_method)),
       _element(e)
 {
     assert(_element.getDimension() == DisplacementDim - 1);
@@ -53,6 +50,11 @@ SmallDeformationLocalAssemblerFracture<ShapeFunction, IntegrationMethod,
     unsigned const n_integration_points =
         _integration_method.getNumberOfPoints();
 
+    auto const shape_matrices =
+        initShapeMatrices<ShapeFunction, ShapeMatricesType, IntegrationMethod,
+                          DisplacementDim>(e, is_axially_symmetric,
+                                           _integration_method);
+
     _ip_data.reserve(n_integration_points);
     _secondary_data.N.resize(n_integration_points);
 
@@ -77,7 +79,7 @@ SmallDeformationLocalAssemblerFracture<ShapeFunction, IntegrationMethod,
         x_position.setIntegrationPoint(ip);
 
         _ip_data.emplace_back(*_process_data._fracture_model);
-        auto const& sm = _shape_matrices[ip];
+        auto const& sm = shape_matrices[ip];
         auto& ip_data = _ip_data[ip];
         ip_data.integration_weight =
             _integration_method.getWeightedPoint(ip).getWeight() *
@@ -176,27 +178,41 @@ void SmallDeformationLocalAssemblerFracture<
     ParameterLib::SpatialPosition x_position;
     x_position.setElementID(_element.getID());
 
+    // The constitutive relation is evaluated for all integration points at
+    // once. Its inputs and outputs are stored contiguously in buffers reused
+    // by all elements assembled by the same thread.
+    using FractureModel =
+        MaterialLib::Fracture::FractureModelBase<DisplacementDim>;
+    using Vector = typename FractureModel::Vector;
+    using Matrix = typename FractureModel::Matrix;
+    thread_local std::vector<double> aperture0s;
+    thread_local std::vector<Vector, Eigen::aligned_allocator<Vector>> ws,
+        w_prevs, sigma_prevs, sigmas;
+    thread_local std::vector<Matrix, Eigen::aligned_allocator<Matrix>> Cs;
+    thread_local std::vector<typename FractureModel::MaterialStateVariables*>
+        states;
+    thread_local std::vector<std::vector<double>> ip_levelsets;
+    aperture0s.resize(n_integration_points);
+    ws.resize(n_integration_points);
+    w_prevs.resize(n_integration_points);
+    sigma_prevs.resize(n_integration_points);
+    sigmas.resize(n_integration_points);
+    Cs.resize(n_integration_points);
+    states.resize(n_integration_points);
+    ip_levelsets.resize(n_integration_points);
+
     for (unsigned ip = 0; ip < n_integration_points; ip++)
     {
-        x_position.setIntegrationPoint(ip);
-
         auto& ip_data = _ip_data[ip];
-        auto const& integration_weight = ip_data.integration_weight;
         auto const& H = ip_data.h_matrices;
-        auto& mat = ip_data.fracture_material;
-        auto& sigma = ip_data.sigma;
-        auto const& sigma_prev = ip_data.sigma_prev;
-        auto& w = ip_data.w;
-        auto const& w_prev = ip_data.w_prev;
-        auto& C = ip_data.C;
-        auto& state = *ip_data.material_state_variables;
         auto& N = _secondary_data.N[ip];
 
         Eigen::Vector3d const ip_physical_coords(
             computePhysicalCoordinates(_element, N).getCoords());
-        std::vector<double> const levelsets(duGlobalEnrichments(
+        ip_levelsets[ip] = duGlobalEnrichments(
             _fracture_property->fracture_id, _fracture_props, _junction_props,
-            _fracID_to_local, ip_physical_coords));
+            _fracID_to_local, ip_physical_coords);
+        auto const& levelsets = ip_levelsets[ip];
 
         // du = du^hat + sum_i(enrich^br_i(x) * [u]_i) + sum_i(enrich^junc_i(x)
         // * [u]_i)
@@ -208,19 +224,36 @@ void SmallDeformationLocalAssemblerFracture<
         }
 
         // displacement jumps
-        w.noalias() = R * H * nodal_gap;
+        ip_data.w.noalias() = R * H * nodal_gap;
 
         // total aperture
-        ip_data.aperture = ip_data.aperture0 + w[index_normal];
+        ip_data.aperture = ip_data.aperture0 + ip_data.w[index_normal];
 
-        // local C, local stress
-        mat.computeConstitutiveRelation(
-            t, x_position, ip_data.aperture0,
-            Eigen::Matrix<double, DisplacementDim, 1>::Zero(),  // TODO (naumov)
-                                                                // Replace with
-                                                                // initial
-                                                                // stress values
-            w_prev, w, sigma_prev, sigma, C, state);
+        aperture0s[ip] = ip_data.aperture0;
+        ws[ip] = ip_data.w;
+        w_prevs[ip] = ip_data.w_prev;
+        sigma_prevs[ip] = ip_data.sigma_prev;
+        states[ip] = ip_data.material_state_variables.get();
+    }
+
+    // local C, local stress
+    _process_data._fracture_model->computeConstitutiveRelationBatch(
+        t, x_position, n_integration_points, aperture0s.data(),
+        Vector::Zero(),  // TODO (naumov) Replace with initial stress values
+        w_prevs.data(), ws.data(), sigma_prevs.data(), sigmas.data(),
+        Cs.data(), states.data());
+
+    for (unsigned ip = 0; ip < n_integration_points; ip++)
+    {
+        auto& ip_data = _ip_data[ip];
+        auto const& integration_weight = ip_data.integration_weight;
+        auto const& H = ip_data.h_matrices;
+        auto const& sigma = sigmas[ip];
+        auto const& C = Cs[ip];
+        auto const& levelsets = ip_levelsets[ip];
+
+        ip_data.sigma = sigma;
+        ip_data.C = C;
 
         // r_[u] += H^T*Stress
         for (unsigned i = 0; i < n_enrich_var; i++)
@@ -247,9 +247,6 @@ private:
         _ip_data;
 
     IntegrationMethod _integration_method;
-    std::vector<ShapeMatrices, Eigen::aligned_allocator<
-                                   typename ShapeMatricesType::ShapeMatrices>>
-        _shape_matrices;
     MeshLib::Element const& _element;
     SecondaryData<typename ShapeMatrices::ShapeType> _secondary_data;
 };
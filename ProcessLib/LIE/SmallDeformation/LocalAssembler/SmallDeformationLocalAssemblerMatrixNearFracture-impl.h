@@ -122,6 +122,20 @@ SmallDeformationLocalAssemblerMatrixNearFracture<ShapeFunction,
     {
         _junction_props.push_back(&_process_data.junction_properties[jid]);
     }
+
+    // The enrichments depend on the geometry only and are evaluated once.
+    auto const n_enrich_var = _fracture_props.size() + _junction_props.size();
+    _ip_levelsets.reserve(n_integration_points * n_enrich_var);
+    for (unsigned ip = 0; ip < n_integration_points; ip++)
+    {
+        Eigen::Vector3d const ip_physical_coords(
+            computePhysicalCoordinates(_element, _ip_data[ip].N).getCoords());
+        auto const levelsets =
+            uGlobalEnrichments(_fracture_props, _junction_props,
+                               _fracID_to_local, ip_physical_coords);
+        _ip_levelsets.insert(_ip_levelsets.end(), levelsets.begin(),
+                             levelsets.end());
+    }
 }
 
 template <typename ShapeFunction, typename IntegrationMethod,
@@ -219,11 +233,7 @@ void SmallDeformationLocalAssemblerMatrixNearFracture<
         auto const& dNdx = ip_data.dNdx;
 
         // levelset functions
-        Eigen::Vector3d const ip_physical_coords(
-            computePhysicalCoordinates(_element, N).getCoords());
-        std::vector<double> const levelsets(
-            uGlobalEnrichments(_fracture_props, _junction_props,
-                               _fracID_to_local, ip_physical_coords));
+        double const* const levelsets = &_ip_levelsets[ip * n_enrich_var];
 
         // u = u^hat + sum_i(enrich^br_i(x) * [u]_i) + sum_i(enrich^junc_i(x) *
         // [u]_i)
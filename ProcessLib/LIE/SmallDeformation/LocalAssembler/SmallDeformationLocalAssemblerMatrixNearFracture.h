@@ -267,6 +267,9 @@ private:
     std::vector<FractureProperty*> _fracture_props;
     std::vector<JunctionProperty*> _junction_props;
     std::unordered_map<int, int> _fracID_to_local;
+    /// Enrichment values of the fractures and junctions at the integration
+    /// points, stored integration point by integration point.
+    std::vector<double> _ip_levelsets;
 
     std::vector<IntegrationPointDataMatrix<ShapeMatricesType, BMatricesType,
                                            DisplacementDim>,
@@ -50,6 +50,13 @@ public:
                                           GlobalVector const& x,
                                           int const process_id) override;
 
+    /// The fracture material states are updated with the secondary
+    /// variables.
+    bool requiresSecondaryVariablesAtEachTimestep() const override
+    {
+        return true;
+    }
+
 private:
     using LocalAssemblerInterface = SmallDeformationLocalAssemblerInterface;
 
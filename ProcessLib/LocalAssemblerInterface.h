@@ -12,6 +12,7 @@
 
 #include <Eigen/Dense>
 
+#include "BaseLib/MonotonicArena.h"
 #include "NumLib/NumericsConfig.h"
 #include "MathLib/Point3d.h"
 
@@ -28,9 +29,12 @@ struct LocalCoupledSolutions;
 /*! Common interface for local assemblers
  * NumLib::ODESystemTag::FirstOrderImplicitQuasilinear ODE systems.
  *
+ * Local assemblers created within a BaseLib::MonotonicArenaScope are placed in
+ * the scope's arena, see Process::initialize().
+ *
  * \todo Generalize to other NumLib::ODESystemTag's.
  */
-class LocalAssemblerInterface
+class LocalAssemblerInterface : public BaseLib::ArenaAllocated
 {
 public:
     virtual ~LocalAssemblerInterface() = default;
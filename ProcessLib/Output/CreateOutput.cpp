@@ -11,12 +11,14 @@
 #include "CreateOutput.h"
 
 #include <logog/include/logog.hpp>
+#include <map>
 #include <memory>
 #include <tuple>
 
 #include "BaseLib/Algorithm.h"
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/FileTools.h"
+#include "BaseLib/StringTools.h"
 
 #include "MeshLib/Mesh.h"
 
@@ -31,8 +33,26 @@ std::unique_ptr<Output> createOutput(
 {
     DBUG("Parse output configuration:");
 
-    //! \ogs_file_param{prj__time_loop__output__type}
-    config.checkConfigParameter("type", "VTK");
+    auto const type =
+        //! \ogs_file_param{prj__time_loop__output__type}
+        config.getConfigParameter<std::string>("type");
+    auto const output_type = [&type] {
+        if (type == "VTK")
+        {
+            return Output::OutputType::VTK;
+        }
+        if (type == "XDMF")
+        {
+#ifndef OGS_USE_XDMF
+            OGS_FATAL(
+                "The XDMF output requires OGS to be built with "
+                "OGS_USE_XDMF=ON.");
+#endif
+            return Output::OutputType::XDMF;
+        }
+        OGS_FATAL("Unknown output type '%s'. Expected VTK or XDMF.",
+                  type.c_str());
+    }();
 
     auto const prefix =
         //! \ogs_file_param{prj__time_loop__output__prefix}
@@ -83,10 +103,43 @@ std::unique_ptr<Output> createOutput(
     auto const out_vars = config.getConfigSubtree("variables");
 
     std::set<std::string> output_variables;
-    for (auto out_var :
+    std::map<std::string, OutputVariableOptions> output_variable_options;
+    for (auto out_var_config :
          //! \ogs_file_param{prj__time_loop__output__variables__variable}
-         out_vars.getConfigParameterList<std::string>("variable"))
+         out_vars.getConfigParameterList("variable"))
     {
+        OutputVariableOptions options;
+        auto const precision =
+            //! \ogs_file_attr{prj__time_loop__output__variables__variable__precision}
+            out_var_config.getConfigAttribute<std::string>("precision",
+                                                           "double");
+        if (precision != "double" && precision != "float")
+        {
+            OGS_FATAL(
+                "Unknown output precision `%s'. Expected `double' or "
+                "`float'.",
+                precision.c_str());
+        }
+        options.single_precision = precision == "float";
+        options.quantization_error =
+            //! \ogs_file_attr{prj__time_loop__output__variables__variable__quantization_error}
+            out_var_config.getConfigAttribute<double>("quantization_error", 0);
+        options.output_every =
+            //! \ogs_file_attr{prj__time_loop__output__variables__variable__output_every}
+            out_var_config.getConfigAttribute<int>("output_every", 1);
+        if (options.output_every < 1)
+        {
+            OGS_FATAL("The output_every attribute must be positive.");
+        }
+        if (auto const meshes =
+                //! \ogs_file_attr{prj__time_loop__output__variables__variable__meshes}
+                out_var_config.getConfigAttributeOptional<std::string>(
+                    "meshes"))
+        {
+            options.mesh_names = BaseLib::splitString(*meshes);
+        }
+
+        auto const out_var = out_var_config.getValue<std::string>();
         if (output_variables.find(out_var) != output_variables.cend())
         {
             OGS_FATAL("output variable `%s' specified more than once.",
@@ -95,13 +148,52 @@ std::unique_ptr<Output> createOutput(
 
         DBUG("adding output variable `%s'", out_var.c_str());
         output_variables.insert(out_var);
+        if (options.single_precision || options.quantization_error > 0 ||
+            options.output_every > 1 || !options.mesh_names.empty())
+        {
+            output_variable_options.emplace(out_var, std::move(options));
+        }
     }
 
     //! \ogs_file_param{prj__time_loop__output__output_extrapolation_residuals}
     bool const output_residuals = config.getConfigParameter<bool>(
         "output_extrapolation_residuals", false);
 
-    ProcessOutput process_output{output_variables, output_residuals};
+    ProcessOutput process_output{output_variables, output_residuals,
+                                 std::move(output_variable_options)};
+
+    if (auto const markers_config =
+            //! \ogs_file_param{prj__time_loop__output__refinement_markers}
+            config.getConfigSubtreeOptional("refinement_markers"))
+    {
+        if (!output_residuals)
+        {
+            OGS_FATAL(
+                "The refinement markers are computed from the extrapolation "
+                "residuals, which requires output_extrapolation_residuals to "
+                "be enabled.");
+        }
+        RefinementMarkerParameters parameters;
+        parameters.refine_fraction =
+            //! \ogs_file_param{prj__time_loop__output__refinement_markers__refine_fraction}
+            markers_config->getConfigParameter<double>(
+                "refine_fraction", parameters.refine_fraction);
+        parameters.coarsen_fraction =
+            //! \ogs_file_param{prj__time_loop__output__refinement_markers__coarsen_fraction}
+            markers_config->getConfigParameter<double>(
+                "coarsen_fraction", parameters.coarsen_fraction);
+        if (!(parameters.refine_fraction > 0 &&
+              parameters.refine_fraction <= 1 &&
+              parameters.coarsen_fraction >= 0 &&
+              parameters.coarsen_fraction < 1))
+        {
+            OGS_FATAL(
+                "The refinement fraction must be in (0, 1] and the coarsening "
+                "fraction in [0, 1), got %g and %g.",
+                parameters.refine_fraction, parameters.coarsen_fraction);
+        }
+        process_output.refinement_markers = parameters;
+    }
 
     std::vector<std::string> mesh_names_for_output;
     //! \ogs_file_param{prj__time_loop__output__meshes}
@@ -128,15 +220,64 @@ std::unique_ptr<Output> createOutput(
         BaseLib::makeVectorUnique(fixed_output_times, std::greater<>());
     }
 
+    std::unique_ptr<ObservationPoints> observation_points;
+    if (auto const observation_points_config =
+            //! \ogs_file_param{prj__time_loop__output__observation_points}
+            config.getConfigSubtreeOptional("observation_points"))
+    {
+        std::vector<std::string> names;
+        std::vector<MathLib::Point3d> points;
+        for (auto point_config :
+             //! \ogs_file_param{prj__time_loop__output__observation_points__point}
+             observation_points_config->getConfigSubtreeList("point"))
+        {
+            names.push_back(
+                //! \ogs_file_param{prj__time_loop__output__observation_points__point__name}
+                point_config.getConfigParameter<std::string>("name"));
+            auto const coordinates =
+                //! \ogs_file_param{prj__time_loop__output__observation_points__point__coordinates}
+                point_config.getConfigParameter<std::vector<double>>(
+                    "coordinates");
+            if (coordinates.size() != 3)
+            {
+                OGS_FATAL(
+                    "The observation point '%s' needs three coordinates, got "
+                    "%d.",
+                    names.back().c_str(), coordinates.size());
+            }
+            points.emplace_back(std::array<double, 3>{
+                {coordinates[0], coordinates[1], coordinates[2]}});
+        }
+        auto variables =
+            //! \ogs_file_param{prj__time_loop__output__observation_points__variables}
+            observation_points_config->getConfigParameter<
+                std::vector<std::string>>("variables", {});
+        observation_points = std::make_unique<ObservationPoints>(
+            std::move(names), std::move(points), std::move(variables));
+    }
+
+    std::unique_ptr<StreamOutput> stream_output;
+    if (auto const stream_path =
+            //! \ogs_file_param{prj__time_loop__output__stream}
+            config.getConfigParameterOptional<std::string>("stream"))
+    {
+        stream_output = std::make_unique<StreamOutput>(*stream_path);
+    }
+
     bool const output_iteration_results =
         //! \ogs_file_param{prj__time_loop__output__output_iteration_results}
         config.getConfigParameter<bool>("output_iteration_results", false);
 
+    bool const asynchronous =
+        //! \ogs_file_param{prj__time_loop__output__asynchronous}
+        config.getConfigParameter<bool>("asynchronous", false);
+
     return std::make_unique<Output>(
-        output_directory, prefix, compress_output, data_mode,
-        output_iteration_results, std::move(repeats_each_steps),
+        output_directory, output_type, prefix, compress_output, data_mode,
+        output_iteration_results, asynchronous, std::move(repeats_each_steps),
         std::move(fixed_output_times), std::move(process_output),
-        std::move(mesh_names_for_output), meshes);
+        std::move(mesh_names_for_output), meshes,
+        std::move(observation_points), std::move(stream_output));
 }
 
 }  // namespace ProcessLib
@@ -0,0 +1,252 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ObservationPoints.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Location.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshSearch/MeshElementGrid.h"
+#include "MeshLib/Node.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/Fem/ShapeFunctionValuesAtPoint.h"
+#include "ProcessLib/Process.h"
+#include "ProcessLib/ProcessVariable.h"
+
+namespace
+{
+std::string columnName(std::string const& name, int const n_components,
+                       int const component)
+{
+    return n_components == 1 ? name : name + "_" + std::to_string(component);
+}
+}  // namespace
+
+namespace ProcessLib
+{
+ObservationPoints::ObservationPoints(std::vector<std::string> names,
+                                     std::vector<MathLib::Point3d> points,
+                                     std::vector<std::string> variables)
+    : _names(std::move(names)),
+      _points(std::move(points)),
+      _variables(std::move(variables))
+{
+#ifdef USE_PETSC
+    OGS_FATAL("Observation points are not supported in parallel runs.");
+#endif
+}
+
+std::vector<ObservationPoints::Probe> const& ObservationPoints::getProbes(
+    MeshLib::Mesh const& mesh)
+{
+    auto& probes = _probes[&mesh];
+    if (!probes.empty())
+    {
+        return probes;
+    }
+
+    MeshLib::MeshElementGrid const grid(mesh);
+    auto const& min = grid.getMinPoint();
+    auto const& max = grid.getMaxPoint();
+    double const eps =
+        1e-10 * std::max({max[0] - min[0], max[1] - min[1], max[2] - min[2]});
+
+    for (std::size_t i = 0; i < _points.size(); ++i)
+    {
+        auto const& p = _points[i];
+        MathLib::Point3d const p_min{{p[0] - eps, p[1] - eps, p[2] - eps}};
+        MathLib::Point3d const p_max{{p[0] + eps, p[1] + eps, p[2] + eps}};
+        auto const candidates = grid.getElementsInVolume(p_min, p_max);
+        auto const element = std::find_if(
+            candidates.begin(), candidates.end(),
+            [&](auto const* e) { return e->isPntInElement(p, eps); });
+        if (element == candidates.end())
+        {
+            OGS_FATAL(
+                "The observation point '%s' at (%g, %g, %g) is not inside "
+                "the mesh '%s'.",
+                _names[i].c_str(), p[0], p[1], p[2], mesh.getName().c_str());
+        }
+
+        auto shape_function_values =
+            NumLib::shapeFunctionValuesAtPoint(**element, p);
+        probes.push_back({*element, std::move(shape_function_values.first),
+                          std::move(shape_function_values.second)});
+        DBUG("Observation point '%s' is located in element %d.",
+             _names[i].c_str(), (*element)->getID());
+    }
+    return probes;
+}
+
+bool ObservationPoints::isObserved(
+    std::string const& name,
+    std::set<std::string> const& output_variables) const
+{
+    if (_variables.empty())
+    {
+        return output_variables.count(name) != 0;
+    }
+    return std::find(_variables.begin(), _variables.end(), name) !=
+           _variables.end();
+}
+
+bool ObservationPoints::observesSecondaryVariables(
+    Process const& process, std::set<std::string> const& output_variables) const
+{
+    auto const& secondary_variables = process.getSecondaryVariables();
+    return std::any_of(secondary_variables.begin(), secondary_variables.end(),
+                       [&](auto const& name_variable) {
+                           return isObserved(name_variable.first,
+                                             output_variables);
+                       });
+}
+
+void ObservationPoints::write(Process const& process,
+                              std::string const& file_name_base,
+                              std::set<std::string> const& output_variables,
+                              double const t,
+                              std::vector<GlobalVector*> const& x)
+{
+    auto const& mesh = process.getMesh();
+    auto const& probes = getProbes(mesh);
+
+    std::vector<std::string> columns;
+    std::vector<std::vector<double>> rows(probes.size());
+    std::set<std::string> already_observed;
+
+    // Primary variables of all processes of a staggered coupling.
+    std::vector<NumLib::LocalToGlobalIndexMap const*> dof_tables;
+    for (std::size_t process_id = 0; process_id < x.size(); ++process_id)
+    {
+        auto const& dof_table = process.getDOFTable(process_id);
+        dof_tables.push_back(&dof_table);
+        auto const& process_variables =
+            process.getProcessVariables(process_id);
+        int global_component_offset = 0;
+        for (ProcessVariable const& pv : process_variables)
+        {
+            int const n_components = pv.getNumberOfComponents();
+            int const component_offset = global_component_offset;
+            if (dof_table.getNumberOfVariables() > 1)
+            {
+                global_component_offset += n_components;
+            }
+            if (!isObserved(pv.getName(), output_variables) ||
+                !already_observed.insert(pv.getName()).second)
+            {
+                continue;
+            }
+
+            bool const linear = pv.getShapeFunctionOrder() == 1;
+            for (int component = 0; component < n_components; ++component)
+            {
+                columns.push_back(
+                    columnName(pv.getName(), n_components, component));
+                for (std::size_t p = 0; p < probes.size(); ++p)
+                {
+                    auto const& N = linear ? probes[p].N_linear : probes[p].N;
+                    double value = 0;
+                    for (std::size_t i = 0; i < N.size(); ++i)
+                    {
+                        MeshLib::Location const l(
+                            mesh.getID(), MeshLib::MeshItemType::Node,
+                            probes[p].element->getNodeIndex(i));
+                        auto const index = dof_table.getLocalIndex(
+                            l, component_offset + component,
+                            x[process_id]->getRangeBegin(),
+                            x[process_id]->getRangeEnd());
+                        if (index == NumLib::MeshComponentMap::nop)
+                        {
+                            // The variable is not defined in the element.
+                            value = std::numeric_limits<double>::quiet_NaN();
+                            break;
+                        }
+                        value += N[i] * x[process_id]->get(index);
+                    }
+                    rows[p].push_back(value);
+                }
+            }
+        }
+    }
+
+    auto const& secondary_variables = process.getSecondaryVariables();
+    for (auto const& name_variable : secondary_variables)
+    {
+        auto const& name = name_variable.first;
+        if (!isObserved(name, output_variables) ||
+            !already_observed.insert(name).second)
+        {
+            continue;
+        }
+
+        auto const& variable = secondary_variables.get(name);
+        std::unique_ptr<GlobalVector> result_cache;
+        auto const& nodal_values =
+            variable.fcts.eval_field(t, x, dof_tables, result_cache);
+        int const n_components = variable.fcts.num_components;
+        for (int component = 0; component < n_components; ++component)
+        {
+            columns.push_back(columnName(name, n_components, component));
+            for (std::size_t p = 0; p < probes.size(); ++p)
+            {
+                auto const& N = probes[p].N;
+                double value = 0;
+                for (std::size_t i = 0; i < N.size(); ++i)
+                {
+                    value +=
+                        N[i] *
+                        nodal_values.get(probes[p].element->getNodeIndex(i) *
+                                             n_components +
+                                         component);
+                }
+                rows[p].push_back(value);
+            }
+        }
+    }
+
+    auto& os = _files[file_name_base];
+    if (!os)
+    {
+        auto const file_name = file_name_base + ".csv";
+        os = std::make_unique<std::ofstream>(file_name);
+        if (!*os)
+        {
+            OGS_FATAL("Could not open file '%s' for the observation points.",
+                      file_name.c_str());
+        }
+        *os << std::setprecision(std::numeric_limits<double>::max_digits10);
+        *os << "time,point";
+        for (auto const& column : columns)
+        {
+            *os << ',' << column;
+        }
+        *os << '\n';
+    }
+
+    for (std::size_t p = 0; p < probes.size(); ++p)
+    {
+        *os << t << ',' << _names[p];
+        for (auto const value : rows[p])
+        {
+            *os << ',' << value;
+        }
+        *os << '\n';
+    }
+    // Keep the file usable if the simulation is aborted later.
+    os->flush();
+}
+}  // namespace ProcessLib
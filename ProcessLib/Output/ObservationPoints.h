@@ -0,0 +1,93 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
+#include "MathLib/Point3d.h"
+
+namespace MeshLib
+{
+class Element;
+class Mesh;
+}  // namespace MeshLib
+
+namespace ProcessLib
+{
+class Process;
+
+//! Writes the values of the output variables at a few points of the domain at
+//! every timestep, like observation wells, without writing the whole meshes.
+//!
+//! The points are located in the process mesh on the first output. Then at
+//! each output the primary variables are interpolated with the shape
+//! functions of the enclosing element. The secondary variables are
+//! interpolated from their nodal values, which requires the extrapolation to
+//! the whole mesh.
+//!
+//! One CSV file per process is written with the columns \c time, \c point,
+//! and one column per component of the observed variables.
+class ObservationPoints final
+{
+public:
+    //! Observes the given \c variables, or all output variables if empty, at
+    //! the named \c points.
+    ObservationPoints(std::vector<std::string> names,
+                      std::vector<MathLib::Point3d> points,
+                      std::vector<std::string> variables);
+
+    //! Appends the values of the observed variables at time \c t to the file
+    //! <tt>\<file_name_base\>.csv</tt>, which is created on the first call.
+    //! The secondary variables of the process must be up to date.
+    void write(Process const& process, std::string const& file_name_base,
+               std::set<std::string> const& output_variables, double const t,
+               std::vector<GlobalVector*> const& x);
+
+    //! Returns if any secondary variable of the \c process is observed.
+    bool observesSecondaryVariables(
+        Process const& process,
+        std::set<std::string> const& output_variables) const;
+
+private:
+    //! A point located in an element of the process mesh.
+    struct Probe
+    {
+        MeshLib::Element const* element;
+        //! Shape function values at the point for all nodes of the element.
+        std::vector<double> N;
+        //! Shape function values at the point for the base nodes of the
+        //! element, used for linear variables on higher order meshes.
+        std::vector<double> N_linear;
+    };
+
+    std::vector<Probe> const& getProbes(MeshLib::Mesh const& mesh);
+
+    //! Returns if the variable \c name is written.
+    bool isObserved(std::string const& name,
+                    std::set<std::string> const& output_variables) const;
+
+    std::vector<std::string> const _names;
+    std::vector<MathLib::Point3d> const _points;
+    std::vector<std::string> const _variables;
+
+    //! The located points by the mesh they are located in.
+    std::map<MeshLib::Mesh const*, std::vector<Probe>> _probes;
+
+    //! The open output files by their name.
+    std::map<std::string, std::unique_ptr<std::ofstream>> _files;
+};
+}  // namespace ProcessLib
@@ -93,15 +93,20 @@ bool Output::shallDoOutput(int timestep, double const t)
     return make_output;
 }
 
-Output::Output(std::string output_directory, std::string output_file_prefix,
+Output::Output(std::string output_directory, OutputType const output_type,
+               std::string output_file_prefix,
                bool const compress_output, std::string const& data_mode,
                bool const output_nonlinear_iteration_results,
+               bool const asynchronous_output,
                std::vector<PairRepeatEachSteps> repeats_each_steps,
                std::vector<double>&& fixed_output_times,
                ProcessOutput&& process_output,
                std::vector<std::string>&& mesh_names_for_output,
-               std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes)
+               std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes,
+               std::unique_ptr<ObservationPoints>&& observation_points,
+               std::unique_ptr<StreamOutput>&& stream_output)
     : _output_directory(std::move(output_directory)),
+      _output_type(output_type),
       _output_file_prefix(std::move(output_file_prefix)),
       _output_file_compression(compress_output),
       _output_file_data_mode(convertVtkDataMode(data_mode)),
@@ -110,8 +115,18 @@ Output::Output(std::string output_directory, std::string output_file_prefix,
       _fixed_output_times(std::move(fixed_output_times)),
       _process_output(std::move(process_output)),
       _mesh_names_for_output(mesh_names_for_output),
-      _meshes(meshes)
+      _meshes(meshes),
+      _observation_points(std::move(observation_points)),
+      _stream_output(std::move(stream_output))
 {
+    if (asynchronous_output)
+    {
+        if (_output_type == OutputType::XDMF)
+        {
+            WARN("The XDMF output is always written synchronously.");
+        }
+        _output_queue = std::make_unique<BaseLib::BackgroundTaskQueue>(1);
+    }
 }
 
 void Output::addProcess(ProcessLib::Process const& process,
@@ -178,21 +193,143 @@ struct Output::OutputFile
 void Output::outputBulkMesh(OutputFile const& output_file,
                             ProcessData* const process_data,
                             MeshLib::Mesh const& mesh,
-                            double const t) const
+                            double const t)
+{
+    outputMeshVtu(output_file, &process_data->pvd_file, mesh, t);
+}
+
+void Output::outputMeshVtu(OutputFile const& output_file,
+                           MeshLib::IO::PVDFile* const pvd_file,
+                           MeshLib::Mesh const& mesh, double const t)
 {
     DBUG("output to %s", output_file.path.c_str());
 
-    process_data->pvd_file.addVTUFile(output_file.name, t);
+    if (!_output_queue)
+    {
+        if (pvd_file)
+        {
+            pvd_file->addVTUFile(output_file.name, t);
+        }
+        makeOutput(output_file.path, mesh, output_file.compression,
+                   output_file.data_mode);
+        return;
+    }
+
+    // Only the properties change between the outputs of a mesh.
+    auto& staging = _staging_meshes[mesh.getName()];
+    auto& staging_mesh = staging.meshes[staging.next];
+    staging.next = (staging.next + 1) % staging.meshes.size();
+    if (!staging_mesh)
+    {
+        staging_mesh = std::make_unique<MeshLib::Mesh>(mesh);
+    }
+    else
+    {
+        staging_mesh->getProperties() = mesh.getProperties();
+    }
 
-    makeOutput(output_file.path, mesh, output_file.compression,
-               output_file.data_mode);
+    _output_queue->push(
+        [output_file, pvd_file, &mesh = *staging_mesh, t]() {
+            makeOutput(output_file.path, mesh, output_file.compression,
+                       output_file.data_mode);
+            if (pvd_file)
+            {
+                pvd_file->addVTUFile(output_file.name, t);
+            }
+        });
 }
 
-void Output::doOutputAlways(Process const& process,
-                            const int process_id,
-                            const int timestep,
-                            const double t,
-                            std::vector<GlobalVector*> const& x)
+void Output::outputMeshXdmf(ProcessData& process_data,
+                            MeshLib::Mesh const& mesh,
+                            std::string const& file_base,
+                            double const t) const
+{
+#ifdef OGS_USE_XDMF
+    auto& writer = process_data.xdmf_writers[mesh.getName()];
+    if (!writer)
+    {
+        writer = std::make_unique<MeshLib::IO::XdmfHdfWriter>(
+            mesh, BaseLib::joinPaths(_output_directory, file_base),
+            _output_file_compression);
+    }
+    DBUG("XDMF output of mesh '%s' at t = %g", mesh.getName().c_str(), t);
+    writer->writeStep(t);
+#else
+    (void)process_data;
+    (void)mesh;
+    (void)file_base;
+    (void)t;
+    OGS_FATAL("OGS has been built without XDMF output support.");
+#endif
+}
+
+void Output::streamMesh(MeshLib::Mesh const& mesh, int const process_id,
+                        int const timestep, double const t)
+{
+    if (!_stream_output)
+    {
+        return;
+    }
+
+    // The record is a copy of the fields, hence the mesh can change while it
+    // is written.
+    auto record = StreamOutput::makeRecord(mesh, process_id, timestep, t);
+    if (!_output_queue)
+    {
+        _stream_output->write(record);
+        return;
+    }
+    _output_queue->push(
+        [stream_output = _stream_output.get(), record = std::move(record)]() {
+            stream_output->write(record);
+        });
+}
+
+Output::OutputMeshData const& Output::getOutputMeshData(
+    Process const& process, MeshLib::Mesh const& mesh,
+    std::size_t const number_of_dof_tables)
+{
+    auto& data = _output_mesh_data[{&process, mesh.getName()}];
+    if (data.dof_tables.size() == number_of_dof_tables)
+    {
+        return data;
+    }
+
+    DBUG("Deriving the DOF tables for the output of %d nodes of mesh '%s'.",
+         mesh.getNumberOfNodes(), mesh.getName().c_str());
+    data.dof_tables.clear();
+    data.dof_table_pointers.clear();
+    for (std::size_t i = 0; i < number_of_dof_tables; ++i)
+    {
+        MeshLib::MeshSubset mesh_subset(mesh, mesh.getNodes());
+        data.dof_tables.push_back(
+            process.getDOFTable(i).deriveBoundaryConstrainedMap(
+                std::move(mesh_subset)));
+        data.dof_table_pointers.push_back(data.dof_tables.back().get());
+    }
+
+    auto const& properties = mesh.getProperties();
+    if (properties.existsPropertyVector<std::size_t>("bulk_node_ids"))
+    {
+        auto const& bulk_node_ids = *properties.getPropertyVector<std::size_t>(
+            "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
+        data.bulk_node_ids.assign(bulk_node_ids.begin(), bulk_node_ids.end());
+    }
+    else
+    {
+        WARN(
+            "The output mesh '%s' has no bulk_node_ids; the secondary "
+            "variables are not written for it.",
+            mesh.getName().c_str());
+    }
+    return data;
+}
+
+void Output::writeOutput(Process& process,
+                         const int process_id,
+                         const int timestep,
+                         const double t,
+                         std::vector<GlobalVector*> const& x)
 {
     BaseLib::RunTime time_output;
     time_output.start();
@@ -204,13 +341,18 @@ void Output::doOutputAlways(Process const& process,
         dof_tables.push_back(&process.getDOFTable(i));
     }
 
-    bool output_secondary_variable = true;
+    auto const output_index =
+        findProcessData(process, process_id)->number_of_outputs++;
+
+    process.updateSecondaryVariables(process_id);
+
+    auto& bulk_mesh = process.getMesh();
     // Need to add variables of process to vtu even no output takes place.
-    processOutputData(t, x, process_id, process.getMesh(), dof_tables,
-                      process.getProcessVariables(process_id),
-                      process.getSecondaryVariables(),
-                      output_secondary_variable,
-                      process.getIntegrationPointWriter(), _process_output);
+    bool const output_secondary_variable = true;
+    addProcessOutputData(t, x, process_id, bulk_mesh, dof_tables,
+                         process.getProcessVariables(process_id),
+                         process.getSecondaryVariables(),
+                         output_secondary_variable, _process_output);
 
     // For the staggered scheme for the coupling, only the last process, which
     // gives the latest solution within a coupling loop, is allowed to make
@@ -218,15 +360,65 @@ void Output::doOutputAlways(Process const& process,
     if (!(process_id == static_cast<int>(_process_to_process_data.size()) - 1 ||
           process.isMonolithicSchemeUsed()))
     {
+        finishProcessOutputData(bulk_mesh, process.getIntegrationPointWriter(),
+                                _process_output, output_index);
         return;
     }
 
+    auto find_mesh = [&](std::string const& mesh_output_name)
+        -> MeshLib::Mesh& {
+        return *BaseLib::findElementOrError(
+            begin(_meshes), end(_meshes),
+            [&mesh_output_name](auto const& m) {
+                return m->getName() == mesh_output_name;
+            },
+            "Need mesh '" + mesh_output_name + "' for the output.");
+    };
+
+    // The secondary variables are extrapolated on the bulk mesh only and
+    // gathered onto the other output meshes before the output options, which
+    // might remove them from the bulk mesh, are applied.
+    for (auto const& mesh_output_name : _mesh_names_for_output)
+    {
+        if (bulk_mesh.getName() == mesh_output_name)
+        {
+            continue;
+        }
+        auto& mesh = find_mesh(mesh_output_name);
+        auto const& mesh_data = getOutputMeshData(process, mesh, x.size());
+
+        addProcessOutputData(t, x, process_id, mesh,
+                             mesh_data.dof_table_pointers,
+                             process.getProcessVariables(process_id),
+                             process.getSecondaryVariables(),
+                             !output_secondary_variable, _process_output);
+        if (!mesh_data.bulk_node_ids.empty())
+        {
+            gatherSecondaryVariables(process.getSecondaryVariables(),
+                                     bulk_mesh, mesh_data.bulk_node_ids, mesh);
+        }
+        finishProcessOutputData(mesh, process.getIntegrationPointWriter(),
+                                _process_output, output_index);
+    }
+    finishProcessOutputData(bulk_mesh, process.getIntegrationPointWriter(),
+                            _process_output, output_index);
+
     auto output_bulk_mesh = [&]() {
+        streamMesh(bulk_mesh, process_id, timestep, t);
+        if (_output_type == OutputType::XDMF)
+        {
+            outputMeshXdmf(*findProcessData(process, process_id),
+                           bulk_mesh,
+                           _output_file_prefix + "_pcs_" +
+                               std::to_string(process_id),
+                           t);
+            return;
+        }
         outputBulkMesh(
             OutputFile(_output_directory, _output_file_prefix, process_id,
                        timestep, t, _output_file_data_mode,
                        _output_file_compression),
-            findProcessData(process, process_id), process.getMesh(), t);
+            findProcessData(process, process_id), bulk_mesh, t);
     };
     // Write the bulk mesh only if there are no other meshes specified for
     // output, otherwise only the specified meshes are written.
@@ -237,48 +429,22 @@ void Output::doOutputAlways(Process const& process,
 
     for (auto const& mesh_output_name : _mesh_names_for_output)
     {
-        if (process.getMesh().getName() == mesh_output_name)
+        if (bulk_mesh.getName() == mesh_output_name)
         {
             output_bulk_mesh();
             continue;
         }
-        auto& mesh = *BaseLib::findElementOrError(
-            begin(_meshes), end(_meshes),
-            [&mesh_output_name](auto const& m) {
-                return m->getName() == mesh_output_name;
-            },
-            "Need mesh '" + mesh_output_name + "' for the output.");
-
-        std::vector<MeshLib::Node*> const& nodes = mesh.getNodes();
-        DBUG(
-            "Found %d nodes for output at mesh '%s'.",
-            nodes.size(), mesh.getName().c_str());
+        auto& mesh = find_mesh(mesh_output_name);
+        streamMesh(mesh, process_id, timestep, t);
 
-        MeshLib::MeshSubset mesh_subset(mesh, nodes);
-        std::vector<std::unique_ptr<NumLib::LocalToGlobalIndexMap>>
-            mesh_dof_tables;
-        mesh_dof_tables.reserve(x.size());
-        for (std::size_t i = 0; i < x.size(); ++i)
+        if (_output_type == OutputType::XDMF)
         {
-            mesh_dof_tables.push_back(
-                process.getDOFTable(i).deriveBoundaryConstrainedMap(
-                    std::move(mesh_subset)));
+            outputMeshXdmf(*findProcessData(process, process_id), mesh,
+                           mesh.getName() + "_pcs_" +
+                               std::to_string(process_id),
+                           t);
+            continue;
         }
-        std::vector<NumLib::LocalToGlobalIndexMap const*>
-            mesh_dof_table_pointers;
-        mesh_dof_table_pointers.reserve(mesh_dof_tables.size());
-        transform(cbegin(mesh_dof_tables), cend(mesh_dof_tables),
-                  back_inserter(mesh_dof_table_pointers),
-                  [](std::unique_ptr<NumLib::LocalToGlobalIndexMap> const& p) {
-                      return p.get();
-                  });
-
-        output_secondary_variable = false;
-        processOutputData(t, x, process_id, mesh, mesh_dof_table_pointers,
-                          process.getProcessVariables(process_id),
-                          process.getSecondaryVariables(),
-                          output_secondary_variable,
-                          process.getIntegrationPointWriter(), _process_output);
 
         // TODO (TomFischer): add pvd support here. This can be done if the
         // output is mesh related instead of process related. This would also
@@ -292,33 +458,81 @@ void Output::doOutputAlways(Process const& process,
                                      _output_file_data_mode,
                                      _output_file_compression};
 
-        DBUG("output to %s", output_file.path.c_str());
-
-        makeOutput(output_file.path, mesh, output_file.compression,
-                   output_file.data_mode);
+        outputMeshVtu(output_file, nullptr, mesh, t);
     }
     INFO("[time] Output of timestep %d took %g s.", timestep,
          time_output.elapsed());
 }
 
-void Output::doOutput(Process const& process,
+void Output::writeObservations(Process& process,
+                               const int process_id,
+                               const double t,
+                               std::vector<GlobalVector*> const& x,
+                               bool const secondary_variables_updated)
+{
+    // As for the meshes, the last process of a staggered coupling writes the
+    // variables of all processes.
+    if (!(process_id == static_cast<int>(_process_to_process_data.size()) - 1 ||
+          process.isMonolithicSchemeUsed()))
+    {
+        return;
+    }
+
+    auto const& output_variables = _process_output.output_variables;
+    if (!secondary_variables_updated &&
+        _observation_points->observesSecondaryVariables(process,
+                                                        output_variables))
+    {
+        for (int i = 0; i < static_cast<int>(x.size()); ++i)
+        {
+            process.updateSecondaryVariables(i);
+        }
+    }
+    _observation_points->write(
+        process,
+        BaseLib::joinPaths(_output_directory,
+                           _output_file_prefix + "_observations_pcs_" +
+                               std::to_string(process_id)),
+        output_variables, t, x);
+}
+
+void Output::doOutputAlways(Process& process,
+                            const int process_id,
+                            const int timestep,
+                            const double t,
+                            std::vector<GlobalVector*> const& x)
+{
+    writeOutput(process, process_id, timestep, t, x);
+    if (_output_queue)
+    {
+        _output_queue->wait();
+    }
+}
+
+void Output::doOutput(Process& process,
                       const int process_id,
                       const int timestep,
                       const double t,
                       std::vector<GlobalVector*> const& x)
 {
-    if (shallDoOutput(timestep, t))
+    bool const output = shallDoOutput(timestep, t);
+    if (output)
+    {
+        writeOutput(process, process_id, timestep, t, x);
+    }
+    if (_observation_points)
     {
-        doOutputAlways(process, process_id, timestep, t, x);
+        writeObservations(process, process_id, t, x, output);
     }
 #ifdef USE_INSITU
     // Note: last time step may be output twice: here and in
     // doOutputLastTimestep() which throws a warning.
+    process.updateSecondaryVariables(process_id);
     InSituLib::CoProcess(process.getMesh(), t, timestep, false);
 #endif
 }
 
-void Output::doOutputLastTimestep(Process const& process,
+void Output::doOutputLastTimestep(Process& process,
                                   const int process_id,
                                   const int timestep,
                                   const double t,
@@ -326,14 +540,19 @@ void Output::doOutputLastTimestep(Process const& process,
 {
     if (!shallDoOutput(timestep, t))
     {
-        doOutputAlways(process, process_id, timestep, t, x);
+        writeOutput(process, process_id, timestep, t, x);
+    }
+    if (_output_queue)
+    {
+        _output_queue->wait();
     }
 #ifdef USE_INSITU
+    process.updateSecondaryVariables(process_id);
     InSituLib::CoProcess(process.getMesh(), t, timestep, true);
 #endif
 }
 
-void Output::doOutputNonlinearIteration(Process const& process,
+void Output::doOutputNonlinearIteration(Process& process,
                                         const int process_id,
                                         const int timestep, const double t,
                                         std::vector<GlobalVector*> const& x,
@@ -343,6 +562,7 @@ void Output::doOutputNonlinearIteration(Process const& process,
     {
         return;
     }
+    std::lock_guard<std::mutex> const lock(_nonlinear_iteration_output_mutex);
 
     BaseLib::RunTime time_output;
     time_output.start();
@@ -353,12 +573,17 @@ void Output::doOutputNonlinearIteration(Process const& process,
         dof_tables.push_back(&process.getDOFTable(i));
     }
 
+    // The variables are selected as for the next regular output.
+    auto const output_index =
+        findProcessData(process, process_id)->number_of_outputs;
+
     bool const output_secondary_variable = true;
     processOutputData(t, x, process_id, process.getMesh(), dof_tables,
                       process.getProcessVariables(process_id),
                       process.getSecondaryVariables(),
                       output_secondary_variable,
-                      process.getIntegrationPointWriter(), _process_output);
+                      process.getIntegrationPointWriter(), _process_output,
+                      output_index);
 
     // For the staggered scheme for the coupling, only the last process, which
     // gives the latest solution within a coupling loop, is allowed to make
@@ -369,9 +594,6 @@ void Output::doOutputNonlinearIteration(Process const& process,
         return;
     }
 
-    // Only check whether a process data is available for output.
-    findProcessData(process, process_id);
-
     std::string const output_file_name =
         constructFileName(_output_file_prefix, process_id, timestep, t) +
         "_nliter_" + std::to_string(iteration) + ".vtu";
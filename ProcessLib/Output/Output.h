@@ -10,11 +10,21 @@
 
 #pragma once
 
+#include <array>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <utility>
 
+#include "BaseLib/BackgroundTaskQueue.h"
 #include "MeshLib/IO/VtkIO/PVDFile.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#ifdef OGS_USE_XDMF
+#include "MeshLib/IO/XDMF/XdmfHdfWriter.h"
+#endif
+#include "ObservationPoints.h"
 #include "ProcessOutput.h"
+#include "StreamOutput.h"
 
 namespace ProcessLib
 {
@@ -36,42 +46,57 @@ public:
         const int each_steps;  //!< Do output every \c each_steps timestep.
     };
 
+    //! File format of the output.
+    enum class OutputType
+    {
+        VTK,  //!< One vtu file per mesh and timestep indexed by a pvd file.
+        XDMF  //!< One HDF5 file per mesh with an XDMF index.
+    };
+
 public:
-    Output(std::string output_directory, std::string prefix,
+    Output(std::string output_directory, OutputType const output_type,
+           std::string prefix,
            bool const compress_output, std::string const& data_mode,
            bool const output_nonlinear_iteration_results,
+           bool const asynchronous_output,
            std::vector<PairRepeatEachSteps> repeats_each_steps,
            std::vector<double>&& fixed_output_times,
            ProcessOutput&& process_output,
            std::vector<std::string>&& mesh_names_for_output,
-           std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes);
+           std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes,
+           std::unique_ptr<ObservationPoints>&& observation_points,
+           std::unique_ptr<StreamOutput>&& stream_output);
 
     //! TODO doc. Opens a PVD file for each process.
     void addProcess(ProcessLib::Process const& process, const int process_id);
 
     //! Writes output for the given \c process if it should be written in the
-    //! given \c timestep.
-    void doOutput(Process const& process, const int process_id,
+    //! given \c timestep. The outdated secondary variables of the process are
+    //! computed only if output is written or secondary variables are
+    //! observed. The observation points are written at every timestep.
+    void doOutput(Process& process, const int process_id,
                   const int timestep, const double t,
                   std::vector<GlobalVector*> const& x);
 
     //! Writes output for the given \c process if it has not been written yet.
     //! This method is intended for doing output after the last timestep in
-    //! order to make sure that its results are written.
-    void doOutputLastTimestep(Process const& process, const int process_id,
+    //! order to make sure that its results are written. Waits for the
+    //! asynchronous output.
+    void doOutputLastTimestep(Process& process, const int process_id,
                               const int timestep, const double t,
                               std::vector<GlobalVector*> const& x);
 
     //! Writes output for the given \c process.
     //! This method will always write.
-    //! It is intended to write output in error handling routines.
-    void doOutputAlways(Process const& process, const int process_id,
+    //! It is intended to write output in error handling routines, therefore
+    //! it waits for the asynchronous output.
+    void doOutputAlways(Process& process, const int process_id,
                         const int timestep, const double t,
                         std::vector<GlobalVector*> const& x);
 
     //! Writes output for the given \c process.
     //! To be used for debug output after an iteration of the nonlinear solver.
-    void doOutputNonlinearIteration(Process const& process,
+    void doOutputNonlinearIteration(Process& process,
                                     const int process_id, const int timestep,
                                     const double t,
                                     std::vector<GlobalVector*> const& x,
@@ -87,16 +112,80 @@ private:
         }
 
         MeshLib::IO::PVDFile pvd_file;
+        //! Number of outputs of the process, which selects the variables
+        //! written with a reduced frequency.
+        std::size_t number_of_outputs = 0;
+#ifdef OGS_USE_XDMF
+        //! The XDMF writers of the output meshes by mesh name, which are
+        //! created on the first output.
+        std::map<std::string, std::unique_ptr<MeshLib::IO::XdmfHdfWriter>>
+            xdmf_writers;
+#endif
+    };
+
+    //! Two copies of an output mesh, which are filled alternately with the
+    //! properties of the mesh for the asynchronous output.
+    struct StagingMeshes
+    {
+        std::array<std::unique_ptr<MeshLib::Mesh>, 2> meshes;
+        std::size_t next = 0;
     };
 
+    //! The data of an output mesh other than the bulk mesh of a process,
+    //! which are derived on the first output of the mesh.
+    struct OutputMeshData
+    {
+        std::vector<std::unique_ptr<NumLib::LocalToGlobalIndexMap>> dof_tables;
+        std::vector<NumLib::LocalToGlobalIndexMap const*> dof_table_pointers;
+        //! Gather indices of the secondary variables from the bulk mesh; empty
+        //! if the mesh has no bulk node ids.
+        std::vector<std::size_t> bulk_node_ids;
+    };
+
+    //! Returns the derived data of the output \c mesh for the \c process.
+    OutputMeshData const& getOutputMeshData(
+        Process const& process, MeshLib::Mesh const& mesh,
+        std::size_t const number_of_dof_tables);
+
     struct OutputFile;
     void outputBulkMesh(OutputFile const& output_file,
                         ProcessData* const process_data,
                         MeshLib::Mesh const& mesh,
-                        double const t) const;
+                        double const t);
+
+    //! Writes the \c mesh to a vtu file, in the background for asynchronous
+    //! output. If a \c pvd_file is given the vtu file is added to it
+    //! afterwards.
+    void outputMeshVtu(OutputFile const& output_file,
+                       MeshLib::IO::PVDFile* const pvd_file,
+                       MeshLib::Mesh const& mesh, double const t);
+
+    //! Publishes the \c mesh to the output stream if there is one, in the
+    //! background for asynchronous output.
+    void streamMesh(MeshLib::Mesh const& mesh, int const process_id,
+                    int const timestep, double const t);
+
+    //! Writes output if the process is the last one of a staggered coupling or
+    //! monolithic.
+    void writeOutput(Process& process, const int process_id,
+                     const int timestep, const double t,
+                     std::vector<GlobalVector*> const& x);
+
+    //! Appends the values at the observation points if the process is the
+    //! last one of a staggered coupling or monolithic.
+    void writeObservations(Process& process, const int process_id,
+                           const double t,
+                           std::vector<GlobalVector*> const& x,
+                           bool const secondary_variables_updated);
+
+    //! Appends the data of the \c mesh at time \c t to the XDMF output with
+    //! the given file name base.
+    void outputMeshXdmf(ProcessData& process_data, MeshLib::Mesh const& mesh,
+                        std::string const& file_base, double const t) const;
 
 private:
     std::string const _output_directory;
+    OutputType const _output_type;
     std::string const _output_file_prefix;
 
     //! Enables or disables zlib-compression of the output files.
@@ -107,6 +196,9 @@ private:
     /// documentation http://www.vtk.org/doc/nightly/html/classvtkXMLWriter.html
     int const _output_file_data_mode;
     bool const _output_nonlinear_iteration_results;
+    //! Serializes the output of nonlinear iterations of processes solved
+    //! concurrently.
+    std::mutex _nonlinear_iteration_output_mutex;
 
     //! Describes after which timesteps to write output.
     std::vector<PairRepeatEachSteps> _repeats_each_steps;
@@ -130,6 +222,25 @@ private:
     ProcessOutput const _process_output;
     std::vector<std::string> const _mesh_names_for_output;
     std::vector<std::unique_ptr<MeshLib::Mesh>> const& _meshes;
+
+    //! Derived data of the output meshes by process and mesh name.
+    std::map<std::pair<Process const*, std::string>, OutputMeshData>
+        _output_mesh_data;
+
+    //! Staging copies of the output meshes by their name.
+    std::map<std::string, StagingMeshes> _staging_meshes;
+
+    //! Writes the vtu files in the background for asynchronous output. Only
+    //! one write is in flight, hence the staging mesh of the previous but one
+    //! output of a mesh can be reused. It is destructed first waiting for all
+    //! writes.
+    std::unique_ptr<BaseLib::BackgroundTaskQueue> _output_queue;
+
+    //! Optional time series at a few points, written at every timestep.
+    std::unique_ptr<ObservationPoints> _observation_points;
+
+    //! Optional stream of the output meshes to an external consumer.
+    std::unique_ptr<StreamOutput> _stream_output;
 };
 
 
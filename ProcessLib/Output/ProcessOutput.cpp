@@ -10,6 +10,9 @@
 
 #include "ProcessOutput.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "InfoLib/GitInfo.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
@@ -80,6 +83,8 @@ static void addSecondaryVariableResiduals(
     std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
     ProcessLib::SecondaryVariable const& var,
     std::string const& output_name,
+    std::optional<ProcessLib::RefinementMarkerParameters> const&
+        refinement_markers,
     MeshLib::Mesh& mesh)
 {
     if (!var.fcts.eval_residuals)
@@ -123,6 +128,82 @@ static void addSecondaryVariableResiduals(
 
     // Copy result
     residuals.copyValues(residuals_mesh);
+
+    if (!refinement_markers)
+    {
+        return;
+    }
+
+    // The error indicator of an element is the norm of the residuals of all
+    // components.
+    auto const num_components = var.fcts.num_components;
+    std::vector<double> indicators(mesh.getNumberOfElements());
+    for (std::size_t e = 0; e < indicators.size(); ++e)
+    {
+        double sum = 0;
+        for (int c = 0; c < num_components; ++c)
+        {
+            auto const r = residuals_mesh[e * num_components + c];
+            sum += r * r;
+        }
+        indicators[e] = std::sqrt(sum);
+    }
+
+    auto const markers =
+        ProcessLib::markElementsForRefinement(indicators, *refinement_markers);
+    auto& markers_mesh = *MeshLib::getOrCreateMeshProperty<int>(
+        mesh, output_name + "_refinement", MeshLib::MeshItemType::Cell, 1);
+    std::copy(markers.begin(), markers.end(), markers_mesh.begin());
+
+    DBUG("  marked %d elements for refinement and %d for coarsening.",
+         static_cast<int>(std::count(markers.begin(), markers.end(), 1)),
+         static_cast<int>(std::count(markers.begin(), markers.end(), -1)));
+}
+
+//! Applies the output options to the mesh property of the given variable.
+static void applyOutputVariableOptions(
+    std::string const& name,
+    ProcessLib::OutputVariableOptions const& options,
+    std::size_t const output_index, MeshLib::Mesh& mesh)
+{
+    auto& properties = mesh.getProperties();
+    if (!properties.existsPropertyVector<double>(name))
+    {
+        return;
+    }
+
+    auto const& mesh_names = options.mesh_names;
+    if (output_index % options.output_every != 0 ||
+        (!mesh_names.empty() &&
+         std::find(mesh_names.begin(), mesh_names.end(), mesh.getName()) ==
+             mesh_names.end()))
+    {
+        properties.removePropertyVector(name);
+        return;
+    }
+
+    auto& values = *properties.getPropertyVector<double>(name);
+    if (options.quantization_error > 0)
+    {
+        double const step = 2 * options.quantization_error;
+        for (auto& v : values)
+        {
+            v = std::round(v / step) * step;
+        }
+    }
+
+    if (!options.single_precision)
+    {
+        return;
+    }
+    std::vector<float> const float_values(values.begin(), values.end());
+    auto const item_type = values.getMeshItemType();
+    auto const number_of_components = values.getNumberOfComponents();
+    // The double values are computed anew at the next output.
+    properties.removePropertyVector(name);
+    auto& float_property = *properties.createNewPropertyVector<float>(
+        name, item_type, number_of_components);
+    float_property.assign(float_values.begin(), float_values.end());
 }
 
 namespace ProcessLib
@@ -139,12 +220,45 @@ void processOutputData(
     bool const output_secondary_variable,
     std::vector<std::unique_ptr<IntegrationPointWriter>> const&
         integration_point_writer,
+    ProcessOutput const& process_output,
+    std::size_t const output_index)
+{
+    addProcessOutputData(t, x, process_id, mesh, dof_table, process_variables,
+                         secondary_variables, output_secondary_variable,
+                         process_output);
+    finishProcessOutputData(mesh, integration_point_writer, process_output,
+                            output_index);
+}
+
+void addProcessOutputData(
+    const double t,
+    std::vector<GlobalVector*> const& x,
+    int const process_id,
+    MeshLib::Mesh& mesh,
+    std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
+    std::vector<std::reference_wrapper<ProcessVariable>> const&
+        process_variables,
+    SecondaryVariableCollection const& secondary_variables,
+    bool const output_secondary_variable,
     ProcessOutput const& process_output)
 {
     DBUG("Process output data.");
 
     addOgsVersion(mesh);
 
+    // Remove the single precision values of the previous output.
+    for (auto const& name_options : process_output.output_variable_options)
+    {
+        for (auto const& name :
+             {name_options.first, name_options.first + "_residual"})
+        {
+            if (mesh.getProperties().existsPropertyVector<float>(name))
+            {
+                mesh.getProperties().removePropertyVector(name);
+            }
+        }
+    }
+
     // Copy result
 #ifdef USE_PETSC
     // TODO It is also possible directly to copy the data for single process
@@ -236,14 +350,66 @@ void processOutputData(
             if (process_output.output_residuals)
             {
                 addSecondaryVariableResiduals(
-                    t, x, dof_table, secondary_variables.get(name), name, mesh);
+                    t, x, dof_table, secondary_variables.get(name), name,
+                    process_output.refinement_markers, mesh);
             }
         }
     }
+}
+
+void finishProcessOutputData(
+    MeshLib::Mesh& mesh,
+    std::vector<std::unique_ptr<IntegrationPointWriter>> const&
+        integration_point_writer,
+    ProcessOutput const& process_output,
+    std::size_t const output_index)
+{
+    for (auto const& name_options : process_output.output_variable_options)
+    {
+        auto const& name = name_options.first;
+        applyOutputVariableOptions(name, name_options.second, output_index,
+                                   mesh);
+        applyOutputVariableOptions(name + "_residual", name_options.second,
+                                   output_index, mesh);
+    }
 
     addIntegrationPointWriter(mesh, integration_point_writer);
 }
 
+void gatherSecondaryVariables(
+    SecondaryVariableCollection const& secondary_variables,
+    MeshLib::Mesh const& bulk_mesh,
+    std::vector<std::size_t> const& bulk_node_ids,
+    MeshLib::Mesh& mesh)
+{
+    auto const& bulk_properties = bulk_mesh.getProperties();
+    for (auto const& name_variable : secondary_variables)
+    {
+        auto const& name = name_variable.first;
+        if (!bulk_properties.existsPropertyVector<double>(name))
+        {
+            continue;
+        }
+        auto const& bulk_values =
+            *bulk_properties.getPropertyVector<double>(name);
+        if (bulk_values.getMeshItemType() != MeshLib::MeshItemType::Node)
+        {
+            continue;
+        }
+
+        DBUG("  secondary variable %s gathered from mesh '%s'", name.c_str(),
+             bulk_mesh.getName().c_str());
+        auto const n_components = bulk_values.getNumberOfComponents();
+        auto& values = *MeshLib::getOrCreateMeshProperty<double>(
+            mesh, name, MeshLib::MeshItemType::Node, n_components);
+        for (std::size_t i = 0; i < bulk_node_ids.size(); ++i)
+        {
+            std::copy_n(&bulk_values[bulk_node_ids[i] * n_components],
+                        n_components, &values[i * n_components]);
+        }
+    }
+}
+
 void makeOutput(std::string const& file_name, MeshLib::Mesh const& mesh,
                 bool const compress_output, int const data_mode)
 {
@@ -10,14 +10,39 @@
 
 #pragma once
 
+#include <map>
+#include <optional>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "ProcessLib/ProcessVariable.h"
+#include "RefinementMarker.h"
 #include "SecondaryVariable.h"
 
 namespace ProcessLib
 {
 struct IntegrationPointWriter;
+
+//! Reduces the output of a single variable.
+struct OutputVariableOptions final
+{
+    //! Writes the values as single precision floating point numbers.
+    bool single_precision = false;
+
+    //! If positive, the values are rounded to multiples of twice this absolute
+    //! error bound, which improves their compression.
+    double quantization_error = 0;
+
+    //! Writes the variable in every n-th output only, starting with the
+    //! first one.
+    int output_every = 1;
+
+    //! Names of the meshes the variable is written for. If empty, it is
+    //! written for all output meshes.
+    std::vector<std::string> mesh_names;
+};
+
 //! Holds information about which variables to write to output files.
 struct ProcessOutput final
 {
@@ -26,10 +51,20 @@ struct ProcessOutput final
 
     //! Tells if also to output extrapolation residuals.
     bool const output_residuals;
+
+    //! Options of the output variables differing from the default full output.
+    std::map<std::string, OutputVariableOptions> output_variable_options;
+
+    //! If set, the extrapolation residuals are used as error indicators to
+    //! mark elements for refinement and coarsening.
+    std::optional<RefinementMarkerParameters> refinement_markers;
 };
 
 ///
 /// Prepare the output data, i.e. add the solution to vtu data structure.
+///
+/// The \c output_index counts the outputs of the process and selects the
+/// variables written with a reduced frequency.
 void processOutputData(
     const double t,
     std::vector<GlobalVector*> const& x,
@@ -42,8 +77,41 @@ void processOutputData(
     bool const output_secondary_variable,
     std::vector<std::unique_ptr<IntegrationPointWriter>> const&
         integration_point_writer,
+    ProcessOutput const& process_output,
+    std::size_t const output_index);
+
+//! First part of processOutputData(): Adds the solution and, if requested, the
+//! secondary variables to the mesh.
+void addProcessOutputData(
+    const double t,
+    std::vector<GlobalVector*> const& x,
+    int const process_id,
+    MeshLib::Mesh& mesh,
+    std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
+    std::vector<std::reference_wrapper<ProcessVariable>> const&
+        process_variables,
+    SecondaryVariableCollection const& secondary_variables,
+    bool const output_secondary_variable,
     ProcessOutput const& process_output);
 
+//! Second part of processOutputData(): Applies the output variable options
+//! and adds the integration point data to the mesh.
+void finishProcessOutputData(
+    MeshLib::Mesh& mesh,
+    std::vector<std::unique_ptr<IntegrationPointWriter>> const&
+        integration_point_writer,
+    ProcessOutput const& process_output,
+    std::size_t const output_index);
+
+//! Copies the nodal values of the secondary variables added to the
+//! \c bulk_mesh by addProcessOutputData() to the nodes of the \c mesh, whose
+//! nodes are mapped to the bulk mesh nodes by \c bulk_node_ids.
+void gatherSecondaryVariables(
+    SecondaryVariableCollection const& secondary_variables,
+    MeshLib::Mesh const& bulk_mesh,
+    std::vector<std::size_t> const& bulk_node_ids,
+    MeshLib::Mesh& mesh);
+
 //! Writes output to the given \c file_name using the VTU file format.
 ///
 /// See Output::_output_file_data_mode documentation for the data_mode
@@ -0,0 +1,62 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "RefinementMarker.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace ProcessLib
+{
+std::vector<int> markElementsForRefinement(
+    std::vector<double> const& indicators,
+    RefinementMarkerParameters const& parameters)
+{
+    std::vector<int> markers(indicators.size(), 0);
+
+    std::vector<std::size_t> order(indicators.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&indicators](std::size_t const a, std::size_t const b) {
+                  return indicators[a] > indicators[b];
+              });
+
+    double const total = std::accumulate(
+        indicators.begin(), indicators.end(), 0.0,
+        [](double const sum, double const eta) { return sum + eta * eta; });
+    if (total == 0)
+    {
+        return markers;
+    }
+
+    auto first_unmarked = order.begin();
+    for (double sum = 0;
+         first_unmarked != order.end() &&
+         sum < parameters.refine_fraction * total;
+         ++first_unmarked)
+    {
+        sum += indicators[*first_unmarked] * indicators[*first_unmarked];
+        markers[*first_unmarked] = 1;
+    }
+
+    double sum = 0;
+    for (auto it = order.rbegin(); it.base() != first_unmarked; ++it)
+    {
+        sum += indicators[*it] * indicators[*it];
+        if (sum > parameters.coarsen_fraction * total)
+        {
+            break;
+        }
+        markers[*it] = -1;
+    }
+
+    return markers;
+}
+}  // namespace ProcessLib
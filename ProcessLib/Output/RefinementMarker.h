@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace ProcessLib
+{
+//! Fractions of the total squared error used for marking elements.
+struct RefinementMarkerParameters final
+{
+    //! The elements with the largest error indicators are marked for
+    //! refinement until their squared indicators sum up to this fraction of
+    //! the total.
+    double refine_fraction = 0.5;
+
+    //! The elements with the smallest error indicators are marked for
+    //! coarsening as long as their squared indicators sum up to at most this
+    //! fraction of the total.
+    double coarsen_fraction = 0.05;
+};
+
+//! Marks elements for refinement (1), coarsening (-1), or neither (0) by
+//! Dörfler's bulk criterion applied to the given element-wise error
+//! indicators, e.g., the extrapolation residuals of a secondary variable.
+//! The markers are written to the output only; the mesh itself is not
+//! changed.
+std::vector<int> markElementsForRefinement(
+    std::vector<double> const& indicators,
+    RefinementMarkerParameters const& parameters);
+}  // namespace ProcessLib
@@ -151,56 +151,97 @@ private:
     std::map<std::string, SecondaryVariable> _configured_secondary_variables;
 };
 
-/*! Creates an object that computes a secondary variable via extrapolation of
- * integration point values.
- *
- * \param num_components The number of components of the secondary variable.
- * \param extrapolator The extrapolator used for extrapolation.
- * \param local_assemblers The collection of local assemblers whose integration
- * point values will be extrapolated.
- * \param integration_point_values_method The member function of the local
- * assembler returning/computing the integration point values of the specific
- * property being extrapolated.
- */
-template <typename LocalAssemblerCollection>
+namespace detail
+{
+//! Creates the SecondaryVariableFunctions for either kind of method of
+//! NumLib::ExtrapolatableLocalAssemblerCollection.
+template <typename LocalAssemblerCollection, typename Method>
 SecondaryVariableFunctions makeExtrapolator(
     const unsigned num_components,
     NumLib::Extrapolator& extrapolator,
     LocalAssemblerCollection const& local_assemblers,
-    typename NumLib::ExtrapolatableLocalAssemblerCollection<
-        LocalAssemblerCollection>::IntegrationPointValuesMethod
-        integration_point_values_method)
+    Method const& method)
 {
     auto const eval_field =
-        [num_components, &extrapolator, &local_assemblers,
-         integration_point_values_method](
+        [num_components, &extrapolator, &local_assemblers, method](
             const double t,
             std::vector<GlobalVector*> const& x,
             std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
             std::unique_ptr<GlobalVector> & /*result_cache*/
             ) -> GlobalVector const& {
-        auto const extrapolatables = NumLib::makeExtrapolatable(
-            local_assemblers, integration_point_values_method);
+        auto const extrapolatables =
+            NumLib::makeExtrapolatable(local_assemblers, method);
         extrapolator.extrapolate(num_components, extrapolatables, t, x,
                                  dof_table);
         return extrapolator.getNodalValues();
     };
 
     auto const eval_residuals =
-        [num_components, &extrapolator, &local_assemblers,
-         integration_point_values_method](
+        [num_components, &extrapolator, &local_assemblers, method](
             const double t,
             std::vector<GlobalVector*> const& x,
             std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
             std::unique_ptr<GlobalVector> & /*result_cache*/
             ) -> GlobalVector const& {
-        auto const extrapolatables = NumLib::makeExtrapolatable(
-            local_assemblers, integration_point_values_method);
+        auto const extrapolatables =
+            NumLib::makeExtrapolatable(local_assemblers, method);
         extrapolator.calculateResiduals(num_components, extrapolatables, t, x,
                                         dof_table);
         return extrapolator.getElementResiduals();
     };
     return {num_components, eval_field, eval_residuals};
 }
+}  // namespace detail
+
+/*! Creates an object that computes a secondary variable via extrapolation of
+ * integration point values.
+ *
+ * \param num_components The number of components of the secondary variable.
+ * \param extrapolator The extrapolator used for extrapolation.
+ * \param local_assemblers The collection of local assemblers whose integration
+ * point values will be extrapolated.
+ * \param integration_point_values_method The member function of the local
+ * assembler returning/computing the integration point values of the specific
+ * property being extrapolated.
+ */
+template <typename LocalAssemblerCollection>
+SecondaryVariableFunctions makeExtrapolator(
+    const unsigned num_components,
+    NumLib::Extrapolator& extrapolator,
+    LocalAssemblerCollection const& local_assemblers,
+    typename NumLib::ExtrapolatableLocalAssemblerCollection<
+        LocalAssemblerCollection>::IntegrationPointValuesMethod
+        integration_point_values_method)
+{
+    return detail::makeExtrapolator(num_components, extrapolator,
+                                    local_assemblers,
+                                    integration_point_values_method);
+}
+
+/*! Creates an object that computes a secondary variable via extrapolation of
+ * integration point values, which the local assemblers write directly to the
+ * extrapolator's buffer of all integration point values.
+ *
+ * \param num_components The number of components of the secondary variable.
+ * \param extrapolator The extrapolator used for extrapolation.
+ * \param local_assemblers The collection of local assemblers whose integration
+ * point values will be extrapolated.
+ * \param integration_point_values_writer The member function of the local
+ * assembler appending the integration point values of the specific property
+ * being extrapolated to the buffer.
+ */
+template <typename LocalAssemblerCollection>
+SecondaryVariableFunctions makeExtrapolator(
+    const unsigned num_components,
+    NumLib::Extrapolator& extrapolator,
+    LocalAssemblerCollection const& local_assemblers,
+    typename NumLib::ExtrapolatableLocalAssemblerCollection<
+        LocalAssemblerCollection>::IntegrationPointValuesWriter
+        integration_point_values_writer)
+{
+    return detail::makeExtrapolator(num_components, extrapolator,
+                                    local_assemblers,
+                                    integration_point_values_writer);
+}
 
 }  // namespace ProcessLib
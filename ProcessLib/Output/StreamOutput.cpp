@@ -0,0 +1,164 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "StreamOutput.h"
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#ifdef USE_PETSC
+#include <petscsys.h>
+#endif
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Mesh.h"
+
+namespace
+{
+constexpr std::uint32_t stream_format_version = 1;
+
+template <typename T>
+void append(std::vector<char>& record, T const value)
+{
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    record.insert(record.end(), bytes, bytes + sizeof(T));
+}
+
+void appendString(std::vector<char>& record, std::string const& s)
+{
+    append(record, static_cast<std::uint32_t>(s.size()));
+    record.insert(record.end(), s.begin(), s.end());
+}
+
+template <typename T>
+void appendField(std::vector<char>& record,
+                 MeshLib::PropertyVector<T> const& values,
+                 std::uint8_t const scalar_type)
+{
+    auto const n_components = values.getNumberOfComponents();
+    appendString(record, values.getPropertyName());
+    append(record,
+           static_cast<std::uint8_t>(values.getMeshItemType() ==
+                                             MeshLib::MeshItemType::Node
+                                         ? 0
+                                         : 1));
+    append(record, scalar_type);
+    append(record, static_cast<std::uint32_t>(n_components));
+    append(record, static_cast<std::uint64_t>(values.size() / n_components));
+    auto const* const data = reinterpret_cast<char const*>(values.data());
+    record.insert(record.end(), data, data + values.size() * sizeof(T));
+}
+
+bool isStreamed(MeshLib::PropertyVectorBase const& values)
+{
+    return values.getMeshItemType() == MeshLib::MeshItemType::Node ||
+           values.getMeshItemType() == MeshLib::MeshItemType::Cell;
+}
+
+std::int32_t rank()
+{
+#ifdef USE_PETSC
+    int mpi_rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &mpi_rank);
+    return mpi_rank;
+#else
+    return 0;
+#endif
+}
+
+std::string pathOfRank(std::string path)
+{
+#ifdef USE_PETSC
+    path += "_" + std::to_string(rank());
+#endif
+    return path;
+}
+}  // namespace
+
+namespace ProcessLib
+{
+StreamOutput::StreamOutput(std::string path)
+    : _path(pathOfRank(std::move(path)))
+{
+}
+
+std::vector<char> StreamOutput::makeRecord(MeshLib::Mesh const& mesh,
+                                           int const process_id,
+                                           int const timestep, double const t)
+{
+    auto const& properties = mesh.getProperties();
+    std::vector<MeshLib::PropertyVector<double> const*> double_fields;
+    std::vector<MeshLib::PropertyVector<float> const*> float_fields;
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        if (properties.existsPropertyVector<double>(name))
+        {
+            auto const* values = properties.getPropertyVector<double>(name);
+            if (isStreamed(*values))
+            {
+                double_fields.push_back(values);
+            }
+        }
+        else if (properties.existsPropertyVector<float>(name))
+        {
+            auto const* values = properties.getPropertyVector<float>(name);
+            if (isStreamed(*values))
+            {
+                float_fields.push_back(values);
+            }
+        }
+    }
+
+    std::vector<char> record{'O', 'G', 'S', 'S'};
+    append(record, stream_format_version);
+    append(record, rank());
+    append(record, static_cast<std::int32_t>(process_id));
+    append(record, static_cast<std::int64_t>(timestep));
+    append(record, t);
+    appendString(record, mesh.getName());
+    append(record, static_cast<std::uint32_t>(double_fields.size() +
+                                              float_fields.size()));
+    for (auto const* values : double_fields)
+    {
+        appendField(record, *values, 0);
+    }
+    for (auto const* values : float_fields)
+    {
+        appendField(record, *values, 1);
+    }
+    return record;
+}
+
+void StreamOutput::write(std::vector<char> const& record)
+{
+    if (!_os.is_open())
+    {
+        INFO("Opening the output stream '%s'.", _path.c_str());
+        _os.open(_path, std::ios::binary);
+        if (!_os)
+        {
+            OGS_FATAL("Could not open the output stream '%s'.",
+                      _path.c_str());
+        }
+    }
+    _os.write(record.data(), record.size());
+    // The consumer reads the records while the simulation is running.
+    _os.flush();
+    if (!_os)
+    {
+        OGS_FATAL("Could not write to the output stream '%s'.",
+                  _path.c_str());
+    }
+}
+}  // namespace ProcessLib
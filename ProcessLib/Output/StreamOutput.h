@@ -0,0 +1,60 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace ProcessLib
+{
+//! Publishes the output fields as a stream of binary records to a consumer,
+//! e.g., a dashboard reading from a named pipe, without writing mesh files.
+//!
+//! Each record holds the data of one output mesh at one timestep; all
+//! numbers are in the native byte order:
+//! - the magic bytes \c OGSS and the format version (uint32, currently 1),
+//! - the rank (int32, 0 in serial runs), process id (int32), timestep
+//!   (int64), and time (float64),
+//! - the mesh name as uint32 length and characters,
+//! - the number of fields (uint32) followed by each field as its name (uint32
+//!   length and characters), mesh item type (uint8, 0 for nodes and 1 for
+//!   cells), scalar type (uint8, 0 for float64 and 1 for float32), number of
+//!   components (uint32), number of tuples (uint64), and the values.
+//!
+//! The fields are the floating point node and cell properties of the mesh
+//! as they would be written to the vtu file.
+class StreamOutput final
+{
+public:
+    //! The stream is opened on the first record, which blocks on a named pipe
+    //! until the consumer opens it. In parallel runs the rank is appended to
+    //! the \c path.
+    explicit StreamOutput(std::string path);
+
+    //! Serializes the fields of the \c mesh into a record.
+    static std::vector<char> makeRecord(MeshLib::Mesh const& mesh,
+                                        int const process_id,
+                                        int const timestep, double const t);
+
+    //! Appends the \c record to the stream.
+    void write(std::vector<char> const& record);
+
+private:
+    std::string const _path;
+    std::ofstream _os;
+};
+}  // namespace ProcessLib
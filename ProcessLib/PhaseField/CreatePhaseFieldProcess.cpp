@@ -189,13 +189,26 @@ std::unique_ptr<Process> createPhaseFieldProcess(
         (crack_scheme &&
          ((*crack_scheme == "propagating") || (*crack_scheme == "static")));
 
+    auto const active_set_damage_threshold =
+        //! \ogs_file_param{prj__processes__process__PHASE_FIELD__active_set_damage_threshold}
+        config.getConfigParameterOptional<double>(
+            "active_set_damage_threshold");
+#ifdef USE_PETSC
+    if (active_set_damage_threshold)
+    {
+        OGS_FATAL(
+            "The active set of the phase-field equation is not implemented "
+            "for PETSc.");
+    }
+#endif  // USE_PETSC
+
     PhaseFieldProcessData<DisplacementDim> process_data{
         materialIDs(mesh),   std::move(solid_constitutive_relations),
         residual_stiffness,  crack_resistance,
         crack_length_scale,  kinetic_coefficient,
         solid_density,       history_field,
         specific_body_force, propagating_crack,
-        crack_pressure};
+        crack_pressure,      active_set_damage_threshold};
 
     SecondaryVariableCollection secondary_variables;
 
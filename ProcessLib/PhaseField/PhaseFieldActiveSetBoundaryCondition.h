@@ -0,0 +1,45 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include "NumLib/IndexValueVector.h"
+#include "ProcessLib/BoundaryCondition/BoundaryCondition.h"
+
+namespace ProcessLib
+{
+namespace PhaseField
+{
+/// Dirichlet-type boundary condition fixing the phase-field at the nodes
+/// outside of the active set to their current values. The values are owned
+/// and updated by the PhaseFieldProcess.
+class PhaseFieldActiveSetBoundaryCondition final : public BoundaryCondition
+{
+public:
+    explicit PhaseFieldActiveSetBoundaryCondition(
+        NumLib::IndexValueVector<GlobalIndexType> const& frozen_values)
+        : _frozen_values(frozen_values)
+    {
+    }
+
+    void getEssentialBCValues(
+        const double /*t*/, GlobalVector const& /*x*/,
+        NumLib::IndexValueVector<GlobalIndexType>& bc_values) const override
+    {
+        bc_values.ids = _frozen_values.ids;
+        bc_values.values = _frozen_values.values;
+    }
+
+private:
+    NumLib::IndexValueVector<GlobalIndexType> const& _frozen_values;
+};
+
+}  // namespace PhaseField
+}  // namespace ProcessLib
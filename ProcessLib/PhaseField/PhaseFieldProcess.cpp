@@ -10,6 +10,7 @@
 
 #include "PhaseFieldProcess.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "NumLib/DOF/ComputeSparsityPattern.h"
@@ -17,6 +18,7 @@
 #include "ProcessLib/Process.h"
 #include "ProcessLib/SmallDeformation/CreateLocalAssemblers.h"
 
+#include "PhaseFieldActiveSetBoundaryCondition.h"
 #include "PhaseFieldFEM.h"
 
 namespace ProcessLib
@@ -156,6 +158,13 @@ void PhaseFieldProcess<DisplacementDim>::initializeBoundaryConditions()
     const int phasefield_process_id = 1;
     initializeProcessBoundaryConditionsAndSourceTerms(
         *_local_to_global_index_map_single_component, phasefield_process_id);
+
+    if (_process_data.active_set_damage_threshold)
+    {
+        _boundary_conditions[phasefield_process_id].addBoundaryCondition(
+            std::make_unique<PhaseFieldActiveSetBoundaryCondition>(
+                _frozen_phasefield_values));
+    }
 }
 
 template <int DisplacementDim>
@@ -185,13 +194,10 @@ void PhaseFieldProcess<DisplacementDim>::assembleConcreteProcess(
     dof_tables.emplace_back(*_local_to_global_index_map_single_component);
     dof_tables.emplace_back(*_local_to_global_index_map);
 
-    ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
-
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot, process_id, M, K,
-        b, _coupled_solutions);
+    executeGlobalAssembly(&VectorMatrixAssembler::assemble, _local_assemblers,
+                          getAssembledElementIDs(process_id), dof_tables, t, dt,
+                          x, xdot, process_id, M, K, b, _coupled_solutions);
 }
 
 template <int DisplacementDim>
@@ -220,13 +226,11 @@ void PhaseFieldProcess<DisplacementDim>::assembleWithJacobianConcreteProcess(
     dof_tables.emplace_back(*_local_to_global_index_map);
     dof_tables.emplace_back(*_local_to_global_index_map_single_component);
 
-    ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
-
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, dt, x, xdot,
-        dxdot_dx, dx_dx, process_id, M, K, b, Jac, _coupled_solutions);
+    executeGlobalAssembly(
+        &VectorMatrixAssembler::assembleWithJacobian, _local_assemblers,
+        getAssembledElementIDs(process_id), dof_tables, t, dt, x, xdot, dxdot_dx, dx_dx,
+        process_id, M, K, b, Jac, _coupled_solutions);
 
     if (process_id == 0)
     {
@@ -251,6 +255,12 @@ void PhaseFieldProcess<DisplacementDim>::preTimestepConcreteProcess(
         &LocalAssemblerInterface::preTimestep, _local_assemblers,
         pv.getActiveElementIDs(), getDOFTable(process_id), *x[process_id], t,
         dt);
+
+    if (_process_data.active_set_damage_threshold &&
+        isPhaseFieldProcess(process_id))
+    {
+        updateActiveSet(*x[process_id]);
+    }
 }
 
 template <int DisplacementDim>
@@ -327,6 +337,13 @@ void PhaseFieldProcess<DisplacementDim>::postNonLinearSolverConcreteProcess(
             MathLib::LinAlg::scale(const_cast<GlobalVector&>(u),
                                    _process_data.pressure);
         }
+
+        // Grow or shrink the active set before the next phase-field solve of
+        // the staggered iteration.
+        if (_process_data.active_set_damage_threshold)
+        {
+            updateActiveSet(*_coupled_solutions->coupled_xs[1]);
+        }
     }
     else
     {
@@ -346,6 +363,117 @@ bool PhaseFieldProcess<DisplacementDim>::isPhaseFieldProcess(
     return process_id == 1;
 }
 
+template <int DisplacementDim>
+std::vector<std::size_t> const&
+PhaseFieldProcess<DisplacementDim>::getAssembledElementIDs(
+    int const process_id) const
+{
+    if (_process_data.active_set_damage_threshold &&
+        isPhaseFieldProcess(process_id))
+    {
+        return _active_set_element_ids;
+    }
+    ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
+    return pv.getActiveElementIDs();
+}
+
+template <int DisplacementDim>
+void PhaseFieldProcess<DisplacementDim>::updateActiveSet(GlobalVector const& d)
+{
+    double const threshold = *_process_data.active_set_damage_threshold;
+    auto const& dof_table = *_local_to_global_index_map_single_component;
+    auto const mesh_id = _mesh.getID();
+    auto const global_index = [&](std::size_t const node_id) {
+        MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
+                                  node_id);
+        return dof_table.getGlobalIndex(l, 0, 0);
+    };
+
+    auto const& nodes = _mesh.getNodes();
+    auto const& elements = _mesh.getElements();
+
+    // Elements connected to a damaged node.
+    std::vector<bool> is_damaged_element(elements.size(), false);
+    for (auto const* node : nodes)
+    {
+        if (d.get(global_index(node->getID())) >= threshold)
+        {
+            continue;
+        }
+        for (auto const* e : node->getElements())
+        {
+            is_damaged_element[e->getID()] = true;
+        }
+    }
+
+    // Grow by one layer of elements such that the damaged nodes are in the
+    // interior of the active set.
+    std::vector<bool> is_active_element(elements.size(), false);
+    for (auto const* e : elements)
+    {
+        if (!is_damaged_element[e->getID()])
+        {
+            continue;
+        }
+        for (unsigned i = 0; i < e->getNumberOfNodes(); ++i)
+        {
+            for (auto const* neighbour : e->getNode(i)->getElements())
+            {
+                is_active_element[neighbour->getID()] = true;
+            }
+        }
+    }
+
+    // Restrict to the elements which are not deactivated.
+    ProcessLib::ProcessVariable const& pv = getProcessVariables(1)[0];
+    auto const& active_element_ids = pv.getActiveElementIDs();
+    if (!active_element_ids.empty())
+    {
+        std::vector<bool> is_activated(elements.size(), false);
+        for (auto const id : active_element_ids)
+        {
+            is_activated[id] = true;
+        }
+        for (std::size_t i = 0; i < elements.size(); ++i)
+        {
+            is_active_element[i] = is_active_element[i] && is_activated[i];
+        }
+    }
+
+    _active_set_element_ids.clear();
+    for (std::size_t i = 0; i < elements.size(); ++i)
+    {
+        if (is_active_element[i])
+        {
+            _active_set_element_ids.push_back(i);
+        }
+    }
+
+    // Freeze the nodes whose equations would lack the contributions of
+    // inactive elements.
+    _frozen_phasefield_values.ids.clear();
+    _frozen_phasefield_values.values.clear();
+    for (auto const* node : nodes)
+    {
+        auto const& node_elements = node->getElements();
+        if (!_active_set_element_ids.empty() &&
+            std::all_of(node_elements.begin(), node_elements.end(),
+                        [&](auto const* e) {
+                            return is_active_element[e->getID()];
+                        }))
+        {
+            continue;
+        }
+        auto const g_idx = global_index(node->getID());
+        _frozen_phasefield_values.ids.push_back(g_idx);
+        _frozen_phasefield_values.values.push_back(d.get(g_idx));
+    }
+
+    DBUG("Phase-field active set: %d of %d elements, %d frozen nodes.",
+         _active_set_element_ids.size(), elements.size(),
+         _frozen_phasefield_values.ids.size());
+}
+
 template class PhaseFieldProcess<2>;
 template class PhaseFieldProcess<3>;
 
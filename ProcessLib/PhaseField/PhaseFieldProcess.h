@@ -128,6 +128,28 @@ private:
     /// mechanical process. In the present implementation, the mechanical
     /// process has process_id == 0 in the staggered scheme.
     bool isPhaseFieldProcess(int const process_id) const;
+
+    /// Returns the IDs of the elements assembled for the given process. For
+    /// the phase-field equation these are the elements of the active set if
+    /// it is used.
+    std::vector<std::size_t> const& getAssembledElementIDs(
+        int const process_id) const;
+
+    /// Recomputes the active set of the phase-field equation for the given
+    /// phase-field \c d. The active elements are those having a node with a
+    /// phase-field below the damage threshold, and their neighbours. The
+    /// nodes not surrounded by active elements only are frozen to their
+    /// current phase-field values.
+    void updateActiveSet(GlobalVector const& d);
+
+    /// The IDs of the elements in the active set of the phase-field equation.
+    /// If no node is damaged, this is empty, and all elements are assembled
+    /// while all nodes are frozen.
+    std::vector<std::size_t> _active_set_element_ids;
+
+    /// The phase-field values at the nodes outside of the active set, applied
+    /// by a PhaseFieldActiveSetBoundaryCondition.
+    NumLib::IndexValueVector<GlobalIndexType> _frozen_phasefield_values;
 };
 
 extern template class PhaseFieldProcess<2>;
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <Eigen/Eigen>
+#include <boost/optional.hpp>
 
 #include <memory>
 #include <utility>
@@ -47,6 +48,9 @@ struct PhaseFieldProcessData
     Eigen::Matrix<double, DisplacementDim, 1> const specific_body_force;
     bool propagating_crack = false;
     bool crack_pressure = false;
+    /// If set, the phase-field equation is solved only in a band around the
+    /// nodes where the phase-field is below this value.
+    boost::optional<double> active_set_damage_threshold;
 
     double const unity_pressure = 1.0;
     double pressure = 0.0;
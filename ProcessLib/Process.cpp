@@ -10,6 +10,12 @@
 
 #include "Process.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include "BaseLib/Timing.h"
+#include "NumLib/Assembler/AssemblyOrder.h"
 #include "NumLib/DOF/ComputeSparsityPattern.h"
 #include "NumLib/Extrapolation/LocalLinearLeastSquaresExtrapolator.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
@@ -94,18 +100,57 @@ void Process::initialize()
 
     DBUG("Construct dof mappings.");
     constructDofTable();
+    BaseLib::Timing::recordMemoryStage(name + "/dof_tables");
 
     DBUG("Compute sparsity pattern");
     computeSparsityPattern();
+    BaseLib::Timing::recordMemoryStage(name + "/sparsity_pattern");
 
     DBUG("Initialize the extrapolator");
     initializeExtrapolator();
 
-    initializeConcreteProcess(*_local_to_global_index_map, _mesh,
-                              _integration_order);
+    {
+        // The local assemblers are placed one after the other in the arena,
+        // which is released at once with the process.
+        BaseLib::MonotonicArenaScope const arena_scope(_local_assembler_arena);
+        initializeConcreteProcess(*_local_to_global_index_map, _mesh,
+                                  _integration_order);
+    }
+    BaseLib::Timing::addMemory(
+        "local_assembler_arena",
+        static_cast<std::int64_t>(_local_assembler_arena.allocatedBytes()));
+    // The increase includes the integration point data and the shape
+    // matrices of the local assemblers.
+    BaseLib::Timing::recordMemoryStage(name + "/local_assemblers");
 
     DBUG("Initialize boundary conditions.");
     initializeBoundaryConditions();
+
+    if (_use_element_reordering)
+    {
+        DBUG("Compute element assembly order.");
+        _assembly_order = NumLib::computeAssemblyOrder(_mesh);
+    }
+
+    if (_use_element_coloring)
+    {
+        DBUG("Compute element coloring.");
+        _element_coloring = NumLib::computeElementColoring(_mesh);
+        INFO("Process `%s' uses %d element colors for the parallel assembly.",
+             name.c_str(), static_cast<int>(_element_coloring.size()));
+        if (_use_element_reordering)
+        {
+            NumLib::sortByAssemblyOrder(_element_coloring, _assembly_order);
+        }
+    }
+}
+
+void Process::enableElementTiming()
+{
+    auto* const times = MeshLib::getOrCreateMeshProperty<double>(
+        _mesh, name + "_assembly_time", MeshLib::MeshItemType::Cell, 1);
+    std::fill(times->begin(), times->end(), 0.0);
+    _global_assembler.enableElementTiming(*times);
 }
 
 void Process::setInitialConditions(const int process_id, double const t,
@@ -170,17 +215,19 @@ MathLib::MatrixSpecifications Process::getMatrixSpecifications(
 {
     auto const& l = *_local_to_global_index_map;
     return {l.dofSizeWithoutGhosts(), l.dofSizeWithoutGhosts(),
-            &l.getGhostIndices(), &_sparsity_pattern};
+            &l.getGhostIndices(), &_sparsity_pattern, l.getBlockSize()};
 }
 
-void Process::updateDeactivatedSubdomains(double const time,
+bool Process::updateDeactivatedSubdomains(double const time,
                                           const int process_id)
 {
+    bool changed = false;
     auto const& variables_per_process = getProcessVariables(process_id);
     for (auto const& variable : variables_per_process)
     {
-        variable.get().updateDeactivatedSubdomains(time);
+        changed = variable.get().updateDeactivatedSubdomains(time) || changed;
     }
+    return changed;
 }
 
 void Process::preAssemble(const double t, double const dt,
@@ -195,10 +242,37 @@ void Process::assemble(const double t, double const dt,
                        int const process_id, GlobalMatrix& M, GlobalMatrix& K,
                        GlobalVector& b)
 {
+    static auto& region = BaseLib::Timing::getRegion("assembly", true);
+    BaseLib::Timing::ScopedTimer const timer{region};
+
     MathLib::LinAlg::setLocalAccessibleVector(*x[process_id]);
     MathLib::LinAlg::setLocalAccessibleVector(*xdot[process_id]);
 
+    _global_assembler.setElementwiseResidual(
+        isElementwiseResidualEnabled(process_id));
+    _global_assembler.setLumpedMass(isLumpedMassEnabled(process_id));
+    _global_assembler.prepareAssembly(process_id, _mesh.getNumberOfElements(),
+                                      M, K, nullptr);
     assembleConcreteProcess(t, dt, x, xdot, process_id, M, K, b);
+    _global_assembler.finishAssembly(process_id);
+
+    // With time-invariant matrices the caller assembles the boundary
+    // conditions and source terms separately.
+    if (!areTimeInvariantMatricesUsed(process_id))
+    {
+        assembleNaturalBCsAndSourceTerms(t, x, process_id, K, b);
+    }
+}
+
+void Process::assembleNaturalBCsAndSourceTerms(
+    const double t, std::vector<GlobalVector*> const& x, int const process_id,
+    GlobalMatrix& K, GlobalVector& b)
+{
+    static auto& bc_region =
+        BaseLib::Timing::getRegion("assembly/natural_bcs_and_source_terms");
+    BaseLib::Timing::ScopedTimer const bc_timer{bc_region};
+
+    MathLib::LinAlg::setLocalAccessibleVector(*x[process_id]);
 
     // the last argument is for the jacobian, nullptr is for a unused jacobian
     _boundary_conditions[process_id].applyNaturalBC(t, x, process_id, K, b,
@@ -217,11 +291,24 @@ void Process::assembleWithJacobian(const double t, double const dt,
                                    GlobalMatrix& K, GlobalVector& b,
                                    GlobalMatrix& Jac)
 {
+    static auto& region = BaseLib::Timing::getRegion("assembly", true);
+    BaseLib::Timing::ScopedTimer const timer{region};
+
     MathLib::LinAlg::setLocalAccessibleVector(*x[process_id]);
     MathLib::LinAlg::setLocalAccessibleVector(xdot);
 
+    _global_assembler.setElementwiseResidual(
+        isElementwiseResidualEnabled(process_id));
+    _global_assembler.setLumpedMass(false);
+    _global_assembler.prepareAssembly(process_id, _mesh.getNumberOfElements(),
+                                      M, K, &Jac);
     assembleWithJacobianConcreteProcess(t, dt, x, xdot, dxdot_dx, dx_dx,
                                         process_id, M, K, b, Jac);
+    _global_assembler.finishAssembly(process_id);
+
+    static auto& bc_region =
+        BaseLib::Timing::getRegion("assembly/natural_bcs_and_source_terms");
+    BaseLib::Timing::ScopedTimer const bc_timer{bc_region};
 
     // TODO: apply BCs to Jacobian.
     _boundary_conditions[process_id].applyNaturalBC(t, x, process_id, K, b,
@@ -231,6 +318,66 @@ void Process::assembleWithJacobian(const double t, double const dt,
     _source_term_collections[process_id].integrate(t, *x[process_id], b, &Jac);
 }
 
+bool Process::enableElementwiseResidual(int const process_id)
+{
+    if (!isElementwiseResidualEnabled(process_id))
+    {
+        _elementwise_residual_process_ids.push_back(process_id);
+    }
+    return true;
+}
+
+bool Process::isElementwiseResidualEnabled(int const process_id) const
+{
+    return std::find(_elementwise_residual_process_ids.begin(),
+                     _elementwise_residual_process_ids.end(),
+                     process_id) != _elementwise_residual_process_ids.end();
+}
+
+bool Process::enableLumpedMass(int const process_id)
+{
+    if (!isLumpedMassEnabled(process_id))
+    {
+        _lumped_mass_process_ids.push_back(process_id);
+    }
+    return true;
+}
+
+bool Process::isLumpedMassEnabled(int const process_id) const
+{
+    return std::find(_lumped_mass_process_ids.begin(),
+                     _lumped_mass_process_ids.end(),
+                     process_id) != _lumped_mass_process_ids.end();
+}
+
+bool Process::useTimeInvariantMatrices(int const process_id)
+{
+    if (!_use_time_invariant_matrices)
+    {
+        return false;
+    }
+    if (!isLinear())
+    {
+        WARN(
+            "The time-invariant matrices requested for process `%s' are not "
+            "used because the process is nonlinear.",
+            name.c_str());
+        return false;
+    }
+    if (!areTimeInvariantMatricesUsed(process_id))
+    {
+        _time_invariant_matrices_process_ids.push_back(process_id);
+    }
+    return true;
+}
+
+bool Process::areTimeInvariantMatricesUsed(int const process_id) const
+{
+    return std::find(_time_invariant_matrices_process_ids.begin(),
+                     _time_invariant_matrices_process_ids.end(),
+                     process_id) != _time_invariant_matrices_process_ids.end();
+}
+
 void Process::constructDofTable()
 {
     if (_use_monolithic_scheme)
@@ -274,7 +421,8 @@ void Process::constructMonolithicProcessDofTable()
     _local_to_global_index_map =
         std::make_unique<NumLib::LocalToGlobalIndexMap>(
             std::move(all_mesh_subsets), vec_var_n_components,
-            NumLib::ComponentOrder::BY_LOCATION);
+            NumLib::ComponentOrder::BY_LOCATION,
+            NumLib::computeNodeOrder(_mesh, _node_ordering));
 
     assert(_local_to_global_index_map);
 }
@@ -305,7 +453,8 @@ void Process::constructDofTableOfSpecifiedProsessStaggerdScheme(
     _local_to_global_index_map =
         std::make_unique<NumLib::LocalToGlobalIndexMap>(
             std::move(all_mesh_subsets), vec_var_n_components,
-            NumLib::ComponentOrder::BY_LOCATION);
+            NumLib::ComponentOrder::BY_LOCATION,
+            NumLib::computeNodeOrder(_mesh, _node_ordering));
 
     assert(_local_to_global_index_map);
 }
@@ -356,6 +505,15 @@ void Process::computeSparsityPattern()
 {
     _sparsity_pattern =
         NumLib::computeSparsityPattern(*_local_to_global_index_map, _mesh);
+
+    // Values and column indices of one global matrix of this pattern.
+    auto const number_of_nonzeros =
+        std::accumulate(_sparsity_pattern.begin(), _sparsity_pattern.end(),
+                        std::int64_t{0});
+    BaseLib::Timing::addMemory(
+        "global_matrix",
+        number_of_nonzeros * static_cast<std::int64_t>(
+                                 sizeof(double) + sizeof(GlobalIndexType)));
 }
 
 void Process::preTimestep(std::vector<GlobalVector*> const& x, const double t,
@@ -371,6 +529,9 @@ void Process::preTimestep(std::vector<GlobalVector*> const& x, const double t,
 void Process::postTimestep(std::vector<GlobalVector*> const& x, const double t,
                            const double delta_t, int const process_id)
 {
+    static auto& region = BaseLib::Timing::getRegion("post_timestep", true);
+    BaseLib::Timing::ScopedTimer const timer{region};
+
     for (auto* const solution : x)
         MathLib::LinAlg::setLocalAccessibleVector(*solution);
     postTimestepConcreteProcess(x, t, delta_t, process_id);
@@ -386,9 +547,58 @@ void Process::postNonLinearSolver(GlobalVector const& x, const double t,
 void Process::computeSecondaryVariable(const double t, GlobalVector const& x,
                                        int const process_id)
 {
+    static auto& region =
+        BaseLib::Timing::getRegion("secondary_variables", true);
+    BaseLib::Timing::ScopedTimer const timer{region};
+
     MathLib::LinAlg::setLocalAccessibleVector(x);
 
     computeSecondaryVariableConcrete(t, x, process_id);
+    _outdated_secondary_variables.erase(process_id);
+}
+
+void Process::setSecondaryVariablesOutdated(const double t,
+                                            GlobalVector const& x,
+                                            int const process_id)
+{
+    if (requiresSecondaryVariablesAtEachTimestep())
+    {
+        computeSecondaryVariable(t, x, process_id);
+        return;
+    }
+    _outdated_secondary_variables[process_id] = {t, &x};
+}
+
+void Process::updateSecondaryVariables(int const process_id)
+{
+    auto const it = _outdated_secondary_variables.find(process_id);
+    if (it == _outdated_secondary_variables.end())
+    {
+        return;
+    }
+    auto const t = it->second.first;
+    auto const& x = *it->second.second;
+    computeSecondaryVariable(t, x, process_id);
+}
+
+void Process::writeCheckpoint(std::ostream& /*os*/) const
+{
+    if (!_integration_point_writer.empty())
+    {
+        OGS_FATAL(
+            "Checkpoints are not supported for this process: its integration "
+            "point data would not be restored.");
+    }
+}
+
+void Process::readCheckpoint(std::istream& /*is*/)
+{
+    if (!_integration_point_writer.empty())
+    {
+        OGS_FATAL(
+            "Restart from a checkpoint is not supported for this process: its "
+            "integration point data cannot be restored.");
+    }
 }
 
 void Process::preIteration(const unsigned iter, const GlobalVector& x)
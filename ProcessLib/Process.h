@@ -10,8 +10,15 @@
 
 #pragma once
 
+#include <iosfwd>
+#include <map>
 #include <tuple>
+#include <utility>
 
+#include "BaseLib/MonotonicArena.h"
+#include "NumLib/Assembler/ElementColoring.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
+#include "NumLib/DOF/NodeOrdering.h"
 #include "NumLib/ODESolver/NonlinearSolver.h"
 #include "NumLib/ODESolver/ODESystem.h"
 #include "NumLib/ODESolver/TimeDiscretization.h"
@@ -74,6 +81,18 @@ public:
     void computeSecondaryVariable(const double t, GlobalVector const& x,
                                   int const process_id);
 
+    /// Marks the secondary variables as outdated after a timestep. They are
+    /// computed for the solution \c x at time \c t by
+    /// updateSecondaryVariables() when they are needed, e.g., for the output.
+    /// Processes needing them at each timestep compute them immediately.
+    /// The solution must not change until the secondary variables have been
+    /// updated.
+    void setSecondaryVariablesOutdated(const double t, GlobalVector const& x,
+                                       int const process_id);
+
+    /// Computes the secondary variables if they are outdated.
+    void updateSecondaryVariables(int const process_id);
+
     NumLib::IterationResult postIteration(GlobalVector const& x) final;
 
     void initialize();
@@ -90,9 +109,72 @@ public:
         _coupled_solutions = coupled_solutions;
     }
 
-    void updateDeactivatedSubdomains(double const time, const int process_id);
+    /// \return true if the active elements of any process variable have
+    /// changed.
+    bool updateDeactivatedSubdomains(double const time, const int process_id);
 
     bool isMonolithicSchemeUsed() const { return _use_monolithic_scheme; }
+
+    /// Switches the element loops of the global assembly to the
+    /// NumLib::ParallelExecutor. The local assemblers of the process must be
+    /// thread-safe then.
+    ///
+    /// \param use_element_coloring if set, the elements are assembled color
+    /// by color, such that concurrently assembled elements never share global
+    /// entries and no synchronization of the global additions is necessary.
+    /// The element coloring is computed in initialize().
+    void enableParallelAssembly(bool const use_element_coloring)
+    {
+        _global_assembler.enableParallelAssembly(use_element_coloring);
+        _use_parallel_assembly = true;
+        _use_element_coloring = use_element_coloring;
+    }
+
+    /// Returns true if the local assemblers of the process are declared
+    /// thread-safe by enableParallelAssembly(). Then also other element loops
+    /// calling into the local assemblers, e.g. flux evaluations, may run in
+    /// parallel.
+    bool isParallelAssemblyUsed() const { return _use_parallel_assembly; }
+
+    /// Assembles the elements in the order given by
+    /// NumLib::computeAssemblyOrder() instead of the mesh element order. The
+    /// order is computed in initialize().
+    void enableElementReordering() { _use_element_reordering = true; }
+
+    /// Numbers the global indices of the process variables following the
+    /// given node \c ordering instead of the mesh node order. Only the DOF
+    /// tables constructed by Process::constructDofTable() and by the
+    /// HeatTransportBHE process are affected.
+    void setNodeOrdering(NumLib::NodeOrdering const ordering)
+    {
+        _node_ordering = ordering;
+    }
+
+    /// Caches the positions of the local matrix entries in the global
+    /// matrices, see VectorMatrixAssembler::prepareAssembly().
+    void enableScatterMaps() { _global_assembler.enableScatterMaps(); }
+
+    /// Reuses the local contributions of elements whose local solution has
+    /// barely changed since their last assembly, see
+    /// VectorMatrixAssembler::enableIncrementalAssembly().
+    void enableIncrementalAssembly(double const tolerance,
+                                   int const max_reuses)
+    {
+        _global_assembler.enableIncrementalAssembly(tolerance, max_reuses);
+    }
+
+    /// Records the accumulated local assembly time of each element in the
+    /// cell property \c <process name>_assembly_time of the mesh, which is
+    /// written with the output. See
+    /// VectorMatrixAssembler::enableElementTiming().
+    void enableElementTiming();
+
+    /// Declares the matrices and the domain part of the right-hand side of a
+    /// linear process as independent of time and solution, such that they
+    /// are assembled only once by the Picard solver, see
+    /// useTimeInvariantMatrices().
+    void enableTimeInvariantMatrices() { _use_time_invariant_matrices = true; }
+
     virtual void setCoupledTermForTheStaggeredSchemeToLocalAssemblers(
         int const /*process_id*/)
     {
@@ -111,6 +193,32 @@ public:
                               GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
                               GlobalMatrix& Jac) final;
 
+    /// All processes assemble the domain through the VectorMatrixAssembler,
+    /// which computes the elementwise residuals.
+    bool enableElementwiseResidual(int const process_id) final;
+
+    /// All processes assemble the domain through the VectorMatrixAssembler,
+    /// which lumps the local mass matrices.
+    bool enableLumpedMass(int const process_id) final;
+
+    /// Returns the stability limit of the explicit forward Euler scheme
+    /// estimated in the last assembly of the process with the given
+    /// \c process_id, see VectorMatrixAssembler::getStableTimeStep().
+    double getStableTimeStep(int const process_id) const
+    {
+        return _global_assembler.getStableTimeStep(process_id);
+    }
+
+    /// Returns true for linear processes whose time-invariant matrices have
+    /// been enabled by enableTimeInvariantMatrices().
+    bool useTimeInvariantMatrices(int const process_id) final;
+
+    void assembleNaturalBCsAndSourceTerms(const double t,
+                                          std::vector<GlobalVector*> const& x,
+                                          int const process_id,
+                                          GlobalMatrix& K,
+                                          GlobalVector& b) final;
+
     std::vector<NumLib::IndexValueVector<GlobalIndexType>> const*
     getKnownSolutions(double const t, GlobalVector const& x,
                       int const process_id) const final
@@ -131,6 +239,15 @@ public:
         return _process_variables[process_id];
     }
 
+    /// The number of process ids, i.e., one for the monolithic scheme and the
+    /// number of the coupled equation systems for the staggered scheme.
+    int getNumberOfProcessIDs() const
+    {
+        return static_cast<int>(_process_variables.size());
+    }
+
+    unsigned getIntegrationOrder() const { return _integration_order; }
+
     SecondaryVariableCollection const& getSecondaryVariables() const
     {
         return _secondary_variables;
@@ -142,6 +259,15 @@ public:
         return _integration_point_writer;
     }
 
+    /// Writes the process state not contained in the solution vectors, e.g.,
+    /// the integration point states, for a restart from a checkpoint. The
+    /// default implementation writes nothing and fails for processes with
+    /// integration point data.
+    virtual void writeCheckpoint(std::ostream& os) const;
+
+    /// Restores the state written by writeCheckpoint().
+    virtual void readCheckpoint(std::istream& is);
+
     // Used as a call back for CalculateSurfaceFlux process.
 
     virtual Eigen::Vector3d getFlux(
@@ -172,6 +298,39 @@ protected:
     void initializeProcessBoundaryConditionsAndSourceTerms(
         const NumLib::LocalToGlobalIndexMap& dof_table, const int process_id);
 
+    /// Calls the given \c method of the global assembler for the local
+    /// assemblers selected by \c active_element_ids, or for all local
+    /// assemblers if \c active_element_ids is empty. In the latter case the
+    /// \c _assembly_order is used if available.
+    ///
+    /// Depending on the configuration of the process the calls are executed
+    /// serially or concurrently.
+    template <typename Method, typename LocalAssemblers, typename... Args>
+    void executeGlobalAssembly(
+        Method method, LocalAssemblers const& local_assemblers,
+        std::vector<std::size_t> const& active_element_ids, Args&&... args)
+    {
+        auto const& element_ids =
+            active_element_ids.empty() ? _assembly_order : active_element_ids;
+        if (_use_element_coloring)
+        {
+            NumLib::ParallelExecutor::executeSelectedMemberDereferencedByColor(
+                _global_assembler, method, local_assemblers, _element_coloring,
+                active_element_ids, std::forward<Args>(args)...);
+            return;
+        }
+        if (_use_parallel_assembly)
+        {
+            NumLib::ParallelExecutor::executeSelectedMemberDereferenced(
+                _global_assembler, method, local_assemblers, element_ids,
+                std::forward<Args>(args)...);
+            return;
+        }
+        GlobalExecutor::executeSelectedMemberDereferenced(
+            _global_assembler, method, local_assemblers, element_ids,
+            std::forward<Args>(args)...);
+    }
+
 private:
     /// Process specific initialization called by initialize().
     virtual void initializeConcreteProcess(
@@ -240,6 +399,15 @@ private:
     {
     }
 
+    /// Processes, whose physics depends on the results of
+    /// computeSecondaryVariableConcrete(), e.g., on updated material states,
+    /// return true. Otherwise the secondary variables are computed only on
+    /// demand.
+    virtual bool requiresSecondaryVariablesAtEachTimestep() const
+    {
+        return false;
+    }
+
     virtual NumLib::IterationResult postIterationConcreteProcess(
         GlobalVector const& /*x*/)
     {
@@ -288,9 +456,38 @@ private:
     /// DOF-table.
     void computeSparsityPattern();
 
+    bool isElementwiseResidualEnabled(int const process_id) const;
+
+    bool isLumpedMassEnabled(int const process_id) const;
+
+    bool areTimeInvariantMatricesUsed(int const process_id) const;
+
 public:
     std::string const name;
 
+private:
+    /// Process ids whose domain residual is assembled elementwise, see
+    /// enableElementwiseResidual().
+    std::vector<int> _elementwise_residual_process_ids;
+
+    /// Process ids which are assembled with lumped mass matrix, see
+    /// enableLumpedMass().
+    std::vector<int> _lumped_mass_process_ids;
+
+    /// If set, useTimeInvariantMatrices() accepts the time-invariant
+    /// matrices for linear processes.
+    bool _use_time_invariant_matrices = false;
+
+    /// Process ids whose assembly is split into the time-invariant domain
+    /// part and the boundary conditions and source terms, see
+    /// useTimeInvariantMatrices().
+    std::vector<int> _time_invariant_matrices_process_ids;
+
+    /// Memory of the local assemblers created in initializeConcreteProcess().
+    /// Being a member of the base class, it outlives the local assemblers
+    /// owned by the derived processes.
+    BaseLib::MonotonicArena _local_assembler_arena;
+
 protected:
     MeshLib::Mesh& _mesh;
     std::unique_ptr<MeshLib::MeshSubset const> _mesh_subset_all_nodes;
@@ -303,6 +500,29 @@ protected:
 
     const bool _use_monolithic_scheme;
 
+    /// If set, the element loops of the global assembly are executed by the
+    /// NumLib::ParallelExecutor.
+    bool _use_parallel_assembly = false;
+
+    /// If set, the parallel global assembly is executed color by color using
+    /// the \c _element_coloring.
+    bool _use_element_coloring = false;
+
+    /// Element ids of the mesh grouped by color; computed once in initialize()
+    /// if the element coloring is used.
+    NumLib::ElementColoring _element_coloring;
+
+    /// Ordering of the nodes for numbering the global indices.
+    NumLib::NodeOrdering _node_ordering = NumLib::NodeOrdering::MESH;
+
+    /// If set, the elements are assembled in the \c _assembly_order.
+    bool _use_element_reordering = false;
+
+    /// Permutation of the element ids used for the element loops of the
+    /// global assembly; computed once in initialize() if the element
+    /// reordering is used, empty otherwise.
+    std::vector<std::size_t> _assembly_order;
+
     /// Pointer to CoupledSolutionsForStaggeredScheme, which contains the
     /// references to the solutions of the coupled processes.
     CoupledSolutionsForStaggeredScheme* _coupled_solutions;
@@ -340,6 +560,10 @@ private:
     std::vector<SourceTermCollection> _source_term_collections;
 
     ExtrapolatorData _extrapolator_data;
+
+    /// Time and solution of the outdated secondary variables by process id.
+    std::map<int, std::pair<double, GlobalVector const*>>
+        _outdated_secondary_variables;
 };
 
 }  // namespace ProcessLib
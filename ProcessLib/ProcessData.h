@@ -17,9 +17,19 @@
 
 #include "CoupledSolutionsForStaggeredScheme.h"
 #include "Process.h"
+#include "SolutionPredictor.h"
 
 namespace ProcessLib
 {
+//! Snapshots of an offline run of a reduced order model, from which the POD
+//! basis is computed at the end of the time loop.
+struct ReducedOrderModelSnapshots
+{
+    std::string basis_file;
+    double energy_fraction;
+    NumLib::SnapshotCollector snapshots;
+};
+
 struct ProcessData
 {
     template <NumLib::NonlinearSolverTag NLTag>
@@ -49,6 +59,10 @@ struct ProcessData
           time_disc(std::move(pd.time_disc)),
           tdisc_ode_sys(std::move(pd.tdisc_ode_sys)),
           mat_strg(pd.mat_strg),
+          number_of_subcycles(pd.number_of_subcycles),
+          predictor(std::move(pd.predictor)),
+          reduced_order_model_snapshots(
+              std::move(pd.reduced_order_model_snapshots)),
           process_id(pd.process_id),
           process(pd.process)
     {
@@ -70,6 +84,18 @@ struct ProcessData
     //! cast of \c tdisc_ode_sys to NumLib::InternalMatrixStorage
     NumLib::InternalMatrixStorage* mat_strg = nullptr;
 
+    //! Number of equally sized substeps of this process within one time step
+    //! of the staggered scheme.
+    int number_of_subcycles = 1;
+
+    //! Extrapolates the initial guess of the nonlinear solver from the
+    //! previous time steps; nullptr if the previous solution is used.
+    std::unique_ptr<SolutionPredictor> predictor;
+
+    //! Collects the accepted solutions for a reduced order model; nullptr if
+    //! not in the offline mode.
+    std::unique_ptr<ReducedOrderModelSnapshots> reduced_order_model_snapshots;
+
     int const process_id;
 
     Process& process;
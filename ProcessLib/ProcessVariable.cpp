@@ -276,12 +276,12 @@ void ProcessVariable::createBoundaryConditionsForDeactivatedSubDomains(
     }
 }
 
-void ProcessVariable::updateDeactivatedSubdomains(double const time)
+bool ProcessVariable::updateDeactivatedSubdomains(double const time)
 {
     if (_deactivated_subdomains.empty())
     {
         _ids_of_active_elements.clear();
-        return;
+        return false;
     }
 
     auto found_a_set =
@@ -294,14 +294,17 @@ void ProcessVariable::updateDeactivatedSubdomains(double const time)
     if (found_a_set == _deactivated_subdomains.end())
     {
         _ids_of_active_elements.clear();
-        return;
+        bool const changed = _current_deactivated_subdomain != nullptr;
+        _current_deactivated_subdomain = nullptr;
+        return changed;
     }
 
-    // Already initialized.
-    if (!_ids_of_active_elements.empty())
+    // Already initialized for the same subdomain.
+    if (found_a_set->get() == _current_deactivated_subdomain)
     {
-        return;
+        return false;
     }
+    _current_deactivated_subdomain = found_a_set->get();
 
     auto const& deactivated_materialIDs = (*found_a_set)->materialIDs;
 
@@ -319,6 +322,7 @@ void ProcessVariable::updateDeactivatedSubdomains(double const time)
         }
         _ids_of_active_elements.push_back(_mesh.getElement(i)->getID());
     }
+    return true;
 }
 
 std::vector<std::unique_ptr<SourceTerm>> ProcessVariable::createSourceTerms(
@@ -65,7 +65,9 @@ public:
         return _deactivated_subdomains;
     }
 
-    void updateDeactivatedSubdomains(double const time);
+    /// \return true if the deactivated subdomain, and therefore the set of
+    /// active elements, has changed.
+    bool updateDeactivatedSubdomains(double const time);
 
     std::vector<std::size_t>& getActiveElementIDs() const
     {
@@ -119,6 +121,12 @@ private:
     /// deactivated subdomains.
     mutable std::vector<std::size_t> _ids_of_active_elements;
 
+    /// The deactivated subdomain for which the \c _ids_of_active_elements
+    /// were computed, or nullptr if no subdomain is deactivated. The active
+    /// elements are only recomputed if another subdomain's time interval
+    /// begins.
+    DeactivatedSubdomain const* _current_deactivated_subdomain = nullptr;
+
     void createBoundaryConditionsForDeactivatedSubDomains(
         const NumLib::LocalToGlobalIndexMap& dof_table, const int variable_id,
         std::vector<std::unique_ptr<ParameterLib::ParameterBase>> const&
@@ -187,21 +187,20 @@ public:
                 solid_phase.property(MaterialPropertyLib::PropertyType::porosity)
                     .template value<double>(vars, pos, t, dt);
 
-            double const Sw =
+            auto const saturation =
                 medium
                     .property(MaterialPropertyLib::PropertyType::saturation)
-                    .template value<double>(vars, pos, t, dt);
+                    .valueAndDerivatives(
+                        vars,
+                        std::array{
+                            MaterialPropertyLib::Variable::capillary_pressure},
+                        pos, t, dt);
+            double const Sw = saturation.value;
+            double const dSw_dpc = saturation.derivatives[0];
             _saturation[ip] = Sw;
             vars[static_cast<int>(
                 MaterialPropertyLib::Variable::liquid_saturation)] = Sw;
 
-            double const dSw_dpc =
-                medium
-                    .property(MaterialPropertyLib::PropertyType::saturation)
-                    .template dValue<double>(
-                        vars, MaterialPropertyLib::Variable::capillary_pressure,
-                        pos, t, dt);
-
             auto const drhow_dp =
                 liquid_phase
                     .property(MaterialPropertyLib::PropertyType::density)
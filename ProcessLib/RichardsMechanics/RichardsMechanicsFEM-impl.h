@@ -293,18 +293,17 @@ void RichardsMechanicsLocalAssembler<
 
         auto const& b = _process_data.specific_body_force;
 
-        S_L = medium->property(MPL::PropertyType::saturation)
-                  .template value<double>(variables, x_position, t, dt);
+        auto const saturation =
+            medium->property(MPL::PropertyType::saturation)
+                .valueAndDerivatives(
+                    variables, std::array{MPL::Variable::capillary_pressure},
+                    x_position, t, dt);
+        S_L = saturation.value;
+        double const dS_L_dp_cap = saturation.derivatives[0];
         variables[static_cast<int>(MPL::Variable::liquid_saturation)] = S_L;
         variables[static_cast<int>(MPL::Variable::liquid_saturation_rate)] =
             (S_L - S_L_prev) / dt;
 
-        double const dS_L_dp_cap =
-            medium->property(MPL::PropertyType::saturation)
-                .template dValue<double>(variables,
-                                         MPL::Variable::capillary_pressure,
-                                         x_position, t, dt);
-
         auto const chi = [medium, x_position, t, dt](double const S_L) {
             MPL::VariableArray variables;
             variables[static_cast<int>(MPL::Variable::liquid_saturation)] = S_L;
@@ -566,18 +565,17 @@ void RichardsMechanicsLocalAssembler<ShapeFunctionDisplacement,
                 .template value<double>(variables, x_position, t, dt);
         auto const& b = _process_data.specific_body_force;
 
-        S_L = medium->property(MPL::PropertyType::saturation)
-                  .template value<double>(variables, x_position, t, dt);
+        auto const saturation =
+            medium->property(MPL::PropertyType::saturation)
+                .valueAndDerivatives(
+                    variables, std::array{MPL::Variable::capillary_pressure},
+                    x_position, t, dt);
+        S_L = saturation.value;
+        double const dS_L_dp_cap = saturation.derivatives[0];
         variables[static_cast<int>(MPL::Variable::liquid_saturation)] = S_L;
         variables[static_cast<int>(MPL::Variable::liquid_saturation_rate)] =
             (S_L - S_L_prev) / dt;
 
-        double const dS_L_dp_cap =
-            medium->property(MPL::PropertyType::saturation)
-                .template dValue<double>(variables,
-                                         MPL::Variable::capillary_pressure,
-                                         x_position, t, dt);
-
         double const d2S_L_dp_cap_2 =
             medium->property(MPL::PropertyType::saturation)
                 .template d2Value<double>(
@@ -669,9 +667,13 @@ void RichardsMechanicsLocalAssembler<ShapeFunctionDisplacement,
             }
         }
 
-        double const k_rel =
+        auto const relative_permeability =
             medium->property(MPL::PropertyType::relative_permeability)
-                .template value<double>(variables, x_position, t, dt);
+                .valueAndDerivatives(
+                    variables, std::array{MPL::Variable::liquid_saturation},
+                    x_position, t, dt);
+        double const k_rel = relative_permeability.value;
+        double const dk_rel_dS_l = relative_permeability.derivatives[0];
         auto const mu = liquid_phase.property(MPL::PropertyType::viscosity)
                             .template value<double>(variables, x_position, t, dt);
         auto const K_intrinsic = MPL::formEigenTensor<DisplacementDim>(
@@ -775,11 +777,6 @@ void RichardsMechanicsLocalAssembler<ShapeFunctionDisplacement,
             .noalias() -= N_p.transpose() * rho_LR * dS_L_dp_cap * alpha *
                           identity2.transpose() * B * u_dot * N_p * w;
 
-        double const dk_rel_dS_l =
-            medium->property(MPL::PropertyType::relative_permeability)
-                .template dValue<double>(variables,
-                                         MPL::Variable::liquid_saturation,
-                                         x_position, t, dt);
         typename ShapeMatricesTypeDisplacement::GlobalDimVectorType const
             grad_p_cap = -dNdx_p * p_L;
         local_Jac
@@ -124,6 +124,13 @@ private:
     void computeSecondaryVariableConcrete(const double t,
                                           GlobalVector const& x,
                                           int const process_id) override;
+
+    /// The integration point saturations are updated with the secondary
+    /// variables.
+    bool requiresSecondaryVariablesAtEachTimestep() const override
+    {
+        return true;
+    }
     /**
      * @copydoc ProcessLib::Process::getDOFTableForExtrapolatorData()
      */
@@ -103,6 +103,14 @@ std::unique_ptr<Process> createSmallDeformationProcess(
         config.getConfigParameter<double>(
             "reference_temperature", std::numeric_limits<double>::quiet_NaN());
 
+    auto const cache_elastic_tangent =
+        //! \ogs_file_param{prj__processes__process__SMALL_DEFORMATION__cache_elastic_tangent}
+        config.getConfigParameter<bool>("cache_elastic_tangent", false);
+
+    auto const use_b_bar =
+        //! \ogs_file_param{prj__processes__process__SMALL_DEFORMATION__use_b_bar}
+        config.getConfigParameter<bool>("use_b_bar", false);
+
     // Initial stress conditions
     auto const initial_stress = ParameterLib::findOptionalTagParameter<double>(
         //! \ogs_file_param_special{prj__processes__process__SMALL_DEFORMATION__initial_stress}
@@ -114,7 +122,9 @@ std::unique_ptr<Process> createSmallDeformationProcess(
     SmallDeformationProcessData<DisplacementDim> process_data{
         materialIDs(mesh),   std::move(solid_constitutive_relations),
         initial_stress,      solid_density,
-        specific_body_force, reference_temperature};
+        specific_body_force, reference_temperature,
+        cache_elastic_tangent, use_b_bar,
+        {} /* integration_point_store, filled by the local assemblers */};
 
     SecondaryVariableCollection secondary_variables;
 
@@ -14,6 +14,7 @@
 
 #include "MaterialLib/SolidModels/MechanicsBase.h"
 #include "NumLib/Extrapolation/ExtrapolatableElement.h"
+#include "NumLib/Extrapolation/IntegrationPointValuesBuffer.h"
 #include "ProcessLib/Deformation/MaterialForces.h"
 #include "ProcessLib/LocalAssemblerInterface.h"
 
@@ -31,24 +32,24 @@ struct SmallDeformationLocalAssemblerInterface
         std::string const& name, double const* values,
         int const integration_order) = 0;
 
-    virtual std::vector<double> const& getIntPtFreeEnergyDensity(
+    virtual void appendIntPtFreeEnergyDensity(
         const double t,
         std::vector<GlobalVector*> const& x,
         std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
-        std::vector<double>& cache) const = 0;
+        NumLib::IntegrationPointValuesBuffer& buffer) const = 0;
 
     virtual std::vector<double> getSigma() const = 0;
-    virtual std::vector<double> const& getIntPtSigma(
+    virtual void appendIntPtSigma(
         const double t,
         std::vector<GlobalVector*> const& x,
         std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
-        std::vector<double>& cache) const = 0;
+        NumLib::IntegrationPointValuesBuffer& buffer) const = 0;
 
-    virtual std::vector<double> const& getIntPtEpsilon(
+    virtual void appendIntPtEpsilon(
         const double t,
         std::vector<GlobalVector*> const& x,
         std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
-        std::vector<double>& cache) const = 0;
+        NumLib::IntegrationPointValuesBuffer& buffer) const = 0;
 
     // TODO move to NumLib::ExtrapolatableElement
     virtual unsigned getNumberOfIntegrationPoints() const = 0;
@@ -56,6 +57,10 @@ struct SmallDeformationLocalAssemblerInterface
     virtual typename MaterialLib::Solids::MechanicsBase<
         DisplacementDim>::MaterialStateVariables const&
     getMaterialStateVariablesAt(unsigned /*integration_point*/) const = 0;
+
+    virtual typename MaterialLib::Solids::MechanicsBase<
+        DisplacementDim>::MaterialStateVariables&
+    getMaterialStateVariablesAt(unsigned /*integration_point*/) = 0;
 };
 
 }  // namespace SmallDeformation
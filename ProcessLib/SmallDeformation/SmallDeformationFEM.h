@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -23,6 +25,7 @@
 #include "ProcessLib/Deformation/BMatrixPolicy.h"
 #include "ProcessLib/Deformation/GMatrixPolicy.h"
 #include "ProcessLib/Deformation/LinearBMatrix.h"
+#include "ProcessLib/Deformation/MechanicsIntegrationPointStore.h"
 #include "ProcessLib/LocalAssemblerInterface.h"
 #include "ProcessLib/LocalAssemblerTraits.h"
 #include "ProcessLib/Utils/InitShapeMatrices.h"
@@ -38,35 +41,9 @@ template <typename BMatricesType, typename ShapeMatricesType,
           int DisplacementDim>
 struct IntegrationPointData final
 {
-    explicit IntegrationPointData(
-        MaterialLib::Solids::MechanicsBase<DisplacementDim> const&
-            solid_material)
-        : solid_material(solid_material),
-          material_state_variables(
-              solid_material.createMaterialStateVariables())
-    {
-    }
-
-    typename BMatricesType::KelvinVectorType sigma, sigma_prev;
-    typename BMatricesType::KelvinVectorType eps, eps_prev;
-    double free_energy_density = 0;
-
-    MaterialLib::Solids::MechanicsBase<DisplacementDim> const& solid_material;
-    std::unique_ptr<typename MaterialLib::Solids::MechanicsBase<
-        DisplacementDim>::MaterialStateVariables>
-        material_state_variables;
-
-    double integration_weight;
     typename ShapeMatricesType::NodalRowVectorType N;
     typename ShapeMatricesType::GlobalDimNodalMatrixType dNdx;
 
-    void pushBackState()
-    {
-        eps_prev = eps;
-        sigma_prev = sigma;
-        material_state_variables->pushBackState();
-    }
-
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
@@ -113,6 +90,11 @@ public:
         SmallDeformationProcessData<DisplacementDim>& process_data)
         : _process_data(process_data),
           _integration_method(integration_order),
+          _ip_view(process_data.integration_point_store,
+                   _integration_method.getNumberOfPoints()),
+          _solid_material(MaterialLib::Solids::selectSolidConstitutiveRelation(
+              _process_data.solid_materials, _process_data.material_ids,
+              e.getID())),
           _element(e),
           _is_axially_symmetric(is_axially_symmetric)
     {
@@ -120,6 +102,7 @@ public:
             _integration_method.getNumberOfPoints();
 
         _ip_data.reserve(n_integration_points);
+        _material_state_variables.reserve(n_integration_points);
         _secondary_data.N.resize(n_integration_points);
 
         auto const shape_matrices =
@@ -127,37 +110,42 @@ public:
                               IntegrationMethod, DisplacementDim>(
                 e, is_axially_symmetric, _integration_method);
 
-        auto& solid_material =
-            MaterialLib::Solids::selectSolidConstitutiveRelation(
-                _process_data.solid_materials,
-                _process_data.material_ids,
-                e.getID());
-
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            _ip_data.emplace_back(solid_material);
+            _ip_data.emplace_back();
+            _material_state_variables.push_back(
+                _solid_material.createMaterialStateVariables());
             auto& ip_data = _ip_data[ip];
             auto const& sm = shape_matrices[ip];
-            _ip_data[ip].integration_weight =
+            _ip_view.integration_weight(ip) =
                 _integration_method.getWeightedPoint(ip).getWeight() *
                 sm.integralMeasure * sm.detJ;
 
             ip_data.N = sm.N;
             ip_data.dNdx = sm.dNdx;
 
-            static const int kelvin_vector_size =
-                MathLib::KelvinVector::KelvinVectorDimensions<
-                    DisplacementDim>::value;
-            // Initialize current time step values
-            ip_data.sigma.setZero(kelvin_vector_size);
-            ip_data.eps.setZero(kelvin_vector_size);
-
-            // Previous time step values are not initialized and are set later.
-            ip_data.sigma_prev.resize(kelvin_vector_size);
-            ip_data.eps_prev.resize(kelvin_vector_size);
+            // The stresses and strains are zero-initialized by the store.
 
             _secondary_data.N[ip] = shape_matrices[ip].N;
         }
+
+        if (_process_data.use_b_bar)
+        {
+            // The volume average of the volumetric parts of the B-matrices.
+            Eigen::RowVectorXd b_bar = Eigen::RowVectorXd::Zero(
+                ShapeFunction::NPOINTS * DisplacementDim);
+            double volume = 0;
+            for (unsigned ip = 0; ip < n_integration_points; ip++)
+            {
+                auto const w = _ip_view.integration_weight(ip);
+                b_bar += LinearBMatrix::volumetricBMatrixPart(
+                             computeBMatrix(ip)) *
+                         w;
+                volume += w;
+            }
+            b_bar /= volume;
+            _b_bar_data.assign(b_bar.data(), b_bar.data() + b_bar.size());
+        }
     }
 
     /// Returns number of read integration points.
@@ -208,7 +196,7 @@ public:
                                                             ShapeMatricesType>(
                         _element, ip_data.N))};
 
-                ip_data.sigma =
+                _ip_view.sigma(ip) =
                     MathLib::KelvinVector::symmetricTensorToKelvinVector<
                         DisplacementDim>((*_process_data.initial_stress)(
                         std::numeric_limits<
@@ -216,8 +204,9 @@ public:
                         x_position));
             }
 
-            ip_data.pushBackState();
+            _material_state_variables[ip]->pushBackState();
         }
+        _ip_view.pushBackState();
     }
 
     void assemble(double const /*t*/, double const /*dt*/,
@@ -252,15 +241,98 @@ public:
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
+        auto const u =
+            Eigen::Map<typename BMatricesType::NodalForceVectorType const>(
+                local_x.data(), ShapeFunction::NPOINTS * DisplacementDim);
+
+        // All current strains and stresses are overwritten below.
+        _ip_view.beginStateUpdate();
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            _ip_view.eps(ip).noalias() = computeBMatrix(ip) * u;
+        }
+
+        // The stresses and tangents of all integration points are computed
+        // at once. The tangents are stored in a buffer reused by all elements
+        // assembled by the same thread.
+        thread_local std::vector<
+            MathLib::KelvinVector::KelvinMatrixType<DisplacementDim>,
+            Eigen::aligned_allocator<
+                MathLib::KelvinVector::KelvinMatrixType<DisplacementDim>>>
+            Cs;
+        Cs.resize(n_integration_points);
+
+        thread_local Eigen::Array<bool, Eigen::Dynamic, 1> elastic;
+        elastic.resize(n_integration_points);
+        bool const cache_elastic_tangent = _process_data.cache_elastic_tangent;
+
         ParameterLib::SpatialPosition x_position;
         x_position.setElementID(_element.getID());
 
+        if (!_solid_material.integrateStressBatch(
+                t, x_position, dt, n_integration_points,
+                _ip_view.eps_prev_data(), _ip_view.eps_data(),
+                _ip_view.sigma_prev_data(), _material_state_variables.data(),
+                _process_data.reference_temperature, _ip_view.sigma_data(),
+                Cs.data(), cache_elastic_tangent ? elastic.data() : nullptr))
+        {
+            OGS_FATAL("Computation of local constitutive relation failed.");
+        }
+
+        // The material does not compute the tangents of elastic steps. The
+        // elastic tangent is evaluated once per element and time, and the
+        // stiffness matrix of an element with elastic steps only is kept
+        // until the time changes.
+        bool const all_elastic = cache_elastic_tangent && elastic.all();
+        bool use_elastic_stiffness = false;
+        if (cache_elastic_tangent && elastic.any())
+        {
+            using KelvinMatrixType =
+                MathLib::KelvinVector::KelvinMatrixType<DisplacementDim>;
+            auto const kelvin_vector_size =
+                MathLib::KelvinVector::KelvinVectorDimensions<
+                    DisplacementDim>::value;
+
+            if (_elastic_tangent_time != t)
+            {
+                auto const* const first_elastic = std::find(
+                    elastic.data(), elastic.data() + n_integration_points,
+                    true);
+                x_position.setIntegrationPoint(
+                    static_cast<unsigned>(first_elastic - elastic.data()));
+                KelvinMatrixType const C_elastic =
+                    _solid_material.getElasticTangent(
+                        t, x_position, _process_data.reference_temperature);
+                _elastic_tangent_data.assign(
+                    C_elastic.data(), C_elastic.data() + C_elastic.size());
+                _elastic_stiffness_data.clear();
+                _elastic_tangent_time = t;
+            }
+
+            auto const C_elastic = MathLib::toMatrix<KelvinMatrixType>(
+                _elastic_tangent_data, kelvin_vector_size, kelvin_vector_size);
+            for (unsigned ip = 0; ip < n_integration_points; ip++)
+            {
+                if (elastic[ip])
+                {
+                    Cs[ip] = C_elastic;
+                }
+            }
+
+            if (all_elastic && !_elastic_stiffness_data.empty())
+            {
+                local_Jac = MathLib::toMatrix<StiffnessMatrixType>(
+                    _elastic_stiffness_data, local_matrix_size,
+                    local_matrix_size);
+                use_elastic_stiffness = true;
+            }
+        }
+
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
             x_position.setIntegrationPoint(ip);
-            auto const& w = _ip_data[ip].integration_weight;
+            auto const w = _ip_view.integration_weight(ip);
             auto const& N = _ip_data[ip].N;
-            auto const& dNdx = _ip_data[ip].dNdx;
 
             typename ShapeMatricesType::template MatrixType<DisplacementDim,
                                                             displacement_size>
@@ -276,43 +348,24 @@ public:
                     .noalias() = N;
             }
 
-            auto const x_coord =
-                interpolateXCoordinate<ShapeFunction, ShapeMatricesType>(
-                    _element, N);
-            auto const B = LinearBMatrix::computeBMatrix<
-                DisplacementDim, ShapeFunction::NPOINTS,
-                typename BMatricesType::BMatrixType>(dNdx, N, x_coord,
-                                                     _is_axially_symmetric);
-
-            auto const& eps_prev = _ip_data[ip].eps_prev;
-            auto const& sigma_prev = _ip_data[ip].sigma_prev;
-
-            auto& eps = _ip_data[ip].eps;
-            auto& sigma = _ip_data[ip].sigma;
-            auto& state = _ip_data[ip].material_state_variables;
-
-            eps.noalias() =
-                B *
-                Eigen::Map<typename BMatricesType::NodalForceVectorType const>(
-                    local_x.data(), ShapeFunction::NPOINTS * DisplacementDim);
-
-            auto&& solution = _ip_data[ip].solid_material.integrateStress(
-                t, x_position, dt, eps_prev, eps, sigma_prev, *state,
-                _process_data.reference_temperature);
-
-            if (!solution)
-            {
-                OGS_FATAL("Computation of local constitutive relation failed.");
-            }
+            auto const B = computeBMatrix(ip);
+            auto const& sigma = _ip_view.sigma(ip);
+            auto const& C = Cs[ip];
 
-            MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-            std::tie(sigma, state, C) = std::move(*solution);
-
-            auto const rho = _process_data.solid_density(t, x_position)[0];
+            double rho;
+            _process_data.solid_density(t, x_position, &rho);
             auto const& b = _process_data.specific_body_force;
             local_b.noalias() -=
                 (B.transpose() * sigma - N_u_op.transpose() * rho * b) * w;
-            local_Jac.noalias() += B.transpose() * C * B * w;
+            if (!use_elastic_stiffness)
+            {
+                local_Jac.noalias() += B.transpose() * C * B * w;
+            }
+        }
+
+        if (all_elastic && !use_elastic_stiffness)
+        {
+            _elastic_stiffness_data = local_Jac_data;
         }
     }
 
@@ -322,9 +375,10 @@ public:
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
-        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        _ip_view.pushBackState();
+        for (auto& state : _material_state_variables)
         {
-            _ip_data[ip].pushBackState();
+            state->pushBackState();
         }
 
         ParameterLib::SpatialPosition x_position;
@@ -334,13 +388,11 @@ public:
         {
             x_position.setIntegrationPoint(ip);
 
-            auto& ip_data = _ip_data[ip];
-
             // Update free energy density needed for material forces.
-            ip_data.free_energy_density =
-                ip_data.solid_material.computeFreeEnergyDensity(
-                    t, x_position, dt, ip_data.eps, ip_data.sigma,
-                    *ip_data.material_state_variables);
+            _ip_view.free_energy_density(ip) =
+                _solid_material.computeFreeEnergyDensity(
+                    t, x_position, dt, _ip_view.eps(ip), _ip_view.sigma(ip),
+                    *_material_state_variables[ip]);
         }
     }
 
@@ -353,7 +405,8 @@ public:
             typename BMatricesType::NodalForceVectorType,
             NodalDisplacementVectorType, GradientVectorType,
             GradientMatrixType>(local_x, nodal_values, _integration_method,
-                                _ip_data, _element, _is_axially_symmetric);
+                                _ip_data, _ip_view, _element,
+                                _is_axially_symmetric);
     }
 
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
@@ -365,21 +418,19 @@ public:
         return Eigen::Map<const Eigen::RowVectorXd>(N.data(), N.size());
     }
 
-    std::vector<double> const& getIntPtFreeEnergyDensity(
+    void appendIntPtFreeEnergyDensity(
         const double /*t*/,
         std::vector<GlobalVector*> const& /*x*/,
         std::vector<NumLib::LocalToGlobalIndexMap const*> const& /*dof_table*/,
-        std::vector<double>& cache) const override
+        NumLib::IntegrationPointValuesBuffer& buffer) const override
     {
-        cache.clear();
-        cache.reserve(_ip_data.size());
+        auto const num_intpts = _ip_view.size();
+        auto values = buffer.appendElement(num_intpts, 1);
 
-        for (auto const& ip_data : _ip_data)
+        for (unsigned ip = 0; ip < num_intpts; ++ip)
         {
-            cache.push_back(ip_data.free_energy_density);
+            values(ip, 0) = _ip_view.free_energy_density(ip);
         }
-
-        return cache;
     }
 
     std::size_t setSigma(double const* values)
@@ -396,7 +447,7 @@ public:
 
         for (unsigned ip = 0; ip < n_integration_points; ++ip)
         {
-            _ip_data[ip].sigma =
+            _ip_view.sigma(ip) =
                 MathLib::KelvinVector::symmetricTensorToKelvinVector(
                     sigma_values.col(ip));
         }
@@ -404,9 +455,8 @@ public:
         return n_integration_points;
     }
 
-    // TODO (naumov) This method is same as getIntPtSigma but for arguments and
-    // the ordering of the cache_mat.
-    // There should be only one.
+    // TODO (naumov) This method is same as appendIntPtSigma but for the
+    // arguments. There should be only one.
     std::vector<double> getSigma() const override
     {
         auto const kelvin_vector_size =
@@ -421,7 +471,7 @@ public:
 
         for (unsigned ip = 0; ip < n_integration_points; ++ip)
         {
-            auto const& sigma = _ip_data[ip].sigma;
+            auto const& sigma = _ip_view.sigma(ip);
             cache_mat.row(ip) =
                 MathLib::KelvinVector::kelvinVectorToSymmetricTensor(sigma);
         }
@@ -429,56 +479,46 @@ public:
         return ip_sigma_values;
     }
 
-    std::vector<double> const& getIntPtSigma(
+    void appendIntPtSigma(
         const double /*t*/,
         std::vector<GlobalVector*> const& /*x*/,
         std::vector<NumLib::LocalToGlobalIndexMap const*> const& /*dof_table*/,
-        std::vector<double>& cache) const override
+        NumLib::IntegrationPointValuesBuffer& buffer) const override
     {
-        static const int kelvin_vector_size =
+        auto const kelvin_vector_size =
             MathLib::KelvinVector::KelvinVectorDimensions<
                 DisplacementDim>::value;
         auto const num_intpts = _ip_data.size();
 
-        cache.clear();
-        auto cache_mat = MathLib::createZeroedMatrix<Eigen::Matrix<
-            double, kelvin_vector_size, Eigen::Dynamic, Eigen::RowMajor>>(
-            cache, kelvin_vector_size, num_intpts);
+        auto values = buffer.appendElement(num_intpts, kelvin_vector_size);
 
         for (unsigned ip = 0; ip < num_intpts; ++ip)
         {
-            auto const& sigma = _ip_data[ip].sigma;
-            cache_mat.col(ip) =
+            auto const& sigma = _ip_view.sigma(ip);
+            values.row(ip) =
                 MathLib::KelvinVector::kelvinVectorToSymmetricTensor(sigma);
         }
-
-        return cache;
     }
 
-    std::vector<double> const& getIntPtEpsilon(
+    void appendIntPtEpsilon(
         const double /*t*/,
         std::vector<GlobalVector*> const& /*x*/,
         std::vector<NumLib::LocalToGlobalIndexMap const*> const& /*dof_table*/,
-        std::vector<double>& cache) const override
+        NumLib::IntegrationPointValuesBuffer& buffer) const override
     {
         auto const kelvin_vector_size =
             MathLib::KelvinVector::KelvinVectorDimensions<
                 DisplacementDim>::value;
         auto const num_intpts = _ip_data.size();
 
-        cache.clear();
-        auto cache_mat = MathLib::createZeroedMatrix<Eigen::Matrix<
-            double, kelvin_vector_size, Eigen::Dynamic, Eigen::RowMajor>>(
-            cache, kelvin_vector_size, num_intpts);
+        auto values = buffer.appendElement(num_intpts, kelvin_vector_size);
 
         for (unsigned ip = 0; ip < num_intpts; ++ip)
         {
-            auto const& eps = _ip_data[ip].eps;
-            cache_mat.col(ip) =
+            auto const& eps = _ip_view.eps(ip);
+            values.row(ip) =
                 MathLib::KelvinVector::kelvinVectorToSymmetricTensor(eps);
         }
-
-        return cache;
     }
 
     unsigned getNumberOfIntegrationPoints() const override
@@ -490,7 +530,35 @@ public:
         DisplacementDim>::MaterialStateVariables const&
     getMaterialStateVariablesAt(unsigned integration_point) const override
     {
-        return *_ip_data[integration_point].material_state_variables;
+        return *_material_state_variables[integration_point];
+    }
+
+    typename MaterialLib::Solids::MechanicsBase<
+        DisplacementDim>::MaterialStateVariables&
+    getMaterialStateVariablesAt(unsigned integration_point) override
+    {
+        return *_material_state_variables[integration_point];
+    }
+
+private:
+    typename BMatricesType::BMatrixType computeBMatrix(unsigned const ip) const
+    {
+        auto const& N = _ip_data[ip].N;
+        auto const x_coord =
+            interpolateXCoordinate<ShapeFunction, ShapeMatricesType>(_element,
+                                                                     N);
+        auto B = LinearBMatrix::computeBMatrix<
+            DisplacementDim, ShapeFunction::NPOINTS,
+            typename BMatricesType::BMatrixType>(_ip_data[ip].dNdx, N, x_coord,
+                                                 _is_axially_symmetric);
+        if (!_b_bar_data.empty())
+        {
+            LinearBMatrix::applyBBar(
+                Eigen::Map<Eigen::RowVectorXd const>(_b_bar_data.data(),
+                                                     _b_bar_data.size()),
+                B);
+        }
+        return B;
     }
 
 private:
@@ -503,10 +571,28 @@ private:
         _ip_data;
 
     IntegrationMethod _integration_method;
+    Deformation::MechanicsIntegrationPointView<DisplacementDim> _ip_view;
+
+    MaterialLib::Solids::MechanicsBase<DisplacementDim> const& _solid_material;
+    std::vector<std::unique_ptr<typename MaterialLib::Solids::MechanicsBase<
+        DisplacementDim>::MaterialStateVariables>>
+        _material_state_variables;
     MeshLib::Element const& _element;
     SecondaryData<typename ShapeMatrices::ShapeType> _secondary_data;
     bool const _is_axially_symmetric;
 
+    /// Volume average of the volumetric parts of the B-matrices, which
+    /// replaces them at all integration points. Only set if
+    /// SmallDeformationProcessData::use_b_bar is set.
+    std::vector<double> _b_bar_data;
+
+    /// Elastic tangent and stiffness matrix of elastic steps, valid at time
+    /// _elastic_tangent_time. Only used if
+    /// SmallDeformationProcessData::cache_elastic_tangent is set.
+    double _elastic_tangent_time = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> _elastic_tangent_data;
+    std::vector<double> _elastic_stiffness_data;
+
     static const int displacement_size =
         ShapeFunction::NPOINTS * DisplacementDim;
 };
@@ -13,6 +13,7 @@
 #include <cassert>
 #include <nlohmann/json.hpp>
 
+#include "BaseLib/FileTools.h"
 #include "ProcessLib/Deformation/SolidMaterialInternalToSecondaryVariables.h"
 #include "ProcessLib/Output/IntegrationPointWriter.h"
 #include "ProcessLib/Process.h"
@@ -100,17 +101,17 @@ void SmallDeformationProcess<DisplacementDim>::initializeConcreteProcess(
 
     add_secondary_variable("free_energy_density",
                            1,
-                           &LocalAssemblerInterface::getIntPtFreeEnergyDensity);
+                           &LocalAssemblerInterface::appendIntPtFreeEnergyDensity);
 
     add_secondary_variable("sigma",
                            MathLib::KelvinVector::KelvinVectorType<
                                DisplacementDim>::RowsAtCompileTime,
-                           &LocalAssemblerInterface::getIntPtSigma);
+                           &LocalAssemblerInterface::appendIntPtSigma);
 
     add_secondary_variable("epsilon",
                            MathLib::KelvinVector::KelvinVectorType<
                                DisplacementDim>::RowsAtCompileTime,
-                           &LocalAssemblerInterface::getIntPtEpsilon);
+                           &LocalAssemblerInterface::appendIntPtEpsilon);
 
     //
     // enable output of internal variables defined by material models
@@ -188,10 +189,9 @@ void SmallDeformationProcess<DisplacementDim>::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_table, t, dt, x, xdot, process_id, M, K,
-        b, _coupled_solutions);
+    executeGlobalAssembly(&VectorMatrixAssembler::assemble, _local_assemblers,
+                          pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
+                          process_id, M, K, b, _coupled_solutions);
 }
 
 template <int DisplacementDim>
@@ -209,10 +209,10 @@ void SmallDeformationProcess<DisplacementDim>::
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
-        dxdot_dx, dx_dx, process_id, M, K, b, Jac, _coupled_solutions);
+    executeGlobalAssembly(
+        &VectorMatrixAssembler::assembleWithJacobian, _local_assemblers,
+        pv.getActiveElementIDs(), dof_table, t, dt, x, xdot, dxdot_dx, dx_dx,
+        process_id, M, K, b, Jac, _coupled_solutions);
 
     transformVariableFromGlobalVector(b, 0, *_local_to_global_index_map,
                                       *_nodal_forces, std::negate<double>());
@@ -240,6 +240,69 @@ void SmallDeformationProcess<DisplacementDim>::postTimestepConcreteProcess(
     material_forces->copyValues(*_material_forces);
 }
 
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::writeCheckpoint(
+    std::ostream& os) const
+{
+    // The current and the previous states are equal after the timestep.
+    auto const& store = _process_data.integration_point_store;
+    typename Deformation::MechanicsIntegrationPointStore<
+        DisplacementDim>::KelvinVectorArray sigma;
+    decltype(sigma) eps;
+    store.getState(sigma, eps);
+    BaseLib::writeVectorBinary(os, sigma);
+    BaseLib::writeVectorBinary(os, eps);
+    BaseLib::writeVectorBinary(os, store.free_energy_density);
+
+    for (auto const& local_asm : _local_assemblers)
+    {
+        auto const n_integration_points =
+            local_asm->getNumberOfIntegrationPoints();
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            BaseLib::writeVectorBinary(
+                os,
+                local_asm->getMaterialStateVariablesAt(ip).getCheckpointData());
+        }
+    }
+}
+
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::readCheckpoint(std::istream& is)
+{
+    auto& store = _process_data.integration_point_store;
+    auto const n_integration_points_total = store.size();
+
+    typename Deformation::MechanicsIntegrationPointStore<
+        DisplacementDim>::KelvinVectorArray sigma;
+    decltype(sigma) eps;
+    BaseLib::readVectorBinary(is, sigma);
+    BaseLib::readVectorBinary(is, eps);
+    BaseLib::readVectorBinary(is, store.free_energy_density);
+    if (!is || sigma.size() != n_integration_points_total ||
+        eps.size() != n_integration_points_total ||
+        store.free_energy_density.size() != n_integration_points_total)
+    {
+        OGS_FATAL(
+            "The integration point data in the checkpoint do not match the "
+            "%d integration points of the process.",
+            n_integration_points_total);
+    }
+    store.setState(sigma, eps);
+
+    std::vector<double> data;
+    for (auto& local_asm : _local_assemblers)
+    {
+        auto const n_integration_points =
+            local_asm->getNumberOfIntegrationPoints();
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            BaseLib::readVectorBinary(is, data);
+            local_asm->getMaterialStateVariablesAt(ip).setCheckpointData(data);
+        }
+    }
+}
+
 template class SmallDeformationProcess<2>;
 template class SmallDeformationProcess<3>;
 
@@ -40,6 +40,10 @@ public:
     bool isLinear() const override;
     //! @}
 
+    void writeCheckpoint(std::ostream& os) const override;
+
+    void readCheckpoint(std::istream& is) override;
+
 private:
     using LocalAssemblerInterface =
         SmallDeformationLocalAssemblerInterface<DisplacementDim>;
@@ -16,6 +16,7 @@
 #include <Eigen/Eigen>
 
 #include "ParameterLib/Parameter.h"
+#include "ProcessLib/Deformation/MechanicsIntegrationPointStore.h"
 
 namespace MaterialLib
 {
@@ -53,6 +54,20 @@ struct SmallDeformationProcessData
 
     double const reference_temperature =
         std::numeric_limits<double>::quiet_NaN();
+
+    /// If set, the local assemblers use the elastic tangent for integration
+    /// points with an elastic step, and cache the element stiffness matrix
+    /// of elements with elastic steps only.
+    bool const cache_elastic_tangent = false;
+
+    /// If set, the volumetric part of the strain-displacement matrices is
+    /// replaced by its element average (B-bar method).
+    bool const use_b_bar = false;
+
+    /// Stresses, strains, etc. at the integration points of all elements.
+    /// Filled by the local assemblers upon their construction.
+    Deformation::MechanicsIntegrationPointStore<DisplacementDim>
+        integration_point_store;
 };
 
 }  // namespace SmallDeformation
@@ -39,6 +39,11 @@ if (NOT OGS_USE_MPI)
     OgsTest(PROJECTFILE Mechanics/InitialStates/into_initial_state.prj)
     OgsTest(PROJECTFILE Mechanics/InitialStates/equilibrium_restart.prj)
     OgsTest(PROJECTFILE Mechanics/InitialStates/non_equilibrium_initial_state.prj)
+
+    # Timings of the assembly and of the constitutive updates compared to the
+    # baselines, see OGS_PERFORMANCE_BASELINE_DIR.
+    OgsTest(PROJECTFILE Mechanics/Linear/square_1e5.prj PERFORMANCE)
+    OgsTest(PROJECTFILE Mechanics/Ehlers/cube_1e3.prj PERFORMANCE)
 endif()
 
 if (OGS_USE_PYTHON)
@@ -0,0 +1,238 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "NonlocalInteraction.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "BaseLib/RunTime.h"
+
+#include "IntegrationPointDataNonlocalInterface.h"
+
+namespace
+{
+using ProcessLib::SmallDeformationNonlocal::
+    IntegrationPointDataNonlocalInterface;
+
+/// Uniform grid of cubic cells of the size of the internal length. All
+/// integration points within the internal length of a point are in the same or
+/// in the adjacent cells of the point's cell.
+class IntegrationPointGrid
+{
+public:
+    IntegrationPointGrid(
+        std::vector<IntegrationPointDataNonlocalInterface*> const&
+            integration_points,
+        double const cell_size)
+        : _integration_points(integration_points), _cell_size(cell_size)
+    {
+        _min.fill(std::numeric_limits<double>::max());
+        std::array<double, 3> max;
+        max.fill(std::numeric_limits<double>::lowest());
+        for (auto const* ip : integration_points)
+        {
+            for (int d = 0; d < 3; ++d)
+            {
+                _min[d] = std::min(_min[d], ip->coordinates[d]);
+                max[d] = std::max(max[d], ip->coordinates[d]);
+            }
+        }
+        for (int d = 0; d < 3; ++d)
+        {
+            _n_cells[d] =
+                static_cast<std::int64_t>((max[d] - _min[d]) / _cell_size) + 1;
+        }
+
+        _sorted_points.reserve(integration_points.size());
+        for (std::size_t i = 0; i < integration_points.size(); ++i)
+        {
+            _sorted_points.emplace_back(
+                cellKey(cell(integration_points[i]->coordinates)), i);
+        }
+        std::sort(_sorted_points.begin(), _sorted_points.end());
+    }
+
+    /// Calls f(l, distance2) for each integration point l closer to the
+    /// integration point k than the given squared distance.
+    template <typename F>
+    void forEachNeighbour(std::size_t const k, double const distance2,
+                          F const& f) const
+    {
+        auto const& x_k = _integration_points[k]->coordinates;
+        auto const c = cell(x_k);
+        for (std::int64_t i = c[0] - 1; i <= c[0] + 1; ++i)
+        {
+            for (std::int64_t j = c[1] - 1; j <= c[1] + 1; ++j)
+            {
+                for (std::int64_t l = c[2] - 1; l <= c[2] + 1; ++l)
+                {
+                    if (i < 0 || j < 0 || l < 0 || i >= _n_cells[0] ||
+                        j >= _n_cells[1] || l >= _n_cells[2])
+                    {
+                        continue;
+                    }
+                    auto const key = cellKey({i, j, l});
+                    auto const first = std::lower_bound(
+                        _sorted_points.begin(), _sorted_points.end(),
+                        std::make_pair(key, std::size_t{0}));
+                    for (auto it = first;
+                         it != _sorted_points.end() && it->first == key; ++it)
+                    {
+                        double const d2 =
+                            (_integration_points[it->second]->coordinates - x_k)
+                                .squaredNorm();
+                        if (d2 < distance2)
+                        {
+                            f(it->second, d2);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    std::array<std::int64_t, 3> cell(Eigen::Vector3d const& x) const
+    {
+        return {{static_cast<std::int64_t>((x[0] - _min[0]) / _cell_size),
+                 static_cast<std::int64_t>((x[1] - _min[1]) / _cell_size),
+                 static_cast<std::int64_t>((x[2] - _min[2]) / _cell_size)}};
+    }
+
+    std::int64_t cellKey(std::array<std::int64_t, 3> const& c) const
+    {
+        return (c[0] * _n_cells[1] + c[1]) * _n_cells[2] + c[2];
+    }
+
+    std::vector<IntegrationPointDataNonlocalInterface*> const&
+        _integration_points;
+    double const _cell_size;
+    std::array<double, 3> _min;
+    std::array<std::int64_t, 3> _n_cells;
+    /// Pairs of cell keys and integration point indices sorted by the keys.
+    std::vector<std::pair<std::int64_t, std::size_t>> _sorted_points;
+};
+}  // namespace
+
+namespace ProcessLib
+{
+namespace SmallDeformationNonlocal
+{
+void NonlocalInteraction::initialize(
+    std::vector<IntegrationPointDataNonlocalInterface*> integration_points,
+    double const internal_length_squared)
+{
+    if (internal_length_squared <= 0)
+    {
+        OGS_FATAL(
+            "The internal length of the nonlocal damage must be positive.");
+    }
+
+    BaseLib::RunTime run_time;
+    run_time.start();
+
+    _integration_points = std::move(integration_points);
+    auto const n_integration_points =
+        static_cast<std::ptrdiff_t>(_integration_points.size());
+
+    IntegrationPointGrid const grid(_integration_points,
+                                    std::sqrt(internal_length_squared));
+
+    // Count the neighbours, then fill the rows sorted by the column indices.
+    std::vector<std::size_t> row_sizes(n_integration_points);
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < n_integration_points; ++k)
+    {
+        std::size_t count = 0;
+        grid.forEachNeighbour(k, internal_length_squared,
+                              [&count](std::size_t, double) { ++count; });
+        row_sizes[k] = count;
+    }
+
+    _row_offsets.resize(n_integration_points + 1);
+    _row_offsets[0] = 0;
+    std::partial_sum(row_sizes.begin(), row_sizes.end(),
+                     _row_offsets.begin() + 1);
+    _columns.resize(_row_offsets.back());
+    _values.resize(_row_offsets.back());
+
+    auto const alpha_0 = [internal_length_squared](double const distance2) {
+        double const a = 1 - distance2 / internal_length_squared;
+        return a * a;
+    };
+
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < n_integration_points; ++k)
+    {
+        std::vector<std::pair<std::size_t, double>> row;
+        row.reserve(row_sizes[k]);
+        grid.forEachNeighbour(k, internal_length_squared,
+                              [&row](std::size_t const l, double const d2) {
+                                  row.emplace_back(l, d2);
+                              });
+        std::sort(row.begin(), row.end());
+
+        double a_k_sum_m = 0;
+        for (auto const& [m, distance2_m] : row)
+        {
+            a_k_sum_m +=
+                _integration_points[m]->integration_weight * alpha_0(distance2_m);
+        }
+
+        // Store the alpha_kl already multiplied with the integration weight of
+        // that l integration point.
+        auto const offset = _row_offsets[k];
+        for (std::size_t i = 0; i < row.size(); ++i)
+        {
+            auto const& [l, distance2_l] = row[i];
+            _columns[offset + i] = l;
+            _values[offset + i] = alpha_0(distance2_l) / a_k_sum_m *
+                                  _integration_points[l]->integration_weight;
+        }
+    }
+
+    INFO(
+        "[time] Building the nonlocal interactions of %d integration points "
+        "(%d interactions) took %g s.",
+        _integration_points.size(), _columns.size(), run_time.elapsed());
+}
+
+void NonlocalInteraction::computeNonlocalKappaD() const
+{
+    auto const n_integration_points =
+        static_cast<std::ptrdiff_t>(_integration_points.size());
+
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < n_integration_points; ++k)
+    {
+        double nonlocal_kappa_d = 0;
+        bool active = false;
+        for (auto i = _row_offsets[k]; i < _row_offsets[k + 1]; ++i)
+        {
+            auto const& ip_l = *_integration_points[_columns[i]];
+            nonlocal_kappa_d += _values[i] * ip_l.kappa_d;
+            active |= ip_l.active_self;
+        }
+        _integration_points[k]->nonlocal_kappa_d =
+            active ? nonlocal_kappa_d : 0;
+    }
+}
+}  // namespace SmallDeformationNonlocal
+}  // namespace ProcessLib
@@ -0,0 +1,57 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ProcessLib
+{
+namespace SmallDeformationNonlocal
+{
+struct IntegrationPointDataNonlocalInterface;
+
+/// The nonlocal averaging weights of all integration points stored as a sparse
+/// matrix in compressed row storage.
+///
+/// Row k holds the weights alpha_kl * w_l of the integration points l within
+/// the internal length of the integration point k, where
+/// alpha_kl = alpha_0(|x_k - x_l|) / sum_m w_m alpha_0(|x_k - x_m|) and
+/// alpha_0(r) = (1 - r^2 / l^2)^2.
+class NonlocalInteraction
+{
+public:
+    /// Builds the weights of the given integration points. The neighbours are
+    /// searched in a uniform grid with the cell size of the internal length.
+    void initialize(
+        std::vector<IntegrationPointDataNonlocalInterface*> integration_points,
+        double internal_length_squared);
+
+    /// Computes the nonlocal kappa_d of all integration points from their
+    /// local kappa_d. An integration point gets a nonzero nonlocal kappa_d
+    /// only if itself or any of its neighbours has been damaged.
+    void computeNonlocalKappaD() const;
+
+    std::size_t getNumberOfIntegrationPoints() const
+    {
+        return _integration_points.size();
+    }
+
+    std::size_t getNumberOfInteractions() const { return _columns.size(); }
+
+private:
+    std::vector<IntegrationPointDataNonlocalInterface*> _integration_points;
+    std::vector<std::size_t> _row_offsets;
+    std::vector<std::size_t> _columns;
+    std::vector<double> _values;
+};
+}  // namespace SmallDeformationNonlocal
+}  // namespace ProcessLib
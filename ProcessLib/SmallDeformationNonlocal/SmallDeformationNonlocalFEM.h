@@ -18,7 +18,6 @@
 #include "MaterialLib/SolidModels/Ehlers.h"
 #include "MaterialLib/SolidModels/SelectSolidConstitutiveRelation.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
-#include "MeshLib/findElementsWithinRadius.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
 #include "NumLib/Function/Interpolation.h"
@@ -184,91 +183,6 @@ public:
         }
     }
 
-    double alpha_0(double const distance2) const
-    {
-        double const internal_length2 = _process_data.internal_length_squared;
-        return (distance2 > internal_length2)
-                   ? 0
-                   : (1 - distance2 / (internal_length2)) *
-                         (1 - distance2 / (internal_length2));
-    }
-
-    void nonlocal(
-        std::size_t const /*mesh_item_id*/,
-        std::vector<
-            std::unique_ptr<SmallDeformationNonlocalLocalAssemblerInterface<
-                DisplacementDim>>> const& local_assemblers) override
-    {
-        auto const search_element_ids = MeshLib::findElementsWithinRadius(
-            _element, _process_data.internal_length_squared);
-
-        unsigned const n_integration_points =
-            _integration_method.getNumberOfPoints();
-
-        std::vector<double> distances;  // Cache for ip-ip distances.
-        //
-        // For every integration point in this element collect the neighbouring
-        // integration points falling in given radius (internal length) and
-        // compute the alpha_kl weight.
-        //
-        for (unsigned k = 0; k < n_integration_points; k++)
-        {
-            //
-            // Collect the integration points.
-            //
-
-            auto const& xyz = _ip_data[k].coordinates;
-
-            // For all neighbors of element
-            for (auto const search_element_id : search_element_ids)
-            {
-                auto const& la = local_assemblers[search_element_id];
-                la->getIntegrationPointCoordinates(xyz, distances);
-                for (int ip = 0; ip < static_cast<int>(distances.size()); ++ip)
-                {
-                    if (distances[ip] >= _process_data.internal_length_squared)
-                    {
-                        continue;
-                    }
-                    // save into current ip_k
-                    _ip_data[k].non_local_assemblers.push_back(
-                        {la->getIPDataPtr(ip),
-                         std::numeric_limits<double>::quiet_NaN(),
-                         distances[ip]});
-                }
-            }
-            if (_ip_data[k].non_local_assemblers.size() == 0)
-            {
-                OGS_FATAL("no neighbours found!");
-            }
-
-            double a_k_sum_m = 0;
-            for (auto const& tuple : _ip_data[k].non_local_assemblers)
-            {
-                double const distance2_m = tuple.distance2;
-
-                auto const& w_m = tuple.ip_l_pointer->integration_weight;
-
-                a_k_sum_m += w_m * alpha_0(distance2_m);
-            }
-
-            //
-            // Calculate alpha_kl =
-            //       alpha_0(|x_k - x_l|) / int_{m \in ip} alpha_0(|x_k - x_m|)
-            //
-            for (auto& tuple : _ip_data[k].non_local_assemblers)
-            {
-                double const distance2_l = tuple.distance2;
-                double const a_kl = alpha_0(distance2_l) / a_k_sum_m;
-
-                // Store the a_kl already multiplied with the integration
-                // weight of that l integration point.
-                auto const w_l = tuple.ip_l_pointer->integration_weight;
-                tuple.alpha_kl_times_w_l = a_kl * w_l;
-            }
-        }
-    }
-
     Eigen::Vector3d getSingleIntegrationPointCoordinates(
         int integration_point) const
     {
@@ -285,25 +199,6 @@ public:
         return xyz;
     }
 
-    /// For each of the current element's integration points the squared
-    /// distance from the current integration point is computed and stored in
-    /// the given distances cache.
-    void getIntegrationPointCoordinates(
-        Eigen::Vector3d const& coords,
-        std::vector<double>& distances) const override
-    {
-        unsigned const n_integration_points =
-            _integration_method.getNumberOfPoints();
-
-        distances.resize(n_integration_points);
-
-        for (unsigned ip = 0; ip < n_integration_points; ip++)
-        {
-            auto const& xyz = _ip_data[ip].coordinates;
-            distances[ip] = (xyz - coords).squaredNorm();
-        }
-    }
-
     void assemble(double const /*t*/, double const /*dt*/,
                   std::vector<double> const& /*local_x*/,
                   std::vector<double> const& /*local_xdot*/,
@@ -403,19 +298,7 @@ public:
                     eps_p_eff_diff, sigma, _ip_data[ip].kappa_d_prev,
                     damage_properties.h_d, material_properties);
 
-                if (!_ip_data[ip].active_self)
-                {
-                    _ip_data[ip].active_self |= _ip_data[ip].kappa_d > 0;
-                    if (_ip_data[ip].active_self)
-                    {
-                        for (auto const& tuple :
-                             _ip_data[ip].non_local_assemblers)
-                        {
-                            // Activate the integration point.
-                            tuple.ip_l_pointer->activated = true;
-                        }
-                    }
-                }
+                _ip_data[ip].active_self |= _ip_data[ip].kappa_d > 0;
             }
         }
     }
@@ -465,18 +348,9 @@ public:
             double& damage = _ip_data[ip].damage;
 
             {
-                double nonlocal_kappa_d = 0;
-
-                if (_ip_data[ip].active_self || _ip_data[ip].activated)
-                {
-                    for (auto const& tuple : _ip_data[ip].non_local_assemblers)
-                    {
-                        // Get local variable for the integration point l.
-                        double const kappa_d_l = tuple.ip_l_pointer->kappa_d;
-                        double const a_kl_times_w_l = tuple.alpha_kl_times_w_l;
-                        nonlocal_kappa_d += a_kl_times_w_l * kappa_d_l;
-                    }
-                }
+                // Computed by the process' NonlocalInteraction after the
+                // preAssemble() of all local assemblers.
+                double nonlocal_kappa_d = _ip_data[ip].nonlocal_kappa_d;
 
                 auto const& ehlers_material =
                     static_cast<MaterialLib::Solids::Ehlers::SolidEhlers<
@@ -139,9 +139,20 @@ void SmallDeformationNonlocalProcess<DisplacementDim>::
         makeExtrapolator(1, getExtrapolator(), _local_assemblers,
                          &LocalAssemblerInterface::getIntPtDamage));
 
-    GlobalExecutor::executeMemberOnDereferenced(
-        &LocalAssemblerInterface::nonlocal, _local_assemblers,
-        _local_assemblers);
+    // Collect the integration points of all elements for the nonlocal
+    // averaging.
+    {
+        std::vector<IntegrationPointDataNonlocalInterface*> integration_points;
+        for (auto const& la : _local_assemblers)
+        {
+            for (unsigned ip = 0; ip < la->getNumberOfIntegrationPoints(); ++ip)
+            {
+                integration_points.push_back(la->getIPDataPtr(ip));
+            }
+        }
+        _nonlocal_interaction.initialize(std::move(integration_points),
+                                         _process_data.internal_length_squared);
+    }
 
     // Set initial conditions for integration point data.
     for (auto const& ip_writer : _integration_point_writer)
@@ -242,10 +253,9 @@ void SmallDeformationNonlocalProcess<DisplacementDim>::assembleConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        pv.getActiveElementIDs(), dof_table, t, dt, x, xdot, process_id, M, K,
-        b, _coupled_solutions);
+    executeGlobalAssembly(&VectorMatrixAssembler::assemble, _local_assemblers,
+                          pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
+                          process_id, M, K, b, _coupled_solutions);
 }
 
 template <int DisplacementDim>
@@ -264,6 +274,9 @@ void SmallDeformationNonlocalProcess<
         _global_assembler, &VectorMatrixAssembler::preAssemble,
         _local_assemblers, pv.getActiveElementIDs(),
         *_local_to_global_index_map, t, dt, x);
+
+    // Average the updated kappa_d over the neighbourhoods.
+    _nonlocal_interaction.computeNonlocalKappaD();
 }
 
 template <int DisplacementDim>
@@ -282,10 +295,10 @@ void SmallDeformationNonlocalProcess<DisplacementDim>::
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, pv.getActiveElementIDs(), dof_table, t, dt, x, xdot,
-        dxdot_dx, dx_dx, process_id, M, K, b, Jac, _coupled_solutions);
+    executeGlobalAssembly(
+        &VectorMatrixAssembler::assembleWithJacobian, _local_assemblers,
+        pv.getActiveElementIDs(), dof_table, t, dt, x, xdot, dxdot_dx, dx_dx,
+        process_id, M, K, b, Jac, _coupled_solutions);
 
     b.copyValues(*_nodal_forces);
     std::transform(_nodal_forces->begin(), _nodal_forces->end(),
@@ -15,6 +15,7 @@
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "ProcessLib/Process.h"
 
+#include "NonlocalInteraction.h"
 #include "SmallDeformationNonlocalFEM.h"
 #include "SmallDeformationNonlocalProcessData.h"
 
@@ -80,6 +81,8 @@ private:
         SmallDeformationNonlocalLocalAssemblerInterface<DisplacementDim>;
     std::vector<std::unique_ptr<LocalAssemblerInterface>> _local_assemblers;
 
+    NonlocalInteraction _nonlocal_interaction;
+
     std::unique_ptr<NumLib::LocalToGlobalIndexMap>
         _local_to_global_index_map_single_component;
 
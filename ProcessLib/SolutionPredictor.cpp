@@ -0,0 +1,113 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "SolutionPredictor.h"
+
+#include <cassert>
+
+#include "BaseLib/Error.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/DOF/GlobalMatrixProviders.h"
+
+namespace ProcessLib
+{
+SolutionPredictor::SolutionPredictor(int const order) : _order(order)
+{
+    assert(order == 1 || order == 2);
+}
+
+SolutionPredictor::~SolutionPredictor()
+{
+    for (auto const& solution : _history)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*solution.x);
+    }
+}
+
+void SolutionPredictor::pushAcceptedSolution(double const t,
+                                             GlobalVector const& x)
+{
+    GlobalVector* storage;
+    if (_history.size() > static_cast<std::size_t>(_order))
+    {
+        storage = _history.back().x;
+        _history.pop_back();
+        MathLib::LinAlg::copy(x, *storage);
+    }
+    else
+    {
+        storage = &NumLib::GlobalVectorProvider::provider.getVector(x);
+    }
+    _history.push_front({t, storage});
+}
+
+void SolutionPredictor::restart()
+{
+    while (_history.size() > 1)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(
+            *_history.back().x);
+        _history.pop_back();
+    }
+}
+
+void SolutionPredictor::predict(double const t, GlobalVector& x) const
+{
+    if (_history.size() < 2)
+    {
+        return;
+    }
+
+    // Lagrange extrapolation through the accepted solutions.
+    auto const n = _history.size();
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        double weight = 1;
+        for (std::size_t m = 0; m < n; ++m)
+        {
+            if (m != j)
+            {
+                weight *= (t - _history[m].t) / (_history[j].t - _history[m].t);
+            }
+        }
+
+        if (j == 0)
+        {
+            MathLib::LinAlg::copy(*_history[0].x, x);
+            MathLib::LinAlg::scale(x, weight);
+        }
+        else
+        {
+            MathLib::LinAlg::axpy(x, weight, *_history[j].x);
+        }
+    }
+}
+
+std::unique_ptr<SolutionPredictor> createSolutionPredictor(
+    std::string const& type)
+{
+    if (type == "none")
+    {
+        return nullptr;
+    }
+    if (type == "linear")
+    {
+        return std::make_unique<SolutionPredictor>(1);
+    }
+    if (type == "quadratic")
+    {
+        return std::make_unique<SolutionPredictor>(2);
+    }
+    OGS_FATAL(
+        "Unknown predictor type '%s'. Possible values are 'none', 'linear', "
+        "and 'quadratic'.",
+        type.c_str());
+}
+}  // namespace ProcessLib
@@ -0,0 +1,72 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
+
+namespace ProcessLib
+{
+/// Predicts the solution of a process at the end of a time step by a
+/// polynomial extrapolation of the solutions of the previous accepted time
+/// steps. The prediction is the initial guess of the nonlinear solver, which
+/// saves iterations for smooth transients.
+///
+/// The extrapolation takes the actual, possibly varying time step sizes into
+/// account. Its order is reduced as long as there are not enough previous
+/// solutions. The Dirichlet boundary conditions are imposed by the nonlinear
+/// solver on the predicted solution as on any other initial guess.
+class SolutionPredictor final
+{
+public:
+    /// \param order 1 for a linear, 2 for a quadratic extrapolation.
+    explicit SolutionPredictor(int const order);
+
+    ~SolutionPredictor();
+
+    SolutionPredictor(SolutionPredictor const&) = delete;
+    SolutionPredictor& operator=(SolutionPredictor const&) = delete;
+
+    /// Stores the solution \c x accepted at time \c t.
+    void pushAcceptedSolution(double const t, GlobalVector const& x);
+
+    /// Discards all but the latest accepted solution, such that the next time
+    /// step starts from it without extrapolation. Used after a rejected time
+    /// step and if the active subdomain of the process has changed, because
+    /// the older solutions do not describe the current transient anymore.
+    void restart();
+
+    /// Replaces \c x, the solution at the latest accepted time, by the
+    /// extrapolated solution at time \c t. Does nothing if there is only one
+    /// accepted solution.
+    void predict(double const t, GlobalVector& x) const;
+
+private:
+    struct AcceptedSolution
+    {
+        double t;
+        GlobalVector* x;
+    };
+
+    int const _order;
+    /// The latest accepted solutions, the newest one first. The vectors are
+    /// owned by the GlobalVectorProvider.
+    std::deque<AcceptedSolution> _history;
+};
+
+/// Creates a predictor of the given type, which is "none", "linear", or
+/// "quadratic". Returns a nullptr for "none".
+std::unique_ptr<SolutionPredictor> createSolutionPredictor(
+    std::string const& type);
+}  // namespace ProcessLib
@@ -34,10 +34,19 @@ void LineSourceTerm::integrate(const double t, GlobalVector const& /*x*/,
 {
     DBUG("Assemble LineSourceTerm.");
 
-    // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberOnDereferenced(
-        &LineSourceTermLocalAssemblerInterface::integrate, _local_assemblers,
-        *_source_term_dof_table, t, b);
+    auto const assemble = [&](GlobalVector& b_) {
+        // Call global assembler for each local assembly item.
+        GlobalExecutor::executeMemberOnDereferenced(
+            &LineSourceTermLocalAssemblerInterface::integrate,
+            _local_assemblers, *_source_term_dof_table, t, b_);
+    };
+
+    if (auto const factor = _line_source_term_parameter.getTimeFactor(t))
+    {
+        _time_scaled_rhs.add(*factor, b, assemble);
+        return;
+    }
+    assemble(b);
 }
 
 }  // namespace ProcessLib
@@ -13,6 +13,7 @@
 #include <memory>
 #include <vector>
 
+#include "ProcessLib/Utils/TimeScaledRhs.h"
 #include "SourceTerm.h"
 #include "LineSourceTermFEM.h"
 
@@ -35,6 +36,10 @@ private:
     ParameterLib::Parameter<double> const& _line_source_term_parameter;
     std::vector<std::unique_ptr<LineSourceTermLocalAssemblerInterface>>
         _local_assemblers;
+
+    /// Used instead of the element integration if the source term only
+    /// varies in time by a factor.
+    mutable TimeScaledRhs _time_scaled_rhs;
 };
 
 }  // namespace ProcessLib
@@ -36,19 +36,28 @@ void NodalSourceTerm::integrate(const double t, GlobalVector const& /*x*/,
 {
     DBUG("Assemble NodalSourceTerm.");
 
-    for (MeshLib::Node const* const node : _st_mesh.getNodes())
+    auto const assemble = [&](GlobalVector& b_) {
+        for (MeshLib::Node const* const node : _st_mesh.getNodes())
+        {
+            auto const node_id = node->getID();
+            MeshLib::Location const l{_source_term_mesh_id,
+                                      MeshLib::MeshItemType::Node, node_id};
+            auto const index = _source_term_dof_table->getGlobalIndex(
+                l, _variable_id, _component_id);
+
+            ParameterLib::SpatialPosition pos;
+            pos.setNodeID(node_id);
+
+            b_.add(index, _parameter(t, pos).front());
+        }
+    };
+
+    if (auto const factor = _parameter.getTimeFactor(t))
     {
-        auto const node_id = node->getID();
-        MeshLib::Location const l{_source_term_mesh_id,
-                                  MeshLib::MeshItemType::Node, node_id};
-        auto const index = _source_term_dof_table->getGlobalIndex(
-            l, _variable_id, _component_id);
-
-        ParameterLib::SpatialPosition pos;
-        pos.setNodeID(node_id);
-
-        b.add(index, _parameter(t, pos).front());
+        _time_scaled_rhs.add(*factor, b, assemble);
+        return;
     }
+    assemble(b);
 }
 
 }  // namespace ProcessLib
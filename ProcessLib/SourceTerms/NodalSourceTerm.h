@@ -11,6 +11,7 @@
 #pragma once
 
 #include "SourceTerm.h"
+#include "ProcessLib/Utils/TimeScaledRhs.h"
 
 namespace ProcessLib
 {
@@ -32,6 +33,10 @@ private:
     int const _variable_id;
     int const _component_id;
     ParameterLib::Parameter<double> const& _parameter;
+
+    /// Used instead of the parameter evaluations if the parameter only varies
+    /// in time by a factor.
+    mutable TimeScaledRhs _time_scaled_rhs;
 };
 
 }  // namespace ProcessLib
@@ -75,16 +75,60 @@ PythonSourceTerm::PythonSourceTerm(
         *_source_term_dof_table, shapefunction_order, _local_assemblers,
         _source_term_data.source_term_mesh.isAxiallySymmetric(),
         integration_order, _source_term_data);
+
+    _integration_point_offsets.reserve(_local_assemblers.size() + 1);
+    _integration_point_offsets.push_back(0);
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        _integration_point_offsets.push_back(
+            _integration_point_offsets.back() +
+            local_assembler->getNumberOfIntegrationPoints());
+    }
 }
 
 void PythonSourceTerm::integrate(const double t, const GlobalVector& x,
                                  GlobalVector& b, GlobalMatrix* Jac) const
 {
-    FlushStdoutGuard guard(_flush_stdout);
+    auto const num_integration_points = _integration_point_offsets.back();
+    auto const num_comp_total = _source_term_dof_table->getNumberOfComponents();
+
+    // Gather the data of all integration points such that Python is called
+    // only once per assembly.
+    Eigen::MatrixXd coords(num_integration_points, 3);
+    Eigen::MatrixXd primary_variables(num_integration_points, num_comp_total);
+    for (std::size_t i = 0; i < _local_assemblers.size(); ++i)
+    {
+        _local_assemblers[i]->getIntegrationPointData(
+            i, *_source_term_dof_table, x, _integration_point_offsets[i],
+            coords, primary_variables);
+    }
+
+    std::pair<std::vector<double>, std::vector<std::vector<double>>>
+        fluxes_dfluxes;
+    {
+        FlushStdoutGuard guard(_flush_stdout);
+        fluxes_dfluxes = _source_term_data.source_term_object->getFluxes(
+            t, coords, primary_variables);
+    }
+    auto const& fluxes = fluxes_dfluxes.first;
+    auto const& flux_jacobians = fluxes_dfluxes.second;
 
-    GlobalExecutor::executeMemberOnDereferenced(
-        &PythonSourceTermLocalAssemblerInterface::assemble, _local_assemblers,
-        *_source_term_dof_table, t, x, b, Jac);
+    if (fluxes.size() != num_integration_points ||
+        flux_jacobians.size() != num_integration_points)
+    {
+        OGS_FATAL(
+            "The Python source term must return the flux and its derivatives "
+            "for each of the %d integration points. %d fluxes and %d "
+            "derivatives returned from Python.",
+            num_integration_points, fluxes.size(), flux_jacobians.size());
+    }
+
+    for (std::size_t i = 0; i < _local_assemblers.size(); ++i)
+    {
+        _local_assemblers[i]->assembleFluxes(
+            i, *_source_term_dof_table, _integration_point_offsets[i], fluxes,
+            flux_jacobians, b, Jac);
+    }
 }
 
 }  // namespace Python
@@ -63,6 +63,10 @@ private:
     std::vector<std::unique_ptr<PythonSourceTermLocalAssemblerInterface>>
         _local_assemblers;
 
+    //! Offsets of the integration points of each element in the arrays passed
+    //! to Python, the last entry being the total number of integration points.
+    std::vector<std::size_t> _integration_point_offsets;
+
     //! Whether or not to flush standard output before and after each call to
     //! Python code. Ensures right order of output messages and therefore
     //! simplifies debugging.
@@ -86,10 +86,17 @@ public:
         }
     }
 
-    void assemble(std::size_t const source_term_element_id,
-                  NumLib::LocalToGlobalIndexMap const& dof_table_source_term,
-                  double const t, const GlobalVector& x, GlobalVector& b,
-                  GlobalMatrix* Jac) override
+    unsigned getNumberOfIntegrationPoints() const override
+    {
+        return _integration_method.getNumberOfPoints();
+    }
+
+    void getIntegrationPointData(
+        std::size_t const /*source_term_element_id*/,
+        NumLib::LocalToGlobalIndexMap const& dof_table_source_term,
+        GlobalVector const& x, std::size_t const offset,
+        Eigen::MatrixXd& coords,
+        Eigen::MatrixXd& primary_variables) const override
     {
         using ShapeMatricesType =
             ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
@@ -143,25 +150,41 @@ public:
             }
         }
 
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            auto const& N = _ip_data[ip].N;
+            auto const& ip_coords = fe.interpolateCoordinates(N);
+            coords.row(offset + ip) =
+                Eigen::Vector3d(ip_coords[0], ip_coords[1], ip_coords[2]);
+            // Assumption: all primary variables have same shape functions.
+            primary_variables.row(offset + ip) = N * primary_variables_mat;
+        }
+    }
+
+    void assembleFluxes(
+        std::size_t const source_term_element_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_source_term,
+        std::size_t const offset, std::vector<double> const& fluxes,
+        std::vector<std::vector<double>> const& flux_jacobians,
+        GlobalVector& b, GlobalMatrix* Jac) const override
+    {
+        unsigned const num_integration_points =
+            _integration_method.getNumberOfPoints();
+        auto const num_nodes = ShapeFunction::NPOINTS;
+        auto const num_comp_total =
+            dof_table_source_term.getNumberOfComponents();
+
         NodalRowVectorType local_rhs = Eigen::VectorXd::Zero(num_nodes);
         NodalMatrixType local_Jac =
             Eigen::MatrixXd::Zero(num_nodes, num_nodes * num_comp_total);
-        std::vector<double> prim_vars_data(num_comp_total);
-        auto prim_vars = MathLib::toVector(prim_vars_data);
 
         for (unsigned ip = 0; ip < num_integration_points; ip++)
         {
             auto const& ip_data = _ip_data[ip];
             auto const& N = ip_data.N;
-            auto const& coords = fe.interpolateCoordinates(N);
-            // Assumption: all primary variables have same shape functions.
-            prim_vars = N * primary_variables_mat;
-
             auto const& w = ip_data.integration_weight;
-            auto const flux_dflux =
-                _data.source_term_object->getFlux(t, coords, prim_vars_data);
-            auto const& flux = flux_dflux.first;
-            auto const& dflux = flux_dflux.second;
+            auto const flux = fluxes[offset + ip];
+            auto const& dflux = flux_jacobians[offset + ip];
             local_rhs.noalias() += N * (flux * w);
 
             if (static_cast<int>(dflux.size()) != num_comp_total)
@@ -193,10 +216,12 @@ public:
             }
         }
 
-        auto const& indices_specific_component =
+        auto const indices_range =
             dof_table_source_term(source_term_element_id,
                                   _data.global_component_id)
                 .rows;
+        std::vector<GlobalIndexType> const indices_specific_component(
+            indices_range.begin(), indices_range.end());
         b.add(indices_specific_component, local_rhs);
 
         if (Jac)
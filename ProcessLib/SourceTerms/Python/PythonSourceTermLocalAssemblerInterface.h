@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <Eigen/Core>
+
 namespace ProcessLib
 {
 namespace SourceTerms
@@ -17,14 +19,31 @@ namespace SourceTerms
 namespace Python
 {
 
+//! Local assembler interface of the Python source term, which evaluates the
+//! fluxes of all integration points of the source term mesh in a single
+//! Python call.
 class PythonSourceTermLocalAssemblerInterface
 {
 public:
-    virtual void assemble(
+    virtual unsigned getNumberOfIntegrationPoints() const = 0;
+
+    //! Writes the positions and the primary variables at the integration
+    //! points of the element to the rows of \c coords and \c
+    //! primary_variables starting at \c offset.
+    virtual void getIntegrationPointData(
+        std::size_t const source_term_element_id,
+        NumLib::LocalToGlobalIndexMap const& source_term_dof_table,
+        GlobalVector const& x, std::size_t const offset,
+        Eigen::MatrixXd& coords, Eigen::MatrixXd& primary_variables) const = 0;
+
+    //! Assembles the fluxes at the integration points of the element, which
+    //! are stored in the entries starting at \c offset.
+    virtual void assembleFluxes(
         std::size_t const source_term_element_id,
         NumLib::LocalToGlobalIndexMap const& source_term_dof_table,
-        double const t, const GlobalVector& x, GlobalVector& b,
-        GlobalMatrix* Jac) = 0;
+        std::size_t const offset, std::vector<double> const& fluxes,
+        std::vector<std::vector<double>> const& flux_jacobians,
+        GlobalVector& b, GlobalMatrix* Jac) const = 0;
 
     virtual ~PythonSourceTermLocalAssemblerInterface() = default;
 };
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <Eigen/Core>
+
 namespace ProcessLib
 {
 namespace SourceTerms
@@ -33,6 +35,41 @@ public:
         double /*t*/, std::array<double, 3> const& /*x*/,
         std::vector<double> const& /*primary_variables*/) const = 0;
 
+    /*!
+     * Computes the fluxes for all integration points of the source term mesh
+     * at once (time, positions and primary variables at the integration
+     * points as the rows of NumPy arrays).
+     *
+     * The default implementation calls getFlux() for each integration point.
+     * Overriding this method avoids the overhead of a Python call per
+     * integration point.
+     *
+     * \return a pair (fluxes, flux_jacobians) of sequences with one entry per
+     * integration point, the latter being the derivatives of the flux w.r.t.
+     * all primary variables.
+     */
+    virtual std::pair<std::vector<double>, std::vector<std::vector<double>>>
+    getFluxes(double t, Eigen::MatrixXd const& coords,
+              Eigen::MatrixXd const& primary_variables) const
+    {
+        auto const num_points = static_cast<std::size_t>(coords.rows());
+        std::vector<double> fluxes(num_points);
+        std::vector<std::vector<double>> flux_jacobians(num_points);
+        std::vector<double> point_primary_variables(primary_variables.cols());
+        for (std::size_t i = 0; i < num_points; ++i)
+        {
+            Eigen::VectorXd::Map(point_primary_variables.data(),
+                                 point_primary_variables.size()) =
+                primary_variables.row(i);
+            auto flux_dflux =
+                getFlux(t, {{coords(i, 0), coords(i, 1), coords(i, 2)}},
+                        point_primary_variables);
+            fluxes[i] = flux_dflux.first;
+            flux_jacobians[i] = std::move(flux_dflux.second);
+        }
+        return {std::move(fluxes), std::move(flux_jacobians)};
+    }
+
     virtual ~PythonSourceTermPythonSideInterface() = default;
 };
 }  // namespace Python
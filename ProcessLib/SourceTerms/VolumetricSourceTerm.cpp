@@ -35,10 +35,19 @@ void VolumetricSourceTerm::integrate(const double t, GlobalVector const& /*x*/,
 {
     DBUG("Assemble VolumetricSourceTerm.");
 
-    // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberOnDereferenced(
-        &VolumetricSourceTermLocalAssemblerInterface::integrate,
-        _local_assemblers, *_source_term_dof_table, t, b);
+    auto const assemble = [&](GlobalVector& b_) {
+        // Call global assembler for each local assembly item.
+        GlobalExecutor::executeMemberOnDereferenced(
+            &VolumetricSourceTermLocalAssemblerInterface::integrate,
+            _local_assemblers, *_source_term_dof_table, t, b_);
+    };
+
+    if (auto const factor = _volumetric_source_term.getTimeFactor(t))
+    {
+        _time_scaled_rhs.add(*factor, b, assemble);
+        return;
+    }
+    assemble(b);
 }
 
 }   // namespace ProcessLib
@@ -13,6 +13,7 @@
 #include <memory>
 #include <vector>
 
+#include "ProcessLib/Utils/TimeScaledRhs.h"
 #include "SourceTerm.h"
 #include "VolumetricSourceTermFEM.h"
 
@@ -34,6 +35,10 @@ private:
     ParameterLib::Parameter<double> const& _volumetric_source_term;
     std::vector<std::unique_ptr<VolumetricSourceTermLocalAssemblerInterface>>
         _local_assemblers;
+
+    /// Used instead of the element integration if the source term only
+    /// varies in time by a factor.
+    mutable TimeScaledRhs _time_scaled_rhs;
 };
 
 }  // namespace ProcessLib
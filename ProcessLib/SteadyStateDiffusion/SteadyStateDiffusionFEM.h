@@ -120,8 +120,11 @@ public:
                 medium.property(MaterialPropertyLib::PropertyType::diffusion)
                     .value(vars, pos, t, dt));
 
-            local_K.noalias() += sm.dNdx.transpose() * k * sm.dNdx * sm.detJ *
-                                 sm.integralMeasure * wp.getWeight();
+            double const w = sm.detJ * sm.integralMeasure * wp.getWeight();
+
+            // Scale the small GlobalDim x GlobalDim tensor instead of the
+            // nodal matrix.
+            local_K.noalias() += sm.dNdx.transpose() * (k * w) * sm.dNdx;
         }
     }
 
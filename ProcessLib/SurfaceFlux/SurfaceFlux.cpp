@@ -59,12 +59,21 @@ void SurfaceFlux::integrate(
     double const t,
     MeshLib::Mesh const& bulk_mesh,
     std::vector<std::size_t> const& active_element_ids,
+    bool const use_parallel_integration,
     std::function<Eigen::Vector3d(
         std::size_t const, MathLib::Point3d const&, double const,
         std::vector<GlobalVector*> const&)> const& getFlux)
 {
     DBUG("Integrate SurfaceFlux.");
 
+    // Each local assembler writes to the entry of its own element only.
+    if (use_parallel_integration)
+    {
+        NumLib::ParallelExecutor::executeSelectedMemberOnDereferenced(
+            &SurfaceFluxLocalAssemblerInterface::integrate, _local_assemblers,
+            active_element_ids, x, balance, t, bulk_mesh, getFlux);
+        return;
+    }
     GlobalExecutor::executeSelectedMemberOnDereferenced(
         &SurfaceFluxLocalAssemblerInterface::integrate,
         _local_assemblers, active_element_ids, x, balance, t, bulk_mesh, getFlux);
@@ -37,6 +37,8 @@ public:
     /// fetch the information for the integration over the surface mesh.
     /// @param active_element_ids The IDs of active elements. It is empty if
     ///                           there is no deactivated subdomain.
+    /// @param use_parallel_integration If set, the elements are integrated
+    /// concurrently. Then \c getFlux must be thread-safe.
     /// @param getFlux function that calculates the flux in the integration
     /// points of the face elements of the bulk element that belongs to the
     /// surface.
@@ -45,6 +47,7 @@ public:
                    double const t,
                    MeshLib::Mesh const& bulk_mesh,
                    std::vector<std::size_t> const& active_element_ids,
+                   bool const use_parallel_integration,
                    std::function<Eigen::Vector3d(
                        std::size_t const, MathLib::Point3d const&, double const,
                        std::vector<GlobalVector*> const&)> const& getFlux);
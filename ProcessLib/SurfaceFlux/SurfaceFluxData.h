@@ -85,13 +85,21 @@ struct SurfaceFluxData
             surface_mesh, property_vector_name, MeshLib::MeshItemType::Cell, 1);
         // initialise the PropertyVector pv with zero values
         std::fill(surfaceflux_pv->begin(), surfaceflux_pv->end(), 0.0);
-        auto surfaceflux_process = ProcessLib::SurfaceFlux(
-            surface_mesh,
-            p.getProcessVariables(process_id)[0].get().getNumberOfComponents(),
-            integration_order);
+        // The local assemblers depend on the surface mesh only and are reused
+        // in subsequent calls.
+        if (!surfaceflux_process)
+        {
+            surfaceflux_process = std::make_unique<ProcessLib::SurfaceFlux>(
+                surface_mesh,
+                p.getProcessVariables(process_id)[0]
+                    .get()
+                    .getNumberOfComponents(),
+                integration_order);
+        }
 
-        surfaceflux_process.integrate(
+        surfaceflux_process->integrate(
             x, *surfaceflux_pv, t, bulk_mesh, active_element_ids,
+            p.isParallelAssemblyUsed(),
             [&p](std::size_t const element_id, MathLib::Point3d const& pnt,
                  double const t, std::vector<GlobalVector*> const& x) {
                 return p.getFlux(element_id, pnt, t, x);
@@ -113,5 +121,6 @@ private:
     std::string const mesh_name;
     std::string const property_vector_name;
     std::string const output_mesh_file_name;
+    std::unique_ptr<ProcessLib::SurfaceFlux> surfaceflux_process;
 };
 }  // namespace ProcessLib
@@ -172,12 +172,14 @@ void TESLocalAssembler<ShapeFunction_, IntegrationMethod_, GlobalDim>::assemble(
         std::puts("### Element: ?");
 
         std::puts("---Velocity of water");
-        for (auto const& vs : _d.getData().velocity)
+        auto const& velocity = _d.getData().velocity;
+        for (unsigned d = 0; d < GlobalDim; ++d)
         {
             std::printf("| ");
-            for (auto v : vs)
+            for (unsigned ip = 0; ip < n_integration_points; ++ip)
             {
-                std::printf("%23.16e ", v);
+                std::printf("%23.16e ",
+                            velocity[d * n_integration_points + ip]);
             }
             std::printf("|\n");
         }
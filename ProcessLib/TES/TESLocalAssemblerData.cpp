@@ -20,7 +20,7 @@ TESLocalAssemblerData::TESLocalAssemblerData(AssemblyParams const& ap_,
     : ap(ap_),
       solid_density(num_int_pts, ap_.initial_solid_density),
       reaction_rate(num_int_pts),
-      velocity(dimension, std::vector<double>(num_int_pts)),
+      velocity(dimension * num_int_pts),
       reaction_adaptor(TESFEMReactionAdaptor::newInstance(*this)),
       solid_density_prev_ts(num_int_pts, ap_.initial_solid_density),
       reaction_rate_prev_ts(num_int_pts)
@@ -30,8 +30,10 @@ struct TESLocalAssemblerData
     // integration point quantities
     std::vector<double> solid_density;
     std::vector<double> reaction_rate;  // dC/dt * rho_SR_dry
-    std::vector<std::vector<double>>
-        velocity;  // vector of velocities for each integration point
+    /// Velocities at the integration points, stored contiguously component
+    /// by component, i.e., the entry [d * num_int_pts + ip] is the d-th
+    /// component at the integration point ip.
+    std::vector<double> velocity;
 
     // integration point values of unknowns -- temporary storage
     double p = std::numeric_limits<double>::quiet_NaN();  // gas pressure
@@ -238,8 +238,8 @@ void TESLocalAssemblerInner<Traits>::assembleIntegrationPoint(
     auto const contentCoeffMat = getContentCoeffMatrix(integration_point);
 
     // calculate velocity
-    assert((unsigned)sm.dNdx.rows() == _d.velocity.size() &&
-           (unsigned)sm.dNdx.cols() == _d.velocity[0].size());
+    auto const num_int_pts = static_cast<unsigned>(_d.solid_density.size());
+    assert(D * num_int_pts == _d.velocity.size());
 
     auto const velocity =
         (Traits::blockDimDim(laplaceCoeffMat, 0, 0, D, D) *
@@ -252,11 +252,11 @@ void TESLocalAssemblerInner<Traits>::assembleIntegrationPoint(
 
     for (unsigned d = 0; d < D; ++d)
     {
-        _d.velocity[d][integration_point] = velocity[d];
+        _d.velocity[d * num_int_pts + integration_point] = velocity[d];
     }
 
-    auto const detJ_w_im_NT =
-        (sm.detJ * weight * sm.integralMeasure * sm.N.transpose()).eval();
+    auto const detJ_w_im = sm.detJ * weight * sm.integralMeasure;
+    auto const detJ_w_im_NT = (detJ_w_im * sm.N.transpose()).eval();
     auto const detJ_w_im_NT_N = (detJ_w_im_NT * sm.N).eval();
     assert(detJ_w_im_NT_N.rows() == N && detJ_w_im_NT_N.cols() == N);
 
@@ -266,16 +266,30 @@ void TESLocalAssemblerInner<Traits>::assembleIntegrationPoint(
 
     for (unsigned r = 0; r < NODAL_DOF; ++r)
     {
+        // The Laplace coefficient matrix is block diagonal.
+        Traits::blockShpShp(local_K, N * r, N * r, N, N).noalias() +=
+            detJ_w_im * sm.dNdx.transpose() *
+            Traits::blockDimDim(laplaceCoeffMat, D * r, D * r, D, D) *
+            sm.dNdx;
+
+        // Most of the other coefficients are zero, their blocks are skipped.
         for (unsigned c = 0; c < NODAL_DOF; ++c)
         {
-            Traits::blockShpShp(local_K, N * r, N * c, N, N).noalias() +=
-                sm.detJ * weight * sm.integralMeasure * sm.dNdx.transpose() *
-                    Traits::blockDimDim(laplaceCoeffMat, D * r, D * c, D, D) *
-                    sm.dNdx  // end Laplacian part
-                + detJ_w_im_NT_N * contentCoeffMat(r, c) +
-                detJ_w_im_NT_vT_dNdx * advCoeffMat(r, c);
-            Traits::blockShpShp(local_M, N * r, N * c, N, N).noalias() +=
-                detJ_w_im_NT_N * massCoeffMat(r, c);
+            if (contentCoeffMat(r, c) != 0.0)
+            {
+                Traits::blockShpShp(local_K, N * r, N * c, N, N).noalias() +=
+                    detJ_w_im_NT_N * contentCoeffMat(r, c);
+            }
+            if (advCoeffMat(r, c) != 0.0)
+            {
+                Traits::blockShpShp(local_K, N * r, N * c, N, N).noalias() +=
+                    detJ_w_im_NT_vT_dNdx * advCoeffMat(r, c);
+            }
+            if (massCoeffMat(r, c) != 0.0)
+            {
+                Traits::blockShpShp(local_M, N * r, N * c, N, N).noalias() +=
+                    detJ_w_im_NT_N * massCoeffMat(r, c);
+            }
         }
     }
 
@@ -284,8 +298,7 @@ void TESLocalAssemblerInner<Traits>::assembleIntegrationPoint(
     for (unsigned r = 0; r < NODAL_DOF; ++r)
     {
         Traits::blockShp(local_b, N * r, N).noalias() +=
-            rhsCoeffVector(r) * sm.N.transpose() * sm.detJ * weight *
-            sm.integralMeasure;
+            rhsCoeffVector(r) * detJ_w_im_NT;
     }
 }
 
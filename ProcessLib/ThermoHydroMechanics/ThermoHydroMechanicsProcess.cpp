@@ -251,9 +251,9 @@ void ThermoHydroMechanicsProcess<DisplacementDim>::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        dof_table, t, dt, x, xdot, process_id, M, K, b, _coupled_solutions);
+    executeGlobalAssembly(
+        &VectorMatrixAssembler::assemble, _local_assemblers, {}, dof_table, t,
+        dt, x, xdot, process_id, M, K, b, _coupled_solutions);
 }
 
 template <int DisplacementDim>
@@ -300,10 +300,10 @@ void ThermoHydroMechanicsProcess<DisplacementDim>::
         dof_tables.emplace_back(*_local_to_global_index_map);
     }
 
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, dof_tables, t, dt, x, xdot, dxdot_dx, dx_dx,
-        process_id, M, K, b, Jac, _coupled_solutions);
+    executeGlobalAssembly(
+        &VectorMatrixAssembler::assembleWithJacobian, _local_assemblers, {},
+        dof_tables, t, dt, x, xdot, dxdot_dx, dx_dx, process_id, M, K, b, Jac,
+        _coupled_solutions);
 
     auto copyRhs = [&](int const variable_id, auto& output_vector) {
         if (_use_monolithic_scheme)
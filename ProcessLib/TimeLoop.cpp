@@ -10,10 +10,17 @@
 
 #include "TimeLoop.h"
 
+#include <algorithm>
+#include <future>
+
 #include "BaseLib/Error.h"
 #include "BaseLib/RunTime.h"
+#include "BaseLib/ConvergenceTelemetry.h"
+#include "BaseLib/Timing.h"
 #include "ChemistryLib/ChemicalSolverInterface.h"
 #include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/DOF/DOFTableUtil.h"
+#include "NumLib/DOF/GlobalMatrixProviders.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
 #include "NumLib/ODESolver/TimeDiscretizedODESystem.h"
 #include "ProcessLib/CreateProcessData.h"
@@ -66,6 +73,40 @@ bool isMonolithicProcess(ProcessLib::ProcessData const& process_data)
 {
     return process_data.process.isMonolithicSchemeUsed();
 }
+
+#ifdef USE_PETSC
+//! Passes the global indices of the process variables to the linear solver,
+//! which uses them as fields if a fieldsplit preconditioner is configured.
+void setFieldSplits(ProcessLib::ProcessData const& process_data)
+{
+    auto const& pcs = process_data.process;
+    auto const process_id = process_data.process_id;
+    auto const& process_variables = pcs.getProcessVariables(process_id);
+    auto const& dof_table = pcs.getDOFTable(process_id);
+
+    // Only if the DOF table's variables are the process variables.
+    if (process_variables.size() < 2 ||
+        dof_table.getNumberOfVariables() !=
+            static_cast<int>(process_variables.size()))
+    {
+        return;
+    }
+
+    std::vector<std::string> names;
+    std::vector<std::vector<GlobalIndexType>> global_indices;
+    for (int variable_id = 0;
+         variable_id < static_cast<int>(process_variables.size());
+         ++variable_id)
+    {
+        names.push_back(process_variables[variable_id].get().getName());
+        global_indices.push_back(
+            NumLib::getNonGhostGlobalIndices(dof_table, variable_id));
+    }
+
+    process_data.nonlinear_solver.getLinearSolver().setFieldSplits(
+        names, global_indices);
+}
+#endif
 }  // namespace
 
 namespace ProcessLib
@@ -193,6 +234,22 @@ void calculateNonEquilibriumInitialResiduum(
     }
 }
 
+/// Adds the accepted solutions of the processes in the offline mode of a
+/// reduced order model to their snapshots.
+void addReducedOrderModelSnapshots(
+    std::vector<std::unique_ptr<ProcessData>> const& per_process_data,
+    std::vector<GlobalVector*> const& process_solutions)
+{
+    for (auto const& process_data : per_process_data)
+    {
+        if (auto const& rom = process_data->reduced_order_model_snapshots)
+        {
+            rom->snapshots.addSnapshot(
+                *process_solutions[process_data->process_id]);
+        }
+    }
+}
+
 NumLib::NonlinearSolverStatus solveOneTimeStepOneProcess(
     std::vector<GlobalVector*>& x, std::size_t const timestep, double const t,
     double const delta_t, ProcessData const& process_data,
@@ -238,15 +295,21 @@ TimeLoop::TimeLoop(
     const int global_coupling_max_iterations,
     std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
         global_coupling_conv_crit,
+    std::unique_ptr<CouplingAcceleration>&& coupling_acceleration,
     std::unique_ptr<ChemistryLib::ChemicalSolverInterface>&& chemical_system,
-    const double start_time, const double end_time)
+    std::unique_ptr<CheckpointConfig>&& checkpoint_config,
+    bool const concurrent_processes, const double start_time,
+    const double end_time)
     : _output(std::move(output)),
       _per_process_data(std::move(per_process_data)),
       _start_time(start_time),
       _end_time(end_time),
       _global_coupling_max_iterations(global_coupling_max_iterations),
       _global_coupling_conv_crit(std::move(global_coupling_conv_crit)),
-      _chemical_system(std::move(chemical_system))
+      _coupling_acceleration(std::move(coupling_acceleration)),
+      _chemical_system(std::move(chemical_system)),
+      _checkpoint_config(std::move(checkpoint_config)),
+      _concurrent_processes(concurrent_processes)
 {
 }
 
@@ -263,6 +326,23 @@ void TimeLoop::setCoupledSolutions()
         // append a solution vector of suitable size
         _solutions_of_last_cpl_iteration.emplace_back(&x0);
     }
+
+    bool const has_subcycles = std::any_of(
+        _per_process_data.begin(), _per_process_data.end(),
+        [](auto const& process_data) {
+            return process_data->number_of_subcycles > 1;
+        });
+    if (!has_subcycles)
+    {
+        return;
+    }
+    for (auto const* x : _process_solutions)
+    {
+        _solutions_at_step_begin.emplace_back(
+            &NumLib::GlobalVectorProvider::provider.getVector(*x));
+        _interpolated_solutions.emplace_back(
+            &NumLib::GlobalVectorProvider::provider.getVector(*x));
+    }
 }
 
 double TimeLoop::computeTimeStepping(const double prev_dt, double& t,
@@ -285,13 +365,16 @@ double TimeLoop::computeTimeStepping(const double prev_dt, double& t,
             (conv_crit) ? conv_crit->getVectorNormType()
                         : MathLib::VecNormType::NORM2;
 
-        const double solution_error =
-            (timestepper->isSolutionErrorComputationNeeded())
-                ? ((t == timestepper->begin())
-                       ? 0.  // Always accepts the zeroth step
-                       : time_disc->getRelativeChangeFromPreviousTimestep(
-                             x, norm_type))
-                : 0.;
+        double solution_error = 0.;  // Always accepts the zeroth step
+        if (timestepper->isSolutionErrorComputationNeeded() &&
+            t != timestepper->begin())
+        {
+            solution_error =
+                timestepper->isLocalErrorEstimateNeeded()
+                    ? time_disc->getRelativeLocalErrorEstimate(x, norm_type)
+                    : time_disc->getRelativeChangeFromPreviousTimestep(
+                          x, norm_type);
+        }
 
         if (!ppd.nonlinear_solver_status.error_norms_met)
         {
@@ -330,6 +413,28 @@ double TimeLoop::computeTimeStepping(const double prev_dt, double& t,
         }
     }
 
+    // The explicit schemes limit the time step size for stability.
+    for (auto const& ppd : _per_process_data)
+    {
+        auto const* const forward_euler =
+            dynamic_cast<NumLib::ForwardEuler const*>(ppd->time_disc.get());
+        if (forward_euler == nullptr || !forward_euler->isMassLumped())
+        {
+            continue;
+        }
+        double const max_dt =
+            forward_euler->getTimeStepSafetyFactor() *
+            ppd->process.getStableTimeStep(ppd->process_id);
+        if (dt > max_dt)
+        {
+            INFO(
+                "Limiting the time step size to %g for the stability of the "
+                "explicit scheme of process %d.",
+                max_dt, ppd->process_id);
+            dt = max_dt;
+        }
+    }
+
     if (all_process_steps_accepted)
     {
         _repeating_times_of_rejected_step = 0;
@@ -348,6 +453,21 @@ double TimeLoop::computeTimeStepping(const double prev_dt, double& t,
         auto& timestepper = ppd.timestepper;
         timestepper->resetCurrentTimeStep(dt);
 
+        auto& x = *_process_solutions[i];
+        if (ppd.predictor)
+        {
+            if (all_process_steps_accepted)
+            {
+                ppd.predictor->pushAcceptedSolution(t, x);
+            }
+            else
+            {
+                // The extrapolation might have caused the rejection, the
+                // repeated step starts from the last accepted solution.
+                ppd.predictor->restart();
+            }
+        }
+
         if (t == timestepper->begin())
         {
             is_initial_step = true;
@@ -355,7 +475,6 @@ double TimeLoop::computeTimeStepping(const double prev_dt, double& t,
         }
 
         auto& time_disc = ppd.time_disc;
-        auto& x = *_process_solutions[i];
         if (all_process_steps_accepted)
         {
             time_disc->pushState(t, x, *ppd.mat_strg);
@@ -439,6 +558,10 @@ void TimeLoop::initialize()
             conv_crit->setDOFTable(pcs.getDOFTable(process_id), pcs.getMesh());
         }
 
+#ifdef USE_PETSC
+        setFieldSplits(*process_data);
+#endif
+
         // Add the fixed times of output to time stepper in order that
         // the time stepping is performed and the results are output at
         // these times. Note: only the adaptive time steppers can have the
@@ -447,16 +570,45 @@ void TimeLoop::initialize()
         timestepper->addFixedOutputTimes(_output->getFixedOutputTimes());
     }
 
+    if (_concurrent_processes && BaseLib::ConvergenceTelemetry::isEnabled())
+    {
+        // The convergence data are recorded per nonlinear iteration of one
+        // process at a time.
+        WARN(
+            "The processes are solved one after another because the "
+            "convergence data are recorded.");
+        _concurrent_processes = false;
+    }
+
     // init solution storage
     _process_solutions = setInitialConditions(_start_time, _per_process_data);
 
-    if (_chemical_system != nullptr)
+    if (_checkpoint_config && !_checkpoint_config->restart_from.empty())
+    {
+        _restart_state =
+            readCheckpoint(_checkpoint_config->restart_from, _per_process_data,
+                           _process_solutions, _chemical_system.get());
+
+        for (auto& process_data : _per_process_data)
+        {
+            auto const& x = *_process_solutions[process_data->process_id];
+            process_data->time_disc->setInitialState(_restart_state->t, x);
+            if (process_data->predictor)
+            {
+                process_data->predictor->pushAcceptedSolution(
+                    _restart_state->t, x);
+            }
+        }
+    }
+
+    if (_chemical_system != nullptr && !_restart_state)
     {
         BaseLib::RunTime time_phreeqc;
         time_phreeqc.start();
         _chemical_system->executeInitialCalculation(_process_solutions);
         INFO("[time] Phreeqc took %g s.", time_phreeqc.elapsed());
     }
+    BaseLib::Timing::recordMemoryStage("initial_conditions");
 
     // All _per_process_data share the first process.
     bool const is_staggered_coupling =
@@ -466,14 +618,41 @@ void TimeLoop::initialize()
     {
         setCoupledSolutions();
     }
+    else if (_per_process_data[0]->number_of_subcycles > 1)
+    {
+        OGS_FATAL(
+            "Subcycles of a process are only possible in the staggered "
+            "scheme.");
+    }
 
-    // Output initial conditions
+    // Output initial conditions. The restart state has been written before.
+    if (!_restart_state)
     {
         const bool output_initial_condition = true;
         outputSolutions(output_initial_condition, 0, _start_time, *_output,
                         &Output::doOutput);
     }
+    addReducedOrderModelSnapshots(_per_process_data, _process_solutions);
+
+    // The matrices and vectors released during the setup are not needed
+    // anymore; the time steps acquire their own.
+    NumLib::GlobalMatrixProvider::provider.freeUnusedMatrices();
+    NumLib::GlobalVectorProvider::provider.freeUnusedVectors();
 
+    if (_restart_state)
+    {
+        _current_time = _restart_state->t;
+        _dt = _restart_state->dt;
+        _accepted_steps = _restart_state->accepted_steps;
+        _rejected_steps = _restart_state->rejected_steps;
+    }
+    else
+    {
+        _current_time = _start_time;
+        _dt = computeTimeStepping(0.0, _current_time, _accepted_steps,
+                                  _rejected_steps);
+    }
+    _time_loop_finished = !(_current_time < _end_time);
 }
 
 /*
@@ -486,99 +665,154 @@ void TimeLoop::initialize()
  */
 bool TimeLoop::loop()
 {
-    // All _per_process_data share the first process.
-    bool const is_staggered_coupling =
-        !isMonolithicProcess(*_per_process_data[0]);
-
-    bool non_equilibrium_initial_residuum_computed = false;
-    double t = _start_time;
-    std::size_t accepted_steps = 0;
-    std::size_t rejected_steps = 0;
-    NumLib::NonlinearSolverStatus nonlinear_solver_status;
-
-    double dt = computeTimeStepping(0.0, t, accepted_steps, rejected_steps);
+    while (executeTimeStep())
+    {
+    }
+    return outputLastTimeStep();
+}
 
-    while (t < _end_time)
+bool TimeLoop::executeTimeStep()
+{
+    if (_time_loop_finished)
     {
-        BaseLib::RunTime time_timestep;
-        time_timestep.start();
+        return false;
+    }
 
-        t += dt;
-        const double prev_dt = dt;
+    BaseLib::RunTime time_timestep;
+    time_timestep.start();
 
-        const std::size_t timesteps = accepted_steps + 1;
-        // TODO(wenqing): , input option for time unit.
-        INFO("=== Time stepping at step #%u and time %g with step size %g",
-             timesteps, t, dt);
+    _current_time += _dt;
+    double const t = _current_time;
+    double const dt = _dt;
 
-        // Check element deactivation:
-        for (auto& process_data : _per_process_data)
-        {
+    const std::size_t timesteps = _accepted_steps + 1;
+    // TODO(wenqing): , input option for time unit.
+    INFO("=== Time stepping at step #%u and time %g with step size %g",
+         timesteps, t, dt);
+    BaseLib::ConvergenceTelemetry::beginTimestep(timesteps, t, dt);
+
+    // Check element deactivation:
+    for (auto& process_data : _per_process_data)
+    {
+        bool const active_elements_changed =
             process_data->process.updateDeactivatedSubdomains(
                 t, process_data->process_id);
-        }
-
-        if (!non_equilibrium_initial_residuum_computed)
+        // The previous solutions of a changed domain are not extrapolated.
+        if (active_elements_changed && process_data->predictor)
         {
-            calculateNonEquilibriumInitialResiduum(_per_process_data,
-                                                   _process_solutions);
-            non_equilibrium_initial_residuum_computed = true;
+            process_data->predictor->restart();
         }
+    }
 
-        if (is_staggered_coupling)
-        {
-            nonlinear_solver_status =
-                solveCoupledEquationSystemsByStaggeredScheme(t, dt, timesteps);
-        }
-        else
-        {
-            nonlinear_solver_status =
-                solveUncoupledEquationSystems(t, dt, timesteps);
-        }
+    if (!_non_equilibrium_initial_residuum_computed)
+    {
+        calculateNonEquilibriumInitialResiduum(_per_process_data,
+                                               _process_solutions);
+        _non_equilibrium_initial_residuum_computed = true;
+    }
 
-        INFO("[time] Time step #%u took %g s.", timesteps,
-             time_timestep.elapsed());
+    // All _per_process_data share the first process.
+    bool const is_staggered_coupling =
+        !isMonolithicProcess(*_per_process_data[0]);
+    if (is_staggered_coupling)
+    {
+        _nonlinear_solver_status =
+            solveCoupledEquationSystemsByStaggeredScheme(t, dt, timesteps);
+    }
+    else
+    {
+        _nonlinear_solver_status =
+            solveUncoupledEquationSystems(t, dt, timesteps);
+    }
 
-        dt = computeTimeStepping(prev_dt, t, accepted_steps, rejected_steps);
+    double const time_of_timestep = time_timestep.elapsed();
+    INFO("[time] Time step #%u took %g s.", timesteps, time_of_timestep);
 
-        if (!_last_step_rejected)
-        {
-            const bool output_initial_condition = false;
-            outputSolutions(output_initial_condition, timesteps, t, *_output,
-                            &Output::doOutput);
-        }
+    for (auto& process_data : _per_process_data)
+    {
+        process_data->timestepper->setCostOfLastStep(
+            time_of_timestep,
+            process_data->nonlinear_solver_status.contraction_rate);
+    }
 
-        if (t == _end_time || t + dt > _end_time ||
-            t + std::numeric_limits<double>::epsilon() > _end_time)
-        {
-            break;
-        }
+    _dt = computeTimeStepping(dt, _current_time, _accepted_steps,
+                              _rejected_steps);
+    BaseLib::ConvergenceTelemetry::finishTimestep(!_last_step_rejected,
+                                                  time_of_timestep);
 
-        if (dt < std::numeric_limits<double>::epsilon())
-        {
-            WARN(
-                "Time step size of %g is too small.\n"
-                "Time stepping stops at step %u and at time of %g.",
-                dt, timesteps, t);
-            break;
-        }
+    if (!_last_step_rejected)
+    {
+        const bool output_initial_condition = false;
+        outputSolutions(output_initial_condition, timesteps, _current_time,
+                        *_output, &Output::doOutput);
+        addReducedOrderModelSnapshots(_per_process_data, _process_solutions);
+        writeCheckpointIfRequested(_current_time, _dt, _accepted_steps,
+                                   _rejected_steps);
     }
 
+    BaseLib::Timing::finishTimestep(timesteps);
+
+    if (_current_time == _end_time || _current_time + _dt > _end_time ||
+        _current_time + std::numeric_limits<double>::epsilon() > _end_time)
+    {
+        _time_loop_finished = true;
+    }
+    else if (_dt < std::numeric_limits<double>::epsilon())
+    {
+        WARN(
+            "Time step size of %g is too small.\n"
+            "Time stepping stops at step %u and at time of %g.",
+            _dt, timesteps, _current_time);
+        _time_loop_finished = true;
+    }
+    return !_time_loop_finished;
+}
+
+bool TimeLoop::outputLastTimeStep() const
+{
     INFO(
         "The whole computation of the time stepping took %u steps, in which\n"
         "\t the accepted steps are %u, and the rejected steps are %u.\n",
-        accepted_steps + rejected_steps, accepted_steps, rejected_steps);
+        _accepted_steps + _rejected_steps, _accepted_steps, _rejected_steps);
 
     // output last time step
-    if (nonlinear_solver_status.error_norms_met)
+    if (_nonlinear_solver_status.error_norms_met)
     {
         const bool output_initial_condition = false;
         outputSolutions(output_initial_condition,
-                        accepted_steps + rejected_steps, t, *_output,
-                        &Output::doOutputLastTimestep);
+                        _accepted_steps + _rejected_steps, _current_time,
+                        *_output, &Output::doOutputLastTimestep);
+    }
+
+    for (auto const& process_data : _per_process_data)
+    {
+        if (auto const& rom = process_data->reduced_order_model_snapshots)
+        {
+            INFO("Writing the reduced basis of process %d to '%s'.",
+                 process_data->process_id, rom->basis_file.c_str());
+            NumLib::writeReducedBasis(
+                rom->basis_file,
+                rom->snapshots.computeBasis(rom->energy_fraction));
+        }
+    }
+
+    return _nonlinear_solver_status.error_norms_met;
+}
+
+void TimeLoop::writeCheckpointIfRequested(
+    double const t, double const dt, std::size_t const accepted_steps,
+    std::size_t const rejected_steps) const
+{
+    if (!_checkpoint_config || _checkpoint_config->every_n_timesteps == 0 ||
+        accepted_steps % _checkpoint_config->every_n_timesteps != 0)
+    {
+        return;
     }
 
-    return nonlinear_solver_status.error_norms_met;
+    writeCheckpoint(
+        _checkpoint_config->prefix + "_ts_" + std::to_string(accepted_steps),
+        {t, dt, accepted_steps, rejected_steps}, _per_process_data,
+        _process_solutions, _chemical_system.get());
 }
 
 void preTimestepForAllProcesses(
@@ -594,6 +828,25 @@ void preTimestepForAllProcesses(
     }
 }
 
+/// Replaces the solutions of the processes having a predictor by their
+/// extrapolations to the end of the time step at \c t. Has to be called after
+/// the preTimestep() hooks, which store the solutions at the beginning of the
+/// time step.
+void predictSolutions(
+    double const t,
+    std::vector<std::unique_ptr<ProcessData>> const& per_process_data,
+    std::vector<GlobalVector*> const& process_solutions)
+{
+    for (auto& process_data : per_process_data)
+    {
+        if (process_data->predictor)
+        {
+            process_data->predictor->predict(
+                t, *process_solutions[process_data->process_id]);
+        }
+    }
+}
+
 static NumLib::NonlinearSolverStatus solveMonolithicProcess(
     const double t, const double dt, const std::size_t timestep_id,
     ProcessData const& process_data, std::vector<GlobalVector*>& x,
@@ -611,6 +864,32 @@ static NumLib::NonlinearSolverStatus solveMonolithicProcess(
     return nonlinear_solver_status;
 }
 
+/// Solves the processes of an uncoupled time step each in its own thread and
+/// stores their statuses in the process data. The threads are joined before
+/// returning; an exception of a thread is rethrown in the order of the
+/// processes.
+static void solveMonolithicProcessesConcurrently(
+    const double t, const double dt, const std::size_t timestep_id,
+    std::vector<std::unique_ptr<ProcessData>> const& per_process_data,
+    std::vector<GlobalVector*>& x, Output& output)
+{
+    std::vector<std::future<NumLib::NonlinearSolverStatus>> statuses;
+    statuses.reserve(per_process_data.size());
+    for (auto const& process_data : per_process_data)
+    {
+        statuses.push_back(std::async(
+            std::launch::async, [&, &process_data = *process_data]() {
+                return solveMonolithicProcess(t, dt, timestep_id,
+                                              process_data, x, output);
+            }));
+    }
+
+    for (std::size_t i = 0; i < per_process_data.size(); ++i)
+    {
+        per_process_data[i]->nonlinear_solver_status = statuses[i].get();
+    }
+}
+
 static constexpr std::string_view timestepper_cannot_reduce_dt =
     "Time stepper cannot reduce the time step size further.";
 
@@ -636,7 +915,8 @@ void postTimestepForAllProcesses(
         }
         auto& x = *process_solutions[process_id];
         pcs.postTimestep(process_solutions, t, dt, process_id);
-        pcs.computeSecondaryVariable(t, x, process_id);
+        // The secondary variables are computed on demand, e.g., for output.
+        pcs.setSecondaryVariablesOutdated(t, x, process_id);
     }
 }
 
@@ -644,13 +924,24 @@ NumLib::NonlinearSolverStatus TimeLoop::solveUncoupledEquationSystems(
     const double t, const double dt, const std::size_t timestep_id)
 {
     preTimestepForAllProcesses(t, dt, _per_process_data, _process_solutions);
+    predictSolutions(t, _per_process_data, _process_solutions);
+
+    if (_concurrent_processes)
+    {
+        solveMonolithicProcessesConcurrently(t, dt, timestep_id,
+                                             _per_process_data,
+                                             _process_solutions, *_output);
+    }
 
     NumLib::NonlinearSolverStatus nonlinear_solver_status;
     for (auto& process_data : _per_process_data)
     {
         auto const process_id = process_data->process_id;
-        nonlinear_solver_status = solveMonolithicProcess(
-            t, dt, timestep_id, *process_data, _process_solutions, *_output);
+        nonlinear_solver_status =
+            _concurrent_processes
+                ? process_data->nonlinear_solver_status
+                : solveMonolithicProcess(t, dt, timestep_id, *process_data,
+                                         _process_solutions, *_output);
 
         process_data->nonlinear_solver_status = nonlinear_solver_status;
         if (!nonlinear_solver_status.error_norms_met)
@@ -698,6 +989,27 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
 
     preTimestepForAllProcesses(t, dt, _per_process_data, _process_solutions);
 
+    // The subcycles restart from the solutions at the beginning of the time
+    // step in each coupling iteration.
+    for (std::size_t i = 0; i < _solutions_at_step_begin.size(); i++)
+    {
+        MathLib::LinAlg::copy(*_process_solutions[i],
+                              *_solutions_at_step_begin[i]);
+    }
+    predictSolutions(t, _per_process_data, _process_solutions);
+
+    if (_coupling_acceleration)
+    {
+        _coupling_acceleration->reset();
+        // The accelerated coupling iteration starts from the possibly
+        // predicted solutions.
+        for (std::size_t i = 0; i < _process_solutions.size(); i++)
+        {
+            MathLib::LinAlg::copy(*_process_solutions[i],
+                                  *_solutions_of_last_cpl_iteration[i]);
+        }
+    }
+
     NumLib::NonlinearSolverStatus nonlinear_solver_status{false, -1};
     bool coupling_iteration_converged = true;
     for (int global_coupling_iteration = 0;
@@ -720,8 +1032,11 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
                 &coupled_solutions);
 
             nonlinear_solver_status =
-                solveOneTimeStepOneProcess(_process_solutions, timestep_id, t,
-                                           dt, *process_data, *_output);
+                process_data->number_of_subcycles > 1
+                    ? solveSubcycledProcess(t, dt, timestep_id, *process_data)
+                    : solveOneTimeStepOneProcess(_process_solutions,
+                                                 timestep_id, t, dt,
+                                                 *process_data, *_output);
             process_data->nonlinear_solver_status = nonlinear_solver_status;
 
             INFO(
@@ -745,27 +1060,61 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
                 }
                 break;
             }
+        }  // end of for (auto& process_data : _per_process_data)
+
+        if (nonlinear_solver_status.error_norms_met)
+        {
+            if (_coupling_acceleration)
+            {
+                _coupling_acceleration->computeResiduals(
+                    _solutions_of_last_cpl_iteration, _process_solutions);
+            }
 
             // Check the convergence of the coupling iteration
-            auto& x = *_process_solutions[process_id];
-            auto& x_old = *_solutions_of_last_cpl_iteration[process_id];
+            auto& x = *_process_solutions[last_process_id];
+            auto& x_old = *_solutions_of_last_cpl_iteration[last_process_id];
             if (global_coupling_iteration > 0)
             {
-                MathLib::LinAlg::axpy(x_old, -1.0, x);  // save dx to x_old
-                if (process_id == last_process_id)
+                INFO(
+                    "------- Checking convergence criterion for coupled "
+                    "solution  -------");
+                if (_coupling_acceleration)
+                {
+                    _global_coupling_conv_crit[last_process_id]->checkDeltaX(
+                        _coupling_acceleration->getMinusResidual(
+                            last_process_id),
+                        x);
+                }
+                else
                 {
-                    INFO(
-                        "------- Checking convergence criterion for coupled "
-                        "solution  -------");
-                    _global_coupling_conv_crit[process_id]->checkDeltaX(x_old,
-                                                                        x);
-                    coupling_iteration_converged =
-                        coupling_iteration_converged &&
-                        _global_coupling_conv_crit[process_id]->isSatisfied();
+                    MathLib::LinAlg::axpy(x_old, -1.0, x);  // save dx to x_old
+                    _global_coupling_conv_crit[last_process_id]->checkDeltaX(
+                        x_old, x);
                 }
+                coupling_iteration_converged =
+                    _global_coupling_conv_crit[last_process_id]->isSatisfied();
             }
-            MathLib::LinAlg::copy(x, x_old);
-        }  // end of for (auto& process_data : _per_process_data)
+
+            bool const is_last_iteration =
+                (coupling_iteration_converged &&
+                 global_coupling_iteration > 0) ||
+                global_coupling_iteration + 1 >= _global_coupling_max_iterations;
+            if (_coupling_acceleration && !is_last_iteration)
+            {
+                // Overwrites the solutions and the solutions of the last
+                // coupling iteration by the next iterate.
+                _coupling_acceleration->accelerate(
+                    _solutions_of_last_cpl_iteration, _process_solutions);
+            }
+            else
+            {
+                for (std::size_t i = 0; i < _process_solutions.size(); i++)
+                {
+                    MathLib::LinAlg::copy(*_process_solutions[i],
+                                          *_solutions_of_last_cpl_iteration[i]);
+                }
+            }
+        }
 
         if (coupling_iteration_converged && global_coupling_iteration > 0)
         {
@@ -804,6 +1153,88 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
     return nonlinear_solver_status;
 }
 
+NumLib::NonlinearSolverStatus TimeLoop::solveSubcycledProcess(
+    const double t, const double dt, const std::size_t timestep_id,
+    ProcessData const& process_data)
+{
+    auto const process_id = process_data.process_id;
+    auto& pcs = process_data.process;
+    auto& time_disc = *process_data.time_disc;
+    auto const number_of_subcycles = process_data.number_of_subcycles;
+    double const t_begin = t - dt;
+    double const sub_dt = dt / number_of_subcycles;
+
+    auto& x = *_process_solutions[process_id];
+    MathLib::LinAlg::copy(*_solutions_at_step_begin[process_id], x);
+    time_disc.setInitialState(t_begin, x);
+
+    // The solutions of the other processes are linearly interpolated between
+    // the beginning and the current end of the time step, while this process
+    // uses its own solution.
+    std::vector<GlobalVector*> substep_solutions = _interpolated_solutions;
+    substep_solutions[process_id] = &x;
+    auto interpolate = [&](double const theta) {
+        for (std::size_t i = 0; i < substep_solutions.size(); i++)
+        {
+            if (static_cast<int>(i) == process_id)
+            {
+                continue;
+            }
+            auto& y = *substep_solutions[i];
+            MathLib::LinAlg::copy(*_process_solutions[i], y);
+            MathLib::LinAlg::axpby(y, 1 - theta, theta,
+                                   *_solutions_at_step_begin[i]);
+        }
+    };
+
+    CoupledSolutionsForStaggeredScheme coupled_solutions(substep_solutions);
+    pcs.setCoupledSolutionsForStaggeredScheme(&coupled_solutions);
+
+    NumLib::NonlinearSolverStatus nonlinear_solver_status{true, 0};
+    for (int k = 1; k <= number_of_subcycles; k++)
+    {
+        double const t_k = t_begin + k * sub_dt;
+        DBUG("Subcycle %d of %d of process #%d from t = %g to t = %g.", k,
+             number_of_subcycles, process_id, t_k - sub_dt, t_k);
+
+        // The states of all processes at the beginning of the substep.
+        interpolate(static_cast<double>(k - 1) / number_of_subcycles);
+        preTimestepForAllProcesses(t_k - sub_dt, sub_dt, _per_process_data,
+                                   substep_solutions);
+
+        interpolate(static_cast<double>(k) / number_of_subcycles);
+        auto const substep_status = solveOneTimeStepOneProcess(
+            substep_solutions, timestep_id, t_k, sub_dt, process_data,
+            *_output);
+
+        nonlinear_solver_status.error_norms_met =
+            substep_status.error_norms_met;
+        nonlinear_solver_status.number_iterations +=
+            substep_status.number_iterations;
+        nonlinear_solver_status.contraction_rate =
+            std::max(nonlinear_solver_status.contraction_rate,
+                     substep_status.contraction_rate);
+        if (!substep_status.error_norms_met)
+        {
+            break;
+        }
+
+        if (k < number_of_subcycles)
+        {
+            time_disc.setInitialState(t_k, x);
+        }
+    }
+
+    // Restore the states of the beginning of the whole time step for the
+    // other processes and the time stepping.
+    time_disc.setInitialState(t_begin, *_solutions_at_step_begin[process_id]);
+    time_disc.nextTimestep(t, dt);
+    preTimestepForAllProcesses(t, dt, _per_process_data,
+                               _solutions_at_step_begin);
+
+    return nonlinear_solver_status;
+}
+
 template <typename OutputClass, typename OutputClassMember>
 void TimeLoop::outputSolutions(bool const output_initial_condition,
                                unsigned timestep, const double t,
@@ -847,6 +1278,8 @@ void TimeLoop::outputSolutions(bool const output_initial_condition,
                 .setCoupledTermForTheStaggeredSchemeToLocalAssemblers(
                     process_id);
         }
+        static auto& region = BaseLib::Timing::getRegion("output", true);
+        BaseLib::Timing::ScopedTimer const timer{region};
         (output_object.*output_class_member)(pcs, process_id, timestep, t,
                                              _process_solutions);
     }
@@ -863,6 +1296,16 @@ TimeLoop::~TimeLoop()
     {
         NumLib::GlobalVectorProvider::provider.releaseVector(*x);
     }
+
+    for (auto* x : _solutions_at_step_begin)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*x);
+    }
+
+    for (auto* x : _interpolated_solutions)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*x);
+    }
 }
 
 }  // namespace ProcessLib
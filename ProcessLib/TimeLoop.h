@@ -12,6 +12,7 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include <logog/include/logog.hpp>
 
@@ -19,6 +20,8 @@
 #include "NumLib/TimeStepping/Algorithms/TimeStepAlgorithm.h"
 #include "ProcessLib/Output/Output.h"
 
+#include "Checkpoint.h"
+#include "CouplingAcceleration.h"
 #include "Process.h"
 
 namespace NumLib
@@ -44,13 +47,39 @@ public:
              const int global_coupling_max_iterations,
              std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
                  global_coupling_conv_crit,
+             std::unique_ptr<CouplingAcceleration>&& coupling_acceleration,
              std::unique_ptr<ChemistryLib::ChemicalSolverInterface>&&
                  chemical_system,
-             const double start_time, const double end_time);
+             std::unique_ptr<CheckpointConfig>&& checkpoint_config,
+             bool const concurrent_processes, const double start_time,
+             const double end_time);
 
     void initialize();
+
+    /// Executes all time steps and writes the output of the last one.
+    /// \return true if the nonlinear solvers converged in the last time step.
     bool loop();
 
+    /// Executes a single time step and computes the size of the next one.
+    /// This allows to drive the simulation step by step, e.g. from Python.
+    /// \return false if the time loop has finished, i.e. the end time is
+    /// reached or the time step size became too small.
+    bool executeTimeStep();
+
+    /// Writes the output of the last time step if it has converged.
+    /// \return true if the nonlinear solvers converged in the last time step.
+    bool outputLastTimeStep() const;
+
+    double currentTime() const { return _current_time; }
+    double endTime() const { return _end_time; }
+
+    /// The solutions of the processes at the current time in the order of
+    /// the process ids.
+    std::vector<GlobalVector*> const& getSolutions() const
+    {
+        return _process_solutions;
+    }
+
     ~TimeLoop();
 
 private:
@@ -89,6 +118,26 @@ private:
     NumLib::NonlinearSolverStatus solveCoupledEquationSystemsByStaggeredScheme(
         const double t, const double dt, const std::size_t timestep_id);
 
+    /**
+     * \brief Solves the equations of a process of the staggered scheme in
+     *        ProcessData::number_of_subcycles equally sized substeps.
+     *
+     * Each substep starts from the solution of the previous one, beginning
+     * with the solution at the start of the time step. The solutions of the
+     * other processes are linearly interpolated in time between the
+     * beginning of the time step and their current solutions.
+     *
+     * @param t            Time at the end of the time step
+     * @param dt           Time step size
+     * @param timestep_id  Index of the time step
+     * @param process_data Data of the subcycled process
+     * @return             The status of the last substep with the summed
+     *                     number of iterations of all substeps.
+     */
+    NumLib::NonlinearSolverStatus solveSubcycledProcess(
+        const double t, const double dt, const std::size_t timestep_id,
+        ProcessData const& process_data);
+
     /**
      *  Find the minimum time step size among the predicted step sizes of
      *  processes and step it as common time step size.
@@ -104,6 +153,11 @@ private:
                                std::size_t& accepted_steps,
                                std::size_t& rejected_steps);
 
+    /// Writes a checkpoint if one is requested for the given accepted step.
+    void writeCheckpointIfRequested(double const t, double const dt,
+                                    std::size_t const accepted_steps,
+                                    std::size_t const rejected_steps) const;
+
     template <typename OutputClass, typename OutputClassMember>
     void outputSolutions(bool const output_initial_condition, unsigned timestep,
                          const double t, OutputClass& output_object,
@@ -119,16 +173,39 @@ private:
     const double _start_time;
     const double _end_time;
 
+    /// State of the time stepping.
+    double _current_time = 0;
+    double _dt = 0;
+    std::size_t _accepted_steps = 0;
+    std::size_t _rejected_steps = 0;
+    bool _non_equilibrium_initial_residuum_computed = false;
+    bool _time_loop_finished = false;
+    NumLib::NonlinearSolverStatus _nonlinear_solver_status;
+
     /// Maximum iterations of the global coupling.
     const int _global_coupling_max_iterations;
     /// Convergence criteria of processes for the global coupling iterations.
     std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>
         _global_coupling_conv_crit;
+    /// Acceleration of the global coupling iterations; none if not set.
+    std::unique_ptr<CouplingAcceleration> _coupling_acceleration;
 
     std::unique_ptr<ChemistryLib::ChemicalSolverInterface> _chemical_system;
 
+    std::unique_ptr<CheckpointConfig> _checkpoint_config;
+    /// Solve the uncoupled processes of a time step each in its own thread.
+    bool _concurrent_processes;
+    /// Time loop state read from a checkpoint if the simulation is restarted.
+    std::optional<CheckpointTimeState> _restart_state;
+
     /// Solutions of the previous coupling iteration for the convergence
     /// criteria of the coupling iteration.
     std::vector<GlobalVector*> _solutions_of_last_cpl_iteration;
+
+    /// Solutions at the beginning of the time step and the interpolated
+    /// solutions of the other processes during the subcycles of a process.
+    /// Both are only allocated if a process is subcycled.
+    std::vector<GlobalVector*> _solutions_at_step_begin;
+    std::vector<GlobalVector*> _interpolated_solutions;
 };
 }  // namespace ProcessLib
@@ -123,30 +123,29 @@ void TwoPhaseFlowWithPPLocalAssembler<
         variables[static_cast<int>(MPL::Variable::temperature)] =
             _process_data.temperature(t, pos)[0];
 
-        auto const rho_nonwet =
+        auto const density_nonwet =
             gas_phase.property(MPL::PropertyType::density)
-                .template value<double>(variables, pos, t, dt);
+                .valueAndDerivatives(
+                    variables, std::array{MPL::Variable::phase_pressure}, pos,
+                    t, dt);
+        auto const rho_nonwet = density_nonwet.value;
+        auto const drhononwet_dpn = density_nonwet.derivatives[0];
 
         auto const rho_wet = liquid_phase.property(MPL::PropertyType::density)
                                  .template value<double>(variables, pos, t, dt);
-        auto& Sw = _saturation[ip];
-        Sw = medium.property(MPL::PropertyType::saturation)
-                 .template value<double>(variables, pos, t, dt);
-
-        auto const dSw_dpc =
+        auto const saturation =
             medium.property(MPL::PropertyType::saturation)
-                .template dValue<double>(
-                    variables, MPL::Variable::capillary_pressure, pos, t, dt);
+                .valueAndDerivatives(
+                    variables, std::array{MPL::Variable::capillary_pressure},
+                    pos, t, dt);
+        auto& Sw = _saturation[ip];
+        Sw = saturation.value;
+        auto const dSw_dpc = saturation.derivatives[0];
 
         auto const porosity =
             medium.property(MPL::PropertyType::porosity)
                 .template value<double>(variables, pos, t, dt);
 
-        auto const drhononwet_dpn =
-            gas_phase.property(MPL::PropertyType::density)
-                .template dValue<double>(
-                    variables, MPL::Variable::phase_pressure, pos, t, dt);
-
         auto const k_rel =
             medium.property(MPL::PropertyType::relative_permeability)
                 .template value<Eigen::Vector2d>(variables, pos, t, dt);
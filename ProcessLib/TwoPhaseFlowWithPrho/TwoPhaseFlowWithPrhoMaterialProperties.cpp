@@ -178,47 +178,62 @@ bool TwoPhaseFlowWithPrhoMaterialProperties::computeConstitutiveRelation(
     double& dxm_dpg,
     double& dxm_dX)
 {
-    {  // Local Newton solver
-        using LocalJacobianMatrix =
-            Eigen::Matrix<double, 2, 2, Eigen::RowMajor>;
-        using LocalResidualVector = Eigen::Matrix<double, 2, 1>;
-        using LocalUnknownVector = Eigen::Matrix<double, 2, 1>;
-        LocalJacobianMatrix J_loc;
+    // TODO Make the following choice of maximum iterations and convergence
+    // criteria available from the input file configuration. See Ehlers
+    // material model implementation for the example.
+    const int maximum_iterations(20);
+    const double tolerance(1.e-14);
 
-        Eigen::PartialPivLU<LocalJacobianMatrix> linear_solver(2);
-        auto const update_residual = [&](LocalResidualVector& residual) {
-            calculateResidual(material_id, pg, X, T, Sw, X_m, residual);
+    // Sw and X_m hold the solution of the previous assembly at this
+    // integration point. If it still fulfills the equations, e.g., for
+    // unchanged or only slightly changed primary variables, the local Newton
+    // iterations are skipped.
+    ResidualVector residual;
+    calculateResidual(material_id, pg, X, T, Sw, X_m, residual);
+    if (residual.squaredNorm() >= tolerance * tolerance)
+    {
+        Cramer2x2Solver linear_solver;
+        JacobianMatrix J_loc;
+        auto const update_residual = [&](ResidualVector& res) {
+            calculateResidual(material_id, pg, X, T, Sw, X_m, res);
         };
 
-        auto const update_jacobian = [&](LocalJacobianMatrix& jacobian) {
+        auto const update_jacobian = [&](JacobianMatrix& jacobian) {
             calculateJacobian(material_id, t, x, pg, X, T, jacobian, Sw,
                               X_m);  // for solution dependent Jacobians
         };
 
-        auto const update_solution = [&](LocalUnknownVector const& increment) {
+        auto const update_solution = [&](UnknownVector const& increment) {
             // increment solution vectors
             Sw += increment[0];
             X_m += increment[1];
         };
 
-        // TODO Make the following choice of maximum iterations and convergence
-        // criteria available from the input file configuration. See Ehlers
-        // material model implementation for the example.
-        const int maximum_iterations(20);
-        const double tolerance(1.e-14);
-
         auto newton_solver = NumLib::NewtonRaphson<
-            decltype(linear_solver), LocalJacobianMatrix,
-            decltype(update_jacobian), LocalResidualVector,
-            decltype(update_residual), decltype(update_solution)>(
-            linear_solver, update_jacobian, update_residual, update_solution,
-            {maximum_iterations, tolerance});
-
-        auto const success_iterations = newton_solver.solve(J_loc);
+            decltype(linear_solver), JacobianMatrix, decltype(update_jacobian),
+            ResidualVector, decltype(update_residual),
+            decltype(update_solution)>(linear_solver, update_jacobian,
+                                       update_residual, update_solution,
+                                       {maximum_iterations, tolerance});
 
-        if (!success_iterations)
+        double const Sw_previous = Sw;
+        double const X_m_previous = X_m;
+        if (!newton_solver.solve(J_loc))
         {
-            return false;
+            // The previous solution might be in the other branch of the
+            // complementarity conditions; retry from the fully saturated
+            // state without dissolved gas, which is the initial state of the
+            // integration points.
+            DBUG(
+                "Local Newton method failed from Sw = %g, X_m = %g; "
+                "restarting from the initial state.",
+                Sw_previous, X_m_previous);
+            Sw = 1.0;
+            X_m = 0.0;
+            if (!newton_solver.solve(J_loc))
+            {
+                return false;
+            }
         }
     }
     dsw_dpg = calculatedSwdP(pg, Sw, X_m, T, material_id);
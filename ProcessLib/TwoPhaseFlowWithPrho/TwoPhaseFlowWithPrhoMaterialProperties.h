@@ -135,6 +135,34 @@ private:
                       Eigen::RowMajor>;
     using UnknownVector = Eigen::Matrix<double, jacobian_residual_size, 1>;
 
+    /// Solves the 2x2 systems of the local Newton iterations by Cramer's rule,
+    /// which is cheaper than setting up a pivoted LU decomposition for each
+    /// iteration.
+    class Cramer2x2Solver
+    {
+    public:
+        Cramer2x2Solver& compute(JacobianMatrix const& J)
+        {
+            _J = J;
+            _inverse_determinant = 1 / (J(0, 0) * J(1, 1) - J(0, 1) * J(1, 0));
+            return *this;
+        }
+
+        template <typename Rhs>
+        UnknownVector solve(Rhs const& b) const
+        {
+            UnknownVector const rhs = b;
+            return UnknownVector{
+                (_J(1, 1) * rhs[0] - _J(0, 1) * rhs[1]) * _inverse_determinant,
+                (_J(0, 0) * rhs[1] - _J(1, 0) * rhs[0]) *
+                    _inverse_determinant};
+        }
+
+    private:
+        JacobianMatrix _J;
+        double _inverse_determinant = 0;
+    };
+
 private:
     /**
     * Calculates the residual vector.
@@ -15,6 +15,7 @@
 
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 
+#include "CreateLocalAssemblersInParallel.h"
 #include "LocalDataInitializer.h"
 
 
@@ -46,7 +47,7 @@ void createLocalAssemblers(
     LocalDataInitializer initializer(dof_table, shapefunction_order);
 
     DBUG("Calling local assembler builder for all mesh elements.");
-    GlobalExecutor::transformDereferenced(
+    createLocalAssemblersInParallel(
         initializer, mesh_elements, local_assemblers,
         std::forward<ExtraCtorArgs>(extra_ctor_args)...);
 }
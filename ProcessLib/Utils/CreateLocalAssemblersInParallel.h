@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/MonotonicArena.h"
+#include "MeshLib/Elements/Element.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
+
+namespace ProcessLib
+{
+/// Creates the local assemblers of all given mesh elements concurrently by
+/// calling \c initializer(i, *mesh_elements[i], local_assemblers[i], args...)
+/// for each element \c i.
+///
+/// The i-th local assembler always belongs to the i-th element, independent of
+/// the number of threads. If the caller is within a
+/// BaseLib::MonotonicArenaScope, each worker thread opens its own scope of the
+/// same arena.
+///
+/// \attention The constructors of the local assemblers, including the
+/// creation of their material states and shape matrices, are run concurrently
+/// and must not modify shared data.
+template <typename LocalDataInitializer, typename LocalAssemblerPtr,
+          typename... Args>
+void createLocalAssemblersInParallel(
+    LocalDataInitializer const& initializer,
+    std::vector<MeshLib::Element*> const& mesh_elements,
+    std::vector<LocalAssemblerPtr>& local_assemblers, Args&&... args)
+{
+    assert(mesh_elements.size() == local_assemblers.size());
+
+    auto const n_elements = mesh_elements.size();
+    // Progress is only reported for meshes whose setup takes noticeable time.
+    std::size_t const min_elements_for_progress = 100000;
+    auto const progress_step = std::max<std::size_t>(n_elements / 10, 1);
+    std::atomic<std::size_t> n_created{0};
+
+    auto* const arena_scope = BaseLib::MonotonicArenaScope::current();
+
+    NumLib::detail::parallelForWithContext(
+        n_elements,
+        [arena_scope] {
+            return arena_scope == nullptr
+                       ? std::optional<BaseLib::MonotonicArenaScope>{}
+                       : std::optional<BaseLib::MonotonicArenaScope>{
+                             std::in_place, arena_scope->arena()};
+        },
+        [&](std::optional<BaseLib::MonotonicArenaScope> const& /*scope*/,
+            std::size_t const i) {
+            initializer(i, *mesh_elements[i], local_assemblers[i],
+                        std::forward<Args>(args)...);
+
+            auto const created = ++n_created;
+            if (n_elements >= min_elements_for_progress &&
+                created % progress_step == 0)
+            {
+                INFO("Created %d of %d local assemblers.", created,
+                     n_elements);
+            }
+        });
+}
+}  // namespace ProcessLib
@@ -13,12 +13,25 @@
 
 #include "MeshLib/Elements/Element.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
+#include "NumLib/Fem/ShapeFunction/HasConstantJacobian.h"
 
 
 namespace ProcessLib
 {
+/// Computes the shape matrices at all integration points of the element.
+///
+/// The computation can be restricted to the members of the shape matrices
+/// given by \c SelectedShapeMatrixType, e.g. NumLib::ShapeMatrixType::N_J for
+/// local assemblers using only N and detJ.
+///
+/// For shape functions with a constant Jacobian (see
+/// NumLib::HasConstantJacobian) the mapping matrices are computed only at the
+/// first integration point and copied to the others; only N and the integral
+/// measure are evaluated per integration point.
 template <typename ShapeFunction, typename ShapeMatricesType,
-          typename IntegrationMethod, unsigned GlobalDim>
+          typename IntegrationMethod, unsigned GlobalDim,
+          NumLib::ShapeMatrixType SelectedShapeMatrixType =
+              NumLib::ShapeMatrixType::ALL>
 std::vector<typename ShapeMatricesType::ShapeMatrices,
             Eigen::aligned_allocator<typename ShapeMatricesType::ShapeMatrices>>
 initShapeMatrices(MeshLib::Element const& e, bool is_axially_symmetric,
@@ -37,11 +50,23 @@ initShapeMatrices(MeshLib::Element const& e, bool is_axially_symmetric,
 
     shape_matrices.reserve(n_integration_points);
     for (unsigned ip = 0; ip < n_integration_points; ++ip) {
+        auto const wp = integration_method.getWeightedPoint(ip);
+        auto const* const natural_pt = wp.getCoords();
+        if constexpr (NumLib::hasConstantJacobian<ShapeFunction>)
+        {
+            if (ip > 0)
+            {
+                shape_matrices.push_back(shape_matrices.front());
+                fe.template computeShapeFunctions<NumLib::ShapeMatrixType::N>(
+                    natural_pt, shape_matrices[ip], GlobalDim,
+                    is_axially_symmetric);
+                continue;
+            }
+        }
         shape_matrices.emplace_back(ShapeFunction::DIM, GlobalDim,
                                      ShapeFunction::NPOINTS);
-        fe.computeShapeFunctions(
-                integration_method.getWeightedPoint(ip).getCoords(),
-                shape_matrices[ip], GlobalDim, is_axially_symmetric);
+        fe.template computeShapeFunctions<SelectedShapeMatrixType>(
+            natural_pt, shape_matrices[ip], GlobalDim, is_axially_symmetric);
     }
 
     return shape_matrices;
@@ -0,0 +1,60 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TimeScaledRhs.h"
+
+#include <logog/include/logog.hpp>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/DOF/GlobalMatrixProviders.h"
+
+namespace ProcessLib
+{
+GlobalVector& TimeScaledRhs::getTemporaryVector(GlobalVector const& b)
+{
+    auto& tmp = NumLib::GlobalVectorProvider::provider.getVector(b);
+    tmp.setZero();
+    return tmp;
+}
+
+void TimeScaledRhs::store(GlobalVector& contribution, double const factor)
+{
+    MathLib::LinAlg::finalizeAssembly(contribution);
+    MathLib::LinAlg::setLocalAccessibleVector(contribution);
+
+    _ids.clear();
+    _values.clear();
+    for (auto i = contribution.getRangeBegin(); i < contribution.getRangeEnd();
+         ++i)
+    {
+        auto const value = contribution.get(i);
+        if (value != 0)
+        {
+            _ids.push_back(i);
+            _values.push_back(value / factor);
+        }
+    }
+    _is_assembled = true;
+
+    DBUG("Stored %d entries of a time-scaled right-hand side.", _ids.size());
+    NumLib::GlobalVectorProvider::provider.releaseVector(contribution);
+}
+
+void TimeScaledRhs::addScaled(double const factor, GlobalVector& b) const
+{
+    _scaled_values.resize(_values.size());
+    for (std::size_t i = 0; i < _values.size(); ++i)
+    {
+        _scaled_values[i] = factor * _values[i];
+    }
+    b.add(_ids, _scaled_values);
+}
+
+}  // namespace ProcessLib
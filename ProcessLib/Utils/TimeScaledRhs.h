@@ -0,0 +1,67 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
+
+namespace ProcessLib
+{
+/// Contribution \f$ f(t) \cdot r \f$ of a boundary condition or source term to
+/// the global right-hand side, where \f$ r \f$ is independent of time.
+///
+/// The vector \f$ r \f$ is assembled once and stored sparsely. Afterwards each
+/// assembly only adds the scaled entries instead of integrating over the
+/// elements again.
+class TimeScaledRhs final
+{
+public:
+    /// Adds \f$ f(t) \cdot r \f$ to \c b, where \c factor is \f$ f(t) \f$.
+    ///
+    /// As long as \f$ r \f$ is unknown, \c assemble(tmp) is called to add
+    /// \f$ f(t) \cdot r \f$ to the zero vector \c tmp. Then \f$ r \f$ is
+    /// obtained by the division by the factor. A zero factor doesn't require
+    /// any assembly.
+    template <typename Assemble>
+    void add(double const factor, GlobalVector& b, Assemble&& assemble)
+    {
+        if (!_is_assembled)
+        {
+            if (factor == 0)
+            {
+                return;
+            }
+            auto& tmp = getTemporaryVector(b);
+            assemble(tmp);
+            store(tmp, factor);
+        }
+        addScaled(factor, b);
+    }
+
+private:
+    /// Returns a zero vector with the layout of \c b.
+    static GlobalVector& getTemporaryVector(GlobalVector const& b);
+
+    /// Stores the nonzero entries of \c contribution divided by \c factor and
+    /// releases the temporary vector.
+    void store(GlobalVector& contribution, double const factor);
+
+    void addScaled(double const factor, GlobalVector& b) const;
+
+    bool _is_assembled = false;
+    std::vector<GlobalIndexType> _ids;
+    std::vector<double> _values;
+    /// Buffer for the scaled values.
+    mutable std::vector<double> _scaled_values;
+};
+
+}  // namespace ProcessLib
@@ -10,9 +10,14 @@
 
 #include "VectorMatrixAssembler.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <functional>  // for std::reference_wrapper.
+#include <limits>
 
+#include "BaseLib/Timing.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "LocalAssemblerInterface.h"
@@ -20,12 +25,520 @@
 #include "CoupledSolutionsForStaggeredScheme.h"
 #include "Process.h"
 
+namespace
+{
+//! Copies the entries of \c x at the given \c indices to \c local_x reusing
+//! its memory.
+void getLocalValues(GlobalVector const& x,
+                    std::vector<GlobalIndexType> const& indices,
+                    std::vector<double>& local_x)
+{
+    local_x.resize(indices.size());
+    for (std::size_t i = 0; i < indices.size(); i++)
+    {
+        local_x[i] = x.get(indices[i]);
+    }
+}
+
+//! Subtracts \f$ M_e \cdot \dot x_e + K_e \cdot x_e \f$ from the local \c b,
+//! which becomes the negative local residual, and clears the local \c M and
+//! \c K.
+void moveMassAndStiffnessToRhs(std::vector<double> const& local_x,
+                               std::vector<double> const& local_xdot,
+                               std::vector<double>& local_M_data,
+                               std::vector<double>& local_K_data,
+                               std::vector<double>& local_b_data)
+{
+    auto const n = static_cast<Eigen::MatrixXd::Index>(local_x.size());
+    if (local_b_data.empty())
+    {
+        local_b_data.resize(local_x.size(), 0.0);
+    }
+    auto b = MathLib::toVector(local_b_data);
+
+    if (!local_M_data.empty())
+    {
+        b.noalias() -= MathLib::toMatrix(local_M_data, n, n) *
+                       MathLib::toVector(local_xdot);
+        local_M_data.clear();
+    }
+    if (!local_K_data.empty())
+    {
+        b.noalias() -= MathLib::toMatrix(local_K_data, n, n) *
+                       MathLib::toVector(local_x);
+        local_K_data.clear();
+    }
+}
+
+//! Replaces the local \c M by the diagonal matrix of its row sums, subtracts
+//! \f$ K_e \cdot x_e \f$ from the local \c b, and clears the local \c K.
+//! Returns \f$ \max_i \sum_j |K_{e,ij}| / m_i \f$, which bounds the largest
+//! eigenvalue of \f$ M_L^{-1} K_e \f$ for the lumped masses \f$ m_i \f$.
+double lumpMassAndMoveStiffnessToRhs(std::vector<double> const& local_x,
+                                     std::vector<double>& local_M_data,
+                                     std::vector<double>& local_K_data,
+                                     std::vector<double>& local_b_data)
+{
+    auto const n = static_cast<Eigen::MatrixXd::Index>(local_x.size());
+    if (local_b_data.empty())
+    {
+        local_b_data.resize(local_x.size(), 0.0);
+    }
+    if (local_M_data.empty())
+    {
+        local_M_data.resize(local_x.size() * local_x.size(), 0.0);
+    }
+    auto M = MathLib::toMatrix(local_M_data, n, n);
+    for (Eigen::MatrixXd::Index i = 0; i < n; ++i)
+    {
+        double const row_sum = M.row(i).sum();
+        M.row(i).setZero();
+        M(i, i) = row_sum;
+    }
+
+    double stiffness_to_mass_ratio = 0;
+    if (!local_K_data.empty())
+    {
+        auto const K = MathLib::toMatrix(local_K_data, n, n);
+        for (Eigen::MatrixXd::Index i = 0; i < n; ++i)
+        {
+            if (M(i, i) > 0)
+            {
+                stiffness_to_mass_ratio =
+                    std::max(stiffness_to_mass_ratio,
+                             K.row(i).cwiseAbs().sum() / M(i, i));
+            }
+        }
+        MathLib::toVector(local_b_data).noalias() -=
+            K * MathLib::toVector(local_x);
+        local_K_data.clear();
+    }
+    return stiffness_to_mass_ratio;
+}
+
+//! Returns the maximum norm of the difference of \c a and \c b, or infinity
+//! if their sizes differ.
+double maxNormOfDifference(std::vector<double> const& a,
+                           std::vector<double> const& b)
+{
+    if (a.size() != b.size())
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    double result = 0;
+    for (std::size_t i = 0; i < a.size(); i++)
+    {
+        result = std::max(result, std::abs(a[i] - b[i]));
+    }
+    return result;
+}
+
+BaseLib::Timing::Region& localAssemblyRegion()
+{
+    static auto& region =
+        BaseLib::Timing::getRegion("assembly/local_assembly");
+    return region;
+}
+
+/// Adds the time from its construction to its destruction to the entry of the
+/// mesh item in \c times, if given.
+class ElementTimer final
+{
+public:
+    ElementTimer(std::vector<double>* const times,
+                 std::size_t const mesh_item_id)
+        : _times(times), _mesh_item_id(mesh_item_id)
+    {
+        if (_times != nullptr)
+        {
+            _begin = BaseLib::Timing::Clock::now();
+        }
+    }
+
+    ~ElementTimer()
+    {
+        if (_times != nullptr)
+        {
+            (*_times)[_mesh_item_id] +=
+                std::chrono::duration<double>(BaseLib::Timing::Clock::now() -
+                                              _begin)
+                    .count();
+        }
+    }
+
+    ElementTimer(ElementTimer const&) = delete;
+    ElementTimer& operator=(ElementTimer const&) = delete;
+
+private:
+    std::vector<double>* const _times;
+    std::size_t const _mesh_item_id;
+    BaseLib::Timing::Clock::time_point _begin;
+};
+}  // namespace
+
 namespace ProcessLib
 {
 VectorMatrixAssembler::VectorMatrixAssembler(
     std::unique_ptr<AbstractJacobianAssembler>&& jacobian_assembler)
-    : _jacobian_assembler(std::move(jacobian_assembler))
 {
+    _thread_local_data.emplace_back(std::move(jacobian_assembler));
+}
+
+void VectorMatrixAssembler::enableParallelAssembly(
+    bool const conflict_free_additions)
+{
+#ifdef USE_PETSC
+    // Setting values of PETSc matrices and vectors is not thread-safe.
+    (void)conflict_free_additions;
+    _serialize_additions = true;
+#else
+    _serialize_additions = !conflict_free_additions;
+#endif
+
+    auto const number_of_threads =
+        static_cast<std::size_t>(NumLib::getMaxNumberOfThreads());
+    while (_thread_local_data.size() < number_of_threads)
+    {
+        _thread_local_data.emplace_back(
+            _thread_local_data.front().jacobian_assembler->copy());
+    }
+}
+
+VectorMatrixAssembler::ThreadLocalData&
+VectorMatrixAssembler::getThreadLocalData()
+{
+    auto const thread_number =
+        static_cast<std::size_t>(NumLib::getThreadNumber());
+    if (thread_number >= _thread_local_data.size())
+    {
+        OGS_FATAL(
+            "The global assembly is executed by thread %d, but data has been "
+            "provided for %d threads only. Either the parallel assembly has "
+            "not been enabled or the number of threads has changed.",
+            static_cast<int>(thread_number),
+            static_cast<int>(_thread_local_data.size()));
+    }
+    return _thread_local_data[thread_number];
+}
+
+void VectorMatrixAssembler::enableIncrementalAssembly(double const tolerance,
+                                                      int const max_reuses)
+{
+    _use_incremental_assembly = true;
+    _incremental_assembly_tolerance = tolerance;
+    _incremental_assembly_max_reuses = max_reuses;
+}
+
+void VectorMatrixAssembler::enableScatterMaps()
+{
+#ifndef USE_PETSC
+    _use_scatter_maps = true;
+#endif
+}
+
+void VectorMatrixAssembler::prepareAssembly(
+    int const process_id, std::size_t const number_of_elements,
+    GlobalMatrix const& M, GlobalMatrix const& K,
+    GlobalMatrix const* const Jac)
+{
+    if (_use_incremental_assembly)
+    {
+        if (_cached_contributions.size() <=
+            static_cast<std::size_t>(process_id))
+        {
+            _cached_contributions.resize(process_id + 1);
+        }
+        _cached_contributions[process_id].resize(number_of_elements);
+    }
+
+#ifdef USE_PETSC
+    (void)process_id;
+    (void)number_of_elements;
+    (void)M;
+    (void)K;
+    (void)Jac;
+#else
+    _current_scatter_map = nullptr;
+    _scatter_M = false;
+    _scatter_K = false;
+    _scatter_Jac = false;
+    // With elementwise residuals or lumped mass matrices only the Jacobian
+    // receives local matrices.
+    if (!_use_scatter_maps ||
+        ((_elementwise_residual || _lumped_mass) && Jac == nullptr))
+    {
+        return;
+    }
+
+    if (_scatter_maps.size() <= static_cast<std::size_t>(process_id))
+    {
+        _scatter_maps.resize(process_id + 1);
+    }
+    auto& map = _scatter_maps[process_id];
+
+    // The Jacobian is the matrix with most entries in Newton's method,
+    // otherwise M and K have the same structure typically.
+    auto const& reference = Jac != nullptr ? *Jac : K;
+    if (!map.isValid() || !map.hasSameStructure(reference))
+    {
+        if (!map.reset(reference, number_of_elements))
+        {
+            // The matrix is not compressed, which happens in the very first
+            // assembly. The entries are inserted on the fly then.
+            return;
+        }
+        DBUG("Recomputing the scatter map of process %d.", process_id);
+    }
+
+    _current_scatter_map = &map;
+    _scatter_M = map.hasSameStructure(M);
+    _scatter_K = &reference == &K || map.hasSameStructure(K);
+    _scatter_Jac = Jac != nullptr;
+#endif
+}
+
+void VectorMatrixAssembler::finishAssembly(int const process_id)
+{
+    if (_lumped_mass)
+    {
+        double stiffness_to_mass_ratio = 0;
+        for (auto& data : _thread_local_data)
+        {
+            stiffness_to_mass_ratio = std::max(stiffness_to_mass_ratio,
+                                               data.stiffness_to_mass_ratio);
+            data.stiffness_to_mass_ratio = 0;
+        }
+        if (_stable_time_steps.size() <= static_cast<std::size_t>(process_id))
+        {
+            _stable_time_steps.resize(process_id + 1,
+                                      std::numeric_limits<double>::infinity());
+        }
+        _stable_time_steps[process_id] =
+            stiffness_to_mass_ratio > 0
+                ? 2 / stiffness_to_mass_ratio
+                : std::numeric_limits<double>::infinity();
+    }
+
+    if (!_use_incremental_assembly)
+    {
+        return;
+    }
+
+    std::size_t number_of_reused_elements = 0;
+    std::size_t number_of_assembled_elements = 0;
+    for (auto& data : _thread_local_data)
+    {
+        number_of_reused_elements += data.number_of_reused_elements;
+        number_of_assembled_elements += data.number_of_assembled_elements;
+        data.number_of_reused_elements = 0;
+        data.number_of_assembled_elements = 0;
+    }
+    auto const number_of_elements =
+        number_of_reused_elements + number_of_assembled_elements;
+    if (number_of_elements == 0)
+    {
+        return;
+    }
+
+    std::size_t cache_size = 0;
+    for (auto const& cached : _cached_contributions[process_id])
+    {
+        cache_size += cached.local_x.capacity() +
+                      cached.local_xdot.capacity() +
+                      cached.local_M_data.capacity() +
+                      cached.local_K_data.capacity() +
+                      cached.local_b_data.capacity() +
+                      cached.local_Jac_data.capacity();
+    }
+    INFO(
+        "Incremental assembly of process %d: reused %u of %u elements "
+        "(%.1f %%); cache size %g MiB.",
+        process_id, number_of_reused_elements, number_of_elements,
+        100.0 * number_of_reused_elements / number_of_elements,
+        cache_size * sizeof(double) / 1024.0 / 1024.0);
+}
+
+VectorMatrixAssembler::CachedContribution*
+VectorMatrixAssembler::getCachedContribution(int const process_id,
+                                             std::size_t const mesh_item_id)
+{
+    if (!_use_incremental_assembly)
+    {
+        return nullptr;
+    }
+    assert(static_cast<std::size_t>(process_id) <
+           _cached_contributions.size());
+    assert(mesh_item_id < _cached_contributions[process_id].size());
+    return &_cached_contributions[process_id][mesh_item_id];
+}
+
+bool VectorMatrixAssembler::reuseCachedContribution(
+    CachedContribution& cached, AssemblyKey const& key,
+    std::vector<double> const& local_x, ThreadLocalData& data) const
+{
+    if (!cached.valid || !(cached.key == key) ||
+        cached.number_of_reuses >= _incremental_assembly_max_reuses)
+    {
+        return false;
+    }
+
+    double x_norm = 0;
+    for (auto const value : local_x)
+    {
+        x_norm = std::max(x_norm, std::abs(value));
+    }
+    auto const tolerance = _incremental_assembly_tolerance * x_norm;
+    if (!(maxNormOfDifference(local_x, cached.local_x) <= tolerance) ||
+        !(key.dt * maxNormOfDifference(data.local_xdot, cached.local_xdot) <=
+          tolerance))
+    {
+        return false;
+    }
+
+    cached.number_of_reuses++;
+    data.element_stiffness_to_mass_ratio =
+        cached.element_stiffness_to_mass_ratio;
+    data.local_M_data = cached.local_M_data;
+    data.local_K_data = cached.local_K_data;
+    data.local_b_data = cached.local_b_data;
+    data.local_Jac_data = cached.local_Jac_data;
+    data.number_of_reused_elements++;
+    return true;
+}
+
+void VectorMatrixAssembler::storeContribution(
+    CachedContribution& cached, AssemblyKey const& key,
+    std::vector<double> const& local_x, ThreadLocalData const& data)
+{
+    cached.valid = true;
+    cached.key = key;
+    cached.number_of_reuses = 0;
+    cached.local_x = local_x;
+    cached.local_xdot = data.local_xdot;
+    cached.element_stiffness_to_mass_ratio =
+        data.element_stiffness_to_mass_ratio;
+    cached.local_M_data = data.local_M_data;
+    cached.local_K_data = data.local_K_data;
+    cached.local_b_data = data.local_b_data;
+    cached.local_Jac_data = data.local_Jac_data;
+}
+
+void VectorMatrixAssembler::getIndices(
+    std::size_t const mesh_item_id,
+    std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
+        dof_tables,
+    ThreadLocalData& data)
+{
+    // The index vectors are reused in order to avoid frequent memory
+    // reallocations.
+    data.indices_of_processes.resize(dof_tables.size());
+    for (std::size_t i = 0; i < dof_tables.size(); i++)
+    {
+        NumLib::getRowColumnIndices(mesh_item_id, dof_tables[i].get(),
+                                    data.indices_of_processes[i]);
+    }
+}
+
+#ifndef USE_PETSC
+template <typename LocalMatrix>
+void VectorMatrixAssembler::addToGlobalMatrix(
+    std::size_t const mesh_item_id, std::vector<GlobalIndexType> const& indices,
+    LocalMatrix const& local_matrix, bool const use_scatter_map,
+    GlobalMatrix& matrix) const
+{
+    auto* const map = _current_scatter_map;
+    if (use_scatter_map && map->isValid())
+    {
+        if (map->computeOffsets(mesh_item_id, indices))
+        {
+            map->add(matrix, mesh_item_id, local_matrix);
+            return;
+        }
+        // GlobalMatrix::add() will insert new entries, which invalidates the
+        // positions stored in the map.
+        map->invalidate();
+    }
+
+    auto const r_c_indices =
+        NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
+    matrix.add(r_c_indices, local_matrix);
+}
+#endif
+
+void VectorMatrixAssembler::addToGlobal(
+    std::size_t const mesh_item_id,
+    std::vector<GlobalIndexType> const& indices, ThreadLocalData const& data,
+    GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix* Jac) const
+{
+    static auto& region = BaseLib::Timing::getRegion("assembly/global_scatter");
+    BaseLib::Timing::ScopedTimer const timer{region};
+
+    auto const num_r_c = indices.size();
+#ifdef USE_PETSC
+    (void)mesh_item_id;
+    auto const r_c_indices =
+        NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
+#endif
+
+    auto add = [&]() {
+        if (!data.local_M_data.empty() && _lumped_mass)
+        {
+            // Only the diagonal is stored.
+            for (std::size_t i = 0; i < num_r_c; ++i)
+            {
+                M.add(indices[i], indices[i],
+                      data.local_M_data[i * num_r_c + i]);
+            }
+        }
+        else if (!data.local_M_data.empty())
+        {
+            auto const local_M =
+                MathLib::toMatrix(data.local_M_data, num_r_c, num_r_c);
+#ifdef USE_PETSC
+            M.add(r_c_indices, local_M);
+#else
+            addToGlobalMatrix(mesh_item_id, indices, local_M, _scatter_M, M);
+#endif
+        }
+        if (!data.local_K_data.empty())
+        {
+            auto const local_K =
+                MathLib::toMatrix(data.local_K_data, num_r_c, num_r_c);
+#ifdef USE_PETSC
+            K.add(r_c_indices, local_K);
+#else
+            addToGlobalMatrix(mesh_item_id, indices, local_K, _scatter_K, K);
+#endif
+        }
+        if (!data.local_b_data.empty())
+        {
+            assert(data.local_b_data.size() == num_r_c);
+            b.add(indices, data.local_b_data);
+        }
+        if (Jac != nullptr)
+        {
+            auto const local_Jac =
+                MathLib::toMatrix(data.local_Jac_data, num_r_c, num_r_c);
+#ifdef USE_PETSC
+            Jac->add(r_c_indices, local_Jac);
+#else
+            addToGlobalMatrix(mesh_item_id, indices, local_Jac, _scatter_Jac,
+                              *Jac);
+#endif
+        }
+    };
+
+#ifdef _OPENMP
+    if (_serialize_additions && omp_in_parallel())
+    {
+        // The global matrices and vectors do not support concurrent
+        // additions.
+#pragma omp critical(ogs_vector_matrix_assembler_add)
+        add();
+        return;
+    }
+#endif
+    add();
 }
 
 void VectorMatrixAssembler::preAssemble(
@@ -33,10 +546,13 @@ void VectorMatrixAssembler::preAssemble(
     const NumLib::LocalToGlobalIndexMap& dof_table, const double t,
     double const dt, const GlobalVector& x)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
-    auto const local_x = x.get(indices);
+    auto& data = getThreadLocalData();
+    auto& indices = data.indices_of_processes;
+    indices.resize(1);
+    NumLib::getRowColumnIndices(mesh_item_id, dof_table, indices[0]);
+    getLocalValues(x, indices[0], data.local_x);
 
-    local_assembler.preAssemble(t, dt, local_x);
+    local_assembler.preAssemble(t, dt, data.local_x);
 }
 
 void VectorMatrixAssembler::assemble(
@@ -48,63 +564,88 @@ void VectorMatrixAssembler::assemble(
     GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
     CoupledSolutionsForStaggeredScheme const* const cpl_xs)
 {
-    std::vector<std::vector<GlobalIndexType>> indices_of_processes;
-    indices_of_processes.reserve(dof_tables.size());
-    for (auto dof_table : dof_tables)
-    {
-        indices_of_processes.emplace_back(
-            NumLib::getIndices(mesh_item_id, dof_table.get()));
-    }
+    auto& data = getThreadLocalData();
+    getIndices(mesh_item_id, dof_tables, data);
+    auto const& indices_of_processes = data.indices_of_processes;
 
     auto const& indices = indices_of_processes[process_id];
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
+    data.local_M_data.clear();
+    data.local_K_data.clear();
+    data.local_b_data.clear();
+    data.local_Jac_data.clear();
+    getLocalValues(*x[process_id], indices, data.local_x);
+    getLocalValues(*xdot[process_id], indices, data.local_xdot);
 
-    if (cpl_xs == nullptr)
+    std::vector<double> local_coupled_xs;
+    if (cpl_xs != nullptr)
     {
-        auto const local_x = x[process_id]->get(indices);
-        auto const local_xdot = xdot[process_id]->get(indices);
-        local_assembler.assemble(t, dt, local_x, local_xdot, _local_M_data,
-                                 _local_K_data, _local_b_data);
+        local_coupled_xs = getCoupledLocalSolutions(x, indices_of_processes);
     }
-    else
+    auto const& local_state =
+        cpl_xs == nullptr ? data.local_x : local_coupled_xs;
+    AssemblyKey const key{
+        t, dt, 0, 0, false, _elementwise_residual, _lumped_mass};
+    auto* const cached = getCachedContribution(process_id, mesh_item_id);
+    if (cached != nullptr &&
+        reuseCachedContribution(*cached, key, local_state, data))
     {
-        auto local_coupled_xs0 = getCoupledLocalSolutions(cpl_xs->coupled_xs_t0,
-                                                          indices_of_processes);
+        if (_lumped_mass)
+        {
+            data.stiffness_to_mass_ratio =
+                std::max(data.stiffness_to_mass_ratio,
+                         data.element_stiffness_to_mass_ratio);
+        }
+        addToGlobal(mesh_item_id, indices, data, M, K, b, nullptr);
+        return;
+    }
 
-        auto local_coupled_xs =
-            getCoupledLocalSolutions(x, indices_of_processes);
+    {
+        BaseLib::Timing::ScopedTimer const timer{localAssemblyRegion()};
+        ElementTimer const element_timer{_element_times, mesh_item_id};
+        if (cpl_xs == nullptr)
+        {
+            local_assembler.assemble(t, dt, data.local_x, data.local_xdot,
+                                     data.local_M_data, data.local_K_data,
+                                     data.local_b_data);
+        }
+        else
+        {
+            auto local_coupled_xs0 = getCoupledLocalSolutions(
+                cpl_xs->coupled_xs_t0, indices_of_processes);
 
-        auto const local_x = MathLib::toVector(local_coupled_xs);
+            auto const local_x = MathLib::toVector(local_coupled_xs);
 
-        ProcessLib::LocalCoupledSolutions local_coupled_solutions(
-            std::move(local_coupled_xs0));
+            ProcessLib::LocalCoupledSolutions local_coupled_solutions(
+                std::move(local_coupled_xs0));
 
-        local_assembler.assembleForStaggeredScheme(
-            t, dt, local_x, process_id, _local_M_data, _local_K_data,
-            _local_b_data, local_coupled_solutions);
+            local_assembler.assembleForStaggeredScheme(
+                t, dt, local_x, process_id, data.local_M_data,
+                data.local_K_data, data.local_b_data, local_coupled_solutions);
+        }
     }
 
-    auto const num_r_c = indices.size();
-    auto const r_c_indices =
-        NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
-
-    if (!_local_M_data.empty())
+    if (_lumped_mass)
     {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
+        data.element_stiffness_to_mass_ratio = lumpMassAndMoveStiffnessToRhs(
+            data.local_x, data.local_M_data, data.local_K_data,
+            data.local_b_data);
+        data.stiffness_to_mass_ratio =
+            std::max(data.stiffness_to_mass_ratio,
+                     data.element_stiffness_to_mass_ratio);
     }
-    if (!_local_K_data.empty())
+    else if (_elementwise_residual)
     {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
+        moveMassAndStiffnessToRhs(data.local_x, data.local_xdot,
+                                  data.local_M_data, data.local_K_data,
+                                  data.local_b_data);
     }
-    if (!_local_b_data.empty())
+
+    if (cached != nullptr)
     {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
+        storeContribution(*cached, key, local_state, data);
+        data.number_of_assembled_elements++;
     }
+    addToGlobal(mesh_item_id, indices, data, M, K, b, nullptr);
 }
 
 void VectorMatrixAssembler::assembleWithJacobian(
@@ -116,79 +657,84 @@ void VectorMatrixAssembler::assembleWithJacobian(
     int const process_id, GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
     GlobalMatrix& Jac, CoupledSolutionsForStaggeredScheme const* const cpl_xs)
 {
-    std::vector<std::vector<GlobalIndexType>> indices_of_processes;
-    indices_of_processes.reserve(dof_tables.size());
-    for (auto dof_table : dof_tables)
-    {
-        indices_of_processes.emplace_back(
-            NumLib::getIndices(mesh_item_id, dof_table.get()));
-    }
+    auto& data = getThreadLocalData();
+    getIndices(mesh_item_id, dof_tables, data);
+    auto const& indices_of_processes = data.indices_of_processes;
 
     auto const& indices = indices_of_processes[process_id];
-    auto const local_xdot = xdot.get(indices);
+    getLocalValues(xdot, indices, data.local_xdot);
+    getLocalValues(*x[process_id], indices, data.local_x);
 
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
-    _local_Jac_data.clear();
+    data.local_M_data.clear();
+    data.local_K_data.clear();
+    data.local_b_data.clear();
+    data.local_Jac_data.clear();
 
-    if (cpl_xs == nullptr)
+    std::vector<double> local_coupled_xs;
+    if (cpl_xs != nullptr)
     {
-        auto const local_x = x[process_id]->get(indices);
-        _jacobian_assembler->assembleWithJacobian(
-            local_assembler, t, dt, local_x, local_xdot, dxdot_dx, dx_dx,
-            _local_M_data, _local_K_data, _local_b_data, _local_Jac_data);
+        local_coupled_xs = getCoupledLocalSolutions(x, indices_of_processes);
     }
-    else
+    auto const& local_state =
+        cpl_xs == nullptr ? data.local_x : local_coupled_xs;
+    AssemblyKey const key{
+        t, dt, dxdot_dx, dx_dx, true, _elementwise_residual, false};
+    auto* const cached = getCachedContribution(process_id, mesh_item_id);
+    if (cached != nullptr &&
+        reuseCachedContribution(*cached, key, local_state, data))
     {
-        auto local_coupled_xs0 = getCoupledLocalSolutions(cpl_xs->coupled_xs_t0,
-                                                          indices_of_processes);
+        addToGlobal(mesh_item_id, indices, data, M, K, b, &Jac);
+        return;
+    }
 
-        auto local_coupled_xs =
-            getCoupledLocalSolutions(x, indices_of_processes);
+    {
+        BaseLib::Timing::ScopedTimer const timer{localAssemblyRegion()};
+        ElementTimer const element_timer{_element_times, mesh_item_id};
+        if (cpl_xs == nullptr)
+        {
+            data.jacobian_assembler->assembleWithJacobian(
+                local_assembler, t, dt, data.local_x, data.local_xdot,
+                dxdot_dx, dx_dx, data.local_M_data, data.local_K_data,
+                data.local_b_data, data.local_Jac_data);
+        }
+        else
+        {
+            auto local_coupled_xs0 = getCoupledLocalSolutions(
+                cpl_xs->coupled_xs_t0, indices_of_processes);
 
-        auto const local_x = MathLib::toVector(local_coupled_xs);
+            auto const local_x = MathLib::toVector(local_coupled_xs);
 
-        ProcessLib::LocalCoupledSolutions local_coupled_solutions(
-            std::move(local_coupled_xs0));
+            ProcessLib::LocalCoupledSolutions local_coupled_solutions(
+                std::move(local_coupled_xs0));
 
-        _jacobian_assembler->assembleWithJacobianForStaggeredScheme(
-            local_assembler, t, dt, local_x, local_xdot, dxdot_dx, dx_dx,
-            process_id, _local_M_data, _local_K_data, _local_b_data,
-            _local_Jac_data, local_coupled_solutions);
+            data.jacobian_assembler->assembleWithJacobianForStaggeredScheme(
+                local_assembler, t, dt, local_x, data.local_xdot, dxdot_dx,
+                dx_dx, process_id, data.local_M_data, data.local_K_data,
+                data.local_b_data, data.local_Jac_data,
+                local_coupled_solutions);
+        }
     }
 
-    auto const num_r_c = indices.size();
-    auto const r_c_indices =
-        NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
-
-    if (!_local_M_data.empty())
-    {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
-    }
-    if (!_local_K_data.empty())
+    if (data.local_Jac_data.empty())
     {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
-    }
-    if (!_local_b_data.empty())
-    {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
+        OGS_FATAL(
+            "No Jacobian has been assembled! This might be due to programming "
+            "errors in the local assembler of the current process.");
     }
-    if (!_local_Jac_data.empty())
+
+    if (_elementwise_residual)
     {
-        auto const local_Jac =
-            MathLib::toMatrix(_local_Jac_data, num_r_c, num_r_c);
-        Jac.add(r_c_indices, local_Jac);
+        moveMassAndStiffnessToRhs(data.local_x, data.local_xdot,
+                                  data.local_M_data, data.local_K_data,
+                                  data.local_b_data);
     }
-    else
+
+    if (cached != nullptr)
     {
-        OGS_FATAL(
-            "No Jacobian has been assembled! This might be due to programming "
-            "errors in the local assembler of the current process.");
+        storeContribution(*cached, key, local_state, data);
+        data.number_of_assembled_elements++;
     }
+    addToGlobal(mesh_item_id, indices, data, M, K, b, &Jac);
 }
 
 }  // namespace ProcessLib
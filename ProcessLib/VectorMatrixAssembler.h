@@ -10,11 +10,17 @@
 
 #pragma once
 
+#include <functional>
+#include <limits>
 #include <vector>
 #include "NumLib/NumericsConfig.h"
 #include "AbstractJacobianAssembler.h"
 #include "CoupledSolutionsForStaggeredScheme.h"
 
+#ifndef USE_PETSC
+#include "MathLib/LinAlg/Eigen/EigenMatrixScatterMap.h"
+#endif
+
 namespace NumLib
 {
 class LocalToGlobalIndexMap;
@@ -30,12 +36,130 @@ class LocalAssemblerInterface;
 //!
 //! The methods of this class get the global matrices and vectors as input and
 //! pass only local data on to the local assemblers.
+//!
+//! After a call of enableParallelAssembly() the assembly methods can be called
+//! concurrently, e.g., by the NumLib::ParallelExecutor. Then each thread uses
+//! its own scratch data and Jacobian assembler, and the additions to the
+//! global matrices and vectors are serialized unless the caller guarantees
+//! that concurrently assembled elements do not share global entries.
 class VectorMatrixAssembler final
 {
 public:
     explicit VectorMatrixAssembler(
         std::unique_ptr<AbstractJacobianAssembler>&& jacobian_assembler);
 
+    //! Provides thread local data for the maximum number of threads of the
+    //! NumLib::ParallelExecutor.
+    //!
+    //! \param conflict_free_additions if set, the caller guarantees that
+    //! elements assembled concurrently never add to the same entries of the
+    //! global matrices and vectors, e.g., by using an element coloring. Then
+    //! the additions are not serialized.
+    //!
+    //! \note Lock-free additions require that the global matrices provide
+    //! storage for all element contributions in advance, which is ensured by
+    //! the sparsity pattern computed by NumLib::computeSparsityPattern(). With
+    //! PETSc the additions are always serialized.
+    void enableParallelAssembly(bool const conflict_free_additions);
+
+    //! Enables caching of the positions of the local matrix entries in the
+    //! global matrices, see prepareAssembly().
+    //!
+    //! \note The scatter maps are not available with PETSc and this call has
+    //! no effect then.
+    void enableScatterMaps();
+
+    //! Sets whether the following assemblies subtract the local
+    //! \f$ M_e \cdot \dot x_e + K_e \cdot x_e \f$ from the local \c b instead
+    //! of adding the local \c M and \c K to the global ones, cf.
+    //! NumLib::ODESystem::enableElementwiseResidual(). Has to be called
+    //! before prepareAssembly().
+    void setElementwiseResidual(bool const enabled)
+    {
+        _elementwise_residual = enabled;
+    }
+
+    //! Sets whether the following assemblies add the row sums of the local
+    //! \c M to the diagonal of the global one and subtract the local
+    //! \f$ K_e \cdot x_e \f$ from the local \c b, cf.
+    //! NumLib::ODESystem::enableLumpedMass(). Has to be called before
+    //! prepareAssembly(). Takes precedence over setElementwiseResidual().
+    void setLumpedMass(bool const enabled) { _lumped_mass = enabled; }
+
+    //! Returns the stability limit \f$ 2 / \lambda_\mathrm{max} \f$ of the
+    //! explicit forward Euler scheme with lumped mass matrix, which has been
+    //! estimated in the last assembly of the process with the given
+    //! \c process_id by the element bounds of the eigenvalues of
+    //! \f$ M_L^{-1} K \f$. Returns infinity if there is no estimate.
+    //!
+    //! \note Contributions of boundary conditions to \c K are not taken into
+    //! account.
+    double getStableTimeStep(int const process_id) const
+    {
+        return static_cast<std::size_t>(process_id) < _stable_time_steps.size()
+                   ? _stable_time_steps[process_id]
+                   : std::numeric_limits<double>::infinity();
+    }
+
+    //! Enables the reuse of the local contributions of elements whose local
+    //! solution has barely changed since their last assembly.
+    //!
+    //! The local matrices and vectors of each element are cached together
+    //! with the local \c x and \c xdot they were assembled for. A cached
+    //! contribution is reused if the time, the time step size, and the kind of
+    //! assembly are the same and
+    //! \f$ \|\Delta x_e\|_\infty \le \epsilon \|x_e\|_\infty \f$ and
+    //! \f$ \Delta t \|\Delta \dot x_e\|_\infty \le \epsilon \|x_e\|_\infty \f$
+    //! hold for the changes of the local solution and its time derivative.
+    //! Hence, contributions are only reused within a time step, e.g., in later
+    //! nonlinear iterations, for elements outside the region where the
+    //! solution still changes.
+    //!
+    //! \param tolerance the relative tolerance \f$ \epsilon \f$.
+    //! \param max_reuses the number of subsequent reuses after which an
+    //! element is reassembled anyway, which bounds the accumulated error.
+    //!
+    //! \attention The local assemblers are not called for reused elements.
+    //! Hence, their integration point data keep the values of their last
+    //! assembly.
+    void enableIncrementalAssembly(double const tolerance,
+                                   int const max_reuses);
+
+    //! Accumulates the wall-clock time of the local assembly of each mesh
+    //! item in the entry of \c times with the mesh item's id, which includes
+    //! the constitutive updates in the local assemblers. Contributions reused
+    //! by the incremental assembly take no time.
+    //!
+    //! \attention \c times must have an entry for each mesh item and must
+    //! outlive the assembler.
+    void enableElementTiming(std::vector<double>& times)
+    {
+        _element_times = &times;
+    }
+
+    //! Has to be called before each global assembly of the process with the
+    //! given \c process_id, outside of parallel regions.
+    //!
+    //! If the scatter maps are enabled, the sparsity structure of the global
+    //! matrices is compared with the one used for the cached positions of the
+    //! local matrix entries. If it changed, e.g., in the very first assembly,
+    //! the cached positions are discarded and recomputed on the fly.
+    //! Matrices whose structure does not match get their local matrices added
+    //! by searching the entries in the sparse structure.
+    //!
+    //! \param number_of_elements is the number of mesh items which can be
+    //! passed to the assembly methods.
+    //! \param Jac is the Jacobian, or nullptr if no Jacobian is assembled.
+    void prepareAssembly(int const process_id,
+                         std::size_t const number_of_elements,
+                         GlobalMatrix const& M, GlobalMatrix const& K,
+                         GlobalMatrix const* const Jac);
+
+    //! Has to be called after each global assembly of the process with the
+    //! given \c process_id, outside of parallel regions. Reports the
+    //! statistics of the incremental assembly, if enabled.
+    void finishAssembly(int const process_id);
+
     void preAssemble(const std::size_t mesh_item_id,
                      LocalAssemblerInterface& local_assembler,
                      const NumLib::LocalToGlobalIndexMap& dof_table,
@@ -68,15 +192,168 @@ public:
         CoupledSolutionsForStaggeredScheme const* const cpl_xs);
 
 private:
-    // temporary data only stored here in order to avoid frequent memory
-    // reallocations.
-    std::vector<double> _local_M_data;
-    std::vector<double> _local_K_data;
-    std::vector<double> _local_b_data;
-    std::vector<double> _local_Jac_data;
-
-    //! Used to assemble the Jacobian.
-    std::unique_ptr<AbstractJacobianAssembler> _jacobian_assembler;
+    //! Data used by one thread during the assembly.
+    struct ThreadLocalData
+    {
+        explicit ThreadLocalData(
+            std::unique_ptr<AbstractJacobianAssembler>&& jacobian_assembler_)
+            : jacobian_assembler(std::move(jacobian_assembler_))
+        {
+        }
+
+        // temporary data only stored here in order to avoid frequent memory
+        // reallocations.
+        std::vector<double> local_M_data;
+        std::vector<double> local_K_data;
+        std::vector<double> local_b_data;
+        std::vector<double> local_Jac_data;
+        std::vector<double> local_x;
+        std::vector<double> local_xdot;
+        std::vector<std::vector<GlobalIndexType>> indices_of_processes;
+
+        //! Used to assemble the Jacobian.
+        std::unique_ptr<AbstractJacobianAssembler> jacobian_assembler;
+
+        //! Statistics of the incremental assembly.
+        std::size_t number_of_reused_elements = 0;
+        std::size_t number_of_assembled_elements = 0;
+
+        //! Bound of the eigenvalues of \f$ M_L^{-1} K_e \f$ of the current
+        //! element and the maximum over the elements of this thread, see
+        //! setLumpedMass().
+        double element_stiffness_to_mass_ratio = 0;
+        double stiffness_to_mass_ratio = 0;
+    };
+
+    //! The parameters of an element assembly besides the local solution
+    //! which determine the local contributions.
+    struct AssemblyKey
+    {
+        double t;
+        double dt;
+        double dxdot_dx;
+        double dx_dx;
+        bool with_jacobian;
+        bool elementwise_residual;
+        bool lumped_mass;
+
+        bool operator==(AssemblyKey const& other) const
+        {
+            return t == other.t && dt == other.dt &&
+                   dxdot_dx == other.dxdot_dx && dx_dx == other.dx_dx &&
+                   with_jacobian == other.with_jacobian &&
+                   elementwise_residual == other.elementwise_residual &&
+                   lumped_mass == other.lumped_mass;
+        }
+    };
+
+    //! The local contributions of an element and the state they have been
+    //! assembled for, see enableIncrementalAssembly().
+    struct CachedContribution
+    {
+        bool valid = false;
+        AssemblyKey key{};
+        int number_of_reuses = 0;
+        double element_stiffness_to_mass_ratio = 0;
+        std::vector<double> local_x;
+        std::vector<double> local_xdot;
+        std::vector<double> local_M_data;
+        std::vector<double> local_K_data;
+        std::vector<double> local_b_data;
+        std::vector<double> local_Jac_data;
+    };
+
+    //! Returns the cached contribution of the element, or nullptr if the
+    //! incremental assembly is disabled.
+    CachedContribution* getCachedContribution(int const process_id,
+                                              std::size_t const mesh_item_id);
+
+    //! Copies the \c cached contribution to the local matrices and vectors of
+    //! \c data and returns true if it can be reused for the given local
+    //! solution \c local_x and the \c local_xdot stored in \c data.
+    bool reuseCachedContribution(CachedContribution& cached,
+                                 AssemblyKey const& key,
+                                 std::vector<double> const& local_x,
+                                 ThreadLocalData& data) const;
+
+    //! Stores the local matrices and vectors of \c data in \c cached.
+    static void storeContribution(CachedContribution& cached,
+                                  AssemblyKey const& key,
+                                  std::vector<double> const& local_x,
+                                  ThreadLocalData const& data);
+
+    //! Returns the data of the calling thread.
+    ThreadLocalData& getThreadLocalData();
+
+    //! Computes the global indices of the given mesh item for all DOF tables
+    //! and stores them in the given \c data.
+    static void getIndices(
+        std::size_t const mesh_item_id,
+        std::vector<std::reference_wrapper<
+            NumLib::LocalToGlobalIndexMap>> const& dof_tables,
+        ThreadLocalData& data);
+
+    //! Adds the local matrices and vectors to the global ones. The additions
+    //! are serialized if called inside of a parallel region.
+    void addToGlobal(std::size_t const mesh_item_id,
+                     std::vector<GlobalIndexType> const& indices,
+                     ThreadLocalData const& data, GlobalMatrix& M,
+                     GlobalMatrix& K, GlobalVector& b, GlobalMatrix* Jac) const;
+
+    //! One entry per thread; there is only one entry if the parallel assembly
+    //! is not enabled.
+    std::vector<ThreadLocalData> _thread_local_data;
+
+    //! Whether concurrent additions to the global matrices and vectors must be
+    //! serialized.
+    bool _serialize_additions = true;
+
+    //! Set by setElementwiseResidual().
+    bool _elementwise_residual = false;
+
+    //! Set by setLumpedMass().
+    bool _lumped_mass = false;
+    //! The stability limits estimated in the last assembly, one per process
+    //! id, see getStableTimeStep().
+    std::vector<double> _stable_time_steps;
+
+    //! Set by enableIncrementalAssembly().
+    bool _use_incremental_assembly = false;
+    double _incremental_assembly_tolerance = 0;
+    int _incremental_assembly_max_reuses = 0;
+    //! The cached contributions of the elements, one vector per process id.
+    std::vector<std::vector<CachedContribution>> _cached_contributions;
+
+    //! Set by enableElementTiming().
+    std::vector<double>* _element_times = nullptr;
+
+#ifndef USE_PETSC
+    //! Adds the given local matrix to the global \c matrix using the scatter
+    //! map if \c use_scatter_map is set and the positions of the item's
+    //! entries are or can be determined, and via GlobalMatrix::add()
+    //! otherwise.
+    template <typename LocalMatrix>
+    void addToGlobalMatrix(std::size_t const mesh_item_id,
+                           std::vector<GlobalIndexType> const& indices,
+                           LocalMatrix const& local_matrix,
+                           bool const use_scatter_map,
+                           GlobalMatrix& matrix) const;
+
+    bool _use_scatter_maps = false;
+
+    //! Cached positions of the local matrix entries, one map per process id.
+    std::vector<MathLib::EigenMatrixScatterMap> _scatter_maps;
+
+    //! The map used in the current assembly, or nullptr if the maps are
+    //! disabled or don't fit any of the matrices. Set by prepareAssembly().
+    MathLib::EigenMatrixScatterMap* _current_scatter_map = nullptr;
+
+    //! Whether the current scatter map can be used for M, K, or Jac,
+    //! respectively. Set by prepareAssembly().
+    bool _scatter_M = false;
+    bool _scatter_K = false;
+    bool _scatter_Jac = false;
+#endif
 };
 
 }  // namespace ProcessLib
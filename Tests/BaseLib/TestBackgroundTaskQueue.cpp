@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/BackgroundTaskQueue.h"
+
+TEST(BaseLibBackgroundTaskQueue, ExecutesTasksInOrder)
+{
+    std::vector<int> executed;
+    {
+        BaseLib::BackgroundTaskQueue queue(2);
+        for (int i = 0; i < 10; ++i)
+        {
+            queue.push([&executed, i] { executed.push_back(i); });
+        }
+        queue.wait();
+        ASSERT_EQ(10u, executed.size());
+
+        queue.push([&executed] { executed.push_back(10); });
+        // The destructor waits for the last task.
+    }
+    ASSERT_EQ(11u, executed.size());
+    for (int i = 0; i < 11; ++i)
+    {
+        EXPECT_EQ(i, executed[i]);
+    }
+}
+
+TEST(BaseLibBackgroundTaskQueue, BoundsTasksInFlight)
+{
+    std::atomic<int> completed{0};
+    BaseLib::BackgroundTaskQueue queue(1);
+    for (int i = 0; i < 20; ++i)
+    {
+        queue.push([&completed] { ++completed; });
+        // With a single task in flight all previous ones have finished.
+        EXPECT_LE(i, completed.load());
+    }
+    queue.wait();
+    EXPECT_EQ(20, completed.load());
+}
+
+TEST(BaseLibBackgroundTaskQueue, RethrowsTaskExceptions)
+{
+    BaseLib::BackgroundTaskQueue queue(1);
+    queue.push([] { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(queue.wait(), std::runtime_error);
+
+    // The queue continues after a failed task.
+    bool executed = false;
+    queue.push([&executed] { executed = true; });
+    queue.wait();
+    EXPECT_TRUE(executed);
+}
@@ -0,0 +1,96 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "BaseLib/ConvergenceTelemetry.h"
+#include "InfoLib/TestInfo.h"
+
+TEST(BaseLibConvergenceTelemetry, WritesIterationsAndTimesteps)
+{
+    namespace CT = BaseLib::ConvergenceTelemetry;
+
+    // Nothing is recorded before the file is opened.
+    ASSERT_FALSE(CT::isEnabled());
+    CT::setResidualNorms({1.0});
+    CT::finishIteration(0, 1, 0.0, 0.0, false);
+
+    std::string const file_name = TestInfoLib::TestInfo::tests_tmp_path +
+                                  "BaseLibConvergenceTelemetry.jsonl";
+    CT::open(file_name);
+    ASSERT_TRUE(CT::isEnabled());
+
+    // A rejected step with one failing iteration, repeated with half the
+    // step size.
+    CT::beginTimestep(1, 1.0, 1.0);
+    CT::setResidualNorms({1.0, 2.0});
+    CT::addLinearIterations(7);
+    CT::finishIteration(0, 1, 0.5, 0.25, false);
+    CT::finishTimestep(false, 1.0);
+
+    CT::beginTimestep(1, 0.5, 0.5);
+    CT::setResidualNorms({1.0, 2.0});
+    CT::addLinearIterations(3);
+    CT::addLinearIterations(2);
+    CT::finishIteration(0, 1, 0.5, 0.25, false);
+    CT::setResidualNorms({1e-3, 2e-3});
+    CT::setIncrementNorms({1e-6, 2e-6});
+    CT::addLinearIterations(4);
+    CT::finishIteration(0, 2, 0.5, 0.25, true);
+    CT::finishTimestep(true, 2.0);
+    CT::close();
+    ASSERT_FALSE(CT::isEnabled());
+
+    std::vector<nlohmann::json> records;
+    {
+        std::ifstream is(file_name);
+        std::string line;
+        while (std::getline(is, line))
+        {
+            records.push_back(nlohmann::json::parse(line));
+        }
+    }
+    std::remove(file_name.c_str());
+
+    ASSERT_EQ(5u, records.size());
+
+    EXPECT_EQ("iteration", records[0]["type"]);
+    EXPECT_EQ(1, records[0]["timestep"]);
+    EXPECT_EQ(1.0, records[0]["dt"]);
+    EXPECT_EQ(7, records[0]["linear_iterations"]);
+    EXPECT_EQ(2u, records[0]["residual_norms"].size());
+    EXPECT_TRUE(records[0]["increment_norms"].empty());
+    EXPECT_EQ(false, records[0]["converged"]);
+
+    EXPECT_EQ("timestep", records[1]["type"]);
+    EXPECT_EQ(false, records[1]["accepted"]);
+    EXPECT_EQ(1, records[1]["iterations"]);
+
+    EXPECT_EQ(0.5, records[2]["dt"]);
+    EXPECT_EQ(5, records[2]["linear_iterations"]);
+
+    EXPECT_EQ(2, records[3]["iteration"]);
+    EXPECT_EQ(4, records[3]["linear_iterations"]);
+    EXPECT_EQ(1e-3, records[3]["residual_norms"][0]);
+    EXPECT_EQ(2e-6, records[3]["increment_norms"][1]);
+    EXPECT_EQ(0.25, records[3]["linear_solver_time"]);
+    EXPECT_EQ(true, records[3]["converged"]);
+
+    EXPECT_EQ("timestep", records[4]["type"]);
+    EXPECT_EQ(true, records[4]["accepted"]);
+    EXPECT_EQ(2, records[4]["iterations"]);
+    EXPECT_EQ(9, records[4]["linear_iterations"]);
+    EXPECT_EQ(2.0, records[4]["time"]);
+}
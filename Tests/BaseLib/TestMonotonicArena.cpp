@@ -0,0 +1,95 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/MonotonicArena.h"
+
+namespace
+{
+struct Base : BaseLib::ArenaAllocated
+{
+    virtual ~Base() = default;
+};
+
+struct Derived final : Base
+{
+    explicit Derived(int& destructions) : destructions(destructions) {}
+    ~Derived() override { ++destructions; }
+
+    int& destructions;
+    double data[4] = {};
+};
+
+struct alignas(64) OverAligned final : Base
+{
+    double data[3] = {};
+};
+}  // namespace
+
+TEST(BaseLibMonotonicArena, ObjectsAreContiguousInCreationOrder)
+{
+    int destructions = 0;
+    BaseLib::MonotonicArena arena;
+    std::vector<std::unique_ptr<Base>> objects;
+    {
+        BaseLib::MonotonicArenaScope const scope(arena);
+        for (int i = 0; i < 100; ++i)
+        {
+            objects.emplace_back(new Derived(destructions));
+        }
+    }
+    EXPECT_EQ(std::size_t{1} << 20, arena.allocatedBytes());
+
+    for (std::size_t i = 1; i < objects.size(); ++i)
+    {
+        auto const distance =
+            reinterpret_cast<char const*>(objects[i].get()) -
+            reinterpret_cast<char const*>(objects[i - 1].get());
+        EXPECT_GT(distance, 0);
+        EXPECT_LT(distance,
+                  2 * static_cast<std::ptrdiff_t>(sizeof(Derived)) + 32);
+    }
+
+    // Deleting the objects only runs the destructors.
+    objects.clear();
+    EXPECT_EQ(100, destructions);
+}
+
+TEST(BaseLibMonotonicArena, UsesHeapOutsideOfScope)
+{
+    BaseLib::MonotonicArena arena;
+    {
+        BaseLib::MonotonicArenaScope const scope(arena);
+    }
+    int destructions = 0;
+    std::unique_ptr<Base> object{new Derived(destructions)};
+    EXPECT_EQ(0u, arena.allocatedBytes());
+    object.reset();
+    EXPECT_EQ(1, destructions);
+}
+
+TEST(BaseLibMonotonicArena, RespectsAlignment)
+{
+    BaseLib::MonotonicArena arena(256);
+    std::vector<std::unique_ptr<Base>> objects;
+    BaseLib::MonotonicArenaScope const scope(arena);
+    for (int i = 0; i < 20; ++i)
+    {
+        objects.emplace_back(new OverAligned);
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(objects.back().get()) %
+                          alignof(OverAligned));
+    }
+    // Small chunks are filled and replaced.
+    EXPECT_LT(256u, arena.allocatedBytes());
+}
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/IO/TextScanner.h"
+
+TEST(BaseLibTextScanner, ReadValuesAndLines)
+{
+    BaseLib::IO::TextScanner in(
+        "$Nodes\r\n2\n1 0.5 -1e-3 +2\n  2 3 4.25 5 $AREA 1\n$EndNodes");
+
+    EXPECT_EQ("$Nodes", in.getLine());
+
+    std::size_t n_nodes = 0;
+    ASSERT_TRUE(in.read(n_nodes));
+    EXPECT_EQ(2u, n_nodes);
+
+    long id = 0;
+    double x = 0;
+    double y = 0;
+    float z = 0;
+    ASSERT_TRUE(in.read(id, x, y, z));
+    EXPECT_EQ(1, id);
+    EXPECT_EQ(0.5, x);
+    EXPECT_EQ(-1e-3, y);
+    EXPECT_EQ(2.f, z);
+    EXPECT_EQ("", in.getLine());
+
+    ASSERT_TRUE(in.read(id, x, y, z));
+    EXPECT_EQ(2, id);
+    EXPECT_EQ(4.25, y);
+    EXPECT_EQ("$AREA", in.readToken());
+    EXPECT_EQ(" 1", in.getLine());
+
+    EXPECT_FALSE(in.eof());
+    int value = 0;
+    EXPECT_FALSE(in.read(value));
+    EXPECT_EQ("$EndNodes", in.readToken());
+    EXPECT_TRUE(in.eof());
+    EXPECT_FALSE(in.read(x));
+    EXPECT_EQ("", in.getLine());
+}
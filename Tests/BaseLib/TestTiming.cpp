@@ -0,0 +1,80 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "BaseLib/Timing.h"
+#include "InfoLib/TestInfo.h"
+
+TEST(BaseLibTiming, AccumulatesPerTimestep)
+{
+    auto& region = BaseLib::Timing::getRegion("test/region", true);
+    ASSERT_EQ(&region, &BaseLib::Timing::getRegion("test/region"));
+
+    // Inactive timers are not counted.
+    {
+        BaseLib::Timing::ScopedTimer const timer{region};
+    }
+    BaseLib::Timing::finishTimestep(0);
+    BaseLib::Timing::recordMemoryStage("test/inactive_stage");
+    ASSERT_EQ(0, region.count);
+
+    BaseLib::Timing::enable();
+    for (int i = 0; i < 3; ++i)
+    {
+        BaseLib::Timing::ScopedTimer const timer{region};
+    }
+    BaseLib::Timing::finishTimestep(1);
+    {
+        BaseLib::Timing::ScopedTimer const timer{region};
+    }
+    BaseLib::Timing::finishTimestep(2);
+    ASSERT_EQ(4, region.count);
+
+    BaseLib::Timing::recordMemoryStage("test/stage");
+    BaseLib::Timing::addMemory("test/subsystem", 100);
+    BaseLib::Timing::addMemory("test/subsystem", 20);
+
+    std::string const file_name =
+        TestInfoLib::TestInfo::tests_tmp_path + "BaseLibTiming.json";
+    BaseLib::Timing::writeJSON(file_name, 0);
+
+    nlohmann::json data;
+    std::ifstream(file_name) >> data;
+    std::remove(file_name.c_str());
+
+    ASSERT_EQ(4, data["total"]["test/region"]["count"]);
+    auto const& timesteps = data["timesteps"];
+    ASSERT_EQ(2u, timesteps.size());
+    ASSERT_EQ(1, timesteps[0]["timestep"]);
+    ASSERT_EQ(3, timesteps[0]["regions"]["test/region"]["count"]);
+    ASSERT_EQ(1, timesteps[1]["regions"]["test/region"]["count"]);
+
+    auto const& memory = data["memory"];
+    ASSERT_EQ(1u, memory["stages"].size());
+    ASSERT_EQ("test/stage", memory["stages"][0]["stage"]);
+    ASSERT_EQ(120, memory["subsystems"]["test/subsystem"]);
+#ifdef __linux__
+    ASSERT_GT(memory["stages"][0]["peak_resident"], 0u);
+    ASSERT_GE(memory["stages"][0]["peak_resident"],
+              memory["stages"][0]["resident"]);
+#endif
+
+    BaseLib::Timing::writeChromeTrace(file_name, 0);
+    std::ifstream(file_name) >> data;
+    std::remove(file_name.c_str());
+
+    ASSERT_EQ(4u, data["traceEvents"].size());
+    ASSERT_EQ("test/region", data["traceEvents"][0]["name"]);
+}
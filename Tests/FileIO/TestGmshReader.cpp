@@ -0,0 +1,137 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "Applications/FileIO/Gmsh/GmshReader.h"
+#include "InfoLib/TestInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/PropertyVector.h"
+
+namespace
+{
+// Two triangles of physical surface 7 in the unit square, a quad of the
+// physical surface 3 next to it, and a point element, which is skipped.
+char const msh41_ascii[] =
+    "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n"
+    "$PhysicalNames\n2\n2 3 \"right\"\n2 7 \"left\"\n$EndPhysicalNames\n"
+    "$Entities\n1 0 2 0\n"
+    "1 0 0 0 0\n"
+    "1 0 0 0 1 1 0 1 7 0\n"
+    "2 1 0 0 2 1 0 1 3 0\n"
+    "$EndEntities\n"
+    "$Nodes\n2 6 1 6\n"
+    "2 1 0 4\n1\n2\n3\n4\n0 0 0\n1 0 0\n1 1 0\n0 1 0\n"
+    "2 2 0 2\n5\n6\n2 0 0\n2 1 0\n"
+    "$EndNodes\n"
+    "$Elements\n3 4 1 4\n"
+    "0 1 15 1\n1 1\n"
+    "2 1 2 2\n2 1 2 3\n3 1 3 4\n"
+    "2 2 3 1\n4 2 5 6 3\n"
+    "$EndElements\n";
+
+template <typename T>
+void writeBinary(std::ofstream& out, std::vector<T> const& values)
+{
+    out.write(reinterpret_cast<char const*>(values.data()),
+              values.size() * sizeof(T));
+}
+
+void writeBinaryMSH41(std::string const& file_name)
+{
+    using S = std::size_t;
+    std::ofstream out(file_name, std::ios::binary);
+    out << "$MeshFormat\n4.1 1 8\n";
+    writeBinary<std::int32_t>(out, {1});
+    out << "\n$EndMeshFormat\n$Entities\n";
+    writeBinary<S>(out, {0, 0, 2, 0});
+    writeBinary<std::int32_t>(out, {1});
+    writeBinary<double>(out, {0, 0, 0, 1, 1, 0});
+    writeBinary<S>(out, {1});
+    writeBinary<std::int32_t>(out, {7});
+    writeBinary<S>(out, {0});
+    writeBinary<std::int32_t>(out, {2});
+    writeBinary<double>(out, {1, 0, 0, 2, 1, 0});
+    writeBinary<S>(out, {1});
+    writeBinary<std::int32_t>(out, {3});
+    writeBinary<S>(out, {0});
+    out << "\n$EndEntities\n$Nodes\n";
+    writeBinary<S>(out, {2, 6, 1, 6});
+    writeBinary<std::int32_t>(out, {2, 1, 0});
+    writeBinary<S>(out, {4, 1, 2, 3, 4});
+    writeBinary<double>(out, {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0});
+    writeBinary<std::int32_t>(out, {2, 2, 0});
+    writeBinary<S>(out, {2, 5, 6});
+    writeBinary<double>(out, {2, 0, 0, 2, 1, 0});
+    out << "\n$EndNodes\n$Elements\n";
+    writeBinary<S>(out, {2, 3, 1, 3});
+    writeBinary<std::int32_t>(out, {2, 1, 2});
+    writeBinary<S>(out, {2, 1, 1, 2, 3, 2, 1, 3, 4});
+    writeBinary<std::int32_t>(out, {2, 2, 3});
+    writeBinary<S>(out, {1, 3, 2, 5, 6, 3});
+    out << "\n$EndElements\n";
+}
+
+void checkMesh(MeshLib::Mesh const& mesh)
+{
+    ASSERT_EQ(6u, mesh.getNumberOfNodes());
+    ASSERT_EQ(3u, mesh.getNumberOfElements());
+    EXPECT_EQ(MeshLib::MeshElemType::TRIANGLE,
+              mesh.getElement(0)->getGeomType());
+    EXPECT_EQ(MeshLib::MeshElemType::TRIANGLE,
+              mesh.getElement(1)->getGeomType());
+    EXPECT_EQ(MeshLib::MeshElemType::QUAD, mesh.getElement(2)->getGeomType());
+    EXPECT_EQ(2.0, (*mesh.getElement(2)->getNode(1))[0]);
+    EXPECT_EQ(1.0, (*mesh.getElement(2)->getNode(2))[1]);
+
+    // The physical tags 7 and 3 are condensed to the material ids 1 and 0.
+    auto const* const material_ids =
+        mesh.getProperties().getPropertyVector<int>("MaterialIDs");
+    ASSERT_NE(nullptr, material_ids);
+    EXPECT_EQ(1, (*material_ids)[0]);
+    EXPECT_EQ(1, (*material_ids)[1]);
+    EXPECT_EQ(0, (*material_ids)[2]);
+}
+}  // namespace
+
+TEST(FileIO, GmshReaderMSH41ASCII)
+{
+    std::string const file_name(TestInfoLib::TestInfo::tests_tmp_path +
+                                "GmshReaderMSH41ASCII.msh");
+    std::ofstream(file_name) << msh41_ascii;
+
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        FileIO::GMSH::readGMSHMesh(file_name));
+    ASSERT_NE(nullptr, mesh);
+    checkMesh(*mesh);
+    std::remove(file_name.c_str());
+}
+
+TEST(FileIO, GmshReaderMSH41Binary)
+{
+    std::string const file_name(TestInfoLib::TestInfo::tests_tmp_path +
+                                "GmshReaderMSH41Binary.msh");
+    writeBinaryMSH41(file_name);
+
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        FileIO::GMSH::readGMSHMesh(file_name));
+    ASSERT_NE(nullptr, mesh);
+    checkMesh(*mesh);
+    std::remove(file_name.c_str());
+}
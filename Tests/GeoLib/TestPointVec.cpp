@@ -194,3 +194,68 @@ TEST_F(PointVecTest, TestPointVecCtorRandomPointsLargeEps)
         name, std::move(ps_ptr), nullptr, GeoLib::PointVec::PointType::POINT,
         1e-2);
 }
+
+// Testing that each point is mapped to the first point within the epsilon
+// range, which is not a duplicate itself.
+TEST_F(PointVecTest, TestPointVecCtorNearbyPoints)
+{
+    auto ps_ptr = std::make_unique<VectorOfPoints>();
+    generateRandomPoints(*ps_ptr, 1000);
+    std::uniform_real_distribution<double> perturbation(-1e-4, 1e-4);
+    for (std::size_t k = 0; k < 1000; ++k)
+    {
+        auto const& p = *(*ps_ptr)[k];
+        ps_ptr->push_back(new GeoLib::Point(p[0] + perturbation(gen),
+                                            p[1] + perturbation(gen),
+                                            p[2] + perturbation(gen),
+                                            ps_ptr->size()));
+    }
+    VectorOfPoints const ps_copy = [&]() {
+        VectorOfPoints copy;
+        for (auto const* p : *ps_ptr)
+        {
+            copy.push_back(new GeoLib::Point(*p));
+        }
+        return copy;
+    }();
+
+    double const rel_eps = 1e-2;
+    GeoLib::PointVec point_vec(name, std::move(ps_ptr), nullptr,
+                               GeoLib::PointVec::PointType::POINT, rel_eps);
+    GeoLib::AABB const aabb(ps_copy.begin(), ps_copy.end());
+    double const eps =
+        rel_eps *
+        std::sqrt(MathLib::sqrDist(aabb.getMinPoint(), aabb.getMaxPoint()));
+
+    auto const& id_map = point_vec.getIDMap();
+    ASSERT_EQ(ps_copy.size(), id_map.size());
+    std::vector<bool> is_first(ps_copy.size(), false);
+    for (std::size_t k = 0; k < ps_copy.size(); ++k)
+    {
+        auto const& p = *(*point_vec.getVector())[id_map[k]];
+        ASSERT_LE(MathLib::sqrDist(p, *ps_copy[k]), eps * eps);
+
+        // the point is the first one mapped to its id
+        is_first[k] = std::none_of(
+            id_map.begin(), id_map.begin() + k,
+            [&](std::size_t const id) { return id == id_map[k]; });
+        if (is_first[k])
+        {
+            ASSERT_EQ(0., MathLib::sqrDist(p, *ps_copy[k]));
+        }
+    }
+    // no two remaining points lie within the epsilon range
+    auto const& pnts = *point_vec.getVector();
+    for (std::size_t i = 0; i < pnts.size(); ++i)
+    {
+        for (std::size_t j = 0; j < i; ++j)
+        {
+            ASSERT_GT(MathLib::sqrDist(*pnts[i], *pnts[j]), eps * eps);
+        }
+    }
+
+    for (auto* p : ps_copy)
+    {
+        delete p;
+    }
+}
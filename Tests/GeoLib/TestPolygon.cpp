@@ -13,6 +13,10 @@
 
 #include "gtest/gtest.h"
 
+#include <cmath>
+
+#include <boost/math/constants/constants.hpp>
+
 #include "GeoLib/Point.h"
 #include "GeoLib/LineSegment.h"
 #include "GeoLib/Polygon.h"
@@ -223,3 +227,42 @@ TEST_F(PolygonTest, CopyConstructor)
         ASSERT_TRUE(polygon_copy.containsSegment(segment));
     }
 }
+
+TEST(GeoLibPolygon, isPntInPolygonManySegments)
+{
+    // Polygon approximating a star shaped curve with many segments.
+    std::size_t const n(2000);
+    std::vector<GeoLib::Point*> pnts;
+    auto const radius = [](double const phi) {
+        return 1 + 0.3 * std::cos(50 * phi);
+    };
+    double const pi = boost::math::double_constants::pi;
+    for (std::size_t k(0); k < n; k++)
+    {
+        double const phi(2 * pi * k / n);
+        pnts.push_back(new GeoLib::Point(radius(phi) * std::cos(phi),
+                                         radius(phi) * std::sin(phi), 0.0));
+    }
+    GeoLib::Polyline ply(pnts);
+    for (std::size_t k(0); k < n; k++)
+    {
+        ply.addPoint(k);
+    }
+    ply.addPoint(0);
+    GeoLib::Polygon const polygon(ply);
+
+    for (std::size_t k(0); k < 1000; k++)
+    {
+        double const phi(2 * pi * (k + 0.5) / 1000);
+        double const r(radius(phi));
+        EXPECT_TRUE(polygon.isPntInPolygon(0.95 * r * std::cos(phi),
+                                           0.95 * r * std::sin(phi), 0.0));
+        EXPECT_FALSE(polygon.isPntInPolygon(1.05 * r * std::cos(phi),
+                                            1.05 * r * std::sin(phi), 0.0));
+    }
+
+    for (auto& pnt : pnts)
+    {
+        delete pnt;
+    }
+}
@@ -0,0 +1,136 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "MaterialLib/SolidModels/Ehlers.h"
+#include "ParameterLib/ConstantParameter.h"
+
+namespace Ehlers = MaterialLib::Solids::Ehlers;
+
+namespace
+{
+constexpr int Dim = 3;
+using Material = Ehlers::SolidEhlers<Dim>;
+using KelvinVector = Material::KelvinVector;
+using KelvinMatrix = Material::KelvinMatrix;
+using StateVariables = Ehlers::StateVariables<Dim>;
+}  // namespace
+
+TEST(MaterialLibSolidModels, IntegrateStressBatchEhlers)
+{
+    ParameterLib::ConstantParameter<double> const G("G", 34.78e9);
+    ParameterLib::ConstantParameter<double> const K("K", 38.10e9);
+    ParameterLib::ConstantParameter<double> const kappa("kappa", 100e6);
+    ParameterLib::ConstantParameter<double> const beta("beta", 0.47);
+    ParameterLib::ConstantParameter<double> const zero("zero", 0);
+
+    Material const material{
+        NumLib::NewtonRaphsonSolverParameters{100, 1e-10},
+        Ehlers::MaterialPropertiesParameters{G, K, zero, beta, zero, zero,
+                                             zero, zero, zero, beta, zero,
+                                             zero, zero, zero, kappa, zero},
+        nullptr, Ehlers::TangentType::Plastic};
+
+    // The first point stays elastic, the others yield.
+    std::size_t const n = 3;
+    std::vector<KelvinVector, Eigen::aligned_allocator<KelvinVector>> eps_prev(
+        n, KelvinVector::Zero()),
+        eps(n, KelvinVector::Zero()), sigma_prev(n, KelvinVector::Zero());
+    std::vector<std::unique_ptr<
+        MaterialLib::Solids::MechanicsBase<Dim>::MaterialStateVariables>>
+        states;
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        eps[ip][3] = 1e-4 + 1e-2 * ip;
+        eps[ip][0] = -1e-4 * ip;
+        states.push_back(material.createMaterialStateVariables());
+    }
+
+    ParameterLib::SpatialPosition x;
+    x.setElementID(0);
+    double const t = 0;
+    double const dt = 1;
+    double const T = 293.15;
+
+    // Point-wise update; the states are not modified.
+    std::vector<KelvinVector, Eigen::aligned_allocator<KelvinVector>>
+        sigma_expected(n);
+    std::vector<KelvinMatrix, Eigen::aligned_allocator<KelvinMatrix>>
+        C_expected(n);
+    std::vector<std::unique_ptr<
+        MaterialLib::Solids::MechanicsBase<Dim>::MaterialStateVariables>>
+        states_expected;
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        x.setIntegrationPoint(ip);
+        auto solution =
+            material.integrateStress(t, x, dt, eps_prev[ip], eps[ip],
+                                     sigma_prev[ip], *states[ip], T);
+        ASSERT_TRUE(solution);
+        std::unique_ptr<
+            MaterialLib::Solids::MechanicsBase<Dim>::MaterialStateVariables>
+            state;
+        std::tie(sigma_expected[ip], state, C_expected[ip]) =
+            std::move(*solution);
+        states_expected.push_back(std::move(state));
+    }
+
+    // Batched update in place.
+    std::vector<KelvinVector, Eigen::aligned_allocator<KelvinVector>> sigma(n);
+    std::vector<KelvinMatrix, Eigen::aligned_allocator<KelvinMatrix>> C(n);
+    ASSERT_TRUE(material.integrateStressBatch(t, x, dt, n, eps_prev.data(),
+                                              eps.data(), sigma_prev.data(),
+                                              states.data(), T, sigma.data(),
+                                              C.data(), nullptr));
+
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        ASSERT_EQ(sigma_expected[ip], sigma[ip]);
+        ASSERT_EQ(C_expected[ip], C[ip]);
+
+        auto const& state = static_cast<StateVariables const&>(*states[ip]);
+        auto const& state_expected =
+            static_cast<StateVariables const&>(*states_expected[ip]);
+        ASSERT_EQ(state_expected.eps_p.D, state.eps_p.D);
+        ASSERT_EQ(state_expected.eps_p.V, state.eps_p.V);
+        ASSERT_EQ(state_expected.eps_p.eff, state.eps_p.eff);
+    }
+
+    // The yielding points have accumulated plastic strains.
+    ASSERT_EQ(0, static_cast<StateVariables const&>(*states[0]).eps_p.eff);
+    ASSERT_LT(0, static_cast<StateVariables const&>(*states[2]).eps_p.eff);
+
+    // Repeated batched update reporting the elastic steps. The tangents of the
+    // elastic points are not computed, but given by the elastic tangent.
+    std::vector<KelvinMatrix, Eigen::aligned_allocator<KelvinMatrix>> C_elastic(
+        n, KelvinMatrix::Zero());
+    bool elastic[n];
+    ASSERT_TRUE(material.integrateStressBatch(
+        t, x, dt, n, eps_prev.data(), eps.data(), sigma_prev.data(),
+        states.data(), T, sigma.data(), C_elastic.data(), elastic));
+
+    ASSERT_TRUE(elastic[0]);
+    ASSERT_FALSE(elastic[1]);
+    ASSERT_FALSE(elastic[2]);
+    ASSERT_EQ(KelvinMatrix::Zero(), C_elastic[0]);
+    x.setIntegrationPoint(0);
+    ASSERT_EQ(C_expected[0], material.getElasticTangent(t, x, T));
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        ASSERT_EQ(sigma_expected[ip], sigma[ip]);
+        if (!elastic[ip])
+        {
+            ASSERT_EQ(C_expected[ip], C_elastic[ip]);
+        }
+    }
+}
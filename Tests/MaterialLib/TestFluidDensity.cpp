@@ -13,6 +13,7 @@
 */
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <memory>
 
 #include "Tests/TestTools.h"
@@ -160,3 +161,50 @@ TEST(Material, checkWaterDensityIAPWSIF97Region1)
     const double rho_p1 = rho->getValue(vars);
     ASSERT_NEAR((rho_p1 - rho_T1) / perturbation, drho_dp, 1.e-6);
 }
+
+TEST(Material, checkTabulatedWaterDensityIAPWSIF97Region1)
+{
+    const char xml[] =
+        "<density>"
+        "   <type>WaterDensityIAPWSIF97Region1</type>"
+        "</density>";
+    const auto rho = createTestFluidDensityModel(xml);
+
+    const char xml_tabulated[] =
+        "<density>"
+        "   <type>WaterDensityIAPWSIF97Region1</type>"
+        "   <tabulation>"
+        "       <temperature_range> 280 450 </temperature_range>"
+        "       <pressure_range> 1e6 5e7 </pressure_range>"
+        "       <relative_tolerance> 1e-7 </relative_tolerance>"
+        "   </tabulation>"
+        "</density>";
+    const auto rho_tabulated = createTestFluidDensityModel(xml_tabulated);
+
+    for (double const T : {280.0, 301.3, 373.15, 449.9})
+    {
+        for (double const p : {1.e+6, 2.34e+6, 4.e+7})
+        {
+            ArrayType const vars = {{T, p}};
+            double const rho_expected = rho->getValue(vars);
+            ASSERT_NEAR(rho_expected, rho_tabulated->getValue(vars),
+                        1.e-7 * rho_expected);
+            double const drho_dT =
+                rho->getdValue(vars, PropertyVariableType::T);
+            ASSERT_NEAR(
+                drho_dT,
+                rho_tabulated->getdValue(vars, PropertyVariableType::T),
+                1.e-5 * std::abs(drho_dT));
+            double const drho_dp =
+                rho->getdValue(vars, PropertyVariableType::p);
+            ASSERT_NEAR(
+                drho_dp,
+                rho_tabulated->getdValue(vars, PropertyVariableType::p),
+                1.e-5 * std::abs(drho_dp));
+        }
+    }
+
+    // Outside of the tabulated range the model is evaluated directly.
+    ArrayType const vars = {{460.0, 6.e+7}};
+    ASSERT_EQ(rho->getValue(vars), rho_tabulated->getValue(vars));
+}
@@ -75,6 +75,65 @@ TEST(MaterialLib_Fracture, LinearElasticIsotropic)
     EXPECT_NEAR(0, C(1, 1), eps);
 }
 
+TEST(MaterialLib_Fracture, LinearElasticIsotropicBatch)
+{
+    ParameterLib::ConstantParameter<double> const kn("", 1e11);
+    ParameterLib::ConstantParameter<double> const ks("", 1e9);
+    LinearElasticIsotropic<2>::MaterialProperties const mp{kn, ks};
+
+    double const penalty_aperture_cutoff = 1e-5;
+    bool const tension_cutoff = true;
+    LinearElasticIsotropic<2> fractureModel{penalty_aperture_cutoff,
+                                            tension_cutoff, mp};
+
+    std::size_t const n = 3;
+    std::vector<double> const aperture0{1e-5, 2e-5, 1e-5};
+    std::vector<Eigen::Vector2d> const w_prev(n, Eigen::Vector2d::Zero());
+    std::vector<Eigen::Vector2d> const sigma_prev(n, Eigen::Vector2d::Zero());
+    std::vector<Eigen::Vector2d> const w{Eigen::Vector2d(-1e-5, -1e-5),
+                                         Eigen::Vector2d(2e-6, -5e-6),
+                                         Eigen::Vector2d(-1e-5, 1e-5)};
+    Eigen::Vector2d const sigma0 = Eigen::Vector2d::Zero();
+
+    std::vector<std::unique_ptr<FractureModelBase<2>::MaterialStateVariables>>
+        states;
+    std::vector<FractureModelBase<2>::MaterialStateVariables*> state_ptrs;
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        states.push_back(fractureModel.createMaterialStateVariables());
+        state_ptrs.push_back(states.back().get());
+    }
+
+    std::vector<Eigen::Vector2d> sigma(n);
+    std::vector<Eigen::Matrix2d> C(n);
+    ParameterLib::SpatialPosition x;
+    x.setElementID(0);
+    fractureModel.computeConstitutiveRelationBatch(
+        0, x, n, aperture0.data(), sigma0, w_prev.data(), w.data(),
+        sigma_prev.data(), sigma.data(), C.data(), state_ptrs.data());
+
+    // Compare with the per point evaluation.
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        auto state = fractureModel.createMaterialStateVariables();
+        Eigen::Vector2d sigma_ip;
+        Eigen::Matrix2d C_ip;
+        fractureModel.computeConstitutiveRelation(
+            0, x, aperture0[ip], sigma0, w_prev[ip], w[ip], sigma_prev[ip],
+            sigma_ip, C_ip, *state);
+
+        EXPECT_NEAR(sigma_ip[0], sigma[ip][0], eps_sigma);
+        EXPECT_NEAR(sigma_ip[1], sigma[ip][1], eps_sigma);
+        EXPECT_NEAR(C_ip(0, 0), C[ip](0, 0), eps_C);
+        EXPECT_NEAR(C_ip(0, 1), C[ip](0, 1), eps_C);
+        EXPECT_NEAR(C_ip(1, 0), C[ip](1, 0), eps_C);
+        EXPECT_NEAR(C_ip(1, 1), C[ip](1, 1), eps_C);
+        EXPECT_EQ(state->setTensileStress(), states[ip]->setTensileStress());
+    }
+    // The last point opens the fracture.
+    EXPECT_TRUE(states[2]->setTensileStress());
+}
+
 TEST(MaterialLib_Fracture, Coulomb2D_elastic)
 {
     ParameterLib::ConstantParameter<double> const kn("", 1e11);
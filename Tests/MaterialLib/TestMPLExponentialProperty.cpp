@@ -60,5 +60,20 @@ TEST(MaterialPropertyLib, ExponentialProperty)
                           MaterialPropertyLib::Variable::temperature)]) -
                       reference_condition)),
         1.e-16);
+
+    MaterialPropertyLib::Property const& property = exp_property;
+    auto const value_and_derivatives = property.valueAndDerivatives(
+        variable_array,
+        std::array{MaterialPropertyLib::Variable::temperature,
+                   MaterialPropertyLib::Variable::phase_pressure},
+        pos, time, dt);
+    ASSERT_EQ(
+        std::get<double>(exp_property.value(variable_array, pos, time, dt)),
+        value_and_derivatives.value);
+    ASSERT_EQ(std::get<double>(exp_property.dValue(
+                  variable_array, MaterialPropertyLib::Variable::temperature,
+                  pos, time, dt)),
+              value_and_derivatives.derivatives[0]);
+    ASSERT_EQ(0.0, value_and_derivatives.derivatives[1]);
 }
 
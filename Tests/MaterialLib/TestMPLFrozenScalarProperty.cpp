@@ -0,0 +1,96 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "MaterialLib/MPL/FrozenScalarProperty.h"
+#include "MaterialLib/MPL/Properties/Constant.h"
+#include "MaterialLib/MPL/Properties/ExponentialProperty.h"
+#include "MaterialLib/MPL/Properties/LinearProperty.h"
+
+namespace MPL = MaterialPropertyLib;
+
+namespace
+{
+MPL::VariableArray makeVariableArray()
+{
+    MPL::VariableArray variable_array;
+    variable_array[static_cast<int>(MPL::Variable::temperature)] = 303.15;
+    variable_array[static_cast<int>(MPL::Variable::phase_pressure)] = 2e5;
+    return variable_array;
+}
+}  // namespace
+
+TEST(MaterialPropertyLib, FrozenScalarPropertyConstant)
+{
+    MPL::Constant const constant{1000.0};
+    MPL::FrozenScalarProperty const frozen{constant};
+
+    auto const variable_array = makeVariableArray();
+    ParameterLib::SpatialPosition const pos;
+    double const t = std::numeric_limits<double>::quiet_NaN();
+    double const dt = std::numeric_limits<double>::quiet_NaN();
+
+    ASSERT_TRUE(frozen.isConstant());
+    ASSERT_EQ(1000.0, frozen.value(variable_array, pos, t, dt));
+    ASSERT_EQ(0.0, frozen.dValue(variable_array, MPL::Variable::temperature,
+                                 pos, t, dt));
+}
+
+TEST(MaterialPropertyLib, FrozenScalarPropertyLinear)
+{
+    MPL::LinearProperty const linear_property{
+        1000.0,
+        {{MPL::Variable::temperature, 293.15, -4e-4},
+         {MPL::Variable::phase_pressure, 1e5, 4.5e-10}}};
+    MPL::Property const& linear = linear_property;
+    MPL::FrozenScalarProperty const frozen{linear};
+
+    auto const variable_array = makeVariableArray();
+    ParameterLib::SpatialPosition const pos;
+    double const t = std::numeric_limits<double>::quiet_NaN();
+    double const dt = std::numeric_limits<double>::quiet_NaN();
+
+    ASSERT_FALSE(frozen.isConstant());
+    // The results are identical to the ones of the property.
+    ASSERT_EQ(linear.value<double>(variable_array, pos, t, dt),
+              frozen.value(variable_array, pos, t, dt));
+    for (auto const variable :
+         {MPL::Variable::temperature, MPL::Variable::phase_pressure,
+          MPL::Variable::capillary_pressure})
+    {
+        ASSERT_EQ(linear.dValue<double>(variable_array, variable, pos, t, dt),
+                  frozen.dValue(variable_array, variable, pos, t, dt));
+    }
+}
+
+TEST(MaterialPropertyLib, FrozenScalarPropertyGeneric)
+{
+    MPL::ExponentialProperty const exponential_property{
+        1e-3, {MPL::Variable::temperature, 293.15, 1 / 75.0}};
+    MPL::Property const& exponential = exponential_property;
+    MPL::FrozenScalarProperty const frozen{exponential};
+
+    auto const variable_array = makeVariableArray();
+    ParameterLib::SpatialPosition const pos;
+    double const t = std::numeric_limits<double>::quiet_NaN();
+    double const dt = std::numeric_limits<double>::quiet_NaN();
+
+    ASSERT_FALSE(frozen.isConstant());
+    ASSERT_EQ(exponential.value<double>(variable_array, pos, t, dt),
+              frozen.value(variable_array, pos, t, dt));
+    ASSERT_EQ(exponential.dValue<double>(variable_array,
+                                         MPL::Variable::temperature, pos, t,
+                                         dt),
+              frozen.dValue(variable_array, MPL::Variable::temperature, pos, t,
+                            dt));
+}
@@ -116,4 +116,15 @@ TEST(MaterialPropertyLib, IdealGasLawOfPurePhase)
     ASSERT_NEAR(d_rho2_dT2_air, d_rho2_dT2, 1.e-10);
     ASSERT_NEAR(d_rho2_dTdp_air, d_rho2_dTdp, 1.e-10);
     ASSERT_EQ(d_rho2_dTdp, d_rho2_dpdT);
+
+    auto const rho_and_derivatives =
+        gas_phase.property(MaterialPropertyLib::PropertyType::density)
+            .valueAndDerivatives(
+                variable_array,
+                std::array{MaterialPropertyLib::Variable::temperature,
+                           MaterialPropertyLib::Variable::phase_pressure},
+                pos, time, dt);
+    ASSERT_NEAR(density, rho_and_derivatives.value, 1.e-15);
+    ASSERT_NEAR(d_rho_dT, rho_and_derivatives.derivatives[0], 1.e-15);
+    ASSERT_NEAR(d_rho_dp, rho_and_derivatives.derivatives[1], 1.e-15);
 }
@@ -45,6 +45,12 @@ TEST(MaterialPropertyLib, RelPermVanGenuchten)
             permeability.template value<double>(variable_array, pos, t, dt);
         double const dk_rel = permeability.template dValue<double>(
             variable_array, MPL::Variable::liquid_saturation, pos, t, dt);
+        auto const k_rel_and_dk_rel = permeability.valueAndDerivatives(
+            variable_array, std::array{MPL::Variable::liquid_saturation}, pos,
+            t, dt);
+        ASSERT_EQ(k_rel, k_rel_and_dk_rel.value);
+        ASSERT_NEAR(dk_rel, k_rel_and_dk_rel.derivatives[0],
+                    1e-14 * std::abs(dk_rel));
 
         double const eps = 1e-8;
         variable_array[static_cast<int>(MPL::Variable::liquid_saturation)] =
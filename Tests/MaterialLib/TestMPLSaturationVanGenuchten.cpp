@@ -48,6 +48,11 @@ TEST(MaterialPropertyLib, SaturationVanGenuchten)
         double const dS2 = pressure_saturation.template d2Value<double>(
             variable_array, MPL::Variable::capillary_pressure,
             MPL::Variable::capillary_pressure, pos, t, dt);
+        auto const S_and_dS = pressure_saturation.valueAndDerivatives(
+            variable_array, std::array{MPL::Variable::capillary_pressure},
+            pos, t, dt);
+        ASSERT_EQ(S, S_and_dS.value);
+        ASSERT_NEAR(dS, S_and_dS.derivatives[0], 1e-15 * std::abs(dS));
 
         double const eps = 1e-1;
         variable_array[static_cast<int>(MPL::Variable::capillary_pressure)] =
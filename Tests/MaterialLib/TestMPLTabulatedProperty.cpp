@@ -0,0 +1,57 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "MaterialLib/MPL/Properties/SaturationVanGenuchten.h"
+#include "MaterialLib/MPL/Properties/TabulatedProperty.h"
+
+namespace MPL = MaterialPropertyLib;
+
+TEST(MaterialPropertyLib, TabulatedPropertySaturationVanGenuchten)
+{
+    MPL::Property const& saturation =
+        MPL::SaturationVanGenuchten{0.1, 0.05, 0.79, 5000};
+    MPL::Property const& tabulated = MPL::TabulatedProperty{
+        std::make_unique<MPL::SaturationVanGenuchten>(0.1, 0.05, 0.79, 5000),
+        MPL::Variable::capillary_pressure,
+        {{0, 1e5}},
+        1e-6};
+
+    MPL::VariableArray variable_array;
+    ParameterLib::SpatialPosition const pos;
+    double const t = std::numeric_limits<double>::quiet_NaN();
+    double const dt = std::numeric_limits<double>::quiet_NaN();
+
+    double S_previous = std::numeric_limits<double>::max();
+    int const n_steps = 10000;
+    for (int i = 0; i <= n_steps; ++i)
+    {
+        // Covers the grid and beyond its maximum.
+        double const p_cap = i * 2e5 / n_steps;
+        variable_array[static_cast<int>(MPL::Variable::capillary_pressure)] =
+            p_cap;
+
+        double const S = tabulated.value<double>(variable_array, pos, t, dt);
+        double const S_exact =
+            saturation.value<double>(variable_array, pos, t, dt);
+        ASSERT_NEAR(S_exact, S, 1e-6) << "for capillary pressure " << p_cap;
+        ASSERT_LE(S, S_previous) << "for capillary pressure " << p_cap;
+        S_previous = S;
+
+        double const dS = tabulated.dValue<double>(
+            variable_array, MPL::Variable::capillary_pressure, pos, t, dt);
+        double const dS_exact = saturation.dValue<double>(
+            variable_array, MPL::Variable::capillary_pressure, pos, t, dt);
+        ASSERT_LE(dS, 0) << "for capillary pressure " << p_cap;
+        ASSERT_NEAR(dS_exact, dS, 1e-7) << "for capillary pressure " << p_cap;
+    }
+}
@@ -0,0 +1,78 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "MaterialLib/SolidModels/LinearElasticIsotropic.h"
+#include "ParameterLib/ConstantParameter.h"
+
+namespace
+{
+constexpr int Dim = 3;
+using Material = MaterialLib::Solids::LinearElasticIsotropic<Dim>;
+using KelvinVector = Material::KelvinVector;
+using KelvinMatrix = Material::KelvinMatrix;
+using StateArray = std::vector<std::unique_ptr<
+    MaterialLib::Solids::MechanicsBase<Dim>::MaterialStateVariables>>;
+}  // namespace
+
+TEST(MaterialLibSolidModels, IntegrateStressBatchLinearElasticIsotropic)
+{
+    ParameterLib::ConstantParameter<double> const E("E", 1e9);
+    ParameterLib::ConstantParameter<double> const nu("nu", 0.3);
+    Material const material{Material::MaterialProperties{E, nu}};
+
+    std::size_t const n = 4;
+    std::vector<KelvinVector, Eigen::aligned_allocator<KelvinVector>> eps_prev(
+        n),
+        eps(n), sigma_prev(n);
+    StateArray states;
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        eps_prev[ip].setConstant(1e-4 * ip);
+        eps[ip] = eps_prev[ip] + KelvinVector::Constant(1e-3);
+        eps[ip][0] += 1e-3 * ip;
+        sigma_prev[ip].setConstant(1e5 * ip);
+        states.push_back(material.createMaterialStateVariables());
+    }
+
+    ParameterLib::SpatialPosition x;
+    x.setElementID(0);
+    double const t = 0;
+    double const dt = 1;
+    double const T = 293.15;
+
+    // Batched update by the material model.
+    std::vector<KelvinVector, Eigen::aligned_allocator<KelvinVector>> sigma(n);
+    std::vector<KelvinMatrix, Eigen::aligned_allocator<KelvinMatrix>> C(n);
+    ASSERT_TRUE(material.integrateStressBatch(t, x, dt, n, eps_prev.data(),
+                                              eps.data(), sigma_prev.data(),
+                                              states.data(), T, sigma.data(),
+                                              C.data(), nullptr));
+
+    // Default implementation based on the point-wise update.
+    std::vector<KelvinVector, Eigen::aligned_allocator<KelvinVector>>
+        sigma_expected(n);
+    std::vector<KelvinMatrix, Eigen::aligned_allocator<KelvinMatrix>>
+        C_expected(n);
+    ASSERT_TRUE(material.MechanicsBase<Dim>::integrateStressBatch(
+        t, x, dt, n, eps_prev.data(), eps.data(), sigma_prev.data(),
+        states.data(), T, sigma_expected.data(), C_expected.data(),
+        nullptr));
+
+    for (std::size_t ip = 0; ip < n; ++ip)
+    {
+        ASSERT_NE(nullptr, states[ip]);
+        ASSERT_TRUE(sigma_expected[ip].isApprox(sigma[ip]));
+        ASSERT_TRUE(C_expected[ip].isApprox(C[ip]));
+    }
+}
@@ -173,3 +173,35 @@ TEST_F(MaterialLibSolidsKelvinVector6, DeviatoricSphericalProjections)
     // Test sum is identity.
     EXPECT_EQ(P_dev + P_sph, (Eigen::Matrix<double, size, size>::Identity()));
 }
+
+//
+// Deviatoric part is equal to the deviatoric projection.
+//
+
+TEST_F(MaterialLibSolidsKelvinVector4, Deviatoric)
+{
+    auto f = [](KelvinVectorType<2> const& v) {
+        auto const error = (Invariants<size>::deviatoric(v) -
+                            Invariants<size>::deviatoric_projection * v)
+                               .norm();
+        return error <= 1e-14 * v.norm();
+    };
+
+    ac::check<KelvinVectorType<2>>(f, 1000,
+                                   ac::make_arbitrary(kelvinVectorGenerator),
+                                   gtest_reporter);
+}
+
+TEST_F(MaterialLibSolidsKelvinVector6, Deviatoric)
+{
+    auto f = [](KelvinVectorType<3> const& v) {
+        auto const error = (Invariants<size>::deviatoric(v) -
+                            Invariants<size>::deviatoric_projection * v)
+                               .norm();
+        return error <= 1e-14 * v.norm();
+    };
+
+    ac::check<KelvinVectorType<3>>(f, 1000,
+                                   ac::make_arbitrary(kelvinVectorGenerator),
+                                   gtest_reporter);
+}
@@ -0,0 +1,101 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Eigen/IterativeLinearSolvers>
+
+#include "MathLib/LinAlg/Eigen/EigenAMGPreconditioner.h"
+
+namespace
+{
+using Matrix = MathLib::EigenAMGPreconditioner::Matrix;
+
+/// Five point stencil of the Laplacian on an n x n grid with homogeneous
+/// Dirichlet boundary conditions, scaled by \c factor.
+Matrix laplacian2D(int const n, double const factor)
+{
+    std::vector<Eigen::Triplet<double>> triplets;
+    auto const index = [n](int const i, int const j) { return i * n + j; };
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            triplets.emplace_back(index(i, j), index(i, j), 4 * factor);
+            if (i > 0)
+            {
+                triplets.emplace_back(index(i, j), index(i - 1, j), -factor);
+            }
+            if (i < n - 1)
+            {
+                triplets.emplace_back(index(i, j), index(i + 1, j), -factor);
+            }
+            if (j > 0)
+            {
+                triplets.emplace_back(index(i, j), index(i, j - 1), -factor);
+            }
+            if (j < n - 1)
+            {
+                triplets.emplace_back(index(i, j), index(i, j + 1), -factor);
+            }
+        }
+    }
+    Matrix A(n * n, n * n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    return A;
+}
+}  // namespace
+
+TEST(MathLibEigenAMGPreconditioner, Poisson2D)
+{
+    Eigen::ConjugateGradient<Matrix, Eigen::Lower | Eigen::Upper,
+                             MathLib::EigenAMGPreconditioner>
+        solver;
+    solver.setTolerance(1e-10);
+
+    for (int const n : {50, 100})
+    {
+        Matrix const A = laplacian2D(n, 1.0);
+        Eigen::VectorXd const x_expected = Eigen::VectorXd::Random(n * n);
+        Eigen::VectorXd const b = A * x_expected;
+
+        solver.compute(A);
+        ASSERT_EQ(Eigen::Success, solver.info());
+        EXPECT_LT(1u, solver.preconditioner().getNumberOfLevels());
+
+        Eigen::VectorXd const x = solver.solve(b);
+        ASSERT_EQ(Eigen::Success, solver.info());
+        EXPECT_LT((x - x_expected).norm(), 1e-7 * x_expected.norm());
+        // Unpreconditioned CG needs more than n iterations.
+        EXPECT_GT(25, solver.iterations()) << "for n = " << n;
+    }
+}
+
+TEST(MathLibEigenAMGPreconditioner, ReuseForUnchangedStructure)
+{
+    Eigen::BiCGSTAB<Matrix, MathLib::EigenAMGPreconditioner> solver;
+    solver.setTolerance(1e-10);
+
+    int const n = 60;
+    for (double const factor : {1.0, 3.0})
+    {
+        Matrix const A = laplacian2D(n, factor);
+        Eigen::VectorXd const x_expected = Eigen::VectorXd::Ones(n * n);
+        Eigen::VectorXd const b = A * x_expected;
+
+        solver.compute(A);
+        ASSERT_EQ(Eigen::Success, solver.info());
+
+        Eigen::VectorXd const x = solver.solve(b);
+        ASSERT_EQ(Eigen::Success, solver.info());
+        EXPECT_LT((x - x_expected).norm(), 1e-7 * x_expected.norm());
+    }
+}
@@ -0,0 +1,86 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Eigen/IterativeLinearSolvers>
+
+#include "MathLib/LinAlg/Eigen/EigenBlockJacobiPreconditioner.h"
+
+namespace
+{
+using Matrix = MathLib::EigenBlockJacobiPreconditioner::Matrix;
+
+/// Nonsymmetric convection-diffusion stencil on an n x n grid.
+Matrix convectionDiffusion2D(int const n)
+{
+    std::vector<Eigen::Triplet<double>> triplets;
+    auto const index = [n](int const i, int const j) { return i * n + j; };
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            triplets.emplace_back(index(i, j), index(i, j), 4.5);
+            if (i > 0)
+            {
+                triplets.emplace_back(index(i, j), index(i - 1, j), -1.5);
+            }
+            if (i < n - 1)
+            {
+                triplets.emplace_back(index(i, j), index(i + 1, j), -0.5);
+            }
+            if (j > 0)
+            {
+                triplets.emplace_back(index(i, j), index(i, j - 1), -1);
+            }
+            if (j < n - 1)
+            {
+                triplets.emplace_back(index(i, j), index(i, j + 1), -1);
+            }
+        }
+    }
+    Matrix A(n * n, n * n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    return A;
+}
+}  // namespace
+
+TEST(MathLibEigenBlockJacobiPreconditioner, ConvectionDiffusion2D)
+{
+    int const n = 60;
+    Matrix const A = convectionDiffusion2D(n);
+    Eigen::VectorXd const x_expected = Eigen::VectorXd::Random(n * n);
+    Eigen::VectorXd const b = A * x_expected;
+
+    Eigen::BiCGSTAB<Matrix, Eigen::IdentityPreconditioner> unpreconditioned;
+    unpreconditioned.setTolerance(1e-10);
+    unpreconditioned.compute(A);
+    Eigen::VectorXd const x_unpreconditioned = unpreconditioned.solve(b);
+    ASSERT_EQ(Eigen::Success, unpreconditioned.info());
+
+    for (int const number_of_blocks : {1, 4})
+    {
+        Eigen::BiCGSTAB<Matrix, MathLib::EigenBlockJacobiPreconditioner>
+            solver;
+        solver.setTolerance(1e-10);
+        solver.preconditioner().setNumberOfBlocks(number_of_blocks);
+        solver.compute(A);
+        ASSERT_EQ(Eigen::Success, solver.info());
+        EXPECT_EQ(static_cast<std::size_t>(number_of_blocks),
+                  solver.preconditioner().getNumberOfBlocks());
+
+        Eigen::VectorXd const x = solver.solve(b);
+        ASSERT_EQ(Eigen::Success, solver.info());
+        EXPECT_LT((x - x_expected).norm(), 1e-7 * x_expected.norm());
+        EXPECT_LT(solver.iterations(), unpreconditioned.iterations())
+            << "for " << number_of_blocks << " blocks";
+    }
+}
@@ -0,0 +1,137 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+#include "MathLib/LinAlg/Eigen/EigenTools.h"
+#include "MathLib/LinAlg/Eigen/EigenVector.h"
+
+namespace
+{
+using IndexType = MathLib::EigenMatrix::IndexType;
+
+// Tridiagonal matrix with a zero diagonal entry in the last row.
+void assemble(MathLib::EigenMatrix& A, MathLib::EigenVector& b)
+{
+    auto const n = A.getNumberOfRows();
+    for (IndexType i = 0; i < n; ++i)
+    {
+        if (i + 1 < n)
+        {
+            A.setValue(i, i, 2.0 + i);
+        }
+        if (i > 0)
+        {
+            A.setValue(i, i - 1, -1.0 - i);
+        }
+        if (i + 1 < n)
+        {
+            A.setValue(i, i + 1, -0.5 * i);
+        }
+        b.set(i, 1.0 + i);
+    }
+}
+
+// Reference implementation on dense storage.
+void applyKnownSolutionDense(Eigen::MatrixXd& A, Eigen::VectorXd& b,
+                             std::vector<IndexType> const& ids,
+                             std::vector<double> const& values)
+{
+    for (auto const k : ids)
+    {
+        double const diagonal = A(k, k);
+        A.row(k).setZero();
+        A(k, k) = diagonal;
+    }
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+        auto const k = ids[i];
+        for (IndexType j = 0; j < A.rows(); ++j)
+        {
+            if (j != k)
+            {
+                b[j] -= A(j, k) * values[i];
+                A(j, k) = 0.0;
+            }
+        }
+        if (A(k, k) != 0.0)
+        {
+            b[k] = values[i] * A(k, k);
+        }
+        else
+        {
+            b[k] = values[i];
+            A(k, k) = 1.0;
+        }
+    }
+}
+
+void checkApplyKnownSolution(MathLib::EigenMatrix& A,
+                             std::vector<IndexType> const& ids,
+                             std::vector<double> const& values)
+{
+    auto const n = A.getNumberOfRows();
+    MathLib::EigenVector b(n);
+    MathLib::EigenVector x(n);
+    A.setZero();
+    assemble(A, b);
+
+    Eigen::MatrixXd A_dense(A.getRawMatrix());
+    Eigen::VectorXd b_dense = b.getRawVector();
+    applyKnownSolutionDense(A_dense, b_dense, ids, values);
+
+    MathLib::applyKnownSolution(A, b, x, ids, values);
+
+    EXPECT_TRUE(A.getRawMatrix().isCompressed());
+    for (IndexType i = 0; i < n; ++i)
+    {
+        EXPECT_DOUBLE_EQ(b_dense[i], b[i]);
+        for (IndexType j = 0; j < n; ++j)
+        {
+            EXPECT_DOUBLE_EQ(A_dense(i, j), A.get(i, j));
+        }
+    }
+}
+}  // namespace
+
+TEST(MathLibEigenKnownSolutionIndex, EqualsDenseElimination)
+{
+    MathLib::EigenMatrix A(6, 3);
+    std::vector<IndexType> const ids = {0, 3, 5};
+    std::vector<double> const values = {1.5, -2.0, 4.0};
+
+    // The first application inserts the missing diagonal entry and computes
+    // the index, which is reused in the second one.
+    checkApplyKnownSolution(A, ids, values);
+    ASSERT_TRUE(A.getKnownSolutionIndex().isValidFor(A.getRawMatrix(), ids));
+    checkApplyKnownSolution(A, ids, values);
+
+    // Other known solutions invalidate the index.
+    std::vector<IndexType> const other_ids = {2, 3};
+    EXPECT_FALSE(
+        A.getKnownSolutionIndex().isValidFor(A.getRawMatrix(), other_ids));
+    checkApplyKnownSolution(A, other_ids, {0.5, 1.0});
+}
+
+TEST(MathLibEigenKnownSolutionIndex, InvalidForChangedStructure)
+{
+    MathLib::EigenMatrix A(6, 3);
+    std::vector<IndexType> const ids = {1, 4};
+    checkApplyKnownSolution(A, ids, {1.0, 2.0});
+
+    A.setValue(0, 4, 1.0);
+    A.getRawMatrix().makeCompressed();
+    EXPECT_FALSE(A.getKnownSolutionIndex().isValidFor(A.getRawMatrix(), ids));
+    checkApplyKnownSolution(A, ids, {1.0, 2.0});
+}
@@ -0,0 +1,95 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+#include "MathLib/LinAlg/Eigen/EigenMatrixScatterMap.h"
+
+namespace
+{
+// Two overlapping "elements" of a 1d chain with four nodes.
+std::vector<std::vector<MathLib::EigenMatrix::IndexType>> const
+    element_indices = {{0, 1, 2}, {2, 3, 1}};
+
+Eigen::MatrixXd localMatrix(int const seed)
+{
+    Eigen::MatrixXd m(3, 3);
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            m(i, j) = seed + 3 * i + j;
+        }
+    }
+    return m;
+}
+
+void assembleWithAdd(MathLib::EigenMatrix& A)
+{
+    for (std::size_t e = 0; e < element_indices.size(); ++e)
+    {
+        A.add(element_indices[e], localMatrix(10 * e));
+    }
+}
+}  // namespace
+
+TEST(MathLibEigenMatrixScatterMap, AddEqualsEigenMatrixAdd)
+{
+    MathLib::EigenMatrix A(4, 3);
+    assembleWithAdd(A);
+    A.getRawMatrix().makeCompressed();
+
+    MathLib::EigenMatrixScatterMap map;
+    ASSERT_TRUE(map.reset(A, element_indices.size()));
+    ASSERT_TRUE(map.hasSameStructure(A));
+
+    MathLib::EigenMatrix B(A);
+    B.setZero();
+    for (std::size_t e = 0; e < element_indices.size(); ++e)
+    {
+        ASSERT_TRUE(map.computeOffsets(e, element_indices[e]));
+        map.add(B, e, localMatrix(10 * e));
+    }
+
+    ASSERT_TRUE(map.hasSameStructure(B));
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            ASSERT_EQ(A.get(i, j), B.get(i, j));
+        }
+    }
+}
+
+TEST(MathLibEigenMatrixScatterMap, RejectsUncompressedAndMissingEntries)
+{
+    MathLib::EigenMatrix A(4, 3);
+    A.add(element_indices[0], localMatrix(0));
+
+    MathLib::EigenMatrixScatterMap map;
+    // The matrix has been reserved, but is not compressed.
+    ASSERT_FALSE(map.reset(A, element_indices.size()));
+    ASSERT_FALSE(map.isValid());
+
+    A.getRawMatrix().makeCompressed();
+    ASSERT_TRUE(map.reset(A, element_indices.size()));
+    ASSERT_TRUE(map.computeOffsets(0, element_indices[0]));
+    // The entries of the second element are not in the structure.
+    ASSERT_FALSE(map.computeOffsets(1, element_indices[1]));
+
+    MathLib::EigenMatrix B(4, 3);
+    assembleWithAdd(B);
+    B.getRawMatrix().makeCompressed();
+    ASSERT_FALSE(map.hasSameStructure(B));
+}
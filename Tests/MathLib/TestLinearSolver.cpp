@@ -13,6 +13,8 @@
  *
  */
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
 #include "MathLib/LinAlg/LinAlg.h"
@@ -241,6 +243,240 @@ TEST(Math, CheckInterface_Eigen)
 }
 #endif
 
+#ifdef OGS_USE_EIGEN
+TEST(Math, EigenSparseLUReusedForChangingMatrices)
+{
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "SparseLU");
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLinearSolver ls("dummy_name", &conf);
+
+    std::size_t const n = 5;
+    auto const checkSolution = [&](MathLib::EigenMatrix& A) {
+        MathLib::EigenVector x_expected(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            x_expected.set(i, 1.0 + i);
+        }
+        MathLib::EigenVector b(n);
+        MathLib::LinAlg::matMult(A, x_expected, b);
+
+        MathLib::EigenVector x(n);
+        ASSERT_TRUE(ls.solve(A, b, x));
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ASSERT_NEAR(x_expected[i], x[i], 1e-12);
+        }
+    };
+
+    // Tridiagonal matrices with changing values but the same structure.
+    MathLib::EigenMatrix A(n);
+    for (double const scale : {1.0, 2.0, 0.5})
+    {
+        A.setZero();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            A.setValue(i, i, 4.0 * scale + i);
+            if (i > 0)
+            {
+                A.setValue(i, i - 1, -scale);
+                A.setValue(i - 1, i, -1.0);
+            }
+        }
+        MathLib::finalizeMatrixAssembly(A);
+        checkSolution(A);
+    }
+
+    // Additional entries change the structure.
+    A.setValue(0, n - 1, 1.0);
+    A.setValue(n - 1, 0, 2.0);
+    MathLib::finalizeMatrixAssembly(A);
+    checkSolution(A);
+
+    // The structure of another matrix differs, too.
+    MathLib::EigenMatrix B(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        B.setValue(i, i, 1.0 + i);
+    }
+    MathLib::finalizeMatrixAssembly(B);
+    checkSolution(B);
+}
+#endif
+
+#ifdef OGS_USE_EIGEN
+TEST(Math, EigenSparseLUReusedForUnchangedMatrices)
+{
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "SparseLU");
+    t_solver.put("reuse_setup_for_unchanged_matrix", true);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLinearSolver ls("dummy_name", &conf);
+
+    std::size_t const n = 5;
+    auto const assemble = [&](MathLib::EigenMatrix& A, double const scale) {
+        A.setZero();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            A.setValue(i, i, 4.0 * scale + i);
+            if (i > 0)
+            {
+                A.setValue(i, i - 1, -scale);
+                A.setValue(i - 1, i, -1.0);
+            }
+        }
+        MathLib::finalizeMatrixAssembly(A);
+    };
+    auto const checkSolution = [&](MathLib::EigenMatrix& A,
+                                   double const offset) {
+        MathLib::EigenVector x_expected(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            x_expected.set(i, offset + i);
+        }
+        MathLib::EigenVector b(n);
+        MathLib::LinAlg::matMult(A, x_expected, b);
+
+        MathLib::EigenVector x(n);
+        ASSERT_TRUE(ls.solve(A, b, x));
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ASSERT_NEAR(x_expected[i], x[i], 1e-12);
+        }
+    };
+
+    // The same matrix assembled again with different right-hand sides, then
+    // changed values, and another matrix with the same values.
+    MathLib::EigenMatrix A(n);
+    for (double const scale : {1.0, 1.0, 2.0, 2.0, 1.0})
+    {
+        assemble(A, scale);
+        checkSolution(A, scale);
+        checkSolution(A, -scale);
+    }
+    MathLib::EigenMatrix B(n);
+    assemble(B, 1.0);
+    checkSolution(B, 3.0);
+    checkSolution(A, 1.0);
+}
+#endif
+
+#ifdef OGS_USE_EIGEN
+TEST(Math, EigenMixedPrecisionLU)
+{
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "MixedPrecisionLU");
+    t_solver.put("error_tolerance", 1e-14);
+    t_solver.put("max_iteration_step", 20);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLinearSolver ls("dummy_name", &conf);
+
+    // A diagonally dominant tridiagonal matrix with entries, which are not
+    // representable in single precision.
+    std::size_t const n = 50;
+    MathLib::EigenMatrix A(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        A.setValue(i, i, 4.0 + 1.0 / 3.0);
+        if (i > 0)
+        {
+            A.setValue(i, i - 1, -1.0 / 7.0);
+            A.setValue(i - 1, i, -1.0 - 1.0 / 11.0);
+        }
+    }
+    MathLib::finalizeMatrixAssembly(A);
+
+    MathLib::EigenVector x_expected(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x_expected.set(i, std::sin(0.1 * i));
+    }
+    MathLib::EigenVector b(n);
+    MathLib::LinAlg::matMult(A, x_expected, b);
+
+    MathLib::EigenVector x(n);
+    ASSERT_TRUE(ls.solve(A, b, x));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        // Far more accurate than a single precision solution.
+        ASSERT_NEAR(x_expected[i], x[i], 1e-13);
+    }
+
+    // An unreachable tolerance is reported as failure.
+    ls.setRelativeTolerance(1e-30);
+    EXPECT_FALSE(ls.solve(A, b, x));
+}
+#endif
+
+#ifdef OGS_USE_EIGEN
+TEST(Math, EigenAutoTuning)
+{
+    // The configured CG with two iterations fails and SparseLU is selected.
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "CG");
+    t_solver.put("precon_type", "NONE");
+    t_solver.put("error_tolerance", 1e-12);
+    t_solver.put("max_iteration_step", 2);
+    boost::property_tree::ptree t_auto_tune;
+    t_auto_tune.put("number_of_solves", 3);
+    boost::property_tree::ptree t_candidate;
+    t_candidate.put("solver_type", "SparseLU");
+    t_auto_tune.add_child("candidate", t_candidate);
+    t_solver.put_child("auto_tune", t_auto_tune);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLinearSolver ls("dummy_name", &conf);
+
+    std::size_t const n = 50;
+    MathLib::EigenMatrix A(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        A.setValue(i, i, 4.0 + i);
+        if (i > 0)
+        {
+            A.setValue(i, i - 1, -1.0);
+            A.setValue(i - 1, i, -1.0);
+        }
+    }
+    MathLib::finalizeMatrixAssembly(A);
+
+    MathLib::EigenVector x_expected(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x_expected.set(i, std::sin(0.1 * i));
+    }
+    MathLib::EigenVector b(n);
+    MathLib::LinAlg::matMult(A, x_expected, b);
+
+    // The solves of the auto-tuning and the subsequent ones succeed.
+    for (int solve = 0; solve < 5; ++solve)
+    {
+        if (solve == 3)
+        {
+            EXPECT_EQ(MathLib::EigenOption::SolverType::SparseLU,
+                      ls.getOption().solver_type);
+        }
+        MathLib::EigenVector x(n);
+        ASSERT_TRUE(ls.solve(A, b, x));
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ASSERT_NEAR(x_expected[i], x[i], 1e-12);
+        }
+    }
+}
+#endif
+
 #if defined(OGS_USE_EIGEN) && defined(USE_LIS)
 TEST(Math, CheckInterface_EigenLis)
 {
@@ -12,6 +12,7 @@
  */
 
 // stl
+#include <cmath>
 #include <limits>
 
 // google test
@@ -166,3 +167,51 @@ TEST(MathLibInterpolationAlgorithms, PiecewiseLinearInterpolationDerivative)
     ASSERT_NEAR(0, interpolation.getDerivative(1001),
                 std::numeric_limits<double>::epsilon());
 }
+
+// The uniformly spaced supporting points are found directly. The result must
+// be the same as for the search among the supporting points, also for points
+// at and close to the supporting points.
+TEST(MathLibInterpolationAlgorithms,
+     PiecewiseLinearInterpolationUniformSpacing)
+{
+    const std::size_t size(101);
+    std::vector<double> supp_pnts;
+    std::vector<double> values;
+    for (std::size_t k(0); k < size; ++k)
+    {
+        supp_pnts.push_back(0.1 * k - 3.);
+        values.push_back(std::sin(0.3 * k));
+    }
+    // Same points, but the last one is moved, which disables the direct index
+    // computation while keeping the other intervals unchanged.
+    std::vector<double> supp_pnts_non_uniform = supp_pnts;
+    std::vector<double> values_non_uniform = values;
+    supp_pnts_non_uniform.push_back(supp_pnts.back() + 10.);
+    values_non_uniform.push_back(values.back());
+
+    MathLib::PiecewiseLinearInterpolation const uniform{
+        std::vector<double>(supp_pnts), std::move(values)};
+    MathLib::PiecewiseLinearInterpolation const non_uniform{
+        std::move(supp_pnts_non_uniform), std::move(values_non_uniform)};
+
+    for (auto const x : supp_pnts)
+    {
+        for (auto const dx : {-1e-14, 0., 1e-14, 0.03, 0.05})
+        {
+            if (x + dx > supp_pnts.back())
+            {
+                continue;
+            }
+            ASSERT_EQ(non_uniform.getValue(x + dx), uniform.getValue(x + dx))
+                << "at x = " << x + dx;
+            // The derivative uses the neighbouring intervals, which differ
+            // close to the moved point.
+            if (x + dx < supp_pnts[size - 4])
+            {
+                ASSERT_EQ(non_uniform.getDerivative(x + dx),
+                          uniform.getDerivative(x + dx))
+                    << "at x = " << x + dx;
+            }
+        }
+    }
+}
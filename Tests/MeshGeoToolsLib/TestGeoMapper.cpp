@@ -12,6 +12,7 @@
 
 #include "GeoLib/GEOObjects.h"
 #include "GeoLib/Point.h"
+#include "GeoLib/Polyline.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshGenerators/MeshGenerator.h"
 #include "MeshGeoToolsLib/GeoMapper.h"
@@ -85,3 +86,50 @@ TEST_F(MeshGeoToolsLibGeoMapper, PointsOnSurfaceMesh)
         gtest_reporter);
 }
 
+
+// The test maps two polylines sharing a point on the surface mesh. The
+// polylines are refined at the intersections with the element edges and all
+// their points have to be located on the surface.
+TEST_F(MeshGeoToolsLibGeoMapper, PolylinesOnSurfaceMesh)
+{
+    GeoLib::GEOObjects geo_obj;
+    std::string geo_name("TestGeoMapperPolylines");
+    auto points = std::make_unique<std::vector<GeoLib::Point*>>();
+    points->push_back(new GeoLib::Point(0.05, 0.1, 5.0, 0));
+    points->push_back(new GeoLib::Point(0.53, 0.47, -3.0, 1));
+    points->push_back(new GeoLib::Point(0.91, 0.87, 2.0, 2));
+    points->push_back(new GeoLib::Point(0.12, 0.93, 0.0, 3));
+    geo_obj.addPointVec(std::move(points), geo_name);
+
+    auto plys = std::make_unique<std::vector<GeoLib::Polyline*>>();
+    auto const& pnt_vec = *geo_obj.getPointVec(geo_name);
+    plys->push_back(new GeoLib::Polyline(pnt_vec));
+    plys->back()->addPoint(0);
+    plys->back()->addPoint(1);
+    plys->back()->addPoint(2);
+    plys->push_back(new GeoLib::Polyline(pnt_vec));
+    plys->back()->addPoint(3);
+    plys->back()->addPoint(1);
+    geo_obj.addPolylineVec(std::move(plys), geo_name);
+
+    MeshGeoToolsLib::GeoMapper geo_mapper(geo_obj, geo_name);
+    geo_mapper.advancedMapOnMesh(*_surface_mesh);
+
+    auto const& mapped_plys = *geo_obj.getPolylineVec(geo_name);
+    ASSERT_EQ(2u, mapped_plys.size());
+    EXPECT_LT(3u, mapped_plys[0]->getNumberOfPoints());
+    EXPECT_LT(2u, mapped_plys[1]->getNumberOfPoints());
+    double const eps(0.01);
+    for (auto const* ply : mapped_plys)
+    {
+        for (std::size_t k = 0; k < ply->getNumberOfPoints(); ++k)
+        {
+            GeoLib::Point const& p(*ply->getPoint(k));
+            EXPECT_NEAR(std::cos(p[0] + p[1]), p[2], eps);
+        }
+    }
+    // the shared point is kept in both polylines
+    EXPECT_TRUE(mapped_plys[0]->isPointIDInPolyline(1));
+    EXPECT_EQ(1u, mapped_plys[1]->getPointID(
+                      mapped_plys[1]->getNumberOfPoints() - 1));
+}
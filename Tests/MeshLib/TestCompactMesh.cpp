@@ -0,0 +1,97 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+#include "MeshLib/CompactMesh.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+// Uses the same interface of Element and CompactMesh::ElementView.
+template <typename ElementType>
+std::array<double, 3> centroid(ElementType const& element)
+{
+    std::array<double, 3> c{{0, 0, 0}};
+    for (unsigned i = 0; i < element.getNumberOfNodes(); ++i)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            c[k] += (*element.getNode(i))[k] / element.getNumberOfNodes();
+        }
+    }
+    return c;
+}
+}  // namespace
+
+class MeshLibCompactMesh : public ::testing::Test
+{
+public:
+    MeshLibCompactMesh()
+        : mesh(MeshLib::MeshGenerator::generateRegularPrismMesh(1.0, 2.0, 3.0,
+                                                                3, 4, 5)),
+          compact_mesh(*mesh)
+    {
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh;
+    MeshLib::CompactMesh compact_mesh;
+};
+
+TEST_F(MeshLibCompactMesh, SameNodesAndElements)
+{
+    ASSERT_EQ(mesh->getNumberOfNodes(), compact_mesh.getNumberOfNodes());
+    for (auto const node : compact_mesh.getNodes())
+    {
+        auto const& original = *mesh->getNode(node.getID());
+        for (int k = 0; k < 3; ++k)
+        {
+            ASSERT_EQ(original[k], node[k]);
+        }
+    }
+
+    ASSERT_EQ(mesh->getNumberOfElements(), compact_mesh.getNumberOfElements());
+    for (auto const element : compact_mesh.getElements())
+    {
+        auto const& original = *mesh->getElement(element.getID());
+        ASSERT_EQ(original.getCellType(), element.getCellType());
+        ASSERT_EQ(original.getNumberOfNodes(), element.getNumberOfNodes());
+        for (unsigned i = 0; i < original.getNumberOfNodes(); ++i)
+        {
+            ASSERT_EQ(original.getNodeIndex(i), element.getNodeIndex(i));
+        }
+        ASSERT_EQ(centroid(original), centroid(element));
+    }
+}
+
+TEST_F(MeshLibCompactMesh, NodeToElementConnectivity)
+{
+    for (auto const node : compact_mesh.getNodes())
+    {
+        std::vector<std::size_t> expected;
+        for (auto const* element : mesh->getNode(node.getID())->getElements())
+        {
+            expected.push_back(element->getID());
+        }
+        std::sort(expected.begin(), expected.end());
+
+        auto const element_ids = node.getElementIDs();
+        ASSERT_EQ(expected,
+                  std::vector<std::size_t>(element_ids.begin(),
+                                           element_ids.end()));
+    }
+}
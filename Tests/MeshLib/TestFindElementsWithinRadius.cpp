@@ -32,6 +32,7 @@ TEST_F(MeshLibFindElementWithinRadius, ZeroRadius)
 {
     auto mesh =
         std::unique_ptr<Mesh>(MeshGenerator::generateRegularQuadMesh(10., 10));
+    mesh->computeElementNeighbors();
 
     auto same_element_returned = [&mesh](std::size_t& element_id) -> bool {
         auto result =
@@ -134,6 +135,7 @@ TEST_F(MeshLibFindElementWithinRadius, VerySmallRadius)
 {
     auto mesh =
         std::unique_ptr<Mesh>(MeshGenerator::generateRegularQuadMesh(10., 10));
+    mesh->computeElementNeighbors();
 
     auto neighboring_elements_returned =
         [&mesh](std::size_t& element_id) -> bool {
@@ -160,6 +162,7 @@ TEST_F(MeshLibFindElementWithinRadius, VeryLargeRadius)
 {
     auto mesh =
         std::unique_ptr<Mesh>(MeshGenerator::generateRegularQuadMesh(10., 10));
+    mesh->computeElementNeighbors();
 
     auto all_elements_returned = [&mesh](std::size_t& element_id) -> bool {
         auto result =
@@ -201,6 +204,7 @@ TEST_F(MeshLibFindElementWithinRadius, RandomPositiveRadius2d)
 {
     auto mesh =
         std::unique_ptr<Mesh>(MeshGenerator::generateRegularQuadMesh(10., 10));
+    mesh->computeElementNeighbors();
 
     auto const compare_to_brute_force_search = CompareToBruteForceSearch{*mesh};
 
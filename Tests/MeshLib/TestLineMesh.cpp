@@ -19,6 +19,7 @@ class MeshLibLineMesh : public ::testing::Test
     MeshLibLineMesh()
     {
         mesh = MeshLib::MeshGenerator::generateLineMesh(extent, mesh_size);
+        mesh->computeElementNeighbors();
     }
 
     ~MeshLibLineMesh() override { delete mesh; }
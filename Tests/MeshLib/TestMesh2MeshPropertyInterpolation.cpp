@@ -0,0 +1,73 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "MathLib/Point3d.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/Mesh2MeshPropertyInterpolation.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+TEST(MeshLibMesh2MeshPropertyInterpolation, SeveralPropertiesInOnePass)
+{
+    std::unique_ptr<MeshLib::Mesh> const src_mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 20));
+    std::unique_ptr<MeshLib::Mesh> dest_mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(
+            0.8, 4, MathLib::Point3d(std::array<double, 3>{{0.1, 0.1, 0}})));
+
+    auto* const constant =
+        src_mesh->getProperties().createNewPropertyVector<double>(
+            "constant", MeshLib::MeshItemType::Cell, 1);
+    auto* const left_right =
+        src_mesh->getProperties().createNewPropertyVector<double>(
+            "left_right", MeshLib::MeshItemType::Cell, 1);
+    for (auto const* element : src_mesh->getElements())
+    {
+        constant->push_back(3.0);
+        left_right->push_back((*element->getNode(0))[0] < 0.5 ? -1.0 : 1.0);
+    }
+
+    MeshLib::Mesh2MeshPropertyInterpolation const interpolation(
+        *src_mesh, std::vector<std::string>{"constant", "left_right"});
+    ASSERT_TRUE(interpolation.setPropertiesForMesh(*dest_mesh));
+
+    auto const& dest_constant =
+        *dest_mesh->getProperties().getPropertyVector<double>("constant");
+    auto const& dest_left_right =
+        *dest_mesh->getProperties().getPropertyVector<double>("left_right");
+    ASSERT_EQ(dest_mesh->getNumberOfElements(), dest_constant.size());
+    ASSERT_EQ(dest_mesh->getNumberOfElements(), dest_left_right.size());
+
+    for (auto const* element : dest_mesh->getElements())
+    {
+        auto const id = element->getID();
+        EXPECT_DOUBLE_EQ(3.0, dest_constant[id]);
+
+        // The destination elements away from the middle of the mesh get the
+        // value of their side.
+        double const x = (*element->getNode(0))[0];
+        if (x + 0.2 < 0.45)
+        {
+            EXPECT_DOUBLE_EQ(-1.0, dest_left_right[id]);
+        }
+        else if (x > 0.55)
+        {
+            EXPECT_DOUBLE_EQ(1.0, dest_left_right[id]);
+        }
+    }
+}
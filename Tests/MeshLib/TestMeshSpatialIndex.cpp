@@ -0,0 +1,69 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSearch/MeshSpatialIndex.h"
+#include "MeshLib/Node.h"
+
+TEST(MeshLibMeshSpatialIndex, SharedPerMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh_a(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 10));
+    std::unique_ptr<MeshLib::Mesh> const mesh_b(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 10));
+
+    auto const& index_a =
+        MeshLib::MeshSpatialIndex::getMeshSpatialIndex(*mesh_a);
+    ASSERT_EQ(&index_a,
+              &MeshLib::MeshSpatialIndex::getMeshSpatialIndex(*mesh_a));
+    ASSERT_EQ(mesh_a.get(), &index_a.getMesh());
+
+    auto const& index_b =
+        MeshLib::MeshSpatialIndex::getMeshSpatialIndex(*mesh_b);
+    ASSERT_NE(&index_a, &index_b);
+    ASSERT_EQ(mesh_b.get(), &index_b.getMesh());
+
+    // The element grid is built once.
+    ASSERT_EQ(&index_a.getElementGrid(), &index_a.getElementGrid());
+}
+
+TEST(MeshLibMeshSpatialIndex, NodeIDsInCuboid)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 20));
+    auto const& index = MeshLib::MeshSpatialIndex::getMeshSpatialIndex(*mesh);
+
+    MathLib::Point3d const min(std::array<double, 3>{{0.2, 0.3, 0.4}});
+    MathLib::Point3d const max(std::array<double, 3>{{0.5, 0.35, 0.9}});
+    auto const ids = index.getNodeIDsInCuboid(min, max);
+
+    ASSERT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+    ASSERT_TRUE(std::adjacent_find(ids.begin(), ids.end()) == ids.end());
+
+    // All nodes within the cuboid are candidates.
+    for (auto const* node : mesh->getNodes())
+    {
+        bool const inside = (*node)[0] >= min[0] && (*node)[0] <= max[0] &&
+                            (*node)[1] >= min[1] && (*node)[1] <= max[1] &&
+                            (*node)[2] >= min[2] && (*node)[2] <= max[2];
+        if (inside)
+        {
+            ASSERT_TRUE(
+                std::binary_search(ids.begin(), ids.end(), node->getID()));
+        }
+    }
+}
@@ -9,6 +9,7 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "MeshLib/Elements/Element.h"
@@ -24,6 +25,7 @@ TEST(MeshLib, CreateNodeAdjacencyTable1D)
     std::unique_ptr<Mesh> mesh(
         MeshGenerator::generateLineMesh(double(1), std::size_t(10)));
 
+    mesh->computeNodesConnectedByElements();
     NodeAdjacencyTable table(mesh->getNodes());
 
     // There must be as many entries as there are nodes in the mesh.
@@ -60,6 +62,7 @@ TEST(MeshLib, CreateNodeAdjacencyTable2D)
     std::unique_ptr<Mesh> mesh(MeshGenerator::generateRegularQuadMesh(
         1, 1, std::size_t(10), std::size_t(10)));
 
+    mesh->computeNodesConnectedByElements();
     NodeAdjacencyTable table(mesh->getNodes());
 
     // There must be as many entries as there are nodes in the mesh.
@@ -98,6 +101,7 @@ TEST(MeshLib, CreateNodeAdjacencyTable3D)
                 1, 1, 1, 10.0, 10.0, 10.0));
         //double(1), double(1), double(1), std::size_t(10), std::size_t(10), std::size_t(10)));
 
+    mesh->computeNodesConnectedByElements();
     NodeAdjacencyTable table(mesh->getNodes());
 
     // There must be as many entries as there are nodes in the mesh.
@@ -130,3 +134,30 @@ TEST(MeshLib, CreateNodeAdjacencyTable3D)
         }
     }
 }
+
+TEST(MeshLib, NodeAdjacencyTableFromElements)
+{
+    using namespace MeshLib;
+
+    std::unique_ptr<Mesh> mesh(MeshGenerator::generateRegularPrismMesh(
+        3.0, 2.0, 1.0, std::size_t(3), std::size_t(2), std::size_t(1)));
+
+    mesh->computeNodesConnectedByElements();
+    NodeAdjacencyTable const table(mesh->getNodes());
+    auto const& shared_table = mesh->getNodeAdjacencyTable();
+
+    // The table of the mesh is computed from the elements directly and is
+    // equal to the one from the connected nodes.
+    ASSERT_EQ(table.size(), shared_table.size());
+    ASSERT_EQ(&shared_table, &mesh->getNodeAdjacencyTable());
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+        auto const expected = table.getAdjacentNodes(i);
+        auto const actual = shared_table.getAdjacentNodes(i);
+        ASSERT_EQ(table.getNodeDegree(i), shared_table.getNodeDegree(i));
+        EXPECT_TRUE(
+            std::equal(expected.begin(), expected.end(), actual.begin()))
+            << " for node " << i;
+        EXPECT_TRUE(std::is_sorted(actual.begin(), actual.end()));
+    }
+}
@@ -20,6 +20,7 @@ class MeshLibQuadMesh : public ::testing::Test
     MeshLibQuadMesh()
     {
         mesh = MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, n_elements);
+        mesh->computeElementNeighbors();
     }
 
     ~MeshLibQuadMesh() override { delete mesh; }
@@ -28,6 +28,7 @@ TEST(MeshLib, QuadraticOrderMesh_Line)
     std::unique_ptr<Mesh> linear_mesh(MeshGenerator::generateLineMesh(
         1, std::size_t(2)));
     std::unique_ptr<Mesh> mesh(createQuadraticOrderMesh(*linear_mesh));
+    mesh->computeNodesConnectedByElements();
     ASSERT_EQ(5u, mesh->getNumberOfNodes());
     ASSERT_EQ(3u, mesh->getNumberOfBaseNodes());
     ASSERT_EQ(2u, mesh->getNumberOfElements());
@@ -71,6 +72,7 @@ TEST(MeshLib, QuadraticOrderMesh_Quad)
     std::unique_ptr<Mesh> linear_mesh(MeshGenerator::generateRegularQuadMesh(
         1, 1, std::size_t(2), std::size_t(2)));
     std::unique_ptr<Mesh> mesh(createQuadraticOrderMesh(*linear_mesh));
+    mesh->computeNodesConnectedByElements();
     ASSERT_EQ(21u, mesh->getNumberOfNodes());
     ASSERT_EQ(9u, mesh->getNumberOfBaseNodes());
     ASSERT_EQ(4u, mesh->getNumberOfElements());
@@ -149,6 +151,7 @@ TEST(MeshLib, QuadraticOrderMesh_LineQuad)
     ASSERT_EQ(6u, linear_mesh->getNumberOfElements());
 
     std::unique_ptr<Mesh> mesh(createQuadraticOrderMesh(*linear_mesh));
+    mesh->computeNodesConnectedByElements();
     ASSERT_EQ(21u, mesh->getNumberOfNodes());
     ASSERT_EQ(9u, mesh->getNumberOfBaseNodes());
     ASSERT_EQ(6u, mesh->getNumberOfElements());
@@ -213,3 +216,33 @@ TEST(MeshLib, QuadraticOrderMesh_LineQuad)
                                           (n->getConnectedNodes().size() == 13);
                                }));
 }
+
+TEST(MeshLib, QuadraticOrderMesh_Hex)
+{
+    using namespace MeshLib;
+
+    std::unique_ptr<Mesh> linear_mesh(
+        MeshGenerator::generateRegularHexMesh(1, std::size_t(2)));
+    std::unique_ptr<Mesh> mesh(createQuadraticOrderMesh(*linear_mesh));
+    // 27 base nodes and one middle node for each of the 54 edges.
+    ASSERT_EQ(81u, mesh->getNumberOfNodes());
+    ASSERT_EQ(27u, mesh->getNumberOfBaseNodes());
+    ASSERT_EQ(8u, mesh->getNumberOfElements());
+
+    for (MeshLib::Element const* e : mesh->getElements())
+    {
+        ASSERT_EQ(MeshLib::CellType::HEX20, e->getCellType());
+        auto const n_base_nodes = e->getNumberOfBaseNodes();
+        for (unsigned i = 0; i < e->getNumberOfEdges(); i++)
+        {
+            auto const& a = *e->getEdgeNode(i, 0);
+            auto const& b = *e->getEdgeNode(i, 1);
+            auto const& middle = *e->getNode(n_base_nodes + i);
+            ASSERT_FALSE(mesh->isBaseNode(middle.getID()));
+            for (int d = 0; d < 3; d++)
+            {
+                ASSERT_DOUBLE_EQ((a[d] + b[d]) / 2, middle[d]);
+            }
+        }
+    }
+}
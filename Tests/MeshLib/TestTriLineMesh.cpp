@@ -42,6 +42,7 @@ class MeshLibTriLineMesh : public ::testing::Test
         elements.push_back(new MeshLib::Line(l_nodes));
 
         mesh = new MeshLib::Mesh("M", nodes, elements);
+        mesh->computeElementNeighbors();
     }
 
     ~MeshLibTriLineMesh() override
@@ -0,0 +1,142 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridReader.h>
+
+#include "InfoLib/TestInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/IO/VtkIO/VtuRawReader.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/VtkMeshConverter.h"
+#include "MeshLib/Node.h"
+
+class VtuRawReader : public ::testing::Test
+{
+public:
+    VtuRawReader()
+        : mesh(MeshLib::MeshGenerator::generateRegularPrismMesh(1.0, 2.0, 3.0,
+                                                                3, 4, 5))
+    {
+        auto* const node_values =
+            mesh->getProperties().createNewPropertyVector<double>(
+                "NodeValues", MeshLib::MeshItemType::Node, 3);
+        node_values->resize(3 * mesh->getNumberOfNodes());
+        std::iota(node_values->begin(), node_values->end(), 0.5);
+
+        auto* const material_ids =
+            mesh->getProperties().createNewPropertyVector<int>(
+                "MaterialIDs", MeshLib::MeshItemType::Cell);
+        material_ids->resize(mesh->getNumberOfElements());
+        std::iota(material_ids->begin(), material_ids->end(), 0);
+
+        auto* const ip_values =
+            mesh->getProperties().createNewPropertyVector<double>(
+                "IntegrationPointValues",
+                MeshLib::MeshItemType::IntegrationPoint);
+        ip_values->resize(2 * mesh->getNumberOfElements());
+        std::iota(ip_values->begin(), ip_values->end(), 1.0);
+    }
+
+    std::string writeMesh(bool const compressed) const
+    {
+        std::string const file_name =
+            TestInfoLib::TestInfo::tests_tmp_path + "VtuRawReader.vtu";
+        MeshLib::IO::VtuInterface writer(mesh.get(), vtkXMLWriter::Appended,
+                                         compressed);
+        EXPECT_TRUE(writer.writeToFile(file_name));
+        return file_name;
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh;
+};
+
+namespace
+{
+void checkSameMeshAsVtkReader(std::string const& file_name)
+{
+    std::unique_ptr<MeshLib::Mesh> raw_mesh(
+        MeshLib::IO::readAppendedRawVtuFile(file_name, "raw"));
+    ASSERT_TRUE(raw_mesh != nullptr);
+
+    auto reader = vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
+    reader->SetFileName(file_name.c_str());
+    reader->Update();
+    std::unique_ptr<MeshLib::Mesh> vtk_mesh(
+        MeshLib::VtkMeshConverter::convertUnstructuredGrid(reader->GetOutput(),
+                                                           "vtk"));
+    ASSERT_TRUE(vtk_mesh != nullptr);
+
+    ASSERT_EQ(vtk_mesh->getNumberOfNodes(), raw_mesh->getNumberOfNodes());
+    for (std::size_t i = 0; i < vtk_mesh->getNumberOfNodes(); ++i)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            ASSERT_EQ((*vtk_mesh->getNode(i))[k], (*raw_mesh->getNode(i))[k]);
+        }
+    }
+
+    ASSERT_EQ(vtk_mesh->getNumberOfElements(), raw_mesh->getNumberOfElements());
+    for (std::size_t i = 0; i < vtk_mesh->getNumberOfElements(); ++i)
+    {
+        auto const& vtk_element = *vtk_mesh->getElement(i);
+        auto const& raw_element = *raw_mesh->getElement(i);
+        ASSERT_EQ(vtk_element.getCellType(), raw_element.getCellType());
+        for (unsigned k = 0; k < vtk_element.getNumberOfNodes(); ++k)
+        {
+            ASSERT_EQ(vtk_element.getNodeIndex(k), raw_element.getNodeIndex(k));
+        }
+    }
+
+    auto const& vtk_properties = vtk_mesh->getProperties();
+    auto const& raw_properties = raw_mesh->getProperties();
+    ASSERT_EQ(vtk_properties.getPropertyVectorNames(),
+              raw_properties.getPropertyVectorNames());
+
+    auto const& node_values =
+        *raw_properties.getPropertyVector<double>("NodeValues");
+    ASSERT_EQ(MeshLib::MeshItemType::Node, node_values.getMeshItemType());
+    ASSERT_EQ(3, node_values.getNumberOfComponents());
+    ASSERT_EQ(*vtk_properties.getPropertyVector<double>("NodeValues"),
+              node_values);
+
+    auto const& material_ids =
+        *raw_properties.getPropertyVector<int>("MaterialIDs");
+    ASSERT_EQ(MeshLib::MeshItemType::Cell, material_ids.getMeshItemType());
+    ASSERT_EQ(*vtk_properties.getPropertyVector<int>("MaterialIDs"),
+              material_ids);
+
+    auto const& ip_values =
+        *raw_properties.getPropertyVector<double>("IntegrationPointValues");
+    ASSERT_EQ(MeshLib::MeshItemType::IntegrationPoint,
+              ip_values.getMeshItemType());
+    ASSERT_EQ(
+        *vtk_properties.getPropertyVector<double>("IntegrationPointValues"),
+        ip_values);
+}
+}  // namespace
+
+TEST_F(VtuRawReader, SameMeshAsVtkReader)
+{
+    checkSameMeshAsVtkReader(writeMesh(false));
+}
+
+TEST_F(VtuRawReader, CompressedSameMeshAsVtkReader)
+{
+    checkSameMeshAsVtkReader(writeMesh(true));
+}
@@ -0,0 +1,90 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifdef OGS_USE_XDMF
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "InfoLib/TestInfo.h"
+#include "MeshLib/IO/XDMF/XdmfHdfWriter.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+
+namespace
+{
+std::string readFile(std::string const& file_name)
+{
+    std::ifstream is(file_name);
+    std::stringstream ss;
+    ss << is.rdbuf();
+    return ss.str();
+}
+
+std::size_t count(std::string const& text, std::string const& pattern)
+{
+    std::size_t n = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos;
+         pos = text.find(pattern, pos + pattern.size()))
+    {
+        ++n;
+    }
+    return n;
+}
+}  // namespace
+
+TEST(MeshLibXdmfHdfWriter, AppendsTimesteps)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 2u));
+    auto* const pressure =
+        mesh->getProperties().createNewPropertyVector<double>(
+            "pressure", MeshLib::MeshItemType::Node, 1);
+    pressure->resize(mesh->getNumberOfNodes(), 1.0);
+    auto* const material_ids =
+        mesh->getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    material_ids->resize(mesh->getNumberOfElements(), 0);
+
+    std::string const file_base =
+        TestInfoLib::TestInfo::tests_tmp_path + "XdmfHdfWriterTest";
+    {
+        MeshLib::IO::XdmfHdfWriter writer(*mesh, file_base, true);
+
+        // The XDMF file is complete before and after each step.
+        auto const empty = readFile(file_base + ".xdmf");
+        EXPECT_EQ(1u, count(empty, "</Xdmf>"));
+        EXPECT_EQ(0u, count(empty, "<Time "));
+
+        writer.writeStep(0.0);
+        (*pressure)[0] = 2.0;
+        writer.writeStep(0.5);
+    }
+
+    auto const xdmf = readFile(file_base + ".xdmf");
+    EXPECT_EQ(1u, count(xdmf, "</Xdmf>"));
+    EXPECT_EQ(2u, count(xdmf, "<Time "));
+    EXPECT_EQ(1u, count(xdmf, "<Time Value=\"0.5\"/>"));
+    // The geometry and topology datasets are shared by all timesteps.
+    EXPECT_EQ(2u, count(xdmf, "XdmfHdfWriterTest.h5:/geometry<"));
+    EXPECT_EQ(2u, count(xdmf, "XdmfHdfWriterTest.h5:/topology<"));
+    EXPECT_EQ(1u, count(xdmf, "XdmfHdfWriterTest.h5:/t_1/pressure<"));
+    EXPECT_EQ(1u, count(xdmf, "XdmfHdfWriterTest.h5:/t_1/MaterialIDs<"));
+    EXPECT_EQ(2u, count(xdmf, "NumberOfElements=\"4\""));
+
+    std::remove((file_base + ".xdmf").c_str());
+    std::remove((file_base + ".h5").c_str());
+}
+
+#endif  // OGS_USE_XDMF
@@ -12,6 +12,7 @@
 
 #include <gtest/gtest.h>
 
+#include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "MeshLib/MeshGenerators/MeshGenerator.h"
 
@@ -150,6 +151,38 @@ TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_MultipleVariablesMultipleCompon
     ASSERT_EQ(20, dof_map->getGlobalIndex(l_node0, 1, 1));
 }
 
+#ifndef USE_PETSC
+TEST_F(NumLibLocalToGlobalIndexMapTest, GlobalIndicesOfVariablesByLocation)
+#else
+TEST_F(NumLibLocalToGlobalIndexMapTest,
+       DISABLED_GlobalIndicesOfVariablesByLocation)
+#endif
+{
+    // 1st variable with 1 component, 2nd variable with 2 components.
+    components.emplace_back(*nodesSubset);
+
+    std::vector<int> vec_var_n_components{1, 2};
+
+    dof_map = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+        std::move(components),
+        vec_var_n_components,
+        NumLib::ComponentOrder::BY_LOCATION);
+
+    auto const indices_0 = NumLib::getNonGhostGlobalIndices(*dof_map, 0);
+    auto const indices_1 = NumLib::getNonGhostGlobalIndices(*dof_map, 1);
+
+    std::size_t const n_nodes = mesh->getNumberOfNodes();
+    ASSERT_EQ(n_nodes, indices_0.size());
+    ASSERT_EQ(2 * n_nodes, indices_1.size());
+    for (std::size_t i = 0; i < n_nodes; i++)
+    {
+        EXPECT_EQ(static_cast<GlobalIndexType>(3 * i), indices_0[i]);
+        EXPECT_EQ(static_cast<GlobalIndexType>(3 * i + 1), indices_1[2 * i]);
+        EXPECT_EQ(static_cast<GlobalIndexType>(3 * i + 2),
+                  indices_1[2 * i + 1]);
+    }
+}
+
 #ifndef USE_PETSC
 TEST_F(NumLibLocalToGlobalIndexMapTest, MultipleVariablesMultipleComponents2)
 #else
@@ -51,3 +51,70 @@ TEST(NumLibNewtonRaphson, Sqrt3)
     EXPECT_LE(*success_iterations, maximum_iterations);
     ASSERT_LE(state - std::sqrt(3), std::numeric_limits<double>::epsilon());
 }
+
+namespace
+{
+boost::optional<int> solveSqrt3(
+    NumLib::NewtonRaphsonSolverParameters const& parameters, double& state)
+{
+    static const int N = 1;  // Problem's size.
+
+    using LocalJacobianMatrix = Eigen::Matrix<double, N, N, Eigen::RowMajor>;
+    using LocalResidualVector = Eigen::Matrix<double, N, 1>;
+
+    Eigen::PartialPivLU<LocalJacobianMatrix> linear_solver(N);
+    LocalJacobianMatrix jacobian;
+
+    // Solve f(x) = x^2 - S == 0, where S = 3.
+    auto const update_jacobian = [&state](LocalJacobianMatrix& jacobian) {
+        jacobian(0, 0) = 2 * state;
+    };
+
+    auto const update_residual = [&state](LocalResidualVector& residual) {
+        residual[0] = state * state - 3;
+    };
+
+    auto const update_solution = [&state](
+        LocalResidualVector const& increment) { state += increment[0]; };
+
+    auto const newton_solver = NumLib::NewtonRaphson<
+        decltype(linear_solver), LocalJacobianMatrix, decltype(update_jacobian),
+        LocalResidualVector, decltype(update_residual),
+        decltype(update_solution)>(linear_solver, update_jacobian,
+                                   update_residual, update_solution,
+                                   parameters);
+    auto const success_iterations = newton_solver.solve(jacobian);
+
+    // The returned jacobian is evaluated at the solution.
+    EXPECT_EQ(2 * state, jacobian(0, 0));
+    return success_iterations;
+}
+}  // namespace
+
+TEST(NumLibNewtonRaphson, Sqrt3Chord)
+{
+    const int maximum_iterations = 30;
+    const double tolerance = 1e-15;
+
+    double state = 1;
+    auto const success_iterations =
+        solveSqrt3({maximum_iterations, tolerance, 4, false}, state);
+
+    EXPECT_TRUE(static_cast<bool>(success_iterations));
+    ASSERT_LE(std::abs(state - std::sqrt(3)),
+              std::numeric_limits<double>::epsilon());
+}
+
+TEST(NumLibNewtonRaphson, Sqrt3Broyden)
+{
+    const int maximum_iterations = 30;
+    const double tolerance = 1e-15;
+
+    double state = 1;
+    auto const success_iterations =
+        solveSqrt3({maximum_iterations, tolerance, 100, true}, state);
+
+    EXPECT_TRUE(static_cast<bool>(success_iterations));
+    ASSERT_LE(std::abs(state - std::sqrt(3)),
+              std::numeric_limits<double>::epsilon());
+}
@@ -0,0 +1,100 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "NumLib/Assembler/AssemblyOrder.h"
+#include "NumLib/Assembler/ElementColoring.h"
+
+namespace
+{
+void checkPermutation(std::vector<std::size_t> order)
+{
+    std::sort(order.begin(), order.end());
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        ASSERT_EQ(i, order[i]);
+    }
+}
+
+bool shareNode(MeshLib::Element const& a, MeshLib::Element const& b)
+{
+    for (unsigned i = 0; i < a.getNumberOfNodes(); ++i)
+    {
+        for (unsigned j = 0; j < b.getNumberOfNodes(); ++j)
+        {
+            if (a.getNodeIndex(i) == b.getNodeIndex(j))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+}  // namespace
+
+TEST(NumLibAssemblyOrder, RegularQuadMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 8));
+
+    auto const order = NumLib::computeAssemblyOrder(*mesh);
+
+    ASSERT_EQ(mesh->getNumberOfElements(), order.size());
+    checkPermutation(order);
+    // On a 2^n x 2^n grid the Hilbert curve moves from each element to one of
+    // its neighbors.
+    for (std::size_t i = 1; i < order.size(); ++i)
+    {
+        ASSERT_TRUE(shareNode(*mesh->getElement(order[i - 1]),
+                              *mesh->getElement(order[i])));
+    }
+}
+
+TEST(NumLibAssemblyOrder, GroupedByMaterial)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 4));
+
+    auto& material_ids = *MeshLib::getOrCreateMeshProperty<int>(
+        *mesh, "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    for (std::size_t e = 0; e < material_ids.size(); ++e)
+    {
+        material_ids[e] = static_cast<int>(e % 3);
+    }
+
+    auto const order = NumLib::computeAssemblyOrder(*mesh);
+
+    ASSERT_EQ(mesh->getNumberOfElements(), order.size());
+    checkPermutation(order);
+    for (std::size_t i = 1; i < order.size(); ++i)
+    {
+        ASSERT_LE(material_ids[order[i - 1]], material_ids[order[i]]);
+    }
+
+    NumLib::ElementColoring groups{{5, 1, 3}, {0, 4, 2}};
+    NumLib::sortByAssemblyOrder(groups, order);
+    auto const position = [&](std::size_t const e) {
+        return std::find(order.begin(), order.end(), e) - order.begin();
+    };
+    for (auto const& group : groups)
+    {
+        for (std::size_t i = 1; i < group.size(); ++i)
+        {
+            ASSERT_LT(position(group[i - 1]), position(group[i]));
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "NumLib/Assembler/ElementColoring.h"
+
+namespace
+{
+void checkColoring(MeshLib::Mesh const& mesh,
+                   NumLib::ElementColoring const& coloring)
+{
+    std::vector<int> visits(mesh.getNumberOfElements(), 0);
+
+    for (auto const& color : coloring)
+    {
+        ASSERT_FALSE(color.empty());
+
+        std::vector<bool> node_used(mesh.getNumberOfNodes(), false);
+        for (auto const element_id : color)
+        {
+            ++visits[element_id];
+
+            auto const& element = *mesh.getElement(element_id);
+            for (unsigned i = 0; i < element.getNumberOfNodes(); ++i)
+            {
+                auto const node_id = element.getNodeIndex(i);
+                ASSERT_FALSE(node_used[node_id])
+                    << "Node " << node_id << " is shared within a color.";
+                node_used[node_id] = true;
+            }
+        }
+    }
+
+    for (auto const v : visits)
+    {
+        ASSERT_EQ(1, v);
+    }
+}
+}  // namespace
+
+TEST(NumLibElementColoring, RegularQuadMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 10));
+
+    auto const coloring = NumLib::computeElementColoring(*mesh);
+
+    checkColoring(*mesh, coloring);
+    // The greedy coloring of a structured quad mesh needs four colors.
+    ASSERT_EQ(4u, coloring.size());
+}
+
+TEST(NumLibElementColoring, RegularHexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 5));
+
+    auto const coloring = NumLib::computeElementColoring(*mesh);
+
+    checkColoring(*mesh, coloring);
+    ASSERT_EQ(8u, coloring.size());
+}
@@ -63,16 +63,13 @@ public:
         std::vector<GlobalVector*> const& /*x*/,
         std::vector<NumLib::LocalToGlobalIndexMap const*> const& /*dof_table*/,
         std::vector<double>& cache) const = 0;
-};
 
-using IntegrationPointValuesMethod = std::vector<double> const& (
-    LocalAssemblerDataInterface::*)(const double /*t*/,
-                                    std::vector<GlobalVector*> const& /*x*/,
-                                    std::vector<
-                                        NumLib::
-                                            LocalToGlobalIndexMap const*> const& /*dof_table*/
-                                    ,
-                                    std::vector<double>& /*cache*/) const;
+    virtual void appendDerivedQuantity(
+        const double t,
+        std::vector<GlobalVector*> const& x,
+        std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
+        NumLib::IntegrationPointValuesBuffer& buffer) const = 0;
+};
 
 template <typename ShapeFunction, typename IntegrationMethod,
           unsigned GlobalDim>
@@ -127,6 +124,19 @@ public:
         return cache;
     }
 
+    void appendDerivedQuantity(
+        const double /*t*/,
+        std::vector<GlobalVector*> const& /*x*/,
+        std::vector<NumLib::LocalToGlobalIndexMap const*> const& /*dof_table*/,
+        NumLib::IntegrationPointValuesBuffer& buffer) const override
+    {
+        auto values = buffer.appendElement(_int_pt_values.size(), 1);
+        for (std::size_t ip = 0; ip < _int_pt_values.size(); ++ip)
+        {
+            values(ip, 0) = 2.0 * _int_pt_values[ip];
+        }
+    }
+
     void interpolateNodalValuesToIntegrationPoints(
         std::vector<double> const& local_nodal_values) override
     {
@@ -187,8 +197,9 @@ public:
                                             global_nodal_values);
     }
 
+    template <typename Method>
     std::pair<GlobalVector const*, GlobalVector const*> extrapolate(
-        IntegrationPointValuesMethod method, const double t,
+        Method method, const double t,
         std::vector<GlobalVector*> const& x) const
     {
         auto const extrapolatables =
@@ -214,8 +225,9 @@ private:
     std::unique_ptr<ExtrapolatorInterface> _extrapolator;
 };
 
+template <typename Method>
 void extrapolate(
-    ExtrapolationTestProcess const& pcs, IntegrationPointValuesMethod method,
+    ExtrapolationTestProcess const& pcs, Method method,
     std::vector<GlobalVector*> const& expected_extrapolated_global_nodal_values,
     std::size_t const nnodes, std::size_t const nelements)
 {
@@ -313,5 +325,13 @@ TEST(NumLib, DISABLED_Extrapolation)
             pcs,
             &ExtrapolationTest::LocalAssemblerDataInterface::getDerivedQuantity,
             two_xs, nnodes, nelements);
+
+        // test extrapolation of the derived quantity written directly to the
+        // extrapolator's buffer
+        ExtrapolationTest::extrapolate(
+            pcs,
+            &ExtrapolationTest::LocalAssemblerDataInterface::
+                appendDerivedQuantity,
+            two_xs, nnodes, nelements);
     }
 }
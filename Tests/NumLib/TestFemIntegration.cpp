@@ -15,7 +15,11 @@
 
 #include "Tests/TestTools.h"
 
+#include "NumLib/Fem/Integration/IntegrationGaussLegendrePrism.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendrePyramid.h"
 #include "NumLib/Fem/Integration/IntegrationGaussLegendreRegular.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendreTet.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendreTri.h"
 
 using namespace NumLib;
 
@@ -187,3 +191,35 @@ TEST(NumLib, FemIntegrationGaussLegendreRegular)
 }
 
 
+
+template <typename IntegrationMethod, std::size_t Dim>
+void checkTabulatedWeightedPoints(unsigned const max_order)
+{
+    for (unsigned order = 1; order <= max_order; ++order)
+    {
+        IntegrationMethod const integration_method(order);
+        for (unsigned ip = 0; ip < integration_method.getNumberOfPoints();
+             ++ip)
+        {
+            auto const tabulated = integration_method.getWeightedPoint(ip);
+            auto const computed = IntegrationMethod::getWeightedPoint(
+                integration_method.getIntegrationOrder(), ip);
+            ASSERT_EQ(computed.getWeight(), tabulated.getWeight());
+            for (std::size_t d = 0; d < Dim; ++d)
+            {
+                ASSERT_EQ(computed[d], tabulated[d]);
+            }
+        }
+    }
+}
+
+TEST(NumLib, FemIntegrationTabulatedWeightedPoints)
+{
+    checkTabulatedWeightedPoints<IntegrationGaussLegendreRegular<1>, 1>(4);
+    checkTabulatedWeightedPoints<IntegrationGaussLegendreRegular<2>, 2>(4);
+    checkTabulatedWeightedPoints<IntegrationGaussLegendreRegular<3>, 3>(4);
+    checkTabulatedWeightedPoints<IntegrationGaussLegendreTri, 2>(4);
+    checkTabulatedWeightedPoints<IntegrationGaussLegendreTet, 3>(3);
+    checkTabulatedWeightedPoints<IntegrationGaussLegendrePrism, 3>(2);
+    checkTabulatedWeightedPoints<IntegrationGaussLegendrePyramid, 3>(3);
+}
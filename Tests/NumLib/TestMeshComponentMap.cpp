@@ -76,6 +76,7 @@ TEST_F(NumLibMeshComponentMapTest, DISABLED_CheckOrderByComponent)
         NumLib::ComponentOrder::BY_COMPONENT);
 
     ASSERT_EQ(2 * mesh->getNumberOfNodes(), cmap->dofSizeWithGhosts());
+    EXPECT_EQ(1, cmap->getBlockSize());
     for (std::size_t i = 0; i < mesh_size; i++)
     {
         // Test global indices for the different components of the node.
@@ -91,6 +92,95 @@ TEST_F(NumLibMeshComponentMapTest, DISABLED_CheckOrderByComponent)
     }
 }
 
+#ifndef USE_PETSC
+TEST_F(NumLibMeshComponentMapTest, CheckNodeOrderByComponent)
+#else
+TEST_F(NumLibMeshComponentMapTest, DISABLED_CheckNodeOrderByComponent)
+#endif
+{
+    // Number the nodes in reverse order.
+    std::size_t const n_nodes = mesh->getNumberOfNodes();
+    std::vector<std::size_t> node_order(n_nodes);
+    for (std::size_t i = 0; i < n_nodes; i++)
+    {
+        node_order[i] = n_nodes - 1 - i;
+    }
+
+    cmap = new MeshComponentMap(
+        components, NumLib::ComponentOrder::BY_COMPONENT, node_order);
+
+    ASSERT_EQ(2 * n_nodes, cmap->dofSizeWithGhosts());
+    for (std::size_t i = 0; i < n_nodes; i++)
+    {
+        ASSERT_EQ(n_nodes - 1 - i, giAtNodeForComponent(i, comp0_id));
+        ASSERT_EQ(2 * n_nodes - 1 - i, giAtNodeForComponent(i, comp1_id));
+    }
+}
+
+#ifndef USE_PETSC
+TEST_F(NumLibMeshComponentMapTest, CheckNodeOrderByLocation)
+#else
+TEST_F(NumLibMeshComponentMapTest, DISABLED_CheckNodeOrderByLocation)
+#endif
+{
+    // Number the nodes in reverse order.
+    std::size_t const n_nodes = mesh->getNumberOfNodes();
+    std::vector<std::size_t> node_order(n_nodes);
+    for (std::size_t i = 0; i < n_nodes; i++)
+    {
+        node_order[i] = n_nodes - 1 - i;
+    }
+
+    cmap = new MeshComponentMap(
+        components, NumLib::ComponentOrder::BY_LOCATION, node_order);
+
+    ASSERT_EQ(2 * n_nodes, cmap->dofSizeWithGhosts());
+    EXPECT_EQ(2, cmap->getBlockSize());
+    for (std::size_t i = 0; i < n_nodes; i++)
+    {
+        ASSERT_EQ(2 * (n_nodes - 1 - i), giAtNodeForComponent(i, comp0_id));
+        ASSERT_EQ(2 * (n_nodes - 1 - i) + 1,
+                  giAtNodeForComponent(i, comp1_id));
+    }
+}
+
+#ifndef USE_PETSC
+TEST_F(NumLibMeshComponentMapTest, CheckNodeOrderByLocationOnSubset)
+#else
+TEST_F(NumLibMeshComponentMapTest, DISABLED_CheckNodeOrderByLocationOnSubset)
+#endif
+{
+    // The second component is only defined on some of the nodes, like the
+    // BHE unknowns in the HeatTransportBHE process.
+    std::vector<MeshLib::Node*> const subset_nodes{
+        mesh->getNodes().begin() + 2, mesh->getNodes().begin() + 5};
+    components.pop_back();
+    components.emplace_back(*mesh, subset_nodes);
+
+    // Number the nodes in reverse order.
+    std::size_t const n_nodes = mesh->getNumberOfNodes();
+    std::vector<std::size_t> node_order(n_nodes);
+    for (std::size_t i = 0; i < n_nodes; i++)
+    {
+        node_order[i] = n_nodes - 1 - i;
+    }
+
+    cmap = new MeshComponentMap(
+        components, NumLib::ComponentOrder::BY_LOCATION, node_order);
+
+    ASSERT_EQ(n_nodes + subset_nodes.size(), cmap->dofSizeWithGhosts());
+    EXPECT_EQ(1, cmap->getBlockSize());
+    std::size_t global_index = 0;
+    for (auto const node_id : node_order)
+    {
+        ASSERT_EQ(global_index++, giAtNodeForComponent(node_id, comp0_id));
+        if (node_id >= 2 && node_id < 5)
+        {
+            ASSERT_EQ(global_index++, giAtNodeForComponent(node_id, comp1_id));
+        }
+    }
+}
+
 #ifndef USE_PETSC
 TEST_F(NumLibMeshComponentMapTest, CheckOrderByLocation)
 #else
@@ -104,6 +194,7 @@ TEST_F(NumLibMeshComponentMapTest, DISABLED_CheckOrderByLocation)
         NumLib::ComponentOrder::BY_LOCATION);
 
     ASSERT_EQ(2 * mesh->getNumberOfNodes(), cmap->dofSizeWithGhosts());
+    EXPECT_EQ(2, cmap->getBlockSize());
     for (std::size_t i = 0; i < mesh_size; i++)
     {
         // Test global indices for the different components of the node.
@@ -119,6 +210,28 @@ TEST_F(NumLibMeshComponentMapTest, DISABLED_CheckOrderByLocation)
     }
 }
 
+#ifndef USE_PETSC
+TEST_F(NumLibMeshComponentMapTest, BlockSizeOfDifferentNodeSets)
+#else
+TEST_F(NumLibMeshComponentMapTest, DISABLED_BlockSizeOfDifferentNodeSets)
+#endif
+{
+    // The second component is defined on every other node only, like a
+    // linear variable on a quadratic mesh.
+    std::vector<MeshLib::Node*> nodes;
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); i += 2)
+    {
+        nodes.push_back(mesh->getNodes()[i]);
+    }
+    std::vector<MeshLib::MeshSubset> const mixed_components{
+        components.front(), MeshLib::MeshSubset{*mesh, nodes}};
+
+    cmap = new MeshComponentMap(mixed_components,
+        NumLib::ComponentOrder::BY_LOCATION);
+
+    EXPECT_EQ(1, cmap->getBlockSize());
+}
+
 #ifndef USE_PETSC
 TEST_F(NumLibMeshComponentMapTest, OutOfRangeAccess)
 #else
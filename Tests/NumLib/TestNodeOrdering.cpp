@@ -0,0 +1,95 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "NumLib/DOF/NodeOrdering.h"
+
+namespace
+{
+/// Returns the rank of each node in the given order.
+std::vector<std::size_t> checkPermutationAndGetRanks(
+    MeshLib::Mesh const& mesh, std::vector<std::size_t> const& order)
+{
+    EXPECT_EQ(mesh.getNumberOfNodes(), order.size());
+
+    std::vector<std::size_t> rank(order.size(), order.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        EXPECT_EQ(order.size(), rank[order[i]]) << "Node appears twice.";
+        rank[order[i]] = i;
+    }
+    return rank;
+}
+
+std::size_t bandwidth(MeshLib::Mesh const& mesh,
+                      std::vector<std::size_t> const& rank)
+{
+    mesh.computeNodesConnectedByElements();
+    std::size_t result = 0;
+    for (auto const* node : mesh.getNodes())
+    {
+        for (auto const* neighbor : node->getConnectedNodes())
+        {
+            auto const a = rank[node->getID()];
+            auto const b = rank[neighbor->getID()];
+            result = std::max(result, a > b ? a - b : b - a);
+        }
+    }
+    return result;
+}
+}  // namespace
+
+TEST(NumLibNodeOrdering, Mesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+
+    ASSERT_TRUE(
+        NumLib::computeNodeOrder(*mesh, NumLib::NodeOrdering::MESH).empty());
+}
+
+TEST(NumLibNodeOrdering, ReverseCuthillMcKee)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(20.0, 3.0, 20, 3));
+
+    auto const order = NumLib::computeNodeOrder(
+        *mesh, NumLib::NodeOrdering::REVERSE_CUTHILL_MCKEE);
+    auto const rank = checkPermutationAndGetRanks(*mesh, order);
+
+    // The mesh nodes are numbered along the long side. The reverse
+    // Cuthill-McKee order proceeds along the long side numbering the four
+    // nodes across the short side consecutively, which reduces the bandwidth
+    // to twice the number of nodes across.
+    std::vector<std::size_t> identity(order.size());
+    for (std::size_t i = 0; i < identity.size(); ++i)
+    {
+        identity[i] = i;
+    }
+    EXPECT_EQ(22u, bandwidth(*mesh, identity));
+    EXPECT_GE(8u, bandwidth(*mesh, rank));
+}
+
+TEST(NumLibNodeOrdering, HilbertCurve)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 4));
+
+    auto const order =
+        NumLib::computeNodeOrder(*mesh, NumLib::NodeOrdering::HILBERT_CURVE);
+    checkPermutationAndGetRanks(*mesh, order);
+}
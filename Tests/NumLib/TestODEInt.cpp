@@ -10,6 +10,7 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <typeinfo>
 
@@ -77,6 +78,10 @@ public:
             _tol, boost::none, MathLib::VecNormType::NORM2);
         auto nonlinear_solver =
             std::make_unique<NLSolver>(*linear_solver, _maxiter);
+        if (configure_nonlinear_solver)
+        {
+            configure_nonlinear_solver(*nonlinear_solver);
+        }
 
         NumLib::TimeLoopSingleODE<NLTag> loop(ode_sys, std::move(linear_solver),
                                               std::move(nonlinear_solver),
@@ -115,6 +120,9 @@ public:
         return sol;
     }
 
+    //! Applied to the nonlinear solver before the time loop is run.
+    std::function<void(NLSolver&)> configure_nonlinear_solver;
+
 private:
     const double _tol = 1e-9;
     const unsigned _maxiter = 20;
@@ -293,6 +301,323 @@ TYPED_TEST(NumLibODEIntTyped, DISABLED_T1)
 }
 
 
+//! Compares the solution of the Newton solver set up by \c configure with the
+//! solution of the default Newton solver.
+template <typename ODE>
+void checkNewtonSolverVariant(
+    std::function<void(
+        NumLib::NonlinearSolver<NumLib::NonlinearSolverTag::Newton>&)> const&
+        configure)
+{
+    const unsigned num_timesteps = 100;
+
+    auto const sol_newton =
+        run_test_case<NumLib::BackwardEuler, ODE,
+                      NumLib::NonlinearSolverTag::Newton>(num_timesteps);
+
+    ODE ode;
+    NumLib::BackwardEuler time_disc;
+    TestOutput<NumLib::NonlinearSolverTag::Newton> test;
+    test.configure_nonlinear_solver = configure;
+    auto const sol = test.run_test(ode, time_disc, num_timesteps);
+
+    ASSERT_EQ(sol_newton.ts.size(), sol.ts.size());
+    for (std::size_t i = 0; i < sol_newton.ts.size(); ++i)
+    {
+        ASSERT_EQ(sol_newton.ts[i], sol.ts[i]);
+        for (int comp = 0;
+             comp < static_cast<int>(sol_newton.solutions[i].size()); ++comp)
+        {
+            EXPECT_NEAR(sol_newton.solutions[i][comp], sol.solutions[i][comp],
+                        1e-8);
+        }
+    }
+}
+
+using NewtonSolver =
+    NumLib::NonlinearSolver<NumLib::NonlinearSolverTag::Newton>;
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, NewtonJacobianLagging)
+#else
+TEST(NumLibODEInt, DISABLED_NewtonJacobianLagging)
+#endif
+{
+    for (bool const residual_only_assembly : {false, true})
+    {
+        checkNewtonSolverVariant<ODE3>([&](NewtonSolver& nonlinear_solver) {
+            NumLib::JacobianLagging lagging;
+            lagging.max_lagged_iterations = 3;
+            lagging.max_residual_ratio = 0.9;
+            nonlinear_solver.setJacobianLagging(lagging);
+            nonlinear_solver.setResidualOnlyAssembly(residual_only_assembly);
+            nonlinear_solver.setEisenstatWalker(NumLib::EisenstatWalker{});
+        });
+    }
+}
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, NewtonConstantJacobian)
+#else
+TEST(NumLibODEInt, DISABLED_NewtonConstantJacobian)
+#endif
+{
+    // The Jacobian of the linear ODE is constant for the constant timestep.
+    checkNewtonSolverVariant<ODE1>([](NewtonSolver& nonlinear_solver) {
+        nonlinear_solver.setConstantJacobian(true);
+    });
+}
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, NewtonLineSearch)
+#else
+TEST(NumLibODEInt, DISABLED_NewtonLineSearch)
+#endif
+{
+    checkNewtonSolverVariant<ODE3>([](NewtonSolver& nonlinear_solver) {
+        NumLib::LineSearch line_search;
+        line_search.type = NumLib::LineSearch::Type::Backtracking;
+        nonlinear_solver.setLineSearch(line_search);
+    });
+
+    // The critical point search is meant for problems with a potential, which
+    // every scalar equation has.
+    checkNewtonSolverVariant<ODE2>([](NewtonSolver& nonlinear_solver) {
+        NumLib::LineSearch line_search;
+        line_search.type = NumLib::LineSearch::Type::CriticalPoint;
+        nonlinear_solver.setLineSearch(line_search);
+    });
+}
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, NewtonJacobianFree)
+#else
+TEST(NumLibODEInt, DISABLED_NewtonJacobianFree)
+#endif
+{
+    for (bool const residual_only_assembly : {false, true})
+    {
+        checkNewtonSolverVariant<ODE3>([&](NewtonSolver& nonlinear_solver) {
+            NumLib::JacobianFree jacobian_free;
+            jacobian_free.tolerance = 1e-10;
+            nonlinear_solver.setJacobianFree(jacobian_free);
+            nonlinear_solver.setResidualOnlyAssembly(residual_only_assembly);
+        });
+    }
+}
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, NewtonInitialGuess)
+#else
+TEST(NumLibODEInt, DISABLED_NewtonInitialGuess)
+#endif
+{
+    for (bool const jacobian_free : {false, true})
+    {
+        checkNewtonSolverVariant<ODE3>([&](NewtonSolver& nonlinear_solver) {
+            NumLib::InitialGuess guess;
+            guess.extrapolation = true;
+            guess.recycled_subspace_dimension = 2;
+            nonlinear_solver.setInitialGuess(guess);
+            if (jacobian_free)
+            {
+                NumLib::JacobianFree jf;
+                jf.tolerance = 1e-10;
+                nonlinear_solver.setJacobianFree(jf);
+            }
+        });
+    }
+}
+
+//! ODE1 with time-invariant matrices, which counts the assemblies.
+class ODE1TimeInvariant final
+    : public NumLib::ODESystem<
+          NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+          NumLib::NonlinearSolverTag::Picard>
+{
+public:
+    void preAssemble(const double /*t*/, double const /*dt*/,
+                     GlobalVector const& /*x*/) override
+    {
+    }
+
+    void assemble(const double /*t*/, double const /*dt*/,
+                  std::vector<GlobalVector*> const& /*x*/,
+                  std::vector<GlobalVector*> const& /*xdot*/,
+                  int const /*process_id*/, GlobalMatrix& M, GlobalMatrix& K,
+                  GlobalVector& b) override
+    {
+        ++number_of_assemblies;
+        _ode.setMKbValues(M, K, b);
+    }
+
+    bool useTimeInvariantMatrices(int const /*process_id*/) override
+    {
+        return true;
+    }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications(
+        const int process_id) const override
+    {
+        return _ode.getMatrixSpecifications(process_id);
+    }
+
+    bool isLinear() const override { return true; }
+
+    int number_of_assemblies = 0;
+
+private:
+    ODE1 _ode;
+};
+
+template <>
+class ODETraits<ODE1TimeInvariant> : public ODETraits<ODE1>
+{
+};
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, PicardTimeInvariantMatrices)
+#else
+TEST(NumLibODEInt, DISABLED_PicardTimeInvariantMatrices)
+#endif
+{
+    const unsigned num_timesteps = 100;
+    auto constexpr Picard = NumLib::NonlinearSolverTag::Picard;
+
+    auto const sol_picard =
+        run_test_case<NumLib::BackwardEuler, ODE1, Picard>(num_timesteps);
+
+    ODE1TimeInvariant ode;
+    NumLib::BackwardEuler time_disc;
+    TestOutput<Picard> test;
+    auto const sol = test.run_test(ode, time_disc, num_timesteps);
+
+    EXPECT_EQ(1, ode.number_of_assemblies);
+    ASSERT_EQ(sol_picard.ts.size(), sol.ts.size());
+    for (std::size_t i = 0; i < sol_picard.ts.size(); ++i)
+    {
+        ASSERT_EQ(sol_picard.ts[i], sol.ts[i]);
+        for (int comp = 0;
+             comp < static_cast<int>(sol_picard.solutions[i].size()); ++comp)
+        {
+            EXPECT_NEAR(sol_picard.solutions[i][comp], sol.solutions[i][comp],
+                        1e-12);
+        }
+    }
+}
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, PicardAndersonAcceleration)
+#else
+TEST(NumLibODEInt, DISABLED_PicardAndersonAcceleration)
+#endif
+{
+    const unsigned num_timesteps = 100;
+    auto constexpr Picard = NumLib::NonlinearSolverTag::Picard;
+
+    auto const sol_picard =
+        run_test_case<NumLib::BackwardEuler, ODE3, Picard>(num_timesteps);
+
+    for (bool const restart : {false, true})
+    {
+        ODE3 ode;
+        NumLib::BackwardEuler time_disc;
+        TestOutput<Picard> test;
+        test.configure_nonlinear_solver =
+            [&](NumLib::NonlinearSolver<Picard>& nonlinear_solver) {
+                NumLib::AndersonAcceleration anderson;
+                anderson.depth = 2;
+                anderson.restart = restart;
+                nonlinear_solver.setAndersonAcceleration(anderson);
+            };
+        auto const sol = test.run_test(ode, time_disc, num_timesteps);
+
+        ASSERT_EQ(sol_picard.ts.size(), sol.ts.size());
+        for (std::size_t i = 0; i < sol_picard.ts.size(); ++i)
+        {
+            ASSERT_EQ(sol_picard.ts[i], sol.ts[i]);
+            for (int comp = 0;
+                 comp < static_cast<int>(sol_picard.solutions[i].size());
+                 ++comp)
+            {
+                EXPECT_NEAR(sol_picard.solutions[i][comp],
+                            sol.solutions[i][comp], 1e-8);
+            }
+        }
+    }
+}
+
+//! ODE1, whose mass matrix is diagonal already, with the lumped mass matrix
+//! enabled.
+class ODE1LumpedMass final
+    : public NumLib::ODESystem<
+          NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+          NumLib::NonlinearSolverTag::Picard>
+{
+public:
+    void preAssemble(const double /*t*/, double const /*dt*/,
+                     GlobalVector const& /*x*/) override
+    {
+    }
+
+    void assemble(const double /*t*/, double const /*dt*/,
+                  std::vector<GlobalVector*> const& /*x*/,
+                  std::vector<GlobalVector*> const& /*xdot*/,
+                  int const /*process_id*/, GlobalMatrix& M, GlobalMatrix& K,
+                  GlobalVector& b) override
+    {
+        _ode.setMKbValues(M, K, b);
+    }
+
+    bool enableLumpedMass(int const /*process_id*/) override { return true; }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications(
+        const int process_id) const override
+    {
+        return _ode.getMatrixSpecifications(process_id);
+    }
+
+    bool isLinear() const override { return true; }
+
+private:
+    ODE1 _ode;
+};
+
+template <>
+class ODETraits<ODE1LumpedMass> : public ODETraits<ODE1>
+{
+};
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, PicardForwardEulerLumpedMass)
+#else
+TEST(NumLibODEInt, DISABLED_PicardForwardEulerLumpedMass)
+#endif
+{
+    const unsigned num_timesteps = 100;
+    auto constexpr Picard = NumLib::NonlinearSolverTag::Picard;
+
+    auto const sol_picard =
+        run_test_case<NumLib::ForwardEuler, ODE1, Picard>(num_timesteps);
+
+    ODE1LumpedMass ode;
+    NumLib::ForwardEuler time_disc(true);
+    TestOutput<Picard> test;
+    auto const sol = test.run_test(ode, time_disc, num_timesteps);
+
+    ASSERT_EQ(sol_picard.ts.size(), sol.ts.size());
+    for (std::size_t i = 0; i < sol_picard.ts.size(); ++i)
+    {
+        ASSERT_EQ(sol_picard.ts[i], sol.ts[i]);
+        for (int comp = 0;
+             comp < static_cast<int>(sol_picard.solutions[i].size()); ++comp)
+        {
+            EXPECT_NEAR(sol_picard.solutions[i][comp], sol.solutions[i][comp],
+                        1e-12);
+        }
+    }
+}
+
 /* TODO Other possible test cases:
  *
  * * check that the order of time discretization scales correctly
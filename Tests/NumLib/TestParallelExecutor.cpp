@@ -0,0 +1,152 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "NumLib/Assembler/ParallelExecutor.h"
+
+namespace
+{
+struct Element
+{
+    void increment(std::size_t const id, std::vector<int>& counts) const
+    {
+        // Each id is visited by exactly one thread, so no synchronization is
+        // needed here.
+        counts[id] += value;
+    }
+
+    int value;
+};
+
+struct Visitor
+{
+    void visit(std::size_t const id, Element const& element,
+               std::vector<int>& counts) const
+    {
+        element.increment(id, counts);
+    }
+};
+
+std::vector<std::unique_ptr<Element>> createElements(std::size_t const size)
+{
+    std::vector<std::unique_ptr<Element>> elements;
+    elements.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        elements.push_back(std::make_unique<Element>(Element{1}));
+    }
+    return elements;
+}
+}  // namespace
+
+TEST(NumLibParallelExecutor, ExecuteMemberDereferencedVisitsAllElements)
+{
+    auto const elements = createElements(1000);
+    std::vector<int> counts(elements.size(), 0);
+
+    Visitor visitor;
+    NumLib::ParallelExecutor::executeMemberDereferenced(
+        visitor, &Visitor::visit, elements, counts);
+
+    ASSERT_TRUE(std::all_of(counts.begin(), counts.end(),
+                            [](int const c) { return c == 1; }));
+}
+
+TEST(NumLibParallelExecutor, ExecuteSelectedMemberDereferenced)
+{
+    auto const elements = createElements(1000);
+    std::vector<int> counts(elements.size(), 0);
+
+    std::vector<std::size_t> active_ids;
+    for (std::size_t i = 0; i < elements.size(); i += 3)
+    {
+        active_ids.push_back(i);
+    }
+
+    Visitor visitor;
+    NumLib::ParallelExecutor::executeSelectedMemberDereferenced(
+        visitor, &Visitor::visit, elements, active_ids, counts);
+
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        ASSERT_EQ(i % 3 == 0 ? 1 : 0, counts[i]);
+    }
+
+    // Empty selection means all elements.
+    std::fill(counts.begin(), counts.end(), 0);
+    NumLib::ParallelExecutor::executeSelectedMemberDereferenced(
+        visitor, &Visitor::visit, elements, std::vector<std::size_t>{},
+        counts);
+    ASSERT_EQ(static_cast<int>(elements.size()),
+              std::accumulate(counts.begin(), counts.end(), 0));
+}
+
+TEST(NumLibParallelExecutor, ExecuteMemberOnDereferenced)
+{
+    auto const elements = createElements(1000);
+    std::vector<int> counts(elements.size(), 0);
+
+    NumLib::ParallelExecutor::executeMemberOnDereferenced(&Element::increment,
+                                                          elements, counts);
+
+    ASSERT_EQ(static_cast<int>(elements.size()),
+              std::accumulate(counts.begin(), counts.end(), 0));
+}
+
+TEST(NumLibParallelExecutor, ExceptionIsRethrown)
+{
+    auto const elements = createElements(1000);
+
+    auto const f = [](std::size_t const id, Element const& /*element*/) {
+        if (id == 500)
+        {
+            throw std::runtime_error("element 500 failed");
+        }
+    };
+
+    ASSERT_THROW(NumLib::ParallelExecutor::executeDereferenced(f, elements),
+                 std::runtime_error);
+}
+
+TEST(NumLibParallelExecutor, ParallelForWithContextUsesOneContextPerThread)
+{
+    std::size_t const size = 1000;
+    std::vector<int> counts(size, 0);
+    std::vector<int> context_of_iteration(size, -1);
+    int n_contexts = 0;
+
+    NumLib::detail::parallelForWithContext(
+        size,
+        [&n_contexts] {
+            int context;
+#pragma omp critical(test_parallel_for_with_context)
+            context = n_contexts++;
+            return context;
+        },
+        [&](int const context, std::size_t const i) {
+            counts[i]++;
+            context_of_iteration[i] = context;
+        });
+
+    ASSERT_EQ(static_cast<int>(size),
+              std::accumulate(counts.begin(), counts.end(), 0));
+    ASSERT_TRUE(std::all_of(counts.begin(), counts.end(),
+                            [](int const c) { return c == 1; }));
+    ASSERT_LE(n_contexts, NumLib::getMaxNumberOfThreads());
+    ASSERT_TRUE(std::all_of(
+        context_of_iteration.begin(), context_of_iteration.end(),
+        [n_contexts](int const c) { return c >= 0 && c < n_contexts; }));
+}
@@ -0,0 +1,63 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/UnifiedMatrixSetters.h"
+#include "NumLib/ODESolver/ReducedBasis.h"
+
+#ifndef USE_PETSC
+TEST(NumLibReducedBasis, GalerkinProjectionReproducesSnapshotSpace)
+#else
+TEST(NumLibReducedBasis, DISABLED_GalerkinProjectionReproducesSnapshotSpace)
+#endif
+{
+    Eigen::MatrixXd A_dense(4, 4);
+    A_dense << 4, -1, 0, 0,  //
+        -1, 4, -1, 0,        //
+        0, -1, 4, -1,        //
+        0, 0, -1, 4;
+    Eigen::VectorXd const x1 = (Eigen::VectorXd(4) << 1, 2, 3, 4).finished();
+    Eigen::VectorXd const x2 = (Eigen::VectorXd(4) << 1, 0, -1, 0).finished();
+
+    // Three snapshots spanning a two-dimensional space.
+    NumLib::SnapshotCollector collector;
+    for (Eigen::VectorXd const& snapshot :
+         {Eigen::VectorXd(x1), Eigen::VectorXd(x2), Eigen::VectorXd(x1 + x2)})
+    {
+        GlobalVector x(4);
+        MathLib::setVector(x, {snapshot[0], snapshot[1], snapshot[2],
+                               snapshot[3]});
+        collector.addSnapshot(x);
+    }
+    ASSERT_EQ(3u, collector.numberOfSnapshots());
+
+    Eigen::MatrixXd const basis = collector.computeBasis(1.0);
+    ASSERT_EQ(2, basis.cols());
+    EXPECT_TRUE((basis.transpose() * basis)
+                    .isApprox(Eigen::MatrixXd::Identity(2, 2), 1e-12));
+
+    // The dominant mode alone is selected for a small energy fraction.
+    EXPECT_EQ(1, collector.computeBasis(0.5).cols());
+
+    GlobalMatrix A(4);
+    MathLib::setMatrix(A, A_dense);
+    Eigen::VectorXd const x_expected = 2 * x1 - x2;
+    Eigen::VectorXd const b = A_dense * x_expected;
+    GlobalVector rhs(4);
+    MathLib::setVector(rhs, {b[0], b[1], b[2], b[3]});
+
+    NumLib::ReducedBasis const reduced_basis(basis);
+    GlobalVector x(4);
+    ASSERT_TRUE(reduced_basis.solve(A, rhs, x));
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_NEAR(x_expected[i], x.get(i), 1e-12);
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "NumLib/DOF/SimpleMatrixVectorProvider.h"
+
+#ifndef USE_PETSC
+TEST(NumLibSimpleMatrixVectorProvider, RecyclesVectorsOfSameLayout)
+#else
+TEST(NumLibSimpleMatrixVectorProvider, DISABLED_RecyclesVectorsOfSameLayout)
+#endif
+{
+    NumLib::SimpleMatrixVectorProvider provider;
+    MathLib::MatrixSpecifications const spec_a(3, 3, nullptr, nullptr);
+    MathLib::MatrixSpecifications const spec_b(5, 5, nullptr, nullptr);
+
+    // A temporary acquired without id is reused for the same layout only.
+    auto* const a = &provider.getVector(spec_a);
+    provider.releaseVector(*a);
+    auto* const b = &provider.getVector(spec_b);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(5, b->size());
+    EXPECT_EQ(a, &provider.getVector(spec_a));
+
+    // Copies of a vector have its layout.
+    provider.releaseVector(*b);
+    auto& x = provider.getVector(spec_a);
+    x.setZero();
+    x.set(1, 2.0);
+    auto* const copy = &provider.getVector(x);
+    EXPECT_EQ(3, copy->size());
+    EXPECT_EQ(2.0, copy->get(1));
+    provider.releaseVector(*copy);
+    EXPECT_EQ(copy, &provider.getVector(spec_a));
+
+    // An id still returns its own vector if it has not been recycled.
+    std::size_t id = 0;
+    auto* const c = &provider.getVector(spec_b, id);
+    EXPECT_NE(0u, id);
+    provider.releaseVector(*c);
+    EXPECT_EQ(c, &provider.getVector(spec_b, id));
+
+    // Uninitialized vectors might be resized and are only reused by id.
+    std::size_t uninitialized_id = 0;
+    auto* const u = &provider.getVector(uninitialized_id);
+    provider.releaseVector(*u);
+    EXPECT_NE(u, &provider.getVector());
+    EXPECT_EQ(u, &provider.getVector(uninitialized_id));
+}
+
+#ifndef USE_PETSC
+TEST(NumLibSimpleMatrixVectorProvider, FreeUnusedMatrices)
+#else
+TEST(NumLibSimpleMatrixVectorProvider, DISABLED_FreeUnusedMatrices)
+#endif
+{
+    NumLib::SimpleMatrixVectorProvider provider;
+    MathLib::MatrixSpecifications const spec(4, 4, nullptr, nullptr);
+
+    std::size_t id = 0;
+    auto& A = provider.getMatrix(spec, id);
+    auto const old_id = id;
+    auto& B = provider.getMatrix(spec);
+    EXPECT_NE(&A, &B);
+    provider.releaseMatrix(A);
+    provider.releaseMatrix(B);
+
+    // After freeing, the id refers to a new matrix.
+    provider.freeUnusedMatrices();
+    auto& C = provider.getMatrix(spec, id);
+    EXPECT_NE(old_id, id);
+    EXPECT_EQ(4, C.getNumberOfRows());
+    provider.releaseMatrix(C);
+}
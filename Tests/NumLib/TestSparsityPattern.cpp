@@ -6,6 +6,8 @@
  *              http://www.opengeosys.org/LICENSE.txt
  */
 
+#include <array>
+
 #include <gtest/gtest.h>
 
 #include "MeshLib/Elements/Utils.h"
@@ -141,3 +143,32 @@ TEST(NumLib_SparsityPattern, DISABLED_MultipleComponentsLinearQuadraticMesh)
     EXPECT_EQ(5u, sp[10]);
 }
 
+
+
+#ifndef USE_PETSC
+TEST(NumLib_SparsityPattern, SingleComponentQuadMesh)
+#else
+TEST(NumLib_SparsityPattern, DISABLED_SingleComponentQuadMesh)
+#endif
+{
+    // 3x3 nodes; the number of nonzeros differs for corner, edge, and center
+    // nodes.
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1., 2u));
+    MeshLib::MeshSubset nodesSubset{*mesh, mesh->getNodes()};
+
+    std::vector<MeshLib::MeshSubset> components{nodesSubset};
+    NumLib::LocalToGlobalIndexMap dof_map(
+                      std::move(components),
+                      NumLib::ComponentOrder::BY_COMPONENT);
+
+    GlobalSparsityPattern sp = NumLib::computeSparsityPattern(dof_map, *mesh);
+
+    ASSERT_EQ(9u, sp.size());
+    std::array<GlobalIndexType, 9> const expected = {4, 6, 4, 6, 9,
+                                                     6, 4, 6, 4};
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(expected[i], sp[i]);
+    }
+}
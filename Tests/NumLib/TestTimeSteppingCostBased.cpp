@@ -0,0 +1,169 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include "NumLib/ODESolver/TimeDiscretization.h"
+#include "NumLib/TimeStepping/Algorithms/CostBasedTimeStepping.h"
+#include "NumLib/TimeStepping/TimeStep.h"
+
+namespace
+{
+NumLib::CostBasedTimeStepping createAlgorithm(double const tol = 0)
+{
+    return NumLib::CostBasedTimeStepping(0, 100, 0.1, 10, 1, 2, 0.5, 0.8, tol,
+                                         {});
+}
+
+// Calls next() for a step with the given wall clock time.
+bool next(NumLib::CostBasedTimeStepping& alg, double const wall_clock_time,
+          double const contraction_rate = 0, bool const converged = true,
+          double const solution_error = 0)
+{
+    alg.setAcceptedOrNot(converged);
+    alg.setCostOfLastStep(wall_clock_time, contraction_rate);
+    return alg.next(solution_error, 3);
+}
+}  // namespace
+
+TEST(NumLib, TimeSteppingCostBasedFollowsEfficiency)
+{
+    auto alg = createAlgorithm();
+
+    ASSERT_TRUE(alg.next(0, 0));
+    ASSERT_EQ(1., alg.getTimeStep().dt());
+
+    // The first accepted step always gets the maximum multiplier.
+    ASSERT_TRUE(next(alg, 1));
+    ASSERT_EQ(2., alg.getTimeStep().dt());
+
+    // The efficiency grew with the step size.
+    ASSERT_TRUE(next(alg, 1));
+    ASSERT_EQ(3., alg.getTimeStep().previous());
+    ASSERT_EQ(4., alg.getTimeStep().dt());
+
+    // The efficiency dropped, the step size is reduced by a damped
+    // multiplier.
+    ASSERT_TRUE(next(alg, 8));
+    ASSERT_NEAR(4. / std::sqrt(2.), alg.getTimeStep().dt(), 1e-14);
+
+    // The efficiency grew with the smaller step size.
+    ASSERT_TRUE(next(alg, 1));
+    ASSERT_NEAR(2. / std::sqrt(2.), alg.getTimeStep().dt(), 1e-14);
+    ASSERT_TRUE(alg.accepted());
+}
+
+TEST(NumLib, TimeSteppingCostBasedRejectedStepCost)
+{
+    auto alg = createAlgorithm();
+    ASSERT_TRUE(alg.next(0, 0));
+    ASSERT_TRUE(next(alg, 1));
+    ASSERT_EQ(2., alg.getTimeStep().dt());
+
+    // The non-linear solver failed.
+    ASSERT_TRUE(next(alg, 4, 0, false));
+    ASSERT_FALSE(alg.accepted());
+    ASSERT_EQ(1., alg.getTimeStep().previous());
+    ASSERT_EQ(1., alg.getTimeStep().dt());
+
+    // The accepted step is charged with the cost of the rejected one, which
+    // makes it less efficient than the first step of the same size. Thus,
+    // the step size is reduced by the damped multiplier.
+    ASSERT_TRUE(next(alg, 1));
+    ASSERT_TRUE(alg.accepted());
+    ASSERT_EQ(2., alg.getTimeStep().previous());
+    ASSERT_NEAR(1. / std::sqrt(2.), alg.getTimeStep().dt(), 1e-14);
+}
+
+TEST(NumLib, TimeSteppingCostBasedContractionRate)
+{
+    auto alg = createAlgorithm();
+    ASSERT_TRUE(alg.next(0, 0));
+
+    // Slow contraction limits the multiplier to 0.8 / 1.6.
+    ASSERT_TRUE(next(alg, 1, 1.6));
+    ASSERT_EQ(0.5, alg.getTimeStep().dt());
+}
+
+TEST(NumLib, TimeSteppingCostBasedLocalErrorEstimate)
+{
+    auto alg = createAlgorithm(1e-3);
+    ASSERT_TRUE(alg.isSolutionErrorComputationNeeded());
+    ASSERT_TRUE(alg.isLocalErrorEstimateNeeded());
+    ASSERT_TRUE(alg.next(0, 0));
+
+    // The error estimate exceeds the tolerance.
+    ASSERT_FALSE(next(alg, 1, 0, true, 4e-3));
+    ASSERT_FALSE(alg.accepted());
+    ASSERT_EQ(0., alg.getTimeStep().previous());
+    ASSERT_NEAR(0.45, alg.getTimeStep().dt(), 1e-14);
+
+    // The error estimate limits the step size increase.
+    ASSERT_TRUE(next(alg, 1, 0, true, 0.81e-3));
+    ASSERT_TRUE(alg.accepted());
+    ASSERT_NEAR(0.45, alg.getTimeStep().dt(), 1e-14);
+}
+
+TEST(NumLib, TimeSteppingCostBasedCheckpoint)
+{
+    auto alg = createAlgorithm();
+    ASSERT_TRUE(alg.next(0, 0));
+    ASSERT_TRUE(next(alg, 1));
+    ASSERT_TRUE(next(alg, 4, 0, false));
+
+    std::stringstream checkpoint;
+    alg.writeCheckpoint(checkpoint);
+
+    auto restarted_alg = createAlgorithm();
+    restarted_alg.readCheckpoint(checkpoint);
+    ASSERT_TRUE(checkpoint.good());
+
+    for (double const wall_clock_time : {1., 2., 8., 1.})
+    {
+        ASSERT_EQ(next(alg, wall_clock_time),
+                  next(restarted_alg, wall_clock_time));
+        auto const ts = alg.getTimeStep();
+        auto const restarted_ts = restarted_alg.getTimeStep();
+        ASSERT_EQ(ts.steps(), restarted_ts.steps());
+        ASSERT_EQ(ts.previous(), restarted_ts.previous());
+        ASSERT_EQ(ts.current(), restarted_ts.current());
+    }
+}
+
+TEST(NumLib, BackwardEulerLocalErrorEstimate)
+{
+    struct NoMatrixStorage final : public NumLib::InternalMatrixStorage
+    {
+        void pushMatrices() const override {}
+    } const storage;
+
+    // The solution x = t^2 of dx/dt = 2t.
+    NumLib::BackwardEuler time_disc;
+    GlobalVector x(1);
+    x[0] = 0;
+    time_disc.setInitialState(0, x);
+
+    time_disc.nextTimestep(1, 1);
+    x[0] = 1;
+    ASSERT_EQ(0., time_disc.getRelativeLocalErrorEstimate(
+                      x, MathLib::VecNormType::NORM2));
+    time_disc.pushState(1, x, storage);
+
+    // The local truncation error of the backward Euler scheme is
+    // dt^2 / 2 * x'' = 4.
+    time_disc.nextTimestep(3, 2);
+    x[0] = 9;
+    ASSERT_NEAR(4. / 9., time_disc.getRelativeLocalErrorEstimate(
+                             x, MathLib::VecNormType::NORM2),
+                1e-14);
+}
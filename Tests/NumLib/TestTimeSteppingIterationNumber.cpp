@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
 #include <utility>
 #include <vector>
 
@@ -122,3 +123,40 @@ TEST(NumLib, TimeSteppingIterationNumberBased2FixedOutputTimes)
     ASSERT_ARRAY_NEAR(expected_vec_t, vec_t, expected_vec_t.size(),
                       std::numeric_limits<double>::epsilon());
 }
+
+TEST(NumLib, TimeSteppingIterationNumberBasedCheckpoint)
+{
+    auto create_algorithm = []() {
+        std::vector<int> iter_times_vector = {0, 3, 5, 7};
+        std::vector<double> multiplier_vector = {2.0, 1.0, 0.5, 0.25};
+        return NumLib::IterationNumberBasedTimeStepping(
+            1, 31, 1, 10, 1, std::move(iter_times_vector),
+            std::move(multiplier_vector), {});
+    };
+
+    auto alg = create_algorithm();
+    const double solution_error = 0.;
+    for (int const number_iterations : {1, 1, 3, 5})
+    {
+        ASSERT_TRUE(alg.next(solution_error, number_iterations));
+    }
+
+    std::stringstream checkpoint;
+    alg.writeCheckpoint(checkpoint);
+
+    auto restarted_alg = create_algorithm();
+    restarted_alg.readCheckpoint(checkpoint);
+    ASSERT_TRUE(checkpoint.good());
+
+    for (int const number_iterations : {7, 8, 4, 1})
+    {
+        ASSERT_EQ(alg.next(solution_error, number_iterations),
+                  restarted_alg.next(solution_error, number_iterations));
+        auto const ts = alg.getTimeStep();
+        auto const restarted_ts = restarted_alg.getTimeStep();
+        ASSERT_EQ(ts.steps(), restarted_ts.steps());
+        ASSERT_EQ(ts.previous(), restarted_ts.previous());
+        ASSERT_EQ(ts.current(), restarted_ts.current());
+        ASSERT_EQ(alg.accepted(), restarted_alg.accepted());
+    }
+}
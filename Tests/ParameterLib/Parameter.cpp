@@ -11,11 +11,14 @@
 #include <logog/include/logog.hpp>
 
 #include <boost/property_tree/xml_parser.hpp>
+#include <fstream>
 #include <numeric>
 #include <sstream>
 #include <vector>
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/FileTools.h"
+#include "InfoLib/TestInfo.h"
 #include "Tests/TestTools.h"
 
 #include "MeshLib/Mesh.h"
@@ -255,3 +258,291 @@ TEST_F(ParameterLibParameter, GetNodalValuesOnElement_curveScaledNode)
     ASSERT_TRUE(testNodalValuesOfElement(meshes[0]->getElements(),
                                          expected_value, *parameter, t));
 }
+
+// For all elements all nodes have the value of the function at the node.
+TEST_F(ParameterLibParameter, GetNodalValuesOnElement_function)
+{
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Function</type>"
+        "<expression>2*x + 1</expression>",
+        meshes);
+
+    double const t = 0;
+    auto expected_value = [](MeshLib::Element* const e,
+                             std::size_t const local_node_id) {
+        return 2 * (*e->getNode(local_node_id))[0] + 1;
+    };
+
+    ASSERT_TRUE(testNodalValuesOfElement(meshes[0]->getElements(),
+                                         expected_value, *parameter, t));
+}
+
+// The values written into a given array are the same as the returned ones.
+TEST_F(ParameterLibParameter, ValuesIntoArray)
+{
+    std::vector<int> mat_ids({0, 1, 0, 1});
+    MeshLib::addPropertyToMesh(*meshes[0], "MaterialIDs",
+                               MeshLib::MeshItemType::Cell, 1, mat_ids);
+    std::vector<double> element_values({0, 1, 2, 3, 4, 5, 6, 7});
+    MeshLib::addPropertyToMesh(*meshes[0], "ElementValues",
+                               MeshLib::MeshItemType::Cell, 2, element_values);
+    std::vector<double> node_ids({0, 1, 2, 3, 4});
+    MeshLib::addPropertyToMesh(*meshes[0], "NodeIDs",
+                               MeshLib::MeshItemType::Node, 1, node_ids);
+
+    std::vector<std::unique_ptr<Parameter<double>>> parameters;
+    parameters.push_back(
+        constructParameterFromString("<name>constant</name>"
+                                     "<type>Constant</type>"
+                                     "<values>1 2</values>",
+                                     meshes));
+    parameters.push_back(
+        constructParameterFromString("<name>element</name>"
+                                     "<type>MeshElement</type>"
+                                     "<field_name>ElementValues</field_name>",
+                                     meshes));
+    parameters.push_back(constructParameterFromString(
+        "<name>group</name>"
+        "<type>Group</type>"
+        "<group_id_property>MaterialIDs</group_id_property>"
+        "<index_values><index>0</index><values>3 4</values></index_values>"
+        "<index_values><index>1</index><values>5 6</values></index_values>",
+        meshes));
+    parameters.push_back(
+        constructParameterFromString("<name>function</name>"
+                                     "<type>Function</type>"
+                                     "<expression>x</expression>"
+                                     "<expression>x*x</expression>",
+                                     meshes));
+    // Uses the default implementation.
+    parameters.push_back(
+        constructParameterFromString("<name>node</name>"
+                                     "<type>MeshNode</type>"
+                                     "<field_name>NodeIDs</field_name>",
+                                     meshes));
+
+    double const t = 0;
+    for (auto const& parameter : parameters)
+    {
+        for (auto const* e : meshes[0]->getElements())
+        {
+            ParameterLib::SpatialPosition x;
+            x.setAll(e->getNodeIndex(0), e->getID(), boost::none, boost::none);
+
+            auto const expected = (*parameter)(t, x);
+            std::vector<double> values(parameter->getNumberOfComponents());
+            (*parameter)(t, x, values.data());
+            ASSERT_EQ(expected, values) << "for parameter " << parameter->name;
+        }
+    }
+}
+
+TEST_F(ParameterLibParameter, TimeFactorOfCurveScaledParameter)
+{
+    std::vector<std::unique_ptr<ParameterBase>> parameters;
+    parameters.push_back(
+        constructParameterFromString("<name>constant</name>"
+                                     "<type>Constant</type>"
+                                     "<value>3</value>",
+                                     meshes));
+
+    std::map<std::string,
+             std::unique_ptr<MathLib::PiecewiseLinearInterpolation>>
+        curves;
+    curves["linear_curve"] =
+        std::make_unique<MathLib::PiecewiseLinearInterpolation>(
+            std::vector<double>{0, 1}, std::vector<double>{0, 2}, true);
+
+    auto curve_scaled = constructParameterFromString(
+        "<name>curve_scaled</name>"
+        "<type>CurveScaled</type>"
+        "<curve>linear_curve</curve>"
+        "<parameter>constant</parameter>",
+        meshes, curves);
+    curve_scaled->initialize(parameters);
+
+    ASSERT_EQ(1.0, *parameters[0]->getTimeFactor(0.5));
+    ASSERT_EQ(1.0, *curve_scaled->getTimeFactor(0.5));
+    ParameterLib::SpatialPosition x;
+    x.setNodeID(0);
+    ASSERT_EQ(3.0, (*curve_scaled)(0.5, x)[0]);
+
+    // The factors of nested curve scaled parameters are multiplied.
+    parameters.push_back(std::move(curve_scaled));
+    auto const nested = constructParameterFromString(
+        "<name>nested</name>"
+        "<type>CurveScaled</type>"
+        "<curve>linear_curve</curve>"
+        "<parameter>curve_scaled</parameter>",
+        meshes, curves);
+    nested->initialize(parameters);
+    ASSERT_EQ(0.25, *nested->getTimeFactor(0.25));
+}
+
+TEST_F(ParameterLibParameter, TimeDependentHeterogeneousParameterNode)
+{
+    std::vector<double> node_ids({0, 1, 2, 3, 4});
+    MeshLib::addPropertyToMesh(*meshes[0], "NodeIDs",
+                               MeshLib::MeshItemType::Node, 1, node_ids);
+    std::vector<double> twice_node_ids({0, 2, 4, 6, 8});
+    MeshLib::addPropertyToMesh(*meshes[0], "TwiceNodeIDs",
+                               MeshLib::MeshItemType::Node, 1,
+                               twice_node_ids);
+
+    std::vector<std::unique_ptr<ParameterBase>> parameters;
+    parameters.push_back(
+        constructParameterFromString("<name>p0</name>"
+                                     "<type>MeshNode</type>"
+                                     "<field_name>NodeIDs</field_name>",
+                                     meshes));
+    parameters.push_back(
+        constructParameterFromString("<name>p1</name>"
+                                     "<type>MeshNode</type>"
+                                     "<field_name>TwiceNodeIDs</field_name>",
+                                     meshes));
+
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>TimeDependentHeterogeneousParameter</type>"
+        "<time_series>"
+        "  <pair><time>0</time><parameter_name>p0</parameter_name></pair>"
+        "  <pair><time>1</time><parameter_name>p1</parameter_name></pair>"
+        "</time_series>",
+        meshes);
+    parameter->initialize(parameters);
+
+    // The cached fields of several times give the interpolated values.
+    for (double const t : {0.25, 0.5, 0.25, 2.0, 0.5})
+    {
+        double const factor = 1 + std::min(t, 1.0);
+        for (std::size_t node_id = 0; node_id < node_ids.size(); ++node_id)
+        {
+            ParameterLib::SpatialPosition x;
+            x.setNodeID(node_id);
+            ASSERT_DOUBLE_EQ(factor * node_id, (*parameter)(t, x)[0]);
+        }
+    }
+}
+
+TEST_F(ParameterLibParameter, BinaryFieldParameter)
+{
+    // The parameter file is looked up relative to the project directory,
+    // which can be set only once.
+    static bool const project_directory_is_set = [] {
+        BaseLib::setProjectDirectory(TestInfoLib::TestInfo::tests_tmp_path);
+        return true;
+    }();
+    (void)project_directory_is_set;
+
+    // Two components for each of the five nodes of the mesh.
+    std::vector<double> const values{0, 1, 10, 11, 20, 21, 30, 31, 40, 41};
+    {
+        std::ofstream out(TestInfoLib::TestInfo::tests_tmp_path +
+                              "BinaryFieldParameter.bin",
+                          std::ios::binary);
+        out.write(reinterpret_cast<char const*>(values.data()),
+                  values.size() * sizeof(double));
+    }
+
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>BinaryField</type>"
+        "<file>BinaryFieldParameter.bin</file>"
+        "<mesh_item_type>Node</mesh_item_type>"
+        "<number_of_components>2</number_of_components>",
+        meshes);
+    ASSERT_EQ(2, parameter->getNumberOfComponents());
+
+    double const t = 0;
+    ParameterLib::SpatialPosition x;
+    for (std::size_t node_id = 0; node_id < 5; ++node_id)
+    {
+        x.setNodeID(node_id);
+        auto const v = (*parameter)(t, x);
+        ASSERT_EQ(10.0 * node_id, v[0]);
+        ASSERT_EQ(10.0 * node_id + 1, v[1]);
+    }
+
+    // Elements' values are looked up by the bulk element ids.
+    std::vector<std::size_t> bulk_element_ids{4, 3, 2, 1};
+    MeshLib::addPropertyToMesh(*meshes[0], "bulk_element_ids",
+                               MeshLib::MeshItemType::Cell, 1,
+                               bulk_element_ids);
+    auto const element_parameter = constructParameterFromString(
+        "<name>element_parameter</name>"
+        "<type>BinaryField</type>"
+        "<file>BinaryFieldParameter.bin</file>"
+        "<number_of_components>2</number_of_components>",
+        meshes);
+    x = ParameterLib::SpatialPosition{};
+    x.setElementID(0);
+    ASSERT_EQ(41.0, (*element_parameter)(t, x)[1]);
+    x.setElementID(3);
+    ASSERT_EQ(10.0, (*element_parameter)(t, x)[0]);
+
+    // The file is too small for five nodes with five components.
+    ASSERT_ANY_THROW(constructParameterFromString(
+        "<name>too_few_values</name>"
+        "<type>BinaryField</type>"
+        "<file>BinaryFieldParameter.bin</file>"
+        "<mesh_item_type>Node</mesh_item_type>"
+        "<number_of_components>5</number_of_components>",
+        meshes));
+}
+
+TEST_F(ParameterLibParameter, MeshInterpolatedParameter)
+{
+    // A coarse and a fine mesh of the unit square; the linear field of the
+    // coarse mesh is reproduced exactly.
+    meshes.emplace_back(MeshLib::MeshGenerator::generateRegularQuadMesh(
+        1.0, 2, MathLib::ORIGIN, "coarse"));
+    meshes.emplace_back(MeshLib::MeshGenerator::generateRegularQuadMesh(
+        1.0, 8, MathLib::ORIGIN, "fine"));
+    auto const field = [](MathLib::Point3d const& p) {
+        return 1 + 2 * p[0] + 3 * p[1];
+    };
+
+    auto const& coarse_mesh = *meshes[1];
+    std::vector<double> nodal_values;
+    for (auto const* node : coarse_mesh.getNodes())
+    {
+        nodal_values.push_back(field(*node));
+    }
+    MeshLib::addPropertyToMesh(*meshes[1], "nodal_field",
+                               MeshLib::MeshItemType::Node, 1, nodal_values);
+    std::vector<double> const cell_values{0, 1, 2, 3};
+    MeshLib::addPropertyToMesh(*meshes[1], "cell_field",
+                               MeshLib::MeshItemType::Cell, 1, cell_values);
+
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>MeshInterpolated</type>"
+        "<mesh>fine</mesh>"
+        "<source_mesh>coarse</source_mesh>"
+        "<field_name>nodal_field</field_name>",
+        meshes);
+
+    double const t = 0;
+    for (auto const* node : meshes[2]->getNodes())
+    {
+        ParameterLib::SpatialPosition x;
+        x.setNodeID(node->getID());
+        ASSERT_NEAR(field(*node), (*parameter)(t, x)[0], 1e-14);
+    }
+
+    // Positions without a node id are interpolated at their coordinates.
+    MathLib::Point3d const p{{0.3, 0.7, 0}};
+    ParameterLib::SpatialPosition x;
+    x.setCoordinates(p);
+    ASSERT_NEAR(field(p), (*parameter)(t, x)[0], 1e-14);
+
+    auto const cell_parameter = constructParameterFromString(
+        "<name>cell_parameter</name>"
+        "<type>MeshInterpolated</type>"
+        "<mesh>fine</mesh>"
+        "<source_mesh>coarse</source_mesh>"
+        "<field_name>cell_field</field_name>",
+        meshes);
+    ASSERT_EQ(2.0, (*cell_parameter)(t, x)[0]);
+}
@@ -0,0 +1,117 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/UnifiedMatrixSetters.h"
+#include "ProcessLib/CouplingAcceleration.h"
+
+namespace
+{
+// A slowly converging linear fixed-point map of two coupled "processes" with
+// two unknowns each. The fixed point is (1, 2, 3, 4).
+void couplingIteration(std::vector<GlobalVector*> const& x)
+{
+    double const M[4][4] = {{0.9, 0.05, 0.02, 0.0},
+                            {0.0, 0.85, 0.0, 0.05},
+                            {0.05, 0.0, 0.8, 0.1},
+                            {0.0, 0.1, 0.0, 0.7}};
+    double const x_star[4] = {1, 2, 3, 4};
+
+    double x_old[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        x_old[i] = x[i / 2]->get(i % 2);
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        double value = x_star[i];
+        for (int j = 0; j < 4; ++j)
+        {
+            value += M[i][j] * (x_old[j] - x_star[j]);
+        }
+        x[i / 2]->set(i % 2, value);
+    }
+}
+
+// Returns the number of coupling iterations until the norm of the residual
+// is below the tolerance.
+int solve(ProcessLib::CouplingAcceleration* acceleration)
+{
+    GlobalVector x0(2), x1(2), x_in0(2), x_in1(2);
+    std::vector<GlobalVector*> x{&x0, &x1};
+    std::vector<GlobalVector*> x_in{&x_in0, &x_in1};
+
+    if (acceleration)
+    {
+        acceleration->reset();
+    }
+    for (int iteration = 1; iteration <= 1000; ++iteration)
+    {
+        couplingIteration(x);
+
+        double residual_norm = 0;
+        for (int p = 0; p < 2; ++p)
+        {
+            GlobalVector dx(*x_in[p]);
+            MathLib::LinAlg::axpy(dx, -1, *x[p]);
+            residual_norm += MathLib::LinAlg::dot(dx, dx);
+        }
+        if (residual_norm < 1e-20)
+        {
+            EXPECT_NEAR(1, x0.get(0), 1e-8);
+            EXPECT_NEAR(2, x0.get(1), 1e-8);
+            EXPECT_NEAR(3, x1.get(0), 1e-8);
+            EXPECT_NEAR(4, x1.get(1), 1e-8);
+            return iteration;
+        }
+
+        if (acceleration)
+        {
+            acceleration->computeResiduals(x_in, x);
+            acceleration->accelerate(x_in, x);
+        }
+        else
+        {
+            MathLib::LinAlg::copy(x0, x_in0);
+            MathLib::LinAlg::copy(x1, x_in1);
+        }
+    }
+    return 1000;
+}
+}  // namespace
+
+#ifndef USE_PETSC
+TEST(ProcessLibCouplingAcceleration, ConvergesFasterThanPlainIteration)
+#else
+TEST(ProcessLibCouplingAcceleration,
+     DISABLED_ConvergesFasterThanPlainIteration)
+#endif
+{
+    int const plain_iterations = solve(nullptr);
+    EXPECT_LT(plain_iterations, 1000);
+
+    ProcessLib::AitkenRelaxation aitken(0.5);
+    int const aitken_iterations = solve(&aitken);
+    EXPECT_LT(aitken_iterations, plain_iterations / 2);
+
+    // IQN-ILS solves a linear problem of dimension four after at most six
+    // coupling iterations.
+    ProcessLib::InterfaceQuasiNewton iqn(0.5, 10);
+    EXPECT_LE(solve(&iqn), 6);
+
+    // With fewer columns it still beats the plain iteration, also after a
+    // reset of the history.
+    ProcessLib::InterfaceQuasiNewton iqn_limited(0.5, 2);
+    EXPECT_LT(solve(&iqn_limited), plain_iterations / 2);
+    EXPECT_LT(solve(&iqn_limited), plain_iterations / 2);
+}
@@ -15,6 +15,7 @@
 #include "ProcessLib/LocalAssemblerInterface.h"
 #include "ProcessLib/AnalyticalJacobianAssembler.h"
 #include "ProcessLib/CentralDifferencesJacobianAssembler.h"
+#include "ProcessLib/ForwardDifferencesJacobianAssembler.h"
 
 //! Fills a vector with values whose absolute value is between \c abs_min and
 //! \c abs_max.
@@ -486,7 +487,12 @@ public:
 template<class LocAsm>
 struct ProcessLibCentralDifferencesJacobianAssembler : public ::testing::Test
 {
-    static void test()
+    //! Compares the Jacobian of the given numerical Jacobian assembler to the
+    //! analytical one within the tolerance of the local assembler times
+    //! \c tolerance_factor.
+    template <typename NumericalJacobianAssembler>
+    static void test(NumericalJacobianAssembler& jac_asm_cd,
+                     double const tolerance_factor)
     {
         // these four local variables will be filled randomly
         std::vector<double> x;
@@ -513,16 +519,18 @@ struct ProcessLibCentralDifferencesJacobianAssembler : public ::testing::Test
             dx_dx = rnd(random_number_generator);
         }
 
-        testInner(x, xdot, dxdot_dx, dx_dx);
+        testInner(jac_asm_cd, tolerance_factor, x, xdot, dxdot_dx, dx_dx);
     }
 
 private:
-    static void testInner(std::vector<double> const& x,
+    template <typename NumericalJacobianAssembler>
+    static void testInner(NumericalJacobianAssembler& jac_asm_cd,
+                          double const tolerance_factor,
+                          std::vector<double> const& x,
                           std::vector<double> const& xdot,
                           const double dxdot_dx, const double dx_dx)
     {
         ProcessLib::AnalyticalJacobianAssembler jac_asm_ana;
-        ProcessLib::CentralDifferencesJacobianAssembler jac_asm_cd({ 1e-8 });
         LocAsm loc_asm;
 
         double const eps = std::numeric_limits<double>::epsilon();
@@ -577,7 +585,8 @@ private:
         ASSERT_EQ(x.size()*x.size(), Jac_data_ana.size());
         for (std::size_t i=0; i<x.size()*x.size(); ++i) {
             // DBUG("%lu, %g, %g", i, Jac_data_ana[i], Jac_data_cd[i]);
-            EXPECT_NEAR(Jac_data_ana[i], Jac_data_cd[i], LocAsm::getTol());
+            EXPECT_NEAR(Jac_data_ana[i], Jac_data_cd[i],
+                        tolerance_factor * LocAsm::getTol());
         }
     }
 };
@@ -606,5 +615,12 @@ TYPED_TEST_CASE(ProcessLibCentralDifferencesJacobianAssembler, TestCases);
 
 TYPED_TEST(ProcessLibCentralDifferencesJacobianAssembler, Test)
 {
-    TestFixture::test();
+    ProcessLib::CentralDifferencesJacobianAssembler jac_asm_cd({1e-8});
+    TestFixture::test(jac_asm_cd, 1.0);
+}
+
+TYPED_TEST(ProcessLibCentralDifferencesJacobianAssembler, ForwardDifferences)
+{
+    ProcessLib::ForwardDifferencesJacobianAssembler jac_asm_fd({1e-8});
+    TestFixture::test(jac_asm_fd, 100.0);
 }
@@ -0,0 +1,47 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "ProcessLib/Deformation/LinearBMatrix.h"
+
+TEST(ProcessLibLinearBMatrix, BBarReplacesVolumetricPart)
+{
+    // Kelvin vector size 4 in 2D, 4 nodes with 2 displacement components.
+    using BMatrixType = Eigen::Matrix<double, 4, 8, Eigen::RowMajor>;
+    BMatrixType const B = BMatrixType::Random();
+    Eigen::Matrix<double, 1, 8> const b_bar =
+        Eigen::Matrix<double, 1, 8>::Random();
+
+    BMatrixType B_bar = B;
+    ProcessLib::LinearBMatrix::applyBBar(b_bar, B_bar);
+
+    // The volumetric part is replaced.
+    ASSERT_TRUE(ProcessLib::LinearBMatrix::volumetricBMatrixPart(B_bar)
+                    .isApprox(b_bar, 1e-14));
+
+    // The deviatoric part is kept: all normal strain rows are shifted by the
+    // same amount and the shear row is unchanged.
+    BMatrixType const difference = B_bar - B;
+    ASSERT_TRUE(difference.row(0).isApprox(difference.row(1), 1e-14));
+    ASSERT_TRUE(difference.row(0).isApprox(difference.row(2), 1e-14));
+    ASSERT_EQ(B.row(3), B_bar.row(3));
+}
+
+TEST(ProcessLibLinearBMatrix, BBarKeepsUniformVolumetricPart)
+{
+    using BMatrixType = Eigen::Matrix<double, 6, 24, Eigen::RowMajor>;
+    BMatrixType const B = BMatrixType::Random();
+
+    BMatrixType B_bar = B;
+    ProcessLib::LinearBMatrix::applyBBar(
+        ProcessLib::LinearBMatrix::volumetricBMatrixPart(B), B_bar);
+
+    ASSERT_TRUE(B_bar.isApprox(B, 1e-14));
+}
@@ -0,0 +1,111 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "ProcessLib/Deformation/MechanicsIntegrationPointStore.h"
+
+TEST(ProcessLibMechanicsIntegrationPointStore, ViewsAccessDisjointRanges)
+{
+    using Store = ProcessLib::Deformation::MechanicsIntegrationPointStore<2>;
+    using View = ProcessLib::Deformation::MechanicsIntegrationPointView<2>;
+    Store store;
+
+    View first(store, 4);
+    View second(store, 3);
+    ASSERT_EQ(7u, store.size());
+    ASSERT_EQ(4u, first.size());
+    ASSERT_EQ(3u, second.size());
+
+    // All values are zero-initialized.
+    for (unsigned ip = 0; ip < second.size(); ++ip)
+    {
+        ASSERT_EQ(0.0, second.sigma(ip).norm());
+        ASSERT_EQ(0.0, second.eps_prev(ip).norm());
+        ASSERT_EQ(0.0, second.free_energy_density(ip));
+    }
+
+    first.beginStateUpdate();
+    for (unsigned ip = 0; ip < first.size(); ++ip)
+    {
+        first.sigma(ip).setConstant(ip + 1.0);
+        first.eps(ip).setConstant(-(ip + 1.0));
+        first.integration_weight(ip) = 0.25;
+    }
+    second.beginStateUpdate();
+    second.sigma(0).setConstant(10.0);
+
+    // The data of one element are contiguous in the store.
+    for (unsigned ip = 0; ip < first.size(); ++ip)
+    {
+        ASSERT_EQ(&first.sigma(0) + ip, &first.sigma(ip));
+        ASSERT_EQ(ip + 1.0, first.sigma_data()[ip][0]);
+    }
+    ASSERT_EQ(&first.sigma(0) + first.size(), &second.sigma(0));
+
+    first.pushBackState();
+    for (unsigned ip = 0; ip < first.size(); ++ip)
+    {
+        ASSERT_EQ(first.sigma(ip), first.sigma_prev(ip));
+        ASSERT_EQ(first.eps(ip), first.eps_prev(ip));
+    }
+    // The other element's previous state is untouched.
+    ASSERT_EQ(0.0, second.sigma_prev(0).norm());
+}
+
+TEST(ProcessLibMechanicsIntegrationPointStore, PushBackStateSwapsBuffers)
+{
+    using Store = ProcessLib::Deformation::MechanicsIntegrationPointStore<2>;
+    using View = ProcessLib::Deformation::MechanicsIntegrationPointView<2>;
+    Store store;
+    View view(store, 2);
+
+    // Initial conditions are the current and the previous state.
+    view.sigma(0).setConstant(1.0);
+    view.pushBackState();
+    ASSERT_EQ(1.0, view.sigma(0)[0]);
+    ASSERT_EQ(1.0, view.sigma_prev(0)[0]);
+
+    for (int step = 2; step < 5; ++step)
+    {
+        view.beginStateUpdate();
+        auto const* const previous = &view.sigma_prev(0);
+        for (unsigned ip = 0; ip < view.size(); ++ip)
+        {
+            view.sigma(ip).setConstant(step);
+            view.eps(ip).setConstant(-step);
+        }
+        ASSERT_EQ(step - 1.0, view.sigma_prev(0)[0]);
+
+        view.pushBackState();
+        ASSERT_EQ(step, view.sigma(1)[0]);
+        ASSERT_EQ(step, view.sigma_prev(1)[0]);
+        ASSERT_EQ(-step, view.eps_prev(1)[0]);
+        // The data were not copied, the buffers changed their roles.
+        ASSERT_NE(previous, &view.sigma_prev(0));
+    }
+
+    // The checkpoint data are the current state.
+    Store::KelvinVectorArray sigma;
+    Store::KelvinVectorArray eps;
+    store.getState(sigma, eps);
+    ASSERT_EQ(4.0, sigma[0][0]);
+    ASSERT_EQ(-4.0, eps[1][0]);
+
+    // A rejected state is discarded by the next update.
+    view.beginStateUpdate();
+    view.sigma(0).setConstant(100.0);
+    view.beginStateUpdate();
+    ASSERT_EQ(4.0, view.sigma_prev(0)[0]);
+
+    sigma[0].setConstant(7.0);
+    store.setState(sigma, eps);
+    ASSERT_EQ(7.0, view.sigma(0)[0]);
+    ASSERT_EQ(7.0, view.sigma_prev(0)[0]);
+}
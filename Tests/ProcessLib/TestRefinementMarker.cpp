@@ -0,0 +1,33 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "ProcessLib/Output/RefinementMarker.h"
+
+TEST(ProcessLibRefinementMarker, BulkCriterion)
+{
+    // Squared indicators: 16, 9, 4, 1, 0.25, 0.01; total 30.26.
+    std::vector<double> const indicators{0.5, 4, 0.1, 2, 3, 1};
+
+    ProcessLib::RefinementMarkerParameters parameters;
+    parameters.refine_fraction = 0.8;
+    parameters.coarsen_fraction = 0.01;
+    EXPECT_EQ((std::vector<int>{-1, 1, -1, 0, 1, 0}),
+              ProcessLib::markElementsForRefinement(indicators, parameters));
+
+    // Elements marked for refinement are never coarsened.
+    parameters.refine_fraction = 1;
+    parameters.coarsen_fraction = 0.5;
+    EXPECT_EQ((std::vector<int>{1, 1, 1, 1, 1, 1}),
+              ProcessLib::markElementsForRefinement(indicators, parameters));
+
+    EXPECT_EQ((std::vector<int>{0, 0}),
+              ProcessLib::markElementsForRefinement({0, 0}, parameters));
+}
@@ -0,0 +1,75 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/UnifiedMatrixSetters.h"
+#include "ProcessLib/SolutionPredictor.h"
+
+namespace
+{
+// Quadratic in time with a different coefficient for each component.
+GlobalVector solution(double const t)
+{
+    GlobalVector x(2);
+    MathLib::setVector(x, {1 + 2 * t, 3 - t + 0.5 * t * t});
+    return x;
+}
+
+void expectSolution(double const t, GlobalVector const& x)
+{
+    auto const expected = solution(t);
+    for (GlobalIndexType i = 0; i < 2; ++i)
+    {
+        EXPECT_NEAR(expected.get(i), x.get(i), 1e-12);
+    }
+}
+}  // namespace
+
+#ifndef USE_PETSC
+TEST(ProcessLibSolutionPredictor, ExtrapolatesWithVaryingStepSizes)
+#else
+TEST(ProcessLibSolutionPredictor, DISABLED_ExtrapolatesWithVaryingStepSizes)
+#endif
+{
+    ProcessLib::SolutionPredictor predictor(2);
+
+    // Without previous solutions the latest solution is kept.
+    auto x = solution(0);
+    predictor.pushAcceptedSolution(0, x);
+    predictor.predict(1, x);
+    expectSolution(0, x);
+
+    // The linear extrapolation through two solutions matches the linear
+    // component only.
+    x = solution(1);
+    predictor.pushAcceptedSolution(1, x);
+    predictor.predict(3, x);
+    EXPECT_NEAR(solution(3).get(0), x.get(0), 1e-12);
+    EXPECT_NE(solution(3).get(1), x.get(1));
+
+    // The quadratic extrapolation is exact for both components.
+    x = solution(3);
+    predictor.pushAcceptedSolution(3, x);
+    predictor.predict(3.5, x);
+    expectSolution(3.5, x);
+
+    // Only the latest three solutions are used.
+    x = solution(3.5);
+    predictor.pushAcceptedSolution(3.5, x);
+    predictor.predict(5, x);
+    expectSolution(5, x);
+
+    // After a restart the next step starts from the latest solution.
+    x = solution(3.5);
+    predictor.restart();
+    predictor.predict(5, x);
+    expectSolution(3.5, x);
+}
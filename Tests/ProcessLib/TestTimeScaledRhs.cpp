@@ -0,0 +1,53 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/UnifiedMatrixSetters.h"
+#include "ProcessLib/Utils/TimeScaledRhs.h"
+
+#ifndef USE_PETSC
+TEST(ProcessLibTimeScaledRhs, AssemblesOnlyOnceForNonzeroFactor)
+#else
+TEST(ProcessLibTimeScaledRhs, DISABLED_AssemblesOnlyOnceForNonzeroFactor)
+#endif
+{
+    ProcessLib::TimeScaledRhs rhs;
+    int number_of_assemblies = 0;
+    double factor = 0;
+
+    // Adds factor * (0, 2, 0, -1).
+    auto const assemble = [&](GlobalVector& b) {
+        ++number_of_assemblies;
+        b.add(1, 2 * factor);
+        b.add(3, -factor);
+    };
+
+    GlobalVector b(4);
+    MathLib::setVector(b, {1, 1, 1, 1});
+
+    // A zero factor doesn't require the assembly.
+    rhs.add(factor, b, assemble);
+    EXPECT_EQ(0, number_of_assemblies);
+
+    for (double const f : {0.5, 2.0, 0.0, -1.0})
+    {
+        factor = f;
+        MathLib::setVector(b, {1, 1, 1, 1});
+        rhs.add(factor, b, assemble);
+        MathLib::LinAlg::finalizeAssembly(b);
+
+        EXPECT_DOUBLE_EQ(1, b[0]);
+        EXPECT_DOUBLE_EQ(1 + 2 * f, b[1]);
+        EXPECT_DOUBLE_EQ(1, b[2]);
+        EXPECT_DOUBLE_EQ(1 - f, b[3]);
+    }
+    EXPECT_EQ(1, number_of_assemblies);
+}
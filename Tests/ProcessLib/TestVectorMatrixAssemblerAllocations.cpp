@@ -0,0 +1,407 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "ProcessLib/AnalyticalJacobianAssembler.h"
+#include "ProcessLib/CentralDifferencesJacobianAssembler.h"
+#include "ProcessLib/LocalAssemblerInterface.h"
+#include "ProcessLib/VectorMatrixAssembler.h"
+
+// The test relies on the global matrices being Eigen matrices.
+#ifndef USE_PETSC
+
+namespace
+{
+std::atomic<bool> count_allocations{false};
+std::atomic<std::size_t> number_of_allocations{0};
+}  // namespace
+
+// Replacements of the global allocation functions counting the allocations
+// while count_allocations is set. Eigen's dynamic matrices allocate via
+// malloc and are not counted.
+void* operator new(std::size_t size)
+{
+    if (count_allocations)
+    {
+        ++number_of_allocations;
+    }
+    if (void* const p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t /*size*/) noexcept
+{
+    ::operator delete(p);
+}
+
+namespace
+{
+//! Local assembler of a linear two-node element using fixed-size local
+//! matrices like the FEM implementations of the processes.
+class LineElementAssembler final : public ProcessLib::LocalAssemblerInterface
+{
+    using LocalMatrix = Eigen::Matrix<double, 2, 2, Eigen::RowMajor>;
+    using LocalVector = Eigen::Matrix<double, 2, 1>;
+
+public:
+    void assemble(double const /*t*/, double const /*dt*/,
+                  std::vector<double> const& local_x,
+                  std::vector<double> const& /*local_xdot*/,
+                  std::vector<double>& local_M_data,
+                  std::vector<double>& local_K_data,
+                  std::vector<double>& local_b_data) override
+    {
+        auto M = MathLib::createZeroedMatrix<LocalMatrix>(local_M_data, 2, 2);
+        auto K = MathLib::createZeroedMatrix<LocalMatrix>(local_K_data, 2, 2);
+        auto b = MathLib::createZeroedVector<LocalVector>(local_b_data, 2);
+
+        auto const x = MathLib::toVector<LocalVector>(local_x, 2);
+        M << 2, 1, 1, 2;
+        K << 1 + x[0] * x[0], -1, -1, 1 + x[1] * x[1];
+        b << 1, 1;
+    }
+
+    void assembleWithJacobian(double const t, double const dt,
+                              std::vector<double> const& local_x,
+                              std::vector<double> const& local_xdot,
+                              const double /*dxdot_dx*/, const double /*dx_dx*/,
+                              std::vector<double>& local_M_data,
+                              std::vector<double>& local_K_data,
+                              std::vector<double>& local_b_data,
+                              std::vector<double>& local_Jac_data) override
+    {
+        assemble(t, dt, local_x, local_xdot, local_M_data, local_K_data,
+                 local_b_data);
+        auto Jac =
+            MathLib::createZeroedMatrix<LocalMatrix>(local_Jac_data, 2, 2);
+        Jac = MathLib::toMatrix<LocalMatrix>(local_K_data, 2, 2);
+    }
+};
+
+class ProcessLibVectorMatrixAssemblerAllocations : public ::testing::Test
+{
+public:
+    ProcessLibVectorMatrixAssemblerAllocations()
+        : mesh(MeshLib::MeshGenerator::generateLineMesh(1.0, 20)),
+          mesh_subset(*mesh, mesh->getNodes()),
+          dof_table({mesh_subset}, NumLib::ComponentOrder::BY_COMPONENT),
+          n(dof_table.dofSizeWithoutGhosts()),
+          M(n, 3),
+          K(n, 3),
+          Jac(n, 3),
+          b(n),
+          x(n),
+          xdot(n),
+          dof_tables{dof_table},
+          xs{&x},
+          xdots{&xdot}
+    {
+        for (std::size_t i = 0; i < mesh->getNumberOfElements(); ++i)
+        {
+            local_assemblers.push_back(
+                std::make_unique<LineElementAssembler>());
+        }
+        for (GlobalIndexType i = 0; i < n; ++i)
+        {
+            x.set(i, 0.1 * i);
+        }
+    }
+
+    void assemble(ProcessLib::VectorMatrixAssembler& assembler)
+    {
+        for (std::size_t i = 0; i < local_assemblers.size(); ++i)
+        {
+            assembler.assemble(i, *local_assemblers[i], dof_tables, 0.0, 1.0,
+                               xs, xdots, 0, M, K, b, nullptr);
+        }
+    }
+
+    void assembleWithJacobian(ProcessLib::VectorMatrixAssembler& assembler)
+    {
+        for (std::size_t i = 0; i < local_assemblers.size(); ++i)
+        {
+            assembler.assembleWithJacobian(i, *local_assemblers[i], dof_tables,
+                                           0.0, 1.0, xs, xdot, 1.0, 1.0, 0, M,
+                                           K, b, Jac, nullptr);
+        }
+    }
+
+    //! Returns the number of allocations during the call of \c f.
+    template <typename F>
+    static std::size_t countAllocations(F const& f)
+    {
+        number_of_allocations = 0;
+        count_allocations = true;
+        f();
+        count_allocations = false;
+        return number_of_allocations;
+    }
+
+protected:
+    std::unique_ptr<MeshLib::Mesh> const mesh;
+    MeshLib::MeshSubset const mesh_subset;
+    NumLib::LocalToGlobalIndexMap dof_table;
+    GlobalIndexType const n;
+
+    std::vector<std::unique_ptr<ProcessLib::LocalAssemblerInterface>>
+        local_assemblers;
+
+    GlobalMatrix M;
+    GlobalMatrix K;
+    GlobalMatrix Jac;
+    GlobalVector b;
+    GlobalVector x;
+    GlobalVector xdot;
+
+    // The arguments of the assembly are set up once, such that only the
+    // allocations of the assembly itself are counted.
+    std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
+        dof_tables;
+    std::vector<GlobalVector*> xs;
+    std::vector<GlobalVector*> xdots;
+};
+}  // namespace
+
+TEST_F(ProcessLibVectorMatrixAssemblerAllocations, Assemble)
+{
+    ProcessLib::VectorMatrixAssembler assembler(
+        std::make_unique<ProcessLib::AnalyticalJacobianAssembler>());
+
+    // The first assembly inserts the entries of the global matrices and
+    // establishes the capacities of the assembler's buffers.
+    assemble(assembler);
+
+    ASSERT_EQ(0u, countAllocations([&] { assemble(assembler); }));
+}
+
+TEST_F(ProcessLibVectorMatrixAssemblerAllocations, AssembleWithJacobian)
+{
+    ProcessLib::VectorMatrixAssembler analytical_assembler(
+        std::make_unique<ProcessLib::AnalyticalJacobianAssembler>());
+    assembleWithJacobian(analytical_assembler);
+    ASSERT_EQ(0u, countAllocations(
+                      [&] { assembleWithJacobian(analytical_assembler); }));
+
+    ProcessLib::VectorMatrixAssembler central_differences_assembler(
+        std::make_unique<ProcessLib::CentralDifferencesJacobianAssembler>(
+            std::vector<double>{1e-8}));
+    assembleWithJacobian(central_differences_assembler);
+    ASSERT_EQ(0u, countAllocations([&] {
+                  assembleWithJacobian(central_differences_assembler);
+              }));
+}
+
+TEST_F(ProcessLibVectorMatrixAssemblerAllocations, AssembleWithScatterMaps)
+{
+    ProcessLib::VectorMatrixAssembler assembler(
+        std::make_unique<ProcessLib::AnalyticalJacobianAssembler>());
+    assembler.enableScatterMaps();
+
+    // In the first assembly the matrices are not compressed yet and the
+    // scatter maps are not used.
+    assembler.prepareAssembly(0, local_assemblers.size(), M, K, nullptr);
+    assemble(assembler);
+    M.getRawMatrix().makeCompressed();
+    K.getRawMatrix().makeCompressed();
+    GlobalMatrix const M_expected = M;
+    GlobalMatrix const K_expected = K;
+
+    // The second assembly computes the positions of the entries.
+    M.setZero();
+    K.setZero();
+    assembler.prepareAssembly(0, local_assemblers.size(), M, K, nullptr);
+    assemble(assembler);
+
+    M.setZero();
+    K.setZero();
+    assembler.prepareAssembly(0, local_assemblers.size(), M, K, nullptr);
+    ASSERT_EQ(0u, countAllocations([&] { assemble(assembler); }));
+
+    for (GlobalIndexType i = 0; i < n; ++i)
+    {
+        for (GlobalIndexType j = 0; j < n; ++j)
+        {
+            ASSERT_EQ(M_expected.get(i, j), M.get(i, j));
+            ASSERT_EQ(K_expected.get(i, j), K.get(i, j));
+        }
+    }
+}
+
+TEST_F(ProcessLibVectorMatrixAssemblerAllocations, ElementwiseResidual)
+{
+    for (GlobalIndexType i = 0; i < n; ++i)
+    {
+        xdot.set(i, 1.0 - 0.05 * i);
+    }
+
+    ProcessLib::VectorMatrixAssembler assembler(
+        std::make_unique<ProcessLib::AnalyticalJacobianAssembler>());
+    assembleWithJacobian(assembler);
+
+    // r = M * xdot + K * x - b
+    GlobalVector residual(n);
+    MathLib::LinAlg::matMult(M, xdot, residual);
+    MathLib::LinAlg::matMultAdd(K, x, residual, residual);
+    MathLib::LinAlg::axpy(residual, -1.0, b);
+    GlobalMatrix const Jac_expected = Jac;
+
+    GlobalMatrix M_boundary(n);
+    GlobalMatrix K_boundary(n);
+    GlobalVector minus_residual(n);
+    Jac.setZero();
+    assembler.setElementwiseResidual(true);
+    for (std::size_t i = 0; i < local_assemblers.size(); ++i)
+    {
+        assembler.assembleWithJacobian(i, *local_assemblers[i], dof_tables,
+                                       0.0, 1.0, xs, xdot, 1.0, 1.0, 0,
+                                       M_boundary, K_boundary, minus_residual,
+                                       Jac, nullptr);
+    }
+
+    ASSERT_EQ(0, M_boundary.getRawMatrix().nonZeros());
+    ASSERT_EQ(0, K_boundary.getRawMatrix().nonZeros());
+    for (GlobalIndexType i = 0; i < n; ++i)
+    {
+        ASSERT_NEAR(residual.get(i), -minus_residual.get(i), 1e-14);
+        for (GlobalIndexType j = 0; j < n; ++j)
+        {
+            ASSERT_EQ(Jac_expected.get(i, j), Jac.get(i, j));
+        }
+    }
+}
+
+TEST_F(ProcessLibVectorMatrixAssemblerAllocations, LumpedMass)
+{
+    ProcessLib::VectorMatrixAssembler assembler(
+        std::make_unique<ProcessLib::AnalyticalJacobianAssembler>());
+    b.setZero();
+    assemble(assembler);
+
+    // b - K * x
+    GlobalVector rhs(n);
+    MathLib::LinAlg::matMult(K, x, rhs);
+    MathLib::LinAlg::aypx(rhs, -1.0, b);
+
+    GlobalMatrix M_lumped(n);
+    GlobalMatrix K_boundary(n);
+    GlobalVector b_lumped(n);
+    b_lumped.setZero();
+    assembler.setLumpedMass(true);
+    assembler.prepareAssembly(0, local_assemblers.size(), M_lumped,
+                              K_boundary, nullptr);
+    for (std::size_t i = 0; i < local_assemblers.size(); ++i)
+    {
+        assembler.assemble(i, *local_assemblers[i], dof_tables, 0.0, 1.0, xs,
+                           xdots, 0, M_lumped, K_boundary, b_lumped, nullptr);
+    }
+    assembler.finishAssembly(0);
+
+    ASSERT_EQ(n, M_lumped.getRawMatrix().nonZeros());
+    ASSERT_EQ(0, K_boundary.getRawMatrix().nonZeros());
+    for (GlobalIndexType i = 0; i < n; ++i)
+    {
+        double row_sum = 0;
+        for (GlobalIndexType j = 0; j < n; ++j)
+        {
+            row_sum += M.get(i, j);
+        }
+        ASSERT_EQ(row_sum, M_lumped.get(i, i));
+        ASSERT_NEAR(rhs.get(i), b_lumped.get(i), 1e-14);
+    }
+
+    // The largest row sum of |K_e| is 1 + 2^2 + 1 at the last node, the
+    // lumped mass of each element node is 3, hence 2 / (6 / 3).
+    EXPECT_DOUBLE_EQ(1.0, assembler.getStableTimeStep(0));
+    EXPECT_EQ(std::numeric_limits<double>::infinity(),
+              assembler.getStableTimeStep(1));
+}
+
+TEST_F(ProcessLibVectorMatrixAssemblerAllocations, IncrementalAssembly)
+{
+    ProcessLib::VectorMatrixAssembler assembler(
+        std::make_unique<ProcessLib::AnalyticalJacobianAssembler>());
+    assembler.enableIncrementalAssembly(1e-6, 2);
+
+    // Returns the diagonal entry of K at the second node, which depends on
+    // the solution at that node.
+    auto assembleK11 = [&]() {
+        M.setZero();
+        K.setZero();
+        assembler.prepareAssembly(0, local_assemblers.size(), M, K, nullptr);
+        assemble(assembler);
+        assembler.finishAssembly(0);
+        return K.get(1, 1);
+    };
+
+    double const K11 = assembleK11();
+    EXPECT_DOUBLE_EQ(2 + 2 * 0.1 * 0.1, K11);
+
+    // Changes below the tolerance reuse the cached contributions up to the
+    // maximum number of reuses.
+    x.set(1, 0.1 + 1e-9);
+    EXPECT_EQ(K11, assembleK11());
+    EXPECT_EQ(K11, assembleK11());
+    EXPECT_NE(K11, assembleK11());
+
+    // Larger changes are always reassembled.
+    x.set(1, 0.2);
+    EXPECT_DOUBLE_EQ(2 + 2 * 0.2 * 0.2, assembleK11());
+}
+
+TEST_F(ProcessLibVectorMatrixAssemblerAllocations, ElementTiming)
+{
+    ProcessLib::VectorMatrixAssembler assembler(
+        std::make_unique<ProcessLib::AnalyticalJacobianAssembler>());
+    std::vector<double> times(local_assemblers.size(), 0.0);
+    assembler.enableElementTiming(times);
+
+    assembler.prepareAssembly(0, local_assemblers.size(), M, K, nullptr);
+    assemble(assembler);
+    assembler.finishAssembly(0);
+    auto const first_times = times;
+    for (auto const t : first_times)
+    {
+        EXPECT_LT(0.0, t);
+    }
+
+    // The times are accumulated over subsequent assemblies, which do not
+    // allocate memory for the timing.
+    assembler.prepareAssembly(0, local_assemblers.size(), M, K, nullptr);
+    ASSERT_EQ(0u, countAllocations([&] { assemble(assembler); }));
+    assembler.finishAssembly(0);
+    for (std::size_t i = 0; i < times.size(); ++i)
+    {
+        EXPECT_LT(first_times[i], times[i]);
+    }
+}
+
+#endif  // USE_PETSC
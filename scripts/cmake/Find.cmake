@@ -55,13 +55,13 @@ find_program(MODULE_CMD modulecmd
 ######################
 find_package(Boost ${ogs.minimum_version.boost} REQUIRED)
 
-set(VTK_COMPONENTS vtkIOXML)
+set(VTK_COMPONENTS vtkIOXML vtkzlib)
 if(OGS_BUILD_GUI)
     set(VTK_COMPONENTS ${VTK_COMPONENTS}
         vtkIOImage vtkIOLegacy vtkIOExport vtkIOExportPDF
         vtkIOExportOpenGL2 vtkInteractionStyle vtkInteractionWidgets
         vtkGUISupportQt vtkRenderingOpenGL2 vtkRenderingContextOpenGL2
-        vtkFiltersTexture vtkRenderingCore
+        vtkFiltersTexture vtkRenderingCore vtkRenderingLOD
     )
 endif()
 if(OGS_USE_MPI)
@@ -119,6 +119,11 @@ if(OGS_USE_NETCDF)
     add_compile_options(-DOGS_USE_NETCDF)
 endif()
 
+if(OGS_USE_XDMF)
+    find_package(HDF5 REQUIRED COMPONENTS C)
+    add_compile_options(-DOGS_USE_XDMF)
+endif()
+
 # lapack
 find_package(LAPACK QUIET)
 
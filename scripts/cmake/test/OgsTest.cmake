@@ -2,7 +2,7 @@ function (OgsTest)
     if(NOT OGS_BUILD_CLI)
         return()
     endif()
-    set(options LARGE)
+    set(options LARGE PERFORMANCE)
     set(oneValueArgs PROJECTFILE RUNTIME)
     set(multiValueArgs WRAPPER)
     cmake_parse_arguments(OgsTest "${options}" "${oneValueArgs}"
@@ -37,11 +37,18 @@ function (OgsTest)
     if (${OgsTest_LARGE})
         set(TEST_NAME "${TEST_NAME}-LARGE")
     endif()
+    # Add -PERFORMANCE tag. These tests record the timing of the run and
+    # compare it to a baseline.
+    if (${OgsTest_PERFORMANCE})
+        set(TEST_NAME "${TEST_NAME}-PERFORMANCE")
+        set(OgsTest_TIMING_FILE "${OgsTest_BINARY_DIR}/${OgsTest_NAME_WE}_timing.json")
+        set(OgsTest_TIMING_ARGS --timing-output ${OgsTest_TIMING_FILE})
+    endif()
 
     add_test(
         NAME ${TEST_NAME}
         WORKING_DIRECTORY "${OgsTest_BINARY_DIR}"
-        COMMAND ${OgsTest_WRAPPER} $<TARGET_FILE:ogs> -r ${OgsTest_SOURCE_DIR} ${OgsTest_SOURCE_DIR}/${OgsTest_NAME})
+        COMMAND ${OgsTest_WRAPPER} $<TARGET_FILE:ogs> -r ${OgsTest_SOURCE_DIR} ${OgsTest_TIMING_ARGS} ${OgsTest_SOURCE_DIR}/${OgsTest_NAME})
     # For debugging:
     #message("Adding test with
     #    NAME ${TEST_NAME}
@@ -52,6 +59,21 @@ function (OgsTest)
         ENVIRONMENT VTKDIFF_EXE=$<TARGET_FILE:vtkdiff>
         COST ${OgsTest_RUNTIME})
 
+    if (${OgsTest_PERFORMANCE} AND TARGET compareTimings)
+        set(OgsTest_BASELINE_DIR "${OGS_PERFORMANCE_BASELINE_DIR}/${OgsTest_DIR}")
+        file(MAKE_DIRECTORY ${OgsTest_BASELINE_DIR})
+        set_tests_properties(${TEST_NAME} PROPERTIES
+            FIXTURES_SETUP ${TEST_NAME}-timing)
+        add_test(
+            NAME ${TEST_NAME}-compare
+            COMMAND $<TARGET_FILE:compareTimings>
+                -i ${OgsTest_TIMING_FILE}
+                -b ${OgsTest_BASELINE_DIR}/${OgsTest_NAME_WE}.json
+                -t ${OGS_PERFORMANCE_TOLERANCE})
+        set_tests_properties(${TEST_NAME}-compare PROPERTIES
+            FIXTURES_REQUIRED ${TEST_NAME}-timing)
+    endif()
+
     if(TARGET ${OgsTest_EXECUTABLE})
         add_dependencies(ctest ${OgsTest_EXECUTABLE})
         add_dependencies(ctest-large ${OgsTest_EXECUTABLE})
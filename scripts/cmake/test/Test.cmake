@@ -34,6 +34,13 @@ configure_file(
     ${PROJECT_BINARY_DIR}/CTestCustom.cmake
 )
 
+# Performance tests compare the timing of a run to a baseline stored here. A
+# missing baseline is created from the first run.
+set(OGS_PERFORMANCE_BASELINE_DIR "${PROJECT_BINARY_DIR}/PerformanceBaselines"
+    CACHE PATH "Directory of the timing baselines of the performance tests.")
+set(OGS_PERFORMANCE_TOLERANCE 0.2 CACHE STRING
+    "Allowed relative slowdown of a timed region in the performance tests.")
+
 include(${CMAKE_CURRENT_SOURCE_DIR}/scripts/cmake/test/AddTest.cmake)
 include(${CMAKE_CURRENT_SOURCE_DIR}/scripts/cmake/test/MeshTest.cmake)
 include(${CMAKE_CURRENT_SOURCE_DIR}/scripts/cmake/test/OgsTest.cmake)
@@ -81,7 +88,7 @@ add_custom_target(
     COMMAND ${CMAKE_CTEST_COMMAND} -T Test
     --force-new-ctest-process
     --output-on-failure --output-log Tests/ctest.log
-    --exclude-regex LARGE
+    --exclude-regex "LARGE|PERFORMANCE"
     ${CONFIG_PARAMETER} --parallel ${NUM_CTEST_PROCESSORS}
     --timeout 900 # 15 minutes
     DEPENDS ${test_dependencies} ctest-cleanup
@@ -93,7 +100,7 @@ add_custom_target(
     COMMAND ${CMAKE_CTEST_COMMAND} -T Test
     --force-new-ctest-process
     --output-on-failure --output-log Tests/ctest.log
-    --exclude-regex LARGE
+    --exclude-regex "LARGE|PERFORMANCE"
     ${CONFIG_PARAMETER}
     --timeout 900 # 15 minutes
     DEPENDS ${test_dependencies} ctest-cleanup
@@ -107,7 +114,7 @@ add_custom_target(
     COMMAND ${CMAKE_CTEST_COMMAND} -T Test
     --force-new-ctest-process
     --output-on-failure --output-log Tests/ctest-large.log
-    --tests-regex LARGE
+    --tests-regex LARGE --exclude-regex PERFORMANCE
     ${CONFIG_PARAMETER} --parallel ${NUM_CTEST_LARGE_PROCESSORS}
     --timeout 3600
     DEPENDS ${test_dependencies} ctest-large-cleanup
@@ -119,16 +126,36 @@ add_custom_target(
     COMMAND ${CMAKE_CTEST_COMMAND} -T Test
     --force-new-ctest-process
     --output-on-failure --output-log Tests/ctest-large.log
-    --tests-regex LARGE
+    --tests-regex LARGE --exclude-regex PERFORMANCE
     ${CONFIG_PARAMETER}
     --timeout 3600
     DEPENDS ${test_dependencies} ctest-large-cleanup
     USES_TERMINAL
 )
 
+add_custom_target(ctest-performance-cleanup ${CMAKE_COMMAND} -E remove -f Tests/ctest-performance.log)
+
+set(performance_test_dependencies ${test_dependencies})
+if(OGS_BUILD_UTILS)
+    list(APPEND performance_test_dependencies compareTimings)
+endif()
+# Always serial, such that the timings are not disturbed by other tests.
+add_custom_target(
+    ctest-performance
+    COMMAND ${CMAKE_CTEST_COMMAND} -T Test
+    --force-new-ctest-process
+    --output-on-failure --output-log Tests/ctest-performance.log
+    --tests-regex PERFORMANCE
+    ${CONFIG_PARAMETER}
+    --timeout 3600
+    DEPENDS ${performance_test_dependencies} ctest-performance-cleanup
+    USES_TERMINAL
+)
+
 set_directory_properties(PROPERTIES
     ADDITIONAL_MAKE_CLEAN_FILES ${PROJECT_BINARY_DIR}/Tests/Data
 )
 
 set_target_properties(ctest ctest-large ctest-large-serial ctest-cleanup ctest-large-cleanup
+    ctest-performance ctest-performance-cleanup
     PROPERTIES FOLDER Testing)